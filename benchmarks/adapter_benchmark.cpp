@@ -3,7 +3,8 @@
  * @brief Performance benchmarks for pacs_bridge adapter implementations
  *
  * Measures throughput, latency, and scalability of each adapter:
- * - Database adapter (SQLite in-memory)
+ * - Database adapter (SQLite in-memory), including per-dequeue cost with
+ *   and without the statement cache and epoch-microsecond timestamps
  * - Thread adapter (worker pool)
  * - Executor adapter (simple_executor)
  * - PACS adapter (stub MPPS/MWL/Storage)
@@ -32,11 +33,13 @@
 #include <atomic>
 #include <chrono>
 #include <cmath>
+#include <ctime>
 #include <future>
 #include <iomanip>
 #include <iostream>
 #include <mutex>
 #include <numeric>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <vector>
@@ -406,6 +409,178 @@ bool test_database_connection_pool() {
     return true;
 }
 
+/**
+ * @brief Queue schema and per-connection setup for one dequeue case
+ */
+struct dequeue_case {
+    const char* label;
+    std::size_t statement_cache_size;
+    bool epoch_micros;
+};
+
+static std::string format_text_timestamp(std::chrono::system_clock::time_point tp) {
+    auto time_t_val = std::chrono::system_clock::to_time_t(tp);
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      tp.time_since_epoch()).count() % 1000;
+    std::tm tm_val{};
+    gmtime_r(&time_t_val, &tm_val);
+    std::ostringstream oss;
+    oss << std::put_time(&tm_val, "%Y-%m-%d %H:%M:%S") << '.'
+        << std::setfill('0') << std::setw(3) << millis;
+    return oss.str();
+}
+
+static std::chrono::system_clock::time_point parse_text_timestamp(
+    const std::string& str) {
+    std::tm tm_val{};
+    int millis = 0;
+    std::istringstream iss(str);
+    iss >> std::get_time(&tm_val, "%Y-%m-%d %H:%M:%S");
+    if (iss.peek() == '.') {
+        iss.ignore();
+        iss >> millis;
+    }
+    return std::chrono::system_clock::from_time_t(timegm(&tm_val)) +
+           std::chrono::milliseconds(millis);
+}
+
+/**
+ * @brief Average ns per dequeue: claim the oldest ready row, decode its
+ *        timestamps, then delete it (the queue_manager claim/ack path)
+ */
+static double measure_dequeue(const dequeue_case& c, int messages, bool& ok) {
+    integration::database_config config;
+    config.database_path = ":memory:";
+    config.statement_cache_size = c.statement_cache_size;
+    auto db = integration::create_database_adapter(config);
+    auto conn_result = db->acquire_connection();
+    if (!conn_result) {
+        ok = false;
+        return 0.0;
+    }
+    auto& conn = *conn_result.value();
+
+    const std::string time_type = c.epoch_micros ? "INTEGER" : "TEXT";
+    (void)conn.execute(
+        "CREATE TABLE bench_queue (id TEXT PRIMARY KEY, payload TEXT, "
+        "priority INTEGER, state INTEGER, created_at " + time_type +
+        ", scheduled_at " + time_type + ")");
+    (void)conn.execute(
+        "CREATE INDEX idx_bench_queue ON bench_queue "
+        "(state, priority, scheduled_at)");
+
+    auto bind_time = [&](integration::database_statement& stmt, std::size_t index,
+                         std::chrono::system_clock::time_point tp) {
+        if (c.epoch_micros) {
+            return stmt.bind_int64(
+                index, std::chrono::duration_cast<std::chrono::microseconds>(
+                           tp.time_since_epoch()).count());
+        }
+        return stmt.bind_string(index, format_text_timestamp(tp));
+    };
+    auto read_time = [&](const integration::database_row& row, std::size_t index) {
+        if (c.epoch_micros) {
+            return std::chrono::system_clock::time_point{
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::microseconds{row.get_int64(index)})};
+        }
+        return parse_text_timestamp(row.get_string(index));
+    };
+
+    // Seed
+    auto base = std::chrono::system_clock::now() - std::chrono::hours(1);
+    (void)conn.begin_transaction();
+    for (int i = 0; i < messages; ++i) {
+        auto stmt = conn.prepare(
+            "INSERT INTO bench_queue VALUES (?, 'MSH|^~\\&|BENCH', 0, 0, ?, ?)");
+        if (!stmt) {
+            ok = false;
+            return 0.0;
+        }
+        auto tp = base + std::chrono::milliseconds(i);
+        (void)(*stmt)->bind_string(1, "MSG" + std::to_string(i));
+        (void)bind_time(**stmt, 2, tp);
+        (void)bind_time(**stmt, 3, tp);
+        (void)(*stmt)->execute();
+    }
+    (void)conn.commit();
+
+    std::chrono::system_clock::time_point last_created{};
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < messages; ++i) {
+        auto claim = conn.prepare(
+            "UPDATE bench_queue SET state = 1 WHERE id = (SELECT id FROM "
+            "bench_queue WHERE state = 0 AND scheduled_at <= ? "
+            "ORDER BY priority, scheduled_at LIMIT 1) "
+            "RETURNING id, created_at, scheduled_at");
+        if (!claim) {
+            ok = false;
+            break;
+        }
+        (void)bind_time(**claim, 1, std::chrono::system_clock::now());
+        auto rows = (*claim)->execute();
+        if (!rows || !(*rows)->next()) {
+            ok = false;
+            break;
+        }
+        const auto& row = (*rows)->current_row();
+        std::string id = row.get_string(0);
+        last_created = read_time(row, 1);
+        (void)read_time(row, 2);
+        (void)(*rows)->next();
+
+        auto ack = conn.prepare("DELETE FROM bench_queue WHERE id = ?");
+        if (!ack) {
+            ok = false;
+            break;
+        }
+        (void)(*ack)->bind_string(1, id);
+        (void)(*ack)->execute();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    ok = ok && last_created >= base;
+    db->release_connection(conn_result.value());
+    return static_cast<double>(
+               std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                   .count()) /
+           messages;
+}
+
+/**
+ * @brief Compare per-dequeue cost without and with the statement cache
+ *        and epoch-microsecond timestamp columns
+ *
+ * Before: every prepare() compiles its SQL; timestamps are text.
+ * After: prepare() reuses cached statements; timestamps are INTEGER
+ *        microseconds, so the scheduled_at range scan compares integers.
+ */
+bool test_database_dequeue() {
+    const int messages = 5000;
+    const dequeue_case before{"uncached, text time", 0, false};
+    const dequeue_case cached{"cached, text time", 64, false};
+    const dequeue_case after{"cached, epoch us", 64, true};
+
+    bool ok = true;
+    double before_ns = measure_dequeue(before, messages, ok);
+    double cached_ns = measure_dequeue(cached, messages, ok);
+    double after_ns = measure_dequeue(after, messages, ok);
+    TEST_ASSERT(ok, "Every seeded message should be dequeued");
+
+    std::cout << "\n  Queue dequeue cost (" << messages << " messages):"
+              << std::endl;
+    for (const auto& [label, ns] :
+         {std::pair{before.label, before_ns}, std::pair{cached.label, cached_ns},
+          std::pair{after.label, after_ns}}) {
+        std::cout << "    " << std::left << std::setw(24) << label << " | "
+                  << std::right << std::setw(10) << std::fixed
+                  << std::setprecision(0) << ns << " ns/dequeue" << std::endl;
+    }
+    std::cout << "    Speedup:                 " << std::setprecision(2)
+              << (after_ns > 0 ? before_ns / after_ns : 0.0) << "x" << std::endl;
+    return true;
+}
+
 // =============================================================================
 // Thread Adapter Benchmarks
 // =============================================================================
@@ -1045,6 +1220,7 @@ int main() {
     RUN_TEST(test_database_prepared_statement);
     RUN_TEST(test_database_transactions);
     RUN_TEST(test_database_connection_pool);
+    RUN_TEST(test_database_dequeue);
 
     // Thread Adapter Benchmarks
     std::cout << "\n--- Thread Adapter Benchmarks ---" << std::endl;
@@ -0,0 +1,180 @@
+/**
+ * @file audit_logger_benchmark.cpp
+ * @brief Audit logger write-path benchmarks
+ *
+ * Compares synchronous writes (format and write on the caller's thread)
+ * with the async writer thread (lock-free queue, batched writev), each
+ * with buffered and fdatasync durability, from 1 and 4 producer threads.
+ * Reports the time a producer spends per event and end-to-end throughput
+ * up to the final flush.
+ */
+
+#include "pacs/bridge/security/audit_logger.h"
+
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace pacs::bridge::benchmark::audit {
+
+// =============================================================================
+// Test Utilities
+// =============================================================================
+
+#define TEST_ASSERT(condition, message)                                        \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::cerr << "FAILED: " << message << " at " << __FILE__ << ":"   \
+                      << __LINE__ << std::endl;                                \
+            return false;                                                      \
+        }                                                                      \
+    } while (0)
+
+#define RUN_TEST(test_func)                                                    \
+    do {                                                                       \
+        std::cout << "Running " << #test_func << "..." << std::endl;           \
+        auto start = std::chrono::high_resolution_clock::now();                \
+        if (test_func()) {                                                     \
+            auto end = std::chrono::high_resolution_clock::now();              \
+            auto duration =                                                    \
+                std::chrono::duration_cast<std::chrono::milliseconds>(         \
+                    end - start);                                              \
+            std::cout << "  PASSED (" << duration.count() << "ms)"            \
+                      << std::endl;                                            \
+            passed++;                                                          \
+        } else {                                                               \
+            std::cout << "  FAILED" << std::endl;                              \
+            failed++;                                                          \
+        }                                                                      \
+    } while (0)
+
+// =============================================================================
+// Write Path
+// =============================================================================
+
+struct run_result {
+    double producer_ns_per_event = 0;
+    double events_per_sec = 0;
+    size_t events_logged = 0;
+};
+
+/**
+ * @brief Log events from threads producers, then flush and stop
+ */
+run_result run(bool async, security::audit_durability durability, int threads,
+               int events_per_thread) {
+    using namespace security;
+
+    auto dir = std::filesystem::temp_directory_path() / "pacs_bridge_audit_bench";
+    std::filesystem::remove_all(dir);
+
+    healthcare_audit_config config;
+    config.log_path = dir / "audit.log";
+    config.async_writes = async;
+    config.durability = durability;
+    healthcare_audit_logger logger(config);
+    (void)logger.start();
+
+    std::vector<std::chrono::nanoseconds> producer_time(static_cast<size_t>(threads));
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threads; ++t) {
+        producers.emplace_back([&, t] {
+            auto begin = std::chrono::steady_clock::now();
+            for (int i = 0; i < events_per_thread; ++i) {
+                logger.log_hl7_processed("MSG" + std::to_string(i), true, 1.25);
+            }
+            producer_time[static_cast<size_t>(t)] = std::chrono::steady_clock::now() - begin;
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    logger.flush();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    run_result result;
+    result.events_logged = logger.get_statistics().events_logged;
+    logger.stop();
+    std::filesystem::remove_all(dir);
+
+    double total_events = static_cast<double>(threads) * events_per_thread;
+    double producer_ns = 0;
+    for (auto time : producer_time) {
+        producer_ns += static_cast<double>(time.count());
+    }
+    result.producer_ns_per_event = producer_ns / total_events;
+    result.events_per_sec =
+        total_events / std::chrono::duration<double>(elapsed).count();
+    return result;
+}
+
+bool test_write_path() {
+    using security::audit_durability;
+
+    std::cout << std::endl;
+    std::cout << "    " << std::left << std::setw(6) << "Mode" << " | "
+              << std::setw(10) << "Durability" << " | " << std::right
+              << std::setw(7) << "Threads" << " | " << std::setw(14)
+              << "Producer ns/ev" << " | " << std::setw(12) << "Events/s"
+              << std::endl;
+    std::cout << "    " << std::string(6, '-') << "-+-" << std::string(10, '-')
+              << "-+-" << std::string(7, '-') << "-+-" << std::string(14, '-')
+              << "-+-" << std::string(12, '-') << std::endl;
+
+    for (auto durability : {audit_durability::buffered, audit_durability::data_sync}) {
+        const bool synced = durability == audit_durability::data_sync;
+        for (int threads : {1, 4}) {
+            for (bool async : {false, true}) {
+                // fdatasync per event is slow; keep the synchronous run short
+                const int events = synced && !async ? 500 : 50000;
+                auto result = run(async, durability, threads, events);
+                TEST_ASSERT(result.events_logged ==
+                                static_cast<size_t>(threads) * static_cast<size_t>(events),
+                            "Every event should be written");
+
+                std::cout << "    " << std::left << std::setw(6)
+                          << (async ? "async" : "sync") << " | " << std::setw(10)
+                          << (synced ? "fdatasync" : "buffered") << " | "
+                          << std::right << std::setw(7) << threads << " | "
+                          << std::setw(14) << std::fixed << std::setprecision(0)
+                          << result.producer_ns_per_event << " | " << std::setw(12)
+                          << result.events_per_sec << std::endl;
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace pacs::bridge::benchmark::audit
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main() {
+    using namespace pacs::bridge::benchmark::audit;
+
+    std::cout << "=============================================" << std::endl;
+    std::cout << "PACS Bridge Audit Logger Benchmarks" << std::endl;
+    std::cout << "Synchronous vs async batched writes" << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    int passed = 0;
+    int failed = 0;
+
+    std::cout << "\n--- Write Path ---" << std::endl;
+    RUN_TEST(test_write_path);
+
+    // Summary
+    std::cout << "\n=============================================" << std::endl;
+    std::cout << "Results: " << passed << " passed, " << failed << " failed"
+              << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    return failed > 0 ? 1 : 0;
+}
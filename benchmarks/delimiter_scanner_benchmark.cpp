@@ -0,0 +1,218 @@
+/**
+ * @file delimiter_scanner_benchmark.cpp
+ * @brief Delimiter scan kernel benchmarks
+ *
+ * Compares the scalar, SSE2 and AVX2 delimiter scan kernels on:
+ * - ADT^A01: short, delimiter-dense message
+ * - ORU^R01 with a multi-MB base64 OBX-5 report: long, delimiter-sparse
+ *
+ * Also reports end-to-end parse time for the large ORU through the tree,
+ * flat and zero-copy parsers, which all consume the scanner.
+ */
+
+#include "pacs/bridge/performance/benchmark_runner.h"
+#include "pacs/bridge/performance/delimiter_scanner.h"
+#include "pacs/bridge/performance/zero_copy_parser.h"
+#include "pacs/bridge/protocol/hl7/hl7_flat_message.h"
+#include "pacs/bridge/protocol/hl7/hl7_message.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace pacs::bridge::benchmark::scanner {
+
+// =============================================================================
+// Test Utilities
+// =============================================================================
+
+#define TEST_ASSERT(condition, message)                                        \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::cerr << "FAILED: " << message << " at " << __FILE__ << ":"   \
+                      << __LINE__ << std::endl;                                \
+            return false;                                                      \
+        }                                                                      \
+    } while (0)
+
+#define RUN_TEST(test_func)                                                    \
+    do {                                                                       \
+        std::cout << "Running " << #test_func << "..." << std::endl;           \
+        auto start = std::chrono::high_resolution_clock::now();                \
+        if (test_func()) {                                                     \
+            auto end = std::chrono::high_resolution_clock::now();              \
+            auto duration =                                                    \
+                std::chrono::duration_cast<std::chrono::milliseconds>(         \
+                    end - start);                                              \
+            std::cout << "  PASSED (" << duration.count() << "ms)"            \
+                      << std::endl;                                            \
+            passed++;                                                          \
+        } else {                                                               \
+            std::cout << "  FAILED" << std::endl;                              \
+            failed++;                                                          \
+        }                                                                      \
+    } while (0)
+
+// =============================================================================
+// Sample Messages
+// =============================================================================
+
+const std::string SAMPLE_ADT_A01 =
+    "MSH|^~\\&|HIS|HOSPITAL|PACS|RADIOLOGY|20240115103000||ADT^A01|MSG001|P|2.4|||AL|NE\r"
+    "EVN|A01|20240115103000|||OPERATOR^JOHN\r"
+    "PID|1||12345^^^HOSPITAL^MR||DOE^JOHN^WILLIAM||19800515|M|||123 MAIN ST^^SPRINGFIELD^IL^62701||555-123-4567\r"
+    "PV1|1|I|WARD^101^A^HOSPITAL||||SMITH^ROBERT^MD\r";
+
+/**
+ * @brief ORU carrying an encapsulated PDF report in OBX-5
+ */
+std::string make_base64_oru(size_t payload_size) {
+    static constexpr char alphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string payload(payload_size, 'A');
+    for (size_t i = 0; i < payload_size; ++i) {
+        payload[i] = alphabet[(i * 7 + i / 64) % 64];
+    }
+    return "MSH|^~\\&|RIS|RADIOLOGY|HIS|HOSPITAL|20240115150000||ORU^R01|MSG100|P|2.5\r"
+           "PID|1||12345^^^HOSPITAL^MR||DOE^JOHN||19800515|M\r"
+           "OBR|1|ORD001|ACC001|71020^CHEST XRAY^CPT\r"
+           "OBX|1|ED|PDF^Report||^application^pdf^Base64^" +
+           payload + "||||||F\r";
+}
+
+const performance::delimiter_set HL7_DELIMITERS{'\r', '\n', '|', '^', '~', '&'};
+
+// =============================================================================
+// Kernel Comparison
+// =============================================================================
+
+/**
+ * @brief Scan each sample with every kernel the CPU supports
+ */
+bool test_scan_kernels() {
+    using namespace performance;
+
+    const std::string large_oru = make_base64_oru(4 * 1024 * 1024);
+    const auto detected = detected_simd_level();
+
+    std::cout << "\n  Detected SIMD level: " << to_string(detected) << std::endl;
+    std::cout << "    " << std::left << std::setw(20) << "Message" << " | "
+              << std::setw(8) << "Kernel" << " | " << std::right
+              << std::setw(12) << "Time" << " | " << std::setw(10) << "MB/s"
+              << std::endl;
+    std::cout << "    " << std::string(20, '-') << "-+-" << std::string(8, '-')
+              << "-+-" << std::string(12, '-') << "-+-" << std::string(10, '-')
+              << std::endl;
+
+    struct sample {
+        const char* label;
+        const std::string* raw;
+        size_t iterations;
+    };
+
+    for (const auto& [label, raw, iterations] :
+         {sample{"ADT^A01", &SAMPLE_ADT_A01, 100000},
+          sample{"ORU^R01 (4MB OBX)", &large_oru, 50}}) {
+        const auto reference =
+            delimiter_index::scan(*raw, HL7_DELIMITERS, simd_level::scalar);
+
+        for (auto level : {simd_level::scalar, simd_level::sse2, simd_level::avx2}) {
+            if (level > detected) {
+                continue;
+            }
+
+            auto index = delimiter_index::scan(*raw, HL7_DELIMITERS, level);
+            TEST_ASSERT(index.size() == reference.size(),
+                        "Kernels should agree on delimiter count");
+
+            auto avg = benchmark_with_warmup(
+                [&]() {
+                    auto idx = delimiter_index::scan(*raw, HL7_DELIMITERS, level);
+                    (void)idx;
+                },
+                iterations / 10 + 1, iterations);
+
+            const double ns = static_cast<double>(avg.count());
+            const double mb_per_sec =
+                ns > 0 ? static_cast<double>(raw->size()) / ns * 1e9 / (1024 * 1024)
+                       : 0.0;
+            std::cout << "    " << std::left << std::setw(20) << label << " | "
+                      << std::setw(8) << to_string(level) << " | " << std::right
+                      << std::setw(9) << std::fixed << std::setprecision(0) << ns
+                      << " ns | " << std::setw(10) << mb_per_sec << std::endl;
+        }
+    }
+    return true;
+}
+
+// =============================================================================
+// Parser Comparison
+// =============================================================================
+
+/**
+ * @brief Parse the large ORU with each parser built on the scanner
+ */
+bool test_large_report_parse() {
+    using namespace performance;
+
+    const std::string large_oru = make_base64_oru(4 * 1024 * 1024);
+    const size_t warmup = 3;
+    const size_t iterations = 20;
+
+    auto tree_avg = benchmark_with_warmup(
+        [&]() { (void)hl7::hl7_message::parse(large_oru); }, warmup, iterations);
+    auto flat_avg = benchmark_with_warmup(
+        [&]() { (void)hl7::hl7_flat_message::parse_borrowed(large_oru); },
+        warmup, iterations);
+    auto lazy_avg = benchmark_with_warmup(
+        [&]() { (void)zero_copy_parser::parse(large_oru); }, warmup, iterations);
+
+    auto tree = hl7::hl7_message::parse(large_oru);
+    TEST_ASSERT(tree.has_value(), "Tree parse should succeed");
+    TEST_ASSERT(tree->segment_count() == 4, "Tree should have 4 segments");
+
+    std::cout << "\n  ORU^R01 (4MB OBX) parse:" << std::endl;
+    for (const auto& [label, avg] :
+         {std::pair<const char*, std::chrono::nanoseconds>{"hl7_message", tree_avg},
+          {"hl7_flat_message", flat_avg},
+          {"zero_copy_parser", lazy_avg}}) {
+        std::cout << "    " << std::left << std::setw(20) << label << " | "
+                  << std::right << std::setw(12) << std::fixed
+                  << std::setprecision(1)
+                  << static_cast<double>(avg.count()) / 1e6 << " ms" << std::endl;
+    }
+    return true;
+}
+
+}  // namespace pacs::bridge::benchmark::scanner
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main() {
+    using namespace pacs::bridge::benchmark::scanner;
+
+    std::cout << "=============================================" << std::endl;
+    std::cout << "PACS Bridge Delimiter Scanner Benchmarks" << std::endl;
+    std::cout << "Scalar vs SSE2 vs AVX2 scan kernels" << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    int passed = 0;
+    int failed = 0;
+
+    std::cout << "\n--- Scan Kernels ---" << std::endl;
+    RUN_TEST(test_scan_kernels);
+
+    std::cout << "\n--- Parsers ---" << std::endl;
+    RUN_TEST(test_large_report_parse);
+
+    // Summary
+    std::cout << "\n=============================================" << std::endl;
+    std::cout << "Results: " << passed << " passed, " << failed << " failed"
+              << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,268 @@
+/**
+ * @file hl7_ingest_benchmark.cpp
+ * @brief Parsed vs lazy-view HL7 ingestion benchmarks
+ *
+ * Compares the two hl7_ingestion_mode settings end to end:
+ * - Router: MLLP payload -> message_router::route() -> handler
+ * - Registry: raw HL7 -> hl7_handler_registry::process() (ADT handler)
+ *
+ * Parsed mode builds an hl7_message tree per message. Lazy-view mode indexes
+ * the received buffer in place and hands handlers an hl7_flat_message.
+ */
+
+#include "pacs/bridge/cache/patient_cache.h"
+#include "pacs/bridge/mllp/mllp_types.h"
+#include "pacs/bridge/performance/benchmark_runner.h"
+#include "pacs/bridge/protocol/hl7/adt_handler.h"
+#include "pacs/bridge/protocol/hl7/hl7_flat_message.h"
+#include "pacs/bridge/protocol/hl7/hl7_handler_registry.h"
+#include "pacs/bridge/protocol/hl7/hl7_message.h"
+#include "pacs/bridge/router/message_router.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace pacs::bridge::benchmark::ingest {
+
+// =============================================================================
+// Test Utilities
+// =============================================================================
+
+#define TEST_ASSERT(condition, message)                                        \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::cerr << "FAILED: " << message << " at " << __FILE__ << ":"   \
+                      << __LINE__ << std::endl;                                \
+            return false;                                                      \
+        }                                                                      \
+    } while (0)
+
+#define RUN_TEST(test_func)                                                    \
+    do {                                                                       \
+        std::cout << "Running " << #test_func << "..." << std::endl;           \
+        auto start = std::chrono::high_resolution_clock::now();                \
+        if (test_func()) {                                                     \
+            auto end = std::chrono::high_resolution_clock::now();              \
+            auto duration =                                                    \
+                std::chrono::duration_cast<std::chrono::milliseconds>(         \
+                    end - start);                                              \
+            std::cout << "  PASSED (" << duration.count() << "ms)"            \
+                      << std::endl;                                            \
+            passed++;                                                          \
+        } else {                                                               \
+            std::cout << "  FAILED" << std::endl;                              \
+            failed++;                                                          \
+        }                                                                      \
+    } while (0)
+
+// =============================================================================
+// Sample Messages
+// =============================================================================
+
+const std::string SAMPLE_ADT_A01 =
+    "MSH|^~\\&|HIS|HOSPITAL|PACS|RADIOLOGY|20240115103000||ADT^A01|MSG001|P|2.4|||AL|NE\r"
+    "EVN|A01|20240115103000|||OPERATOR^JOHN\r"
+    "PID|1||12345^^^HOSPITAL^MR||DOE^JOHN^WILLIAM||19800515|M|||123 MAIN ST^^SPRINGFIELD^IL^62701||555-123-4567\r"
+    "PV1|1|I|WARD^101^A^HOSPITAL||||SMITH^ROBERT^MD\r";
+
+/**
+ * @brief ORU with a long OBX block, typical of report traffic
+ */
+std::string make_large_oru() {
+    std::string msg =
+        "MSH|^~\\&|RIS|RADIOLOGY|HIS|HOSPITAL|20240115150000||ORU^R01|MSG100|P|2.4\r"
+        "PID|1||12345^^^HOSPITAL^MR||DOE^JOHN||19800515|M\r"
+        "OBR|1|ORD001|ACC001|71020^CHEST XRAY^CPT\r";
+    for (int i = 1; i <= 40; ++i) {
+        msg += "OBX|" + std::to_string(i) +
+               "|TX|GDT^REPORT^L||Line of report text^with^components||||||F\r";
+    }
+    return msg;
+}
+
+// =============================================================================
+// Comparison Result
+// =============================================================================
+
+struct comparison_result {
+    std::string label;
+    double parsed_ns;
+    double lazy_ns;
+
+    double speedup() const { return lazy_ns > 0 ? parsed_ns / lazy_ns : 0.0; }
+
+    void print() const {
+        std::cout << "    " << std::left << std::setw(24) << label << " | "
+                  << std::right << std::setw(10) << std::fixed
+                  << std::setprecision(0) << parsed_ns << " ns"
+                  << " | " << std::setw(10) << lazy_ns << " ns"
+                  << " | " << std::setw(7) << std::setprecision(2)
+                  << speedup() << "x" << std::endl;
+    }
+};
+
+static void print_comparison_header(const std::string& section) {
+    std::cout << "\n  " << section << ":" << std::endl;
+    std::cout << "    " << std::left << std::setw(24) << "Operation"
+              << " | " << std::right << std::setw(13) << "Parsed"
+              << " | " << std::setw(13) << "Lazy view"
+              << " | " << std::setw(8) << "Speedup" << std::endl;
+    std::cout << "    " << std::string(24, '-') << "-+-" << std::string(13, '-')
+              << "-+-" << std::string(13, '-') << "-+-"
+              << std::string(8, '-') << std::endl;
+}
+
+// =============================================================================
+// Router Ingestion
+// =============================================================================
+
+/**
+ * @brief Route MLLP payloads in both ingestion modes
+ *
+ * Both routers match on MSH and run a handler that reads one PID field, so
+ * the difference is the cost of building the message representation.
+ */
+bool test_router_ingestion() {
+    using namespace performance;
+
+    const size_t warmup = 200;
+    const size_t iterations = 20000;
+
+    router::message_router parsed_router;
+    parsed_router.register_handler(
+        "read_pid", [](const hl7::hl7_message& msg) {
+            return msg.get_value("PID.3").empty()
+                       ? router::handler_result::error("missing PID.3")
+                       : router::handler_result::ok();
+        });
+    (void)parsed_router.add_route(router::route_builder::create("all")
+                                      .match_any()
+                                      .handler("read_pid")
+                                      .build());
+
+    router::message_router lazy_router;
+    lazy_router.register_view_handler(
+        "read_pid", [](const hl7::hl7_flat_message& msg) {
+            return msg.get_value("PID.3").empty()
+                       ? router::handler_result::error("missing PID.3")
+                       : router::handler_result::ok();
+        });
+    (void)lazy_router.add_route(router::route_builder::create("all")
+                                    .match_any()
+                                    .handler("read_pid")
+                                    .build());
+
+    print_comparison_header("Router Ingestion (MLLP -> route)");
+
+    const std::string large_oru = make_large_oru();
+    for (const auto& [label, raw] :
+         {std::pair<const char*, const std::string*>{"ADT^A01", &SAMPLE_ADT_A01},
+          {"ORU^R01 (40 OBX)", &large_oru}}) {
+        auto payload = mllp::mllp_message::from_string(*raw);
+
+        auto parsed_ok = parsed_router.route(payload, hl7::hl7_ingestion_mode::parsed);
+        auto lazy_ok = lazy_router.route(payload, hl7::hl7_ingestion_mode::lazy_view);
+        TEST_ASSERT(parsed_ok && parsed_ok->success, "Parsed routing should succeed");
+        TEST_ASSERT(lazy_ok && lazy_ok->success, "Lazy routing should succeed");
+
+        auto parsed_avg = benchmark_with_warmup(
+            [&]() {
+                (void)parsed_router.route(payload, hl7::hl7_ingestion_mode::parsed);
+            },
+            warmup, iterations);
+        auto lazy_avg = benchmark_with_warmup(
+            [&]() {
+                (void)lazy_router.route(payload, hl7::hl7_ingestion_mode::lazy_view);
+            },
+            warmup, iterations);
+
+        comparison_result{label, static_cast<double>(parsed_avg.count()),
+                          static_cast<double>(lazy_avg.count())}
+            .print();
+    }
+
+    TEST_ASSERT(lazy_router.get_statistics().materialized_messages == 0,
+                "Lazy router should never materialize");
+    return true;
+}
+
+// =============================================================================
+// Handler Registry Ingestion
+// =============================================================================
+
+/**
+ * @brief Parse + dispatch an ADT message through the handler registry
+ */
+bool test_registry_ingestion() {
+    using namespace performance;
+
+    const size_t warmup = 200;
+    const size_t iterations = 10000;
+
+    auto cache = std::make_shared<cache::patient_cache>();
+    hl7::hl7_handler_registry registry;
+    TEST_ASSERT(registry.register_handler<hl7::adt_handler>(cache).is_ok(),
+                "ADT handler should register");
+
+    auto parsed_avg = benchmark_with_warmup(
+        [&]() {
+            auto msg = hl7::hl7_message::parse(SAMPLE_ADT_A01);
+            if (msg) {
+                (void)registry.process(*msg);
+            }
+        },
+        warmup, iterations);
+
+    auto lazy_avg = benchmark_with_warmup(
+        [&]() {
+            auto view = hl7::hl7_flat_message::parse_borrowed(SAMPLE_ADT_A01);
+            if (view) {
+                (void)registry.process(*view);
+            }
+        },
+        warmup, iterations);
+
+    print_comparison_header("Registry Ingestion (parse -> ADT handler)");
+    comparison_result{"ADT^A01", static_cast<double>(parsed_avg.count()),
+                      static_cast<double>(lazy_avg.count())}
+        .print();
+
+    auto stats = registry.get_statistics();
+    TEST_ASSERT(stats.failure_count == 0, "All messages should be handled");
+    TEST_ASSERT(stats.materialized_count == 0,
+                "ADT handler should read views directly");
+    return true;
+}
+
+}  // namespace pacs::bridge::benchmark::ingest
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main() {
+    using namespace pacs::bridge::benchmark::ingest;
+
+    std::cout << "=============================================" << std::endl;
+    std::cout << "PACS Bridge HL7 Ingestion Benchmarks" << std::endl;
+    std::cout << "Parsed vs lazy-view ingestion mode" << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    int passed = 0;
+    int failed = 0;
+
+    std::cout << "\n--- Ingestion Mode Comparisons ---" << std::endl;
+    RUN_TEST(test_router_ingestion);
+    RUN_TEST(test_registry_ingestion);
+
+    // Summary
+    std::cout << "\n=============================================" << std::endl;
+    std::cout << "Results: " << passed << " passed, " << failed << " failed"
+              << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    return failed > 0 ? 1 : 0;
+}
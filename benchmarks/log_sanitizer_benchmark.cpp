@@ -0,0 +1,266 @@
+/**
+ * @file log_sanitizer_benchmark.cpp
+ * @brief PHI log sanitizer throughput benchmarks
+ *
+ * Reports MB/s for healthcare_log_sanitizer on:
+ * - Free-text log lines, some carrying SSNs, phones, emails and MRNs
+ * - HL7 ADT^A01 dumps, through sanitize() and sanitize_hl7()
+ *
+ * Each workload is also run through the std::regex pipeline the sanitizer
+ * used before the compiled engine, for comparison.
+ */
+
+#include "pacs/bridge/performance/benchmark_runner.h"
+#include "pacs/bridge/security/log_sanitizer.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pacs::bridge::benchmark::sanitizer {
+
+// =============================================================================
+// Test Utilities
+// =============================================================================
+
+#define TEST_ASSERT(condition, message)                                        \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::cerr << "FAILED: " << message << " at " << __FILE__ << ":"   \
+                      << __LINE__ << std::endl;                                \
+            return false;                                                      \
+        }                                                                      \
+    } while (0)
+
+#define RUN_TEST(test_func)                                                    \
+    do {                                                                       \
+        std::cout << "Running " << #test_func << "..." << std::endl;           \
+        auto start = std::chrono::high_resolution_clock::now();                \
+        if (test_func()) {                                                     \
+            auto end = std::chrono::high_resolution_clock::now();              \
+            auto duration =                                                    \
+                std::chrono::duration_cast<std::chrono::milliseconds>(         \
+                    end - start);                                              \
+            std::cout << "  PASSED (" << duration.count() << "ms)"            \
+                      << std::endl;                                            \
+            passed++;                                                          \
+        } else {                                                               \
+            std::cout << "  FAILED" << std::endl;                              \
+            failed++;                                                          \
+        }                                                                      \
+    } while (0)
+
+// =============================================================================
+// Sample Content
+// =============================================================================
+
+const std::string SAMPLE_ADT_A01 =
+    "MSH|^~\\&|HIS|HOSPITAL|PACS|RADIOLOGY|20240115103000||ADT^A01|MSG001|P|2.4|||AL|NE\r"
+    "EVN|A01|20240115103000|||OPERATOR^JOHN\r"
+    "PID|1||12345^^^HOSPITAL^MR||DOE^JOHN^WILLIAM||19800515|M|||123 MAIN ST^^SPRINGFIELD^IL^62701||555-123-4567|||||ACC001|123-45-6789\r"
+    "NK1|1|DOE^JANE|SPO|123 MAIN ST^^SPRINGFIELD^IL^62701|555-123-9876\r"
+    "PV1|1|I|WARD^101^A^HOSPITAL||||SMITH^ROBERT^MD\r";
+
+/**
+ * @brief About size bytes of log lines; one in four carries PHI
+ */
+std::string make_log_corpus(size_t size) {
+    static const char* lines[] = {
+        "2024-01-15 10:30:00.123 INFO  [mllp] session=42 peer=10.0.0.7:2575 "
+        "frame received bytes=1834 elapsed_us=212\n",
+        "2024-01-15 10:30:00.125 DEBUG [router] route=adt-to-pacs matched "
+        "message_type=ADT^A01 control_id=MSG001 priority=normal\n",
+        "2024-01-15 10:30:00.127 WARN  [emr] lookup for MRN: A1234567 slow, "
+        "callback 555-123-4567, contact j.doe@example.org\n",
+        "2024-01-15 10:30:00.131 INFO  [queue] enqueued id=98231 depth=17 "
+        "retry=0 destination=pacs-primary latency_ms=3\n",
+    };
+    std::string corpus;
+    corpus.reserve(size + 256);
+    for (size_t i = 0; corpus.size() < size; ++i) {
+        corpus += lines[i % 4];
+    }
+    return corpus;
+}
+
+std::string make_hl7_dump(size_t size) {
+    std::string dump;
+    dump.reserve(size + SAMPLE_ADT_A01.size());
+    while (dump.size() < size) {
+        dump += SAMPLE_ADT_A01;
+    }
+    return dump;
+}
+
+// =============================================================================
+// std::regex Baseline
+// =============================================================================
+
+/**
+ * @brief The pattern list sanitize() ran before the compiled engine
+ */
+class regex_sanitizer {
+public:
+    regex_sanitizer() {
+        patterns_.emplace_back(
+            std::regex(R"(\b(MRN|PatientID|Patient ID)[\s:=]*([A-Z0-9]{4,12})\b)",
+                       std::regex::icase),
+            "$1=[PATIENT_ID]");
+        patterns_.emplace_back(
+            std::regex(R"((\|)([A-Z][A-Za-z'-]+)\^([A-Z][A-Za-z'-]+)(\||\^))"),
+            "$1[PATIENT_NAME]$4");
+        patterns_.emplace_back(std::regex(R"(\b\d{3}[-\s]?\d{2}[-\s]?\d{4}\b)"), "[SSN]");
+        patterns_.emplace_back(
+            std::regex(R"(\b(\+?1[-.\s]?)?\(?\d{3}\)?[-.\s]?\d{3}[-.\s]?\d{4}\b)"),
+            "[PHONE]");
+        patterns_.emplace_back(
+            std::regex(R"(\b[A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Z|a-z]{2,}\b)"),
+            "[EMAIL]");
+        patterns_.emplace_back(std::regex(R"(\b(19|20)\d{6}\b)"), "[DOB]");
+        patterns_.emplace_back(
+            std::regex(R"(\b\d+\s+[A-Z][a-z]+\s+(St|Street|Ave|Avenue|Rd|Road|Blvd|Dr|Drive|Ln|Lane)\b)",
+                       std::regex::icase),
+            "[ADDRESS]");
+    }
+
+    std::string sanitize(std::string_view content) const {
+        std::string result(content);
+        for (const auto& [pattern, replacement] : patterns_) {
+            result = std::regex_replace(result, pattern, replacement);
+        }
+        return result;
+    }
+
+private:
+    std::vector<std::pair<std::regex, std::string>> patterns_;
+};
+
+// =============================================================================
+// Throughput
+// =============================================================================
+
+void print_header() {
+    std::cout << "    " << std::left << std::setw(24) << "Workload" << " | "
+              << std::setw(16) << "Engine" << " | " << std::right
+              << std::setw(10) << "MB/s" << std::endl;
+    std::cout << "    " << std::string(24, '-') << "-+-" << std::string(16, '-')
+              << "-+-" << std::string(10, '-') << std::endl;
+}
+
+template <typename Func>
+double report(const char* workload, const char* engine, size_t bytes,
+              size_t iterations, Func&& func) {
+    using namespace performance;
+    auto avg = benchmark_with_warmup(func, 1, iterations);
+    const double ns = static_cast<double>(avg.count());
+    const double mb_per_sec =
+        ns > 0 ? static_cast<double>(bytes) / ns * 1e9 / (1024 * 1024) : 0.0;
+    std::cout << "    " << std::left << std::setw(24) << workload << " | "
+              << std::setw(16) << engine << " | " << std::right << std::setw(10)
+              << std::fixed << std::setprecision(1) << mb_per_sec << std::endl;
+    return mb_per_sec;
+}
+
+/**
+ * @brief Free-text log lines through sanitize()
+ */
+bool test_log_line_throughput() {
+    using security::healthcare_log_sanitizer;
+
+    const std::string corpus = make_log_corpus(1024 * 1024);
+    healthcare_log_sanitizer compiled;
+    regex_sanitizer baseline;
+
+    std::string out;
+    out.reserve(corpus.size());
+    compiled.sanitize_to(corpus, out);
+    TEST_ASSERT(out.find("A1234567") == std::string::npos, "MRN should be redacted");
+    TEST_ASSERT(out.find("555-123-4567") == std::string::npos, "Phone should be redacted");
+    TEST_ASSERT(out.find("j.doe@example.org") == std::string::npos,
+                "Email should be redacted");
+    TEST_ASSERT(out == baseline.sanitize(corpus),
+                "Compiled and regex engines should agree on log lines");
+
+    std::cout << std::endl;
+    print_header();
+    double fast = report("log lines (1 MB)", "compiled", corpus.size(), 50, [&]() {
+        out.clear();
+        compiled.sanitize_to(corpus, out);
+    });
+    double slow = report("log lines (1 MB)", "std::regex", corpus.size(), 2,
+                         [&]() { (void)baseline.sanitize(corpus); });
+    std::cout << "    speedup: " << std::setprecision(1) << fast / slow << "x"
+              << std::endl;
+    return true;
+}
+
+/**
+ * @brief HL7 message dumps through sanitize() and sanitize_hl7()
+ */
+bool test_hl7_dump_throughput() {
+    using security::healthcare_log_sanitizer;
+
+    const std::string dump = make_hl7_dump(1024 * 1024);
+    healthcare_log_sanitizer compiled;
+    regex_sanitizer baseline;
+
+    std::string out;
+    out.reserve(dump.size());
+    compiled.sanitize_hl7_to(dump, out);
+    TEST_ASSERT(out.find("DOE^JOHN") == std::string::npos, "PID-5 should be redacted");
+    TEST_ASSERT(out.find("123-45-6789") == std::string::npos, "PID-19 should be redacted");
+    TEST_ASSERT(out.find("SMITH^ROBERT") != std::string::npos,
+                "Non-PHI segments should be kept");
+
+    std::cout << std::endl;
+    print_header();
+    double fast = report("ADT dump (1 MB)", "sanitize_hl7", dump.size(), 50, [&]() {
+        out.clear();
+        compiled.sanitize_hl7_to(dump, out);
+    });
+    report("ADT dump (1 MB)", "sanitize", dump.size(), 50, [&]() {
+        out.clear();
+        compiled.sanitize_to(dump, out);
+    });
+    double slow = report("ADT dump (1 MB)", "std::regex", dump.size(), 2,
+                         [&]() { (void)baseline.sanitize(dump); });
+    std::cout << "    speedup: " << std::setprecision(1) << fast / slow << "x"
+              << std::endl;
+    return true;
+}
+
+}  // namespace pacs::bridge::benchmark::sanitizer
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main() {
+    using namespace pacs::bridge::benchmark::sanitizer;
+
+    std::cout << "=============================================" << std::endl;
+    std::cout << "PACS Bridge Log Sanitizer Benchmarks" << std::endl;
+    std::cout << "Compiled PHI redaction vs std::regex" << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    int passed = 0;
+    int failed = 0;
+
+    std::cout << "\n--- Free Text ---" << std::endl;
+    RUN_TEST(test_log_line_throughput);
+
+    std::cout << "\n--- HL7 ---" << std::endl;
+    RUN_TEST(test_hl7_dump_throughput);
+
+    // Summary
+    std::cout << "\n=============================================" << std::endl;
+    std::cout << "Results: " << passed << " passed, " << failed << " failed"
+              << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    return failed > 0 ? 1 : 0;
+}
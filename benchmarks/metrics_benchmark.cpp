@@ -0,0 +1,251 @@
+/**
+ * @file metrics_benchmark.cpp
+ * @brief Recording cost of bridge_metrics_collector counters and histograms
+ *
+ * Measures nanoseconds per recorded metric on one thread and on several
+ * threads hitting the same label, which is where a shared lock or a shared
+ * cache line would show up:
+ * - Labeled counter increment (record_hl7_message_received)
+ * - The same counter through a pre-resolved counter_handle
+ * - Histogram sample (record_hl7_processing_duration)
+ * - Raw log_linear_histogram::record, as a floor
+ *
+ * and the cost of one Prometheus scrape, into a fresh string, into a
+ * reused buffer, and gzip-compressed.
+ */
+
+#include "pacs/bridge/internal/log_linear_histogram.h"
+#include "pacs/bridge/monitoring/bridge_metrics.h"
+#include "pacs/bridge/monitoring/prometheus_writer.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace pacs::bridge::benchmark::metrics {
+
+using monitoring::bridge_metrics_collector;
+
+// =============================================================================
+// Test Utilities
+// =============================================================================
+
+#define TEST_ASSERT(condition, message)                                        \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::cerr << "FAILED: " << message << " at " << __FILE__ << ":"   \
+                      << __LINE__ << std::endl;                                \
+            return false;                                                      \
+        }                                                                      \
+    } while (0)
+
+#define RUN_TEST(test_func)                                                    \
+    do {                                                                       \
+        std::cout << "Running " << #test_func << "..." << std::endl;           \
+        auto start = std::chrono::high_resolution_clock::now();                \
+        if (test_func()) {                                                     \
+            auto end = std::chrono::high_resolution_clock::now();              \
+            auto duration =                                                    \
+                std::chrono::duration_cast<std::chrono::milliseconds>(         \
+                    end - start);                                              \
+            std::cout << "  PASSED (" << duration.count() << "ms)"            \
+                      << std::endl;                                            \
+            passed++;                                                          \
+        } else {                                                               \
+            std::cout << "  FAILED" << std::endl;                              \
+            failed++;                                                          \
+        }                                                                      \
+    } while (0)
+
+/**
+ * @brief Run body(iterations) on each of thread_count threads
+ * @return Nanoseconds per call, averaged over each thread's wall time
+ */
+double ns_per_call(size_t thread_count, size_t iterations,
+                   const std::function<void(size_t)>& body) {
+    std::atomic<size_t> ready{0};
+    std::atomic<bool> go{false};
+    std::atomic<uint64_t> total_ns{0};
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&] {
+            ready.fetch_add(1);
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            auto start = std::chrono::steady_clock::now();
+            body(iterations);
+            auto end = std::chrono::steady_clock::now();
+            total_ns.fetch_add(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                    .count()));
+        });
+    }
+    while (ready.load() < thread_count) {
+        std::this_thread::yield();
+    }
+    go.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return static_cast<double>(total_ns.load()) /
+           static_cast<double>(thread_count * iterations);
+}
+
+void print_row(const char* label, size_t threads, double ns) {
+    std::cout << "    " << std::left << std::setw(36) << label << std::right
+              << std::setw(3) << threads << " thread(s)" << std::fixed
+              << std::setprecision(1) << std::setw(10) << ns << " ns/op"
+              << std::endl;
+}
+
+// =============================================================================
+// Recording Cost
+// =============================================================================
+
+bool test_recording_cost() {
+    constexpr size_t iterations = 1000000;
+    auto& collector = bridge_metrics_collector::instance();
+    collector.initialize("metrics_benchmark", 0);
+
+    const std::string message_type = "ADT";
+    auto handles = collector.hl7_metrics(message_type);
+    internal::log_linear_histogram histogram;
+
+    std::cout << "\n    Cost per recorded metric:" << std::endl;
+    double counter_1 = 0.0;
+    double histogram_1 = 0.0;
+    for (size_t threads : {1, 4}) {
+        double counter = ns_per_call(threads, iterations, [&](size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                collector.record_hl7_message_received(message_type);
+            }
+        });
+        double handle = ns_per_call(threads, iterations, [&](size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                handles.received.increment();
+            }
+        });
+        double sample = ns_per_call(threads, iterations, [&](size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                collector.record_hl7_processing_duration(
+                    message_type, std::chrono::nanoseconds(1000 + (i & 0xffff)));
+            }
+        });
+        double raw = ns_per_call(threads, iterations, [&](size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                histogram.record(1000 + (i & 0xffff));
+            }
+        });
+        print_row("record_hl7_message_received", threads, counter);
+        print_row("counter_handle::increment", threads, handle);
+        print_row("record_hl7_processing_duration", threads, sample);
+        print_row("log_linear_histogram::record", threads, raw);
+        if (threads == 1) {
+            counter_1 = counter;
+            histogram_1 = sample;
+        }
+    }
+
+    collector.shutdown();
+
+    TEST_ASSERT(counter_1 < 100.0,
+                "Uncontended counter increment should take tens of ns");
+    TEST_ASSERT(histogram_1 < 100.0,
+                "Uncontended histogram sample should take tens of ns");
+    return true;
+}
+
+template <typename Body>
+double us_per_scrape(int scrapes, Body&& body) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < scrapes; ++i) {
+        body();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() /
+           scrapes;
+}
+
+bool test_scrape_cost() {
+    auto& collector = bridge_metrics_collector::instance();
+    collector.initialize("metrics_benchmark", 0);
+
+    for (int i = 0; i < 100000; ++i) {
+        collector.record_hl7_processing_duration(
+            "ORM", std::chrono::microseconds(i % 5000));
+    }
+    for (int d = 0; d < 50; ++d) {
+        auto queue = collector.queue_metrics("destination_" + std::to_string(d));
+        queue.enqueued.increment();
+        queue.delivered.increment();
+    }
+
+    constexpr int scrapes = 200;
+    size_t bytes = 0;
+    double fresh = us_per_scrape(scrapes, [&] {
+        bytes = collector.get_prometheus_metrics().size();
+    });
+
+    std::string buffer;
+    double reused = us_per_scrape(scrapes, [&] {
+        buffer.clear();
+        collector.write_prometheus_metrics(buffer);
+    });
+
+    std::string compressed;
+    monitoring::gzip_compressor compressor;
+    double gzipped = us_per_scrape(scrapes, [&] {
+        buffer.clear();
+        collector.write_prometheus_metrics(buffer);
+        compressor.compress(buffer, compressed);
+    });
+
+    std::cout << "\n    Scrape of " << bytes << " bytes:" << std::endl;
+    std::cout << "    " << std::left << std::setw(36) << "get_prometheus_metrics"
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << fresh << " us" << std::endl;
+    std::cout << "    " << std::left << std::setw(36) << "write_prometheus_metrics (reused)"
+              << std::right << std::setw(10) << reused << " us" << std::endl;
+    if (monitoring::gzip_available()) {
+        std::cout << "    " << std::left << std::setw(36) << "  + gzip"
+                  << std::right << std::setw(10) << gzipped << " us, "
+                  << compressed.size() << " bytes" << std::endl;
+    }
+
+    collector.shutdown();
+    TEST_ASSERT(bytes > 0, "Scrape should produce output");
+    return true;
+}
+
+}  // namespace pacs::bridge::benchmark::metrics
+
+int main() {
+    using namespace pacs::bridge::benchmark::metrics;
+
+    std::cout << "=============================================" << std::endl;
+    std::cout << "PACS Bridge Metrics Benchmarks" << std::endl;
+    std::cout << "Counter and histogram recording, scrape cost" << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    int passed = 0;
+    int failed = 0;
+
+    std::cout << "\n--- Metrics Recording ---" << std::endl;
+    RUN_TEST(test_recording_cost);
+    RUN_TEST(test_scrape_cost);
+
+    // Summary
+    std::cout << "\n=============================================" << std::endl;
+    std::cout << "Results: " << passed << " passed, " << failed << " failed"
+              << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,345 @@
+/**
+ * @file mllp_event_loop_benchmark.cpp
+ * @brief MLLP server connection scaling benchmarks
+ *
+ * Holds 1,000 concurrent MLLP connections open against mllp_server and
+ * exchanges ORM^O01 / ACK round trips on all of them, once per I/O model:
+ * - thread_per_connection: one blocked receive thread per connection
+ * - event_loop: epoll reactor threads plus a bounded handler pool
+ *
+ * Reports process thread count while all connections are open (from
+ * /proc/self/status), round-trip throughput, and P50/P99 latency.
+ *
+ * Linux only; needs an open file limit above 2,000.
+ */
+
+#include "pacs/bridge/mllp/mllp_server.h"
+#include "pacs/bridge/mllp/mllp_types.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace pacs::bridge::benchmark::mllp_event_loop {
+
+// =============================================================================
+// Test Utilities
+// =============================================================================
+
+#define TEST_ASSERT(condition, message)                                        \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::cerr << "FAILED: " << message << " at " << __FILE__ << ":"   \
+                      << __LINE__ << std::endl;                                \
+            return false;                                                      \
+        }                                                                      \
+    } while (0)
+
+#define RUN_TEST(test_func)                                                    \
+    do {                                                                       \
+        std::cout << "Running " << #test_func << "..." << std::endl;           \
+        auto start = std::chrono::high_resolution_clock::now();                \
+        if (test_func()) {                                                     \
+            auto end = std::chrono::high_resolution_clock::now();              \
+            auto duration =                                                    \
+                std::chrono::duration_cast<std::chrono::milliseconds>(         \
+                    end - start);                                              \
+            std::cout << "  PASSED (" << duration.count() << "ms)"            \
+                      << std::endl;                                            \
+            passed++;                                                          \
+        } else {                                                               \
+            std::cout << "  FAILED" << std::endl;                              \
+            failed++;                                                          \
+        }                                                                      \
+    } while (0)
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+constexpr size_t CONNECTIONS = 1000;
+constexpr size_t CLIENT_THREADS = 4;
+constexpr size_t ROUNDS = 10;
+
+const std::string SAMPLE_ORM =
+    "MSH|^~\\&|HIS|HOSPITAL|PACS|RADIOLOGY|20240115110000||ORM^O01|MSG002|P|2.4\r"
+    "PID|1||12345^^^HOSPITAL^MR||DOE^JOHN||19800515|M\r"
+    "ORC|NW|ORD001^HIS|ACC001^PACS||SC\r"
+    "OBR|1|ORD001^HIS|ACC001^PACS|71020^CHEST XRAY^CPT\r";
+
+const std::string SAMPLE_ACK =
+    "MSH|^~\\&|PACS|RADIOLOGY|HIS|HOSPITAL|20240115110001||ACK^O01|ACK002|P|2.4\r"
+    "MSA|AA|MSG002\r";
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+/**
+ * @brief Current thread count of this process
+ */
+size_t process_thread_count() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("Threads:", 0) == 0) {
+            return std::stoul(line.substr(8));
+        }
+    }
+    return 0;
+}
+
+int connect_client(uint16_t port) {
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    int nodelay = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+bool send_all(int fd, const std::vector<uint8_t>& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t n = ::send(fd, data.data() + sent, data.size() - sent,
+                           MSG_NOSIGNAL);
+        if (n <= 0) {
+            return false;
+        }
+        sent += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+/**
+ * @brief Read until the MLLP trailer (FS CR) of one response
+ */
+bool read_frame(int fd) {
+    char buffer[1024];
+    char last = 0;
+    while (true) {
+        ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+        if (n <= 0) {
+            return false;
+        }
+        for (ssize_t i = 0; i < n; ++i) {
+            if (last == mllp::MLLP_END_BYTE &&
+                buffer[i] == mllp::MLLP_CARRIAGE_RETURN) {
+                return true;
+            }
+            last = buffer[i];
+        }
+    }
+}
+
+struct scaling_result {
+    size_t connected = 0;
+    size_t server_threads = 0;
+    size_t round_trips = 0;
+    std::chrono::milliseconds elapsed{0};
+    std::vector<std::chrono::microseconds> latencies;
+
+    std::chrono::microseconds percentile(double p) const {
+        if (latencies.empty()) {
+            return std::chrono::microseconds{0};
+        }
+        auto sorted = latencies;
+        std::sort(sorted.begin(), sorted.end());
+        size_t idx = static_cast<size_t>(static_cast<double>(sorted.size()) * p / 100.0);
+        return sorted[std::min(idx, sorted.size() - 1)];
+    }
+};
+
+/**
+ * @brief Open CONNECTIONS sockets and run ROUNDS ACK round trips on each
+ *
+ * Each client thread owns a slice of the sockets. Per round it sends one
+ * message on every socket it owns, then reads every ACK, so all
+ * connections have a request in flight at once.
+ */
+scaling_result run_scaling(mllp::mllp_io_model model, uint16_t port) {
+    scaling_result result;
+
+    mllp::mllp_server_config config;
+    config.port = port;
+    config.max_connections = CONNECTIONS + 100;
+    config.io_model = model;
+    config.reactor_threads = 2;
+    config.worker_threads = 4;
+
+    mllp::mllp_server server(config);
+    server.set_message_handler(
+        [](const mllp::mllp_message&, const mllp::mllp_session_info&)
+            -> std::optional<mllp::mllp_message> {
+            return mllp::mllp_message::from_string(SAMPLE_ACK);
+        });
+
+    const size_t threads_before = process_thread_count();
+    if (!server.start()) {
+        return result;
+    }
+
+    const auto request = mllp::mllp_message::from_string(SAMPLE_ORM).frame();
+
+    std::vector<std::vector<int>> sockets(CLIENT_THREADS);
+    for (size_t i = 0; i < CONNECTIONS; ++i) {
+        int fd = connect_client(port);
+        if (fd >= 0) {
+            sockets[i % CLIENT_THREADS].push_back(fd);
+            ++result.connected;
+        }
+    }
+
+    // Let the server register every connection before sampling threads
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while (server.statistics().active_connections < result.connected &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    result.server_threads = process_thread_count() - threads_before;
+
+    std::vector<std::vector<std::chrono::microseconds>> latencies(CLIENT_THREADS);
+    std::atomic<size_t> round_trips{0};
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> clients;
+    for (size_t t = 0; t < CLIENT_THREADS; ++t) {
+        clients.emplace_back([&, t] {
+            auto& owned = sockets[t];
+            std::vector<std::chrono::steady_clock::time_point> sent_at(owned.size());
+            for (size_t round = 0; round < ROUNDS; ++round) {
+                for (size_t i = 0; i < owned.size(); ++i) {
+                    sent_at[i] = std::chrono::steady_clock::now();
+                    (void)send_all(owned[i], request);
+                }
+                for (size_t i = 0; i < owned.size(); ++i) {
+                    if (read_frame(owned[i])) {
+                        latencies[t].push_back(
+                            std::chrono::duration_cast<std::chrono::microseconds>(
+                                std::chrono::steady_clock::now() - sent_at[i]));
+                        round_trips++;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& c : clients) {
+        c.join();
+    }
+    result.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    result.round_trips = round_trips;
+
+    for (auto& per_thread : latencies) {
+        result.latencies.insert(result.latencies.end(), per_thread.begin(),
+                                per_thread.end());
+    }
+
+    for (auto& owned : sockets) {
+        for (int fd : owned) {
+            ::close(fd);
+        }
+    }
+    server.stop(true, std::chrono::seconds{5});
+    return result;
+}
+
+void print_result(const char* label, const scaling_result& result) {
+    const double per_second =
+        result.elapsed.count() > 0
+            ? static_cast<double>(result.round_trips) * 1000.0 /
+                  static_cast<double>(result.elapsed.count())
+            : 0.0;
+    std::cout << "    " << std::left << std::setw(22) << label << " | "
+              << std::right << std::setw(11) << result.connected << " | "
+              << std::setw(7) << result.server_threads << " | "
+              << std::setw(10) << std::fixed << std::setprecision(0)
+              << per_second << " | " << std::setw(9)
+              << result.percentile(50).count() << " | " << std::setw(9)
+              << result.percentile(99).count() << std::endl;
+}
+
+// =============================================================================
+// Benchmarks
+// =============================================================================
+
+bool test_connection_scaling() {
+    std::cout << "\n  " << CONNECTIONS << " connections x " << ROUNDS
+              << " round trips" << std::endl;
+    std::cout << "    " << std::left << std::setw(22) << "I/O model" << " | "
+              << std::right << std::setw(11) << "Connections" << " | "
+              << std::setw(7) << "Threads" << " | " << std::setw(10) << "Msgs/s"
+              << " | " << std::setw(9) << "P50 (us)" << " | " << std::setw(9)
+              << "P99 (us)" << std::endl;
+    std::cout << "    " << std::string(22, '-') << "-+-" << std::string(11, '-')
+              << "-+-" << std::string(7, '-') << "-+-" << std::string(10, '-')
+              << "-+-" << std::string(9, '-') << "-+-" << std::string(9, '-')
+              << std::endl;
+
+    auto threaded = run_scaling(mllp::mllp_io_model::thread_per_connection, 12651);
+    print_result("thread_per_connection", threaded);
+
+    auto event_loop = run_scaling(mllp::mllp_io_model::event_loop, 12652);
+    print_result("event_loop", event_loop);
+
+    TEST_ASSERT(threaded.connected == CONNECTIONS,
+                "All connections should open (check ulimit -n)");
+    TEST_ASSERT(event_loop.connected == CONNECTIONS,
+                "All connections should open (check ulimit -n)");
+    TEST_ASSERT(event_loop.round_trips == CONNECTIONS * ROUNDS,
+                "Event loop should answer every message");
+    TEST_ASSERT(event_loop.server_threads < threaded.server_threads,
+                "Event loop should use fewer threads");
+    return true;
+}
+
+}  // namespace pacs::bridge::benchmark::mllp_event_loop
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main() {
+    using namespace pacs::bridge::benchmark::mllp_event_loop;
+
+    std::cout << "=============================================" << std::endl;
+    std::cout << "PACS Bridge MLLP Connection Scaling Benchmarks" << std::endl;
+    std::cout << "Thread-per-connection vs event loop" << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    int passed = 0;
+    int failed = 0;
+
+    std::cout << "\n--- Connection Scaling ---" << std::endl;
+    RUN_TEST(test_connection_scaling);
+
+    // Summary
+    std::cout << "\n=============================================" << std::endl;
+    std::cout << "Results: " << passed << " passed, " << failed << " failed"
+              << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    return failed > 0 ? 1 : 0;
+}
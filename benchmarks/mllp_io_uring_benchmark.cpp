@@ -0,0 +1,288 @@
+/**
+ * @file mllp_io_uring_benchmark.cpp
+ * @brief MLLP io_uring transport benchmarks
+ *
+ * Measures ORM^O01 / ACK round-trip throughput over loopback for each
+ * server transport and client transport combination:
+ * - Server: thread_per_connection (BSD sockets), event_loop (epoll),
+ *   io_uring
+ * - Client: blocking BSD sockets, io_uring (send and receive submitted
+ *   together)
+ *
+ * Each client thread owns one mllp_client and runs sequential round trips,
+ * so latency reflects per-message transport cost. Reports throughput and
+ * P50/P99 latency.
+ *
+ * Linux only; skipped when the kernel or UAPI headers lack io_uring support.
+ */
+
+#include "pacs/bridge/mllp/mllp_client.h"
+#include "pacs/bridge/mllp/mllp_server.h"
+#include "pacs/bridge/mllp/mllp_types.h"
+
+#include "../src/mllp/io_uring_ring.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace pacs::bridge::benchmark::mllp_io_uring {
+
+// =============================================================================
+// Test Utilities
+// =============================================================================
+
+#define TEST_ASSERT(condition, message)                                        \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::cerr << "FAILED: " << message << " at " << __FILE__ << ":"   \
+                      << __LINE__ << std::endl;                                \
+            return false;                                                      \
+        }                                                                      \
+    } while (0)
+
+#define RUN_TEST(test_func)                                                    \
+    do {                                                                       \
+        std::cout << "Running " << #test_func << "..." << std::endl;           \
+        auto start = std::chrono::high_resolution_clock::now();                \
+        if (test_func()) {                                                     \
+            auto end = std::chrono::high_resolution_clock::now();              \
+            auto duration =                                                    \
+                std::chrono::duration_cast<std::chrono::milliseconds>(         \
+                    end - start);                                              \
+            std::cout << "  PASSED (" << duration.count() << "ms)"            \
+                      << std::endl;                                            \
+            passed++;                                                          \
+        } else {                                                               \
+            std::cout << "  FAILED" << std::endl;                              \
+            failed++;                                                          \
+        }                                                                      \
+    } while (0)
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+constexpr size_t CLIENT_THREADS = 8;
+constexpr size_t MESSAGES_PER_CLIENT = 2000;
+
+const std::string SAMPLE_ORM =
+    "MSH|^~\\&|HIS|HOSPITAL|PACS|RADIOLOGY|20240115110000||ORM^O01|MSG002|P|2.4\r"
+    "PID|1||12345^^^HOSPITAL^MR||DOE^JOHN||19800515|M\r"
+    "ORC|NW|ORD001^HIS|ACC001^PACS||SC\r"
+    "OBR|1|ORD001^HIS|ACC001^PACS|71020^CHEST XRAY^CPT\r";
+
+const std::string SAMPLE_ACK =
+    "MSH|^~\\&|PACS|RADIOLOGY|HIS|HOSPITAL|20240115110001||ACK^O01|ACK002|P|2.4\r"
+    "MSA|AA|MSG002\r";
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+struct throughput_result {
+    size_t round_trips = 0;
+    size_t errors = 0;
+    std::chrono::milliseconds elapsed{0};
+    std::vector<std::chrono::microseconds> latencies;
+
+    double per_second() const {
+        return elapsed.count() > 0 ? static_cast<double>(round_trips) * 1000.0 /
+                                         static_cast<double>(elapsed.count())
+                                   : 0.0;
+    }
+
+    std::chrono::microseconds percentile(double p) const {
+        if (latencies.empty()) {
+            return std::chrono::microseconds{0};
+        }
+        auto sorted = latencies;
+        std::sort(sorted.begin(), sorted.end());
+        size_t idx = static_cast<size_t>(static_cast<double>(sorted.size()) * p / 100.0);
+        return sorted[std::min(idx, sorted.size() - 1)];
+    }
+};
+
+/**
+ * @brief Run CLIENT_THREADS x MESSAGES_PER_CLIENT round trips
+ */
+throughput_result run_throughput(mllp::mllp_io_model model, bool client_io_uring,
+                                 uint16_t port) {
+    throughput_result result;
+
+    mllp::mllp_server_config config;
+    config.port = port;
+    config.io_model = model;
+    config.worker_threads = 4;
+
+    mllp::mllp_server server(config);
+    server.set_message_handler(
+        [](const mllp::mllp_message&, const mllp::mllp_session_info&)
+            -> std::optional<mllp::mllp_message> {
+            return mllp::mllp_message::from_string(SAMPLE_ACK);
+        });
+    if (!server.start()) {
+        return result;
+    }
+
+    const auto request = mllp::mllp_message::from_string(SAMPLE_ORM);
+    std::vector<std::vector<std::chrono::microseconds>> latencies(CLIENT_THREADS);
+    std::atomic<size_t> round_trips{0};
+    std::atomic<size_t> errors{0};
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> clients;
+    for (size_t t = 0; t < CLIENT_THREADS; ++t) {
+        clients.emplace_back([&, t] {
+            mllp::mllp_client_config client_config;
+            client_config.host = "127.0.0.1";
+            client_config.port = port;
+            client_config.use_io_uring = client_io_uring;
+            client_config.retry_count = 0;
+
+            mllp::mllp_client client(client_config);
+            if (!client.connect()) {
+                errors++;
+                return;
+            }
+            latencies[t].reserve(MESSAGES_PER_CLIENT);
+            for (size_t i = 0; i < MESSAGES_PER_CLIENT; ++i) {
+                auto sent_at = std::chrono::steady_clock::now();
+                if (!client.send(request)) {
+                    errors++;
+                    continue;
+                }
+                latencies[t].push_back(
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - sent_at));
+                round_trips++;
+            }
+            client.disconnect();
+        });
+    }
+    for (auto& c : clients) {
+        c.join();
+    }
+    result.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    result.round_trips = round_trips;
+    result.errors = errors;
+
+    for (auto& per_thread : latencies) {
+        result.latencies.insert(result.latencies.end(), per_thread.begin(),
+                                per_thread.end());
+    }
+
+    server.stop(true, std::chrono::seconds{5});
+    return result;
+}
+
+void print_result(const char* server_label, const char* client_label,
+                  const throughput_result& result) {
+    std::cout << "    " << std::left << std::setw(22) << server_label << " | "
+              << std::setw(8) << client_label << " | " << std::right
+              << std::setw(10) << std::fixed << std::setprecision(0)
+              << result.per_second() << " | " << std::setw(9)
+              << result.percentile(50).count() << " | " << std::setw(9)
+              << result.percentile(99).count() << std::endl;
+}
+
+// =============================================================================
+// Benchmarks
+// =============================================================================
+
+bool test_transport_throughput() {
+#ifdef PACS_BRIDGE_HAS_IO_URING
+    const bool supported = mllp::io_uring_ring::supported();
+#else
+    const bool supported = false;
+#endif
+    if (!supported) {
+        std::cout << "  io_uring not supported by this build or kernel, skipping"
+                  << std::endl;
+        return true;
+    }
+
+    std::cout << "\n  " << CLIENT_THREADS << " clients x " << MESSAGES_PER_CLIENT
+              << " sequential round trips" << std::endl;
+    std::cout << "    " << std::left << std::setw(22) << "Server" << " | "
+              << std::setw(8) << "Client" << " | " << std::right
+              << std::setw(10) << "Msgs/s" << " | " << std::setw(9)
+              << "P50 (us)" << " | " << std::setw(9) << "P99 (us)" << std::endl;
+    std::cout << "    " << std::string(22, '-') << "-+-" << std::string(8, '-')
+              << "-+-" << std::string(10, '-') << "-+-" << std::string(9, '-')
+              << "-+-" << std::string(9, '-') << std::endl;
+
+    struct server_case {
+        const char* label;
+        mllp::mllp_io_model model;
+    };
+    const server_case servers[] = {
+        {"thread_per_connection", mllp::mllp_io_model::thread_per_connection},
+        {"event_loop", mllp::mllp_io_model::event_loop},
+        {"io_uring", mllp::mllp_io_model::io_uring},
+    };
+
+    uint16_t port = 12661;
+    throughput_result bsd_baseline;
+    throughput_result uring_both;
+    for (const auto& server : servers) {
+        for (bool client_io_uring : {false, true}) {
+            auto result = run_throughput(server.model, client_io_uring, port++);
+            print_result(server.label, client_io_uring ? "io_uring" : "bsd", result);
+
+            TEST_ASSERT(result.errors == 0, "Every round trip should succeed");
+            TEST_ASSERT(result.round_trips == CLIENT_THREADS * MESSAGES_PER_CLIENT,
+                        "Every message should be answered");
+
+            if (server.model == mllp::mllp_io_model::thread_per_connection &&
+                !client_io_uring) {
+                bsd_baseline = std::move(result);
+            } else if (server.model == mllp::mllp_io_model::io_uring &&
+                       client_io_uring) {
+                uring_both = std::move(result);
+            }
+        }
+    }
+
+    std::cout << "\n    io_uring / BSD throughput: " << std::setprecision(2)
+              << (bsd_baseline.per_second() > 0
+                      ? uring_both.per_second() / bsd_baseline.per_second()
+                      : 0.0)
+              << "x" << std::endl;
+    return true;
+}
+
+}  // namespace pacs::bridge::benchmark::mllp_io_uring
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main() {
+    using namespace pacs::bridge::benchmark::mllp_io_uring;
+
+    std::cout << "=============================================" << std::endl;
+    std::cout << "PACS Bridge MLLP io_uring Transport Benchmarks" << std::endl;
+    std::cout << "BSD sockets vs epoll vs io_uring" << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    int passed = 0;
+    int failed = 0;
+
+    std::cout << "\n--- Transport Throughput ---" << std::endl;
+    RUN_TEST(test_transport_throughput);
+
+    // Summary
+    std::cout << "\n=============================================" << std::endl;
+    std::cout << "Results: " << passed << " passed, " << failed << " failed"
+              << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,423 @@
+/**
+ * @file patient_cache_benchmark.cpp
+ * @brief Multi-threaded hit ratio and throughput of patient_cache
+ *
+ * Compares the sharded patient_cache against single_lock_cache, a copy of
+ * the previous design reduced to get/put: one shared_mutex, a std::list
+ * LRU order bumped under the unique lock on every hit, and a full patient
+ * copy per hit.
+ *
+ * - Cache-aside workload: Zipf(0.9) lookups over 50,000 MRNs into a
+ *   10,000-entry cache, loading on miss. Reports hit ratio (the eviction
+ *   policy) and lookups per second
+ * - Hit path: every lookup hits; get() (copy) and get_shared() against
+ *   the single-lock get
+ * - Warm start: snapshot write and background restore of 500,000
+ *   patients, and how long construction blocks
+ */
+
+#include "pacs/bridge/cache/patient_cache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace pacs::bridge::benchmark::caching {
+
+using cache::patient_cache_config;
+using mapping::dicom_patient;
+
+// =============================================================================
+// Test Utilities
+// =============================================================================
+
+#define TEST_ASSERT(condition, message)                                        \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::cerr << "FAILED: " << message << " at " << __FILE__ << ":"   \
+                      << __LINE__ << std::endl;                                \
+            return false;                                                      \
+        }                                                                      \
+    } while (0)
+
+#define RUN_TEST(test_func)                                                    \
+    do {                                                                       \
+        std::cout << "Running " << #test_func << "..." << std::endl;           \
+        auto start = std::chrono::high_resolution_clock::now();                \
+        if (test_func()) {                                                     \
+            auto end = std::chrono::high_resolution_clock::now();              \
+            auto duration =                                                    \
+                std::chrono::duration_cast<std::chrono::milliseconds>(         \
+                    end - start);                                              \
+            std::cout << "  PASSED (" << duration.count() << "ms)"            \
+                      << std::endl;                                            \
+            passed++;                                                          \
+        } else {                                                               \
+            std::cout << "  FAILED" << std::endl;                              \
+            failed++;                                                          \
+        }                                                                      \
+    } while (0)
+
+constexpr size_t key_space = 50000;
+constexpr size_t capacity = 10000;
+constexpr size_t sequence_length = size_t{1} << 16;
+constexpr size_t thread_counts[] = {1, 2, 4, 8};
+
+dicom_patient make_patient(size_t index) {
+    dicom_patient patient;
+    patient.patient_id = "MRN" + std::to_string(index);
+    patient.issuer_of_patient_id = "HOSPITAL_A";
+    patient.patient_name = "DOE^JOHN^WILLIAM^^";
+    patient.patient_birth_date = "19800515";
+    patient.patient_sex = "M";
+    patient.patient_weight = 72.5;
+    patient.other_patient_ids = {"SSN:123-45-6789", "ALT:" + std::to_string(index)};
+    patient.patient_comments = "Registered through ADT^A04";
+    return patient;
+}
+
+/**
+ * @brief Per-thread Zipf-distributed key indices
+ */
+std::vector<std::vector<uint32_t>> zipf_sequences(size_t thread_count,
+                                                  double skew) {
+    std::vector<double> cdf(key_space);
+    double total = 0.0;
+    for (size_t i = 0; i < key_space; ++i) {
+        total += 1.0 / std::pow(static_cast<double>(i + 1), skew);
+        cdf[i] = total;
+    }
+
+    std::vector<std::vector<uint32_t>> sequences(thread_count);
+    for (size_t t = 0; t < thread_count; ++t) {
+        std::mt19937_64 rng(42 + t);
+        std::uniform_real_distribution<double> uniform(0.0, total);
+        sequences[t].resize(sequence_length);
+        for (auto& index : sequences[t]) {
+            auto it = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng));
+            index = static_cast<uint32_t>(
+                std::min<size_t>(static_cast<size_t>(it - cdf.begin()),
+                                 key_space - 1));
+        }
+    }
+    return sequences;
+}
+
+/**
+ * @brief Run body(thread_index) on thread_count threads
+ * @return Wall-clock seconds from release to the last thread finishing
+ */
+double run_threads(size_t thread_count, const std::function<void(size_t)>& body) {
+    std::atomic<size_t> ready{0};
+    std::atomic<bool> go{false};
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            ready.fetch_add(1);
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            body(t);
+        });
+    }
+    while (ready.load() < thread_count) {
+        std::this_thread::yield();
+    }
+    auto start = std::chrono::steady_clock::now();
+    go.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+struct result {
+    double lookups_per_second = 0.0;
+    double hit_ratio = 0.0;
+};
+
+void print_row(const char* label, size_t threads, const result& r) {
+    std::cout << "    " << std::left << std::setw(28) << label << std::right
+              << std::setw(3) << threads << " thread(s)" << std::fixed
+              << std::setprecision(2) << std::setw(10)
+              << r.lookups_per_second / 1e6 << " M lookups/s"
+              << std::setprecision(3) << std::setw(10) << r.hit_ratio
+              << " hit ratio" << std::endl;
+}
+
+// =============================================================================
+// Single-Lock Cache (previous design)
+// =============================================================================
+
+class single_lock_cache {
+public:
+    explicit single_lock_cache(size_t max_entries) : max_entries_(max_entries) {}
+
+    void put(std::string_view key, const dicom_patient& patient) {
+        std::unique_lock lock(mutex_);
+        std::string key_str(key);
+        while (entries_.size() >= max_entries_ && !lru_order_.empty()) {
+            const std::string& oldest = lru_order_.back();
+            entries_.erase(oldest);
+            lru_index_.erase(oldest);
+            lru_order_.pop_back();
+        }
+        entries_[key_str] = patient;
+        touch(key_str);
+    }
+
+    std::optional<dicom_patient> get(std::string_view key) {
+        std::unique_lock lock(mutex_);
+        std::string key_str(key);
+        auto it = entries_.find(key_str);
+        if (it == entries_.end()) {
+            return std::nullopt;
+        }
+        touch(key_str);
+        return it->second;
+    }
+
+private:
+    void touch(const std::string& key) {
+        auto it = lru_index_.find(key);
+        if (it != lru_index_.end()) {
+            lru_order_.erase(it->second);
+        }
+        lru_order_.push_front(key);
+        lru_index_[key] = lru_order_.begin();
+    }
+
+    size_t max_entries_;
+    std::unordered_map<std::string, dicom_patient> entries_;
+    std::list<std::string> lru_order_;
+    std::unordered_map<std::string, std::list<std::string>::iterator> lru_index_;
+    std::shared_mutex mutex_;
+};
+
+// =============================================================================
+// Cache-Aside Workload
+// =============================================================================
+
+/**
+ * @brief Zipf lookups, loading on miss, with iterations lookups per thread
+ */
+template <typename Cache>
+result run_cache_aside(Cache& cache, size_t thread_count, size_t iterations,
+                       const std::vector<std::string>& keys,
+                       const std::vector<dicom_patient>& patients,
+                       const std::vector<std::vector<uint32_t>>& sequences) {
+    std::atomic<size_t> hits{0};
+    double seconds = run_threads(thread_count, [&](size_t t) {
+        const auto& sequence = sequences[t];
+        size_t local_hits = 0;
+        for (size_t i = 0; i < iterations; ++i) {
+            uint32_t index = sequence[i & (sequence_length - 1)];
+            if (cache.get(keys[index])) {
+                ++local_hits;
+            } else {
+                cache.put(keys[index], patients[index]);
+            }
+        }
+        hits.fetch_add(local_hits);
+    });
+
+    result r;
+    double lookups = static_cast<double>(thread_count * iterations);
+    r.lookups_per_second = lookups / seconds;
+    r.hit_ratio = static_cast<double>(hits.load()) / lookups;
+    return r;
+}
+
+bool test_cache_aside_workload() {
+    constexpr size_t iterations = 200000;
+
+    std::vector<std::string> keys;
+    std::vector<dicom_patient> patients;
+    for (size_t i = 0; i < key_space; ++i) {
+        patients.push_back(make_patient(i));
+        keys.push_back(patients.back().patient_id);
+    }
+    auto sequences = zipf_sequences(8, 0.9);
+
+    std::cout << "\n    Zipf(0.9) over " << key_space << " MRNs, capacity "
+              << capacity << ", load on miss:" << std::endl;
+    for (size_t threads : thread_counts) {
+        single_lock_cache legacy(capacity);
+        auto before = run_cache_aside(legacy, threads, iterations, keys,
+                                      patients, sequences);
+
+        patient_cache_config config;
+        config.max_entries = capacity;
+        cache::patient_cache sharded(config);
+        auto after = run_cache_aside(sharded, threads, iterations, keys,
+                                     patients, sequences);
+
+        print_row("single lock, exact LRU", threads, before);
+        print_row("sharded, sampled LRU", threads, after);
+
+        TEST_ASSERT(after.hit_ratio >= before.hit_ratio - 0.03,
+                    "Sampled LRU should keep the exact LRU hit ratio");
+    }
+    return true;
+}
+
+// =============================================================================
+// Hit Path
+// =============================================================================
+
+bool test_hit_path() {
+    constexpr size_t iterations = 500000;
+    constexpr size_t hot_keys = 1000;
+
+    std::vector<std::string> keys;
+    single_lock_cache legacy(capacity);
+    patient_cache_config config;
+    config.max_entries = capacity;
+    cache::patient_cache sharded(config);
+    for (size_t i = 0; i < hot_keys; ++i) {
+        auto patient = make_patient(i);
+        keys.push_back(patient.patient_id);
+        legacy.put(keys.back(), patient);
+        sharded.put(keys.back(), patient);
+    }
+
+    auto measure = [&](size_t threads, auto&& lookup) {
+        std::atomic<size_t> hits{0};
+        double seconds = run_threads(threads, [&](size_t t) {
+            size_t local_hits = 0;
+            for (size_t i = 0; i < iterations; ++i) {
+                if (lookup(keys[(i * 7 + t * 131) % hot_keys])) {
+                    ++local_hits;
+                }
+            }
+            hits.fetch_add(local_hits);
+        });
+        result r;
+        double lookups = static_cast<double>(threads * iterations);
+        r.lookups_per_second = lookups / seconds;
+        r.hit_ratio = static_cast<double>(hits.load()) / lookups;
+        return r;
+    };
+
+    std::cout << "\n    Every lookup hits (" << hot_keys << " patients):"
+              << std::endl;
+    for (size_t threads : thread_counts) {
+        auto before = measure(threads, [&](const std::string& key) {
+            return legacy.get(key).has_value();
+        });
+        auto copied = measure(threads, [&](const std::string& key) {
+            return sharded.get(key).has_value();
+        });
+        auto shared = measure(threads, [&](const std::string& key) {
+            return sharded.get_shared(key).has_value();
+        });
+
+        print_row("single lock, get()", threads, before);
+        print_row("sharded, get()", threads, copied);
+        print_row("sharded, get_shared()", threads, shared);
+
+        TEST_ASSERT(shared.hit_ratio == 1.0 && copied.hit_ratio == 1.0,
+                    "Every lookup should hit");
+    }
+    return true;
+}
+
+// =============================================================================
+// Warm Start
+// =============================================================================
+
+bool test_snapshot_warm_start() {
+    constexpr size_t patients = 500000;
+    auto path = std::filesystem::temp_directory_path() /
+                "pacs_bridge_patient_cache_benchmark.snap";
+
+    // Headroom so no shard evicts while filling
+    patient_cache_config config;
+    config.max_entries = 2 * patients;
+    {
+        cache::patient_cache source(config);
+        for (size_t i = 0; i < patients; ++i) {
+            auto patient = make_patient(i);
+            std::string key = patient.patient_id;
+            source.put(key, std::move(patient));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        auto saved = source.save_snapshot(path);
+        auto end = std::chrono::steady_clock::now();
+        TEST_ASSERT(saved.has_value() && *saved == patients,
+                    "Snapshot should hold every patient");
+        std::cout << "\n    Save " << patients << " patients: " << std::fixed
+                  << std::setprecision(1)
+                  << std::chrono::duration<double, std::milli>(end - start).count()
+                  << " ms, " << std::filesystem::file_size(path) / (1024 * 1024)
+                  << " MiB" << std::endl;
+    }
+
+    config.snapshot_path = path;
+    config.snapshot_interval = std::chrono::seconds{0};
+    auto start = std::chrono::steady_clock::now();
+    cache::patient_cache restored(config);
+    auto constructed = std::chrono::steady_clock::now();
+    while (restored.size() < patients &&
+           std::chrono::steady_clock::now() - start < std::chrono::seconds(30)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    auto warm = std::chrono::steady_clock::now();
+
+    std::cout << "    Construct with snapshot: " << std::setprecision(3)
+              << std::chrono::duration<double, std::milli>(constructed - start).count()
+              << " ms" << std::endl;
+    std::cout << "    Fully restored after:    " << std::setprecision(1)
+              << std::chrono::duration<double, std::milli>(warm - start).count()
+              << " ms" << std::endl;
+
+    std::filesystem::remove(path);
+    TEST_ASSERT(restored.size() == patients, "Every patient should be restored");
+    TEST_ASSERT(constructed - start < std::chrono::milliseconds(50),
+                "Construction should not wait for the restore");
+    return true;
+}
+
+}  // namespace pacs::bridge::benchmark::caching
+
+int main() {
+    using namespace pacs::bridge::benchmark::caching;
+
+    std::cout << "=============================================" << std::endl;
+    std::cout << "PACS Bridge Patient Cache Benchmarks" << std::endl;
+    std::cout << "Single-lock LRU vs sharded, sampled LRU" << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    int passed = 0;
+    int failed = 0;
+
+    std::cout << "\n--- Patient Cache ---" << std::endl;
+    RUN_TEST(test_cache_aside_workload);
+    RUN_TEST(test_hit_path);
+    RUN_TEST(test_snapshot_warm_start);
+
+    // Summary
+    std::cout << "\n=============================================" << std::endl;
+    std::cout << "Results: " << passed << " passed, " << failed << " failed"
+              << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,280 @@
+/**
+ * @file router_benchmark.cpp
+ * @brief Route matching benchmarks at 10, 100 and 1000 routes
+ *
+ * Compares per-message route matching:
+ * - Linear: every route checked in turn, regexes compiled on each check
+ *   (the matcher before patterns were compiled and indexed)
+ * - Indexed: message_router::find_matching_routes(), with patterns compiled
+ *   when routes are added and candidates taken from the route index
+ *
+ * Route sets are mostly exact message type / trigger / facility routes, one
+ * in ten regex routes, and a catch-all, which is typical of interface
+ * engine configurations. Regex routes cannot be indexed, so they remain
+ * candidates for every message and dominate the indexed cost.
+ */
+
+#include "pacs/bridge/performance/benchmark_runner.h"
+#include "pacs/bridge/protocol/hl7/hl7_message.h"
+#include "pacs/bridge/router/message_router.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace pacs::bridge::benchmark::routing {
+
+// =============================================================================
+// Test Utilities
+// =============================================================================
+
+#define TEST_ASSERT(condition, message)                                        \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::cerr << "FAILED: " << message << " at " << __FILE__ << ":"   \
+                      << __LINE__ << std::endl;                                \
+            return false;                                                      \
+        }                                                                      \
+    } while (0)
+
+#define RUN_TEST(test_func)                                                    \
+    do {                                                                       \
+        std::cout << "Running " << #test_func << "..." << std::endl;           \
+        auto start = std::chrono::high_resolution_clock::now();                \
+        if (test_func()) {                                                     \
+            auto end = std::chrono::high_resolution_clock::now();              \
+            auto duration =                                                    \
+                std::chrono::duration_cast<std::chrono::milliseconds>(         \
+                    end - start);                                              \
+            std::cout << "  PASSED (" << duration.count() << "ms)"            \
+                      << std::endl;                                            \
+            passed++;                                                          \
+        } else {                                                               \
+            std::cout << "  FAILED" << std::endl;                              \
+            failed++;                                                          \
+        }                                                                      \
+    } while (0)
+
+// =============================================================================
+// Sample Messages and Routes
+// =============================================================================
+
+const std::string SAMPLE_ADT_A01 =
+    "MSH|^~\\&|HIS|HOSPITAL|PACS|RADIOLOGY|20240115103000||ADT^A01|MSG001|P|2.4\r"
+    "PID|1||12345|||DOE^JOHN||19800515|M\r";
+
+const char* const MESSAGE_TYPES[] = {"ADT", "ORM", "ORU", "SIU", "MDM",
+                                     "DFT", "BAR", "MFN", "QRY", "ACK"};
+
+/**
+ * @brief Build a route set of the given size
+ *
+ * Route i matches type MESSAGE_TYPES[i % 10], trigger "E<i / 10>" and
+ * facility "SITE<i % 7>"; every tenth route is instead a regex on the
+ * trigger. The last route is a catch-all.
+ */
+std::vector<router::route> make_routes(size_t count) {
+    std::vector<router::route> routes;
+    routes.reserve(count);
+    for (size_t i = 0; i + 1 < count; ++i) {
+        router::route r;
+        r.id = "route_" + std::to_string(i);
+        r.priority = static_cast<int>(i);
+        r.handler_ids = {"noop"};
+        r.pattern.message_type = MESSAGE_TYPES[i % 10];
+        if (i % 10 == 9) {
+            r.pattern.trigger_event = "Z[0-9]+" + std::to_string(i);
+            r.pattern.use_regex = true;
+        } else {
+            r.pattern.trigger_event = "E" + std::to_string(i / 10);
+            r.pattern.sending_facility = "SITE" + std::to_string(i % 7);
+        }
+        routes.push_back(std::move(r));
+    }
+
+    router::route catch_all;
+    catch_all.id = "catch_all";
+    catch_all.priority = static_cast<int>(count);
+    catch_all.handler_ids = {"noop"};
+    catch_all.pattern = router::message_pattern::any();
+    routes.push_back(std::move(catch_all));
+    return routes;
+}
+
+// =============================================================================
+// Linear Matcher (patterns interpreted per check)
+// =============================================================================
+
+bool legacy_field_matches(const std::string& pattern, std::string_view value,
+                          bool use_regex) {
+    if (pattern.empty()) return true;
+    if (use_regex) {
+        try {
+            std::regex re(pattern, std::regex::icase);
+            return std::regex_match(std::string(value), re);
+        } catch (const std::regex_error&) {
+            return false;
+        }
+    }
+    if (pattern == "*") return true;
+    if (pattern.back() == '*') {
+        std::string_view prefix(pattern.data(), pattern.size() - 1);
+        return value.substr(0, prefix.size()) == prefix;
+    }
+    return pattern == value;
+}
+
+bool legacy_matches(const router::message_pattern& p,
+                    const hl7::hl7_message_header& h) {
+    const bool re = p.use_regex;
+    return legacy_field_matches(p.message_type, h.type_string, re) &&
+           legacy_field_matches(p.trigger_event, h.trigger_event, re) &&
+           legacy_field_matches(p.sending_application, h.sending_application, re) &&
+           legacy_field_matches(p.sending_facility, h.sending_facility, re) &&
+           legacy_field_matches(p.receiving_application, h.receiving_application, re) &&
+           legacy_field_matches(p.receiving_facility, h.receiving_facility, re) &&
+           legacy_field_matches(p.processing_id, h.processing_id, re) &&
+           legacy_field_matches(p.version, h.version_id, re);
+}
+
+// =============================================================================
+// Benchmarks
+// =============================================================================
+
+/**
+ * @brief Match one ADT^A01 against 10, 100 and 1000 routes
+ */
+bool test_route_matching_scaling() {
+    using namespace performance;
+
+    const size_t warmup = 20;
+
+    auto parsed = hl7::hl7_message::parse(SAMPLE_ADT_A01);
+    TEST_ASSERT(parsed.has_value(), "Sample message should parse");
+    const auto& message = *parsed;
+
+    std::cout << "\n  Route matching (ADT^A01):" << std::endl;
+    std::cout << "    " << std::right << std::setw(8) << "Routes"
+              << " | " << std::setw(13) << "Linear"
+              << " | " << std::setw(13) << "Indexed"
+              << " | " << std::setw(8) << "Speedup" << std::endl;
+    std::cout << "    " << std::string(8, '-') << "-+-" << std::string(13, '-')
+              << "-+-" << std::string(13, '-') << "-+-" << std::string(8, '-')
+              << std::endl;
+
+    for (size_t count : {size_t{10}, size_t{100}, size_t{1000}}) {
+        auto routes = make_routes(count);
+
+        router::message_router router;
+        router.register_handler("noop", [](const hl7::hl7_message&) {
+            return router::handler_result::ok();
+        });
+        for (const auto& r : routes) {
+            TEST_ASSERT(router.add_route(r).has_value(), "Route should be added");
+        }
+
+        // Same answer from both matchers
+        std::vector<std::string> linear_ids;
+        auto header = message.header();
+        for (const auto& r : routes) {
+            if (legacy_matches(r.pattern, header)) {
+                linear_ids.push_back(r.id);
+            }
+        }
+        TEST_ASSERT(router.find_matching_routes(message) == linear_ids,
+                    "Indexed and linear matching should agree");
+
+        const size_t iterations = count >= 1000 ? 200 : 2000;
+        auto linear_avg = benchmark_with_warmup(
+            [&]() {
+                auto h = message.header();
+                size_t matched = 0;
+                for (const auto& r : routes) {
+                    matched += legacy_matches(r.pattern, h) ? 1 : 0;
+                }
+                (void)matched;
+            },
+            warmup, iterations);
+
+        auto indexed_avg = benchmark_with_warmup(
+            [&]() { (void)router.find_matching_routes(message); },
+            warmup, iterations * 10);
+
+        double linear_ns = static_cast<double>(linear_avg.count());
+        double indexed_ns = static_cast<double>(indexed_avg.count());
+        std::cout << "    " << std::setw(8) << count << " | " << std::setw(10)
+                  << std::fixed << std::setprecision(0) << linear_ns << " ns"
+                  << " | " << std::setw(10) << indexed_ns << " ns"
+                  << " | " << std::setw(7) << std::setprecision(1)
+                  << (indexed_ns > 0 ? linear_ns / indexed_ns : 0.0) << "x"
+                  << std::endl;
+    }
+    return true;
+}
+
+/**
+ * @brief Full route() dispatch cost at 10, 100 and 1000 routes
+ */
+bool test_route_dispatch_scaling() {
+    using namespace performance;
+
+    const size_t warmup = 100;
+    const size_t iterations = 5000;
+
+    auto parsed = hl7::hl7_message::parse(SAMPLE_ADT_A01);
+    TEST_ASSERT(parsed.has_value(), "Sample message should parse");
+
+    std::cout << "\n  route() dispatch (ADT^A01):" << std::endl;
+    for (size_t count : {size_t{10}, size_t{100}, size_t{1000}}) {
+        router::message_router router;
+        router.register_handler("noop", [](const hl7::hl7_message&) {
+            return router::handler_result::ok();
+        });
+        for (const auto& r : make_routes(count)) {
+            (void)router.add_route(r);
+        }
+        router.set_log_level(router::message_router::log_level::error);
+
+        auto result = router.route(*parsed);
+        TEST_ASSERT(result.has_value(), "Message should route");
+
+        auto avg = benchmark_with_warmup([&]() { (void)router.route(*parsed); },
+                                         warmup, iterations);
+        std::cout << "    " << std::setw(8) << count << " routes | "
+                  << std::setw(10) << avg.count() << " ns/message" << std::endl;
+    }
+    return true;
+}
+
+}  // namespace pacs::bridge::benchmark::routing
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main() {
+    using namespace pacs::bridge::benchmark::routing;
+
+    std::cout << "=============================================" << std::endl;
+    std::cout << "PACS Bridge Router Benchmarks" << std::endl;
+    std::cout << "Linear vs compiled, indexed route matching" << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    int passed = 0;
+    int failed = 0;
+
+    std::cout << "\n--- Route Matching ---" << std::endl;
+    RUN_TEST(test_route_matching_scaling);
+    RUN_TEST(test_route_dispatch_scaling);
+
+    // Summary
+    std::cout << "\n=============================================" << std::endl;
+    std::cout << "Results: " << passed << " passed, " << failed << " failed"
+              << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    return failed > 0 ? 1 : 0;
+}
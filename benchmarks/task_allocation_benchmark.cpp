@@ -0,0 +1,276 @@
+/**
+ * @file task_allocation_benchmark.cpp
+ * @brief Heap allocations per task for std::function and small_task
+ *
+ * Counts calls to the global operator new while tasks are built, posted to
+ * thread_pool_manager and run:
+ * - Construction: std::function against small_task<> for captures below,
+ *   at and above the inline capacity
+ * - Pool posting: lambdas posted directly (small_task, inline or pooled
+ *   overflow) against lambdas first wrapped in std::function, which is how
+ *   every task was posted before thread_pool_manager took small_task
+ *
+ * Steady-state counts exclude a warm-up pass that fills the overflow
+ * caches.
+ */
+
+#include "pacs/bridge/performance/small_task.h"
+#include "pacs/bridge/performance/thread_pool_manager.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <thread>
+
+// =============================================================================
+// Allocation Counting
+// =============================================================================
+
+namespace {
+std::atomic<uint64_t> g_allocations{0};
+}  // namespace
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    auto align = static_cast<std::size_t>(alignment);
+    if (void* ptr = std::aligned_alloc(align, (size + align - 1) / align * align)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+namespace pacs::bridge::benchmark::tasks {
+
+using performance::small_task;
+using performance::task_priority;
+using performance::thread_pool_config;
+using performance::thread_pool_manager;
+
+// =============================================================================
+// Test Utilities
+// =============================================================================
+
+#define TEST_ASSERT(condition, message)                                        \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::cerr << "FAILED: " << message << " at " << __FILE__ << ":"   \
+                      << __LINE__ << std::endl;                                \
+            return false;                                                      \
+        }                                                                      \
+    } while (0)
+
+#define RUN_TEST(test_func)                                                    \
+    do {                                                                       \
+        std::cout << "Running " << #test_func << "..." << std::endl;           \
+        auto start = std::chrono::high_resolution_clock::now();                \
+        if (test_func()) {                                                     \
+            auto end = std::chrono::high_resolution_clock::now();              \
+            auto duration =                                                    \
+                std::chrono::duration_cast<std::chrono::milliseconds>(         \
+                    end - start);                                              \
+            std::cout << "  PASSED (" << duration.count() << "ms)"            \
+                      << std::endl;                                            \
+            passed++;                                                          \
+        } else {                                                               \
+            std::cout << "  FAILED" << std::endl;                              \
+            failed++;                                                          \
+        }                                                                      \
+    } while (0)
+
+struct measurement {
+    double allocations_per_task = 0.0;
+    double ns_per_task = 0.0;
+};
+
+void print_row(const char* label, const measurement& m) {
+    std::cout << "    " << std::left << std::setw(34) << label << std::right
+              << std::fixed << std::setprecision(3) << std::setw(10)
+              << m.allocations_per_task << " allocs/task" << std::setprecision(1)
+              << std::setw(10) << m.ns_per_task << " ns/task" << std::endl;
+}
+
+template <typename Body>
+measurement measure(size_t iterations, Body&& body) {
+    uint64_t before = g_allocations.load();
+    auto start = std::chrono::steady_clock::now();
+    body(iterations);
+    auto end = std::chrono::steady_clock::now();
+    uint64_t allocations = g_allocations.load() - before;
+
+    measurement m;
+    m.allocations_per_task =
+        static_cast<double>(allocations) / static_cast<double>(iterations);
+    m.ns_per_task =
+        static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                .count()) /
+        static_cast<double>(iterations);
+    return m;
+}
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+template <typename Task, size_t CaptureBytes>
+measurement measure_construction(size_t iterations) {
+    std::array<char, CaptureBytes> payload{};
+    uint64_t sink = 0;
+    auto run = [&](size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            payload[0] = static_cast<char>(i);
+            Task task([payload, &sink] { sink += static_cast<uint64_t>(payload[0]); });
+            task();
+        }
+    };
+    run(1000);  // warm-up
+    auto m = measure(iterations, run);
+    if (sink == 42) {
+        std::cout << "";
+    }
+    return m;
+}
+
+bool test_task_construction_allocations() {
+    constexpr size_t iterations = 200000;
+
+    std::cout << "\n    Construct, invoke and destroy one task:" << std::endl;
+    auto fn_24 = measure_construction<std::function<void()>, 16>(iterations);
+    auto st_24 = measure_construction<small_task<>, 16>(iterations);
+    auto fn_56 = measure_construction<std::function<void()>, 48>(iterations);
+    auto st_56 = measure_construction<small_task<>, 48>(iterations);
+    auto fn_208 = measure_construction<std::function<void()>, 200>(iterations);
+    auto st_208 = measure_construction<small_task<>, 200>(iterations);
+
+    print_row("std::function, 24 B capture", fn_24);
+    print_row("small_task<>, 24 B capture", st_24);
+    print_row("std::function, 56 B capture", fn_56);
+    print_row("small_task<>, 56 B capture", st_56);
+    print_row("std::function, 208 B capture", fn_208);
+    print_row("small_task<>, 208 B (overflow)", st_208);
+
+    TEST_ASSERT(st_24.allocations_per_task == 0.0 &&
+                    st_56.allocations_per_task == 0.0,
+                "Inline captures should not allocate");
+    TEST_ASSERT(st_208.allocations_per_task < 0.01,
+                "Overflow storage should be recycled");
+    TEST_ASSERT(fn_56.allocations_per_task >= 1.0,
+                "std::function should allocate above its small buffer");
+    return true;
+}
+
+// =============================================================================
+// Thread Pool Posting
+// =============================================================================
+
+template <size_t CaptureBytes, bool WrapInFunction>
+measurement measure_pool_posting(thread_pool_manager& pool, size_t iterations) {
+    std::array<char, CaptureBytes> payload{};
+    std::atomic<size_t> completed{0};
+
+    auto run = [&](size_t count) {
+        completed.store(0);
+        size_t posted = 0;
+        while (posted < count) {
+            // Keep well inside the injection queue capacity
+            if (posted - completed.load(std::memory_order_relaxed) >= 512) {
+                std::this_thread::yield();
+                continue;
+            }
+            auto body = [payload, &completed] {
+                (void)payload;
+                completed.fetch_add(1, std::memory_order_relaxed);
+            };
+            bool ok = false;
+            if constexpr (WrapInFunction) {
+                ok = pool.post(std::function<void()>(body), task_priority::normal);
+            } else {
+                ok = pool.post(body, task_priority::normal);
+            }
+            if (ok) {
+                ++posted;
+            }
+        }
+        while (completed.load() < count) {
+            std::this_thread::yield();
+        }
+    };
+
+    run(5000);  // warm-up
+    return measure(iterations, run);
+}
+
+bool test_thread_pool_post_allocations() {
+    constexpr size_t iterations = 100000;
+
+    thread_pool_config config;
+    config.min_threads = 4;
+    config.max_threads = 4;
+    thread_pool_manager pool(config);
+    TEST_ASSERT(pool.start().has_value(), "Pool should start");
+
+    std::cout << "\n    Post and run one task on a 4-worker pool:" << std::endl;
+    auto fn_48 = measure_pool_posting<40, true>(pool, iterations);
+    auto st_48 = measure_pool_posting<40, false>(pool, iterations);
+    auto fn_208 = measure_pool_posting<200, true>(pool, iterations);
+    auto st_208 = measure_pool_posting<200, false>(pool, iterations);
+
+    (void)pool.stop(true);
+
+    print_row("std::function, 48 B capture", fn_48);
+    print_row("small_task<>, 48 B capture", st_48);
+    print_row("std::function, 208 B capture", fn_208);
+    print_row("small_task<>, 208 B (overflow)", st_208);
+
+    TEST_ASSERT(st_48.allocations_per_task < 0.01,
+                "Posting an inline task should not allocate");
+    TEST_ASSERT(st_208.allocations_per_task < 0.05,
+                "Overflow blocks should be recycled across threads");
+    return true;
+}
+
+}  // namespace pacs::bridge::benchmark::tasks
+
+int main() {
+    using namespace pacs::bridge::benchmark::tasks;
+
+    std::cout << "=============================================" << std::endl;
+    std::cout << "PACS Bridge Task Allocation Benchmarks" << std::endl;
+    std::cout << "std::function vs small_task, standalone and pooled" << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    int passed = 0;
+    int failed = 0;
+
+    std::cout << "\n--- Task Allocations ---" << std::endl;
+    RUN_TEST(test_task_construction_allocations);
+    RUN_TEST(test_thread_pool_post_allocations);
+
+    // Summary
+    std::cout << "\n=============================================" << std::endl;
+    std::cout << "Results: " << passed << " passed, " << failed << " failed"
+              << std::endl;
+    std::cout << "=============================================" << std::endl;
+
+    return failed > 0 ? 1 : 0;
+}
@@ -305,6 +305,25 @@ else()
     set(PACS_BRIDGE_HAS_OPENSSL FALSE CACHE BOOL "OpenSSL is available" FORCE)
 endif()
 
+# =============================================================================
+# zlib (Optional, for gzip-compressed metrics responses)
+# =============================================================================
+
+option(BRIDGE_ENABLE_GZIP "Enable gzip compression of metrics responses" ON)
+
+if(BRIDGE_ENABLE_GZIP)
+    find_package(ZLIB QUIET)
+    if(ZLIB_FOUND)
+        message(STATUS "Found zlib: ${ZLIB_VERSION_STRING}")
+        set(PACS_BRIDGE_HAS_ZLIB TRUE CACHE BOOL "zlib is available" FORCE)
+    else()
+        message(STATUS "zlib not found. Metrics gzip compression disabled.")
+        set(PACS_BRIDGE_HAS_ZLIB FALSE CACHE BOOL "zlib is available" FORCE)
+    endif()
+else()
+    set(PACS_BRIDGE_HAS_ZLIB FALSE CACHE BOOL "zlib is available" FORCE)
+endif()
+
 # =============================================================================
 # Interface Library for All Dependencies
 # =============================================================================
@@ -402,6 +421,14 @@ if(PACS_BRIDGE_HAS_OPENSSL)
     )
 endif()
 
+# Add zlib if available
+if(PACS_BRIDGE_HAS_ZLIB)
+    target_link_libraries(pacs_bridge_dependencies INTERFACE ZLIB::ZLIB)
+    target_compile_definitions(pacs_bridge_dependencies INTERFACE
+        PACS_BRIDGE_HAS_ZLIB
+    )
+endif()
+
 # =============================================================================
 # Google Test (for unit testing)
 # =============================================================================
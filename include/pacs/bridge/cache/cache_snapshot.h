@@ -0,0 +1,180 @@
+#ifndef PACS_BRIDGE_CACHE_CACHE_SNAPSHOT_H
+#define PACS_BRIDGE_CACHE_CACHE_SNAPSHOT_H
+
+/**
+ * @file cache_snapshot.h
+ * @brief Versioned, checksummed snapshot files for warm cache restarts
+ *
+ * A snapshot holds one cache's entries as length-prefixed records whose
+ * fields the cache encodes with internal::field_writer. File layout:
+ * - 48-byte header: magic "PBCSNAP1", format version (u32), kind (u32),
+ *   written_at (i64 epoch microseconds), record count (u64), payload size
+ *   (u64), payload CRC-32 (u32), CRC-32 of the preceding header bytes (u32)
+ * - Payload: records, each a length (u32) followed by its fields
+ *
+ * snapshot_writer streams records to "<path>.tmp" and renames it over
+ * path on commit(), so a crash mid-write leaves the previous snapshot in
+ * place. snapshot_reader memory-maps the file and verifies the header and
+ * payload checksums before any record is decoded; records are decoded
+ * straight from the mapping.
+ *
+ * Time points inside records are wall-clock, so entry ages (and TTLs)
+ * carry across a restart.
+ *
+ * Snapshots are not encrypted: records hold patient demographics as
+ * plain fields. On POSIX the file is created with mode 0600; on Windows it
+ * inherits the ACL of its directory. Keep snapshot_path on a volume only
+ * the bridge's account can read.
+ */
+
+#include "pacs/bridge/cache/patient_cache.h"
+#include "pacs/bridge/internal/binary_fields.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <expected>
+#include <filesystem>
+#include <vector>
+
+namespace pacs::bridge::cache {
+
+/**
+ * @brief Which cache a snapshot belongs to
+ */
+enum class snapshot_kind : uint32_t {
+    patient_cache = 1,
+    patient_lookup = 2
+};
+
+// =============================================================================
+// Snapshot Writer
+// =============================================================================
+
+/**
+ * @brief Streams records into a snapshot file
+ *
+ * Not thread-safe. A writer destroyed without commit() removes its
+ * temporary file.
+ */
+class snapshot_writer {
+public:
+    /**
+     * @brief Start a snapshot of kind, to be committed to path
+     */
+    [[nodiscard]] static std::expected<snapshot_writer, cache_error> create(
+        const std::filesystem::path& path, snapshot_kind kind);
+
+    ~snapshot_writer();
+
+    snapshot_writer(const snapshot_writer&) = delete;
+    snapshot_writer& operator=(const snapshot_writer&) = delete;
+    snapshot_writer(snapshot_writer&& other) noexcept;
+    snapshot_writer& operator=(snapshot_writer&& other) noexcept;
+
+    /**
+     * @brief Append one record whose fields encode(field_writer&) writes
+     */
+    template <typename Encode>
+    void append(Encode&& encode) {
+        record_.clear();
+        internal::field_writer fields(record_);
+        encode(fields);
+        append_record();
+    }
+
+    /**
+     * @brief Flush and sync the file, then rename it over the target path
+     *
+     * @return Number of records written, or error
+     */
+    [[nodiscard]] std::expected<size_t, cache_error> commit();
+
+private:
+    snapshot_writer(std::FILE* file, std::filesystem::path path,
+                    snapshot_kind kind);
+
+    void append_record();
+    void flush();
+    void close();
+
+    std::FILE* file_ = nullptr;
+    std::filesystem::path path_;
+    std::filesystem::path temp_path_;
+    snapshot_kind kind_;
+    uint64_t record_count_ = 0;
+    uint64_t payload_size_ = 0;
+    uint32_t payload_crc_ = 0;
+    bool failed_ = false;
+    std::vector<uint8_t> buffer_;
+    std::vector<uint8_t> record_;
+};
+
+// =============================================================================
+// Snapshot Reader
+// =============================================================================
+
+/**
+ * @brief Verified, memory-mapped snapshot file
+ */
+class snapshot_reader {
+public:
+    /**
+     * @brief Map path and verify it is an intact snapshot of kind
+     *
+     * @return Reader, cache_error::snapshot_io_error if the file cannot be
+     *         read, or cache_error::serialization_error if it is corrupt,
+     *         of another kind or of an unsupported version
+     */
+    [[nodiscard]] static std::expected<snapshot_reader, cache_error> open(
+        const std::filesystem::path& path, snapshot_kind kind);
+
+    ~snapshot_reader();
+
+    snapshot_reader(const snapshot_reader&) = delete;
+    snapshot_reader& operator=(const snapshot_reader&) = delete;
+    snapshot_reader(snapshot_reader&& other) noexcept;
+    snapshot_reader& operator=(snapshot_reader&& other) noexcept;
+
+    /** When the snapshot was written */
+    [[nodiscard]] std::chrono::system_clock::time_point written_at() const noexcept {
+        return written_at_;
+    }
+
+    [[nodiscard]] uint64_t record_count() const noexcept { return record_count_; }
+
+    /**
+     * @brief Call decode(field_reader&) for each record, in write order
+     */
+    template <typename Decode>
+    void for_each(Decode&& decode) const {
+        internal::field_reader payload(payload_, payload_size_);
+        for (uint64_t i = 0; i < record_count_; ++i) {
+            uint32_t length = payload.u32();
+            auto bytes = payload.bytes(length);
+            if (!payload.ok()) {
+                return;
+            }
+            internal::field_reader record(
+                reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+            decode(record);
+        }
+    }
+
+private:
+    snapshot_reader() = default;
+
+    void release() noexcept;
+
+    void* mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+    std::vector<uint8_t> contents_;  // used where mmap is unavailable
+    const uint8_t* payload_ = nullptr;
+    size_t payload_size_ = 0;
+    uint64_t record_count_ = 0;
+    std::chrono::system_clock::time_point written_at_;
+};
+
+}  // namespace pacs::bridge::cache
+
+#endif  // PACS_BRIDGE_CACHE_CACHE_SNAPSHOT_H
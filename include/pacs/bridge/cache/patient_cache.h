@@ -8,8 +8,11 @@
  * Provides an in-memory cache for patient demographic data to reduce
  * repeated lookups to source systems. Features include:
  *   - Time-based expiration (TTL)
- *   - LRU eviction when capacity is reached
- *   - Thread-safe operations
+ *   - Sampled LRU eviction when capacity is reached
+ *   - Lock-striped shards; hits take only a shard's shared lock
+ *   - Shared, immutable patient records (no copy on hit)
+ *   - Coalesced loads and refresh-ahead in get_or_load()
+ *   - Snapshot files for warm restarts
  *   - Cache statistics
  *
  * @see https://github.com/kcenon/pacs_bridge/issues/18
@@ -19,6 +22,7 @@
 
 #include <chrono>
 #include <expected>
+#include <filesystem>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -54,7 +58,10 @@ enum class cache_error : int {
     serialization_error = -924,
 
     /** Cache is disabled */
-    cache_disabled = -925
+    cache_disabled = -925,
+
+    /** Snapshot file could not be opened, written or renamed */
+    snapshot_io_error = -926
 };
 
 /**
@@ -81,6 +88,8 @@ enum class cache_error : int {
             return "Cache serialization error";
         case cache_error::cache_disabled:
             return "Cache is disabled";
+        case cache_error::snapshot_io_error:
+            return "Cache snapshot file I/O failed";
         default:
             return "Unknown cache error";
     }
@@ -112,6 +121,33 @@ struct patient_cache_config {
     /** Use LRU eviction when capacity is reached */
     bool lru_eviction = true;
 
+    /**
+     * Number of lock shards, rounded down to a power of two (0 = automatic)
+     *
+     * Automatic sizing gives each shard at least 64 entries, up to 16
+     * shards, so small caches keep a single shard and exact LRU order.
+     */
+    size_t shard_count = 0;
+
+    /**
+     * Fraction of an entry's TTL after which a get_or_load() hit reloads it
+     * in the background, still returning the cached value (0 = disabled)
+     */
+    double refresh_ahead = 0.0;
+
+    /**
+     * Snapshot file for warm restarts (empty = disabled)
+     *
+     * When set, the cache restores this file on a background thread after
+     * construction, so startup does not wait on it, and rewrites it every
+     * snapshot_interval. The file holds PHI unencrypted (owner-only mode
+     * on POSIX).
+     */
+    std::filesystem::path snapshot_path;
+
+    /** Interval between background snapshot writes (0 = restore only) */
+    std::chrono::seconds snapshot_interval{300};
+
     /** Enable cache statistics */
     bool enable_statistics = true;
 };
@@ -165,6 +201,20 @@ struct cache_entry_metadata {
  * Caches patient demographic data for quick lookup without querying
  * source systems repeatedly. Supports multiple lookup keys per patient.
  *
+ * Entries and aliases are spread over shards by hash of their key, each
+ * shard with its own shared_mutex and an equal part of max_entries. A hit
+ * takes the shard's shared lock and records its recency with relaxed
+ * atomics, so readers on different threads never serialize on a write
+ * lock. When a shard is full, put() evicts the least recently used of up
+ * to 8 sampled entries (exact LRU for shards that small).
+ *
+ * Patients are stored as shared_ptr<const dicom_patient>; get_shared()
+ * and peek_shared() hand out the stored record without copying it.
+ *
+ * Entries and aliases can be saved to a snapshot file (see
+ * cache_snapshot.h) and restored after a restart or failover, keeping
+ * each entry's wall-clock creation time so its remaining TTL carries over.
+ *
  * @example Basic Usage
  * ```cpp
  * patient_cache cache;
@@ -236,6 +286,17 @@ public:
     void put(std::string_view key, const mapping::dicom_patient& patient,
              std::optional<std::chrono::seconds> ttl = std::nullopt);
 
+    /**
+     * @brief Add or update patient in cache, sharing the given record
+     *
+     * @param key Primary lookup key (usually patient ID)
+     * @param patient Patient data (must not be null)
+     * @param ttl Custom TTL (optional, uses default if not specified)
+     */
+    void put(std::string_view key,
+             std::shared_ptr<const mapping::dicom_patient> patient,
+             std::optional<std::chrono::seconds> ttl = std::nullopt);
+
     /**
      * @brief Get patient from cache
      *
@@ -254,6 +315,29 @@ public:
     [[nodiscard]] std::expected<mapping::dicom_patient, cache_error> peek(
         std::string_view key) const;
 
+    /**
+     * @brief Get the stored patient record without copying it
+     *
+     * Same lookup, statistics and access tracking as get().
+     *
+     * @param key Lookup key
+     * @return Shared patient record or error
+     */
+    [[nodiscard]] std::expected<std::shared_ptr<const mapping::dicom_patient>,
+                                cache_error>
+    get_shared(std::string_view key) const;
+
+    /**
+     * @brief Get the stored patient record without copying it or updating
+     *        access time
+     *
+     * @param key Lookup key
+     * @return Shared patient record or error
+     */
+    [[nodiscard]] std::expected<std::shared_ptr<const mapping::dicom_patient>,
+                                cache_error>
+    peek_shared(std::string_view key) const;
+
     /**
      * @brief Check if key exists in cache
      *
@@ -291,7 +375,11 @@ public:
      * @brief Get or load patient
      *
      * If patient is not in cache, calls loader function to fetch it
-     * and adds it to cache.
+     * and adds it to cache. Concurrent misses on the same key share one
+     * loader call. A hit on an entry past config().refresh_ahead of its
+     * TTL returns the cached patient and reloads it on the cache's
+     * background thread, so the loader may be called after this returns
+     * and must stay valid until then.
      *
      * @param key Lookup key
      * @param loader Function to load patient if not cached
@@ -369,6 +457,35 @@ public:
      */
     [[nodiscard]] std::vector<std::string> keys() const;
 
+    // =========================================================================
+    // Snapshots
+    // =========================================================================
+
+    /**
+     * @brief Write unexpired entries and all aliases to a snapshot file
+     *
+     * Holds each shard's shared lock only while copying its entries. The
+     * file is replaced atomically.
+     *
+     * @param path Snapshot file
+     * @return Number of records written, or error
+     */
+    std::expected<size_t, cache_error> save_snapshot(
+        const std::filesystem::path& path) const;
+
+    /**
+     * @brief Restore entries and aliases from a snapshot file
+     *
+     * Entries that expired since the snapshot was written are skipped, as
+     * are keys already cached (they are at least as fresh) and entries
+     * that would need an eviction to fit.
+     *
+     * @param path Snapshot file
+     * @return Number of entries restored, or error
+     */
+    std::expected<size_t, cache_error> load_snapshot(
+        const std::filesystem::path& path);
+
     // =========================================================================
     // Statistics
     // =========================================================================
@@ -404,6 +521,18 @@ public:
         /** Maximum entries ever stored */
         size_t max_size_reached = 0;
 
+        /** Loader calls made by get_or_load(), including refreshes */
+        size_t load_count = 0;
+
+        /** get_or_load() misses that waited on another caller's load */
+        size_t coalesced_count = 0;
+
+        /** Background refresh-ahead reloads */
+        size_t refresh_count = 0;
+
+        /** Entries restored from snapshot files */
+        size_t restored_count = 0;
+
         /**
          * @brief Calculate hit rate
          */
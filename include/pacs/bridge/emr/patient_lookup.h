@@ -18,6 +18,7 @@
 #include "patient_record.h"
 
 #include <chrono>
+#include <filesystem>
 #include <memory>
 #include <optional>
 #include <string>
@@ -140,6 +141,25 @@ struct patient_lookup_config {
     /** Maximum cache entries */
     size_t max_cache_entries{10000};
 
+    /**
+     * Fraction of cache_ttl after which a cache hit re-queries the EMR in
+     * the background, still returning the cached record (0 = disabled)
+     */
+    double refresh_ahead{0.0};
+
+    /**
+     * Snapshot file for warm restarts (empty = disabled)
+     *
+     * When set, cached records and not-found results are restored from
+     * this file on a background thread after construction and the file is
+     * rewritten every snapshot_interval. The file holds PHI unencrypted
+     * (owner-only mode on POSIX).
+     */
+    std::filesystem::path snapshot_path;
+
+    /** Interval between background snapshot writes (0 = restore only) */
+    std::chrono::seconds snapshot_interval{300};
+
     /** Enable automatic disambiguation for multiple matches */
     bool auto_disambiguate{true};
 
@@ -164,6 +184,16 @@ struct patient_lookup_config {
  * via FHIR API. Supports caching, automatic retry, and disambiguation
  * of multiple matches.
  *
+ * Concurrent MRN and identifier lookups that miss the cache for the same
+ * patient share one EMR query. Cached records past refresh_ahead of their
+ * TTL are re-queried on a background thread while hits keep returning
+ * them.
+ *
+ * The cache can be saved to and restored from a snapshot file, so a
+ * restarted or failed-over node starts warm instead of re-querying the
+ * EMR for every patient. Cache times are wall-clock; restored entries
+ * expire when they would have without the restart.
+ *
  * Thread-safe: All operations are thread-safe for concurrent use.
  *
  * @example Basic Usage
@@ -329,6 +359,29 @@ public:
      */
     size_t prefetch(const std::vector<std::string>& mrns);
 
+    /**
+     * @brief Write cached records and not-found results to a snapshot file
+     *
+     * Expired entries are left out. The file is replaced atomically.
+     *
+     * @param path Snapshot file
+     * @return Number of entries written or error
+     */
+    [[nodiscard]] auto save_snapshot(const std::filesystem::path& path) const
+        -> Result<size_t>;
+
+    /**
+     * @brief Restore cached records and not-found results from a snapshot
+     *
+     * Skips entries that expired since the snapshot was written, keys
+     * already cached, and records beyond max_cache_entries.
+     *
+     * @param path Snapshot file
+     * @return Number of entries restored or error
+     */
+    [[nodiscard]] auto load_snapshot(const std::filesystem::path& path)
+        -> Result<size_t>;
+
     /**
      * @brief Get cache statistics
      */
@@ -378,6 +431,9 @@ public:
         size_t multiple_matches{0};
         size_t cache_hits{0};
         size_t cache_misses{0};
+        size_t coalesced_queries{0};
+        size_t background_refreshes{0};
+        size_t restored_entries{0};
         std::chrono::milliseconds total_query_time{0};
     };
 
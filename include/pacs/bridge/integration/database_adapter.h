@@ -116,6 +116,9 @@ struct database_config {
 
     /** Busy timeout in milliseconds (SQLite) */
     int busy_timeout_ms = 5000;
+
+    /** Compiled statements kept per connection for reuse (SQLite, 0 = none) */
+    std::size_t statement_cache_size = 64;
 };
 
 // =============================================================================
@@ -342,12 +345,35 @@ public:
 
     /**
      * @brief Prepare a SQL statement
+     *
+     * SQLite connections keep an LRU cache of compiled statements keyed by
+     * SQL text. Preparing SQL that is cached reuses the compiled statement;
+     * destroying the returned statement resets it, clears its bindings and
+     * returns it to the cache.
+     *
      * @param sql SQL statement with parameter placeholders (?)
      * @return Prepared statement or error
      */
     [[nodiscard]] virtual std::expected<std::unique_ptr<database_statement>, database_error>
     prepare(std::string_view sql) = 0;
 
+    /**
+     * @brief Prepare a SQL statement, reusing one cached on this connection
+     *
+     * The statement is owned by the connection and returned reset with
+     * bindings cleared. The connection keeps the most recently used
+     * statements (database_config::statement_cache_size, at least one); a
+     * statement stays valid until later prepare_cached() calls evict it or
+     * the connection is closed.
+     * Step its result to completion before releasing the connection, so no
+     * read transaction is left open.
+     *
+     * @param sql SQL statement with parameter placeholders (?)
+     * @return Cached statement or error
+     */
+    [[nodiscard]] virtual std::expected<database_statement*, database_error>
+    prepare_cached(std::string_view sql) = 0;
+
     /**
      * @brief Execute a SQL statement directly
      * @param sql SQL statement to execute
@@ -15,6 +15,8 @@
  * @see docs/SDS_COMPONENTS.md - Section 8: Integration Module
  */
 
+#include "pacs/bridge/performance/small_task.h"
+
 #include <kcenon/common/interfaces/executor_interface.h>
 #include <kcenon/common/patterns/result.h>
 
@@ -266,7 +268,7 @@ private:
 
     struct delayed_task {
         std::chrono::steady_clock::time_point execute_at;
-        std::function<void()> task;
+        performance::small_task<> task;
 
         bool operator>(const delayed_task& other) const {
             return execute_at > other.execute_at;
@@ -286,6 +288,8 @@ private:
  *
  * A self-contained executor that manages its own worker threads.
  * Suitable for components that don't need to share a thread pool.
+ * Each job is queued together with its promise in one small_task, so
+ * execute() allocates nothing beyond the future's shared state.
  */
 class simple_executor : public kcenon::common::interfaces::IExecutor {
 public:
@@ -335,7 +339,7 @@ private:
 
     struct delayed_task {
         std::chrono::steady_clock::time_point execute_at;
-        std::function<void()> task;
+        performance::small_task<> task;
 
         bool operator>(const delayed_task& other) const {
             return execute_at > other.execute_at;
@@ -346,7 +350,7 @@ private:
     std::vector<std::thread> workers_;
     std::thread delay_thread_;
 
-    std::queue<std::function<void()>> task_queue_;
+    std::queue<performance::small_task<>> task_queue_;
     std::mutex queue_mutex_;
     std::condition_variable queue_cv_;
 
@@ -15,6 +15,7 @@
 #include <functional>
 #include <future>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 
@@ -68,12 +69,24 @@ public:
      * @brief Submit a task for execution
      * @param task Task function to execute
      * @param priority Task priority
-     * @return Future for task result
+     * @return Future for task result; holds std::runtime_error if the pool
+     *         is not running and the task was not queued
      */
     template <typename F>
     [[nodiscard]] auto submit(F&& task, task_priority priority = task_priority::normal)
         -> std::future<decltype(task())>;
 
+    /**
+     * @brief Queue a fire-and-forget task
+     * @param task Task function to execute
+     * @param priority Task priority
+     * @return false if the pool is not running; task is then not run
+     */
+    [[nodiscard]] bool try_submit(std::function<void()> task,
+                                  task_priority priority = task_priority::normal) {
+        return submit_internal(std::move(task), priority);
+    }
+
     /**
      * @brief Get current queue size
      */
@@ -92,8 +105,9 @@ public:
 protected:
     /**
      * @brief Internal task submission
+     * @return false if the task was rejected because the pool is not running
      */
-    virtual void submit_internal(std::function<void()> task,
+    virtual bool submit_internal(std::function<void()> task,
                                   task_priority priority) = 0;
 };
 
@@ -115,7 +129,7 @@ auto thread_adapter::submit(F&& task, task_priority priority)
     auto promise = std::make_shared<std::promise<result_type>>();
     auto future = promise->get_future();
 
-    submit_internal(
+    bool queued = submit_internal(
         [promise, task = std::forward<F>(task)]() mutable {
             try {
                 if constexpr (std::is_void_v<result_type>) {
@@ -129,6 +143,10 @@ auto thread_adapter::submit(F&& task, task_priority priority)
             }
         },
         priority);
+    if (!queued) {
+        promise->set_exception(
+            std::make_exception_ptr(std::runtime_error("Thread pool is not running")));
+    }
 
     return future;
 }
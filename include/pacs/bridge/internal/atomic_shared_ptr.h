@@ -0,0 +1,58 @@
+/**
+ * @file atomic_shared_ptr.h
+ * @brief Atomically published shared_ptr for read-mostly snapshots
+ *
+ * Configuration that is rebuilt rarely and read on every message (routing
+ * tables, subscription lists) is published as an immutable snapshot behind
+ * a shared_ptr. Uses std::atomic<std::shared_ptr> where the standard
+ * library provides it, which keeps the lock inside the object instead of
+ * the global mutex pool behind the deprecated free functions. libc++ does
+ * not provide it yet, so it keeps the free functions.
+ */
+
+#ifndef PACS_BRIDGE_INTERNAL_ATOMIC_SHARED_PTR_H
+#define PACS_BRIDGE_INTERNAL_ATOMIC_SHARED_PTR_H
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace pacs::bridge::internal {
+
+template <typename T>
+class atomic_shared_ptr {
+public:
+    atomic_shared_ptr() = default;
+
+    atomic_shared_ptr(const atomic_shared_ptr&) = delete;
+    atomic_shared_ptr& operator=(const atomic_shared_ptr&) = delete;
+
+    [[nodiscard]] std::shared_ptr<T> load(
+        std::memory_order order = std::memory_order_acquire) const noexcept {
+#ifdef __cpp_lib_atomic_shared_ptr
+        return ptr_.load(order);
+#else
+        return std::atomic_load_explicit(&ptr_, order);
+#endif
+    }
+
+    void store(std::shared_ptr<T> value,
+               std::memory_order order = std::memory_order_release) noexcept {
+#ifdef __cpp_lib_atomic_shared_ptr
+        ptr_.store(std::move(value), order);
+#else
+        std::atomic_store_explicit(&ptr_, std::move(value), order);
+#endif
+    }
+
+private:
+#ifdef __cpp_lib_atomic_shared_ptr
+    std::atomic<std::shared_ptr<T>> ptr_;
+#else
+    std::shared_ptr<T> ptr_;
+#endif
+};
+
+}  // namespace pacs::bridge::internal
+
+#endif  // PACS_BRIDGE_INTERNAL_ATOMIC_SHARED_PTR_H
@@ -0,0 +1,134 @@
+/**
+ * @file background_worker.h
+ * @brief Single lazily started thread running posted tasks in order
+ *
+ * Used for cache refresh-ahead, where reloads must not run on the caller's
+ * thread but are too few to warrant a pool, and for periodic cache
+ * snapshots (post_after()). The thread starts with the first post.
+ * Immediate tasks run before delayed ones that have come due. Stopping
+ * discards tasks that have not started and joins the thread after the
+ * running one returns.
+ */
+
+#ifndef PACS_BRIDGE_INTERNAL_BACKGROUND_WORKER_H
+#define PACS_BRIDGE_INTERNAL_BACKGROUND_WORKER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace pacs::bridge::internal {
+
+class background_worker {
+public:
+    background_worker() = default;
+    ~background_worker() { stop(); }
+
+    background_worker(const background_worker&) = delete;
+    background_worker& operator=(const background_worker&) = delete;
+
+    /**
+     * @brief Queue task to run on the worker thread
+     *
+     * @return false if the worker has been stopped
+     */
+    bool post(std::function<void()> task) {
+        {
+            std::lock_guard lock(mutex_);
+            if (!start()) {
+                return false;
+            }
+            queue_.push_back(std::move(task));
+        }
+        cv_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Queue task to run on the worker thread once delay has passed
+     *
+     * @return false if the worker has been stopped
+     */
+    bool post_after(std::chrono::steady_clock::duration delay,
+                    std::function<void()> task) {
+        {
+            std::lock_guard lock(mutex_);
+            if (!start()) {
+                return false;
+            }
+            timed_.emplace(std::chrono::steady_clock::now() + delay,
+                           std::move(task));
+        }
+        cv_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Discard queued tasks and join the thread
+     */
+    void stop() {
+        {
+            std::lock_guard lock(mutex_);
+            stopping_ = true;
+            queue_.clear();
+            timed_.clear();
+        }
+        cv_.notify_one();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+private:
+    /** Start the thread if needed (caller holds the mutex) */
+    bool start() {
+        if (stopping_) {
+            return false;
+        }
+        if (!thread_.joinable()) {
+            thread_ = std::thread([this] { run(); });
+        }
+        return true;
+    }
+
+    void run() {
+        std::unique_lock lock(mutex_);
+        while (!stopping_) {
+            std::function<void()> task;
+            if (!queue_.empty()) {
+                task = std::move(queue_.front());
+                queue_.pop_front();
+            } else if (!timed_.empty() &&
+                       timed_.begin()->first <= std::chrono::steady_clock::now()) {
+                task = std::move(timed_.begin()->second);
+                timed_.erase(timed_.begin());
+            } else if (!timed_.empty()) {
+                cv_.wait_until(lock, timed_.begin()->first);
+                continue;
+            } else {
+                cv_.wait(lock);
+                continue;
+            }
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> queue_;
+    std::multimap<std::chrono::steady_clock::time_point, std::function<void()>>
+        timed_;
+    std::thread thread_;
+    bool stopping_ = false;
+};
+
+}  // namespace pacs::bridge::internal
+
+#endif  // PACS_BRIDGE_INTERNAL_BACKGROUND_WORKER_H
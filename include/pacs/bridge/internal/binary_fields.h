@@ -0,0 +1,157 @@
+/**
+ * @file binary_fields.h
+ * @brief Little-endian field codec and CRC-32 for on-disk records
+ *
+ * Shared by the queue segment log and the cache snapshots. Strings are
+ * length-prefixed (u32), time points are epoch microseconds (i64) so they
+ * stay meaningful across restarts, and the reader is bounds-checked so a
+ * truncated or corrupt record decodes to zero values with ok() false
+ * instead of reading past its buffer.
+ */
+
+#ifndef PACS_BRIDGE_INTERNAL_BINARY_FIELDS_H
+#define PACS_BRIDGE_INTERNAL_BINARY_FIELDS_H
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pacs::bridge::internal {
+
+/**
+ * @brief CRC-32 (IEEE 802.3, reflected)
+ */
+inline uint32_t crc32(const uint8_t* data, size_t size, uint32_t crc = 0) noexcept {
+    static const auto table = [] {
+        std::array<uint32_t, 256> t{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            t[i] = c;
+        }
+        return t;
+    }();
+
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+inline int64_t to_micros(std::chrono::system_clock::time_point tp) noexcept {
+    return std::chrono::duration_cast<std::chrono::microseconds>(tp.time_since_epoch())
+        .count();
+}
+
+inline std::chrono::system_clock::time_point from_micros(int64_t micros) noexcept {
+    return std::chrono::system_clock::time_point{
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::microseconds{micros})};
+}
+
+/**
+ * @brief Little-endian field encoder
+ */
+class field_writer {
+public:
+    explicit field_writer(std::vector<uint8_t>& out) : out_(out) {}
+
+    void u8(uint8_t v) { out_.push_back(v); }
+
+    void u32(uint32_t v) {
+        for (int i = 0; i < 4; ++i) out_.push_back(static_cast<uint8_t>(v >> (8 * i)));
+    }
+
+    void u64(uint64_t v) {
+        for (int i = 0; i < 8; ++i) out_.push_back(static_cast<uint8_t>(v >> (8 * i)));
+    }
+
+    void i32(int32_t v) { u32(static_cast<uint32_t>(v)); }
+    void i64(int64_t v) { u64(static_cast<uint64_t>(v)); }
+    void f64(double v) { u64(std::bit_cast<uint64_t>(v)); }
+    void time(std::chrono::system_clock::time_point tp) { i64(to_micros(tp)); }
+
+    void str(std::string_view s) {
+        u32(static_cast<uint32_t>(s.size()));
+        out_.insert(out_.end(), s.begin(), s.end());
+    }
+
+private:
+    std::vector<uint8_t>& out_;
+};
+
+/**
+ * @brief Bounds-checked little-endian field decoder
+ *
+ * Reads past the end set ok() to false and yield zero values.
+ */
+class field_reader {
+public:
+    field_reader(const uint8_t* data, size_t size) : p_(data), end_(data + size) {}
+
+    [[nodiscard]] bool ok() const noexcept { return ok_; }
+
+    /** Bytes not yet read */
+    [[nodiscard]] size_t remaining() const noexcept {
+        return static_cast<size_t>(end_ - p_);
+    }
+
+    uint8_t u8() { return take(1) ? p_[-1] : 0; }
+
+    uint32_t u32() {
+        if (!take(4)) return 0;
+        uint32_t v = 0;
+        for (int i = 0; i < 4; ++i) v |= static_cast<uint32_t>(p_[i - 4]) << (8 * i);
+        return v;
+    }
+
+    uint64_t u64() {
+        if (!take(8)) return 0;
+        uint64_t v = 0;
+        for (int i = 0; i < 8; ++i) v |= static_cast<uint64_t>(p_[i - 8]) << (8 * i);
+        return v;
+    }
+
+    int32_t i32() { return static_cast<int32_t>(u32()); }
+    int64_t i64() { return static_cast<int64_t>(u64()); }
+    double f64() { return std::bit_cast<double>(u64()); }
+    std::chrono::system_clock::time_point time() { return from_micros(i64()); }
+
+    std::string str() {
+        uint32_t size = u32();
+        if (!take(size)) return {};
+        return std::string(reinterpret_cast<const char*>(p_ - size), size);
+    }
+
+    /** Next size bytes without copying (empty and not ok() if short) */
+    std::string_view bytes(size_t size) {
+        if (!take(size)) return {};
+        return std::string_view(reinterpret_cast<const char*>(p_ - size), size);
+    }
+
+private:
+    bool take(size_t n) {
+        if (!ok_ || static_cast<size_t>(end_ - p_) < n) {
+            ok_ = false;
+            return false;
+        }
+        p_ += n;
+        return true;
+    }
+
+    const uint8_t* p_;
+    const uint8_t* end_;
+    bool ok_ = true;
+};
+
+}  // namespace pacs::bridge::internal
+
+#endif  // PACS_BRIDGE_INTERNAL_BINARY_FIELDS_H
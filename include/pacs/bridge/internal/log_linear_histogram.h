@@ -0,0 +1,143 @@
+/**
+ * @file log_linear_histogram.h
+ * @brief Fixed-bucket log-linear histogram with per-thread shards
+ *
+ * Values are counted in buckets whose width doubles every power of two,
+ * with 2^sub_bucket_bits linear sub-buckets per power (HDR histogram
+ * layout). Every value below 2^max_exponent lands in a bucket whose width
+ * is at most 1/8 of its lower bound; larger values are counted in the last
+ * bucket.
+ *
+ * record() is two relaxed increments on the calling thread's shard: no
+ * lock, no allocation, no shared cache line. collect() merges the shards
+ * into a snapshot at scrape time.
+ */
+
+#ifndef PACS_BRIDGE_INTERNAL_LOG_LINEAR_HISTOGRAM_H
+#define PACS_BRIDGE_INTERNAL_LOG_LINEAR_HISTOGRAM_H
+
+#include "pacs/bridge/internal/sharded_counter.h"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace pacs::bridge::internal {
+
+class log_linear_histogram {
+public:
+    static constexpr unsigned sub_bucket_bits = 3;
+    static constexpr uint64_t sub_bucket_count = uint64_t{1} << sub_bucket_bits;
+    static constexpr unsigned max_exponent = 40;
+    static constexpr size_t bucket_count =
+        (max_exponent - sub_bucket_bits + 1) * sub_bucket_count;
+    static constexpr size_t shard_count = 8;
+
+    /**
+     * @brief Merged bucket counts at one point in time
+     */
+    struct snapshot {
+        std::array<uint64_t, bucket_count> counts{};
+        uint64_t count = 0;
+        uint64_t sum = 0;
+
+        /** Number of recorded values in buckets entirely at or below limit */
+        [[nodiscard]] uint64_t count_at_or_below(uint64_t limit) const noexcept {
+            uint64_t total = 0;
+            for (size_t i = 0; i < bucket_count && upper_bound(i) <= limit; ++i) {
+                total += counts[i];
+            }
+            return total;
+        }
+
+        /** Upper bound of the bucket holding the q-quantile (0 <= q <= 1) */
+        [[nodiscard]] uint64_t quantile(double q) const noexcept {
+            if (count == 0) return 0;
+            auto rank = static_cast<uint64_t>(q * static_cast<double>(count));
+            if (rank >= count) rank = count - 1;
+            uint64_t seen = 0;
+            for (size_t i = 0; i < bucket_count; ++i) {
+                seen += counts[i];
+                if (seen > rank) return upper_bound(i);
+            }
+            return upper_bound(bucket_count - 1);
+        }
+    };
+
+    /** Bucket holding value */
+    [[nodiscard]] static constexpr size_t bucket_index(uint64_t value) noexcept {
+        if (value < sub_bucket_count) {
+            return static_cast<size_t>(value);
+        }
+        auto exponent = static_cast<unsigned>(std::bit_width(value) - 1);
+        if (exponent >= max_exponent) {
+            return bucket_count - 1;
+        }
+        unsigned shift = exponent - sub_bucket_bits;
+        return static_cast<size_t>((shift + 1) * sub_bucket_count +
+                                   ((value >> shift) - sub_bucket_count));
+    }
+
+    /** Largest value counted in bucket index */
+    [[nodiscard]] static constexpr uint64_t upper_bound(size_t index) noexcept {
+        if (index < sub_bucket_count) {
+            return index;
+        }
+        if (index == bucket_count - 1) {
+            return UINT64_MAX;
+        }
+        uint64_t shift = index / sub_bucket_count - 1;
+        uint64_t sub = index % sub_bucket_count + sub_bucket_count;
+        return ((sub + 1) << shift) - 1;
+    }
+
+    void record(uint64_t value) noexcept {
+        auto& shard = shards_[thread_shard_index<shard_count>()];
+        shard.buckets[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        shard.sum.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Merge all shards
+     *
+     * Not atomic across shards: values recorded during collect() may be
+     * counted in the buckets but not yet the sum, or the reverse.
+     */
+    [[nodiscard]] snapshot collect() const noexcept {
+        snapshot result;
+        for (const auto& shard : shards_) {
+            for (size_t i = 0; i < bucket_count; ++i) {
+                result.counts[i] +=
+                    shard.buckets[i].load(std::memory_order_relaxed);
+            }
+            result.sum += shard.sum.load(std::memory_order_relaxed);
+        }
+        for (auto c : result.counts) {
+            result.count += c;
+        }
+        return result;
+    }
+
+    void reset() noexcept {
+        for (auto& shard : shards_) {
+            for (auto& bucket : shard.buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            shard.sum.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct alignas(64) shard {
+        std::array<std::atomic<uint64_t>, bucket_count> buckets{};
+        std::atomic<uint64_t> sum{0};
+    };
+
+    std::array<shard, shard_count> shards_{};
+};
+
+}  // namespace pacs::bridge::internal
+
+#endif  // PACS_BRIDGE_INTERNAL_LOG_LINEAR_HISTOGRAM_H
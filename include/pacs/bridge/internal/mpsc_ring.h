@@ -0,0 +1,112 @@
+/**
+ * @file mpsc_ring.h
+ * @brief Bounded lock-free multi-producer, single-consumer ring
+ *
+ * Each cell carries a sequence number (Vyukov's bounded queue): producers
+ * claim a position with one CAS on the tail, move their value in and
+ * publish it by advancing the cell's sequence; the single consumer reads
+ * cells in order without any read-modify-write. A full ring makes
+ * try_push() fail rather than block, so the caller chooses between
+ * waiting and dropping.
+ */
+
+#ifndef PACS_BRIDGE_INTERNAL_MPSC_RING_H
+#define PACS_BRIDGE_INTERNAL_MPSC_RING_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace pacs::bridge::internal {
+
+template <typename T>
+class mpsc_ring {
+public:
+    /** capacity is rounded up to a power of two (at least 2) */
+    explicit mpsc_ring(size_t capacity)
+        : mask_(std::bit_ceil(capacity < 2 ? size_t{2} : capacity) - 1),
+          cells_(std::make_unique<cell[]>(mask_ + 1)) {
+        for (size_t i = 0; i <= mask_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    mpsc_ring(const mpsc_ring&) = delete;
+    mpsc_ring& operator=(const mpsc_ring&) = delete;
+
+    /**
+     * @brief Enqueue value from any thread
+     *
+     * @return false if the ring is full; value is then left untouched
+     */
+    bool try_push(T&& value) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell& c = cells_[pos & mask_];
+            size_t seq = c.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1,
+                                                std::memory_order_relaxed)) {
+                    c.value = std::move(value);
+                    c.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Dequeue the oldest published value (consumer thread only)
+     */
+    bool try_pop(T& out) {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        cell& c = cells_[pos & mask_];
+        if (c.sequence.load(std::memory_order_acquire) != pos + 1) {
+            return false;
+        }
+        out = std::move(c.value);
+        c.sequence.store(pos + mask_ + 1, std::memory_order_release);
+        head_.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Values pushed so far (including ones still being published) */
+    [[nodiscard]] size_t pushed() const noexcept {
+        return tail_.load(std::memory_order_acquire);
+    }
+
+    /** Values popped so far */
+    [[nodiscard]] size_t popped() const noexcept {
+        return head_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        size_t head = popped();
+        size_t tail = pushed();
+        return tail > head ? tail - head : 0;
+    }
+
+    [[nodiscard]] size_t capacity() const noexcept { return mask_ + 1; }
+
+private:
+    struct cell {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    size_t mask_;
+    std::unique_ptr<cell[]> cells_;
+    alignas(64) std::atomic<size_t> tail_{0};
+    alignas(64) std::atomic<size_t> head_{0};
+};
+
+}  // namespace pacs::bridge::internal
+
+#endif  // PACS_BRIDGE_INTERNAL_MPSC_RING_H
@@ -0,0 +1,73 @@
+/**
+ * @file sharded_counter.h
+ * @brief Statistics counter spread over cache-line-sized shards
+ *
+ * Hot-path statistics (routing, message bus delivery) are incremented by
+ * many threads at once. Each thread increments its own shard, so those
+ * threads do not contend on one cache line; readers sum the shards.
+ */
+
+#ifndef PACS_BRIDGE_INTERNAL_SHARDED_COUNTER_H
+#define PACS_BRIDGE_INTERNAL_SHARDED_COUNTER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace pacs::bridge::internal {
+
+/**
+ * @brief Index of the calling thread's shard, stable for the thread's lifetime
+ *
+ * @tparam ShardCount Number of shards the index is reduced to
+ */
+template <size_t ShardCount>
+[[nodiscard]] inline size_t thread_shard_index() noexcept {
+    static std::atomic<size_t> next_index{0};
+    thread_local const size_t index =
+        next_index.fetch_add(1, std::memory_order_relaxed) % ShardCount;
+    return index;
+}
+
+/**
+ * @brief Relaxed counter with one cache line per shard
+ *
+ * load() is not a snapshot: increments racing with it may or may not be
+ * included.
+ */
+class sharded_counter {
+public:
+    static constexpr size_t shard_count = 16;
+
+    void increment() noexcept { add(1); }
+
+    void add(size_t n) noexcept {
+        shards_[thread_shard_index<shard_count>()].value.fetch_add(
+            n, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] size_t load() const noexcept {
+        size_t total = 0;
+        for (const auto& shard : shards_) {
+            total += shard.value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    void reset() noexcept {
+        for (auto& shard : shards_) {
+            shard.value.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct alignas(64) shard {
+        std::atomic<size_t> value{0};
+    };
+
+    std::array<shard, shard_count> shards_{};
+};
+
+}  // namespace pacs::bridge::internal
+
+#endif  // PACS_BRIDGE_INTERNAL_SHARDED_COUNTER_H
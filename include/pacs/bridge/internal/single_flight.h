@@ -0,0 +1,120 @@
+/**
+ * @file single_flight.h
+ * @brief Per-key call coalescing for cache loaders
+ *
+ * When many threads miss the same cache key at once, only the first runs
+ * the loader; the others wait for and share its result instead of all
+ * querying the source system (thundering herd). A call may also be begun
+ * on one thread and finished on another, which is how refresh-ahead
+ * reloads run in the background while callers that miss the same key
+ * join them.
+ *
+ * A caller that finds no call in flight should re-check its cache inside
+ * load(): a call that finished a moment earlier has already stored its
+ * result there.
+ */
+
+#ifndef PACS_BRIDGE_INTERNAL_SINGLE_FLIGHT_H
+#define PACS_BRIDGE_INTERNAL_SINGLE_FLIGHT_H
+
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace pacs::bridge::internal {
+
+template <typename Value>
+class single_flight {
+public:
+    /**
+     * @brief Run load() for key, or wait for the call already in flight
+     *
+     * Exceptions thrown by load() reach the caller and every waiter.
+     *
+     * @param coalesced Set to true if this caller waited on another's call
+     */
+    template <typename Load>
+    Value run(std::string_view key, Load&& load, bool* coalesced = nullptr) {
+        auto promise = std::make_shared<std::promise<Value>>();
+        auto [future, leader] = join(key, promise);
+        if (coalesced != nullptr) {
+            *coalesced = !leader;
+        }
+        if (leader) {
+            finish(key, *promise, std::forward<Load>(load));
+        }
+        return future.get();
+    }
+
+    /**
+     * @brief Begin a call for key to be finished elsewhere
+     *
+     * @return Task that runs load() and completes the call, or an empty
+     *         function if a call for key is already in flight
+     */
+    template <typename Load>
+    std::function<void()> begin(std::string_view key, Load load) {
+        auto promise = std::make_shared<std::promise<Value>>();
+        if (!join(key, promise).second) {
+            return {};
+        }
+        return [this, key = std::string(key), promise,
+                load = std::move(load)]() mutable {
+            finish(key, *promise, load);
+        };
+    }
+
+    [[nodiscard]] bool in_flight(std::string_view key) const {
+        std::lock_guard lock(mutex_);
+        return calls_.find(key) != calls_.end();
+    }
+
+private:
+    struct string_hash {
+        using is_transparent = void;
+        size_t operator()(std::string_view value) const noexcept {
+            return std::hash<std::string_view>{}(value);
+        }
+    };
+
+    /** Future of key's call, and whether promise now leads it */
+    std::pair<std::shared_future<Value>, bool> join(
+        std::string_view key,
+        const std::shared_ptr<std::promise<Value>>& promise) {
+        std::lock_guard lock(mutex_);
+        auto it = calls_.find(key);
+        if (it != calls_.end()) {
+            return {it->second, false};
+        }
+        auto future = promise->get_future().share();
+        calls_.emplace(std::string(key), future);
+        return {future, true};
+    }
+
+    template <typename Load>
+    void finish(std::string_view key, std::promise<Value>& promise,
+                Load&& load) {
+        try {
+            promise.set_value(load());
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+        }
+        std::lock_guard lock(mutex_);
+        calls_.erase(calls_.find(key));
+    }
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_future<Value>, string_hash,
+                       std::equal_to<>>
+        calls_;
+};
+
+}  // namespace pacs::bridge::internal
+
+#endif  // PACS_BRIDGE_INTERNAL_SINGLE_FLIGHT_H
@@ -21,6 +21,7 @@
  * @see docs/reference_materials/05_mwl_mapping.md
  */
 
+#include "pacs/bridge/protocol/hl7/hl7_flat_message.h"
 #include "pacs/bridge/protocol/hl7/hl7_message.h"
 #include "pacs/bridge/protocol/hl7/hl7_types.h"
 
@@ -434,6 +435,17 @@ public:
     [[nodiscard]] Result<mwl_item> to_mwl(
         const hl7::hl7_message& message) const;
 
+    /**
+     * @brief Convert ORM^O01 message view to MWL item
+     *
+     * Same mapping as to_mwl(const hl7_message&), read in place.
+     *
+     * @param message Flat HL7 ORM order message
+     * @return MWL item or error
+     */
+    [[nodiscard]] Result<mwl_item> to_mwl(
+        const hl7::hl7_flat_message& message) const;
+
     /**
      * @brief Extract patient demographics from ADT message
      *
@@ -443,6 +455,15 @@ public:
     [[nodiscard]] Result<dicom_patient> to_patient(
         const hl7::hl7_message& message) const;
 
+    /**
+     * @brief Extract patient demographics from ADT message view
+     *
+     * @param message Flat HL7 ADT message
+     * @return Patient data or error
+     */
+    [[nodiscard]] Result<dicom_patient> to_patient(
+        const hl7::hl7_flat_message& message) const;
+
     /**
      * @brief Check if message type can be mapped to MWL
      *
@@ -569,6 +590,13 @@ public:
         const mwl_item& item) const;
 
 private:
+    template <typename Message>
+    [[nodiscard]] Result<mwl_item> map_mwl(const Message& message) const;
+
+    template <typename Message>
+    [[nodiscard]] Result<dicom_patient> map_patient(
+        const Message& message) const;
+
     class impl;
     std::unique_ptr<impl> pimpl_;
 };
@@ -229,6 +229,20 @@ struct subscription_result {
 using message_callback =
     std::function<subscription_result(const hl7::hl7_message& message)>;
 
+/**
+ * @brief Shared immutable handle to a published message
+ */
+using message_ptr = std::shared_ptr<const hl7::hl7_message>;
+
+/**
+ * @brief Callback type for subscriptions that keep the message
+ *
+ * Subscribers that hand the message to another thread can hold on to the
+ * handle instead of copying the message.
+ */
+using shared_message_callback =
+    std::function<subscription_result(const message_ptr& message)>;
+
 /**
  * @brief Filter function type - returns true to accept message
  */
@@ -322,6 +336,13 @@ struct hl7_message_bus_config {
  * topic-based distribution. Messages are automatically routed to
  * appropriate topics based on message type and trigger event.
  *
+ * In standalone mode messages are delivered synchronously on the publishing
+ * thread. Subscriptions are held in an immutable snapshot indexed by topic
+ * pattern, so publishing takes no lock and its cost depends on the number
+ * of matching subscriptions, not the total. Matching subscriptions are
+ * called highest priority first, then in subscription order. A subscription
+ * removed while a publish is in flight may still receive that message.
+ *
  * @example Basic Usage
  * ```cpp
  * hl7_message_bus bus;
@@ -431,6 +452,32 @@ public:
         const hl7::hl7_message& message,
         message_priority priority = message_priority::normal);
 
+    /**
+     * @brief Publish a shared HL7 message
+     *
+     * subscribe_shared() subscribers receive this handle rather than a copy.
+     *
+     * @param message HL7 message to publish (must not be null)
+     * @param priority Message priority (default: normal)
+     * @return Success or error
+     */
+    [[nodiscard]] std::expected<void, message_bus_error> publish(
+        const message_ptr& message,
+        message_priority priority = message_priority::normal);
+
+    /**
+     * @brief Publish a shared HL7 message to a specific topic
+     *
+     * @param topic Target topic
+     * @param message HL7 message to publish (must not be null)
+     * @param priority Message priority
+     * @return Success or error
+     */
+    [[nodiscard]] std::expected<void, message_bus_error> publish(
+        std::string_view topic,
+        const message_ptr& message,
+        message_priority priority = message_priority::normal);
+
     // =========================================================================
     // Subscribing
     // =========================================================================
@@ -454,6 +501,25 @@ public:
         message_filter filter = nullptr,
         int priority = 5);
 
+    /**
+     * @brief Subscribe with a callback that receives a shared message handle
+     *
+     * Publishing a const reference creates at most one shared copy per
+     * publish, however many shared subscribers match; publishing a
+     * message_ptr passes it through without copying.
+     *
+     * @param topic_pattern Topic pattern (supports wildcards: * and #)
+     * @param callback Function to call for matching messages
+     * @param filter Optional filter function
+     * @param priority Subscription priority (default: 5)
+     * @return Subscription handle or error
+     */
+    [[nodiscard]] std::expected<subscription_handle, message_bus_error>
+    subscribe_shared(std::string_view topic_pattern,
+                     shared_message_callback callback,
+                     message_filter filter = nullptr,
+                     int priority = 5);
+
     /**
      * @brief Subscribe to a specific message type
      *
@@ -11,6 +11,7 @@
  *   - Error handling and recovery
  *   - Stage metrics and logging
  *   - Conditional stage execution
+ *   - Staged (SEDA) execution with per-stage queues and workers
  *
  * @see https://github.com/kcenon/pacs_bridge/issues/146
  * @see https://github.com/kcenon/pacs_bridge/issues/155
@@ -22,6 +23,7 @@
 #include <chrono>
 #include <expected>
 #include <functional>
+#include <future>
 #include <memory>
 #include <optional>
 #include <string>
@@ -64,7 +66,10 @@ enum class pipeline_error : int {
     max_retries_exceeded = -827,
 
     /** Pipeline already running */
-    already_running = -828
+    already_running = -828,
+
+    /** Stage queue stayed full past the enqueue timeout */
+    queue_full = -829
 };
 
 /**
@@ -97,6 +102,8 @@ enum class pipeline_error : int {
             return "Maximum retry attempts exceeded";
         case pipeline_error::already_running:
             return "Pipeline is already running";
+        case pipeline_error::queue_full:
+            return "Pipeline stage queue is full";
         default:
             return "Unknown pipeline error";
     }
@@ -200,12 +207,32 @@ struct pipeline_stage {
 
     /** Retry delay */
     std::chrono::milliseconds retry_delay{100};
+
+    /** Worker threads for this stage (staged execution only) */
+    size_t workers = 1;
+
+    /** Capacity of this stage's input queue (staged execution only) */
+    size_t queue_capacity = 1024;
 };
 
 // =============================================================================
 // Pipeline Configuration
 // =============================================================================
 
+/**
+ * @brief How the pipeline runs its stages
+ */
+enum class pipeline_execution {
+    /** process() and submit() run every stage on the calling thread */
+    synchronous,
+
+    /**
+     * Each stage has its own bounded queue and worker threads; submit()
+     * returns once the message is queued for the first stage
+     */
+    staged
+};
+
 /**
  * @brief Pipeline configuration
  */
@@ -230,6 +257,12 @@ struct pipeline_config {
 
     /** Stop on first error */
     bool stop_on_error = true;
+
+    /** Execution mode for submit() and message bus integration */
+    pipeline_execution execution = pipeline_execution::synchronous;
+
+    /** How long submit() waits for room in the first stage's queue */
+    std::chrono::milliseconds enqueue_timeout{1000};
 };
 
 // =============================================================================
@@ -293,6 +326,26 @@ struct pipeline_config {
  *     .add_processor("send", send_to_pacs)
  *     .build();
  * ```
+ *
+ * @example Staged Execution
+ * ```cpp
+ * auto pipeline = hl7_pipeline_builder::create("adt_pipeline")
+ *     .staged()
+ *     .add_validator(validate_adt).with_workers(4)
+ *     .add_processor("send", send_to_pacs).with_retry(3, 500ms)
+ *     .build();
+ *
+ * auto done = pipeline.submit(std::move(message));  // Does not wait
+ * ```
+ *
+ * In staged execution each enabled stage gets a bounded lock-free queue and
+ * its own workers, so CPU-bound stages scale independently of I/O-bound
+ * ones. A message moves from stage to stage without being copied. A worker
+ * whose next stage is full waits for room, which propagates backpressure
+ * back to submit(). Failed attempts are retried from a timer after the
+ * stage's retry_delay instead of sleeping on a worker. Workers start on the
+ * first submit() and take a snapshot of the stages; later stage changes
+ * apply after stop().
  */
 class hl7_pipeline {
 public:
@@ -403,6 +456,25 @@ public:
     [[nodiscard]] std::expected<hl7::hl7_message, pipeline_error> process(
         std::string_view raw_data);
 
+    /**
+     * @brief Submit a message for processing
+     *
+     * In staged execution the message is queued for the first stage and the
+     * future completes when it leaves the last one; if the first stage's
+     * queue stays full for enqueue_timeout the future holds queue_full. In
+     * synchronous execution the message is processed before returning.
+     *
+     * @param message HL7 message to process (moved through the stages)
+     * @return Future for the processed message or error
+     */
+    [[nodiscard]] std::future<std::expected<hl7::hl7_message, pipeline_error>>
+    submit(hl7::hl7_message message);
+
+    /**
+     * @brief Messages submitted in staged execution and not yet completed
+     */
+    [[nodiscard]] size_t in_flight() const noexcept;
+
     // =========================================================================
     // Message Bus Integration
     // =========================================================================
@@ -419,7 +491,9 @@ public:
         std::shared_ptr<class hl7_message_bus> bus);
 
     /**
-     * @brief Stop message bus integration
+     * @brief Stop message bus integration and staged workers
+     *
+     * Waits for messages already submitted to complete.
      */
     void stop();
 
@@ -455,6 +529,21 @@ public:
             uint64_t successes = 0;
             uint64_t failures = 0;
             double avg_time_us = 0.0;
+
+            /** Messages waiting in this stage's queue (staged execution) */
+            size_t queue_depth = 0;
+
+            /** Highest queue depth observed (staged execution) */
+            size_t peak_queue_depth = 0;
+
+            /** Queue capacity (staged execution) */
+            size_t queue_capacity = 0;
+
+            /** Times a message found this stage's queue full (backpressure) */
+            uint64_t queue_full_events = 0;
+
+            /** Retry attempts scheduled for this stage */
+            uint64_t retries = 0;
         };
         std::vector<stage_stats> stage_statistics;
 
@@ -585,6 +674,22 @@ public:
     hl7_pipeline_builder& with_retry(size_t max_retries,
                                       std::chrono::milliseconds delay);
 
+    /**
+     * @brief Configure workers and queue for the last added stage
+     *
+     * Applies to staged execution only.
+     *
+     * @param workers Worker threads for the stage
+     * @param queue_capacity Capacity of the stage's input queue
+     */
+    hl7_pipeline_builder& with_workers(size_t workers,
+                                        size_t queue_capacity = 1024);
+
+    /**
+     * @brief Use staged execution
+     */
+    hl7_pipeline_builder& staged(bool enable = true);
+
     /**
      * @brief Set pipeline timeout
      */
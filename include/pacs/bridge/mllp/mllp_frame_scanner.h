@@ -0,0 +1,122 @@
+#ifndef PACS_BRIDGE_MLLP_MLLP_FRAME_SCANNER_H
+#define PACS_BRIDGE_MLLP_MLLP_FRAME_SCANNER_H
+
+/**
+ * @file mllp_frame_scanner.h
+ * @brief Incremental MLLP frame extraction for stream receivers
+ *
+ * Splits a TCP byte stream into MLLP frame payloads. The scanner keeps its
+ * framing state between reads, so every received byte is examined exactly
+ * once regardless of how a message is fragmented, and nothing is erased
+ * from the front of a buffer.
+ *
+ * Payload bytes are appended to a per-frame buffer as they arrive. When
+ * the FS+CR trailer is seen, that buffer is moved out as the completed
+ * payload, ready to become mllp_message::content without another copy.
+ * Consumers can hand the buffer back with recycle() once done with it.
+ *
+ * @see docs/reference_materials/04_mllp_protocol.md
+ */
+
+#include "pacs/bridge/mllp/mllp_types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace pacs::bridge::mllp {
+
+/**
+ * @brief Resumable MLLP framing state machine
+ *
+ * Bytes outside a frame (before VT) are discarded. An FS not followed by CR
+ * is treated as payload, matching the previous buffer-rescan behaviour.
+ * Not thread-safe; use one scanner per connection.
+ *
+ * @example
+ * @code
+ * mllp_frame_scanner scanner(config.max_message_size);
+ * std::span<const uint8_t> input(read_buffer, bytes_read);
+ * while (!input.empty()) {
+ *     auto frame = scanner.next_frame(input);
+ *     if (!frame) { ... protocol error ... }
+ *     if (*frame) {
+ *         mllp_message msg;
+ *         msg.content = std::move(**frame);
+ *         ...
+ *         scanner.recycle(std::move(msg.content));
+ *     }
+ * }
+ * @endcode
+ */
+class mllp_frame_scanner {
+public:
+    /** Largest payload buffer kept for reuse by recycle() */
+    static constexpr size_t max_recycled_capacity = 1024 * 1024;
+
+    /**
+     * @brief Create scanner
+     * @param max_message_size Largest accepted payload in bytes
+     */
+    explicit mllp_frame_scanner(size_t max_message_size = MLLP_MAX_MESSAGE_SIZE);
+
+    /**
+     * @brief Consume input until one frame completes or input is exhausted
+     *
+     * Advances input past every byte consumed. Call repeatedly while input
+     * is non-empty to drain several frames received in one read.
+     *
+     * @param input Received bytes; updated to the unconsumed remainder
+     * @return Completed payload, std::nullopt if more data is needed, or
+     *         message_too_large (the partial frame is dropped)
+     */
+    [[nodiscard]] std::expected<std::optional<std::vector<uint8_t>>, mllp_error>
+    next_frame(std::span<const uint8_t>& input);
+
+    /**
+     * @brief Return a consumed payload buffer for the next frame
+     *
+     * Buffers larger than max_recycled_capacity are released instead.
+     */
+    void recycle(std::vector<uint8_t>&& buffer) noexcept;
+
+    /**
+     * @brief Check if a frame has started but not yet completed
+     */
+    [[nodiscard]] bool in_frame() const noexcept {
+        return state_ != scan_state::seeking_start;
+    }
+
+    /**
+     * @brief Payload bytes buffered for the incomplete frame
+     */
+    [[nodiscard]] size_t pending_bytes() const noexcept { return body_.size(); }
+
+    /**
+     * @brief Drop any partial frame and return to the initial state
+     */
+    void reset() noexcept;
+
+private:
+    enum class scan_state : uint8_t {
+        /** Discarding bytes until VT */
+        seeking_start,
+
+        /** Accumulating payload until FS */
+        in_body,
+
+        /** Saw FS; expecting CR */
+        after_end_byte
+    };
+
+    size_t max_message_size_;
+    scan_state state_ = scan_state::seeking_start;
+    std::vector<uint8_t> body_;
+};
+
+}  // namespace pacs::bridge::mllp
+
+#endif  // PACS_BRIDGE_MLLP_MLLP_FRAME_SCANNER_H
@@ -167,6 +167,20 @@ struct session_stats {
  */
 class mllp_session {
 public:
+    /**
+     * @brief Callback for data delivered in push mode
+     *
+     * The span is only valid for the duration of the call.
+     */
+    using receive_callback = std::function<void(std::span<const uint8_t> data)>;
+
+    /**
+     * @brief Callback invoked once when a push-mode session ends
+     *
+     * @param reason connection_closed, timeout (idle) or socket_error
+     */
+    using close_callback = std::function<void(network_error reason)>;
+
     virtual ~mllp_session() = default;
 
     // Non-copyable
@@ -190,6 +204,41 @@ public:
     [[nodiscard]] virtual std::expected<std::vector<uint8_t>, network_error>
     receive(size_t max_bytes, std::chrono::milliseconds timeout) = 0;
 
+    /**
+     * @brief Receive data directly into a caller-provided buffer
+     *
+     * Same semantics as receive(), but avoids allocating a vector per call so
+     * callers can read into a reused (e.g. pooled) buffer. The default
+     * implementation copies from receive(); transports override it to read
+     * in place.
+     *
+     * @param buffer Destination; up to buffer.size() bytes are written
+     * @param timeout Maximum time to wait for data
+     * @return Number of bytes written, or error
+     */
+    [[nodiscard]] virtual std::expected<size_t, network_error>
+    receive_into(std::span<uint8_t> buffer, std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Switch the session to push-mode delivery
+     *
+     * Event-driven transports invoke on_data from their I/O thread as bytes
+     * arrive, so the caller does not need a thread blocked in receive() for
+     * every connection. on_close is invoked once when the peer disconnects,
+     * an error occurs, or no data arrives within idle_timeout. receive() and
+     * receive_into() must not be used after a successful call.
+     *
+     * The default implementation returns false.
+     *
+     * @param on_data Called for each received chunk
+     * @param on_close Called when the session ends
+     * @param idle_timeout Close after this long without data (0 = never)
+     * @return false if the transport only supports blocking receive()
+     */
+    [[nodiscard]] virtual bool
+    start_async_receive(receive_callback on_data, close_callback on_close,
+                        std::chrono::milliseconds idle_timeout);
+
     /**
      * @brief Send data over the connection
      *
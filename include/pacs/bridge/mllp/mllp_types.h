@@ -138,6 +138,26 @@ enum class mllp_error : int {
 // MLLP Server Configuration
 // =============================================================================
 
+/**
+ * @brief Connection I/O model used by mllp_server
+ */
+enum class mllp_io_model : uint8_t {
+    /** Event loop where supported and TLS is disabled, otherwise per-thread */
+    automatic,
+
+    /** One thread blocked in receive per connection */
+    thread_per_connection,
+
+    /** Reactor threads multiplex all connections (Linux epoll, no TLS) */
+    event_loop,
+
+    /**
+     * Completion-based loop (Linux io_uring, no TLS). Falls back to
+     * event_loop when the kernel lacks io_uring support.
+     */
+    io_uring
+};
+
 /**
  * @brief MLLP server configuration
  *
@@ -163,6 +183,21 @@ struct mllp_server_config {
     /** TLS configuration (disabled by default) */
     security::tls_config tls;
 
+    /** Connection I/O model */
+    mllp_io_model io_model = mllp_io_model::automatic;
+
+    /** Reactor threads reading sockets (event-loop model) */
+    size_t reactor_threads = 1;
+
+    /** Worker threads running the message handler (event-loop model) */
+    size_t worker_threads = 4;
+
+    /**
+     * Completed messages queued per worker (event-loop model). When full,
+     * the reactor runs the handler itself, pausing reads until it returns.
+     */
+    size_t max_pending_messages = 1024;
+
 #ifndef PACS_BRIDGE_STANDALONE_BUILD
     /** Optional executor for task execution (nullptr = use internal std::thread) */
     std::shared_ptr<kcenon::common::interfaces::IExecutor> executor;
@@ -174,6 +209,8 @@ struct mllp_server_config {
         if (max_connections == 0) return false;
         if (max_message_size == 0) return false;
         if (tls.enabled && !tls.is_valid_for_server()) return false;
+        if (reactor_threads == 0 || worker_threads == 0) return false;
+        if (max_pending_messages == 0) return false;
         return true;
     }
 };
@@ -213,6 +250,13 @@ struct mllp_client_config {
     /** Keep connection alive for reuse */
     bool keep_alive = true;
 
+    /**
+     * Send and receive through io_uring, submitting each message and the
+     * read of its response together (Linux, no TLS). Ignored when the
+     * kernel lacks io_uring support.
+     */
+    bool use_io_uring = false;
+
 #ifndef PACS_BRIDGE_STANDALONE_BUILD
     /** Optional executor for async operations (nullptr = use std::async) */
     std::shared_ptr<kcenon::common::interfaces::IExecutor> executor;
@@ -11,12 +11,17 @@
  * @see https://github.com/kcenon/pacs_bridge/issues/40
  */
 
+#include "pacs/bridge/internal/log_linear_histogram.h"
+#include "pacs/bridge/internal/sharded_counter.h"
+#include "pacs/bridge/monitoring/prometheus_writer.h"
+
 #include <atomic>
 #include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -61,6 +66,117 @@ inline std::vector<double> default_queue_depth_buckets() {
     return {10, 50, 100, 500, 1000, 5000, 10000, 50000};
 }
 
+// ═══════════════════════════════════════════════════════════════════════════
+// Metric Handles
+// ═══════════════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Default limit on label sets across all labeled metrics
+ */
+inline constexpr size_t default_cardinality_limit = 2048;
+
+/**
+ * @brief Pre-resolved handle to one labeled counter
+ *
+ * Obtained once from bridge_metrics_collector and cached by the call site;
+ * recording through it is a relaxed increment with no lookup. Handles stay
+ * valid for the life of the process. A default-constructed handle is a
+ * no-op.
+ */
+class counter_handle {
+public:
+    counter_handle() = default;
+
+    void increment() const noexcept {
+        if (cell_ && enabled_->load(std::memory_order_relaxed)) {
+            cell_->increment();
+        }
+    }
+
+    explicit operator bool() const noexcept { return cell_ != nullptr; }
+
+private:
+    friend class bridge_metrics_collector;
+    counter_handle(internal::sharded_counter* cell,
+                   const std::atomic<bool>* enabled) noexcept
+        : cell_(cell), enabled_(enabled) {}
+
+    internal::sharded_counter* cell_ = nullptr;
+    const std::atomic<bool>* enabled_ = nullptr;
+};
+
+/**
+ * @brief Pre-resolved handle to one labeled gauge
+ */
+class gauge_handle {
+public:
+    gauge_handle() = default;
+
+    void set(size_t value) const noexcept {
+        if (cell_ && enabled_->load(std::memory_order_relaxed)) {
+            cell_->store(value, std::memory_order_relaxed);
+        }
+    }
+
+    explicit operator bool() const noexcept { return cell_ != nullptr; }
+
+private:
+    friend class bridge_metrics_collector;
+    gauge_handle(std::atomic<size_t>* cell,
+                 const std::atomic<bool>* enabled) noexcept
+        : cell_(cell), enabled_(enabled) {}
+
+    std::atomic<size_t>* cell_ = nullptr;
+    const std::atomic<bool>* enabled_ = nullptr;
+};
+
+/**
+ * @brief Pre-resolved handle to one labeled latency histogram
+ */
+class histogram_handle {
+public:
+    histogram_handle() = default;
+
+    void record(std::chrono::nanoseconds duration) const noexcept {
+        if (cell_ && enabled_->load(std::memory_order_relaxed)) {
+            cell_->record(duration.count() > 0
+                              ? static_cast<uint64_t>(duration.count())
+                              : 0);
+        }
+    }
+
+    explicit operator bool() const noexcept { return cell_ != nullptr; }
+
+private:
+    friend class bridge_metrics_collector;
+    histogram_handle(internal::log_linear_histogram* cell,
+                     const std::atomic<bool>* enabled) noexcept
+        : cell_(cell), enabled_(enabled) {}
+
+    internal::log_linear_histogram* cell_ = nullptr;
+    const std::atomic<bool>* enabled_ = nullptr;
+};
+
+/**
+ * @brief Handles for the per-message-type HL7 metrics
+ */
+struct hl7_message_metrics {
+    counter_handle received;
+    counter_handle sent;
+    histogram_handle processing_duration;
+};
+
+/**
+ * @brief Handles for the per-destination queue metrics
+ */
+struct destination_metrics {
+    gauge_handle depth;
+    counter_handle enqueued;
+    counter_handle delivered;
+    counter_handle delivery_failures;
+    counter_handle dead_letters;
+};
+
 // ═══════════════════════════════════════════════════════════════════════════
 // Bridge Metrics Collector
 // ═══════════════════════════════════════════════════════════════════════════
@@ -68,7 +184,16 @@ inline std::vector<double> default_queue_depth_buckets() {
 /**
  * @brief Metrics collector for PACS Bridge components
  *
- * Thread-safe: All public methods are thread-safe.
+ * Thread-safe: All public methods are thread-safe. Recording takes no lock
+ * once a label value has been seen: counters are per-thread sharded and
+ * latencies go to log-linear histograms with atomic buckets (see
+ * internal/log_linear_histogram.h), merged only when metrics are exported.
+ * Call sites on hot paths resolve handles once (hl7_metrics(),
+ * queue_metrics()) and record through them without any lookup.
+ *
+ * Label sets are bounded: once cardinality_limit() label sets exist across
+ * all metrics, or 512 in one metric, a metric counts any further label
+ * values under the label value "other".
  *
  * @example
  * ```cpp
@@ -125,13 +250,13 @@ public:
      * @brief Record an HL7 message received
      * @param message_type HL7 message type (ADT, ORM, ORU, SIU, etc.)
      */
-    void record_hl7_message_received(const std::string& message_type);
+    void record_hl7_message_received(std::string_view message_type);
 
     /**
      * @brief Record an HL7 message sent
      * @param message_type HL7 message type
      */
-    void record_hl7_message_sent(const std::string& message_type);
+    void record_hl7_message_sent(std::string_view message_type);
 
     /**
      * @brief Record HL7 message processing duration
@@ -139,7 +264,7 @@ public:
      * @param duration Processing duration
      */
     void record_hl7_processing_duration(
-        const std::string& message_type,
+        std::string_view message_type,
         std::chrono::nanoseconds duration);
 
     /**
@@ -147,8 +272,8 @@ public:
      * @param message_type HL7 message type
      * @param error_type Error category (parse_error, validation_error, etc.)
      */
-    void record_hl7_error(const std::string& message_type,
-                          const std::string& error_type);
+    void record_hl7_error(std::string_view message_type,
+                          std::string_view error_type);
 
     // ═══════════════════════════════════════════════════════════════════════
     // MWL Metrics
@@ -184,31 +309,31 @@ public:
      * @param destination Queue destination name
      * @param depth Current queue depth
      */
-    void set_queue_depth(const std::string& destination, size_t depth);
+    void set_queue_depth(std::string_view destination, size_t depth);
 
     /**
      * @brief Record message enqueued
      * @param destination Queue destination name
      */
-    void record_message_enqueued(const std::string& destination);
+    void record_message_enqueued(std::string_view destination);
 
     /**
      * @brief Record message delivered
      * @param destination Queue destination name
      */
-    void record_message_delivered(const std::string& destination);
+    void record_message_delivered(std::string_view destination);
 
     /**
      * @brief Record delivery failure
      * @param destination Queue destination name
      */
-    void record_delivery_failure(const std::string& destination);
+    void record_delivery_failure(std::string_view destination);
 
     /**
      * @brief Record dead letter
      * @param destination Queue destination name
      */
-    void record_dead_letter(const std::string& destination);
+    void record_dead_letter(std::string_view destination);
 
     // ═══════════════════════════════════════════════════════════════════════
     // Connection Metrics
@@ -236,8 +361,54 @@ public:
      * @param method HTTP method
      * @param resource FHIR resource type
      */
-    void record_fhir_request(const std::string& method,
-                             const std::string& resource);
+    void record_fhir_request(std::string_view method,
+                             std::string_view resource);
+
+    // ═══════════════════════════════════════════════════════════════════════
+    // Metric Handles
+    // ═══════════════════════════════════════════════════════════════════════
+
+    /**
+     * @brief Resolve handles for one HL7 message type
+     * @param message_type HL7 message type (ADT, ORM, ADT_ACK, etc.)
+     */
+    [[nodiscard]] hl7_message_metrics hl7_metrics(std::string_view message_type);
+
+    /**
+     * @brief Resolve the handle for one (message type, error type) pair
+     */
+    [[nodiscard]] counter_handle hl7_error_counter(std::string_view message_type,
+                                                   std::string_view error_type);
+
+    /**
+     * @brief Resolve handles for one queue destination
+     */
+    [[nodiscard]] destination_metrics queue_metrics(std::string_view destination);
+
+    /**
+     * @brief Resolve the handle for one (method, resource) FHIR request pair
+     */
+    [[nodiscard]] counter_handle fhir_request_counter(std::string_view method,
+                                                      std::string_view resource);
+
+    /**
+     * @brief Set the limit on label sets across all labeled metrics
+     *
+     * Applies to label sets registered from now on. A metric that has
+     * already folded a label set into "other" keeps doing so for unseen
+     * label values.
+     */
+    void set_cardinality_limit(size_t limit) noexcept;
+
+    /**
+     * @brief Get the limit on label sets across all labeled metrics
+     */
+    [[nodiscard]] size_t cardinality_limit() const noexcept;
+
+    /**
+     * @brief Get the number of label sets registered across all metrics
+     */
+    [[nodiscard]] size_t label_set_count() const noexcept;
 
     // ═══════════════════════════════════════════════════════════════════════
     // System Metrics
@@ -260,6 +431,20 @@ public:
      */
     [[nodiscard]] std::string get_prometheus_metrics() const;
 
+    /**
+     * @brief Append metrics to a caller-owned buffer
+     *
+     * Encodes straight into out without intermediate strings. A caller that
+     * keeps out across scrapes (clearing it in between) allocates nothing
+     * once it has grown to the exposition size.
+     *
+     * @param out Buffer to append to
+     * @param format Prometheus text or OpenMetrics text
+     */
+    void write_prometheus_metrics(
+        std::string& out,
+        exposition_format format = exposition_format::prometheus_text) const;
+
     /**
      * @brief Get the Prometheus exporter port
      * @return Port number (0 if disabled)
@@ -285,6 +470,7 @@ private:
     std::string service_name_;
     uint16_t prometheus_port_{0};
     mutable std::mutex mutex_;
+    mutable std::atomic<size_t> last_exposition_size_{0};
 
 #ifdef PACS_BRIDGE_HAS_MONITORING_SYSTEM
     std::unique_ptr<kcenon::monitoring::prometheus_exporter> prometheus_exporter_;
@@ -14,6 +14,10 @@
  *   GET /health/deep  - Deep health check with component details
  *   GET /metrics      - Prometheus metrics (optional, requires metrics_provider)
  *
+ * Without a custom metrics_provider, /metrics streams bridge_metrics_collector
+ * output into a buffer reused across scrapes, in Prometheus text or (if the
+ * scraper asks for it) OpenMetrics format, gzip-compressed when accepted.
+ *
  * @see https://github.com/kcenon/pacs_bridge/issues/41
  */
 
@@ -23,6 +27,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 
 // IExecutor interface for task execution (when available)
 #ifndef PACS_BRIDGE_STANDALONE_BUILD
@@ -48,6 +53,9 @@ struct http_response {
     /** Response body */
     std::string body;
 
+    /** Content-Encoding header value (empty for identity) */
+    std::string content_encoding{};
+
     /**
      * @brief Create a 200 OK response with JSON body
      */
@@ -152,6 +160,12 @@ public:
         /** Path for metrics endpoint */
         std::string metrics_path = "/metrics";
 
+        /**
+         * Gzip the metrics response when the scraper sends
+         * Accept-Encoding: gzip (requires a build with zlib)
+         */
+        bool enable_metrics_compression = true;
+
 #ifndef PACS_BRIDGE_STANDALONE_BUILD
         /** Optional executor for accept and handler task execution (nullptr = use internal std::thread) */
         std::shared_ptr<kcenon::common::interfaces::IExecutor> executor;
@@ -323,6 +337,19 @@ public:
      */
     [[nodiscard]] http_response handle_request(std::string_view path) const;
 
+    /**
+     * @brief Handle a request with its raw header block
+     *
+     * The Accept header selects OpenMetrics output from the default metrics
+     * provider, and Accept-Encoding allows a gzip-compressed metrics body.
+     *
+     * @param path Request path (e.g., "/metrics")
+     * @param headers Raw request header lines ("Name: value\r\n"...)
+     * @return HTTP response
+     */
+    [[nodiscard]] http_response handle_request(std::string_view path,
+                                               std::string_view headers) const;
+
 private:
     class impl;
     std::unique_ptr<impl> pimpl_;
@@ -0,0 +1,199 @@
+#ifndef PACS_BRIDGE_MONITORING_PROMETHEUS_WRITER_H
+#define PACS_BRIDGE_MONITORING_PROMETHEUS_WRITER_H
+
+/**
+ * @file prometheus_writer.h
+ * @brief Streaming Prometheus / OpenMetrics text exposition encoder
+ *
+ * Writes metric families straight into a caller-owned output buffer with
+ * std::to_chars, so a scrape that reuses its buffer allocates nothing once
+ * the buffer has grown to the exposition size. The `# HELP` / `# TYPE`
+ * lines of each family are rendered once, when its metric_descriptor is
+ * built, and copied into the output on every scrape.
+ *
+ * Example usage:
+ * @code
+ *     static const metric_descriptor requests{
+ *         "requests_total", "Total requests", metric_type::counter};
+ *
+ *     std::string buffer;  // kept across scrapes
+ *     buffer.clear();
+ *     exposition_writer writer(buffer, exposition_format::openmetrics_text);
+ *     writer.family(requests);
+ *     writer.counter(requests, "method=\"GET\"", 42);
+ *     writer.finish();
+ * @endcode
+ */
+
+#include "pacs/bridge/internal/log_linear_histogram.h"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace pacs::bridge::monitoring {
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Exposition Format
+// ═══════════════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Text exposition formats
+ */
+enum class exposition_format {
+    /** Prometheus text format 0.0.4 */
+    prometheus_text,
+
+    /** OpenMetrics text format 1.0.0 */
+    openmetrics_text
+};
+
+/**
+ * @brief HTTP Content-Type for an exposition format
+ */
+[[nodiscard]] std::string_view content_type(exposition_format format) noexcept;
+
+/**
+ * @brief Metric family types
+ */
+enum class metric_type { counter, gauge, histogram };
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Metric Descriptor
+// ═══════════════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Name, help and type of one metric family, with pre-rendered headers
+ *
+ * Counters are named with their `_total` sample name. In OpenMetrics the
+ * family name drops the suffix and the sample name always carries it.
+ */
+class metric_descriptor {
+public:
+    metric_descriptor(std::string_view name, std::string_view help,
+                      metric_type type);
+
+    [[nodiscard]] metric_type type() const noexcept { return type_; }
+
+    /** Sample name (counter samples, or histogram base name) */
+    [[nodiscard]] std::string_view sample_name(
+        exposition_format format) const noexcept;
+
+    /** Pre-rendered `# HELP` and `# TYPE` lines */
+    [[nodiscard]] std::string_view header(
+        exposition_format format) const noexcept;
+
+private:
+    metric_type type_;
+    std::string name_;
+    std::string openmetrics_sample_name_;
+    std::string text_header_;
+    std::string openmetrics_header_;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Exposition Writer
+// ═══════════════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Appends exposition text for metric families to a buffer
+ *
+ * Labels are passed pre-rendered (`name="value",...`), as produced once per
+ * label set by the metric registry.
+ */
+class exposition_writer {
+public:
+    explicit exposition_writer(
+        std::string& out,
+        exposition_format format = exposition_format::prometheus_text) noexcept
+        : out_(out), format_(format) {}
+
+    [[nodiscard]] exposition_format format() const noexcept { return format_; }
+
+    /** Write the family's `# HELP` / `# TYPE` lines */
+    void family(const metric_descriptor& descriptor);
+
+    /** Write one counter sample */
+    void counter(const metric_descriptor& descriptor, std::string_view labels,
+                 uint64_t value);
+
+    /** Write one gauge sample */
+    void gauge(const metric_descriptor& descriptor, std::string_view labels,
+               double value);
+
+    /**
+     * @brief Write one histogram series from a nanosecond snapshot
+     *
+     * @param bounds Bucket boundaries in seconds, ascending
+     */
+    void histogram(const metric_descriptor& descriptor, std::string_view labels,
+                   const internal::log_linear_histogram::snapshot& snapshot,
+                   std::span<const double> bounds);
+
+    /** Terminate the exposition (`# EOF` for OpenMetrics) */
+    void finish();
+
+private:
+    void sample_prefix(std::string_view name, std::string_view suffix,
+                       std::string_view labels, std::string_view extra_label);
+    void append(uint64_t value);
+    void append_fixed(double value, int precision);
+
+    std::string& out_;
+    exposition_format format_;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Compression
+// ═══════════════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Check if gzip compression is available (built with zlib)
+ */
+[[nodiscard]] bool gzip_available() noexcept;
+
+/**
+ * @brief Gzip-compress input into output, replacing its contents
+ *
+ * output keeps its capacity, so a reused buffer does not reallocate once
+ * grown. Sets up and tears down a deflate stream per call; repeated
+ * callers should keep a gzip_compressor instead.
+ *
+ * @return false if compression is unavailable or failed
+ */
+bool gzip_compress(std::string_view input, std::string& output);
+
+/**
+ * @brief Reusable gzip compressor
+ *
+ * Keeps one deflate stream (and its window and hash tables) for its
+ * lifetime and resets it between calls. Not thread-safe.
+ */
+class gzip_compressor {
+public:
+    gzip_compressor();
+    ~gzip_compressor();
+
+    gzip_compressor(const gzip_compressor&) = delete;
+    gzip_compressor& operator=(const gzip_compressor&) = delete;
+
+    /**
+     * @brief Same contract as gzip_compress()
+     */
+    bool compress(std::string_view input, std::string& output);
+
+private:
+    struct stream;
+    std::unique_ptr<stream> stream_;
+};
+
+/**
+ * @brief Check if an HTTP Accept-Encoding value allows gzip
+ */
+[[nodiscard]] bool accepts_gzip(std::string_view accept_encoding) noexcept;
+
+}  // namespace pacs::bridge::monitoring
+
+#endif  // PACS_BRIDGE_MONITORING_PROMETHEUS_WRITER_H
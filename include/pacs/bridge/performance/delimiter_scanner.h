@@ -0,0 +1,264 @@
+#ifndef PACS_BRIDGE_PERFORMANCE_DELIMITER_SCANNER_H
+#define PACS_BRIDGE_PERFORMANCE_DELIMITER_SCANNER_H
+
+/**
+ * @file delimiter_scanner.h
+ * @brief Vectorized delimiter scanner for HL7 tokenization
+ *
+ * Locates every segment terminator and encoding character in a message
+ * buffer in a single pass and records their byte offsets. Parsers walk the
+ * resulting index instead of re-examining each byte at every level of the
+ * segment / field / component hierarchy.
+ *
+ * The scan kernel is selected at runtime:
+ *   - AVX2: 32 bytes per iteration
+ *   - SSE2: 16 bytes per iteration
+ *   - Scalar: byte lookup table (non-x86 targets)
+ *
+ * Payloads with few delimiters (e.g. base64 reports in OBX-5) are skipped
+ * a full vector at a time, which is where the vector kernels pay off most.
+ *
+ * @see docs/reference_materials/01_hl7_message_structure.md
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace pacs::bridge::performance {
+
+// =============================================================================
+// SIMD Level
+// =============================================================================
+
+/**
+ * @brief Instruction set used by the delimiter scan kernel
+ */
+enum class simd_level : uint8_t {
+    /** Portable byte-at-a-time lookup */
+    scalar,
+
+    /** 128-bit SSE2 compare + movemask */
+    sse2,
+
+    /** 256-bit AVX2 compare + movemask */
+    avx2
+};
+
+/**
+ * @brief Get string name of SIMD level
+ */
+[[nodiscard]] constexpr const char* to_string(simd_level level) noexcept {
+    switch (level) {
+        case simd_level::scalar:
+            return "scalar";
+        case simd_level::sse2:
+            return "sse2";
+        case simd_level::avx2:
+            return "avx2";
+        default:
+            return "unknown";
+    }
+}
+
+/**
+ * @brief Best SIMD level supported by the running CPU
+ *
+ * Detected once on first call.
+ */
+[[nodiscard]] simd_level detected_simd_level() noexcept;
+
+// =============================================================================
+// Delimiter Set
+// =============================================================================
+
+/**
+ * @brief Set of up to eight distinct delimiter bytes
+ */
+class delimiter_set {
+public:
+    /** Maximum number of delimiter bytes */
+    static constexpr size_t max_size = 8;
+
+    delimiter_set() = default;
+
+    /**
+     * @brief Create set from bytes (duplicates are ignored, extras dropped)
+     */
+    delimiter_set(std::initializer_list<char> bytes) noexcept {
+        for (char c : bytes) {
+            add(c);
+        }
+    }
+
+    /**
+     * @brief Add a byte to the set
+     * @return false if the set is full
+     */
+    bool add(char c) noexcept {
+        if (contains(c)) {
+            return true;
+        }
+        if (size_ == max_size) {
+            return false;
+        }
+        bytes_[size_++] = c;
+        const auto u = static_cast<unsigned char>(c);
+        table_[u >> 6] |= uint64_t{1} << (u & 63);
+        return true;
+    }
+
+    /**
+     * @brief Check if a byte is a delimiter
+     */
+    [[nodiscard]] bool contains(char c) const noexcept {
+        const auto u = static_cast<unsigned char>(c);
+        return (table_[u >> 6] >> (u & 63)) & 1;
+    }
+
+    /**
+     * @brief Delimiter bytes in insertion order
+     */
+    [[nodiscard]] std::span<const char> bytes() const noexcept {
+        return {bytes_.data(), size_};
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+private:
+    std::array<char, max_size> bytes_{};
+    size_t size_ = 0;
+    std::array<uint64_t, 4> table_{};
+};
+
+// =============================================================================
+// Delimiter Scanner
+// =============================================================================
+
+/**
+ * @brief Resumable scan that writes delimiter offsets into caller memory
+ *
+ * Lets parsers consume the index in fixed-size chunks (e.g. a stack buffer)
+ * without allocating. Use delimiter_index when the whole index is needed.
+ *
+ * @example
+ * @code
+ * delimiter_scanner scanner(raw, {'\r', '\n'});
+ * std::array<uint32_t, 256> chunk;
+ * while (size_t n = scanner.next(chunk)) {
+ *     for (size_t i = 0; i < n; ++i) { ... chunk[i] ... }
+ * }
+ * @endcode
+ */
+class delimiter_scanner {
+public:
+    /** Minimum buffer size that keeps the vector kernels engaged */
+    static constexpr size_t min_chunk = 64;
+
+    /**
+     * @brief Prepare a scan of data
+     *
+     * Levels above detected_simd_level() fall back to the best supported
+     * level.
+     */
+    delimiter_scanner(std::string_view data, const delimiter_set& delimiters,
+                      simd_level level = detected_simd_level()) noexcept;
+
+    /**
+     * @brief Write the next delimiter offsets into out
+     * @return Number of offsets written; 0 once the buffer is exhausted
+     */
+    [[nodiscard]] size_t next(std::span<uint32_t> out) noexcept;
+
+    /**
+     * @brief Check if the whole buffer has been scanned
+     */
+    [[nodiscard]] bool done() const noexcept { return position_ >= data_.size(); }
+
+    /**
+     * @brief Kernel in use
+     */
+    [[nodiscard]] simd_level level() const noexcept { return level_; }
+
+private:
+    std::string_view data_;
+    delimiter_set delimiters_;
+    size_t position_ = 0;
+    simd_level level_;
+};
+
+// =============================================================================
+// Delimiter Index
+// =============================================================================
+
+/**
+ * @brief Ascending byte offsets of delimiters in one buffer
+ *
+ * Offsets are 32-bit; buffers larger than 4 GiB are not supported (HL7
+ * messages are capped well below that by HL7_MAX_MESSAGE_SIZE).
+ *
+ * @example
+ * @code
+ * auto index = delimiter_index::scan(raw, {'\r', '\n', '|', '^', '~', '&'});
+ * for (uint32_t pos : index.positions()) {
+ *     switch (raw[pos]) { ... }
+ * }
+ * @endcode
+ */
+class delimiter_index {
+public:
+    delimiter_index() = default;
+
+    /**
+     * @brief Scan buffer with the best available kernel
+     */
+    [[nodiscard]] static delimiter_index scan(std::string_view data,
+                                              const delimiter_set& delimiters);
+
+    /**
+     * @brief Scan buffer with a specific kernel
+     *
+     * Levels above detected_simd_level() fall back to the best supported
+     * level. Intended for tests and benchmarks.
+     */
+    [[nodiscard]] static delimiter_index scan(std::string_view data,
+                                              const delimiter_set& delimiters,
+                                              simd_level level);
+
+    /**
+     * @brief Delimiter offsets in ascending order
+     */
+    [[nodiscard]] std::span<const uint32_t> positions() const noexcept {
+        return positions_;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return positions_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return positions_.empty(); }
+
+    [[nodiscard]] uint32_t operator[](size_t i) const noexcept {
+        return positions_[i];
+    }
+
+    /**
+     * @brief Index of the first position at or after offset
+     */
+    [[nodiscard]] size_t lower_bound(uint32_t offset) const noexcept;
+
+    /**
+     * @brief Kernel that produced this index
+     */
+    [[nodiscard]] simd_level level() const noexcept { return level_; }
+
+private:
+    std::vector<uint32_t> positions_;
+    simd_level level_ = simd_level::scalar;
+};
+
+}  // namespace pacs::bridge::performance
+
+#endif  // PACS_BRIDGE_PERFORMANCE_DELIMITER_SCANNER_H
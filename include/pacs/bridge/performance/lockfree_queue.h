@@ -32,6 +32,7 @@
 #include <memory>
 #include <optional>
 #include <span>
+#include <utility>
 #include <vector>
 
 namespace pacs::bridge::performance {
@@ -106,6 +107,13 @@ struct queue_statistics {
  *     }
  * @endcode
  *
+ * The queue is a fixed ring of capacity() cells (config.capacity rounded up
+ * to a power of two); config.bounded is not consulted. Blocking push()/pop()
+ * spin with backoff, then yield, then sleep briefly until the timeout.
+ * Items whose push fails or times out are destroyed.
+ *
+ * Explicitly instantiated for std::function<void()> and small_task<>.
+ *
  * @see concepts::Queueable
  */
 template <concepts::Queueable T>
@@ -249,6 +257,12 @@ private:
     std::unique_ptr<impl> impl_;
 };
 
+template <concepts::Queueable T>
+template <typename... Args>
+bool lockfree_queue<T>::emplace(Args&&... args) {
+    return try_push(T(std::forward<Args>(args)...));
+}
+
 // =============================================================================
 // Priority Queue
 // =============================================================================
@@ -376,6 +390,14 @@ private:
  * Multiple consumers (steal threads) can steal from top.
  * Optimized for locality - owner works on recently added items.
  *
+ * Chase-Lev deque over a fixed ring of capacity() slots that hold items
+ * inline; nothing is allocated per item. pop() and steal() claim an index
+ * before moving the item out, and a slot is reused only after its item has
+ * been moved out, so a push fails rather than overwrite a slot a slow thief
+ * is still reading.
+ *
+ * Explicitly instantiated for std::function<void()> and small_task<>.
+ *
  * @tparam T Element type (must satisfy concepts::Queueable)
  *
  * @see concepts::Queueable
@@ -402,8 +424,9 @@ public:
 
     /**
      * @brief Push item to bottom (owner only)
+     * @return false if the deque is full; item is then left untouched
      */
-    void push(T item);
+    [[nodiscard]] bool push(T&& item);
 
     /**
      * @brief Pop item from bottom (owner only)
@@ -435,6 +458,11 @@ public:
      */
     [[nodiscard]] size_t size() const noexcept;
 
+    /**
+     * @brief Get queue capacity
+     */
+    [[nodiscard]] size_t capacity() const noexcept;
+
 private:
     struct impl;
     std::unique_ptr<impl> impl_;
@@ -0,0 +1,222 @@
+#ifndef PACS_BRIDGE_PERFORMANCE_SMALL_TASK_H
+#define PACS_BRIDGE_PERFORMANCE_SMALL_TASK_H
+
+/**
+ * @file small_task.h
+ * @brief Move-only, allocation-free task type for thread pools and executors
+ *
+ * small_task<N> holds any void() callable. Callables of up to N bytes that
+ * are nothrow-movable live in the task itself; larger ones go to pooled
+ * overflow storage, recycled through per-thread caches, so steady-state
+ * posting does not touch the global allocator either way.
+ *
+ * Unlike std::function, small_task is move-only, so it can own move-only
+ * state such as std::promise, std::packaged_task or std::unique_ptr without
+ * a shared_ptr around it.
+ *
+ * Example usage:
+ * @code
+ *     std::promise<void> done;
+ *     auto future = done.get_future();
+ *
+ *     small_task<> task([done = std::move(done)]() mutable {
+ *         done.set_value();
+ *     });
+ *     pool.post(std::move(task));
+ * @endcode
+ */
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace pacs::bridge::performance {
+
+/** Default inline capacity of small_task in bytes */
+inline constexpr size_t default_task_capacity = 64;
+
+namespace detail {
+
+/**
+ * @brief Allocate overflow storage for a task callable
+ *
+ * Sizes up to 1 KiB with fundamental alignment come from size-classed
+ * blocks cached per thread; anything else goes to operator new.
+ */
+[[nodiscard]] void* allocate_task_storage(size_t size, size_t alignment);
+
+/**
+ * @brief Return storage from allocate_task_storage()
+ *
+ * May be called from a different thread than the allocation.
+ */
+void deallocate_task_storage(void* ptr, size_t size, size_t alignment) noexcept;
+
+}  // namespace detail
+
+// =============================================================================
+// Small Task
+// =============================================================================
+
+/**
+ * @brief Move-only void() callable with inline storage
+ *
+ * @tparam InlineCapacity Bytes of inline storage for the callable
+ */
+template <size_t InlineCapacity = default_task_capacity>
+class small_task {
+public:
+    static constexpr size_t inline_capacity = InlineCapacity;
+
+    /** Construct an empty task */
+    small_task() noexcept = default;
+
+    /** Construct an empty task */
+    small_task(std::nullptr_t) noexcept {}
+
+    /**
+     * @brief Construct from a callable
+     *
+     * Stored inline when it fits and is nothrow-movable; otherwise in pooled
+     * overflow storage.
+     */
+    template <typename F>
+        requires(!std::is_same_v<std::remove_cvref_t<F>, small_task> &&
+                 !std::is_same_v<std::remove_cvref_t<F>, std::nullptr_t> &&
+                 std::is_invocable_r_v<void, std::decay_t<F>&>)
+    small_task(F&& f) {
+        using callable = std::decay_t<F>;
+        if constexpr (fits_inline<callable>) {
+            ::new (static_cast<void*>(storage_)) callable(std::forward<F>(f));
+            ops_ = &inline_ops<callable>;
+        } else {
+            void* block =
+                detail::allocate_task_storage(sizeof(callable), alignof(callable));
+            try {
+                ::new (block) callable(std::forward<F>(f));
+            } catch (...) {
+                detail::deallocate_task_storage(block, sizeof(callable),
+                                                alignof(callable));
+                throw;
+            }
+            ::new (static_cast<void*>(storage_)) void*(block);
+            ops_ = &overflow_ops<callable>;
+        }
+    }
+
+    small_task(small_task&& other) noexcept { take(other); }
+
+    small_task& operator=(small_task&& other) noexcept {
+        if (this != &other) {
+            reset();
+            take(other);
+        }
+        return *this;
+    }
+
+    small_task& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    small_task(const small_task&) = delete;
+    small_task& operator=(const small_task&) = delete;
+
+    ~small_task() { reset(); }
+
+    /**
+     * @brief Invoke the callable
+     *
+     * @throws std::bad_function_call if the task is empty
+     */
+    void operator()() {
+        if (!ops_) {
+            throw std::bad_function_call();
+        }
+        ops_->invoke(storage_);
+    }
+
+    /** Check if the task holds a callable */
+    explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+    /** Check if the callable is stored inline (false when empty) */
+    [[nodiscard]] bool is_inline() const noexcept {
+        return ops_ != nullptr && ops_->is_inline;
+    }
+
+    /** Destroy the callable, leaving the task empty */
+    void reset() noexcept {
+        if (ops_) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+private:
+    struct operations {
+        void (*invoke)(void* storage);
+        void (*relocate)(void* from, void* to) noexcept;
+        void (*destroy)(void* storage) noexcept;
+        bool is_inline;
+    };
+
+    template <typename C>
+    static constexpr bool fits_inline =
+        sizeof(C) <= InlineCapacity &&
+        alignof(C) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<C>;
+
+    template <typename C>
+    static C* inline_target(void* storage) noexcept {
+        return std::launder(static_cast<C*>(storage));
+    }
+
+    template <typename C>
+    static C* overflow_target(void* storage) noexcept {
+        return static_cast<C*>(*std::launder(static_cast<void**>(storage)));
+    }
+
+    template <typename C>
+    static constexpr operations inline_ops{
+        [](void* storage) { (*inline_target<C>(storage))(); },
+        [](void* from, void* to) noexcept {
+            C* source = inline_target<C>(from);
+            ::new (to) C(std::move(*source));
+            source->~C();
+        },
+        [](void* storage) noexcept { inline_target<C>(storage)->~C(); },
+        true};
+
+    template <typename C>
+    static constexpr operations overflow_ops{
+        [](void* storage) { (*overflow_target<C>(storage))(); },
+        [](void* from, void* to) noexcept {
+            ::new (to) void*(*std::launder(static_cast<void**>(from)));
+        },
+        [](void* storage) noexcept {
+            C* target = overflow_target<C>(storage);
+            target->~C();
+            detail::deallocate_task_storage(target, sizeof(C), alignof(C));
+        },
+        false};
+
+    void take(small_task& other) noexcept {
+        if (other.ops_) {
+            other.ops_->relocate(other.storage_, storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+    }
+
+    static_assert(InlineCapacity >= sizeof(void*),
+                  "Inline storage must hold an overflow pointer");
+
+    alignas(std::max_align_t) unsigned char storage_[InlineCapacity];
+    const operations* ops_ = nullptr;
+};
+
+}  // namespace pacs::bridge::performance
+
+#endif  // PACS_BRIDGE_PERFORMANCE_SMALL_TASK_H
@@ -20,6 +20,7 @@
  */
 
 #include "pacs/bridge/performance/performance_types.h"
+#include "pacs/bridge/performance/small_task.h"
 
 #include <atomic>
 #include <chrono>
@@ -49,7 +50,7 @@ struct thread_pool_statistics {
     /** Total threads in pool */
     std::atomic<size_t> total_threads{0};
 
-    /** Tasks queued waiting for execution */
+    /** Tasks queued waiting for execution (workers report in batches) */
     std::atomic<size_t> queued_tasks{0};
 
     /** Peak queued tasks */
@@ -142,6 +143,13 @@ enum class task_priority : uint8_t {
  * Manages worker threads for message processing with integration to
  * thread_system's work-stealing scheduler.
  *
+ * Each worker owns a lock-free deque per priority; tasks posted from a worker
+ * stay on its deque, other posts go through a bounded injection queue per
+ * priority. Workers take the most urgent work they can see, steal from each
+ * other when idle, and park until a post wakes them. Priority is honoured
+ * per worker, not globally: a busy worker may still be running a normal task
+ * while an idle one picks up a critical task.
+ *
  * Example usage:
  * @code
  *     thread_pool_config config;
@@ -169,8 +177,13 @@ public:
     // Types
     // -------------------------------------------------------------------------
 
-    /** Task function type */
-    using task_fn = std::function<void()>;
+    /**
+     * @brief Task function type
+     *
+     * Move-only; callables up to default_task_capacity bytes are stored
+     * inline, so posting them does not allocate.
+     */
+    using task_fn = small_task<>;
 
     // -------------------------------------------------------------------------
     // Construction
@@ -409,12 +422,12 @@ auto thread_pool_manager::submit_priority(task_priority priority, F&& f,
     -> std::future<std::invoke_result_t<F, Args...>> {
     using return_type = std::invoke_result_t<F, Args...>;
 
-    auto task = std::make_shared<std::packaged_task<return_type()>>(
+    std::packaged_task<return_type()> task(
         std::bind(std::forward<F>(f), std::forward<Args>(args)...));
 
-    auto future = task->get_future();
+    auto future = task.get_future();
 
-    post([task = std::move(task)]() { (*task)(); }, priority);
+    post([task = std::move(task)]() mutable { task(); }, priority);
 
     return future;
 }
@@ -26,6 +26,7 @@
 #include "pacs/bridge/cache/patient_cache.h"
 #include "pacs/bridge/concepts/bridge_concepts.h"
 #include "pacs/bridge/mapping/hl7_dicom_mapper.h"
+#include "pacs/bridge/protocol/hl7/hl7_flat_message.h"
 #include "pacs/bridge/protocol/hl7/hl7_handler_base.h"
 #include "pacs/bridge/protocol/hl7/hl7_message.h"
 #include "pacs/bridge/protocol/hl7/hl7_types.h"
@@ -397,6 +398,18 @@ public:
     [[nodiscard]] Result<adt_result> handle(
         const hl7_message& message);
 
+    /**
+     * @brief Handle ADT message view
+     *
+     * Same processing as handle(const hl7_message&), reading the received
+     * buffer in place. Only the ACK is built as an hl7_message.
+     *
+     * @param message Flat HL7 ADT message
+     * @return Processing result or error
+     */
+    [[nodiscard]] Result<adt_result> handle(
+        const hl7_flat_message& message);
+
     // Note: can_handle() is provided by HL7HandlerBase via CRTP
 
     /**
@@ -575,6 +588,12 @@ private:
     [[nodiscard]] bool can_handle_impl(
         const hl7_message& message) const noexcept;
 
+    /**
+     * @brief CRTP implementation for can_handle on a message view
+     */
+    [[nodiscard]] bool can_handle_impl(
+        const hl7_flat_message& message) const noexcept;
+
     class impl;
     std::unique_ptr<impl> pimpl_;
 };
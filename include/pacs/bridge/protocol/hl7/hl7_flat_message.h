@@ -0,0 +1,510 @@
+#ifndef PACS_BRIDGE_PROTOCOL_HL7_HL7_FLAT_MESSAGE_H
+#define PACS_BRIDGE_PROTOCOL_HL7_HL7_FLAT_MESSAGE_H
+
+/**
+ * @file hl7_flat_message.h
+ * @brief Arena-backed flat HL7 v2.x message representation
+ *
+ * hl7_flat_message is a read-mostly alternative to hl7_message. Instead of
+ * building a segment -> field -> repetition -> component -> subcomponent
+ * tree with one std::string per leaf, it keeps:
+ *
+ *   - one contiguous buffer holding the raw message bytes (owned, or
+ *     borrowed from the caller via parse_borrowed()), and
+ *   - one flat offset table for segments, fields, repetitions, components
+ *     and subcomponents, carved out of a single per-message arena block.
+ *
+ * Parsing therefore costs a fixed, small number of allocations regardless
+ * of message size (buffer + arena), versus one or more per subcomponent in
+ * hl7_message. Values are returned as std::string_view into the buffer.
+ *
+ * Mutation is copy-on-write: set_value() records an owned replacement string
+ * in an overlay and leaves the raw buffer untouched. Value reads consult the
+ * overlay only once it is non-empty; structural queries (counts, raw())
+ * always describe the parsed bytes. to_message() materializes a full
+ * hl7_message (with all overlay writes applied) for code that needs the
+ * mutable tree API.
+ *
+ * @example Read-only access
+ * ```cpp
+ * auto msg = hl7_flat_message::parse(raw);
+ * if (msg) {
+ *     std::string_view family = msg->get_value("PID.5.1");
+ *     if (auto pid = msg->segment("PID")) {
+ *         std::string_view mrn = pid->field(3).component(1).value();
+ *     }
+ * }
+ * ```
+ *
+ * @see hl7_message
+ */
+
+#include "hl7_message.h"
+#include "hl7_types.h"
+
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pacs::bridge::hl7 {
+
+class hl7_flat_message;
+
+namespace detail {
+
+/**
+ * @brief Offset table entry shared by every level of the flat model
+ *
+ * Children of a node are stored contiguously in the next level's table,
+ * starting at first_child. Subcomponent entries leave the child fields zero.
+ */
+struct flat_node {
+    uint32_t offset = 0;
+    uint32_t length = 0;
+    uint32_t first_child = 0;
+    uint32_t child_count = 0;
+};
+
+}  // namespace detail
+
+// =============================================================================
+// Views
+// =============================================================================
+
+/**
+ * @brief Non-owning view of a component in an hl7_flat_message
+ *
+ * Views are cheap to copy and remain valid as long as the owning message
+ * is alive and not moved-from. Overlay writes made through
+ * hl7_flat_message::set_value() are visible through value() and
+ * subcomponent(); raw() always returns the original bytes.
+ */
+class hl7_component_view {
+public:
+    hl7_component_view() = default;
+
+    /** Get number of subcomponents */
+    [[nodiscard]] size_t subcomponent_count() const noexcept;
+
+    /** Check if component is empty */
+    [[nodiscard]] bool empty() const noexcept { return value().empty(); }
+
+    /** Get subcomponent value (1-based) */
+    [[nodiscard]] std::string_view subcomponent(size_t index) const noexcept;
+
+    /** Get the simple value (first subcomponent) */
+    [[nodiscard]] std::string_view value() const noexcept {
+        return subcomponent(1);
+    }
+
+    /** Get the unparsed component bytes */
+    [[nodiscard]] std::string_view raw() const noexcept;
+
+    /** Implicit conversion to string_view (gets first subcomponent value) */
+    [[nodiscard]] operator std::string_view() const noexcept { return value(); }
+
+    /** Comparison */
+    [[nodiscard]] bool operator==(std::string_view sv) const noexcept {
+        return value() == sv;
+    }
+
+private:
+    friend class hl7_field_view;
+
+    hl7_component_view(const hl7_flat_message* owner, uint32_t segment,
+                       uint32_t field, uint32_t repetition, uint32_t component)
+        : owner_(owner),
+          segment_(segment),
+          field_(field),
+          repetition_(repetition),
+          component_(component) {}
+
+    const hl7_flat_message* owner_ = nullptr;
+    uint32_t segment_ = 0;
+    uint32_t field_ = 0;
+    uint32_t repetition_ = 0;
+    uint32_t component_ = 0;
+};
+
+/**
+ * @brief Non-owning view of a field in an hl7_flat_message
+ */
+class hl7_field_view {
+public:
+    hl7_field_view() = default;
+
+    /** Get number of repetitions */
+    [[nodiscard]] size_t repetition_count() const noexcept;
+
+    /** Get number of components in first repetition */
+    [[nodiscard]] size_t component_count() const noexcept;
+
+    /** Check if field is empty */
+    [[nodiscard]] bool empty() const noexcept;
+
+    /** Get component by index (1-based) from first repetition */
+    [[nodiscard]] hl7_component_view component(size_t index) const noexcept {
+        return component(1, index);
+    }
+
+    /** Get component from specific repetition (both 1-based) */
+    [[nodiscard]] hl7_component_view component(size_t rep_index,
+                                               size_t comp_index) const noexcept;
+
+    /** Get the simple value (first component of first repetition) */
+    [[nodiscard]] std::string_view value() const noexcept {
+        return component(1).value();
+    }
+
+    /** Get the unparsed field bytes (all repetitions) */
+    [[nodiscard]] std::string_view raw() const noexcept;
+
+    /** Implicit conversion to string_view */
+    [[nodiscard]] operator std::string_view() const noexcept { return value(); }
+
+    /** Comparison */
+    [[nodiscard]] bool operator==(std::string_view sv) const noexcept {
+        return value() == sv;
+    }
+
+private:
+    friend class hl7_segment_view;
+
+    hl7_field_view(const hl7_flat_message* owner, uint32_t segment,
+                   uint32_t field)
+        : owner_(owner), segment_(segment), field_(field) {}
+
+    const hl7_flat_message* owner_ = nullptr;
+    uint32_t segment_ = 0;
+    uint32_t field_ = 0;
+};
+
+/**
+ * @brief Non-owning view of a segment in an hl7_flat_message
+ *
+ * A default-constructed (or not-found) view is "null": it converts to
+ * false and all accessors return empty values. operator-> is provided so
+ * code written against `const hl7_segment*` reads the same:
+ *
+ * ```cpp
+ * if (auto pid = msg.segment("PID")) {
+ *     auto id = pid->field_value(3);
+ * }
+ * ```
+ */
+class hl7_segment_view {
+public:
+    hl7_segment_view() = default;
+
+    /** Check whether the view refers to a segment */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return owner_ != nullptr;
+    }
+
+    /** Pointer-style access for parity with hl7_message::segment() */
+    [[nodiscard]] const hl7_segment_view* operator->() const noexcept {
+        return this;
+    }
+
+    /** Get segment ID (e.g., "MSH", "PID") */
+    [[nodiscard]] std::string_view segment_id() const noexcept;
+
+    /** Get number of fields (excluding segment ID) */
+    [[nodiscard]] size_t field_count() const noexcept;
+
+    /**
+     * @brief Get field by index (1-based per HL7 convention)
+     *
+     * As with hl7_segment, MSH-1 is the field separator and MSH-2 the
+     * encoding characters.
+     */
+    [[nodiscard]] hl7_field_view field(size_t index) const noexcept;
+
+    /** Get field value as string */
+    [[nodiscard]] std::string_view field_value(size_t index) const noexcept {
+        return field(index).value();
+    }
+
+    /**
+     * @brief Get value by path relative to the segment (e.g., "5.1.2")
+     */
+    [[nodiscard]] std::string_view get_value(std::string_view path) const noexcept;
+
+    /** Get the unparsed segment bytes (without terminator) */
+    [[nodiscard]] std::string_view raw() const noexcept;
+
+    /** Check if this is an MSH segment */
+    [[nodiscard]] bool is_msh() const noexcept { return segment_id() == "MSH"; }
+
+private:
+    friend class hl7_flat_message;
+
+    hl7_segment_view(const hl7_flat_message* owner, uint32_t segment)
+        : owner_(owner), segment_(segment) {}
+
+    const hl7_flat_message* owner_ = nullptr;
+    uint32_t segment_ = 0;
+};
+
+// =============================================================================
+// HL7 Flat Message
+// =============================================================================
+
+/**
+ * @brief Flat, arena-backed HL7 v2.x message
+ *
+ * Offers the read API of hl7_message (get_value, segment, header, ...)
+ * over a single owned buffer and offset table. See file documentation for
+ * the memory layout and mutation model.
+ *
+ * Thread safety: const member functions may be called concurrently;
+ * set_value() requires external synchronization.
+ */
+class hl7_flat_message {
+public:
+    /** Creates an empty message */
+    hl7_flat_message() = default;
+
+    hl7_flat_message(const hl7_flat_message& other);
+    hl7_flat_message(hl7_flat_message&& other) noexcept;
+    hl7_flat_message& operator=(const hl7_flat_message& other);
+    hl7_flat_message& operator=(hl7_flat_message&& other) noexcept;
+    ~hl7_flat_message() = default;
+
+    // =========================================================================
+    // Parsing
+    // =========================================================================
+
+    /**
+     * @brief Parse HL7 message, copying the bytes into an owned buffer
+     *
+     * Encoding characters are detected from MSH-1/MSH-2.
+     *
+     * @param data Raw HL7 message data
+     * @return Parsed message or error
+     */
+    [[nodiscard]] static std::expected<hl7_flat_message, hl7_error> parse(
+        std::string_view data);
+
+    /**
+     * @brief Parse HL7 message, adopting the given buffer without copying
+     *
+     * @param data Raw HL7 message data (moved into the message)
+     * @return Parsed message or error
+     */
+    [[nodiscard]] static std::expected<hl7_flat_message, hl7_error> parse_owned(
+        std::string data);
+
+    /**
+     * @brief Parse HL7 message over a caller-owned buffer without copying
+     *
+     * Intended for transient views over a receive buffer (for example
+     * mllp_message::content). The caller must keep @p data alive and
+     * unmodified for the lifetime of the message, its copies and every
+     * view or string_view obtained from it.
+     *
+     * @param data Raw HL7 message data (borrowed)
+     * @return Parsed message or error
+     */
+    [[nodiscard]] static std::expected<hl7_flat_message, hl7_error>
+    parse_borrowed(std::string_view data);
+
+    // =========================================================================
+    // Message Information
+    // =========================================================================
+
+    /** Get the raw bytes the message was parsed from */
+    [[nodiscard]] std::string_view raw() const noexcept { return buffer_; }
+
+    /** Get message header information (same semantics as hl7_message) */
+    [[nodiscard]] hl7_message_header header() const;
+
+    /** Get encoding characters */
+    [[nodiscard]] const hl7_encoding_characters& encoding() const noexcept {
+        return encoding_;
+    }
+
+    /** Check if message is empty (no segments) */
+    [[nodiscard]] bool empty() const noexcept { return segment_count_ == 0; }
+
+    /** Get message type */
+    [[nodiscard]] message_type type() const noexcept;
+
+    /** Get trigger event (e.g., "A01" for ADT^A01) */
+    [[nodiscard]] std::string_view trigger_event() const noexcept;
+
+    /** Get message control ID */
+    [[nodiscard]] std::string_view control_id() const noexcept;
+
+    // =========================================================================
+    // Segment Access
+    // =========================================================================
+
+    /** Get total number of segments */
+    [[nodiscard]] size_t segment_count() const noexcept { return segment_count_; }
+
+    /** Get count of segments with specific ID */
+    [[nodiscard]] size_t segment_count(std::string_view segment_id) const noexcept;
+
+    /**
+     * @brief Get segment by index (0-based)
+     * @throws std::out_of_range if index is invalid
+     */
+    [[nodiscard]] hl7_segment_view segment_at(size_t index) const;
+
+    /** Get first segment with specific ID (null view if not found) */
+    [[nodiscard]] hl7_segment_view segment(std::string_view segment_id) const noexcept {
+        return segment(segment_id, 0);
+    }
+
+    /** Get segment by ID and 0-based occurrence (null view if not found) */
+    [[nodiscard]] hl7_segment_view segment(std::string_view segment_id,
+                                           size_t occurrence) const noexcept;
+
+    /** Get all segments with specific ID */
+    [[nodiscard]] std::vector<hl7_segment_view> segments(
+        std::string_view segment_id) const;
+
+    /** Check if segment exists */
+    [[nodiscard]] bool has_segment(std::string_view segment_id) const noexcept {
+        return static_cast<bool>(segment(segment_id));
+    }
+
+    // =========================================================================
+    // Path-based Access
+    // =========================================================================
+
+    /**
+     * @brief Get value by path
+     *
+     * Same path syntax and semantics as hl7_message::get_value():
+     * "SEGMENT[occurrence].field[.component[.subcomponent]]".
+     */
+    [[nodiscard]] std::string_view get_value(std::string_view path) const noexcept;
+
+    /**
+     * @brief Set value by path (copy-on-write)
+     *
+     * The replacement is stored as an owned string in the overlay; the raw
+     * buffer is not modified. Unlike hl7_message::set_value(), segments are
+     * not created on demand; use to_message() for structural edits.
+     *
+     * @return true if the path addressed an existing segment
+     */
+    bool set_value(std::string_view path, std::string value);
+
+    /** Check whether the raw bytes are borrowed rather than owned */
+    [[nodiscard]] bool is_borrowed() const noexcept { return borrowed_; }
+
+    /** Check whether any overlay writes have been made */
+    [[nodiscard]] bool is_modified() const noexcept { return !overlay_.empty(); }
+
+    // =========================================================================
+    // Conversion
+    // =========================================================================
+
+    /**
+     * @brief Serialize to HL7 format
+     *
+     * Unmodified messages are emitted from the raw buffer with segments
+     * normalized to CR terminators. Modified messages are serialized through
+     * to_message(); an empty string is returned if that fails.
+     */
+    [[nodiscard]] std::string serialize() const;
+
+    /**
+     * @brief Materialize a full hl7_message with all overlay writes applied
+     *
+     * @return The message, or the hl7_message::parse() error if the raw
+     *         bytes do not form a message the tree parser accepts
+     *         (hl7_error::empty_message for a default-constructed view)
+     */
+    [[nodiscard]] std::expected<hl7_message, hl7_error> to_message() const;
+
+    /**
+     * @brief Create ACK response (same output as hl7_message::create_ack)
+     *
+     * Builds only the ACK; the message itself is not materialized.
+     *
+     * @param code Acknowledgment code
+     * @param text Optional text message
+     */
+    [[nodiscard]] hl7_message create_ack(ack_code code,
+                                         std::string_view text = "") const;
+
+    /**
+     * @brief Total number of offset table entries in the arena
+     *
+     * Useful for sizing and diagnostics; the arena is allocated once per
+     * parse with exactly this many entries.
+     */
+    [[nodiscard]] size_t node_count() const noexcept { return arena_size_; }
+
+private:
+    friend class hl7_segment_view;
+    friend class hl7_field_view;
+    friend class hl7_component_view;
+
+    /** Overlay write recorded by set_value() */
+    struct overlay_entry {
+        uint32_t segment = 0;
+        uint32_t field = 0;
+        uint32_t component = 0;     ///< 0 = whole field
+        uint32_t subcomponent = 0;  ///< 0 = whole component
+        std::string value;
+    };
+
+    [[nodiscard]] std::string_view slice(const detail::flat_node& node) const noexcept {
+        return buffer_.substr(node.offset, node.length);
+    }
+
+    [[nodiscard]] const detail::flat_node* segment_node(size_t index) const noexcept;
+    [[nodiscard]] const detail::flat_node* field_node(size_t segment,
+                                                      size_t field) const noexcept;
+    [[nodiscard]] const detail::flat_node* repetition_node(
+        size_t segment, size_t field, size_t repetition) const noexcept;
+    [[nodiscard]] const detail::flat_node* component_node(
+        size_t segment, size_t field, size_t repetition,
+        size_t component) const noexcept;
+
+    /**
+     * @brief Resolve a leaf value, applying overlay writes
+     *
+     * All indices are 1-based except segment (0-based table index).
+     */
+    [[nodiscard]] std::string_view resolve(size_t segment, size_t field,
+                                           size_t repetition, size_t component,
+                                           size_t subcomponent) const noexcept;
+
+    [[nodiscard]] std::string overlay_path(const overlay_entry& entry) const;
+
+    /** Build the offset table over buffer_ */
+    [[nodiscard]] static std::expected<hl7_flat_message, hl7_error> index(
+        hl7_flat_message msg);
+
+    // buffer_ views either storage_ (owned) or caller memory (borrowed)
+    bool borrowed_ = false;
+    std::string storage_;
+    std::string_view buffer_;
+    hl7_encoding_characters encoding_;
+
+    // Single arena block partitioned into per-level tables. Segments start
+    // at index 0; the other levels start at their *_base_ index. Indices
+    // (not pointers) keep copies and moves trivially correct.
+    std::unique_ptr<detail::flat_node[]> arena_;
+    size_t arena_size_ = 0;
+    uint32_t field_base_ = 0;
+    uint32_t repetition_base_ = 0;
+    uint32_t component_base_ = 0;
+    uint32_t subcomponent_base_ = 0;
+    size_t segment_count_ = 0;
+
+    std::vector<overlay_entry> overlay_;
+};
+
+}  // namespace pacs::bridge::hl7
+
+#endif  // PACS_BRIDGE_PROTOCOL_HL7_HL7_FLAT_MESSAGE_H
@@ -15,11 +15,14 @@
  *   - HL7HandlerConcept: Compile-time handler validation
  *   - IHL7Handler: Type erasure interface for runtime dispatch
  *   - HL7HandlerWrapper<T>: Bridges CRTP handlers to interface
+ *   - HL7ViewHandlerConcept: Handlers that read hl7_flat_message views
+ *     directly, so lazy-view ingestion never builds an hl7_message
  *
  * @see https://github.com/kcenon/pacs_bridge/issues/202
  * @see https://github.com/kcenon/pacs_bridge/issues/259
  */
 
+#include "pacs/bridge/protocol/hl7/hl7_flat_message.h"
 #include "pacs/bridge/protocol/hl7/hl7_message.h"
 #include "pacs/bridge/protocol/hl7/hl7_types.h"
 
@@ -153,6 +156,23 @@ concept HL7HandlerConcept = requires(T handler, const hl7_message& msg) {
     { T::type_name } -> std::convertible_to<std::string_view>;
 };
 
+/**
+ * @brief Concept for handlers that can process a flat message view
+ *
+ * Such handlers provide handle(const hl7_flat_message&) and implement
+ * can_handle_impl(const hl7_flat_message&), so view-based dispatch reads
+ * the received buffer in place. Other handlers are still dispatched from a
+ * view, but the view is materialized into an hl7_message first.
+ *
+ * @tparam T Handler type to validate
+ */
+template<typename T>
+concept HL7ViewHandlerConcept =
+    HL7HandlerConcept<T> && requires(T handler, const hl7_flat_message& view) {
+        { handler.can_handle(view) } -> std::convertible_to<bool>;
+        handler.handle(view);
+    };
+
 // =============================================================================
 // CRTP Base Class
 // =============================================================================
@@ -196,6 +216,19 @@ public:
         return derived().can_handle_impl(message);
     }
 
+    /**
+     * @brief Check if handler can process the message view
+     *
+     * Only available when the derived class implements
+     * can_handle_impl(const hl7_flat_message&).
+     *
+     * @param message Flat HL7 message view to check
+     * @return true if handler can process this message
+     */
+    [[nodiscard]] bool can_handle(const hl7_flat_message& message) const noexcept {
+        return derived().can_handle_impl(message);
+    }
+
     /**
      * @brief Get the handler type name
      *
@@ -264,6 +297,48 @@ public:
     [[nodiscard]] virtual Result<handler_result> process(
         const hl7_message& message) = 0;
 
+    /**
+     * @brief Check if handler can process the message view
+     *
+     * The default implementation materializes the view; a view that cannot
+     * be materialized is not handled.
+     */
+    [[nodiscard]] virtual bool can_handle(
+        const hl7_flat_message& message) const noexcept {
+        try {
+            auto materialized = message.to_message();
+            return materialized && can_handle(*materialized);
+        } catch (...) {
+            return false;
+        }
+    }
+
+    /**
+     * @brief Process flat HL7 message view
+     *
+     * The default implementation materializes the view and delegates to
+     * process(const hl7_message&).
+     *
+     * @param message Flat HL7 message view to process
+     * @return Generic handler result, or processing_failed if the view
+     *         cannot be materialized
+     */
+    [[nodiscard]] virtual Result<handler_result> process(
+        const hl7_flat_message& message) {
+        auto materialized = message.to_message();
+        if (!materialized) {
+            return Result<handler_result>::err(
+                to_error_info(handler_error::processing_failed,
+                              to_string(materialized.error())));
+        }
+        return process(*materialized);
+    }
+
+    /**
+     * @brief Check if the handler reads views without materializing them
+     */
+    [[nodiscard]] virtual bool supports_view() const noexcept { return false; }
+
     /**
      * @brief Get handler type name
      */
@@ -320,6 +395,18 @@ public:
         return handler_.can_handle(message);
     }
 
+    /**
+     * @brief Check if handler can process the message view
+     */
+    [[nodiscard]] bool can_handle(
+        const hl7_flat_message& message) const noexcept override {
+        if constexpr (HL7ViewHandlerConcept<Handler>) {
+            return handler_.can_handle(message);
+        } else {
+            return IHL7Handler::can_handle(message);
+        }
+    }
+
     /**
      * @brief Process HL7 message using the wrapped handler
      *
@@ -328,22 +415,29 @@ public:
      */
     [[nodiscard]] Result<handler_result> process(
         const hl7_message& message) override {
-        auto result = handler_.handle(message);
-        if (!result.is_ok()) {
-            return Result<handler_result>::err(
-                to_error_info(handler_error::processing_failed,
-                              result.error().message));
-        }
+        return to_generic(handler_.handle(message));
+    }
 
-        // Convert handler-specific result to generic result
-        handler_result generic_result;
-        generic_result.success = result.value().success;
-        generic_result.handler_type = std::string(Handler::type_name);
-        generic_result.description = result.value().description;
-        generic_result.ack_message = result.value().ack_message;
-        generic_result.warnings = result.value().warnings;
+    /**
+     * @brief Process flat message view using the wrapped handler
+     *
+     * View-capable handlers read the view directly; others receive a
+     * materialized hl7_message.
+     */
+    [[nodiscard]] Result<handler_result> process(
+        const hl7_flat_message& message) override {
+        if constexpr (HL7ViewHandlerConcept<Handler>) {
+            return to_generic(handler_.handle(message));
+        } else {
+            return IHL7Handler::process(message);
+        }
+    }
 
-        return generic_result;
+    /**
+     * @brief Check if the wrapped handler reads views directly
+     */
+    [[nodiscard]] bool supports_view() const noexcept override {
+        return HL7ViewHandlerConcept<Handler>;
     }
 
     /**
@@ -368,6 +462,29 @@ public:
     }
 
 private:
+    /**
+     * @brief Convert handler-specific result to the generic handler_result
+     */
+    template<typename HandlerResult>
+    [[nodiscard]] static Result<handler_result> to_generic(
+        HandlerResult result) {
+        if (!result.is_ok()) {
+            return Result<handler_result>::err(
+                to_error_info(handler_error::processing_failed,
+                              result.error().message));
+        }
+
+        // Convert handler-specific result to generic result
+        handler_result generic_result;
+        generic_result.success = result.value().success;
+        generic_result.handler_type = std::string(Handler::type_name);
+        generic_result.description = result.value().description;
+        generic_result.ack_message = result.value().ack_message;
+        generic_result.warnings = result.value().warnings;
+
+        return generic_result;
+    }
+
     Handler handler_;
 };
 
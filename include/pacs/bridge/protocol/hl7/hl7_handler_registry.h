@@ -252,6 +252,33 @@ public:
      */
     [[nodiscard]] bool can_process(const hl7_message& message) const;
 
+    /**
+     * @brief Find handler for a flat message view
+     *
+     * @param message Flat HL7 message view
+     * @return Pointer to handler or nullptr if none found
+     */
+    [[nodiscard]] IHL7Handler* find_handler(
+        const hl7_flat_message& message) const;
+
+    /**
+     * @brief Process a flat message view with the appropriate handler
+     *
+     * Used by lazy-view ingestion. Handlers satisfying
+     * HL7ViewHandlerConcept read the view in place; other handlers receive
+     * a materialized hl7_message (counted in statistics::materialized_count).
+     *
+     * @param message Flat HL7 message view to process
+     * @return Handler result or error
+     */
+    [[nodiscard]] Result<handler_result> process(
+        const hl7_flat_message& message);
+
+    /**
+     * @brief Check if any handler can process the message view
+     */
+    [[nodiscard]] bool can_process(const hl7_flat_message& message) const;
+
     // =========================================================================
     // Statistics
     // =========================================================================
@@ -272,6 +299,9 @@ public:
         /** Messages with no handler */
         size_t no_handler_count = 0;
 
+        /** Views that had to be materialized for a non-view handler */
+        size_t materialized_count = 0;
+
         /** Per-handler statistics */
         std::unordered_map<std::string, size_t> handler_counts;
     };
@@ -287,6 +317,12 @@ public:
     void reset_statistics();
 
 private:
+    template<typename Message>
+    [[nodiscard]] IHL7Handler* find_handler_for(const Message& message) const;
+
+    template<typename Message>
+    [[nodiscard]] Result<handler_result> process_with(const Message& message);
+
     // Handler storage by type name
     std::unordered_map<std::string, std::unique_ptr<IHL7Handler>> handlers_;
 
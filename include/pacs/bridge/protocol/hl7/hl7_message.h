@@ -20,8 +20,10 @@
 
 #include "hl7_types.h"
 
+#include <cstdint>
 #include <expected>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -152,6 +154,19 @@ public:
     }
 
 private:
+    friend class hl7_field;
+
+    /**
+     * @brief Build from data using pre-scanned delimiter offsets
+     * @param data Component data
+     * @param delimiters Delimiter offsets falling inside data
+     * @param offset Offset of data[0] in the scanned buffer
+     * @param encoding Encoding characters
+     */
+    [[nodiscard]] static hl7_component parse_indexed(
+        std::string_view data, std::span<const uint32_t> delimiters,
+        uint32_t offset, const hl7_encoding_characters& encoding);
+
     std::vector<hl7_subcomponent> subcomponents_;
     static const hl7_subcomponent empty_subcomponent_;
 };
@@ -248,6 +263,16 @@ public:
     }
 
 private:
+    friend class hl7_segment;
+
+    /**
+     * @brief Build from data using pre-scanned delimiter offsets
+     * @see hl7_component::parse_indexed
+     */
+    [[nodiscard]] static hl7_field parse_indexed(
+        std::string_view data, std::span<const uint32_t> delimiters,
+        uint32_t offset, const hl7_encoding_characters& encoding);
+
     // Each repetition is a vector of components
     std::vector<std::vector<hl7_component>> repetitions_;
     static const hl7_component empty_component_;
@@ -357,6 +382,16 @@ public:
     [[nodiscard]] auto end() noexcept { return fields_.end(); }
 
 private:
+    friend class hl7_message;
+
+    /**
+     * @brief Build from data using pre-scanned delimiter offsets
+     * @see hl7_component::parse_indexed
+     */
+    [[nodiscard]] static std::expected<hl7_segment, hl7_error> parse_indexed(
+        std::string_view data, std::span<const uint32_t> delimiters,
+        uint32_t offset, const hl7_encoding_characters& encoding);
+
     std::string segment_id_;
     std::vector<hl7_field> fields_;
     static const hl7_field empty_field_;
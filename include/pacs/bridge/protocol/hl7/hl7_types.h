@@ -447,6 +447,35 @@ enum class ack_code {
     return code == ack_code::AA || code == ack_code::CA;
 }
 
+// =============================================================================
+// Ingestion Mode
+// =============================================================================
+
+/**
+ * @brief How inbound messages are represented for routing and handling
+ */
+enum class hl7_ingestion_mode {
+    /** Parse every message into a full hl7_message tree */
+    parsed,
+
+    /**
+     * Route and handle a zero-copy hl7_flat_message view over the receive
+     * buffer; an hl7_message is built only for consumers that need one
+     */
+    lazy_view
+};
+
+/**
+ * @brief Convert ingestion mode to string
+ */
+[[nodiscard]] constexpr const char* to_string(hl7_ingestion_mode mode) noexcept {
+    switch (mode) {
+        case hl7_ingestion_mode::parsed: return "parsed";
+        case hl7_ingestion_mode::lazy_view: return "lazy_view";
+        default: return "parsed";
+    }
+}
+
 // =============================================================================
 // HL7 Date/Time Types
 // =============================================================================
@@ -24,6 +24,7 @@
 
 #include "pacs/bridge/mapping/hl7_dicom_mapper.h"
 #include "pacs/bridge/pacs_adapter/mwl_client.h"
+#include "pacs/bridge/protocol/hl7/hl7_flat_message.h"
 #include "pacs/bridge/protocol/hl7/hl7_handler_base.h"
 #include "pacs/bridge/protocol/hl7/hl7_message.h"
 #include "pacs/bridge/protocol/hl7/hl7_types.h"
@@ -541,6 +542,18 @@ public:
     [[nodiscard]] Result<orm_result> handle(
         const hl7_message& message);
 
+    /**
+     * @brief Handle ORM message view
+     *
+     * Same processing as handle(const hl7_message&), reading the received
+     * buffer in place. Only the ACK is built as an hl7_message.
+     *
+     * @param message Flat HL7 ORM message
+     * @return Processing result or error
+     */
+    [[nodiscard]] Result<orm_result> handle(
+        const hl7_flat_message& message);
+
     // Note: can_handle() is provided by HL7HandlerBase via CRTP
 
     /**
@@ -765,6 +778,48 @@ private:
     [[nodiscard]] bool can_handle_impl(
         const hl7_message& message) const noexcept;
 
+    /**
+     * @brief CRTP implementation for can_handle on a message view
+     */
+    [[nodiscard]] bool can_handle_impl(
+        const hl7_flat_message& message) const noexcept;
+
+    // =========================================================================
+    // Shared implementation for hl7_message and hl7_flat_message input
+    // =========================================================================
+
+    template <typename Message>
+    [[nodiscard]] Result<orm_result> handle_impl(const Message& message);
+
+    template <typename Message>
+    [[nodiscard]] bool can_handle_message(
+        const Message& message) const noexcept;
+
+    template <typename Message>
+    [[nodiscard]] Result<orm_result> handle_new_order_impl(const Message& message);
+
+    template <typename Message>
+    [[nodiscard]] Result<orm_result> handle_change_order_impl(const Message& message);
+
+    template <typename Message>
+    [[nodiscard]] Result<orm_result> handle_cancel_order_impl(const Message& message);
+
+    template <typename Message>
+    [[nodiscard]] Result<orm_result> handle_discontinue_order_impl(const Message& message);
+
+    template <typename Message>
+    [[nodiscard]] Result<orm_result> handle_status_change_impl(const Message& message);
+
+    template <typename Message>
+    [[nodiscard]] Result<order_info> extract_order_info_impl(
+        const Message& message) const;
+
+    template <typename Message>
+    [[nodiscard]] hl7_message generate_ack_impl(
+        const Message& original, bool success,
+        std::string_view error_code = "",
+        std::string_view error_message = "") const;
+
     class impl;
     std::unique_ptr<impl> pimpl_;
 };
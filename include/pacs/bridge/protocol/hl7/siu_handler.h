@@ -23,6 +23,7 @@
 
 #include "pacs/bridge/mapping/hl7_dicom_mapper.h"
 #include "pacs/bridge/pacs_adapter/mwl_client.h"
+#include "pacs/bridge/protocol/hl7/hl7_flat_message.h"
 #include "pacs/bridge/protocol/hl7/hl7_handler_base.h"
 #include "pacs/bridge/protocol/hl7/hl7_message.h"
 #include "pacs/bridge/protocol/hl7/hl7_types.h"
@@ -548,6 +549,18 @@ public:
     [[nodiscard]] Result<siu_result> handle(
         const hl7_message& message);
 
+    /**
+     * @brief Handle SIU message view
+     *
+     * Same processing as handle(const hl7_message&), reading the received
+     * buffer in place. Only the ACK is built as an hl7_message.
+     *
+     * @param message Flat HL7 SIU message
+     * @return Processing result or error
+     */
+    [[nodiscard]] Result<siu_result> handle(
+        const hl7_flat_message& message);
+
     // Note: can_handle() is provided by HL7HandlerBase via CRTP
 
     /**
@@ -758,6 +771,45 @@ private:
     [[nodiscard]] bool can_handle_impl(
         const hl7_message& message) const noexcept;
 
+    /**
+     * @brief CRTP implementation for can_handle on a message view
+     */
+    [[nodiscard]] bool can_handle_impl(
+        const hl7_flat_message& message) const noexcept;
+
+    // =========================================================================
+    // Shared implementation for hl7_message and hl7_flat_message input
+    // =========================================================================
+
+    template <typename Message>
+    [[nodiscard]] Result<siu_result> handle_impl(const Message& message);
+
+    template <typename Message>
+    [[nodiscard]] bool can_handle_message(
+        const Message& message) const noexcept;
+
+    template <typename Message>
+    [[nodiscard]] Result<siu_result> handle_s12_impl(const Message& message);
+
+    template <typename Message>
+    [[nodiscard]] Result<siu_result> handle_s13_impl(const Message& message);
+
+    template <typename Message>
+    [[nodiscard]] Result<siu_result> handle_s14_impl(const Message& message);
+
+    template <typename Message>
+    [[nodiscard]] Result<siu_result> handle_s15_impl(const Message& message);
+
+    template <typename Message>
+    [[nodiscard]] Result<appointment_info> extract_appointment_info_impl(
+        const Message& message) const;
+
+    template <typename Message>
+    [[nodiscard]] hl7_message generate_ack_impl(
+        const Message& original, bool success,
+        std::string_view error_code = "",
+        std::string_view error_message = "") const;
+
     class impl;
     std::unique_ptr<impl> pimpl_;
 };
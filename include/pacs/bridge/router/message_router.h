@@ -11,17 +11,22 @@
  *   - Priority-based routing
  *   - Content-based routing
  *   - Handler chains for message processing
+ *   - Lazy-view ingestion: routing a zero-copy hl7_flat_message and
+ *     building an hl7_message only for handlers that need one
  *
  * @see https://github.com/kcenon/pacs_bridge/issues/19
  * @see docs/reference_materials/07_routing_rules.md
  */
 
+#include "pacs/bridge/mllp/mllp_types.h"
+#include "pacs/bridge/protocol/hl7/hl7_flat_message.h"
 #include "pacs/bridge/protocol/hl7/hl7_message.h"
 #include "pacs/bridge/protocol/hl7/hl7_types.h"
 
 #include <chrono>
 #include <expected>
 #include <functional>
+#include <future>
 #include <memory>
 #include <optional>
 #include <regex>
@@ -29,6 +34,10 @@
 #include <unordered_map>
 #include <vector>
 
+namespace pacs::bridge::integration {
+class thread_adapter;
+}  // namespace pacs::bridge::integration
+
 namespace pacs::bridge::router {
 
 // =============================================================================
@@ -66,7 +75,10 @@ enum class router_error : int {
     message_rejected = -937,
 
     /** Routing timeout */
-    timeout = -938
+    timeout = -938,
+
+    /** Inbound message could not be parsed */
+    invalid_message = -939
 };
 
 /**
@@ -99,6 +111,8 @@ enum class router_error : int {
             return "Message was rejected by filter";
         case router_error::timeout:
             return "Routing operation timed out";
+        case router_error::invalid_message:
+            return "Inbound message could not be parsed";
         default:
             return "Unknown router error";
     }
@@ -205,6 +219,15 @@ struct handler_result {
  */
 using message_handler = std::function<handler_result(const hl7::hl7_message& message)>;
 
+/**
+ * @brief Handler function type that reads a flat message view
+ *
+ * View handlers receive the inbound view directly when routing in
+ * lazy-view mode, so no hl7_message is built on their behalf.
+ */
+using view_handler =
+    std::function<handler_result(const hl7::hl7_flat_message& message)>;
+
 /**
  * @brief Filter function type - returns true to accept message
  */
@@ -214,6 +237,42 @@ using message_filter = std::function<bool(const hl7::hl7_message& message)>;
 // Route Definition
 // =============================================================================
 
+/**
+ * @brief How a matched route's handler chain is executed
+ */
+enum class execution_policy {
+    /** Inline on the routing thread, in priority order (default) */
+    sequential,
+
+    /**
+     * On the router's worker pool after route() has returned; the chain
+     * reads a copy of the message. Use for steps the ACK need not wait for.
+     */
+    async,
+
+    /**
+     * Concurrently with the other parallel routes the message matched;
+     * route() waits for all of them and aggregates their results.
+     */
+    parallel
+};
+
+/**
+ * @brief Get policy name
+ */
+[[nodiscard]] constexpr const char* to_string(execution_policy policy) noexcept {
+    switch (policy) {
+        case execution_policy::sequential:
+            return "sequential";
+        case execution_policy::async:
+            return "async";
+        case execution_policy::parallel:
+            return "parallel";
+        default:
+            return "unknown";
+    }
+}
+
 /**
  * @brief Single routing rule
  */
@@ -236,6 +295,9 @@ struct route {
     /** Stop processing after this route matches */
     bool terminal = false;
 
+    /** How the handler chain runs once the route matches */
+    execution_policy execution = execution_policy::sequential;
+
     /** Handler chain */
     std::vector<std::string> handler_ids;
 
@@ -249,6 +311,14 @@ struct route {
      * @brief Check if route matches a message
      */
     [[nodiscard]] bool matches(const hl7::hl7_message& message) const;
+
+    /**
+     * @brief Check enabled state and pattern against a message header
+     *
+     * Does not apply the filter, which needs the full message.
+     */
+    [[nodiscard]] bool matches_header(
+        const hl7::hl7_message_header& header) const;
 };
 
 // =============================================================================
@@ -262,6 +332,21 @@ struct route {
  * configurable matching rules. Supports priority-based routing,
  * handler chains, and content-based filtering.
  *
+ * Thread safety: configuration changes compile an immutable routing table
+ * that is published by atomic pointer swap. route() reads the current
+ * table without locking, so concurrent calls run their handlers in
+ * parallel; a call in progress keeps the table it started with.
+ *
+ * Execution policies: sequential routes run inline in priority order and
+ * determine route()'s result. Matched parallel routes fan out on the worker
+ * pool once matching is done, with the routing thread taking part, and
+ * route() returns after all of them; any failure fails the call and the
+ * first response (by priority) is used if no sequential route gave one.
+ * Async routes are submitted to the pool and not awaited, so an MLLP ACK can
+ * be sent after the durable sequential step; route_deferred() exposes their
+ * completion. Without a running worker pool, async and parallel chains run
+ * inline.
+ *
  * @example Basic Usage
  * ```cpp
  * message_router router;
@@ -343,6 +428,19 @@ public:
      */
     bool register_handler(std::string_view id, message_handler handler);
 
+    /**
+     * @brief Register a handler that reads flat message views
+     *
+     * Shares the ID namespace with register_handler(). When routing an
+     * hl7_message, a view over its serialized form is built for view
+     * handlers.
+     *
+     * @param id Unique handler identifier
+     * @param handler View handler function
+     * @return true if registered, false if ID already exists
+     */
+    bool register_view_handler(std::string_view id, view_handler handler);
+
     /**
      * @brief Unregister a handler
      *
@@ -368,8 +466,13 @@ public:
     /**
      * @brief Add a routing rule
      *
+     * The route's pattern is compiled here, once; routes with exact
+     * message type, trigger or sender/receiver values are indexed so that
+     * routing does not check every route.
+     *
      * @param r Route to add
-     * @return Success or error
+     * @return Success or error (invalid_pattern if any field's regex is
+     *         invalid)
      */
     [[nodiscard]] std::expected<void, router_error> add_route(const route& r);
 
@@ -391,6 +494,9 @@ public:
 
     /**
      * @brief Get route by ID
+     *
+     * The pointer stays valid until the route is removed or
+     * set_route_enabled() replaces it; copy the route to keep it longer.
      */
     [[nodiscard]] const route* get_route(std::string_view route_id) const;
 
@@ -404,10 +510,36 @@ public:
      */
     void clear_routes();
 
+    // =========================================================================
+    // Execution
+    // =========================================================================
+
+    /**
+     * @brief Set the worker pool for async and parallel routes
+     *
+     * @param pool Initialized pool, or nullptr to run every chain inline
+     */
+    void set_worker_pool(std::shared_ptr<integration::thread_adapter> pool);
+
     // =========================================================================
     // Message Routing
     // =========================================================================
 
+    /**
+     * @brief Routing result with async routes possibly still running
+     */
+    struct deferred_result {
+        /** Result of the sequential and parallel routes */
+        std::expected<handler_result, router_error> result;
+
+        /**
+         * Completes when every async route dispatched for the message has
+         * finished; handler_error if any of them failed. Ready at once if
+         * none was dispatched.
+         */
+        std::future<std::expected<void, router_error>> completion;
+    };
+
     /**
      * @brief Route a message to matching handlers
      *
@@ -417,6 +549,55 @@ public:
     [[nodiscard]] std::expected<handler_result, router_error> route(
         const hl7::hl7_message& message) const;
 
+    /**
+     * @brief Route a flat message view to matching handlers
+     *
+     * Matching reads MSH from the view. An hl7_message is materialized
+     * (once per call) only if a matched route has a filter or a handler
+     * registered with register_handler(); see
+     * statistics::materialized_messages.
+     *
+     * @param message Flat HL7 message view to route
+     * @return Handler result or error
+     */
+    [[nodiscard]] std::expected<handler_result, router_error> route(
+        const hl7::hl7_flat_message& message) const;
+
+    /**
+     * @brief Route a received MLLP message using the given ingestion mode
+     *
+     * parsed builds an hl7_message from the content; lazy_view routes a
+     * view borrowed from mllp_message::content without copying it.
+     *
+     * @param message Received MLLP message
+     * @param mode Ingestion mode chosen by the owner of the listener
+     * @return Handler result or error (invalid_message if parsing fails)
+     */
+    [[nodiscard]] std::expected<handler_result, router_error> route(
+        const mllp::mllp_message& message,
+        hl7::hl7_ingestion_mode mode) const;
+
+    /**
+     * @brief Route a message, returning the completion of its async routes
+     *
+     * @param message HL7 message to route
+     * @return Routing result and async completion
+     */
+    [[nodiscard]] deferred_result route_deferred(
+        const hl7::hl7_message& message) const;
+
+    /**
+     * @brief Route a flat message view, returning the completion of its
+     *        async routes
+     *
+     * Async routes read an owned copy of the view's bytes.
+     *
+     * @param message Flat HL7 message view to route
+     * @return Routing result and async completion
+     */
+    [[nodiscard]] deferred_result route_deferred(
+        const hl7::hl7_flat_message& message) const;
+
     /**
      * @brief Find matching routes for a message (without executing)
      *
@@ -471,6 +652,12 @@ public:
         /** Handler errors */
         size_t handler_errors = 0;
 
+        /** Views routed that had to be materialized into an hl7_message */
+        size_t materialized_messages = 0;
+
+        /** Handler chains submitted to the worker pool by async routes */
+        size_t async_chains = 0;
+
         /** Per-route match counts */
         std::unordered_map<std::string, size_t> route_matches;
     };
@@ -639,6 +826,9 @@ public:
     /** Set as terminal route */
     route_builder& terminal(bool t = true);
 
+    /** Set handler chain execution policy */
+    route_builder& execution(execution_policy policy);
+
     /** Add content filter */
     route_builder& filter(message_filter f);
 
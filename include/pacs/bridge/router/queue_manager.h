@@ -157,6 +157,52 @@ enum class message_state {
 // Queue Configuration
 // =============================================================================
 
+/**
+ * @brief How queue operations are persisted
+ */
+enum class queue_persistence {
+    /** Every operation is its own SQLite statement */
+    direct,
+    /**
+     * Messages are served from an in-memory tier; a background writer
+     * group-commits changes. enqueue() returns once its message is committed,
+     * while ack/nack/dequeue do not wait.
+     */
+    hot_tier,
+    /**
+     * Like hot_tier, but group commits are appended to memory-mapped segment
+     * files in segment_directory instead of SQLite. The in-memory index is
+     * rebuilt from the segments on start, and sealed segments whose records
+     * are mostly acknowledged are compacted in the background. POSIX only.
+     */
+    segmented_log
+};
+
+/**
+ * @brief Durability of committed writes
+ *
+ * SQLite synchronous level for hot_tier; for segmented_log, when mapped
+ * segments are flushed to disk.
+ */
+enum class queue_sync_mode {
+    /** No fsync; commits survive a process crash but not power loss */
+    off,
+    /** fsync at WAL checkpoints (segmented_log: when a segment is sealed) */
+    normal,
+    /** fsync on every commit */
+    full
+};
+
+/**
+ * @brief Storage format of queue timestamp columns
+ */
+enum class queue_timestamp_format {
+    /** ISO 8601 text */
+    text,
+    /** Integer microseconds since the epoch; range scans compare integers */
+    epoch_micros
+};
+
 /**
  * @brief Queue manager configuration
  */
@@ -185,7 +231,7 @@ struct queue_config {
     /** Number of worker threads for delivery */
     size_t worker_count = 4;
 
-    /** Batch size for dequeue operations */
+    /** Number of messages each worker claims per dequeue */
     size_t batch_size = 10;
 
     /** Interval for cleanup of expired messages */
@@ -194,6 +240,34 @@ struct queue_config {
     /** Enable WAL mode for better concurrent access */
     bool enable_wal_mode = true;
 
+    /** How operations are persisted */
+    queue_persistence persistence = queue_persistence::direct;
+
+    /** Hot tier: longest a non-enqueue write waits before it is committed */
+    std::chrono::milliseconds group_commit_interval{5};
+
+    /** Hot tier: commit early once this many writes are pending */
+    size_t group_commit_max_batch = 512;
+
+    /**
+     * Hot tier: consecutive failed commits after which writes waiting for
+     * durability (enqueue, dead letter retry) fail with database_error.
+     * Failed batches keep being retried in the background.
+     */
+    size_t group_commit_max_attempts = 5;
+
+    /** Hot tier: synchronous level of group commits */
+    queue_sync_mode sync_mode = queue_sync_mode::normal;
+
+    /** Segmented log: directory holding the segment files */
+    std::string segment_directory = "queue_segments";
+
+    /** Segmented log: size of each segment file in bytes */
+    size_t segment_size = 64 * 1024 * 1024;
+
+    /** Timestamp column format of newly created tables; existing tables keep theirs */
+    queue_timestamp_format timestamp_format = queue_timestamp_format::text;
+
 #ifndef PACS_BRIDGE_STANDALONE_BUILD
     /** Optional executor for worker and cleanup task execution (nullptr = use internal std::thread) */
     std::shared_ptr<kcenon::common::interfaces::IExecutor> executor;
@@ -208,6 +282,12 @@ struct queue_config {
         if (max_retry_count == 0) return false;
         if (worker_count == 0) return false;
         if (retry_backoff_multiplier < 1.0) return false;
+        if (group_commit_max_batch == 0) return false;
+        if (group_commit_max_attempts == 0) return false;
+        if (persistence == queue_persistence::segmented_log) {
+            if (segment_directory.empty()) return false;
+            if (segment_size < 4096) return false;
+        }
         return true;
     }
 };
@@ -500,6 +580,10 @@ public:
     /**
      * @brief Dequeue multiple messages for batch processing
      *
+     * Claims up to count ready messages in one atomic statement, so
+     * concurrent callers never receive the same message. Messages are
+     * returned in priority order with state 'processing'.
+     *
      * @param count Maximum number of messages to dequeue
      * @param destination Optional destination filter
      * @return List of messages ready for delivery
@@ -552,6 +636,8 @@ public:
      *
      * Workers continuously dequeue messages and call the sender function
      * for delivery. On success, messages are acked. On failure, nacked.
+     * Idle workers sleep until a message is enqueued or a scheduled retry
+     * becomes due; the database is not polled.
      *
      * @param sender Function to send messages
      */
@@ -790,6 +876,20 @@ public:
     /** Enable/disable WAL mode */
     queue_config_builder& wal_mode(bool enable);
 
+    /** Serve messages from memory with group-committed persistence */
+    queue_config_builder& hot_tier(std::chrono::milliseconds commit_interval,
+                                   size_t max_batch = 512);
+
+    /** Persist to append-only segment files in directory */
+    queue_config_builder& segmented_log(std::string_view directory,
+                                        size_t segment_size = 64 * 1024 * 1024);
+
+    /** Set synchronous level of group commits */
+    queue_config_builder& sync_mode(queue_sync_mode mode);
+
+    /** Set timestamp column format of newly created tables */
+    queue_config_builder& timestamp_format(queue_timestamp_format format);
+
     /** Build the configuration */
     [[nodiscard]] queue_config build() const;
 
@@ -624,6 +624,10 @@ public:
     /** Set message TTL */
     reliable_sender_config_builder& ttl(std::chrono::hours ttl);
 
+    /** Persist the queue to append-only segment files in directory */
+    reliable_sender_config_builder& segmented_log(std::string_view directory,
+                                                  size_t segment_size = 64 * 1024 * 1024);
+
     /** Add a destination */
     reliable_sender_config_builder& add_destination(const outbound_destination& dest);
 
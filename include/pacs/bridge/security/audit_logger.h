@@ -262,6 +262,17 @@ struct healthcare_audit_event_record {
 // Healthcare Audit Configuration
 // =============================================================================
 
+/**
+ * @brief How far written audit events are pushed towards stable storage
+ */
+enum class audit_durability {
+    /** Each write is handed to the OS; survives a process crash */
+    buffered,
+
+    /** fdatasync after each write; survives power loss */
+    data_sync
+};
+
 /**
  * @brief Healthcare audit logging configuration
  */
@@ -281,9 +292,43 @@ struct healthcare_audit_config {
     /** Maximum log file size before rotation (bytes) */
     size_t max_file_size = 100 * 1024 * 1024;  // 100MB
 
-    /** Number of rotated files to keep */
+    /** Also rotate once the current file is this old (0 = size only) */
+    std::chrono::seconds rotation_interval{0};
+
+    /**
+     * Rotated files always kept when pruning (log_path.1 is the newest)
+     *
+     * Rotation never deletes on its own: without prune_rotated_files every
+     * rotated file is kept.
+     */
     size_t max_rotated_files = 10;
 
+    /**
+     * Delete rotated files beyond max_rotated_files once they are older
+     * than retention_period. Off by default, since audit records must
+     * outlive the retention period; archive them elsewhere before enabling.
+     */
+    bool prune_rotated_files = false;
+
+    /**
+     * Queue events for a background writer thread instead of writing on
+     * the caller's thread. Events are never dropped: a producer that finds
+     * the queue full waits for the writer.
+     */
+    bool async_writes = false;
+
+    /** Async: queued events before producers wait (rounded up to 2^n) */
+    size_t async_queue_capacity = 8192;
+
+    /** Async: longest an event stays queued before it is written */
+    std::chrono::milliseconds flush_interval{10};
+
+    /** Async: write as soon as this many events are queued */
+    size_t flush_batch_size = 256;
+
+    /** Durability of each write (per event when sync, per batch when async) */
+    audit_durability durability = audit_durability::buffered;
+
     /** Retention period for audit logs (HIPAA: 6-7 years) */
     std::chrono::hours retention_period{24 * 365 * 7};  // 7 years
 
@@ -327,6 +372,19 @@ struct healthcare_audit_config {
  * logger.log_hl7_processed("MSG001", true, 15.5);
  * ```
  *
+ * @example Asynchronous Writes
+ * ```cpp
+ * healthcare_audit_config config;
+ * config.async_writes = true;
+ * config.flush_interval = std::chrono::milliseconds{5};
+ * config.durability = audit_durability::data_sync;
+ *
+ * healthcare_audit_logger logger(config);
+ * logger.start();
+ * logger.log_hl7_received("ADT^A01", "MSG001", "PACS", 1024, session_id);
+ * logger.flush();  // returns once the event is on disk
+ * ```
+ *
  * @example Builder Pattern
  * ```cpp
  * logger.log_event(healthcare_audit_category::security,
@@ -412,6 +470,9 @@ public:
 
     /**
      * @brief Flush pending log entries
+     *
+     * In async mode, blocks until every event logged before the call has
+     * been written.
      */
     void flush();
 
@@ -424,6 +485,11 @@ public:
      */
     void log(const healthcare_audit_event_record& event);
 
+    /**
+     * @brief Log an audit event, moving it into the async queue
+     */
+    void log(healthcare_audit_event_record&& event);
+
     /**
      * @brief Begin building an event with fluent API
      */
@@ -571,6 +637,11 @@ public:
         size_t security_events = 0;
         size_t error_events = 0;
         size_t bytes_written = 0;
+        size_t batches_written = 0;
+        size_t rotations = 0;
+        size_t write_failures = 0;
+        /** Async: times a producer waited because the queue was full */
+        size_t queue_full_waits = 0;
         std::chrono::system_clock::time_point started_at;
         std::chrono::system_clock::time_point last_event_at;
     };
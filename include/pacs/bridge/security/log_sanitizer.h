@@ -219,13 +219,20 @@ struct phi_detection {
  * Extends the base log_sanitizer from logger_system with healthcare-specific
  * patterns for PHI detection and HL7 message awareness.
  *
+ * Redaction is one linear pass without std::regex. HL7 segments listed in
+ * phi_segments are masked by field position (PID-5, PID-7, PID-19, ...);
+ * other text goes through fixed recognizers for MRNs, HL7 names, SSNs,
+ * phone numbers, emails, YYYYMMDD birth dates and street addresses,
+ * dispatched from a table compiled when the configuration is set. Only
+ * add_custom_pattern() patterns use std::regex.
+ *
  * @example Basic Usage
  * ```cpp
  * healthcare_log_sanitizer sanitizer;
  *
- * std::string log_line = "Patient John Doe (MRN: 12345) admitted";
+ * std::string log_line = "Patient MRN: A12345 admitted";
  * std::string safe_log = sanitizer.sanitize(log_line);
- * // Result: "Patient [PATIENT_NAME] (MRN: [PATIENT_ID]) admitted"
+ * // Result: "Patient MRN=[PATIENT_ID] admitted"
  * ```
  *
  * @example HL7 Message Sanitization
@@ -264,24 +271,42 @@ public:
     /**
      * @brief Sanitize free-text content
      *
-     * Uses both base sanitizer patterns and healthcare-specific patterns.
+     * Lines that are HL7 PHI segments are masked by field position as in
+     * sanitize_hl7(); everything else goes through the free-text
+     * recognizers, then any custom patterns.
      *
      * @param content Content to sanitize
      * @return Sanitized content
      */
     [[nodiscard]] std::string sanitize(std::string_view content) const;
 
+    /**
+     * @brief Append sanitized free-text content to out
+     *
+     * Same result as sanitize(), without allocating when out has capacity.
+     */
+    void sanitize_to(std::string_view content, std::string& out) const;
+
     /**
      * @brief Sanitize HL7 message content
      *
-     * Uses HL7 structure awareness to mask PHI in specific segments
-     * and fields defined in the configuration.
+     * Masks the PHI fields of each segment in phi_segments by position
+     * (e.g. PID-3, PID-5, PID-7, PID-11, PID-19; NK1, GT1, IN1 and IN2
+     * likewise). A configured segment with no built-in field map has every
+     * field masked, and MSH-10 is masked when sanitize_control_id is set.
+     * Other segments are copied unchanged. The field separator is taken
+     * from MSH.
      *
      * @param hl7_message HL7 message content
      * @return Sanitized HL7 message
      */
     [[nodiscard]] std::string sanitize_hl7(std::string_view hl7_message) const;
 
+    /**
+     * @brief Append sanitized HL7 message content to out
+     */
+    void sanitize_hl7_to(std::string_view hl7_message, std::string& out) const;
+
     /**
      * @brief Sanitize and detect PHI
      *
@@ -358,6 +383,11 @@ public:
 
     /**
      * @brief Add custom pattern for detection
+     *
+     * Custom patterns are std::regex and run over sanitize() output after
+     * the built-in pass, so each one adds a regex pass per call. They are
+     * kept across set_config().
+     *
      * @param pattern Regex pattern
      * @param replacement Replacement text
      */
@@ -0,0 +1,320 @@
+/**
+ * @file cache_snapshot.cpp
+ * @brief Versioned, checksummed snapshot files for warm cache restarts
+ *
+ * @see include/pacs/bridge/cache/cache_snapshot.h
+ */
+
+#include "pacs/bridge/cache/cache_snapshot.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace pacs::bridge::cache {
+
+namespace {
+
+constexpr char snapshot_magic[8] = {'P', 'B', 'C', 'S', 'N', 'A', 'P', '1'};
+constexpr uint32_t snapshot_version = 1;
+constexpr size_t header_size = 48;
+constexpr size_t header_crc_offset = header_size - 4;
+constexpr size_t flush_threshold = size_t{1} << 20;
+
+void sync_directory([[maybe_unused]] const std::filesystem::path& directory) noexcept {
+#ifndef _WIN32
+    int fd = ::open(directory.empty() ? "." : directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+#endif
+}
+
+/**
+ * @brief Create or truncate path for writing, readable by the owner only
+ *
+ * Snapshots hold patient demographics in the clear, so the file must not
+ * pick up the process umask.
+ */
+std::FILE* open_private(const std::filesystem::path& path) noexcept {
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_CREAT | O_TRUNC | O_WRONLY | O_CLOEXEC, 0600);
+    if (fd < 0) {
+        return nullptr;
+    }
+    // The mode only applies on creation; tighten a leftover temp file too
+    std::FILE* file = ::fchmod(fd, 0600) == 0 ? ::fdopen(fd, "wb") : nullptr;
+    if (file == nullptr) {
+        ::close(fd);
+    }
+    return file;
+#else
+    // Windows files inherit the directory's ACL
+    return std::fopen(path.string().c_str(), "wb");
+#endif
+}
+
+}  // namespace
+
+// =============================================================================
+// snapshot_writer
+// =============================================================================
+
+snapshot_writer::snapshot_writer(std::FILE* file, std::filesystem::path path,
+                                 snapshot_kind kind)
+    : file_(file), path_(std::move(path)), kind_(kind) {
+    temp_path_ = path_;
+    temp_path_ += ".tmp";
+    buffer_.reserve(flush_threshold + 4096);
+}
+
+std::expected<snapshot_writer, cache_error> snapshot_writer::create(
+    const std::filesystem::path& path, snapshot_kind kind) {
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), ec);
+        if (ec) {
+            return std::unexpected(cache_error::snapshot_io_error);
+        }
+    }
+
+    auto temp_path = path;
+    temp_path += ".tmp";
+    std::FILE* file = open_private(temp_path);
+    if (file == nullptr) {
+        return std::unexpected(cache_error::snapshot_io_error);
+    }
+
+    // Header placeholder, rewritten by commit() once the payload is known
+    const uint8_t zeros[header_size] = {};
+    if (std::fwrite(zeros, 1, header_size, file) != header_size) {
+        std::fclose(file);
+        std::filesystem::remove(temp_path, ec);
+        return std::unexpected(cache_error::snapshot_io_error);
+    }
+    return snapshot_writer(file, path, kind);
+}
+
+snapshot_writer::~snapshot_writer() { close(); }
+
+snapshot_writer::snapshot_writer(snapshot_writer&& other) noexcept
+    : file_(std::exchange(other.file_, nullptr)),
+      path_(std::move(other.path_)),
+      temp_path_(std::exchange(other.temp_path_, {})),
+      kind_(other.kind_),
+      record_count_(other.record_count_),
+      payload_size_(other.payload_size_),
+      payload_crc_(other.payload_crc_),
+      failed_(other.failed_),
+      buffer_(std::move(other.buffer_)),
+      record_(std::move(other.record_)) {}
+
+snapshot_writer& snapshot_writer::operator=(snapshot_writer&& other) noexcept {
+    if (this != &other) {
+        close();
+        file_ = std::exchange(other.file_, nullptr);
+        path_ = std::move(other.path_);
+        temp_path_ = std::exchange(other.temp_path_, {});
+        kind_ = other.kind_;
+        record_count_ = other.record_count_;
+        payload_size_ = other.payload_size_;
+        payload_crc_ = other.payload_crc_;
+        failed_ = other.failed_;
+        buffer_ = std::move(other.buffer_);
+        record_ = std::move(other.record_);
+    }
+    return *this;
+}
+
+void snapshot_writer::append_record() {
+    internal::field_writer frame(buffer_);
+    frame.u32(static_cast<uint32_t>(record_.size()));
+    buffer_.insert(buffer_.end(), record_.begin(), record_.end());
+    payload_size_ += 4 + record_.size();
+    ++record_count_;
+    if (buffer_.size() >= flush_threshold) {
+        flush();
+    }
+}
+
+void snapshot_writer::flush() {
+    if (!failed_ && !buffer_.empty()) {
+        payload_crc_ = internal::crc32(buffer_.data(), buffer_.size(), payload_crc_);
+        failed_ = std::fwrite(buffer_.data(), 1, buffer_.size(), file_) != buffer_.size();
+    }
+    buffer_.clear();
+}
+
+void snapshot_writer::close() {
+    if (file_ != nullptr) {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+    if (!temp_path_.empty()) {
+        std::error_code ec;
+        std::filesystem::remove(temp_path_, ec);
+        temp_path_.clear();
+    }
+}
+
+std::expected<size_t, cache_error> snapshot_writer::commit() {
+    if (file_ == nullptr) {
+        return std::unexpected(cache_error::snapshot_io_error);
+    }
+    flush();
+
+    std::vector<uint8_t> header(std::begin(snapshot_magic), std::end(snapshot_magic));
+    internal::field_writer fields(header);
+    fields.u32(snapshot_version);
+    fields.u32(static_cast<uint32_t>(kind_));
+    fields.time(std::chrono::system_clock::now());
+    fields.u64(record_count_);
+    fields.u64(payload_size_);
+    fields.u32(payload_crc_);
+    fields.u32(internal::crc32(header.data(), header.size()));
+
+    bool ok = !failed_ && std::fseek(file_, 0, SEEK_SET) == 0 &&
+              std::fwrite(header.data(), 1, header.size(), file_) == header.size() &&
+              std::fflush(file_) == 0;
+#ifndef _WIN32
+    ok = ok && ::fsync(::fileno(file_)) == 0;
+#endif
+    ok = std::fclose(file_) == 0 && ok;
+    file_ = nullptr;
+    if (!ok) {
+        return std::unexpected(cache_error::snapshot_io_error);
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temp_path_, path_, ec);
+    if (ec) {
+        return std::unexpected(cache_error::snapshot_io_error);
+    }
+    temp_path_.clear();
+    sync_directory(path_.parent_path());
+    return static_cast<size_t>(record_count_);
+}
+
+// =============================================================================
+// snapshot_reader
+// =============================================================================
+
+std::expected<snapshot_reader, cache_error> snapshot_reader::open(
+    const std::filesystem::path& path, snapshot_kind kind) {
+    snapshot_reader reader;
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return std::unexpected(cache_error::snapshot_io_error);
+    }
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return std::unexpected(cache_error::snapshot_io_error);
+    }
+    size = static_cast<size_t>(st.st_size);
+    if (size < header_size) {
+        ::close(fd);
+        return std::unexpected(cache_error::serialization_error);
+    }
+    void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        return std::unexpected(cache_error::snapshot_io_error);
+    }
+    ::madvise(mapped, size, MADV_SEQUENTIAL);
+    reader.mapping_ = mapped;
+    reader.mapping_size_ = size;
+    data = static_cast<const uint8_t*>(mapped);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return std::unexpected(cache_error::snapshot_io_error);
+    }
+    reader.contents_.assign(std::istreambuf_iterator<char>(file),
+                            std::istreambuf_iterator<char>());
+    data = reader.contents_.data();
+    size = reader.contents_.size();
+    if (size < header_size) {
+        return std::unexpected(cache_error::serialization_error);
+    }
+#endif
+
+    internal::field_reader header(data + sizeof(snapshot_magic),
+                                  header_size - sizeof(snapshot_magic));
+    uint32_t version = header.u32();
+    uint32_t file_kind = header.u32();
+    auto written_at = header.time();
+    uint64_t record_count = header.u64();
+    uint64_t payload_size = header.u64();
+    uint32_t payload_crc = header.u32();
+    uint32_t header_crc = header.u32();
+
+    if (std::memcmp(data, snapshot_magic, sizeof(snapshot_magic)) != 0 ||
+        internal::crc32(data, header_crc_offset) != header_crc ||
+        version != snapshot_version ||
+        file_kind != static_cast<uint32_t>(kind) ||
+        payload_size != size - header_size ||
+        internal::crc32(data + header_size, payload_size) != payload_crc) {
+        return std::unexpected(cache_error::serialization_error);
+    }
+
+    reader.payload_ = data + header_size;
+    reader.payload_size_ = payload_size;
+    reader.record_count_ = record_count;
+    reader.written_at_ = written_at;
+    return reader;
+}
+
+snapshot_reader::~snapshot_reader() { release(); }
+
+snapshot_reader::snapshot_reader(snapshot_reader&& other) noexcept
+    : mapping_(std::exchange(other.mapping_, nullptr)),
+      mapping_size_(std::exchange(other.mapping_size_, 0)),
+      contents_(std::move(other.contents_)),
+      payload_(std::exchange(other.payload_, nullptr)),
+      payload_size_(std::exchange(other.payload_size_, 0)),
+      record_count_(std::exchange(other.record_count_, 0)),
+      written_at_(other.written_at_) {}
+
+snapshot_reader& snapshot_reader::operator=(snapshot_reader&& other) noexcept {
+    if (this != &other) {
+        release();
+        mapping_ = std::exchange(other.mapping_, nullptr);
+        mapping_size_ = std::exchange(other.mapping_size_, 0);
+        contents_ = std::move(other.contents_);
+        payload_ = std::exchange(other.payload_, nullptr);
+        payload_size_ = std::exchange(other.payload_size_, 0);
+        record_count_ = std::exchange(other.record_count_, 0);
+        written_at_ = other.written_at_;
+    }
+    return *this;
+}
+
+void snapshot_reader::release() noexcept {
+#ifndef _WIN32
+    if (mapping_ != nullptr) {
+        ::munmap(mapping_, mapping_size_);
+    }
+#endif
+    mapping_ = nullptr;
+    mapping_size_ = 0;
+    payload_ = nullptr;
+    payload_size_ = 0;
+    record_count_ = 0;
+}
+
+}  // namespace pacs::bridge::cache
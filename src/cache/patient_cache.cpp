@@ -4,8 +4,15 @@
  */
 
 #include "pacs/bridge/cache/patient_cache.h"
+#include "pacs/bridge/cache/cache_snapshot.h"
+#include "pacs/bridge/internal/background_worker.h"
+#include "pacs/bridge/internal/sharded_counter.h"
+#include "pacs/bridge/internal/single_flight.h"
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <limits>
 #include <list>
 #include <mutex>
 #include <shared_mutex>
@@ -194,255 +201,728 @@ size_t lru_cache<K, V>::evict_expired() {
 // Explicit template instantiations
 template class lru_cache<std::string, mapping::dicom_patient>;
 
+
 // =============================================================================
 // patient_cache Implementation
 // =============================================================================
 
+namespace {
+
+using patient_ptr = std::shared_ptr<const mapping::dicom_patient>;
+using patient_loader = std::function<std::optional<mapping::dicom_patient>()>;
+using clock_type = std::chrono::system_clock;
+
+/**
+ * @brief Heterogeneous string hash for string_view lookups
+ */
+struct string_hash {
+    using is_transparent = void;
+    size_t operator()(std::string_view value) const noexcept {
+        return std::hash<std::string_view>{}(value);
+    }
+};
+
+template <typename Value>
+using string_map =
+    std::unordered_map<std::string, Value, string_hash, std::equal_to<>>;
+
+/**
+ * @brief Snapshot record types
+ */
+enum class snapshot_record : uint8_t { entry = 1, alias = 2 };
+
+void write_patient(internal::field_writer& w, const mapping::dicom_patient& patient) {
+    w.str(patient.patient_id);
+    w.str(patient.issuer_of_patient_id);
+    w.str(patient.patient_name);
+    w.str(patient.patient_birth_date);
+    w.str(patient.patient_sex);
+    w.u8(patient.patient_weight.has_value() ? 1 : 0);
+    if (patient.patient_weight) w.f64(*patient.patient_weight);
+    w.u8(patient.patient_size.has_value() ? 1 : 0);
+    if (patient.patient_size) w.f64(*patient.patient_size);
+    w.u32(static_cast<uint32_t>(patient.other_patient_ids.size()));
+    for (const auto& id : patient.other_patient_ids) {
+        w.str(id);
+    }
+    w.str(patient.patient_comments);
+}
+
+mapping::dicom_patient read_patient(internal::field_reader& r) {
+    mapping::dicom_patient patient;
+    patient.patient_id = r.str();
+    patient.issuer_of_patient_id = r.str();
+    patient.patient_name = r.str();
+    patient.patient_birth_date = r.str();
+    patient.patient_sex = r.str();
+    if (r.u8() != 0) patient.patient_weight = r.f64();
+    if (r.u8() != 0) patient.patient_size = r.f64();
+    const uint32_t ids = r.u32();
+    for (uint32_t i = 0; i < ids && r.ok(); ++i) {
+        patient.other_patient_ids.push_back(r.str());
+    }
+    patient.patient_comments = r.str();
+    return patient;
+}
+
+constexpr size_t max_shards = 16;
+constexpr size_t min_entries_per_shard = 64;
+constexpr size_t eviction_sample = 8;
+
+size_t shard_count_for(const patient_cache_config& config) noexcept {
+    size_t count = config.shard_count;
+    if (count == 0) {
+        count = std::min(max_shards, config.max_entries / min_entries_per_shard);
+    }
+    // Every shard must be able to hold an entry
+    count = std::min(count, config.max_entries);
+    return std::bit_floor(std::max<size_t>(count, 1));
+}
+
+}  // namespace
+
 class patient_cache::impl {
 public:
-    struct cache_entry {
-        mapping::dicom_patient patient;
-        cache_entry_metadata metadata;
+    struct node {
+        const std::string* key = nullptr;  // the shard map's key
+        patient_ptr patient;
+        clock_type::time_point created_at;
+        std::chrono::seconds ttl{0};
+        size_t slot = 0;  // position in shard::slots
+
+        // Written by hits under the shard's shared lock
+        std::atomic<uint64_t> last_use{0};
+        std::atomic<clock_type::rep> last_accessed{0};
+        std::atomic<size_t> access_count{0};
+
+        [[nodiscard]] bool is_expired(clock_type::time_point now) const noexcept {
+            return (now - created_at) > ttl;
+        }
+
+        [[nodiscard]] cache_entry_metadata metadata() const {
+            cache_entry_metadata result;
+            result.created_at = created_at;
+            result.last_accessed = clock_type::time_point(clock_type::duration(
+                last_accessed.load(std::memory_order_relaxed)));
+            result.ttl = ttl;
+            result.access_count = access_count.load(std::memory_order_relaxed);
+            return result;
+        }
     };
 
-    using list_type = std::list<std::string>;  // Keys in LRU order
-    using list_iterator = list_type::iterator;
+    struct alignas(64) shard {
+        std::shared_mutex mutex;
+        std::atomic<uint64_t> tick{0};  // recency clock, advanced by hits
+        string_map<node> entries;
+        string_map<std::string> aliases;  // alias -> primary key
+        std::vector<node*> slots;         // entries, for eviction sampling
+        uint64_t random = 0x9E3779B97F4A7C15ULL;
+        size_t capacity = 0;
+    };
 
     patient_cache_config config_;
-    std::unordered_map<std::string, cache_entry> entries_;
-    std::unordered_map<std::string, std::string> aliases_;  // alias -> primary key
-    list_type lru_order_;
-    std::unordered_map<std::string, list_iterator> lru_index_;
-    mutable std::shared_mutex mutex_;
-    mutable statistics stats_;
-
-    explicit impl(const patient_cache_config& config) : config_(config) {}
+    std::atomic<bool> enabled_;
+    size_t shard_mask_;
+    std::unique_ptr<shard[]> shards_;
+    std::atomic<size_t> size_{0};
+
+    internal::sharded_counter get_count_;
+    internal::sharded_counter hit_count_;
+    internal::sharded_counter miss_count_;
+    internal::sharded_counter expired_count_;
+    internal::sharded_counter put_count_;
+    internal::sharded_counter remove_count_;
+    internal::sharded_counter eviction_count_;
+    internal::sharded_counter load_count_;
+    internal::sharded_counter coalesced_count_;
+    internal::sharded_counter refresh_count_;
+    internal::sharded_counter restored_count_;
+    std::atomic<size_t> max_size_reached_{0};
+
+    internal::single_flight<patient_ptr> loads_;
+    // Declared last: stopped before the state their tasks use is destroyed
+    internal::background_worker refresher_;
+    internal::background_worker snapshotter_;
+
+    explicit impl(const patient_cache_config& config)
+        : config_(config), enabled_(config.enabled) {
+        size_t count = shard_count_for(config);
+        shard_mask_ = count - 1;
+        shards_ = std::make_unique<shard[]>(count);
+        for (size_t i = 0; i < count; ++i) {
+            size_t share = config.max_entries / count +
+                           (i < config.max_entries % count ? 1 : 0);
+            shards_[i].capacity = std::max<size_t>(share, 1);
+        }
 
-    void update_lru(const std::string& key) {
-        auto it = lru_index_.find(key);
-        if (it != lru_index_.end()) {
-            lru_order_.erase(it->second);
+        if (!config_.snapshot_path.empty()) {
+            snapshotter_.post([this] { (void)load_snapshot(config_.snapshot_path); });
+            schedule_snapshot();
         }
-        lru_order_.push_front(key);
-        lru_index_[key] = lru_order_.begin();
     }
 
-    void remove_from_lru(const std::string& key) {
-        auto it = lru_index_.find(key);
-        if (it != lru_index_.end()) {
-            lru_order_.erase(it->second);
-            lru_index_.erase(it);
-        }
+    [[nodiscard]] size_t shard_count() const noexcept { return shard_mask_ + 1; }
+
+    shard& shard_for(std::string_view key) noexcept {
+        // The upper hash bits pick the shard, the map inside buckets by all
+        size_t hash = string_hash{}(key);
+        return shards_[(hash >> (std::numeric_limits<size_t>::digits / 2)) &
+                       shard_mask_];
     }
 
-    std::string resolve_key(std::string_view key) const {
-        std::string key_str(key);
-        auto alias_it = aliases_.find(key_str);
-        if (alias_it != aliases_.end()) {
-            return alias_it->second;
+    /**
+     * @brief Call fn(shard, entry-or-nullptr) for key, resolving an alias,
+     *        under the owning shard's shared lock
+     */
+    template <typename Fn>
+    auto with_entry(std::string_view key, Fn&& fn) {
+        std::string primary;
+        {
+            shard& s = shard_for(key);
+            std::shared_lock lock(s.mutex);
+            auto alias = s.aliases.find(key);
+            if (alias == s.aliases.end()) {
+                auto it = s.entries.find(key);
+                return fn(s, it == s.entries.end() ? nullptr : &it->second);
+            }
+            primary = alias->second;
         }
-        return key_str;
+        shard& s = shard_for(primary);
+        std::shared_lock lock(s.mutex);
+        auto it = s.entries.find(primary);
+        return fn(s, it == s.entries.end() ? nullptr : &it->second);
     }
 
-    void evict_lru_if_needed() {
-        while (entries_.size() >= config_.max_entries && !lru_order_.empty()) {
-            const std::string& oldest_key = lru_order_.back();
-            entries_.erase(oldest_key);
-            lru_index_.erase(oldest_key);
-            lru_order_.pop_back();
-            ++stats_.eviction_count;
-        }
+    bool has_entry(std::string_view primary_key) {
+        shard& s = shard_for(primary_key);
+        std::shared_lock lock(s.mutex);
+        return s.entries.contains(primary_key);
     }
-};
 
-patient_cache::patient_cache() : patient_cache(patient_cache_config{}) {}
+    /**
+     * @param refresh_due If given, set when the entry is past refresh_ahead
+     *        of its TTL
+     */
+    std::expected<patient_ptr, cache_error> lookup(std::string_view key,
+                                                   bool track,
+                                                   bool* refresh_due = nullptr) {
+        if (!enabled_.load(std::memory_order_relaxed)) {
+            return std::unexpected(cache_error::cache_disabled);
+        }
 
-patient_cache::patient_cache(const patient_cache_config& config)
-    : pimpl_(std::make_unique<impl>(config)) {}
+        auto now = clock_type::now();
+        auto result = with_entry(
+            key,
+            [&](shard& s, node* entry) -> std::expected<patient_ptr, cache_error> {
+                if (entry == nullptr) {
+                    return std::unexpected(cache_error::not_found);
+                }
+                if (entry->is_expired(now)) {
+                    return std::unexpected(cache_error::expired);
+                }
+                if (track) {
+                    entry->last_use.store(
+                        s.tick.fetch_add(1, std::memory_order_relaxed) + 1,
+                        std::memory_order_relaxed);
+                    entry->last_accessed.store(now.time_since_epoch().count(),
+                                               std::memory_order_relaxed);
+                    entry->access_count.fetch_add(1, std::memory_order_relaxed);
+                }
+                if (refresh_due != nullptr && config_.refresh_ahead > 0.0) {
+                    *refresh_due = now - entry->created_at >=
+                                   std::chrono::duration_cast<clock_type::duration>(
+                                       entry->ttl * config_.refresh_ahead);
+                }
+                return entry->patient;
+            });
+
+        if (track) {
+            get_count_.increment();
+            if (result.has_value()) {
+                hit_count_.increment();
+            } else {
+                if (result.error() == cache_error::expired) {
+                    expired_count_.increment();
+                }
+                miss_count_.increment();
+            }
+        }
+        return result;
+    }
 
-patient_cache::~patient_cache() = default;
+    void put(std::string_view key, patient_ptr patient,
+             std::optional<std::chrono::seconds> ttl) {
+        auto now = clock_type::now();
+        shard& s = shard_for(key);
+        std::unique_lock lock(s.mutex);
+
+        auto it = s.entries.find(key);
+        if (it == s.entries.end()) {
+            if (config_.lru_eviction) {
+                while (s.entries.size() >= s.capacity && !s.slots.empty()) {
+                    evict_one(s, now);
+                }
+            }
+            it = emplace(s, key);
+        }
 
-patient_cache::patient_cache(patient_cache&&) noexcept = default;
-patient_cache& patient_cache::operator=(patient_cache&&) noexcept = default;
+        node& entry = it->second;
+        entry.patient = std::move(patient);
+        entry.created_at = now;
+        entry.ttl = ttl.value_or(config_.default_ttl);
+        entry.last_use.store(s.tick.fetch_add(1, std::memory_order_relaxed) + 1,
+                             std::memory_order_relaxed);
+        entry.last_accessed.store(now.time_since_epoch().count(),
+                                  std::memory_order_relaxed);
+        entry.access_count.store(0, std::memory_order_relaxed);
+
+        put_count_.increment();
+    }
 
-void patient_cache::put(std::string_view key, const mapping::dicom_patient& patient,
-                         std::optional<std::chrono::seconds> ttl) {
-    if (!pimpl_->config_.enabled) {
-        return;
+    /**
+     * @brief Add a new, empty entry for key (caller holds the unique lock)
+     */
+    string_map<node>::iterator emplace(shard& s, std::string_view key) {
+        auto it = s.entries.try_emplace(std::string(key)).first;
+        it->second.key = &it->first;
+        it->second.slot = s.slots.size();
+        s.slots.push_back(&it->second);
+        note_size(size_.fetch_add(1, std::memory_order_relaxed) + 1);
+        return it;
     }
 
-    std::unique_lock lock(pimpl_->mutex_);
+    std::expected<patient_ptr, cache_error> get_or_load(
+        std::string_view key, const patient_loader& loader) {
+        bool refresh_due = false;
+        auto cached = lookup(key, true, &refresh_due);
+        if (cached.has_value()) {
+            if (refresh_due) {
+                schedule_refresh(key, loader);
+            }
+            return cached;
+        }
 
-    std::string key_str(key);
+        bool coalesced = false;
+        auto loaded = loads_.run(
+            key,
+            [&]() -> patient_ptr {
+                // A load that finished just before this one began has
+                // already stored its result
+                if (auto fresh = lookup(key, false); fresh.has_value()) {
+                    return *fresh;
+                }
+                return load(key, loader);
+            },
+            &coalesced);
+        if (coalesced) {
+            coalesced_count_.increment();
+        }
 
-    // Evict if needed
-    if (pimpl_->config_.lru_eviction) {
-        pimpl_->evict_lru_if_needed();
+        if (!loaded) {
+            return std::unexpected(cache_error::not_found);
+        }
+        return loaded;
     }
 
-    auto now = std::chrono::system_clock::now();
+    patient_ptr load(std::string_view key, const patient_loader& loader) {
+        load_count_.increment();
+        auto loaded = loader();
+        if (!loaded.has_value()) {
+            return nullptr;
+        }
+        auto patient =
+            std::make_shared<const mapping::dicom_patient>(std::move(*loaded));
+        if (enabled_.load(std::memory_order_relaxed)) {
+            put(key, patient, std::nullopt);
+        }
+        return patient;
+    }
 
-    impl::cache_entry entry;
-    entry.patient = patient;
-    entry.metadata.created_at = now;
-    entry.metadata.last_accessed = now;
-    entry.metadata.ttl = ttl.value_or(pimpl_->config_.default_ttl);
-    entry.metadata.access_count = 0;
+    /**
+     * @brief Reload key on the background thread unless a load is in flight
+     *
+     * At most one refresh per key is queued at a time, so the queue is
+     * bounded by the number of entries.
+     */
+    void schedule_refresh(std::string_view key, const patient_loader& loader) {
+        if (loads_.in_flight(key)) {
+            return;
+        }
+        auto task = loads_.begin(key, [this, key = std::string(key), loader] {
+            refresh_count_.increment();
+            return load(key, loader);
+        });
+        // A stopped worker would never finish the call and key would stay
+        // in flight, so reload here instead
+        if (task && !refresher_.post(task)) {
+            task();
+        }
+    }
+
+    // =========================================================================
+    // Snapshots
+    // =========================================================================
+
+    std::expected<size_t, cache_error> save_snapshot(
+        const std::filesystem::path& path) {
+        auto writer = snapshot_writer::create(path, snapshot_kind::patient_cache);
+        if (!writer) {
+            return std::unexpected(writer.error());
+        }
+
+        struct saved_entry {
+            std::string key;
+            patient_ptr patient;
+            clock_type::time_point created_at;
+            std::chrono::seconds ttl;
+            uint64_t last_use;
+        };
+        std::vector<saved_entry> entries;
+        std::vector<std::pair<std::string, std::string>> aliases;
+
+        auto now = clock_type::now();
+        for (size_t i = 0; i < shard_count(); ++i) {
+            shard& s = shards_[i];
+            entries.clear();
+            {
+                std::shared_lock lock(s.mutex);
+                entries.reserve(s.slots.size());
+                for (const node* entry : s.slots) {
+                    if (!entry->is_expired(now)) {
+                        entries.push_back(
+                            {*entry->key, entry->patient, entry->created_at,
+                             entry->ttl,
+                             entry->last_use.load(std::memory_order_relaxed)});
+                    }
+                }
+                aliases.insert(aliases.end(), s.aliases.begin(), s.aliases.end());
+            }
 
-    pimpl_->entries_[key_str] = std::move(entry);
-    pimpl_->update_lru(key_str);
+            // Least recently used first, so a restore rebuilds the order
+            std::sort(entries.begin(), entries.end(),
+                      [](const saved_entry& a, const saved_entry& b) {
+                          return a.last_use < b.last_use;
+                      });
+            for (const auto& entry : entries) {
+                writer->append([&entry](internal::field_writer& w) {
+                    w.u8(static_cast<uint8_t>(snapshot_record::entry));
+                    w.str(entry.key);
+                    w.time(entry.created_at);
+                    w.i64(entry.ttl.count());
+                    write_patient(w, *entry.patient);
+                });
+            }
+        }
 
-    ++pimpl_->stats_.put_count;
-    pimpl_->stats_.current_size = pimpl_->entries_.size();
-    if (pimpl_->stats_.current_size > pimpl_->stats_.max_size_reached) {
-        pimpl_->stats_.max_size_reached = pimpl_->stats_.current_size;
+        for (const auto& [alias, primary] : aliases) {
+            writer->append([&](internal::field_writer& w) {
+                w.u8(static_cast<uint8_t>(snapshot_record::alias));
+                w.str(alias);
+                w.str(primary);
+            });
+        }
+        return writer->commit();
     }
-}
 
-std::expected<mapping::dicom_patient, cache_error> patient_cache::get(
-    std::string_view key) const {
-    if (!pimpl_->config_.enabled) {
-        return std::unexpected(cache_error::cache_disabled);
+    std::expected<size_t, cache_error> load_snapshot(
+        const std::filesystem::path& path) {
+        if (!enabled_.load(std::memory_order_relaxed)) {
+            return std::unexpected(cache_error::cache_disabled);
+        }
+        auto reader = snapshot_reader::open(path, snapshot_kind::patient_cache);
+        if (!reader) {
+            return std::unexpected(reader.error());
+        }
+
+        auto now = clock_type::now();
+        size_t restored = 0;
+        reader->for_each([&](internal::field_reader& r) {
+            switch (static_cast<snapshot_record>(r.u8())) {
+                case snapshot_record::entry: {
+                    std::string key = r.str();
+                    auto created_at = r.time();
+                    std::chrono::seconds ttl{r.i64()};
+                    auto patient = read_patient(r);
+                    if (!r.ok() || now - created_at > ttl) break;
+                    if (restore_entry(key,
+                                      std::make_shared<const mapping::dicom_patient>(
+                                          std::move(patient)),
+                                      created_at, ttl)) {
+                        ++restored;
+                    }
+                    break;
+                }
+                case snapshot_record::alias: {
+                    std::string alias = r.str();
+                    std::string primary = r.str();
+                    if (!r.ok() || !has_entry(primary)) break;
+                    shard& s = shard_for(alias);
+                    std::unique_lock lock(s.mutex);
+                    s.aliases.try_emplace(std::move(alias), std::move(primary));
+                    break;
+                }
+                default:
+                    break;
+            }
+        });
+
+        restored_count_.add(restored);
+        return restored;
     }
 
-    std::unique_lock lock(pimpl_->mutex_);
+    /**
+     * @brief Insert a restored entry unless key is cached or its shard full
+     */
+    bool restore_entry(std::string_view key, patient_ptr patient,
+                       clock_type::time_point created_at,
+                       std::chrono::seconds ttl) {
+        shard& s = shard_for(key);
+        std::unique_lock lock(s.mutex);
+        if (s.entries.size() >= s.capacity || s.entries.contains(key)) {
+            return false;
+        }
 
-    ++pimpl_->stats_.get_count;
+        node& entry = emplace(s, key)->second;
+        entry.patient = std::move(patient);
+        entry.created_at = created_at;
+        entry.ttl = ttl;
+        entry.last_use.store(s.tick.fetch_add(1, std::memory_order_relaxed) + 1,
+                             std::memory_order_relaxed);
+        entry.last_accessed.store(created_at.time_since_epoch().count(),
+                                  std::memory_order_relaxed);
+        return true;
+    }
 
-    std::string resolved_key = pimpl_->resolve_key(key);
-    auto it = pimpl_->entries_.find(resolved_key);
+    void schedule_snapshot() {
+        if (config_.snapshot_interval.count() <= 0) {
+            return;
+        }
+        snapshotter_.post_after(config_.snapshot_interval, [this] {
+            (void)save_snapshot(config_.snapshot_path);
+            schedule_snapshot();
+        });
+    }
 
-    if (it == pimpl_->entries_.end()) {
-        ++pimpl_->stats_.miss_count;
-        return std::unexpected(cache_error::not_found);
+    /**
+     * @brief Evict one entry from a full shard (caller holds the unique lock)
+     *
+     * Samples eviction_sample random slots (every slot of a smaller shard)
+     * and evicts the first expired one, or else the least recently used.
+     */
+    void evict_one(shard& s, clock_type::time_point now) {
+        size_t count = s.slots.size();
+        bool scan_all = count <= eviction_sample;
+        size_t sample = scan_all ? count : eviction_sample;
+        size_t victim = 0;
+        uint64_t oldest = UINT64_MAX;
+        for (size_t i = 0; i < sample; ++i) {
+            size_t pos = scan_all ? i : static_cast<size_t>(next_random(s) % count);
+            const node* candidate = s.slots[pos];
+            if (candidate->is_expired(now)) {
+                victim = pos;
+                break;
+            }
+            uint64_t use = candidate->last_use.load(std::memory_order_relaxed);
+            if (use < oldest) {
+                oldest = use;
+                victim = pos;
+            }
+        }
+        erase_slot(s, victim);
+        eviction_count_.increment();
     }
 
-    if (it->second.metadata.is_expired()) {
-        ++pimpl_->stats_.expired_count;
-        ++pimpl_->stats_.miss_count;
-        return std::unexpected(cache_error::expired);
+    static uint64_t next_random(shard& s) noexcept {
+        // xorshift64
+        s.random ^= s.random << 13;
+        s.random ^= s.random >> 7;
+        s.random ^= s.random << 17;
+        return s.random;
     }
 
-    // Update access metadata
-    it->second.metadata.last_accessed = std::chrono::system_clock::now();
-    ++it->second.metadata.access_count;
-    pimpl_->update_lru(resolved_key);
+    /**
+     * @brief Remove the entry at slot pos (caller holds the unique lock)
+     */
+    void erase_slot(shard& s, size_t pos) {
+        node* entry = s.slots[pos];
+        s.slots[pos] = s.slots.back();
+        s.slots[pos]->slot = pos;
+        s.slots.pop_back();
+        s.entries.erase(s.entries.find(*entry->key));
+        size_.fetch_sub(1, std::memory_order_relaxed);
+    }
 
-    ++pimpl_->stats_.hit_count;
-    return it->second.patient;
-}
+    /**
+     * @brief Remove aliases whose primary entry is gone
+     *
+     * Never holds two shard locks at once.
+     */
+    void drop_dangling_aliases() {
+        std::vector<std::pair<std::string, std::string>> dangling;
+        for (size_t i = 0; i < shard_count(); ++i) {
+            shard& s = shards_[i];
+            {
+                std::shared_lock lock(s.mutex);
+                dangling.assign(s.aliases.begin(), s.aliases.end());
+            }
+            std::erase_if(dangling, [this](const auto& alias) {
+                return has_entry(alias.second);
+            });
+            if (dangling.empty()) {
+                continue;
+            }
 
-std::expected<mapping::dicom_patient, cache_error> patient_cache::peek(
-    std::string_view key) const {
-    if (!pimpl_->config_.enabled) {
-        return std::unexpected(cache_error::cache_disabled);
+            std::unique_lock lock(s.mutex);
+            for (const auto& [alias, primary] : dangling) {
+                auto it = s.aliases.find(alias);
+                if (it != s.aliases.end() && it->second == primary) {
+                    s.aliases.erase(it);
+                }
+            }
+        }
+    }
+
+    void note_size(size_t size) noexcept {
+        size_t max = max_size_reached_.load(std::memory_order_relaxed);
+        while (size > max && !max_size_reached_.compare_exchange_weak(
+                                 max, size, std::memory_order_relaxed)) {
+        }
     }
+};
 
-    std::shared_lock lock(pimpl_->mutex_);
+patient_cache::patient_cache() : patient_cache(patient_cache_config{}) {}
 
-    std::string resolved_key = pimpl_->resolve_key(key);
-    auto it = pimpl_->entries_.find(resolved_key);
+patient_cache::patient_cache(const patient_cache_config& config)
+    : pimpl_(std::make_unique<impl>(config)) {}
 
-    if (it == pimpl_->entries_.end()) {
-        return std::unexpected(cache_error::not_found);
+patient_cache::~patient_cache() = default;
+
+patient_cache::patient_cache(patient_cache&&) noexcept = default;
+patient_cache& patient_cache::operator=(patient_cache&&) noexcept = default;
+
+void patient_cache::put(std::string_view key, const mapping::dicom_patient& patient,
+                         std::optional<std::chrono::seconds> ttl) {
+    if (!pimpl_->enabled_.load(std::memory_order_relaxed)) {
+        return;
     }
+    pimpl_->put(key, std::make_shared<const mapping::dicom_patient>(patient), ttl);
+}
 
-    if (it->second.metadata.is_expired()) {
-        return std::unexpected(cache_error::expired);
+void patient_cache::put(std::string_view key,
+                         std::shared_ptr<const mapping::dicom_patient> patient,
+                         std::optional<std::chrono::seconds> ttl) {
+    if (!pimpl_->enabled_.load(std::memory_order_relaxed) || !patient) {
+        return;
     }
+    pimpl_->put(key, std::move(patient), ttl);
+}
 
-    return it->second.patient;
+std::expected<mapping::dicom_patient, cache_error> patient_cache::get(
+    std::string_view key) const {
+    auto result = pimpl_->lookup(key, true);
+    if (!result.has_value()) {
+        return std::unexpected(result.error());
+    }
+    return **result;
 }
 
-bool patient_cache::contains(std::string_view key) const noexcept {
-    if (!pimpl_->config_.enabled) {
-        return false;
+std::expected<mapping::dicom_patient, cache_error> patient_cache::peek(
+    std::string_view key) const {
+    auto result = pimpl_->lookup(key, false);
+    if (!result.has_value()) {
+        return std::unexpected(result.error());
     }
+    return **result;
+}
 
-    std::shared_lock lock(pimpl_->mutex_);
+std::expected<std::shared_ptr<const mapping::dicom_patient>, cache_error>
+patient_cache::get_shared(std::string_view key) const {
+    return pimpl_->lookup(key, true);
+}
 
-    std::string resolved_key = pimpl_->resolve_key(key);
-    auto it = pimpl_->entries_.find(resolved_key);
+std::expected<std::shared_ptr<const mapping::dicom_patient>, cache_error>
+patient_cache::peek_shared(std::string_view key) const {
+    return pimpl_->lookup(key, false);
+}
 
-    if (it == pimpl_->entries_.end()) {
+bool patient_cache::contains(std::string_view key) const noexcept {
+    if (!pimpl_->enabled_.load(std::memory_order_relaxed)) {
         return false;
     }
 
-    return !it->second.metadata.is_expired();
+    auto now = std::chrono::system_clock::now();
+    return pimpl_->with_entry(key, [now](impl::shard&, const impl::node* entry) {
+        return entry != nullptr && !entry->is_expired(now);
+    });
 }
 
 bool patient_cache::remove(std::string_view key) {
-    std::unique_lock lock(pimpl_->mutex_);
-
-    std::string key_str(key);
+    std::string primary(key);
 
     // Check if it's an alias
-    auto alias_it = pimpl_->aliases_.find(key_str);
-    if (alias_it != pimpl_->aliases_.end()) {
-        key_str = alias_it->second;
+    {
+        auto& s = pimpl_->shard_for(key);
+        std::shared_lock lock(s.mutex);
+        auto alias_it = s.aliases.find(key);
+        if (alias_it != s.aliases.end()) {
+            primary = alias_it->second;
+        }
     }
 
-    auto it = pimpl_->entries_.find(key_str);
-    if (it == pimpl_->entries_.end()) {
-        return false;
+    {
+        auto& s = pimpl_->shard_for(primary);
+        std::unique_lock lock(s.mutex);
+        auto it = s.entries.find(primary);
+        if (it == s.entries.end()) {
+            return false;
+        }
+        pimpl_->erase_slot(s, it->second.slot);
     }
 
-    pimpl_->entries_.erase(it);
-    pimpl_->remove_from_lru(key_str);
-
     // Remove all aliases pointing to this key
-    for (auto alias_it = pimpl_->aliases_.begin(); alias_it != pimpl_->aliases_.end();) {
-        if (alias_it->second == key_str) {
-            alias_it = pimpl_->aliases_.erase(alias_it);
-        } else {
-            ++alias_it;
-        }
+    for (size_t i = 0; i < pimpl_->shard_count(); ++i) {
+        auto& s = pimpl_->shards_[i];
+        std::unique_lock lock(s.mutex);
+        std::erase_if(s.aliases, [&primary](const auto& alias) {
+            return alias.second == primary;
+        });
     }
 
-    ++pimpl_->stats_.remove_count;
-    pimpl_->stats_.current_size = pimpl_->entries_.size();
-
+    pimpl_->remove_count_.increment();
     return true;
 }
 
 bool patient_cache::add_alias(std::string_view alias, std::string_view primary_key) {
-    std::unique_lock lock(pimpl_->mutex_);
-
-    std::string primary_str(primary_key);
-
     // Check if primary key exists
-    if (pimpl_->entries_.find(primary_str) == pimpl_->entries_.end()) {
+    if (!pimpl_->has_entry(primary_key)) {
         return false;
     }
 
-    pimpl_->aliases_[std::string(alias)] = primary_str;
+    auto& s = pimpl_->shard_for(alias);
+    std::unique_lock lock(s.mutex);
+    s.aliases.insert_or_assign(std::string(alias), std::string(primary_key));
     return true;
 }
 
 bool patient_cache::remove_alias(std::string_view alias) {
-    std::unique_lock lock(pimpl_->mutex_);
-    return pimpl_->aliases_.erase(std::string(alias)) > 0;
+    auto& s = pimpl_->shard_for(alias);
+    std::unique_lock lock(s.mutex);
+    auto it = s.aliases.find(alias);
+    if (it == s.aliases.end()) {
+        return false;
+    }
+    s.aliases.erase(it);
+    return true;
 }
 
 std::expected<mapping::dicom_patient, cache_error> patient_cache::get_or_load(
     std::string_view key,
     std::function<std::optional<mapping::dicom_patient>()> loader) {
-    // First try to get from cache
-    auto cached = get(key);
-    if (cached.has_value()) {
-        return cached;
+    auto result = pimpl_->get_or_load(key, loader);
+    if (!result.has_value()) {
+        return std::unexpected(result.error());
     }
-
-    // Cache miss - try to load
-    auto loaded = loader();
-    if (!loaded.has_value()) {
-        return std::unexpected(cache_error::not_found);
-    }
-
-    // Store in cache
-    put(key, *loaded);
-
-    return *loaded;
+    return **result;
 }
 
 std::unordered_map<std::string, mapping::dicom_patient> patient_cache::get_many(
@@ -450,9 +930,9 @@ std::unordered_map<std::string, mapping::dicom_patient> patient_cache::get_many(
     std::unordered_map<std::string, mapping::dicom_patient> results;
 
     for (const auto& key : keys) {
-        auto result = get(key);
+        auto result = get_shared(key);
         if (result.has_value()) {
-            results[key] = *result;
+            results[key] = **result;
         }
     }
 
@@ -467,56 +947,46 @@ void patient_cache::put_many(
 }
 
 void patient_cache::clear() {
-    std::unique_lock lock(pimpl_->mutex_);
-
-    pimpl_->entries_.clear();
-    pimpl_->aliases_.clear();
-    pimpl_->lru_order_.clear();
-    pimpl_->lru_index_.clear();
-    pimpl_->stats_.current_size = 0;
+    for (size_t i = 0; i < pimpl_->shard_count(); ++i) {
+        auto& s = pimpl_->shards_[i];
+        std::unique_lock lock(s.mutex);
+        pimpl_->size_.fetch_sub(s.entries.size(), std::memory_order_relaxed);
+        s.entries.clear();
+        s.aliases.clear();
+        s.slots.clear();
+    }
 }
 
 size_t patient_cache::evict_expired() {
-    std::unique_lock lock(pimpl_->mutex_);
-
+    auto now = std::chrono::system_clock::now();
     size_t count = 0;
-    std::vector<std::string> expired_keys;
 
-    for (const auto& [key, entry] : pimpl_->entries_) {
-        if (entry.metadata.is_expired()) {
-            expired_keys.push_back(key);
+    for (size_t i = 0; i < pimpl_->shard_count(); ++i) {
+        auto& s = pimpl_->shards_[i];
+        std::unique_lock lock(s.mutex);
+        for (size_t pos = 0; pos < s.slots.size();) {
+            if (s.slots[pos]->is_expired(now)) {
+                pimpl_->erase_slot(s, pos);
+                ++count;
+            } else {
+                ++pos;
+            }
         }
     }
 
-    for (const auto& key : expired_keys) {
-        pimpl_->entries_.erase(key);
-        pimpl_->remove_from_lru(key);
-        ++count;
-    }
-
     // Remove aliases pointing to expired entries
-    for (auto it = pimpl_->aliases_.begin(); it != pimpl_->aliases_.end();) {
-        if (pimpl_->entries_.find(it->second) == pimpl_->entries_.end()) {
-            it = pimpl_->aliases_.erase(it);
-        } else {
-            ++it;
-        }
-    }
-
-    pimpl_->stats_.eviction_count += count;
-    pimpl_->stats_.current_size = pimpl_->entries_.size();
+    pimpl_->drop_dangling_aliases();
 
+    pimpl_->eviction_count_.add(count);
     return count;
 }
 
 size_t patient_cache::size() const noexcept {
-    std::shared_lock lock(pimpl_->mutex_);
-    return pimpl_->entries_.size();
+    return pimpl_->size_.load(std::memory_order_relaxed);
 }
 
 bool patient_cache::empty() const noexcept {
-    std::shared_lock lock(pimpl_->mutex_);
-    return pimpl_->entries_.empty();
+    return size() == 0;
 }
 
 const patient_cache_config& patient_cache::config() const noexcept {
@@ -524,46 +994,80 @@ const patient_cache_config& patient_cache::config() const noexcept {
 }
 
 void patient_cache::set_enabled(bool enabled) {
-    std::unique_lock lock(pimpl_->mutex_);
     pimpl_->config_.enabled = enabled;
+    pimpl_->enabled_.store(enabled, std::memory_order_relaxed);
 }
 
 std::optional<cache_entry_metadata> patient_cache::get_metadata(
     std::string_view key) const {
-    std::shared_lock lock(pimpl_->mutex_);
-
-    std::string resolved_key = pimpl_->resolve_key(key);
-    auto it = pimpl_->entries_.find(resolved_key);
+    return pimpl_->with_entry(
+        key,
+        [](impl::shard&, const impl::node* entry)
+            -> std::optional<cache_entry_metadata> {
+            if (entry == nullptr) {
+                return std::nullopt;
+            }
+            return entry->metadata();
+        });
+}
 
-    if (it == pimpl_->entries_.end()) {
-        return std::nullopt;
-    }
+std::expected<size_t, cache_error> patient_cache::save_snapshot(
+    const std::filesystem::path& path) const {
+    return pimpl_->save_snapshot(path);
+}
 
-    return it->second.metadata;
+std::expected<size_t, cache_error> patient_cache::load_snapshot(
+    const std::filesystem::path& path) {
+    return pimpl_->load_snapshot(path);
 }
 
 std::vector<std::string> patient_cache::keys() const {
-    std::shared_lock lock(pimpl_->mutex_);
-
     std::vector<std::string> result;
-    result.reserve(pimpl_->entries_.size());
+    result.reserve(size());
 
-    for (const auto& [key, _] : pimpl_->entries_) {
-        result.push_back(key);
+    for (size_t i = 0; i < pimpl_->shard_count(); ++i) {
+        auto& s = pimpl_->shards_[i];
+        std::shared_lock lock(s.mutex);
+        for (const auto& [key, _] : s.entries) {
+            result.push_back(key);
+        }
     }
 
     return result;
 }
 
 patient_cache::statistics patient_cache::get_statistics() const {
-    std::shared_lock lock(pimpl_->mutex_);
-    return pimpl_->stats_;
+    statistics stats;
+    stats.get_count = pimpl_->get_count_.load();
+    stats.hit_count = pimpl_->hit_count_.load();
+    stats.miss_count = pimpl_->miss_count_.load();
+    stats.expired_count = pimpl_->expired_count_.load();
+    stats.put_count = pimpl_->put_count_.load();
+    stats.remove_count = pimpl_->remove_count_.load();
+    stats.eviction_count = pimpl_->eviction_count_.load();
+    stats.current_size = size();
+    stats.max_size_reached =
+        pimpl_->max_size_reached_.load(std::memory_order_relaxed);
+    stats.load_count = pimpl_->load_count_.load();
+    stats.coalesced_count = pimpl_->coalesced_count_.load();
+    stats.refresh_count = pimpl_->refresh_count_.load();
+    stats.restored_count = pimpl_->restored_count_.load();
+    return stats;
 }
 
 void patient_cache::reset_statistics() {
-    std::unique_lock lock(pimpl_->mutex_);
-    pimpl_->stats_ = statistics{};
-    pimpl_->stats_.current_size = pimpl_->entries_.size();
+    pimpl_->get_count_.reset();
+    pimpl_->hit_count_.reset();
+    pimpl_->miss_count_.reset();
+    pimpl_->expired_count_.reset();
+    pimpl_->put_count_.reset();
+    pimpl_->remove_count_.reset();
+    pimpl_->eviction_count_.reset();
+    pimpl_->load_count_.reset();
+    pimpl_->coalesced_count_.reset();
+    pimpl_->refresh_count_.reset();
+    pimpl_->restored_count_.reset();
+    pimpl_->max_size_reached_.store(0, std::memory_order_relaxed);
 }
 
 }  // namespace pacs::bridge::cache
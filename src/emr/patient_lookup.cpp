@@ -6,10 +6,15 @@
  */
 
 #include "pacs/bridge/emr/patient_lookup.h"
+#include "pacs/bridge/cache/cache_snapshot.h"
 #include "pacs/bridge/emr/patient_matcher.h"
 #include "pacs/bridge/emr/search_params.h"
+#include "pacs/bridge/internal/background_worker.h"
+#include "pacs/bridge/internal/binary_fields.h"
+#include "pacs/bridge/internal/single_flight.h"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <mutex>
 #include <shared_mutex>
@@ -32,6 +37,15 @@ struct cache_entry {
         auto now = std::chrono::system_clock::now();
         return (now - cached_at) > ttl;
     }
+
+    /** Past the given fraction of the TTL (refresh-ahead) */
+    [[nodiscard]] bool is_due(double fraction) const noexcept {
+        auto now = std::chrono::system_clock::now();
+        return fraction > 0.0 &&
+               now - cached_at >=
+                   std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                       ttl * fraction);
+    }
 };
 
 struct negative_cache_entry {
@@ -44,6 +58,172 @@ struct negative_cache_entry {
     }
 };
 
+// =============================================================================
+// Snapshot Encoding
+// =============================================================================
+
+/**
+ * @brief Snapshot record types
+ */
+enum class snapshot_record : uint8_t { entry = 1, negative = 2 };
+
+using internal::field_reader;
+using internal::field_writer;
+
+void write_optional(field_writer& w, const std::optional<std::string>& value) {
+    w.u8(value.has_value() ? 1 : 0);
+    if (value) w.str(*value);
+}
+
+std::optional<std::string> read_optional(field_reader& r) {
+    if (r.u8() == 0) return std::nullopt;
+    return r.str();
+}
+
+void write_list(field_writer& w, const std::vector<std::string>& values) {
+    w.u32(static_cast<uint32_t>(values.size()));
+    for (const auto& value : values) {
+        w.str(value);
+    }
+}
+
+std::vector<std::string> read_list(field_reader& r) {
+    std::vector<std::string> values;
+    const uint32_t count = r.u32();
+    for (uint32_t i = 0; i < count && r.ok(); ++i) {
+        values.push_back(r.str());
+    }
+    return values;
+}
+
+void write_record(field_writer& w, const patient_record& patient) {
+    w.str(patient.id);
+    w.str(patient.mrn);
+
+    w.u32(static_cast<uint32_t>(patient.identifiers.size()));
+    for (const auto& identifier : patient.identifiers) {
+        w.str(identifier.value);
+        write_optional(w, identifier.system);
+        write_optional(w, identifier.use);
+        write_optional(w, identifier.type_code);
+        write_optional(w, identifier.type_display);
+    }
+
+    w.u32(static_cast<uint32_t>(patient.names.size()));
+    for (const auto& name : patient.names) {
+        write_optional(w, name.use);
+        write_optional(w, name.text);
+        write_optional(w, name.family);
+        write_list(w, name.given);
+        write_list(w, name.prefix);
+        write_list(w, name.suffix);
+    }
+
+    write_optional(w, patient.birth_date);
+    write_optional(w, patient.sex);
+
+    w.u32(static_cast<uint32_t>(patient.addresses.size()));
+    for (const auto& address : patient.addresses) {
+        write_optional(w, address.use);
+        write_optional(w, address.type);
+        write_optional(w, address.text);
+        write_list(w, address.lines);
+        write_optional(w, address.city);
+        write_optional(w, address.district);
+        write_optional(w, address.state);
+        write_optional(w, address.postal_code);
+        write_optional(w, address.country);
+    }
+
+    w.u32(static_cast<uint32_t>(patient.telecom.size()));
+    for (const auto& contact : patient.telecom) {
+        w.str(contact.system);
+        w.str(contact.value);
+        write_optional(w, contact.use);
+        w.u8(contact.rank.has_value() ? 1 : 0);
+        if (contact.rank) w.i32(*contact.rank);
+    }
+
+    w.u8(patient.active ? 1 : 0);
+    w.u8(patient.deceased.has_value() ? (*patient.deceased ? 2 : 1) : 0);
+    write_optional(w, patient.deceased_datetime);
+    write_optional(w, patient.language);
+    write_optional(w, patient.managing_organization);
+    write_optional(w, patient.link_reference);
+    write_optional(w, patient.link_type);
+    write_optional(w, patient.version_id);
+    write_optional(w, patient.last_updated);
+    write_optional(w, patient.raw_json);
+    w.u8(patient.cached_at.has_value() ? 1 : 0);
+    if (patient.cached_at) w.time(*patient.cached_at);
+}
+
+patient_record read_record(field_reader& r) {
+    patient_record patient;
+    patient.id = r.str();
+    patient.mrn = r.str();
+
+    for (uint32_t i = 0, n = r.u32(); i < n && r.ok(); ++i) {
+        patient_identifier identifier;
+        identifier.value = r.str();
+        identifier.system = read_optional(r);
+        identifier.use = read_optional(r);
+        identifier.type_code = read_optional(r);
+        identifier.type_display = read_optional(r);
+        patient.identifiers.push_back(std::move(identifier));
+    }
+
+    for (uint32_t i = 0, n = r.u32(); i < n && r.ok(); ++i) {
+        patient_name name;
+        name.use = read_optional(r);
+        name.text = read_optional(r);
+        name.family = read_optional(r);
+        name.given = read_list(r);
+        name.prefix = read_list(r);
+        name.suffix = read_list(r);
+        patient.names.push_back(std::move(name));
+    }
+
+    patient.birth_date = read_optional(r);
+    patient.sex = read_optional(r);
+
+    for (uint32_t i = 0, n = r.u32(); i < n && r.ok(); ++i) {
+        patient_address address;
+        address.use = read_optional(r);
+        address.type = read_optional(r);
+        address.text = read_optional(r);
+        address.lines = read_list(r);
+        address.city = read_optional(r);
+        address.district = read_optional(r);
+        address.state = read_optional(r);
+        address.postal_code = read_optional(r);
+        address.country = read_optional(r);
+        patient.addresses.push_back(std::move(address));
+    }
+
+    for (uint32_t i = 0, n = r.u32(); i < n && r.ok(); ++i) {
+        patient_contact_point contact;
+        contact.system = r.str();
+        contact.value = r.str();
+        contact.use = read_optional(r);
+        if (r.u8() != 0) contact.rank = r.i32();
+        patient.telecom.push_back(std::move(contact));
+    }
+
+    patient.active = r.u8() != 0;
+    if (auto deceased = r.u8(); deceased != 0) patient.deceased = deceased == 2;
+    patient.deceased_datetime = read_optional(r);
+    patient.language = read_optional(r);
+    patient.managing_organization = read_optional(r);
+    patient.link_reference = read_optional(r);
+    patient.link_type = read_optional(r);
+    patient.version_id = read_optional(r);
+    patient.last_updated = read_optional(r);
+    patient.raw_json = read_optional(r);
+    if (r.u8() != 0) patient.cached_at = r.time();
+    return patient;
+}
+
 }  // namespace
 
 // =============================================================================
@@ -56,7 +236,12 @@ public:
                   const patient_lookup_config& config)
         : client_(std::move(client))
         , config_(config)
-        , matcher_(std::make_shared<patient_matcher>()) {}
+        , matcher_(std::make_shared<patient_matcher>()) {
+        if (!config_.snapshot_path.empty()) {
+            snapshotter_.post([this] { (void)load_snapshot(config_.snapshot_path); });
+            schedule_snapshot();
+        }
+    }
 
     auto get_by_mrn(std::string_view mrn)
         -> Result<patient_record> {
@@ -64,8 +249,13 @@ public:
 
         // Check cache first
         if (config_.enable_cache) {
-            if (auto cached = get_from_cache(mrn_str)) {
+            bool refresh_due = false;
+            if (auto cached = get_from_cache(mrn_str, &refresh_due)) {
                 ++stats_.cache_hits;
+                if (refresh_due) {
+                    schedule_refresh("mrn:" + mrn_str,
+                                     [this, mrn_str] { return query_by_mrn(mrn_str); });
+                }
                 return *cached;
             }
             if (is_negative_cached(mrn_str)) {
@@ -75,6 +265,23 @@ public:
             ++stats_.cache_misses;
         }
 
+        return coalesce("mrn:" + mrn_str, [&]() -> Result<patient_record> {
+            // A query that finished just before this one began has
+            // already cached its result
+            if (config_.enable_cache) {
+                if (auto cached = get_from_cache(mrn_str)) {
+                    return *cached;
+                }
+                if (is_negative_cached(mrn_str)) {
+                    return to_error_info(patient_error::not_found);
+                }
+            }
+            return query_by_mrn(mrn_str);
+        });
+    }
+
+    auto query_by_mrn(const std::string& mrn)
+        -> Result<patient_record> {
         ++stats_.total_queries;
         auto start = std::chrono::steady_clock::now();
 
@@ -99,7 +306,7 @@ public:
         if (bundle.empty()) {
             // Cache negative result
             if (config_.enable_cache) {
-                add_negative_cache(mrn_str);
+                add_negative_cache(mrn);
             }
             ++stats_.failed_queries;
             return to_error_info(patient_error::not_found);
@@ -117,12 +324,10 @@ public:
 
         // Cache the result
         if (config_.enable_cache) {
-            add_to_cache(mrn_str, patient);
+            add_to_cache(mrn, patient);
         }
 
-        auto end = std::chrono::steady_clock::now();
-        stats_.total_query_time +=
-            std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        stats_.add_query_time(std::chrono::steady_clock::now() - start);
         ++stats_.successful_queries;
 
         return patient;
@@ -134,13 +339,36 @@ public:
 
         // Check cache
         if (config_.enable_cache) {
-            if (auto cached = get_from_cache(cache_key)) {
+            bool refresh_due = false;
+            if (auto cached = get_from_cache(cache_key, &refresh_due)) {
                 ++stats_.cache_hits;
+                if (refresh_due) {
+                    schedule_refresh(
+                        "identifier:" + cache_key,
+                        [this, system = std::string(system),
+                         value = std::string(value)] {
+                            return query_by_identifier(system, value);
+                        });
+                }
                 return *cached;
             }
             ++stats_.cache_misses;
         }
 
+        return coalesce("identifier:" + cache_key, [&]() -> Result<patient_record> {
+            if (config_.enable_cache) {
+                if (auto cached = get_from_cache(cache_key)) {
+                    return *cached;
+                }
+            }
+            return query_by_identifier(system, value);
+        });
+    }
+
+    auto query_by_identifier(std::string_view system, std::string_view value)
+        -> Result<patient_record> {
+        std::string cache_key = std::string(system) + "|" + std::string(value);
+
         ++stats_.total_queries;
         auto start = std::chrono::steady_clock::now();
 
@@ -157,6 +385,9 @@ public:
 
         auto& bundle = result.value().value;
         if (bundle.empty()) {
+            if (config_.enable_cache) {
+                remove_from_cache(cache_key);
+            }
             ++stats_.failed_queries;
             return to_error_info(patient_error::not_found);
         }
@@ -178,9 +409,7 @@ public:
             }
         }
 
-        auto end = std::chrono::steady_clock::now();
-        stats_.total_query_time +=
-            std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        stats_.add_query_time(std::chrono::steady_clock::now() - start);
         ++stats_.successful_queries;
 
         return patient;
@@ -222,9 +451,7 @@ public:
             add_to_cache(patient.mrn, patient);
         }
 
-        auto end = std::chrono::steady_clock::now();
-        stats_.total_query_time +=
-            std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        stats_.add_query_time(std::chrono::steady_clock::now() - start);
         ++stats_.successful_queries;
 
         return patient;
@@ -371,9 +598,7 @@ public:
                       return a.score > b.score;
                   });
 
-        auto end = std::chrono::steady_clock::now();
-        stats_.total_query_time +=
-            std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        stats_.add_query_time(std::chrono::steady_clock::now() - start);
         ++stats_.successful_queries;
 
         return matches;
@@ -418,11 +643,105 @@ public:
         return count;
     }
 
+    auto save_snapshot(const std::filesystem::path& path) const
+        -> Result<size_t> {
+        auto writer = cache::snapshot_writer::create(
+            path, cache::snapshot_kind::patient_lookup);
+        if (!writer) {
+            return to_error_info(patient_error::cache_failed,
+                                 cache::to_string(writer.error()));
+        }
+
+        std::vector<std::pair<std::string, cache_entry>> entries;
+        std::vector<std::pair<std::string, negative_cache_entry>> negatives;
+        {
+            std::shared_lock lock(cache_mutex_);
+            entries.reserve(cache_.size());
+            for (const auto& [key, entry] : cache_) {
+                if (!entry.is_expired()) {
+                    entries.emplace_back(key, entry);
+                }
+            }
+            for (const auto& [key, entry] : negative_cache_) {
+                if (!entry.is_expired()) {
+                    negatives.emplace_back(key, entry);
+                }
+            }
+        }
+
+        for (const auto& [key, entry] : entries) {
+            writer->append([&](field_writer& w) {
+                w.u8(static_cast<uint8_t>(snapshot_record::entry));
+                w.str(key);
+                w.time(entry.cached_at);
+                w.i64(entry.ttl.count());
+                write_record(w, entry.patient);
+            });
+        }
+        for (const auto& [key, entry] : negatives) {
+            writer->append([&](field_writer& w) {
+                w.u8(static_cast<uint8_t>(snapshot_record::negative));
+                w.str(key);
+                w.time(entry.cached_at);
+                w.i64(entry.ttl.count());
+            });
+        }
+
+        auto written = writer->commit();
+        if (!written) {
+            return to_error_info(patient_error::cache_failed,
+                                 cache::to_string(written.error()));
+        }
+        return *written;
+    }
+
+    auto load_snapshot(const std::filesystem::path& path) -> Result<size_t> {
+        if (!config_.enable_cache) {
+            return to_error_info(patient_error::cache_failed, "Cache is disabled");
+        }
+        auto reader = cache::snapshot_reader::open(
+            path, cache::snapshot_kind::patient_lookup);
+        if (!reader) {
+            return to_error_info(patient_error::cache_failed,
+                                 cache::to_string(reader.error()));
+        }
+
+        size_t restored = 0;
+        reader->for_each([&](field_reader& r) {
+            auto type = static_cast<snapshot_record>(r.u8());
+            std::string key = r.str();
+            auto cached_at = r.time();
+            std::chrono::seconds ttl{r.i64()};
+
+            if (type == snapshot_record::entry) {
+                cache_entry entry{read_record(r), cached_at, ttl};
+                if (!r.ok() || entry.is_expired()) return;
+                std::unique_lock lock(cache_mutex_);
+                if (cache_.size() < config_.max_cache_entries &&
+                    !cache_.contains(key) && !negative_cache_.contains(key)) {
+                    cache_.emplace(std::move(key), std::move(entry));
+                    ++restored;
+                }
+            } else if (type == snapshot_record::negative) {
+                negative_cache_entry entry{cached_at, ttl};
+                if (!r.ok() || entry.is_expired()) return;
+                std::unique_lock lock(cache_mutex_);
+                if (!cache_.contains(key) && !negative_cache_.contains(key)) {
+                    negative_cache_.emplace(std::move(key), entry);
+                    ++restored;
+                }
+            }
+        });
+
+        stats_.restored_entries += restored;
+        return restored;
+    }
+
     cache_stats get_cache_stats() const {
         std::shared_lock lock(cache_mutex_);
         cache_stats stats;
-        stats.hits = stats_.cache_hits;
-        stats.misses = stats_.cache_misses;
+        stats.hits = stats_.cache_hits.load();
+        stats.misses = stats_.cache_misses.load();
         stats.entries = cache_.size();
         auto total = stats.hits + stats.misses;
         stats.hit_rate = total > 0
@@ -444,18 +763,114 @@ public:
     }
 
     statistics get_statistics() const noexcept {
-        return stats_;
+        return stats_.snapshot();
     }
 
     void reset_statistics() noexcept {
-        stats_ = statistics{};
+        stats_.reset();
     }
 
 private:
-    std::optional<patient_record> get_from_cache(const std::string& key) const {
+    /**
+     * @brief Lookup counters, safe to bump from callers and the refresher
+     */
+    struct counters {
+        std::atomic<size_t> total_queries{0};
+        std::atomic<size_t> successful_queries{0};
+        std::atomic<size_t> failed_queries{0};
+        std::atomic<size_t> multiple_matches{0};
+        std::atomic<size_t> cache_hits{0};
+        std::atomic<size_t> cache_misses{0};
+        std::atomic<size_t> coalesced_queries{0};
+        std::atomic<size_t> background_refreshes{0};
+        std::atomic<size_t> restored_entries{0};
+        std::atomic<int64_t> total_query_ms{0};
+
+        void add_query_time(std::chrono::steady_clock::duration elapsed) noexcept {
+            total_query_ms.fetch_add(
+                std::chrono::duration_cast<std::chrono::milliseconds>(elapsed)
+                    .count());
+        }
+
+        [[nodiscard]] statistics snapshot() const noexcept {
+            statistics result;
+            result.total_queries = total_queries.load();
+            result.successful_queries = successful_queries.load();
+            result.failed_queries = failed_queries.load();
+            result.multiple_matches = multiple_matches.load();
+            result.cache_hits = cache_hits.load();
+            result.cache_misses = cache_misses.load();
+            result.coalesced_queries = coalesced_queries.load();
+            result.background_refreshes = background_refreshes.load();
+            result.restored_entries = restored_entries.load();
+            result.total_query_time =
+                std::chrono::milliseconds{total_query_ms.load()};
+            return result;
+        }
+
+        void reset() noexcept {
+            for (auto* counter :
+                 {&total_queries, &successful_queries, &failed_queries,
+                  &multiple_matches, &cache_hits, &cache_misses,
+                  &coalesced_queries, &background_refreshes,
+                  &restored_entries}) {
+                counter->store(0);
+            }
+            total_query_ms.store(0);
+        }
+    };
+
+    /**
+     * @brief Run query, or share the result of the one in flight for key
+     */
+    template <typename Query>
+    auto coalesce(const std::string& key, Query&& query)
+        -> Result<patient_record> {
+        bool coalesced = false;
+        auto result = queries_.run(key, std::forward<Query>(query), &coalesced);
+        if (coalesced) {
+            ++stats_.coalesced_queries;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Re-run query on the background thread unless one is in flight
+     */
+    template <typename Query>
+    void schedule_refresh(const std::string& key, Query query) {
+        if (queries_.in_flight(key)) {
+            return;
+        }
+        auto task = queries_.begin(key, [this, query = std::move(query)] {
+            ++stats_.background_refreshes;
+            return query();
+        });
+        // A stopped worker would never finish the call and key would stay
+        // in flight, so query here instead
+        if (task && !refresher_.post(task)) {
+            task();
+        }
+    }
+
+    void schedule_snapshot() {
+        if (config_.snapshot_interval.count() <= 0) {
+            return;
+        }
+        snapshotter_.post_after(config_.snapshot_interval, [this] {
+            (void)save_snapshot(config_.snapshot_path);
+            schedule_snapshot();
+        });
+    }
+
+    std::optional<patient_record> get_from_cache(
+        const std::string& key, bool* refresh_due = nullptr) const {
         std::shared_lock lock(cache_mutex_);
         auto it = cache_.find(key);
         if (it != cache_.end() && !it->second.is_expired()) {
+            if (refresh_due != nullptr) {
+                *refresh_due = it->second.is_due(config_.refresh_ahead);
+            }
             return it->second.patient;
         }
         return std::nullopt;
@@ -481,6 +896,7 @@ private:
         entry.ttl = config_.cache_ttl;
 
         cache_[key] = std::move(entry);
+        negative_cache_.erase(key);
     }
 
     void add_negative_cache(const std::string& key) {
@@ -491,6 +907,13 @@ private:
         entry.ttl = config_.negative_cache_ttl;
 
         negative_cache_[key] = entry;
+        // A refresh that no longer finds the patient drops the stale record
+        cache_.erase(key);
+    }
+
+    void remove_from_cache(const std::string& key) {
+        std::unique_lock lock(cache_mutex_);
+        cache_.erase(key);
     }
 
     void evict_oldest() {
@@ -522,7 +945,12 @@ private:
     std::unordered_map<std::string, cache_entry> cache_;
     std::unordered_map<std::string, negative_cache_entry> negative_cache_;
 
-    mutable statistics stats_;
+    mutable counters stats_;
+
+    internal::single_flight<Result<patient_record>> queries_;
+    // Declared last: stopped before the state their tasks use is destroyed
+    internal::background_worker refresher_;
+    internal::background_worker snapshotter_;
 };
 
 // =============================================================================
@@ -582,6 +1010,16 @@ size_t emr_patient_lookup::prefetch(const std::vector<std::string>& mrns) {
     return impl_->prefetch(mrns);
 }
 
+auto emr_patient_lookup::save_snapshot(const std::filesystem::path& path) const
+    -> Result<size_t> {
+    return impl_->save_snapshot(path);
+}
+
+auto emr_patient_lookup::load_snapshot(const std::filesystem::path& path)
+    -> Result<size_t> {
+    return impl_->load_snapshot(path);
+}
+
 emr_patient_lookup::cache_stats emr_patient_lookup::get_cache_stats() const {
     return impl_->get_cache_stats();
 }
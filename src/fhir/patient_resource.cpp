@@ -485,12 +485,12 @@ resource_result<std::unique_ptr<fhir_resource>> patient_resource_handler::read(
 
     std::shared_lock lock(pimpl_->mutex_);
 
-    auto result = pimpl_->cache_->get(id);
+    auto result = pimpl_->cache_->get_shared(id);
     if (!result.has_value()) {
         return resource_not_found(id);
     }
 
-    return dicom_to_fhir_patient(result.value(), id);
+    return dicom_to_fhir_patient(*result.value(), id);
 }
 
 resource_result<search_result> patient_resource_handler::search(
@@ -511,12 +511,12 @@ resource_result<search_result> patient_resource_handler::search(
     std::vector<std::string> matching_keys;
 
     for (const auto& key : keys) {
-        auto patient_result = pimpl_->cache_->peek(key);
+        auto patient_result = pimpl_->cache_->peek_shared(key);
         if (!patient_result.has_value()) {
             continue;
         }
 
-        const auto& patient = patient_result.value();
+        const auto& patient = *patient_result.value();
         bool matches = true;
 
         // Check each search parameter
@@ -583,10 +583,10 @@ resource_result<search_result> patient_resource_handler::search(
     // Convert matching patients to FHIR resources
     for (size_t i = start; i < end; ++i) {
         const auto& key = matching_keys[i];
-        auto patient_result = pimpl_->cache_->peek(key);
+        auto patient_result = pimpl_->cache_->peek_shared(key);
         if (patient_result.has_value()) {
             auto fhir_patient =
-                dicom_to_fhir_patient(patient_result.value(), key);
+                dicom_to_fhir_patient(*patient_result.value(), key);
             result.entries.push_back(std::move(fhir_patient));
             result.search_modes.push_back("match");
         }
@@ -13,9 +13,12 @@
 #include <sqlite3.h>
 
 #include <algorithm>
+#include <list>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <queue>
+#include <unordered_map>
 
 namespace pacs::bridge::integration {
 
@@ -55,6 +58,87 @@ std::string_view to_string(database_error error) noexcept {
     return "Unknown database error";
 }
 
+// =============================================================================
+// Statement Cache
+// =============================================================================
+
+/**
+ * @brief Least-recently-used map from SQL text to a cached statement
+ *
+ * Index keys view the SQL stored in the list nodes, so lookups do not
+ * allocate. Evicted values are destroyed. Not thread-safe; each instance
+ * belongs to one connection.
+ */
+template <typename Value>
+class statement_lru {
+public:
+    explicit statement_lru(std::size_t capacity) : capacity_(capacity) {}
+
+    statement_lru(const statement_lru&) = delete;
+    statement_lru& operator=(const statement_lru&) = delete;
+
+    /**
+     * @brief Find the value cached for sql and mark it most recently used
+     */
+    [[nodiscard]] Value* find(std::string_view sql) {
+        auto it = index_.find(sql);
+        if (it == index_.end()) {
+            return nullptr;
+        }
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return &it->second->value;
+    }
+
+    /**
+     * @brief Remove and return the value cached for sql
+     */
+    [[nodiscard]] std::optional<Value> take(std::string_view sql) {
+        auto it = index_.find(sql);
+        if (it == index_.end()) {
+            return std::nullopt;
+        }
+        auto node = it->second;
+        index_.erase(it);
+        std::optional<Value> value(std::move(node->value));
+        lru_.erase(node);
+        return value;
+    }
+
+    /**
+     * @brief Cache value as most recently used, evicting the least recent
+     *
+     * @return The cached value, or nullptr if sql is already cached or the
+     *         cache is disabled (value is destroyed)
+     */
+    Value* insert(std::string_view sql, Value value) {
+        if (capacity_ == 0 || index_.count(sql) != 0) {
+            return nullptr;
+        }
+        if (index_.size() >= capacity_) {
+            index_.erase(std::string_view(lru_.back().sql));
+            lru_.pop_back();
+        }
+        lru_.push_front(node{std::string(sql), std::move(value)});
+        index_.emplace(std::string_view(lru_.front().sql), lru_.begin());
+        return &lru_.front().value;
+    }
+
+    void clear() {
+        index_.clear();
+        lru_.clear();
+    }
+
+private:
+    struct node {
+        std::string sql;
+        Value value;
+    };
+
+    std::size_t capacity_;
+    std::list<node> lru_;  // Most recently used first
+    std::unordered_map<std::string_view, typename std::list<node>::iterator> index_;
+};
+
 // =============================================================================
 // SQLite Row Implementation
 // =============================================================================
@@ -273,15 +357,34 @@ private:
 // SQLite Statement Implementation
 // =============================================================================
 
+struct sqlite_stmt_finalizer {
+    void operator()(sqlite3_stmt* stmt) const noexcept { sqlite3_finalize(stmt); }
+};
+
+using sqlite_stmt_handle = std::unique_ptr<sqlite3_stmt, sqlite_stmt_finalizer>;
+
+/** Idle compiled statements of one connection, keyed by SQL text */
+using sqlite_stmt_cache = statement_lru<sqlite_stmt_handle>;
+
 class sqlite_statement : public database_statement {
 public:
-    explicit sqlite_statement(sqlite3_stmt* stmt, sqlite3* db)
-        : stmt_(stmt), db_(db) {}
+    /**
+     * @param cache Idle cache the compiled statement returns to on
+     *        destruction; finalized instead if the cache is gone
+     */
+    sqlite_statement(sqlite_stmt_handle stmt, sqlite3* db,
+                     std::weak_ptr<sqlite_stmt_cache> cache = {})
+        : handle_(std::move(stmt)), stmt_(handle_.get()), db_(db), cache_(std::move(cache)) {}
 
     ~sqlite_statement() override {
-        if (stmt_) {
-            sqlite3_finalize(stmt_);
-            stmt_ = nullptr;
+        if (!handle_) {
+            return;
+        }
+        if (auto cache = cache_.lock()) {
+            sqlite3_reset(stmt_);
+            sqlite3_clear_bindings(stmt_);
+            const char* sql = sqlite3_sql(stmt_);
+            cache->insert(sql ? sql : "", std::move(handle_));
         }
     }
 
@@ -408,8 +511,10 @@ public:
     }
 
 private:
+    sqlite_stmt_handle handle_;
     sqlite3_stmt* stmt_;
     sqlite3* db_;
+    std::weak_ptr<sqlite_stmt_cache> cache_;
 };
 
 // =============================================================================
@@ -419,7 +524,11 @@ private:
 class sqlite_connection : public database_connection {
 public:
     explicit sqlite_connection(const database_config& config)
-        : db_(nullptr), config_(config), in_transaction_(false) {
+        : db_(nullptr),
+          config_(config),
+          in_transaction_(false),
+          idle_statements_(std::make_shared<sqlite_stmt_cache>(config.statement_cache_size)),
+          lent_statements_(std::max<std::size_t>(config.statement_cache_size, 1)) {
         open();
     }
 
@@ -439,15 +548,37 @@ public:
             return std::unexpected(database_error::connection_failed);
         }
 
+        // Reuse an idle compiled statement; it was reset when returned
+        if (auto cached = idle_statements_->take(sql)) {
+            return std::make_unique<sqlite_statement>(std::move(*cached), db_,
+                                                      idle_statements_);
+        }
+
         sqlite3_stmt* stmt = nullptr;
-        int rc = sqlite3_prepare_v2(db_, sql.data(), static_cast<int>(sql.size()),
-                                    &stmt, nullptr);
+        int rc = sqlite3_prepare_v3(db_, sql.data(), static_cast<int>(sql.size()),
+                                    SQLITE_PREPARE_PERSISTENT, &stmt, nullptr);
         if (rc != SQLITE_OK || !stmt) {
             last_error_ = sqlite3_errmsg(db_);
             return std::unexpected(database_error::prepare_failed);
         }
 
-        return std::make_unique<sqlite_statement>(stmt, db_);
+        return std::make_unique<sqlite_statement>(sqlite_stmt_handle(stmt), db_,
+                                                  idle_statements_);
+    }
+
+    [[nodiscard]] std::expected<database_statement*, database_error>
+    prepare_cached(std::string_view sql) override {
+        if (auto* cached = lent_statements_.find(sql)) {
+            (void)(*cached)->reset();
+            (void)(*cached)->clear_bindings();
+            return cached->get();
+        }
+
+        auto stmt = prepare(sql);
+        if (!stmt) {
+            return std::unexpected(stmt.error());
+        }
+        return lent_statements_.insert(sql, std::move(*stmt))->get();
     }
 
     [[nodiscard]] std::expected<std::unique_ptr<database_result>, database_error>
@@ -609,6 +740,11 @@ private:
     }
 
     void close() {
+        // Cached statements must be finalized before the handle closes.
+        // Lent statements return their handles to the idle cache first.
+        lent_statements_.clear();
+        idle_statements_->clear();
+        idle_statements_.reset();
         if (db_) {
             if (in_transaction_) {
                 sqlite3_exec(db_, "ROLLBACK", nullptr, nullptr, nullptr);
@@ -623,6 +759,13 @@ private:
     database_config config_;
     std::string last_error_;
     bool in_transaction_;
+
+    // Compiled statements not in use; prepare() takes from here and released
+    // statements return here. Shared with statements that may outlive close().
+    std::shared_ptr<sqlite_stmt_cache> idle_statements_;
+
+    // Statements owned by the connection for prepare_cached()
+    statement_lru<std::unique_ptr<database_statement>> lent_statements_;
 };
 
 // =============================================================================
@@ -1093,9 +1236,12 @@ private:
  */
 class pool_connection_wrapper : public database_connection {
 public:
+    /** Statements kept for prepare_cached() per checked-out connection */
+    static constexpr std::size_t pool_statement_cache_size = 64;
+
     explicit pool_connection_wrapper(
         kcenon::database::pooled_connection conn)
-        : conn_(std::move(conn)) {}
+        : conn_(std::move(conn)), statement_cache_(pool_statement_cache_size) {}
 
     ~pool_connection_wrapper() override = default;
 
@@ -1114,6 +1260,21 @@ public:
         return std::make_unique<pool_statement_wrapper>(std::move(*stmt));
     }
 
+    [[nodiscard]] std::expected<database_statement*, database_error>
+    prepare_cached(std::string_view sql) override {
+        if (auto* cached = statement_cache_.find(sql)) {
+            (void)(*cached)->reset();
+            (void)(*cached)->clear_bindings();
+            return cached->get();
+        }
+
+        auto stmt = prepare(sql);
+        if (!stmt) {
+            return std::unexpected(stmt.error());
+        }
+        return statement_cache_.insert(sql, std::move(*stmt))->get();
+    }
+
     [[nodiscard]] std::expected<std::unique_ptr<database_result>, database_error>
     execute(std::string_view sql) override {
         auto result = conn_->execute(sql);
@@ -1162,6 +1323,9 @@ public:
 
 private:
     kcenon::database::pooled_connection conn_;
+
+    // Declared last so cached statements are destroyed before conn_
+    statement_lru<std::unique_ptr<database_statement>> statement_cache_;
 };
 
 /**
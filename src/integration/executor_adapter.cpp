@@ -11,9 +11,37 @@
 #include <kcenon/thread/thread_pool.h>
 
 #include <exception>
+#include <stdexcept>
 
 namespace pacs::bridge::integration {
 
+namespace {
+
+// Runs job and settles promise with its outcome
+void run_job(kcenon::common::interfaces::IJob& job, std::promise<void>& promise) {
+    try {
+        auto result = job.execute();
+        if (result.is_ok()) {
+            promise.set_value();
+        } else {
+            promise.set_exception(std::make_exception_ptr(
+                std::runtime_error(result.error().message)));
+        }
+    } catch (...) {
+        promise.set_exception(std::current_exception());
+    }
+}
+
+// kcenon::thread::thread_pool only accepts copyable callables, so a
+// move-only task is shared by the copies
+std::function<void()> make_copyable(performance::small_task<> task) {
+    return [task = std::make_shared<performance::small_task<>>(std::move(task))] {
+        (*task)();
+    };
+}
+
+}  // namespace
+
 // =============================================================================
 // thread_pool_executor_adapter Implementation
 // =============================================================================
@@ -95,26 +123,16 @@ kcenon::common::Result<std::future<void>> thread_pool_executor_adapter::execute(
             kcenon::common::error_info{-2, "Job is null", "executor"});
     }
 
-    auto promise = std::make_shared<std::promise<void>>();
-    auto future = promise->get_future();
-    auto shared_job = std::shared_ptr<kcenon::common::interfaces::IJob>(std::move(job));
+    std::promise<void> promise;
+    auto future = promise.get_future();
 
     pending_count_.fetch_add(1, std::memory_order_release);
 
-    pool_->submit_task([this, shared_job, promise]() {
-        try {
-            auto result = shared_job->execute();
-            if (result.is_ok()) {
-                promise->set_value();
-            } else {
-                promise->set_exception(std::make_exception_ptr(
-                    std::runtime_error(result.error().message)));
-            }
-        } catch (...) {
-            promise->set_exception(std::current_exception());
-        }
-        pending_count_.fetch_sub(1, std::memory_order_release);
-    });
+    pool_->submit_task(make_copyable(
+        [this, job = std::move(job), promise = std::move(promise)]() mutable {
+            run_job(*job, promise);
+            pending_count_.fetch_sub(1, std::memory_order_release);
+        }));
 
     return kcenon::common::Result<std::future<void>>(std::move(future));
 }
@@ -132,9 +150,8 @@ kcenon::common::Result<std::future<void>> thread_pool_executor_adapter::execute_
             kcenon::common::error_info{-2, "Job is null", "executor"});
     }
 
-    auto promise = std::make_shared<std::promise<void>>();
-    auto future = promise->get_future();
-    auto shared_job = std::shared_ptr<kcenon::common::interfaces::IJob>(std::move(job));
+    std::promise<void> promise;
+    auto future = promise.get_future();
 
     pending_count_.fetch_add(1, std::memory_order_release);
 
@@ -142,21 +159,13 @@ kcenon::common::Result<std::future<void>> thread_pool_executor_adapter::execute_
         std::lock_guard<std::mutex> lock(delay_mutex_);
         delayed_tasks_.push(delayed_task{
             std::chrono::steady_clock::now() + delay,
-            [this, shared_job, promise]() {
-                pool_->submit_task([this, shared_job, promise]() {
-                    try {
-                        auto result = shared_job->execute();
-                        if (result.is_ok()) {
-                            promise->set_value();
-                        } else {
-                            promise->set_exception(std::make_exception_ptr(
-                                std::runtime_error(result.error().message)));
-                        }
-                    } catch (...) {
-                        promise->set_exception(std::current_exception());
-                    }
-                    pending_count_.fetch_sub(1, std::memory_order_release);
-                });
+            [this, job = std::move(job), promise = std::move(promise)]() mutable {
+                pool_->submit_task(make_copyable(
+                    [this, job = std::move(job),
+                     promise = std::move(promise)]() mutable {
+                        run_job(*job, promise);
+                        pending_count_.fetch_sub(1, std::memory_order_release);
+                    }));
             }});
     }
     delay_cv_.notify_one();
@@ -216,7 +225,7 @@ simple_executor::~simple_executor() {
 
 void simple_executor::worker_loop() {
     while (true) {
-        std::function<void()> task;
+        performance::small_task<> task;
 
         {
             std::unique_lock<std::mutex> lock(queue_mutex_);
@@ -296,28 +305,18 @@ kcenon::common::Result<std::future<void>> simple_executor::execute(
             kcenon::common::error_info{-2, "Job is null", "executor"});
     }
 
-    auto promise = std::make_shared<std::promise<void>>();
-    auto future = promise->get_future();
-    auto shared_job = std::shared_ptr<kcenon::common::interfaces::IJob>(std::move(job));
+    std::promise<void> promise;
+    auto future = promise.get_future();
 
     pending_count_.fetch_add(1, std::memory_order_release);
 
     {
         std::lock_guard<std::mutex> lock(queue_mutex_);
-        task_queue_.push([this, shared_job, promise]() {
-            try {
-                auto result = shared_job->execute();
-                if (result.is_ok()) {
-                    promise->set_value();
-                } else {
-                    promise->set_exception(std::make_exception_ptr(
-                        std::runtime_error(result.error().message)));
-                }
-            } catch (...) {
-                promise->set_exception(std::current_exception());
-            }
-            pending_count_.fetch_sub(1, std::memory_order_release);
-        });
+        task_queue_.push(
+            [this, job = std::move(job), promise = std::move(promise)]() mutable {
+                run_job(*job, promise);
+                pending_count_.fetch_sub(1, std::memory_order_release);
+            });
     }
     queue_cv_.notify_one();
 
@@ -337,9 +336,8 @@ kcenon::common::Result<std::future<void>> simple_executor::execute_delayed(
             kcenon::common::error_info{-2, "Job is null", "executor"});
     }
 
-    auto promise = std::make_shared<std::promise<void>>();
-    auto future = promise->get_future();
-    auto shared_job = std::shared_ptr<kcenon::common::interfaces::IJob>(std::move(job));
+    std::promise<void> promise;
+    auto future = promise.get_future();
 
     pending_count_.fetch_add(1, std::memory_order_release);
 
@@ -347,18 +345,8 @@ kcenon::common::Result<std::future<void>> simple_executor::execute_delayed(
         std::lock_guard<std::mutex> lock(delay_mutex_);
         delayed_tasks_.push(delayed_task{
             std::chrono::steady_clock::now() + delay,
-            [this, shared_job, promise]() {
-                try {
-                    auto result = shared_job->execute();
-                    if (result.is_ok()) {
-                        promise->set_value();
-                    } else {
-                        promise->set_exception(std::make_exception_ptr(
-                            std::runtime_error(result.error().message)));
-                    }
-                } catch (...) {
-                    promise->set_exception(std::current_exception());
-                }
+            [this, job = std::move(job), promise = std::move(promise)]() mutable {
+                run_job(*job, promise);
                 pending_count_.fetch_sub(1, std::memory_order_release);
             }});
     }
@@ -98,14 +98,16 @@ public:
     }
 
 protected:
-    void submit_internal(std::function<void()> task,
+    bool submit_internal(std::function<void()> task,
                          task_priority /*priority*/) override {
+        std::lock_guard<std::mutex> lock(mutex_);
         if (!pool_ || !running_.load(std::memory_order_acquire)) {
-            return;
+            return false;
         }
 
         // thread_pool's submit returns a future; we discard it for fire-and-forget
         (void)pool_->submit(std::move(task));
+        return true;
     }
 
 private:
@@ -164,6 +166,13 @@ public:
                 return;
             }
             running_.store(false, std::memory_order_release);
+
+            // Drop queued tasks if not waiting; otherwise workers drain them
+            if (!wait_for_completion) {
+                while (!task_queue_.empty()) {
+                    task_queue_.pop();
+                }
+            }
         }
 
         // Wake up all workers
@@ -176,14 +185,6 @@ public:
             }
         }
         workers_.clear();
-
-        // Clear remaining tasks if not waiting
-        if (!wait_for_completion) {
-            std::lock_guard<std::mutex> lock(mutex_);
-            while (!task_queue_.empty()) {
-                task_queue_.pop();
-            }
-        }
     }
 
     [[nodiscard]] size_t queue_size() const noexcept override {
@@ -200,17 +201,18 @@ public:
     }
 
 protected:
-    void submit_internal(std::function<void()> task,
+    bool submit_internal(std::function<void()> task,
                          task_priority priority) override {
-        if (!running_.load(std::memory_order_acquire)) {
-            return;
-        }
-
         {
+            // Checked under the lock so shutdown() cannot strand the task
             std::lock_guard<std::mutex> lock(mutex_);
+            if (!running_.load(std::memory_order_acquire)) {
+                return false;
+            }
             task_queue_.push(prioritized_task{priority, std::move(task)});
         }
         cv_.notify_one();
+        return true;
     }
 
 private:
@@ -225,7 +227,7 @@ private:
     };
 
     void worker_loop() {
-        while (running_.load(std::memory_order_acquire)) {
+        for (;;) {
             std::function<void()> task;
 
             {
@@ -108,6 +108,28 @@ hl7_dicom_mapper& hl7_dicom_mapper::operator=(hl7_dicom_mapper&&) noexcept = def
 
 Result<mwl_item> hl7_dicom_mapper::to_mwl(
     const hl7::hl7_message& message) const {
+    return map_mwl(message);
+}
+
+Result<mwl_item> hl7_dicom_mapper::to_mwl(
+    const hl7::hl7_flat_message& message) const {
+    return map_mwl(message);
+}
+
+Result<dicom_patient> hl7_dicom_mapper::to_patient(
+    const hl7::hl7_message& message) const {
+    return map_patient(message);
+}
+
+Result<dicom_patient> hl7_dicom_mapper::to_patient(
+    const hl7::hl7_flat_message& message) const {
+    return map_patient(message);
+}
+
+// Shared by hl7_message (segment pointers) and hl7_flat_message (segment
+// views); both expose the same field/component accessors.
+template <typename Message>
+Result<mwl_item> hl7_dicom_mapper::map_mwl(const Message& message) const {
     // Start tracing span for HL7 to DICOM mapping
     auto span = tracing::trace_manager::instance().start_span(
         "hl7_to_dicom", tracing::span_kind::internal);
@@ -129,7 +151,7 @@ Result<mwl_item> hl7_dicom_mapper::to_mwl(
     mwl.hl7_message_control_id = header.message_control_id;
 
     // Map patient information (PID segment)
-    const auto* pid = message.segment("PID");
+    auto pid = message.segment("PID");
     if (pid) {
         // Patient ID (PID-3)
         std::string_view pid3 = pid->field_value(3);
@@ -160,7 +182,7 @@ Result<mwl_item> hl7_dicom_mapper::to_mwl(
     }
 
     // Map order information (ORC segment)
-    const auto* orc = message.segment("ORC");
+    auto orc = message.segment("ORC");
     if (orc) {
         // Placer Order Number (ORC-2)
         mwl.imaging_service_request.placer_order_number =
@@ -184,7 +206,7 @@ Result<mwl_item> hl7_dicom_mapper::to_mwl(
     }
 
     // Map observation request (OBR segment)
-    const auto* obr = message.segment("OBR");
+    auto obr = message.segment("OBR");
     if (obr) {
         // Accession Number: OBR-3 (Filler Order Number), fallback to OBR-18
         std::string_view accession = obr->field(3).component(1).value();
@@ -305,8 +327,9 @@ Result<mwl_item> hl7_dicom_mapper::to_mwl(
     return Result<mwl_item>::ok(std::move(mwl));
 }
 
-Result<dicom_patient> hl7_dicom_mapper::to_patient(
-    const hl7::hl7_message& message) const {
+template <typename Message>
+Result<dicom_patient> hl7_dicom_mapper::map_patient(
+    const Message& message) const {
     auto header = message.header();
 
     // ADT and ORM messages are acceptable
@@ -317,7 +340,7 @@ Result<dicom_patient> hl7_dicom_mapper::to_patient(
             to_string(mapping_error::unsupported_message_type)});
     }
 
-    const auto* pid = message.segment("PID");
+    auto pid = message.segment("PID");
     if (!pid) {
         return Result<dicom_patient>::err(error_info{
             static_cast<int>(mapping_error::missing_required_field),
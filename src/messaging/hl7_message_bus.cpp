@@ -7,15 +7,17 @@
  */
 
 #include "pacs/bridge/messaging/hl7_message_bus.h"
+#include "pacs/bridge/internal/atomic_shared_ptr.h"
+#include "pacs/bridge/internal/sharded_counter.h"
 #include "pacs/bridge/protocol/hl7/hl7_parser.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cctype>
+#include <map>
 #include <mutex>
-#include <shared_mutex>
 #include <unordered_map>
-#include <map>
 
 #ifndef PACS_BRIDGE_STANDALONE_BUILD
 #include <kcenon/messaging/core/message_bus.h>
@@ -59,6 +61,161 @@ std::string build_topic(const hl7::hl7_message& message) {
 
 }  // namespace topics
 
+// =============================================================================
+// Topic Index
+// =============================================================================
+
+namespace {
+
+/**
+ * @brief Heterogeneous string hash for string_view lookups
+ */
+struct string_hash {
+    using is_transparent = void;
+    size_t operator()(std::string_view value) const noexcept {
+        return std::hash<std::string_view>{}(value);
+    }
+};
+
+template <typename Value>
+using string_map =
+    std::unordered_map<std::string, Value, string_hash, std::equal_to<>>;
+
+/**
+ * @brief Topic pattern index resolving a topic in a few hash lookups
+ *
+ * Patterns are indexed by kind:
+ * - exact: the whole pattern
+ * - '#' suffix: the prefix before '#'; matches any topic with that prefix
+ * - '*' suffix: the prefix before '*'; matches when the rest of the topic
+ *   has no further level
+ *
+ * A topic is resolved by one exact lookup plus one lookup per distinct
+ * wildcard prefix length, independent of the number of subscriptions.
+ */
+class topic_index {
+public:
+    void add(std::string_view pattern, uint32_t position) {
+        if (pattern.ends_with('#')) {
+            insert(multi_level_, multi_lengths_,
+                   pattern.substr(0, pattern.size() - 1), position);
+        } else if (pattern.ends_with('*')) {
+            insert(single_level_, single_lengths_,
+                   pattern.substr(0, pattern.size() - 1), position);
+        } else {
+            exact_[std::string(pattern)].push_back(position);
+        }
+    }
+
+    /**
+     * @brief Append positions of patterns matching the topic, sorted
+     */
+    void collect(std::string_view topic, std::vector<uint32_t>& out) const {
+        out.clear();
+        visit(topic, [&](const std::vector<uint32_t>& positions) {
+            out.insert(out.end(), positions.begin(), positions.end());
+            return false;
+        });
+        std::sort(out.begin(), out.end());
+    }
+
+    [[nodiscard]] bool any(std::string_view topic) const {
+        return visit(topic, [](const std::vector<uint32_t>&) { return true; });
+    }
+
+private:
+    static void insert(string_map<std::vector<uint32_t>>& map,
+                       std::vector<size_t>& lengths, std::string_view prefix,
+                       uint32_t position) {
+        map[std::string(prefix)].push_back(position);
+        if (std::find(lengths.begin(), lengths.end(), prefix.size()) ==
+            lengths.end()) {
+            lengths.push_back(prefix.size());
+        }
+    }
+
+    // Calls fn for each matching bucket; stops early when fn returns true
+    template <typename Fn>
+    bool visit(std::string_view topic, Fn&& fn) const {
+        if (auto it = exact_.find(topic); it != exact_.end() && fn(it->second)) {
+            return true;
+        }
+        for (size_t length : multi_lengths_) {
+            if (length > topic.size()) {
+                continue;
+            }
+            auto it = multi_level_.find(topic.substr(0, length));
+            if (it != multi_level_.end() && fn(it->second)) {
+                return true;
+            }
+        }
+        for (size_t length : single_lengths_) {
+            if (length > topic.size() ||
+                topic.find('.', length) != std::string_view::npos) {
+                continue;
+            }
+            auto it = single_level_.find(topic.substr(0, length));
+            if (it != single_level_.end() && fn(it->second)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    string_map<std::vector<uint32_t>> exact_;
+    string_map<std::vector<uint32_t>> multi_level_;
+    string_map<std::vector<uint32_t>> single_level_;
+    std::vector<size_t> multi_lengths_;
+    std::vector<size_t> single_lengths_;
+};
+
+/**
+ * @brief Per-topic publish counts, sharded by publishing thread
+ */
+class topic_counter {
+public:
+    void increment(std::string_view topic) {
+        auto& shard = shards_[internal::thread_shard_index<shard_count>()];
+        std::lock_guard lock(shard.mutex);
+        auto it = shard.counts.find(topic);
+        if (it == shard.counts.end()) {
+            shard.counts.emplace(std::string(topic), 1);
+        } else {
+            ++it->second;
+        }
+    }
+
+    [[nodiscard]] std::map<std::string, uint64_t> collect() const {
+        std::map<std::string, uint64_t> totals;
+        for (auto& shard : shards_) {
+            std::lock_guard lock(shard.mutex);
+            for (const auto& [topic, count] : shard.counts) {
+                totals[topic] += count;
+            }
+        }
+        return totals;
+    }
+
+    void reset() {
+        for (auto& shard : shards_) {
+            std::lock_guard lock(shard.mutex);
+            shard.counts.clear();
+        }
+    }
+
+private:
+    static constexpr size_t shard_count = internal::sharded_counter::shard_count;
+
+    struct alignas(64) shard {
+        mutable std::mutex mutex;
+        string_map<uint64_t> counts;
+    };
+
+    mutable std::array<shard, shard_count> shards_;
+};
+
+}  // namespace
+
 // =============================================================================
 // HL7 Message Bus Implementation
 // =============================================================================
@@ -69,6 +226,7 @@ public:
         : config_(config)
         , running_(false)
         , next_subscription_id_(1) {
+        table_.store(std::make_shared<const subscription_table>());
     }
 
     ~impl() {
@@ -76,7 +234,7 @@ public:
     }
 
     std::expected<void, message_bus_error> start() {
-        std::unique_lock lock(mutex_);
+        std::lock_guard lock(mutex_);
 
         if (running_.load()) {
             return std::unexpected(message_bus_error::already_started);
@@ -114,7 +272,7 @@ public:
     }
 
     void stop() {
-        std::unique_lock lock(mutex_);
+        std::lock_guard lock(mutex_);
 
         if (!running_.load()) {
             return;
@@ -131,7 +289,8 @@ public:
 #endif
 
         // Clear subscriptions
-        subscriptions_.clear();
+        entries_.clear();
+        publish_table();
     }
 
     bool is_running() const noexcept {
@@ -143,12 +302,24 @@ public:
         message_priority priority) {
 
         auto topic = topics::build_topic(message);
-        return publish(topic, message, priority);
+        return publish(topic, message, nullptr, priority);
     }
 
+    std::expected<void, message_bus_error> publish(
+        const message_ptr& message,
+        message_priority priority) {
+
+        auto topic = topics::build_topic(*message);
+        return publish(topic, *message, message, priority);
+    }
+
+    /**
+     * @param shared Handle to message, if the publisher already holds one
+     */
     std::expected<void, message_bus_error> publish(
         std::string_view topic,
         const hl7::hl7_message& message,
+        message_ptr shared,
         message_priority priority) {
 
         if (!running_.load()) {
@@ -156,6 +327,7 @@ public:
         }
 
 #ifndef PACS_BRIDGE_STANDALONE_BUILD
+        (void)shared;
         try {
             // Convert HL7 message to messaging_system message
             kcenon::messaging::message msg(std::string(topic),
@@ -188,9 +360,8 @@ public:
 
             // Update statistics
             if (config_.enable_statistics) {
-                std::unique_lock lock(stats_mutex_);
-                stats_.messages_published++;
-                topic_counts_[std::string(topic)]++;
+                stats_.messages_published.increment();
+                topic_counts_.increment(topic);
             }
 
             return {};
@@ -198,36 +369,46 @@ public:
             return std::unexpected(message_bus_error::publish_failed);
         }
 #else
-        // Standalone mode: direct delivery to local subscribers
-        std::shared_lock lock(mutex_);
+        (void)priority;
 
-        for (const auto& [id, sub] : subscriptions_) {
-            if (!sub.active) continue;
+        // Standalone mode: direct delivery to local subscribers. The table is
+        // immutable, so delivery takes no lock.
+        auto table = load_table();
 
-            if (matches_pattern(topic, sub.topic_pattern)) {
-                // Apply filter if present
-                if (sub.filter && !sub.filter(message)) {
-                    continue;
-                }
+        // Not thread_local: a callback may publish re-entrantly
+        std::vector<uint32_t> matched;
+        table->index.collect(topic, matched);
 
-                // Invoke callback
-                auto result = sub.callback(message);
+        size_t delivered = 0;
+        for (uint32_t position : matched) {
+            const auto& sub = *table->entries[position];
 
-                if (config_.enable_statistics) {
-                    std::unique_lock stats_lock(stats_mutex_);
-                    stats_.messages_delivered++;
-                }
+            // Apply filter if present
+            if (sub.filter && !sub.filter(message)) {
+                continue;
+            }
 
-                if (result.stop_propagation) {
-                    break;
+            // Invoke callback; shared subscribers get one handle per publish
+            subscription_result result;
+            if (sub.shared_callback) {
+                if (!shared) {
+                    shared = std::make_shared<const hl7::hl7_message>(message);
                 }
+                result = sub.shared_callback(shared);
+            } else {
+                result = sub.callback(message);
+            }
+            ++delivered;
+
+            if (result.stop_propagation) {
+                break;
             }
         }
 
         if (config_.enable_statistics) {
-            std::unique_lock stats_lock(stats_mutex_);
-            stats_.messages_published++;
-            topic_counts_[std::string(topic)]++;
+            stats_.messages_delivered.add(delivered);
+            stats_.messages_published.increment();
+            topic_counts_.increment(topic);
         }
 
         return {};
@@ -237,6 +418,7 @@ public:
     std::expected<subscription_handle, message_bus_error> subscribe(
         std::string_view topic_pattern,
         message_callback callback,
+        shared_message_callback shared_callback,
         message_filter filter,
         int priority) {
 
@@ -248,29 +430,24 @@ public:
             return std::unexpected(message_bus_error::invalid_topic);
         }
 
-        std::unique_lock lock(mutex_);
+        std::lock_guard lock(mutex_);
 
-        subscription_info sub;
-        sub.id = next_subscription_id_++;
-        sub.topic_pattern = std::string(topic_pattern);
-        sub.callback = std::move(callback);
-        sub.filter = std::move(filter);
-        sub.priority = priority;
-        sub.active = true;
+        auto sub = std::make_shared<subscription_info>();
+        sub->id = next_subscription_id_++;
+        sub->topic_pattern = std::string(topic_pattern);
+        sub->callback = std::move(callback);
+        sub->shared_callback = std::move(shared_callback);
+        sub->filter = std::move(filter);
+        sub->priority = priority;
 
 #ifndef PACS_BRIDGE_STANDALONE_BUILD
-        // Subscribe to messaging_system
+        // Subscribe to messaging_system; the callback owns its subscription
         auto result = message_bus_->subscribe(
             std::string(topic_pattern),
-            [this, sub_id = sub.id](const kcenon::messaging::message& msg)
+            [this, sub_info = std::shared_ptr<const subscription_info>(sub)](
+                const kcenon::messaging::message& msg)
                 -> kcenon::common::VoidResult {
 
-                std::shared_lock lock(mutex_);
-                auto it = subscriptions_.find(sub_id);
-                if (it == subscriptions_.end() || !it->second.active) {
-                    return kcenon::common::ok();
-                }
-
                 // Convert messaging_system message to HL7 message
                 auto raw_opt = msg.payload().get_value("raw_message");
                 if (!raw_opt || raw_opt->type != container_module::value_types::string_value) {
@@ -284,19 +461,22 @@ public:
                     return kcenon::common::ok();
                 }
 
-                const auto& sub_info = it->second;
-
                 // Apply filter
-                if (sub_info.filter && !sub_info.filter(parse_result.value())) {
+                if (sub_info->filter && !sub_info->filter(parse_result.value())) {
                     return kcenon::common::ok();
                 }
 
                 // Invoke callback
-                auto cb_result = sub_info.callback(parse_result.value());
+                if (sub_info->shared_callback) {
+                    (void)sub_info->shared_callback(
+                        std::make_shared<const hl7::hl7_message>(
+                            std::move(parse_result.value())));
+                } else {
+                    (void)sub_info->callback(parse_result.value());
+                }
 
                 if (config_.enable_statistics) {
-                    std::unique_lock stats_lock(stats_mutex_);
-                    stats_.messages_delivered++;
+                    stats_.messages_delivered.increment();
                 }
 
                 return kcenon::common::ok();
@@ -308,13 +488,14 @@ public:
             return std::unexpected(message_bus_error::subscribe_failed);
         }
 
-        sub.internal_id = result.value();
+        sub->internal_id = result.value();
 #endif
 
-        subscriptions_[sub.id] = std::move(sub);
+        entries_.push_back(std::move(sub));
+        publish_table();
 
         subscription_handle handle;
-        handle.id = sub.id;
+        handle.id = entries_.back()->id;
         handle.topic_pattern = std::string(topic_pattern);
         handle.active = true;
 
@@ -324,64 +505,57 @@ public:
     std::expected<void, message_bus_error> unsubscribe(
         const subscription_handle& handle) {
 
-        std::unique_lock lock(mutex_);
+        std::lock_guard lock(mutex_);
 
-        auto it = subscriptions_.find(handle.id);
-        if (it == subscriptions_.end()) {
+        auto it = std::find_if(entries_.begin(), entries_.end(),
+                               [&](const auto& sub) { return sub->id == handle.id; });
+        if (it == entries_.end()) {
             return std::unexpected(message_bus_error::subscription_not_found);
         }
 
 #ifndef PACS_BRIDGE_STANDALONE_BUILD
         if (message_bus_) {
-            message_bus_->unsubscribe(it->second.internal_id);
+            message_bus_->unsubscribe((*it)->internal_id);
         }
 #endif
 
-        subscriptions_.erase(it);
+        entries_.erase(it);
+        publish_table();
         return {};
     }
 
     void unsubscribe_all() {
-        std::unique_lock lock(mutex_);
+        std::lock_guard lock(mutex_);
 
 #ifndef PACS_BRIDGE_STANDALONE_BUILD
         if (message_bus_) {
-            for (const auto& [id, sub] : subscriptions_) {
-                message_bus_->unsubscribe(sub.internal_id);
+            for (const auto& sub : entries_) {
+                message_bus_->unsubscribe(sub->internal_id);
             }
         }
 #endif
 
-        subscriptions_.clear();
+        entries_.clear();
+        publish_table();
     }
 
     size_t subscription_count() const noexcept {
-        std::shared_lock lock(mutex_);
-        return subscriptions_.size();
+        return load_table()->entries.size();
     }
 
     bool has_subscribers(std::string_view topic) const noexcept {
-        std::shared_lock lock(mutex_);
-
-        for (const auto& [id, sub] : subscriptions_) {
-            if (sub.active && matches_pattern(topic, sub.topic_pattern)) {
-                return true;
-            }
-        }
-        return false;
+        return load_table()->index.any(topic);
     }
 
     hl7_message_bus::statistics get_statistics() const {
-        std::shared_lock lock(stats_mutex_);
-
         statistics stats;
-        stats.messages_published = stats_.messages_published;
-        stats.messages_delivered = stats_.messages_delivered;
-        stats.messages_failed = stats_.messages_failed;
-        stats.dead_letter_count = stats_.dead_letter_count;
-        stats.active_subscriptions = subscriptions_.size();
+        stats.messages_published = stats_.messages_published.load();
+        stats.messages_delivered = stats_.messages_delivered.load();
+        stats.messages_failed = stats_.messages_failed.load();
+        stats.dead_letter_count = stats_.dead_letter_count.load();
+        stats.active_subscriptions = subscription_count();
 
-        for (const auto& [topic, count] : topic_counts_) {
+        for (const auto& [topic, count] : topic_counts_.collect()) {
             stats.topic_counts.emplace_back(topic, count);
         }
 
@@ -389,9 +563,11 @@ public:
     }
 
     void reset_statistics() {
-        std::unique_lock lock(stats_mutex_);
-        stats_ = internal_statistics{};
-        topic_counts_.clear();
+        stats_.messages_published.reset();
+        stats_.messages_delivered.reset();
+        stats_.messages_failed.reset();
+        stats_.dead_letter_count.reset();
+        topic_counts_.reset();
     }
 
     const hl7_message_bus_config& config() const noexcept {
@@ -404,45 +580,65 @@ private:
         uint64_t internal_id = 0;  // messaging_system subscription ID
         std::string topic_pattern;
         message_callback callback;
+        shared_message_callback shared_callback;
         message_filter filter;
         int priority = 5;
-        bool active = false;
+    };
+
+    /**
+     * @brief Immutable snapshot of the subscriptions, in delivery order
+     *
+     * Rebuilt on every subscribe/unsubscribe and swapped in atomically;
+     * publishers keep the snapshot they loaded until they finish.
+     */
+    struct subscription_table {
+        /** Highest priority first, then subscription order */
+        std::vector<std::shared_ptr<const subscription_info>> entries;
+
+        /** Topic pattern -> positions in entries */
+        topic_index index;
     };
 
     struct internal_statistics {
-        uint64_t messages_published = 0;
-        uint64_t messages_delivered = 0;
-        uint64_t messages_failed = 0;
-        uint64_t dead_letter_count = 0;
+        internal::sharded_counter messages_published;
+        internal::sharded_counter messages_delivered;
+        internal::sharded_counter messages_failed;
+        internal::sharded_counter dead_letter_count;
     };
 
-    static bool matches_pattern(std::string_view topic,
-                                 std::string_view pattern) {
-        // Simple pattern matching with * and #
-        if (pattern == topic) return true;
-        if (pattern.ends_with("#")) {
-            auto prefix = pattern.substr(0, pattern.size() - 1);
-            return topic.starts_with(prefix);
-        }
-        if (pattern.ends_with("*")) {
-            auto prefix = pattern.substr(0, pattern.size() - 1);
-            if (!topic.starts_with(prefix)) return false;
-            auto remainder = topic.substr(prefix.size());
-            return remainder.find('.') == std::string_view::npos;
+    [[nodiscard]] std::shared_ptr<const subscription_table> load_table() const noexcept {
+        return table_.load();
+    }
+
+    // Caller holds mutex_
+    void publish_table() {
+        auto table = std::make_shared<subscription_table>();
+        table->entries.assign(entries_.begin(), entries_.end());
+        std::stable_sort(table->entries.begin(), table->entries.end(),
+                         [](const auto& a, const auto& b) {
+                             return a->priority > b->priority;
+                         });
+        for (size_t i = 0; i < table->entries.size(); ++i) {
+            table->index.add(table->entries[i]->topic_pattern,
+                             static_cast<uint32_t>(i));
         }
-        return false;
+        table_.store(std::shared_ptr<const subscription_table>(std::move(table)));
     }
 
     hl7_message_bus_config config_;
     std::atomic<bool> running_;
     std::atomic<uint64_t> next_subscription_id_;
 
-    mutable std::shared_mutex mutex_;
-    std::unordered_map<uint64_t, subscription_info> subscriptions_;
+    /** Serializes lifecycle and subscription changes; never held by publish */
+    std::mutex mutex_;
+
+    /** Current subscriptions in subscription order (guarded by mutex_) */
+    std::vector<std::shared_ptr<subscription_info>> entries_;
+
+    internal::atomic_shared_ptr<const subscription_table> table_;
 
-    mutable std::shared_mutex stats_mutex_;
     internal_statistics stats_;
-    std::unordered_map<std::string, uint64_t> topic_counts_;
+    topic_counter topic_counts_;
 
 #ifndef PACS_BRIDGE_STANDALONE_BUILD
     std::shared_ptr<kcenon::messaging::standalone_backend> backend_;
@@ -489,7 +685,26 @@ std::expected<void, message_bus_error> hl7_message_bus::publish(
     std::string_view topic,
     const hl7::hl7_message& message,
     message_priority priority) {
-    return pimpl_->publish(topic, message, priority);
+    return pimpl_->publish(topic, message, nullptr, priority);
+}
+
+std::expected<void, message_bus_error> hl7_message_bus::publish(
+    const message_ptr& message,
+    message_priority priority) {
+    if (!message) {
+        return std::unexpected(message_bus_error::publish_failed);
+    }
+    return pimpl_->publish(message, priority);
+}
+
+std::expected<void, message_bus_error> hl7_message_bus::publish(
+    std::string_view topic,
+    const message_ptr& message,
+    message_priority priority) {
+    if (!message) {
+        return std::unexpected(message_bus_error::publish_failed);
+    }
+    return pimpl_->publish(topic, *message, message, priority);
 }
 
 std::expected<subscription_handle, message_bus_error> hl7_message_bus::subscribe(
@@ -497,7 +712,16 @@ std::expected<subscription_handle, message_bus_error> hl7_message_bus::subscribe
     message_callback callback,
     message_filter filter,
     int priority) {
-    return pimpl_->subscribe(topic_pattern, std::move(callback),
+    return pimpl_->subscribe(topic_pattern, std::move(callback), nullptr,
+                              std::move(filter), priority);
+}
+
+std::expected<subscription_handle, message_bus_error>
+hl7_message_bus::subscribe_shared(std::string_view topic_pattern,
+                                  shared_message_callback callback,
+                                  message_filter filter,
+                                  int priority) {
+    return pimpl_->subscribe(topic_pattern, nullptr, std::move(callback),
                               std::move(filter), priority);
 }
 
@@ -8,13 +8,19 @@
 
 #include "pacs/bridge/messaging/hl7_pipeline.h"
 #include "pacs/bridge/messaging/hl7_message_bus.h"
+#include "pacs/bridge/performance/lockfree_queue.h"
 #include "pacs/bridge/protocol/hl7/hl7_parser.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <mutex>
+#include <queue>
 #include <shared_mutex>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace pacs::bridge::messaging {
@@ -234,6 +240,46 @@ public:
         return process(parse_result.value());
     }
 
+    std::future<std::expected<hl7::hl7_message, pipeline_error>> submit(
+        hl7::hl7_message message) {
+
+        if (config_.execution != pipeline_execution::staged) {
+            std::promise<std::expected<hl7::hl7_message, pipeline_error>> done;
+            done.set_value(process(message));
+            return done.get_future();
+        }
+
+        auto runtime = acquire_runtime();
+
+        auto job = std::make_shared<staged_job>();
+        job->message = std::move(message);
+        job->started = std::chrono::steady_clock::now();
+        auto future = job->done.get_future();
+
+        // Counted before checking accepting, so stop() cannot miss it
+        runtime->in_flight.fetch_add(1);
+        if (!runtime->accepting.load()) {
+            complete(*runtime, *job, std::unexpected(pipeline_error::not_started));
+            return future;
+        }
+
+        if (runtime->stages.empty()) {
+            auto result = std::move(job->message);
+            complete(*runtime, *job, std::move(result));
+            return future;
+        }
+
+        if (!enqueue(*runtime, 0, job, config_.enqueue_timeout)) {
+            complete(*runtime, *job, std::unexpected(pipeline_error::queue_full));
+        }
+        return future;
+    }
+
+    size_t in_flight() const noexcept {
+        std::lock_guard lock(runtime_mutex_);
+        return runtime_ ? runtime_->in_flight.load() : 0;
+    }
+
     std::expected<void, pipeline_error> start(
         std::shared_ptr<hl7_message_bus> bus) {
 
@@ -251,6 +297,12 @@ public:
         if (!config_.input_topic.empty()) {
             auto sub_result = bus_->subscribe(config_.input_topic,
                 [this](const hl7::hl7_message& msg) {
+                    if (config_.execution == pipeline_execution::staged) {
+                        // The last stage publishes to the output topic
+                        (void)submit(msg);
+                        return subscription_result::ok();
+                    }
+
                     auto result = process(msg);
 
                     if (result && !config_.output_topic.empty()) {
@@ -272,14 +324,15 @@ public:
     }
 
     void stop() {
-        if (!running_.load()) {
-            return;
+        bool was_running = running_.exchange(false);
+        if (was_running && bus_) {
+            (void)bus_->unsubscribe(subscription_);
         }
 
-        running_.store(false);
+        // Completing staged messages may still publish to the bus
+        shutdown_runtime();
 
-        if (bus_) {
-            (void)bus_->unsubscribe(subscription_);
+        if (was_running) {
             bus_.reset();
         }
     }
@@ -304,6 +357,20 @@ public:
         }
 
         // Stage statistics
+        std::unordered_map<std::string, const stage_runtime*> queues;
+        std::lock_guard runtime_lock(runtime_mutex_);
+        if (runtime_) {
+            for (const auto& stage : runtime_->stages) {
+                queues.emplace(stage->stage.id, stage.get());
+                if (!stage_stats_.contains(stage->stage.id)) {
+                    statistics::stage_stats ss;
+                    ss.stage_id = stage->stage.id;
+                    fill_queue_stats(ss, *stage);
+                    stats.stage_statistics.push_back(ss);
+                }
+            }
+        }
+
         for (const auto& [stage_id, stage_stats] : stage_stats_) {
             statistics::stage_stats ss;
             ss.stage_id = stage_id;
@@ -317,6 +384,10 @@ public:
                     static_cast<double>(stage_stats.invocations);
             }
 
+            if (auto it = queues.find(stage_id); it != queues.end()) {
+                fill_queue_stats(ss, *it->second);
+            }
+
             stats.stage_statistics.push_back(ss);
         }
 
@@ -354,6 +425,336 @@ private:
         uint64_t total_time_us = 0;
     };
 
+    // -------------------------------------------------------------------------
+    // Staged execution
+    // -------------------------------------------------------------------------
+
+    using stage_task = std::function<void()>;
+    using stage_queue = performance::lockfree_queue<stage_task>;
+
+    /**
+     * @brief A message travelling through the stages
+     */
+    struct staged_job {
+        hl7::hl7_message message;
+        std::promise<std::expected<hl7::hl7_message, pipeline_error>> done;
+        std::chrono::steady_clock::time_point started;
+
+        /** Failed attempts at the current stage */
+        size_t attempts = 0;
+    };
+
+    /**
+     * @brief One stage's queue and workers
+     */
+    struct stage_runtime {
+        pipeline_stage stage;
+        std::unique_ptr<stage_queue> queue;
+        std::vector<std::thread> workers;
+
+        // Idle workers park here instead of spinning on an empty queue
+        std::mutex idle_mutex;
+        std::condition_variable idle_cv;
+        std::atomic<size_t> idle{0};
+
+        std::atomic<uint64_t> queue_full_events{0};
+        std::atomic<uint64_t> retries{0};
+    };
+
+    struct retry_entry {
+        std::chrono::steady_clock::time_point due;
+        uint64_t sequence = 0;
+        size_t stage = 0;
+        std::shared_ptr<staged_job> job;
+
+        bool operator>(const retry_entry& other) const {
+            return due != other.due ? due > other.due : sequence > other.sequence;
+        }
+    };
+
+    /**
+     * @brief Workers, queues and retry timer for one staged run
+     */
+    struct staged_runtime {
+        std::vector<std::unique_ptr<stage_runtime>> stages;
+
+        std::atomic<bool> accepting{true};
+        std::atomic<bool> stopping{false};
+
+        std::atomic<size_t> in_flight{0};
+        std::mutex drain_mutex;
+        std::condition_variable drain_cv;
+
+        std::thread timer;
+        std::mutex timer_mutex;
+        std::condition_variable timer_cv;
+        std::priority_queue<retry_entry, std::vector<retry_entry>,
+                            std::greater<>> pending_retries;
+        uint64_t retry_sequence = 0;
+    };
+
+    std::shared_ptr<staged_runtime> acquire_runtime() {
+        std::lock_guard lock(runtime_mutex_);
+        if (runtime_) {
+            return runtime_;
+        }
+
+        auto runtime = std::make_shared<staged_runtime>();
+        {
+            std::shared_lock stages_lock(mutex_);
+            for (const auto& stage : stages_) {
+                if (!stage.enabled) {
+                    continue;
+                }
+                auto rt = std::make_unique<stage_runtime>();
+                rt->stage = stage;
+                performance::lockfree_queue_config queue_config;
+                queue_config.capacity = std::max<size_t>(stage.queue_capacity, 1);
+                rt->queue = std::make_unique<stage_queue>(queue_config);
+                runtime->stages.push_back(std::move(rt));
+            }
+        }
+
+        auto* raw = runtime.get();
+        for (size_t i = 0; i < raw->stages.size(); ++i) {
+            size_t workers = std::max<size_t>(raw->stages[i]->stage.workers, 1);
+            for (size_t w = 0; w < workers; ++w) {
+                raw->stages[i]->workers.emplace_back(
+                    [raw, i] { worker_loop(*raw, *raw->stages[i]); });
+            }
+        }
+        raw->timer = std::thread([this, raw] { timer_loop(*raw); });
+
+        runtime_ = runtime;
+        return runtime;
+    }
+
+    void shutdown_runtime() {
+        std::shared_ptr<staged_runtime> runtime;
+        {
+            std::lock_guard lock(runtime_mutex_);
+            runtime = std::move(runtime_);
+        }
+        if (!runtime) {
+            return;
+        }
+
+        // Let submitted messages finish, then release the workers
+        runtime->accepting.store(false);
+        {
+            std::unique_lock lock(runtime->drain_mutex);
+            runtime->drain_cv.wait(lock, [&] { return runtime->in_flight.load() == 0; });
+        }
+        runtime->stopping.store(true);
+
+        for (auto& stage : runtime->stages) {
+            {
+                std::lock_guard lock(stage->idle_mutex);
+                stage->idle_cv.notify_all();
+            }
+            for (auto& worker : stage->workers) {
+                worker.join();
+            }
+        }
+        {
+            std::lock_guard lock(runtime->timer_mutex);
+            runtime->timer_cv.notify_all();
+        }
+        runtime->timer.join();
+    }
+
+    static void worker_loop(staged_runtime& runtime, stage_runtime& stage) {
+        while (true) {
+            if (auto task = stage.queue->try_pop()) {
+                (*task)();
+                continue;
+            }
+
+            std::unique_lock lock(stage.idle_mutex);
+            if (runtime.stopping.load() && stage.queue->empty()) {
+                return;
+            }
+            stage.idle.fetch_add(1);
+            // Timed wait bounds a wakeup lost between the check and the park
+            stage.idle_cv.wait_for(lock, std::chrono::milliseconds(10), [&] {
+                return runtime.stopping.load() || !stage.queue->empty();
+            });
+            stage.idle.fetch_sub(1);
+        }
+    }
+
+    void timer_loop(staged_runtime& runtime) {
+        std::unique_lock lock(runtime.timer_mutex);
+        while (!runtime.stopping.load()) {
+            if (runtime.pending_retries.empty()) {
+                runtime.timer_cv.wait(lock);
+                continue;
+            }
+
+            auto due = runtime.pending_retries.top().due;
+            if (std::chrono::steady_clock::now() < due) {
+                runtime.timer_cv.wait_until(lock, due);
+                continue;
+            }
+
+            auto entry = runtime.pending_retries.top();
+            runtime.pending_retries.pop();
+            lock.unlock();
+            (void)enqueue(runtime, entry.stage, entry.job,
+                          std::chrono::milliseconds::max());
+            lock.lock();
+        }
+    }
+
+    /**
+     * @brief Queue a job for a stage, waiting up to timeout for room
+     */
+    bool enqueue(staged_runtime& runtime, size_t index,
+                 const std::shared_ptr<staged_job>& job,
+                 std::chrono::milliseconds timeout) {
+        auto& stage = *runtime.stages[index];
+        stage_task task = [this, &runtime, index, job] {
+            run_stage(runtime, index, job);
+        };
+
+        // Copies of the task are cheap; a failed push destroys its copy only
+        if (!stage.queue->try_push(task)) {
+            stage.queue_full_events.fetch_add(1, std::memory_order_relaxed);
+            if (!stage.queue->push(task, timeout)) {
+                return false;
+            }
+        }
+
+        if (stage.idle.load() > 0) {
+            std::lock_guard lock(stage.idle_mutex);
+            stage.idle_cv.notify_one();
+        }
+        return true;
+    }
+
+    void schedule_retry(staged_runtime& runtime, size_t index,
+                        const std::shared_ptr<staged_job>& job,
+                        std::chrono::milliseconds delay) {
+        std::lock_guard lock(runtime.timer_mutex);
+        runtime.pending_retries.push(
+            {std::chrono::steady_clock::now() + delay, runtime.retry_sequence++,
+             index, job});
+        runtime.timer_cv.notify_one();
+    }
+
+    void run_stage(staged_runtime& runtime, size_t index,
+                   const std::shared_ptr<staged_job>& job) {
+        auto& rt = *runtime.stages[index];
+        const auto& stage = rt.stage;
+
+        // Apply filter if present
+        if (stage.filter && !stage.filter(job->message)) {
+            if (config_.enable_statistics) {
+                update_stage_stats(stage.id, true, 0);
+            }
+            advance(runtime, index + 1, job);
+            return;
+        }
+
+        auto stage_start = std::chrono::steady_clock::now();
+        stage_result result;
+        try {
+            result = stage.processor(job->message);
+        } catch (const std::exception& e) {
+            result.success = false;
+            result.error_message = e.what();
+        }
+
+        if (!result.success && job->attempts < stage.max_retries) {
+            ++job->attempts;
+            rt.retries.fetch_add(1, std::memory_order_relaxed);
+            schedule_retry(runtime, index, job, stage.retry_delay);
+            return;
+        }
+        job->attempts = 0;
+
+        auto stage_time = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - stage_start);
+        if (config_.enable_statistics) {
+            update_stage_stats(stage.id, result.success,
+                               static_cast<uint64_t>(stage_time.count()));
+        }
+
+        if (!result.success) {
+            if (stage.optional) {
+                advance(runtime, index + 1, job);
+                return;
+            }
+            if (config_.stop_on_error) {
+                if (config_.enable_statistics) {
+                    std::unique_lock stats_lock(stats_mutex_);
+                    stats_.messages_failed++;
+                }
+                complete(runtime, *job, std::unexpected(pipeline_error::stage_failed));
+                return;
+            }
+        }
+
+        // Update message if transformed
+        if (result.message) {
+            job->message = std::move(*result.message);
+        }
+
+        if (result.skip_remaining) {
+            advance(runtime, runtime.stages.size(), job);
+            return;
+        }
+        advance(runtime, index + 1, job);
+    }
+
+    /**
+     * @brief Hand a job to the next stage, or complete it after the last
+     */
+    void advance(staged_runtime& runtime, size_t next,
+                 const std::shared_ptr<staged_job>& job) {
+        if (next < runtime.stages.size()) {
+            // Blocks while the next stage is full: backpressure
+            (void)enqueue(runtime, next, job, std::chrono::milliseconds::max());
+            return;
+        }
+
+        auto total_time = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - job->started);
+        if (config_.enable_statistics) {
+            std::unique_lock stats_lock(stats_mutex_);
+            stats_.messages_processed++;
+            stats_.messages_succeeded++;
+            stats_.total_pipeline_time_us +=
+                static_cast<uint64_t>(total_time.count());
+        }
+
+        if (bus_ && !config_.output_topic.empty()) {
+            (void)bus_->publish(config_.output_topic, job->message);
+        }
+
+        auto result = std::move(job->message);
+        complete(runtime, *job, std::move(result));
+    }
+
+    static void complete(staged_runtime& runtime, staged_job& job,
+                         std::expected<hl7::hl7_message, pipeline_error> result) {
+        job.done.set_value(std::move(result));
+        if (runtime.in_flight.fetch_sub(1) == 1) {
+            std::lock_guard lock(runtime.drain_mutex);
+            runtime.drain_cv.notify_all();
+        }
+    }
+
+    static void fill_queue_stats(statistics::stage_stats& ss,
+                                 const stage_runtime& stage) {
+        const auto& queue_stats = stage.queue->statistics();
+        ss.queue_depth = stage.queue->size();
+        ss.peak_queue_depth = queue_stats.peak_depth.load(std::memory_order_relaxed);
+        ss.queue_capacity = stage.queue->capacity();
+        ss.queue_full_events = stage.queue_full_events.load(std::memory_order_relaxed);
+        ss.retries = stage.retries.load(std::memory_order_relaxed);
+    }
+
     void update_stage_stats(const std::string& stage_id, bool success,
                              uint64_t time_us) {
         std::unique_lock lock(stats_mutex_);
@@ -378,6 +779,9 @@ private:
     std::shared_ptr<hl7_message_bus> bus_;
     subscription_handle subscription_;
 
+    mutable std::mutex runtime_mutex_;
+    std::shared_ptr<staged_runtime> runtime_;
+
     mutable std::shared_mutex stats_mutex_;
     internal_stats stats_;
     std::unordered_map<std::string, stage_internal_stats> stage_stats_;
@@ -445,6 +849,15 @@ std::expected<hl7::hl7_message, pipeline_error> hl7_pipeline::process(
     return pimpl_->process(raw_data);
 }
 
+std::future<std::expected<hl7::hl7_message, pipeline_error>>
+hl7_pipeline::submit(hl7::hl7_message message) {
+    return pimpl_->submit(std::move(message));
+}
+
+size_t hl7_pipeline::in_flight() const noexcept {
+    return pimpl_->in_flight();
+}
+
 std::expected<void, pipeline_error> hl7_pipeline::start(
     std::shared_ptr<hl7_message_bus> bus) {
     return pimpl_->start(std::move(bus));
@@ -583,6 +996,22 @@ hl7_pipeline_builder& hl7_pipeline_builder::with_retry(
     return *this;
 }
 
+hl7_pipeline_builder& hl7_pipeline_builder::with_workers(
+    size_t workers, size_t queue_capacity) {
+
+    if (!stages_.empty()) {
+        stages_.back().workers = workers;
+        stages_.back().queue_capacity = queue_capacity;
+    }
+    return *this;
+}
+
+hl7_pipeline_builder& hl7_pipeline_builder::staged(bool enable) {
+    config_.execution = enable ? pipeline_execution::staged
+                               : pipeline_execution::synchronous;
+    return *this;
+}
+
 hl7_pipeline_builder& hl7_pipeline_builder::timeout(
     std::chrono::milliseconds timeout) {
     config_.timeout = timeout;
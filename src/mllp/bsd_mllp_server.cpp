@@ -93,6 +93,18 @@ bsd_mllp_session::~bsd_mllp_session() { close(); }
 std::expected<std::vector<uint8_t>, network_error>
 bsd_mllp_session::receive(size_t max_bytes,
                           std::chrono::milliseconds timeout) {
+    std::vector<uint8_t> buffer(max_bytes);
+    auto result = receive_into(buffer, timeout);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+    buffer.resize(result.value());
+    return buffer;
+}
+
+std::expected<size_t, network_error>
+bsd_mllp_session::receive_into(std::span<uint8_t> buffer,
+                               std::chrono::milliseconds timeout) {
     if (!is_open_) {
         return std::unexpected(network_error::connection_closed);
     }
@@ -109,14 +121,12 @@ bsd_mllp_session::receive(size_t max_bytes,
     }
 
     // Receive data
-    std::vector<uint8_t> buffer(max_bytes);
-
 #ifdef _WIN32
     int bytes_received =
         ::recv(socket_, reinterpret_cast<char*>(buffer.data()),
-               static_cast<int>(max_bytes), 0);
+               static_cast<int>(buffer.size()), 0);
 #else
-    ssize_t bytes_received = ::recv(socket_, buffer.data(), max_bytes, 0);
+    ssize_t bytes_received = ::recv(socket_, buffer.data(), buffer.size(), 0);
 #endif
 
     if (bytes_received < 0) {
@@ -141,8 +151,7 @@ bsd_mllp_session::receive(size_t max_bytes,
         stats_.last_activity = std::chrono::system_clock::now();
     }
 
-    buffer.resize(static_cast<size_t>(bytes_received));
-    return buffer;
+    return static_cast<size_t>(bytes_received);
 }
 
 std::expected<size_t, network_error>
@@ -70,6 +70,10 @@ public:
     [[nodiscard]] std::expected<std::vector<uint8_t>, network_error>
     receive(size_t max_bytes, std::chrono::milliseconds timeout) override;
 
+    [[nodiscard]] std::expected<size_t, network_error>
+    receive_into(std::span<uint8_t> buffer,
+                 std::chrono::milliseconds timeout) override;
+
     [[nodiscard]] std::expected<size_t, network_error>
     send(std::span<const uint8_t> data) override;
 
@@ -0,0 +1,737 @@
+/**
+ * @file epoll_mllp_server.cpp
+ * @brief Event-loop (epoll) implementation of MLLP network adapter
+ *
+ * @see src/mllp/epoll_mllp_server.h
+ */
+
+#include "epoll_mllp_server.h"
+
+#ifdef PACS_BRIDGE_HAS_EPOLL
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace pacs::bridge::mllp {
+
+namespace {
+
+/** Events handled per epoll_wait call */
+constexpr int MAX_EVENTS = 256;
+
+/** Per-reactor read buffer; each ready socket is drained through it */
+constexpr size_t REACTOR_READ_BUFFER_SIZE = 64 * 1024;
+
+/** Interval between idle-timeout sweeps */
+constexpr std::chrono::milliseconds SWEEP_INTERVAL{250};
+
+/** Delay before retrying accept after a resource error such as EMFILE */
+constexpr std::chrono::milliseconds ACCEPT_RETRY_INTERVAL{100};
+
+/** Time allowed for a blocked send to make progress */
+constexpr std::chrono::milliseconds SEND_TIMEOUT{5000};
+
+[[nodiscard]] int64_t steady_now_ms() noexcept {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+[[nodiscard]] bool is_would_block(int error) noexcept {
+    return error == EAGAIN || error == EWOULDBLOCK;
+}
+
+}  // anonymous namespace
+
+// =============================================================================
+// Connection State
+// =============================================================================
+
+/**
+ * @brief State shared by a session and the reactor serving it
+ */
+struct epoll_connection {
+    int fd;
+    uint64_t session_id;
+    std::string remote_addr;
+    uint16_t remote_port;
+    std::shared_ptr<std::atomic<size_t>> active_count;
+
+    std::atomic<bool> open{true};
+    std::atomic<bool> async{false};
+    std::atomic<int64_t> last_activity_ms{0};
+
+    // Push-mode state: written before registration with the reactor, then
+    // only accessed from the reactor thread
+    mllp_session::receive_callback on_data;
+    mllp_session::close_callback on_close;
+    int64_t idle_timeout_ms = 0;
+
+    mutable std::mutex stats_mutex;
+    session_stats stats;
+
+    epoll_connection(int sock, uint64_t id, std::string addr, uint16_t port,
+                     std::shared_ptr<std::atomic<size_t>> counter)
+        : fd(sock),
+          session_id(id),
+          remote_addr(std::move(addr)),
+          remote_port(port),
+          active_count(std::move(counter)),
+          last_activity_ms(steady_now_ms()) {
+        stats.connected_at = std::chrono::system_clock::now();
+        stats.last_activity = stats.connected_at;
+    }
+
+    ~epoll_connection() {
+        ::close(fd);
+        active_count->fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    epoll_connection(const epoll_connection&) = delete;
+    epoll_connection& operator=(const epoll_connection&) = delete;
+
+    void record_received(size_t bytes) {
+        last_activity_ms.store(steady_now_ms(), std::memory_order_relaxed);
+        std::lock_guard lock(stats_mutex);
+        stats.bytes_received += bytes;
+        stats.last_activity = std::chrono::system_clock::now();
+    }
+
+    void record_sent(size_t bytes) {
+        std::lock_guard lock(stats_mutex);
+        stats.bytes_sent += bytes;
+        stats.last_activity = std::chrono::system_clock::now();
+    }
+};
+
+// =============================================================================
+// Reactor
+// =============================================================================
+
+/**
+ * @brief One epoll instance and the thread that waits on it
+ *
+ * Only the reactor thread reads from registered sockets, invokes their
+ * callbacks and removes them, so each connection's push-mode callbacks are
+ * never invoked concurrently.
+ */
+class epoll_reactor {
+public:
+    /** Returns false if the backlog was not drained and must be retried */
+    using accept_handler = std::function<bool()>;
+
+    epoll_reactor() : read_buffer_(REACTOR_READ_BUFFER_SIZE) {}
+
+    ~epoll_reactor() {
+        stop();
+        if (wake_fd_ >= 0) {
+            ::close(wake_fd_);
+        }
+        if (epoll_fd_ >= 0) {
+            ::close(epoll_fd_);
+        }
+    }
+
+    epoll_reactor(const epoll_reactor&) = delete;
+    epoll_reactor& operator=(const epoll_reactor&) = delete;
+
+    /**
+     * @brief Create the epoll instance and start the reactor thread
+     *
+     * @param listen_fd Listening socket to watch, or -1
+     * @param on_accept Called on the reactor thread when listen_fd is ready
+     */
+    [[nodiscard]] std::expected<void, network_error>
+    start(int listen_fd, accept_handler on_accept) {
+        epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+        wake_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (epoll_fd_ < 0 || wake_fd_ < 0) {
+            return std::unexpected(network_error::socket_error);
+        }
+
+        epoll_event wake_event{};
+        wake_event.events = EPOLLIN;
+        wake_event.data.ptr = nullptr;
+        if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &wake_event) < 0) {
+            return std::unexpected(network_error::socket_error);
+        }
+
+        if (listen_fd >= 0) {
+            epoll_event listen_event{};
+            listen_event.events = EPOLLIN | EPOLLET;
+            listen_event.data.ptr = this;
+            if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, listen_fd,
+                            &listen_event) < 0) {
+                return std::unexpected(network_error::socket_error);
+            }
+            on_accept_ = std::move(on_accept);
+        }
+
+        thread_ = std::thread([this] { run(); });
+        return {};
+    }
+
+    /**
+     * @brief Stop the reactor thread and close every registered connection
+     */
+    void stop() {
+        {
+            std::lock_guard lock(connections_mutex_);
+            stop_requested_ = true;
+        }
+
+        if (wake_fd_ >= 0) {
+            uint64_t one = 1;
+            [[maybe_unused]] auto written = ::write(wake_fd_, &one, sizeof(one));
+        }
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+
+        std::unordered_map<epoll_connection*, std::shared_ptr<epoll_connection>>
+            remaining;
+        {
+            std::lock_guard lock(connections_mutex_);
+            remaining.swap(connections_);
+        }
+        for (auto& [raw, connection] : remaining) {
+            ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, connection->fd, nullptr);
+            ::shutdown(connection->fd, SHUT_RDWR);
+            finish(connection, network_error::connection_closed);
+        }
+    }
+
+    /**
+     * @brief Register a connection for push-mode delivery (any thread)
+     */
+    [[nodiscard]] bool add(const std::shared_ptr<epoll_connection>& connection) {
+        {
+            std::lock_guard lock(connections_mutex_);
+            if (stop_requested_) {
+                return false;
+            }
+            connections_.emplace(connection.get(), connection);
+        }
+
+        // Edge-triggered: a socket that is already readable reports an event
+        // immediately on registration
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLRDHUP | EPOLLET;
+        event.data.ptr = connection.get();
+        if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, connection->fd, &event) < 0) {
+            std::lock_guard lock(connections_mutex_);
+            connections_.erase(connection.get());
+            return false;
+        }
+        return true;
+    }
+
+private:
+    void run() {
+        std::array<epoll_event, MAX_EVENTS> events{};
+        int64_t next_sweep = steady_now_ms() + SWEEP_INTERVAL.count();
+        // The listener is edge-triggered, so connections left in the backlog
+        // after a failed accept raise no new event; retry them on a timer
+        int64_t accept_retry_at = 0;
+
+        while (!stop_requested_) {
+            int64_t timeout = SWEEP_INTERVAL.count();
+            if (accept_retry_at != 0) {
+                timeout = std::clamp<int64_t>(accept_retry_at - steady_now_ms(), 0, timeout);
+            }
+            int count = ::epoll_wait(epoll_fd_, events.data(), MAX_EVENTS,
+                                     static_cast<int>(timeout));
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                break;
+            }
+
+            for (int i = 0; i < count; ++i) {
+                void* tag = events[static_cast<size_t>(i)].data.ptr;
+                if (tag == nullptr) {
+                    uint64_t value = 0;
+                    [[maybe_unused]] auto read = ::read(wake_fd_, &value, sizeof(value));
+                    continue;
+                }
+                if (tag == this) {
+                    if (on_accept_ && !on_accept_()) {
+                        accept_retry_at = steady_now_ms() + ACCEPT_RETRY_INTERVAL.count();
+                    }
+                    continue;
+                }
+                // The connection may have been closed earlier in this batch
+                if (auto connection = find(static_cast<epoll_connection*>(tag))) {
+                    handle_readable(connection);
+                }
+            }
+
+            if (accept_retry_at != 0 && steady_now_ms() >= accept_retry_at) {
+                accept_retry_at = on_accept_()
+                                      ? 0
+                                      : steady_now_ms() + ACCEPT_RETRY_INTERVAL.count();
+            }
+
+            if (int64_t now = steady_now_ms(); now >= next_sweep) {
+                sweep_idle(now);
+                next_sweep = now + SWEEP_INTERVAL.count();
+            }
+        }
+    }
+
+    [[nodiscard]] std::shared_ptr<epoll_connection> find(epoll_connection* raw) {
+        std::lock_guard lock(connections_mutex_);
+        auto it = connections_.find(raw);
+        return it != connections_.end() ? it->second : nullptr;
+    }
+
+    /**
+     * @brief Drain a ready socket until EAGAIN (required for edge-triggered)
+     */
+    void handle_readable(const std::shared_ptr<epoll_connection>& connection) {
+        while (true) {
+            ssize_t received = ::recv(connection->fd, read_buffer_.data(),
+                                      read_buffer_.size(), 0);
+            if (received > 0) {
+                const auto bytes = static_cast<size_t>(received);
+                connection->record_received(bytes);
+                if (connection->on_data) {
+                    connection->on_data(
+                        std::span<const uint8_t>(read_buffer_.data(), bytes));
+                }
+                continue;
+            }
+            if (received == 0) {
+                close_connection(connection, network_error::connection_closed);
+                return;
+            }
+            if (errno == EINTR) {
+                continue;
+            }
+            if (is_would_block(errno)) {
+                return;
+            }
+            close_connection(connection, network_error::socket_error);
+            return;
+        }
+    }
+
+    void sweep_idle(int64_t now) {
+        std::vector<std::shared_ptr<epoll_connection>> expired;
+        {
+            std::lock_guard lock(connections_mutex_);
+            for (const auto& [raw, connection] : connections_) {
+                if (connection->idle_timeout_ms > 0 &&
+                    now - connection->last_activity_ms.load(
+                              std::memory_order_relaxed) >
+                        connection->idle_timeout_ms) {
+                    expired.push_back(connection);
+                }
+            }
+        }
+        for (const auto& connection : expired) {
+            ::shutdown(connection->fd, SHUT_RDWR);
+            close_connection(connection, network_error::timeout);
+        }
+    }
+
+    void close_connection(const std::shared_ptr<epoll_connection>& connection,
+                          network_error reason) {
+        {
+            std::lock_guard lock(connections_mutex_);
+            if (connections_.erase(connection.get()) == 0) {
+                return;
+            }
+        }
+        ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, connection->fd, nullptr);
+        finish(connection, reason);
+    }
+
+    static void finish(const std::shared_ptr<epoll_connection>& connection,
+                       network_error reason) {
+        connection->open = false;
+        auto on_close = std::move(connection->on_close);
+        connection->on_close = nullptr;
+        connection->on_data = nullptr;
+        if (on_close) {
+            on_close(reason);
+        }
+    }
+
+    int epoll_fd_ = -1;
+    int wake_fd_ = -1;
+    accept_handler on_accept_;
+    std::thread thread_;
+    std::atomic<bool> stop_requested_{false};
+
+    std::mutex connections_mutex_;
+    std::unordered_map<epoll_connection*, std::shared_ptr<epoll_connection>>
+        connections_;
+
+    std::vector<uint8_t> read_buffer_;
+};
+
+// =============================================================================
+// Epoll Session Implementation
+// =============================================================================
+
+epoll_mllp_session::epoll_mllp_session(
+    std::shared_ptr<epoll_connection> connection,
+    std::shared_ptr<epoll_reactor> reactor)
+    : connection_(std::move(connection)), reactor_(std::move(reactor)) {}
+
+epoll_mllp_session::~epoll_mllp_session() { close(); }
+
+std::expected<std::vector<uint8_t>, network_error>
+epoll_mllp_session::receive(size_t max_bytes,
+                            std::chrono::milliseconds timeout) {
+    std::vector<uint8_t> buffer(max_bytes);
+    auto result = receive_into(buffer, timeout);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+    buffer.resize(result.value());
+    return buffer;
+}
+
+std::expected<size_t, network_error>
+epoll_mllp_session::receive_into(std::span<uint8_t> buffer,
+                                 std::chrono::milliseconds timeout) {
+    if (!connection_->open) {
+        return std::unexpected(network_error::connection_closed);
+    }
+    if (connection_->async) {
+        // Data is delivered to the push-mode callback
+        return std::unexpected(network_error::socket_error);
+    }
+
+    pollfd pfd{};
+    pfd.fd = connection_->fd;
+    pfd.events = POLLIN;
+    int ready = ::poll(&pfd, 1, static_cast<int>(timeout.count()));
+    if (ready < 0) {
+        return std::unexpected(network_error::socket_error);
+    }
+    if (ready == 0) {
+        return std::unexpected(network_error::timeout);
+    }
+    if (pfd.revents & (POLLERR | POLLNVAL)) {
+        connection_->open = false;
+        return std::unexpected(network_error::connection_closed);
+    }
+
+    ssize_t received = ::recv(connection_->fd, buffer.data(), buffer.size(), 0);
+    if (received > 0) {
+        connection_->record_received(static_cast<size_t>(received));
+        return static_cast<size_t>(received);
+    }
+    if (received == 0) {
+        connection_->open = false;
+        return std::unexpected(network_error::connection_closed);
+    }
+    if (is_would_block(errno)) {
+        return std::unexpected(network_error::would_block);
+    }
+    connection_->open = false;
+    return std::unexpected(network_error::socket_error);
+}
+
+bool epoll_mllp_session::start_async_receive(
+    receive_callback on_data, close_callback on_close,
+    std::chrono::milliseconds idle_timeout) {
+    bool expected = false;
+    if (!connection_->open ||
+        !connection_->async.compare_exchange_strong(expected, true)) {
+        return false;
+    }
+
+    connection_->on_data = std::move(on_data);
+    connection_->on_close = std::move(on_close);
+    connection_->idle_timeout_ms = idle_timeout.count();
+    connection_->last_activity_ms.store(steady_now_ms(),
+                                        std::memory_order_relaxed);
+
+    if (!reactor_->add(connection_)) {
+        connection_->on_data = nullptr;
+        connection_->on_close = nullptr;
+        connection_->async = false;
+        return false;
+    }
+    return true;
+}
+
+std::expected<size_t, network_error>
+epoll_mllp_session::send(std::span<const uint8_t> data) {
+    std::lock_guard lock(send_mutex_);
+
+    if (!connection_->open) {
+        return std::unexpected(network_error::connection_closed);
+    }
+
+    size_t total_sent = 0;
+    while (total_sent < data.size()) {
+        ssize_t sent = ::send(connection_->fd, data.data() + total_sent,
+                              data.size() - total_sent, MSG_NOSIGNAL);
+        if (sent > 0) {
+            total_sent += static_cast<size_t>(sent);
+            continue;
+        }
+        if (sent < 0 && errno == EINTR) {
+            continue;
+        }
+        if (sent < 0 && is_would_block(errno)) {
+            // Socket buffer full; wait for the peer to drain it
+            pollfd pfd{};
+            pfd.fd = connection_->fd;
+            pfd.events = POLLOUT;
+            if (::poll(&pfd, 1, static_cast<int>(SEND_TIMEOUT.count())) <= 0) {
+                return std::unexpected(network_error::timeout);
+            }
+            continue;
+        }
+        connection_->open = false;
+        return std::unexpected(network_error::socket_error);
+    }
+
+    connection_->record_sent(total_sent);
+    return total_sent;
+}
+
+void epoll_mllp_session::close() {
+    if (connection_->open.exchange(false)) {
+        // Wakes the reactor (or a blocked poll) with a hang-up; the socket
+        // itself is closed when the last owner releases the connection
+        ::shutdown(connection_->fd, SHUT_RDWR);
+    }
+}
+
+bool epoll_mllp_session::is_open() const noexcept { return connection_->open; }
+
+session_stats epoll_mllp_session::get_stats() const noexcept {
+    std::lock_guard lock(connection_->stats_mutex);
+    return connection_->stats;
+}
+
+std::string epoll_mllp_session::remote_address() const noexcept {
+    return connection_->remote_addr;
+}
+
+uint16_t epoll_mllp_session::remote_port() const noexcept {
+    return connection_->remote_port;
+}
+
+uint64_t epoll_mllp_session::session_id() const noexcept {
+    return connection_->session_id;
+}
+
+// =============================================================================
+// Epoll Server Implementation
+// =============================================================================
+
+epoll_mllp_server::epoll_mllp_server(const server_config& config,
+                                     size_t reactor_threads)
+    : config_(config),
+      reactor_threads_(std::max<size_t>(reactor_threads, 1)),
+      active_sessions_(std::make_shared<std::atomic<size_t>>(0)) {}
+
+epoll_mllp_server::~epoll_mllp_server() { stop(false); }
+
+std::expected<void, network_error> epoll_mllp_server::start() {
+    std::lock_guard lock(state_mutex_);
+
+    if (running_) {
+        return std::unexpected(network_error::socket_error);
+    }
+
+    if (!config_.is_valid()) {
+        return std::unexpected(network_error::invalid_config);
+    }
+
+    if (auto result = create_server_socket(); !result) {
+        return result;
+    }
+
+    // Create all reactors before any can accept, so accept_ready() never
+    // sees a partially built list
+    for (size_t i = 0; i < reactor_threads_; ++i) {
+        reactors_.push_back(std::make_shared<epoll_reactor>());
+    }
+    for (size_t i = reactor_threads_; i-- > 0;) {
+        auto result =
+            i == 0 ? reactors_[i]->start(listen_fd_, [this] { return accept_ready(); })
+                   : reactors_[i]->start(-1, nullptr);
+        if (!result) {
+            reactors_.clear();
+            ::close(listen_fd_);
+            listen_fd_ = -1;
+            return result;
+        }
+    }
+
+    next_reactor_ = 0;
+    running_ = true;
+    return {};
+}
+
+void epoll_mllp_server::stop(bool wait_for_connections) {
+    std::lock_guard lock(state_mutex_);
+    if (!running_) {
+        return;
+    }
+
+    // Reactor 0 first so no connection is accepted while others shut down.
+    // Reactors own their connections, so stopping them closes every session
+    // (mllp_server is notified through each session's close callback).
+    for (auto& reactor : reactors_) {
+        reactor->stop();
+    }
+    reactors_.clear();
+    (void)wait_for_connections;
+
+    ::close(listen_fd_);
+    listen_fd_ = -1;
+    running_ = false;
+}
+
+bool epoll_mllp_server::is_running() const noexcept { return running_; }
+
+uint16_t epoll_mllp_server::port() const noexcept { return config_.port; }
+
+void epoll_mllp_server::on_connection(on_connection_callback callback) {
+    connection_callback_ = std::move(callback);
+}
+
+size_t epoll_mllp_server::active_session_count() const noexcept {
+    return active_sessions_->load(std::memory_order_relaxed);
+}
+
+size_t epoll_mllp_server::reactor_count() const noexcept {
+    return reactor_threads_;
+}
+
+std::expected<void, network_error> epoll_mllp_server::create_server_socket() {
+    listen_fd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC,
+                          IPPROTO_TCP);
+    if (listen_fd_ < 0) {
+        return std::unexpected(network_error::socket_error);
+    }
+
+    auto fail = [this](network_error error) {
+        ::close(listen_fd_);
+        listen_fd_ = -1;
+        return std::unexpected(error);
+    };
+
+    if (config_.reuse_addr) {
+        int reuse = 1;
+        if (::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse,
+                         sizeof(reuse)) < 0) {
+            return fail(network_error::socket_error);
+        }
+    }
+
+    sockaddr_in server_addr{};
+    server_addr.sin_family = AF_INET;
+    server_addr.sin_port = htons(config_.port);
+    if (config_.bind_address.empty()) {
+        server_addr.sin_addr.s_addr = INADDR_ANY;
+    } else if (::inet_pton(AF_INET, config_.bind_address.c_str(),
+                           &server_addr.sin_addr) <= 0) {
+        return fail(network_error::invalid_config);
+    }
+
+    if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&server_addr),
+               sizeof(server_addr)) < 0) {
+        return fail(network_error::bind_failed);
+    }
+
+    if (::listen(listen_fd_, config_.backlog) < 0) {
+        return fail(network_error::bind_failed);
+    }
+
+    return {};
+}
+
+void epoll_mllp_server::configure_client_socket(int fd) const {
+    if (config_.no_delay) {
+        int nodelay = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+    }
+
+    if (config_.keep_alive) {
+        int keepalive = 1;
+        ::setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &keepalive,
+                     sizeof(keepalive));
+        ::setsockopt(fd, IPPROTO_TCP, TCP_KEEPIDLE, &config_.keep_alive_idle,
+                     sizeof(config_.keep_alive_idle));
+        ::setsockopt(fd, IPPROTO_TCP, TCP_KEEPINTVL,
+                     &config_.keep_alive_interval,
+                     sizeof(config_.keep_alive_interval));
+        ::setsockopt(fd, IPPROTO_TCP, TCP_KEEPCNT, &config_.keep_alive_count,
+                     sizeof(config_.keep_alive_count));
+    }
+
+    if (config_.recv_buffer_size > 0) {
+        int size = static_cast<int>(config_.recv_buffer_size);
+        ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+    }
+
+    if (config_.send_buffer_size > 0) {
+        int size = static_cast<int>(config_.send_buffer_size);
+        ::setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+    }
+}
+
+bool epoll_mllp_server::accept_ready() {
+    // Edge-triggered: accept until the backlog is empty
+    while (true) {
+        sockaddr_in client_addr{};
+        socklen_t client_addr_len = sizeof(client_addr);
+        int fd = ::accept4(listen_fd_, reinterpret_cast<sockaddr*>(&client_addr),
+                           &client_addr_len, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            // EAGAIN: backlog drained. Other errors (e.g. EMFILE) leave it
+            // pending; the reactor retries after ACCEPT_RETRY_INTERVAL.
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+
+        configure_client_socket(fd);
+
+        char addr_str[INET_ADDRSTRLEN] = {};
+        ::inet_ntop(AF_INET, &client_addr.sin_addr, addr_str, sizeof(addr_str));
+
+        auto& reactor = reactors_[next_reactor_++ % reactors_.size()];
+        active_sessions_->fetch_add(1, std::memory_order_relaxed);
+        auto connection = std::make_shared<epoll_connection>(
+            fd, next_session_id_++, std::string(addr_str),
+            ntohs(client_addr.sin_port), active_sessions_);
+        auto session =
+            std::make_unique<epoll_mllp_session>(std::move(connection), reactor);
+
+        if (connection_callback_) {
+            connection_callback_(std::move(session));
+        }
+    }
+}
+
+}  // namespace pacs::bridge::mllp
+
+#endif  // PACS_BRIDGE_HAS_EPOLL
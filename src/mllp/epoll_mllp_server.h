@@ -0,0 +1,170 @@
+#ifndef PACS_BRIDGE_MLLP_EPOLL_MLLP_SERVER_H
+#define PACS_BRIDGE_MLLP_EPOLL_MLLP_SERVER_H
+
+/**
+ * @file epoll_mllp_server.h
+ * @brief Event-loop (epoll) implementation of MLLP network adapter
+ *
+ * Serves all connections from a small, fixed number of reactor threads
+ * instead of one blocked thread per connection. Sockets are non-blocking
+ * and registered edge-triggered; each reactor drains a ready socket until
+ * EAGAIN and pushes the bytes to the session's receive callback.
+ *
+ * Sessions support both models:
+ * - Push mode (start_async_receive): data is delivered on the reactor thread
+ * - Blocking mode (receive / receive_into): poll() on the socket, as with
+ *   bsd_mllp_session, for callers that have not switched to push mode
+ *
+ * Linux only. PACS_BRIDGE_HAS_EPOLL is defined when available.
+ */
+
+#include "pacs/bridge/mllp/mllp_network_adapter.h"
+
+#if defined(__linux__)
+#define PACS_BRIDGE_HAS_EPOLL 1
+#endif
+
+#ifdef PACS_BRIDGE_HAS_EPOLL
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace pacs::bridge::mllp {
+
+class epoll_reactor;
+struct epoll_connection;
+
+// =============================================================================
+// Epoll Session Implementation
+// =============================================================================
+
+/**
+ * @brief mllp_session served by an epoll reactor
+ *
+ * The socket is closed once both the session and its reactor have released
+ * the connection, so a descriptor is never reused while an event for it may
+ * still be in flight.
+ */
+class epoll_mllp_session : public mllp_session {
+public:
+    epoll_mllp_session(std::shared_ptr<epoll_connection> connection,
+                       std::shared_ptr<epoll_reactor> reactor);
+
+    ~epoll_mllp_session() override;
+
+    // Implement mllp_session interface
+    [[nodiscard]] std::expected<std::vector<uint8_t>, network_error>
+    receive(size_t max_bytes, std::chrono::milliseconds timeout) override;
+
+    [[nodiscard]] std::expected<size_t, network_error>
+    receive_into(std::span<uint8_t> buffer,
+                 std::chrono::milliseconds timeout) override;
+
+    [[nodiscard]] bool
+    start_async_receive(receive_callback on_data, close_callback on_close,
+                        std::chrono::milliseconds idle_timeout) override;
+
+    [[nodiscard]] std::expected<size_t, network_error>
+    send(std::span<const uint8_t> data) override;
+
+    void close() override;
+
+    [[nodiscard]] bool is_open() const noexcept override;
+
+    [[nodiscard]] session_stats get_stats() const noexcept override;
+
+    [[nodiscard]] std::string remote_address() const noexcept override;
+
+    [[nodiscard]] uint16_t remote_port() const noexcept override;
+
+    [[nodiscard]] uint64_t session_id() const noexcept override;
+
+private:
+    std::shared_ptr<epoll_connection> connection_;
+    std::shared_ptr<epoll_reactor> reactor_;
+    std::mutex send_mutex_;
+};
+
+// =============================================================================
+// Epoll Server Adapter Implementation
+// =============================================================================
+
+/**
+ * @brief Event-loop implementation of mllp_server_adapter
+ *
+ * Reactor 0 also owns the listening socket. Accepted connections are
+ * assigned to reactors round-robin.
+ */
+class epoll_mllp_server : public mllp_server_adapter {
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param config Server configuration
+     * @param reactor_threads Number of reactor threads (minimum 1)
+     */
+    explicit epoll_mllp_server(const server_config& config,
+                               size_t reactor_threads = 1);
+
+    ~epoll_mllp_server() override;
+
+    // Implement mllp_server_adapter interface
+    [[nodiscard]] std::expected<void, network_error> start() override;
+
+    void stop(bool wait_for_connections = true) override;
+
+    [[nodiscard]] bool is_running() const noexcept override;
+
+    [[nodiscard]] uint16_t port() const noexcept override;
+
+    void on_connection(on_connection_callback callback) override;
+
+    [[nodiscard]] size_t active_session_count() const noexcept override;
+
+    /**
+     * @brief Number of reactor threads serving connections
+     */
+    [[nodiscard]] size_t reactor_count() const noexcept;
+
+private:
+    /**
+     * @brief Create, bind and listen on the non-blocking server socket
+     */
+    [[nodiscard]] std::expected<void, network_error> create_server_socket();
+
+    /**
+     * @brief Apply per-connection socket options (keep-alive, nodelay, ...)
+     */
+    void configure_client_socket(int fd) const;
+
+    /**
+     * @brief Accept all pending connections (reactor 0 thread)
+     *
+     * @return false if accepting failed before the backlog was drained
+     *         (e.g. EMFILE), so the reactor must retry later
+     */
+    bool accept_ready();
+
+    server_config config_;
+    size_t reactor_threads_;
+    int listen_fd_ = -1;
+
+    std::vector<std::shared_ptr<epoll_reactor>> reactors_;
+    size_t next_reactor_ = 0;
+
+    on_connection_callback connection_callback_;
+
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> next_session_id_{1};
+    std::shared_ptr<std::atomic<size_t>> active_sessions_;
+
+    mutable std::mutex state_mutex_;
+};
+
+}  // namespace pacs::bridge::mllp
+
+#endif  // PACS_BRIDGE_HAS_EPOLL
+
+#endif  // PACS_BRIDGE_MLLP_EPOLL_MLLP_SERVER_H
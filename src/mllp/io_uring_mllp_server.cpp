@@ -0,0 +1,995 @@
+/**
+ * @file io_uring_mllp_server.cpp
+ * @brief io_uring implementation of MLLP network adapter
+ *
+ * @see src/mllp/io_uring_mllp_server.h
+ */
+
+#include "io_uring_mllp_server.h"
+
+#ifdef PACS_BRIDGE_HAS_IO_URING
+
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace pacs::bridge::mllp {
+
+namespace {
+
+/** Submission queue entries */
+constexpr unsigned RING_ENTRIES = 1024;
+
+/** Completion queue entries; sized for bursts across many connections */
+constexpr unsigned CQ_ENTRIES = 8192;
+
+/** Provided-buffer group for receives */
+constexpr uint16_t RECV_BUFFER_GROUP = 0;
+
+/** Provided receive buffers shared by all connections (power of two) */
+constexpr unsigned RECV_BUFFER_COUNT = 256;
+
+/** Size of each provided receive buffer */
+constexpr size_t RECV_BUFFER_SIZE = 16 * 1024;
+
+/** Interval between idle-timeout sweeps */
+constexpr std::chrono::milliseconds TICK_INTERVAL{250};
+
+/** Time allowed for a queued send to complete */
+constexpr std::chrono::seconds SEND_TIMEOUT{5};
+
+/** Time allowed at stop for in-flight operations to finish */
+constexpr std::chrono::milliseconds DRAIN_TIMEOUT{1000};
+
+/**
+ * @brief Operation tag stored in the top byte of sqe->user_data
+ */
+enum class op_kind : uint8_t { accept = 1, recv, send, send_timeout, wake, tick };
+
+constexpr uint64_t ID_MASK = (uint64_t{1} << 56) - 1;
+
+[[nodiscard]] constexpr uint64_t encode(op_kind op, uint64_t id) noexcept {
+    return (static_cast<uint64_t>(op) << 56) | (id & ID_MASK);
+}
+
+[[nodiscard]] constexpr op_kind decode_op(uint64_t user_data) noexcept {
+    return static_cast<op_kind>(user_data >> 56);
+}
+
+[[nodiscard]] int64_t steady_now_ms() noexcept {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+}  // anonymous namespace
+
+// =============================================================================
+// Connection State
+// =============================================================================
+
+/**
+ * @brief State shared by a session and the loop serving it
+ */
+struct io_uring_connection {
+    int fd;
+    uint64_t session_id;
+    std::string remote_addr;
+    uint16_t remote_port;
+    std::shared_ptr<std::atomic<size_t>> active_count;
+
+    std::atomic<bool> open{true};
+    std::atomic<bool> async{false};
+    std::atomic<int64_t> last_activity_ms{0};
+
+    // Push-mode state: written before the receive is started on the loop,
+    // then only accessed from the loop thread
+    mllp_session::receive_callback on_data;
+    mllp_session::close_callback on_close;
+    int64_t idle_timeout_ms = 0;
+
+    // Loop-thread state
+    bool closed = false;
+    bool recv_armed = false;
+    bool send_inflight = false;
+
+    // Pending sends; the front entry is in flight while send_inflight is set
+    std::mutex send_mutex;
+    std::deque<std::vector<uint8_t>> send_queue;
+    size_t send_offset = 0;
+
+    mutable std::mutex stats_mutex;
+    session_stats stats;
+
+    io_uring_connection(int sock, uint64_t id, std::string addr, uint16_t port,
+                        std::shared_ptr<std::atomic<size_t>> counter)
+        : fd(sock),
+          session_id(id),
+          remote_addr(std::move(addr)),
+          remote_port(port),
+          active_count(std::move(counter)),
+          last_activity_ms(steady_now_ms()) {
+        stats.connected_at = std::chrono::system_clock::now();
+        stats.last_activity = stats.connected_at;
+    }
+
+    ~io_uring_connection() {
+        ::close(fd);
+        active_count->fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    io_uring_connection(const io_uring_connection&) = delete;
+    io_uring_connection& operator=(const io_uring_connection&) = delete;
+
+    void record_received(size_t bytes) {
+        last_activity_ms.store(steady_now_ms(), std::memory_order_relaxed);
+        std::lock_guard lock(stats_mutex);
+        stats.bytes_received += bytes;
+        stats.last_activity = std::chrono::system_clock::now();
+    }
+
+    void record_sent(size_t bytes) {
+        std::lock_guard lock(stats_mutex);
+        stats.bytes_sent += bytes;
+        stats.last_activity = std::chrono::system_clock::now();
+    }
+};
+
+// =============================================================================
+// Completion Loop
+// =============================================================================
+
+/**
+ * @brief One io_uring instance and the thread that drives it
+ *
+ * All ring access happens on the loop thread. Other threads hand work over
+ * with post(), which wakes the loop through an eventfd read kept in flight.
+ */
+class io_uring_loop {
+public:
+    using accept_handler = std::function<void(int fd)>;
+
+    io_uring_loop() = default;
+
+    ~io_uring_loop() {
+        stop();
+        if (wake_fd_ >= 0) {
+            ::close(wake_fd_);
+        }
+    }
+
+    io_uring_loop(const io_uring_loop&) = delete;
+    io_uring_loop& operator=(const io_uring_loop&) = delete;
+
+    [[nodiscard]] std::expected<void, network_error>
+    start(int listen_fd, accept_handler on_accept) {
+        if (!ring_.init(RING_ENTRIES, CQ_ENTRIES) ||
+            !ring_.setup_buffer_ring(RECV_BUFFER_GROUP, RECV_BUFFER_COUNT,
+                                     RECV_BUFFER_SIZE)) {
+            return std::unexpected(network_error::socket_error);
+        }
+
+        wake_fd_ = ::eventfd(0, EFD_CLOEXEC);
+        if (wake_fd_ < 0) {
+            return std::unexpected(network_error::socket_error);
+        }
+
+        listen_fd_ = listen_fd;
+        on_accept_ = std::move(on_accept);
+
+        tick_ts_.tv_sec = 0;
+        tick_ts_.tv_nsec = std::chrono::nanoseconds(TICK_INTERVAL).count();
+        send_timeout_ts_.tv_sec = SEND_TIMEOUT.count();
+        send_timeout_ts_.tv_nsec = 0;
+
+        thread_ = std::thread([this] { run(); });
+        return {};
+    }
+
+    /**
+     * @brief Stop the loop; every open connection is closed and reported
+     */
+    void stop() {
+        {
+            std::lock_guard lock(commands_mutex_);
+            if (!accepting_commands_) {
+                return;
+            }
+            accepting_commands_ = false;
+        }
+        stop_requested_ = true;
+        wake();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    /**
+     * @brief Run fn on the loop thread (immediately if already on it)
+     * @return false if the loop has stopped
+     */
+    bool post(std::function<void()> fn) {
+        if (current_loop == this) {
+            fn();
+            return true;
+        }
+
+        bool was_empty = false;
+        {
+            std::lock_guard lock(commands_mutex_);
+            if (!accepting_commands_) {
+                return false;
+            }
+            was_empty = commands_.empty();
+            commands_.push_back(std::move(fn));
+        }
+        // One wake per batch; the loop drains every queued command
+        if (was_empty) {
+            wake();
+        }
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Loop-thread operations
+    // -------------------------------------------------------------------------
+
+    void add(const std::shared_ptr<io_uring_connection>& connection) {
+        connections_.emplace(connection->session_id, connection);
+    }
+
+    void start_receive(const std::shared_ptr<io_uring_connection>& connection) {
+        if (connection->closed) {
+            auto on_close = std::move(connection->on_close);
+            connection->on_close = nullptr;
+            connection->on_data = nullptr;
+            if (on_close) {
+                on_close(network_error::connection_closed);
+            }
+            return;
+        }
+        arm_recv(connection);
+    }
+
+    /**
+     * @brief Submit the send queue head unless a send is already in flight
+     */
+    void flush_send(const std::shared_ptr<io_uring_connection>& connection) {
+        if (connection->closed || connection->send_inflight) {
+            return;
+        }
+        std::lock_guard lock(connection->send_mutex);
+        if (!connection->send_queue.empty()) {
+            submit_send(connection);
+        }
+    }
+
+    void close_connection(const std::shared_ptr<io_uring_connection>& connection,
+                          network_error reason) {
+        if (connection->closed) {
+            return;
+        }
+        connection->closed = true;
+        connection->open = false;
+
+        // Ends the in-flight receive; a pending send fails with EPIPE
+        ::shutdown(connection->fd, SHUT_RDWR);
+
+        // Keep only the buffer the kernel may still be reading
+        {
+            std::lock_guard lock(connection->send_mutex);
+            while (connection->send_queue.size() >
+                   (connection->send_inflight ? 1u : 0u)) {
+                connection->send_queue.pop_back();
+            }
+        }
+
+        auto on_close = std::move(connection->on_close);
+        connection->on_close = nullptr;
+        connection->on_data = nullptr;
+        if (on_close) {
+            on_close(reason);
+        }
+        try_release(connection);
+    }
+
+private:
+    static inline thread_local io_uring_loop* current_loop = nullptr;
+
+    void wake() {
+        if (wake_fd_ >= 0) {
+            uint64_t one = 1;
+            [[maybe_unused]] auto written = ::write(wake_fd_, &one, sizeof(one));
+        }
+    }
+
+    void run() {
+        current_loop = this;
+
+        arm_accept();
+        arm_wake();
+        arm_tick();
+
+        while (!stop_requested_) {
+            // Submits everything queued since the last pass and waits
+            int ret = ring_.submit_and_wait(1);
+            if (ret < 0 && ret != -ETIME && ret != -EBUSY && ret != -EAGAIN) {
+                break;
+            }
+            ring_.for_each_cqe([this](const io_uring_cqe& cqe) { handle_cqe(cqe); });
+            run_commands();
+        }
+
+        drain();
+        current_loop = nullptr;
+    }
+
+    void run_commands() {
+        std::vector<std::function<void()>> batch;
+        {
+            std::lock_guard lock(commands_mutex_);
+            batch.swap(commands_);
+        }
+        for (auto& command : batch) {
+            command();
+        }
+    }
+
+    /**
+     * @brief Close every connection and wait for in-flight operations
+     */
+    void drain() {
+        {
+            std::lock_guard lock(commands_mutex_);
+            commands_.clear();
+        }
+
+        std::vector<std::shared_ptr<io_uring_connection>> remaining;
+        remaining.reserve(connections_.size());
+        for (const auto& [id, connection] : connections_) {
+            remaining.push_back(connection);
+        }
+        for (const auto& connection : remaining) {
+            close_connection(connection, network_error::connection_closed);
+        }
+
+        // Buffers referenced by pending sends must outlive them
+        const int64_t deadline = steady_now_ms() + DRAIN_TIMEOUT.count();
+        while (!connections_.empty() && steady_now_ms() < deadline) {
+            (void)ring_.submit_and_wait(1, std::chrono::milliseconds{100});
+            ring_.for_each_cqe([this](const io_uring_cqe& cqe) { handle_cqe(cqe); });
+        }
+        connections_.clear();
+    }
+
+    // -------------------------------------------------------------------------
+    // Submission helpers
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Next free SQE, flushing the submission queue if it is full
+     */
+    io_uring_sqe* next_sqe() {
+        io_uring_sqe* sqe = ring_.get_sqe();
+        while (!sqe) {
+            (void)ring_.submit_and_wait(0);
+            sqe = ring_.get_sqe();
+        }
+        return sqe;
+    }
+
+    void arm_accept() {
+        io_uring_sqe* sqe = next_sqe();
+        sqe->opcode = IORING_OP_ACCEPT;
+        sqe->fd = listen_fd_;
+        sqe->accept_flags = SOCK_CLOEXEC;
+        if (multishot_accept_) {
+            sqe->ioprio |= IORING_ACCEPT_MULTISHOT;
+        }
+        sqe->user_data = encode(op_kind::accept, 0);
+        accept_armed_ = true;
+    }
+
+    void arm_recv(const std::shared_ptr<io_uring_connection>& connection) {
+        io_uring_sqe* sqe = next_sqe();
+        sqe->opcode = IORING_OP_RECV;
+        sqe->fd = connection->fd;
+        sqe->flags = IOSQE_BUFFER_SELECT;
+        sqe->buf_group = RECV_BUFFER_GROUP;
+        if (multishot_recv_) {
+            sqe->ioprio |= IORING_RECV_MULTISHOT;
+        }
+        sqe->user_data = encode(op_kind::recv, connection->session_id);
+        connection->recv_armed = true;
+    }
+
+    void arm_wake() {
+        io_uring_sqe* sqe = next_sqe();
+        sqe->opcode = IORING_OP_READ;
+        sqe->fd = wake_fd_;
+        sqe->addr = reinterpret_cast<uint64_t>(&wake_value_);
+        sqe->len = sizeof(wake_value_);
+        sqe->user_data = encode(op_kind::wake, 0);
+    }
+
+    void arm_tick() {
+        io_uring_sqe* sqe = next_sqe();
+        sqe->opcode = IORING_OP_TIMEOUT;
+        sqe->addr = reinterpret_cast<uint64_t>(&tick_ts_);
+        sqe->len = 1;
+        sqe->user_data = encode(op_kind::tick, 0);
+    }
+
+    /**
+     * @brief Submit the head of the send queue, linked to a timeout
+     *
+     * Caller holds connection->send_mutex.
+     */
+    void submit_send(const std::shared_ptr<io_uring_connection>& connection) {
+        // The pair must not be split by a flush, or the link is lost
+        if (ring_.sq_space_left() < 2) {
+            (void)ring_.submit_and_wait(0);
+        }
+
+        const auto& front = connection->send_queue.front();
+        io_uring_sqe* sqe = next_sqe();
+        sqe->opcode = IORING_OP_SEND;
+        sqe->fd = connection->fd;
+        sqe->addr = reinterpret_cast<uint64_t>(front.data() + connection->send_offset);
+        sqe->len = static_cast<uint32_t>(front.size() - connection->send_offset);
+        sqe->msg_flags = MSG_NOSIGNAL | MSG_WAITALL;
+        sqe->flags = IOSQE_IO_LINK;
+        sqe->user_data = encode(op_kind::send, connection->session_id);
+
+        io_uring_sqe* timeout = next_sqe();
+        timeout->opcode = IORING_OP_LINK_TIMEOUT;
+        timeout->addr = reinterpret_cast<uint64_t>(&send_timeout_ts_);
+        timeout->len = 1;
+        timeout->user_data = encode(op_kind::send_timeout, connection->session_id);
+
+        connection->send_inflight = true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Completion handling
+    // -------------------------------------------------------------------------
+
+    void handle_cqe(const io_uring_cqe& cqe) {
+        switch (decode_op(cqe.user_data)) {
+            case op_kind::accept:
+                handle_accept(cqe);
+                break;
+            case op_kind::recv:
+                handle_recv(cqe);
+                break;
+            case op_kind::send:
+                handle_send(cqe);
+                break;
+            case op_kind::send_timeout:
+                break;
+            case op_kind::wake:
+                if (!stop_requested_) {
+                    arm_wake();
+                }
+                break;
+            case op_kind::tick:
+                if (!stop_requested_) {
+                    sweep_idle();
+                    if (!accept_armed_) {
+                        arm_accept();
+                    }
+                    arm_tick();
+                }
+                break;
+        }
+    }
+
+    void handle_accept(const io_uring_cqe& cqe) {
+        const bool more = (cqe.flags & IORING_CQE_F_MORE) != 0;
+        if (!more) {
+            accept_armed_ = false;
+        }
+
+        if (cqe.res >= 0) {
+            if (stop_requested_) {
+                ::close(cqe.res);
+            } else if (on_accept_) {
+                on_accept_(cqe.res);
+            }
+            if (!more && !stop_requested_) {
+                arm_accept();
+            }
+            return;
+        }
+
+        if (cqe.res == -EINVAL && multishot_accept_) {
+            // Kernel without multishot accept: re-arm one accept at a time
+            multishot_accept_ = false;
+            arm_accept();
+        }
+        // Other errors (e.g. EMFILE) are retried on the next tick
+    }
+
+    void handle_recv(const io_uring_cqe& cqe) {
+        auto connection = find(cqe.user_data & ID_MASK);
+
+        if (cqe.flags & IORING_CQE_F_BUFFER) {
+            const auto bid = static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+            if (connection && cqe.res > 0 && !connection->closed) {
+                const auto bytes = static_cast<size_t>(cqe.res);
+                connection->record_received(bytes);
+                if (connection->on_data) {
+                    connection->on_data(
+                        std::span<const uint8_t>(ring_.buffer(bid), bytes));
+                }
+            }
+            ring_.recycle_buffer(bid);
+        }
+
+        if (!connection || (cqe.flags & IORING_CQE_F_MORE)) {
+            return;
+        }
+
+        connection->recv_armed = false;
+        if (connection->closed) {
+            try_release(connection);
+            return;
+        }
+
+        if (cqe.res > 0 || cqe.res == -ENOBUFS) {
+            // Single-shot completion, or multishot ended: keep receiving
+            arm_recv(connection);
+            return;
+        }
+        if (cqe.res == -EINVAL && multishot_recv_) {
+            // Kernel without multishot recv: re-arm one recv at a time
+            multishot_recv_ = false;
+            arm_recv(connection);
+            return;
+        }
+
+        close_connection(connection, cqe.res == 0 || cqe.res == -ECONNRESET
+                                         ? network_error::connection_closed
+                                         : network_error::socket_error);
+    }
+
+    void handle_send(const io_uring_cqe& cqe) {
+        auto connection = find(cqe.user_data & ID_MASK);
+        if (!connection) {
+            return;
+        }
+
+        connection->send_inflight = false;
+        if (connection->closed) {
+            std::lock_guard lock(connection->send_mutex);
+            connection->send_queue.clear();
+            try_release(connection);
+            return;
+        }
+
+        if (cqe.res > 0) {
+            connection->record_sent(static_cast<size_t>(cqe.res));
+            std::lock_guard lock(connection->send_mutex);
+            connection->send_offset += static_cast<size_t>(cqe.res);
+            if (connection->send_offset >= connection->send_queue.front().size()) {
+                connection->send_queue.pop_front();
+                connection->send_offset = 0;
+            }
+            if (!connection->send_queue.empty()) {
+                submit_send(connection);
+            }
+            return;
+        }
+
+        // -ECANCELED: the linked timeout fired first
+        close_connection(connection, cqe.res == -ECANCELED
+                                         ? network_error::timeout
+                                         : network_error::socket_error);
+    }
+
+    void sweep_idle() {
+        const int64_t now = steady_now_ms();
+        std::vector<std::shared_ptr<io_uring_connection>> expired;
+        for (const auto& [id, connection] : connections_) {
+            if (connection->async && !connection->closed &&
+                connection->idle_timeout_ms > 0 &&
+                now - connection->last_activity_ms.load(std::memory_order_relaxed) >
+                    connection->idle_timeout_ms) {
+                expired.push_back(connection);
+            }
+        }
+        for (const auto& connection : expired) {
+            close_connection(connection, network_error::timeout);
+        }
+    }
+
+    /**
+     * @brief Forget a closed connection once the kernel holds no references
+     */
+    void try_release(const std::shared_ptr<io_uring_connection>& connection) {
+        if (connection->closed && !connection->recv_armed &&
+            !connection->send_inflight) {
+            connections_.erase(connection->session_id);
+        }
+    }
+
+    [[nodiscard]] std::shared_ptr<io_uring_connection> find(uint64_t id) const {
+        auto it = connections_.find(id);
+        return it != connections_.end() ? it->second : nullptr;
+    }
+
+    io_uring_ring ring_;
+    int listen_fd_ = -1;
+    int wake_fd_ = -1;
+    accept_handler on_accept_;
+    std::thread thread_;
+    std::atomic<bool> stop_requested_{false};
+
+    std::mutex commands_mutex_;
+    std::vector<std::function<void()>> commands_;
+    bool accepting_commands_ = true;
+
+    // Loop-thread state
+    std::unordered_map<uint64_t, std::shared_ptr<io_uring_connection>> connections_;
+    bool accept_armed_ = false;
+    bool multishot_accept_ = true;
+    bool multishot_recv_ = true;
+
+    // Referenced by in-flight SQEs
+    uint64_t wake_value_ = 0;
+    __kernel_timespec tick_ts_{};
+    __kernel_timespec send_timeout_ts_{};
+};
+
+// =============================================================================
+// io_uring Session Implementation
+// =============================================================================
+
+io_uring_mllp_session::io_uring_mllp_session(
+    std::shared_ptr<io_uring_connection> connection,
+    std::shared_ptr<io_uring_loop> loop)
+    : connection_(std::move(connection)), loop_(std::move(loop)) {}
+
+io_uring_mllp_session::~io_uring_mllp_session() { close(); }
+
+std::expected<std::vector<uint8_t>, network_error>
+io_uring_mllp_session::receive(size_t max_bytes,
+                               std::chrono::milliseconds timeout) {
+    std::vector<uint8_t> buffer(max_bytes);
+    auto result = receive_into(buffer, timeout);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+    buffer.resize(result.value());
+    return buffer;
+}
+
+std::expected<size_t, network_error>
+io_uring_mllp_session::receive_into(std::span<uint8_t> buffer,
+                                    std::chrono::milliseconds timeout) {
+    if (!connection_->open) {
+        return std::unexpected(network_error::connection_closed);
+    }
+    if (connection_->async) {
+        // Data is delivered to the push-mode callback
+        return std::unexpected(network_error::socket_error);
+    }
+
+    pollfd pfd{};
+    pfd.fd = connection_->fd;
+    pfd.events = POLLIN;
+    int ready = ::poll(&pfd, 1, static_cast<int>(timeout.count()));
+    if (ready < 0) {
+        return std::unexpected(network_error::socket_error);
+    }
+    if (ready == 0) {
+        return std::unexpected(network_error::timeout);
+    }
+    if (pfd.revents & (POLLERR | POLLNVAL)) {
+        connection_->open = false;
+        return std::unexpected(network_error::connection_closed);
+    }
+
+    ssize_t received =
+        ::recv(connection_->fd, buffer.data(), buffer.size(), MSG_DONTWAIT);
+    if (received > 0) {
+        connection_->record_received(static_cast<size_t>(received));
+        return static_cast<size_t>(received);
+    }
+    if (received == 0) {
+        connection_->open = false;
+        return std::unexpected(network_error::connection_closed);
+    }
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        return std::unexpected(network_error::would_block);
+    }
+    connection_->open = false;
+    return std::unexpected(network_error::socket_error);
+}
+
+bool io_uring_mllp_session::start_async_receive(
+    receive_callback on_data, close_callback on_close,
+    std::chrono::milliseconds idle_timeout) {
+    bool expected = false;
+    if (!connection_->open ||
+        !connection_->async.compare_exchange_strong(expected, true)) {
+        return false;
+    }
+
+    connection_->on_data = std::move(on_data);
+    connection_->on_close = std::move(on_close);
+    connection_->idle_timeout_ms = idle_timeout.count();
+    connection_->last_activity_ms.store(steady_now_ms(),
+                                        std::memory_order_relaxed);
+
+    auto* loop = loop_.get();
+    if (!loop->post([loop, connection = connection_] {
+            loop->start_receive(connection);
+        })) {
+        connection_->on_data = nullptr;
+        connection_->on_close = nullptr;
+        connection_->async = false;
+        return false;
+    }
+    return true;
+}
+
+std::expected<size_t, network_error>
+io_uring_mllp_session::send(std::span<const uint8_t> data) {
+    if (!connection_->open) {
+        return std::unexpected(network_error::connection_closed);
+    }
+    if (data.empty()) {
+        return 0;
+    }
+
+    const size_t total = data.size();
+    {
+        std::unique_lock lock(connection_->send_mutex);
+        if (connection_->send_queue.empty()) {
+            // Nothing queued: write directly while the socket has room,
+            // avoiding a hand-off to the loop thread
+            ssize_t sent = ::send(connection_->fd, data.data(), data.size(),
+                                  MSG_DONTWAIT | MSG_NOSIGNAL);
+            if (sent > 0) {
+                connection_->record_sent(static_cast<size_t>(sent));
+                data = data.subspan(static_cast<size_t>(sent));
+                if (data.empty()) {
+                    return total;
+                }
+            } else if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                lock.unlock();
+                close();
+                return std::unexpected(network_error::socket_error);
+            }
+        }
+
+        // Queue behind earlier sends; the first entry needs a submission
+        connection_->send_queue.emplace_back(data.begin(), data.end());
+        if (connection_->send_queue.size() > 1) {
+            return total;
+        }
+    }
+
+    auto* loop = loop_.get();
+    if (!loop->post([loop, connection = connection_] {
+            loop->flush_send(connection);
+        })) {
+        return std::unexpected(network_error::connection_closed);
+    }
+    return total;
+}
+
+void io_uring_mllp_session::close() {
+    if (connection_->open.exchange(false)) {
+        // Unblocks a blocking receiver immediately
+        ::shutdown(connection_->fd, SHUT_RDWR);
+    }
+    auto* loop = loop_.get();
+    (void)loop->post([loop, connection = connection_] {
+        loop->close_connection(connection, network_error::connection_closed);
+    });
+}
+
+bool io_uring_mllp_session::is_open() const noexcept { return connection_->open; }
+
+session_stats io_uring_mllp_session::get_stats() const noexcept {
+    std::lock_guard lock(connection_->stats_mutex);
+    return connection_->stats;
+}
+
+std::string io_uring_mllp_session::remote_address() const noexcept {
+    return connection_->remote_addr;
+}
+
+uint16_t io_uring_mllp_session::remote_port() const noexcept {
+    return connection_->remote_port;
+}
+
+uint64_t io_uring_mllp_session::session_id() const noexcept {
+    return connection_->session_id;
+}
+
+// =============================================================================
+// io_uring Server Implementation
+// =============================================================================
+
+io_uring_mllp_server::io_uring_mllp_server(const server_config& config)
+    : config_(config),
+      active_sessions_(std::make_shared<std::atomic<size_t>>(0)) {}
+
+io_uring_mllp_server::~io_uring_mllp_server() { stop(false); }
+
+std::expected<void, network_error> io_uring_mllp_server::start() {
+    std::lock_guard lock(state_mutex_);
+
+    if (running_) {
+        return std::unexpected(network_error::socket_error);
+    }
+
+    if (!config_.is_valid()) {
+        return std::unexpected(network_error::invalid_config);
+    }
+
+    if (!io_uring_ring::supported()) {
+        return std::unexpected(network_error::socket_error);
+    }
+
+    if (auto result = create_server_socket(); !result) {
+        return result;
+    }
+
+    loop_ = std::make_shared<io_uring_loop>();
+    if (auto result = loop_->start(listen_fd_, [this](int fd) { accept_connection(fd); });
+        !result) {
+        loop_.reset();
+        ::close(listen_fd_);
+        listen_fd_ = -1;
+        return result;
+    }
+
+    running_ = true;
+    return {};
+}
+
+void io_uring_mllp_server::stop(bool wait_for_connections) {
+    std::lock_guard lock(state_mutex_);
+    if (!running_) {
+        return;
+    }
+
+    // The loop owns every connection; stopping it closes them all
+    // (mllp_server is notified through each session's close callback)
+    loop_->stop();
+    loop_.reset();
+    (void)wait_for_connections;
+
+    ::close(listen_fd_);
+    listen_fd_ = -1;
+    running_ = false;
+}
+
+bool io_uring_mllp_server::is_running() const noexcept { return running_; }
+
+uint16_t io_uring_mllp_server::port() const noexcept { return config_.port; }
+
+void io_uring_mllp_server::on_connection(on_connection_callback callback) {
+    connection_callback_ = std::move(callback);
+}
+
+size_t io_uring_mllp_server::active_session_count() const noexcept {
+    return active_sessions_->load(std::memory_order_relaxed);
+}
+
+std::expected<void, network_error> io_uring_mllp_server::create_server_socket() {
+    listen_fd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, IPPROTO_TCP);
+    if (listen_fd_ < 0) {
+        return std::unexpected(network_error::socket_error);
+    }
+
+    auto fail = [this](network_error error) {
+        ::close(listen_fd_);
+        listen_fd_ = -1;
+        return std::unexpected(error);
+    };
+
+    if (config_.reuse_addr) {
+        int reuse = 1;
+        if (::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse,
+                         sizeof(reuse)) < 0) {
+            return fail(network_error::socket_error);
+        }
+    }
+
+    sockaddr_in server_addr{};
+    server_addr.sin_family = AF_INET;
+    server_addr.sin_port = htons(config_.port);
+    if (config_.bind_address.empty()) {
+        server_addr.sin_addr.s_addr = INADDR_ANY;
+    } else if (::inet_pton(AF_INET, config_.bind_address.c_str(),
+                           &server_addr.sin_addr) <= 0) {
+        return fail(network_error::invalid_config);
+    }
+
+    if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&server_addr),
+               sizeof(server_addr)) < 0) {
+        return fail(network_error::bind_failed);
+    }
+
+    if (::listen(listen_fd_, config_.backlog) < 0) {
+        return fail(network_error::bind_failed);
+    }
+
+    return {};
+}
+
+void io_uring_mllp_server::configure_client_socket(int fd) const {
+    if (config_.no_delay) {
+        int nodelay = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+    }
+
+    if (config_.keep_alive) {
+        int keepalive = 1;
+        ::setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &keepalive,
+                     sizeof(keepalive));
+        ::setsockopt(fd, IPPROTO_TCP, TCP_KEEPIDLE, &config_.keep_alive_idle,
+                     sizeof(config_.keep_alive_idle));
+        ::setsockopt(fd, IPPROTO_TCP, TCP_KEEPINTVL,
+                     &config_.keep_alive_interval,
+                     sizeof(config_.keep_alive_interval));
+        ::setsockopt(fd, IPPROTO_TCP, TCP_KEEPCNT, &config_.keep_alive_count,
+                     sizeof(config_.keep_alive_count));
+    }
+
+    if (config_.recv_buffer_size > 0) {
+        int size = static_cast<int>(config_.recv_buffer_size);
+        ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+    }
+
+    if (config_.send_buffer_size > 0) {
+        int size = static_cast<int>(config_.send_buffer_size);
+        ::setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+    }
+}
+
+void io_uring_mllp_server::accept_connection(int fd) {
+    configure_client_socket(fd);
+
+    // Multishot accept cannot return per-connection addresses
+    sockaddr_in client_addr{};
+    socklen_t client_addr_len = sizeof(client_addr);
+    char addr_str[INET_ADDRSTRLEN] = {};
+    if (::getpeername(fd, reinterpret_cast<sockaddr*>(&client_addr),
+                      &client_addr_len) == 0) {
+        ::inet_ntop(AF_INET, &client_addr.sin_addr, addr_str, sizeof(addr_str));
+    }
+
+    active_sessions_->fetch_add(1, std::memory_order_relaxed);
+    auto connection = std::make_shared<io_uring_connection>(
+        fd, next_session_id_++, std::string(addr_str),
+        ntohs(client_addr.sin_port), active_sessions_);
+    loop_->add(connection);
+
+    auto session =
+        std::make_unique<io_uring_mllp_session>(std::move(connection), loop_);
+    if (connection_callback_) {
+        connection_callback_(std::move(session));
+    }
+}
+
+}  // namespace pacs::bridge::mllp
+
+#endif  // PACS_BRIDGE_HAS_IO_URING
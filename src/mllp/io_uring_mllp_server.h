@@ -0,0 +1,157 @@
+#ifndef PACS_BRIDGE_MLLP_IO_URING_MLLP_SERVER_H
+#define PACS_BRIDGE_MLLP_IO_URING_MLLP_SERVER_H
+
+/**
+ * @file io_uring_mllp_server.h
+ * @brief io_uring implementation of MLLP network adapter
+ *
+ * A single completion-driven loop thread serves the listener and every
+ * connection:
+ * - Multishot accept: one submission yields all incoming connections
+ * - Multishot recv with provided buffers: one submission per connection
+ *   delivers every chunk, without a per-connection read buffer
+ * - Send linked to a link timeout: responses the socket cannot take at once
+ *   are queued from any thread, batched into the loop's next io_uring_enter,
+ *   and bounded in time
+ *
+ * Receiving a message costs no system call of its own; each loop iteration
+ * submits and reaps in one io_uring_enter. Multishot operations fall back to
+ * re-armed single-shot ones on kernels that reject them.
+ *
+ * send() does not block: when nothing is queued it writes directly with
+ * MSG_DONTWAIT, and queues whatever the socket did not accept, in order
+ * behind earlier sends, for the loop to complete. A failed queued send
+ * closes the session, which is reported through the close callback.
+ *
+ * Linux only. Check io_uring_ring::supported() before use.
+ */
+
+#include "io_uring_ring.h"
+#include "pacs/bridge/mllp/mllp_network_adapter.h"
+
+#ifdef PACS_BRIDGE_HAS_IO_URING
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace pacs::bridge::mllp {
+
+class io_uring_loop;
+struct io_uring_connection;
+
+// =============================================================================
+// io_uring Session Implementation
+// =============================================================================
+
+/**
+ * @brief mllp_session served by an io_uring loop
+ *
+ * Push mode (start_async_receive) uses the loop's multishot recv. Blocking
+ * receive()/receive_into() poll the socket directly, as bsd_mllp_session
+ * does.
+ */
+class io_uring_mllp_session : public mllp_session {
+public:
+    io_uring_mllp_session(std::shared_ptr<io_uring_connection> connection,
+                          std::shared_ptr<io_uring_loop> loop);
+
+    ~io_uring_mllp_session() override;
+
+    // Implement mllp_session interface
+    [[nodiscard]] std::expected<std::vector<uint8_t>, network_error>
+    receive(size_t max_bytes, std::chrono::milliseconds timeout) override;
+
+    [[nodiscard]] std::expected<size_t, network_error>
+    receive_into(std::span<uint8_t> buffer,
+                 std::chrono::milliseconds timeout) override;
+
+    [[nodiscard]] bool
+    start_async_receive(receive_callback on_data, close_callback on_close,
+                        std::chrono::milliseconds idle_timeout) override;
+
+    [[nodiscard]] std::expected<size_t, network_error>
+    send(std::span<const uint8_t> data) override;
+
+    void close() override;
+
+    [[nodiscard]] bool is_open() const noexcept override;
+
+    [[nodiscard]] session_stats get_stats() const noexcept override;
+
+    [[nodiscard]] std::string remote_address() const noexcept override;
+
+    [[nodiscard]] uint16_t remote_port() const noexcept override;
+
+    [[nodiscard]] uint64_t session_id() const noexcept override;
+
+private:
+    std::shared_ptr<io_uring_connection> connection_;
+    std::shared_ptr<io_uring_loop> loop_;
+};
+
+// =============================================================================
+// io_uring Server Adapter Implementation
+// =============================================================================
+
+/**
+ * @brief io_uring implementation of mllp_server_adapter
+ */
+class io_uring_mllp_server : public mllp_server_adapter {
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param config Server configuration
+     */
+    explicit io_uring_mllp_server(const server_config& config);
+
+    ~io_uring_mllp_server() override;
+
+    // Implement mllp_server_adapter interface
+    [[nodiscard]] std::expected<void, network_error> start() override;
+
+    void stop(bool wait_for_connections = true) override;
+
+    [[nodiscard]] bool is_running() const noexcept override;
+
+    [[nodiscard]] uint16_t port() const noexcept override;
+
+    void on_connection(on_connection_callback callback) override;
+
+    [[nodiscard]] size_t active_session_count() const noexcept override;
+
+private:
+    /**
+     * @brief Create, bind and listen on the server socket
+     */
+    [[nodiscard]] std::expected<void, network_error> create_server_socket();
+
+    /**
+     * @brief Apply per-connection socket options (keep-alive, nodelay, ...)
+     */
+    void configure_client_socket(int fd) const;
+
+    /**
+     * @brief Wrap an accepted socket in a session (loop thread)
+     */
+    void accept_connection(int fd);
+
+    server_config config_;
+    int listen_fd_ = -1;
+
+    std::shared_ptr<io_uring_loop> loop_;
+    on_connection_callback connection_callback_;
+
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> next_session_id_{1};
+    std::shared_ptr<std::atomic<size_t>> active_sessions_;
+
+    mutable std::mutex state_mutex_;
+};
+
+}  // namespace pacs::bridge::mllp
+
+#endif  // PACS_BRIDGE_HAS_IO_URING
+
+#endif  // PACS_BRIDGE_MLLP_IO_URING_MLLP_SERVER_H
@@ -0,0 +1,275 @@
+/**
+ * @file io_uring_ring.cpp
+ * @brief Minimal io_uring submission/completion ring
+ *
+ * @see src/mllp/io_uring_ring.h
+ */
+
+#include "io_uring_ring.h"
+
+#ifdef PACS_BRIDGE_HAS_IO_URING
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <initializer_list>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace pacs::bridge::mllp {
+
+namespace {
+
+int sys_io_uring_setup(unsigned entries, io_uring_params* params) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+                       unsigned flags, const void* arg, size_t arg_size) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit,
+                                      min_complete, flags, arg, arg_size));
+}
+
+int sys_io_uring_register(int fd, unsigned opcode, const void* arg,
+                          unsigned nr_args) noexcept {
+    return static_cast<int>(
+        ::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+void* map_ring(int fd, size_t size, uint64_t offset) noexcept {
+    void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, fd, static_cast<off_t>(offset));
+    return ptr == MAP_FAILED ? nullptr : ptr;
+}
+
+template <typename T>
+T* ring_field(void* base, uint32_t offset) noexcept {
+    return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+}
+
+bool probe_opcodes(int ring_fd) noexcept {
+    constexpr unsigned probe_ops = 256;
+    std::vector<uint8_t> storage(sizeof(io_uring_probe) +
+                                 probe_ops * sizeof(io_uring_probe_op));
+    auto* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+    if (sys_io_uring_register(ring_fd, IORING_REGISTER_PROBE, probe,
+                              probe_ops) < 0) {
+        return false;
+    }
+
+    const auto* ops = reinterpret_cast<const io_uring_probe_op*>(
+        storage.data() + sizeof(io_uring_probe));
+    for (unsigned op : {IORING_OP_ACCEPT, IORING_OP_RECV, IORING_OP_SEND,
+                        IORING_OP_READ, IORING_OP_TIMEOUT,
+                        IORING_OP_LINK_TIMEOUT, IORING_OP_ASYNC_CANCEL}) {
+        if (op > probe->last_op || !(ops[op].flags & IO_URING_OP_SUPPORTED)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // anonymous namespace
+
+io_uring_ring::~io_uring_ring() { release(); }
+
+bool io_uring_ring::supported() noexcept {
+    static const bool result = [] {
+        io_uring_ring ring;
+        if (!ring.init(8)) {
+            return false;
+        }
+        if (!(ring.features_ & IORING_FEAT_EXT_ARG)) {
+            return false;
+        }
+        if (!probe_opcodes(ring.ring_fd_)) {
+            return false;
+        }
+        // Provided-buffer rings (5.19) gate multishot accept/recv as well
+        return ring.setup_buffer_ring(0, 2, 64);
+    }();
+    return result;
+}
+
+bool io_uring_ring::init(unsigned entries, unsigned cq_entries) noexcept {
+    io_uring_params params{};
+    params.flags = IORING_SETUP_COOP_TASKRUN;
+    if (cq_entries > 0) {
+        params.flags |= IORING_SETUP_CQSIZE;
+        params.cq_entries = cq_entries;
+    }
+
+    ring_fd_ = sys_io_uring_setup(entries, &params);
+    if (ring_fd_ < 0 && errno == EINVAL) {
+        // Older kernels reject COOP_TASKRUN
+        params = {};
+        if (cq_entries > 0) {
+            params.flags = IORING_SETUP_CQSIZE;
+            params.cq_entries = cq_entries;
+        }
+        ring_fd_ = sys_io_uring_setup(entries, &params);
+    }
+    if (ring_fd_ < 0) {
+        return false;
+    }
+    features_ = params.features;
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = (features_ & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+        sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+
+    sq_ptr_ = map_ring(ring_fd_, sq_ring_size_, IORING_OFF_SQ_RING);
+    if (!sq_ptr_) {
+        release();
+        return false;
+    }
+    cq_ptr_ = single_mmap ? sq_ptr_
+                          : map_ring(ring_fd_, cq_ring_size_, IORING_OFF_CQ_RING);
+    if (!cq_ptr_) {
+        release();
+        return false;
+    }
+
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = static_cast<io_uring_sqe*>(
+        map_ring(ring_fd_, sqes_size_, IORING_OFF_SQES));
+    if (!sqes_) {
+        release();
+        return false;
+    }
+
+    sq_head_ = ring_field<unsigned>(sq_ptr_, params.sq_off.head);
+    sq_tail_ = ring_field<unsigned>(sq_ptr_, params.sq_off.tail);
+    sq_mask_ = ring_field<unsigned>(sq_ptr_, params.sq_off.ring_mask);
+    sq_array_ = ring_field<unsigned>(sq_ptr_, params.sq_off.array);
+    sq_entries_ = params.sq_entries;
+    sqe_tail_ = *sq_tail_;
+
+    cq_head_ = ring_field<unsigned>(cq_ptr_, params.cq_off.head);
+    cq_tail_ = ring_field<unsigned>(cq_ptr_, params.cq_off.tail);
+    cq_mask_ = ring_field<unsigned>(cq_ptr_, params.cq_off.ring_mask);
+    cqes_ = ring_field<io_uring_cqe>(cq_ptr_, params.cq_off.cqes);
+    return true;
+}
+
+io_uring_sqe* io_uring_ring::get_sqe() noexcept {
+    const unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    if (sqe_tail_ - head >= sq_entries_) {
+        return nullptr;
+    }
+    const unsigned index = sqe_tail_ & *sq_mask_;
+    sq_array_[index] = index;
+    ++sqe_tail_;
+
+    io_uring_sqe* sqe = &sqes_[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+int io_uring_ring::submit_and_wait(unsigned wait_nr,
+                                   std::chrono::milliseconds timeout) noexcept {
+    __atomic_store_n(sq_tail_, sqe_tail_, __ATOMIC_RELEASE);
+    const unsigned to_submit =
+        sqe_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+
+    unsigned flags = wait_nr > 0 ? IORING_ENTER_GETEVENTS : 0;
+    __kernel_timespec ts{};
+    io_uring_getevents_arg arg{};
+    const void* arg_ptr = nullptr;
+    size_t arg_size = 0;
+    if (wait_nr > 0 && timeout.count() >= 0) {
+        ts.tv_sec = timeout.count() / 1000;
+        ts.tv_nsec = (timeout.count() % 1000) * 1000000;
+        arg.ts = reinterpret_cast<uint64_t>(&ts);
+        flags |= IORING_ENTER_EXT_ARG;
+        arg_ptr = &arg;
+        arg_size = sizeof(arg);
+    }
+
+    while (true) {
+        int ret = sys_io_uring_enter(ring_fd_, to_submit, wait_nr, flags,
+                                     arg_ptr, arg_size);
+        if (ret >= 0) {
+            return ret;
+        }
+        if (errno != EINTR) {
+            return -errno;
+        }
+    }
+}
+
+bool io_uring_ring::setup_buffer_ring(uint16_t group, unsigned count,
+                                      size_t size) noexcept {
+    buf_ring_size_ = count * sizeof(io_uring_buf);
+    void* mem = ::mmap(nullptr, buf_ring_size_, PROT_READ | PROT_WRITE,
+                       MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    if (mem == MAP_FAILED) {
+        return false;
+    }
+
+    io_uring_buf_reg reg{};
+    reg.ring_addr = reinterpret_cast<uint64_t>(mem);
+    reg.ring_entries = count;
+    reg.bgid = group;
+    if (sys_io_uring_register(ring_fd_, IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+        ::munmap(mem, buf_ring_size_);
+        return false;
+    }
+
+    buf_ring_ = static_cast<io_uring_buf_ring*>(mem);
+    buf_count_ = count;
+    buf_group_ = group;
+    buffer_size_ = size;
+    buffer_memory_.resize(count * size);
+
+    buf_tail_ = 0;
+    for (unsigned bid = 0; bid < count; ++bid) {
+        recycle_buffer(static_cast<uint16_t>(bid));
+    }
+    return true;
+}
+
+void io_uring_ring::recycle_buffer(uint16_t bid) noexcept {
+    auto* bufs = reinterpret_cast<io_uring_buf*>(buf_ring_);
+    io_uring_buf& slot = bufs[buf_tail_ & (buf_count_ - 1)];
+    slot.addr = reinterpret_cast<uint64_t>(buffer(bid));
+    slot.len = static_cast<uint32_t>(buffer_size_);
+    slot.bid = bid;
+    ++buf_tail_;
+    __atomic_store_n(&buf_ring_->tail, buf_tail_, __ATOMIC_RELEASE);
+}
+
+void io_uring_ring::release() noexcept {
+    if (buf_ring_) {
+        io_uring_buf_reg reg{};
+        reg.bgid = buf_group_;
+        sys_io_uring_register(ring_fd_, IORING_UNREGISTER_PBUF_RING, &reg, 1);
+        ::munmap(buf_ring_, buf_ring_size_);
+        buf_ring_ = nullptr;
+    }
+    if (sqes_) {
+        ::munmap(sqes_, sqes_size_);
+        sqes_ = nullptr;
+    }
+    if (cq_ptr_ && cq_ptr_ != sq_ptr_) {
+        ::munmap(cq_ptr_, cq_ring_size_);
+    }
+    cq_ptr_ = nullptr;
+    if (sq_ptr_) {
+        ::munmap(sq_ptr_, sq_ring_size_);
+        sq_ptr_ = nullptr;
+    }
+    if (ring_fd_ >= 0) {
+        ::close(ring_fd_);
+        ring_fd_ = -1;
+    }
+}
+
+}  // namespace pacs::bridge::mllp
+
+#endif  // PACS_BRIDGE_HAS_IO_URING
@@ -0,0 +1,177 @@
+#ifndef PACS_BRIDGE_MLLP_IO_URING_RING_H
+#define PACS_BRIDGE_MLLP_IO_URING_RING_H
+
+/**
+ * @file io_uring_ring.h
+ * @brief Minimal io_uring submission/completion ring
+ *
+ * Thin wrapper over the io_uring system calls and shared rings, sufficient
+ * for the MLLP transports: SQE allocation, batched submit-and-wait with an
+ * optional timeout, completion iteration, and one provided-buffer ring for
+ * buffer-select receives. Uses the kernel UAPI header directly, so there is
+ * no liburing dependency.
+ *
+ * Not thread-safe; each ring is driven by a single thread.
+ *
+ * Linux only. PACS_BRIDGE_HAS_IO_URING is defined when the UAPI header
+ * declares everything the ring uses: provided-buffer rings, multishot
+ * accept/recv, cooperative task running and cancel-all (Linux 6.0+
+ * headers). Older headers build the epoll transports only.
+ * io_uring_ring::supported() reports whether the running kernel allows and
+ * implements the operations the transports need.
+ */
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+// Macros added with the UAPI the ring depends on; io_uring_buf_ring,
+// IORING_REGISTER_PBUF_RING and io_uring_getevents_arg ship alongside them
+#if defined(IORING_RECV_MULTISHOT) && defined(IORING_ACCEPT_MULTISHOT) && \
+    defined(IORING_SETUP_COOP_TASKRUN) && defined(IORING_ASYNC_CANCEL_ALL)
+#define PACS_BRIDGE_HAS_IO_URING 1
+#endif
+#endif
+
+#ifdef PACS_BRIDGE_HAS_IO_URING
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pacs::bridge::mllp {
+
+class io_uring_ring {
+public:
+    io_uring_ring() = default;
+    ~io_uring_ring();
+
+    io_uring_ring(const io_uring_ring&) = delete;
+    io_uring_ring& operator=(const io_uring_ring&) = delete;
+
+    /**
+     * @brief Check once whether the kernel supports the MLLP transports
+     *
+     * Requires accept, recv, send, read, timeout, link timeout and cancel
+     * opcodes, extended wait arguments and provided-buffer rings. Returns
+     * false when io_uring is disabled (e.g. by sysctl or seccomp).
+     */
+    [[nodiscard]] static bool supported() noexcept;
+
+    /**
+     * @brief Create the ring
+     *
+     * @param entries Submission queue entries (rounded up by the kernel)
+     * @param cq_entries Completion queue entries (0 = kernel default)
+     * @return false if io_uring_setup or mmap failed
+     */
+    [[nodiscard]] bool init(unsigned entries, unsigned cq_entries = 0) noexcept;
+
+    [[nodiscard]] bool is_initialized() const noexcept { return ring_fd_ >= 0; }
+
+    /**
+     * @brief Next free submission entry, zeroed; nullptr if the SQ is full
+     */
+    [[nodiscard]] io_uring_sqe* get_sqe() noexcept;
+
+    /** Free submission entries */
+    [[nodiscard]] unsigned sq_space_left() const noexcept {
+        return sq_entries_ - (sqe_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE));
+    }
+
+    /**
+     * @brief Submit queued entries and wait for completions
+     *
+     * @param wait_nr Completions to wait for (0 = submit only)
+     * @param timeout Wait limit (negative = no limit)
+     * @return Entries submitted, or -errno (-ETIME on timeout)
+     */
+    int submit_and_wait(unsigned wait_nr,
+                        std::chrono::milliseconds timeout =
+                            std::chrono::milliseconds{-1}) noexcept;
+
+    /**
+     * @brief Invoke handler for every available completion and consume them
+     * @return Number of completions handled
+     */
+    template <typename Handler>
+    unsigned for_each_cqe(Handler&& handler) {
+        unsigned head = *cq_head_;
+        const unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        unsigned count = 0;
+        while (head != tail) {
+            // Copy so the slot can be released before the handler submits
+            const io_uring_cqe cqe = cqes_[head & *cq_mask_];
+            ++head;
+            ++count;
+            __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+            handler(cqe);
+        }
+        return count;
+    }
+
+    // -------------------------------------------------------------------------
+    // Provided buffers
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Register a provided-buffer ring for buffer-select receives
+     *
+     * @param group Buffer group id used in sqe->buf_group
+     * @param count Number of buffers (power of two)
+     * @param size Size of each buffer
+     */
+    [[nodiscard]] bool setup_buffer_ring(uint16_t group, unsigned count,
+                                         size_t size) noexcept;
+
+    /** Address of provided buffer bid */
+    [[nodiscard]] uint8_t* buffer(uint16_t bid) noexcept {
+        return buffer_memory_.data() + static_cast<size_t>(bid) * buffer_size_;
+    }
+
+    /** Size of each provided buffer */
+    [[nodiscard]] size_t buffer_size() const noexcept { return buffer_size_; }
+
+    /** Return provided buffer bid to the kernel */
+    void recycle_buffer(uint16_t bid) noexcept;
+
+private:
+    void release() noexcept;
+
+    int ring_fd_ = -1;
+    unsigned features_ = 0;
+
+    // Submission queue
+    void* sq_ptr_ = nullptr;
+    size_t sq_ring_size_ = 0;
+    io_uring_sqe* sqes_ = nullptr;
+    size_t sqes_size_ = 0;
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ = nullptr;
+    unsigned* sq_mask_ = nullptr;
+    unsigned* sq_array_ = nullptr;
+    unsigned sq_entries_ = 0;
+    unsigned sqe_tail_ = 0;
+
+    // Completion queue
+    void* cq_ptr_ = nullptr;
+    size_t cq_ring_size_ = 0;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned* cq_mask_ = nullptr;
+    io_uring_cqe* cqes_ = nullptr;
+
+    // Provided-buffer ring
+    io_uring_buf_ring* buf_ring_ = nullptr;
+    size_t buf_ring_size_ = 0;
+    unsigned buf_count_ = 0;
+    uint16_t buf_group_ = 0;
+    uint16_t buf_tail_ = 0;
+    size_t buffer_size_ = 0;
+    std::vector<uint8_t> buffer_memory_;
+};
+
+}  // namespace pacs::bridge::mllp
+
+#endif  // PACS_BRIDGE_HAS_IO_URING
+
+#endif  // PACS_BRIDGE_MLLP_IO_URING_RING_H
@@ -10,6 +10,7 @@
  * - Uses BSD sockets for cross-platform TCP networking
  * - Implements proper MLLP framing with VT/FS/CR markers
  * - Supports TLS 1.2/1.3 via OpenSSL when PACS_BRIDGE_HAS_OPENSSL is defined
+ * - Optionally exchanges messages through io_uring (Linux, plaintext only)
  * - Thread-safe operations for concurrent message sending
  * - Connection pooling support via mllp_connection_pool
  *
@@ -18,6 +19,9 @@
  */
 
 #include "pacs/bridge/mllp/mllp_client.h"
+#include "pacs/bridge/mllp/mllp_frame_scanner.h"
+
+#include "io_uring_ring.h"
 
 #include "pacs/bridge/monitoring/bridge_metrics.h"
 
@@ -135,9 +139,7 @@ private:
  */
 class mllp_client::impl {
 public:
-    explicit impl(const mllp_client_config& config) : config_(config) {
-        receive_buffer_.reserve(8192);
-    }
+    explicit impl(const mllp_client_config& config) : config_(config) {}
 
     ~impl() { disconnect_internal(false); }
 
@@ -232,6 +234,16 @@ public:
             }
         }
 
+#ifdef PACS_BRIDGE_HAS_IO_URING
+        if (config_.use_io_uring && !config_.tls.enabled &&
+            io_uring_ring::supported()) {
+            auto ring = std::make_unique<io_uring_ring>();
+            if (ring->init(URING_ENTRIES)) {
+                ring_ = std::move(ring);
+            }
+        }
+#endif
+
         // Update session info
         session_info_.session_id = ++session_counter_;
         session_info_.remote_address = config_.host;
@@ -270,9 +282,12 @@ public:
         }
 #endif
 
+#ifdef PACS_BRIDGE_HAS_IO_URING
+        ring_.reset();
+#endif
         close_socket();
         connected_ = false;
-        receive_buffer_.clear();
+        framer_.reset();
     }
 
     [[nodiscard]] bool is_connected() const noexcept {
@@ -321,16 +336,9 @@ public:
                 }
             }
 
-            // Frame and send message
+            // Frame and send message, then wait for response
             auto framed = message.frame();
-            if (auto result = send_data(framed); !result) {
-                increment_stat(&stats_.send_errors);
-                retry_count++;
-                continue;
-            }
-
-            // Wait for response
-            auto response = receive_response();
+            auto response = exchange(framed);
             if (!response) {
                 increment_stat(&stats_.send_errors);
                 retry_count++;
@@ -745,8 +753,24 @@ private:
         return {};
     }
 
+    /**
+     * @brief Send one framed message and read its response
+     */
+    [[nodiscard]] std::optional<mllp_message>
+    exchange(const std::vector<uint8_t>& framed) {
+#ifdef PACS_BRIDGE_HAS_IO_URING
+        if (ring_) {
+            return uring_exchange(framed);
+        }
+#endif
+        if (!send_data(framed)) {
+            return std::nullopt;
+        }
+        return receive_response();
+    }
+
     [[nodiscard]] std::optional<mllp_message> receive_response() {
-        receive_buffer_.clear();
+        framer_.reset();
         std::vector<uint8_t> read_buffer(4096);
 
         auto start_time = std::chrono::steady_clock::now();
@@ -781,45 +805,170 @@ private:
             add_stat(&stats_.bytes_received, static_cast<size_t>(bytes_read));
             session_info_.bytes_received += static_cast<size_t>(bytes_read);
 
-            // Append to buffer
-            receive_buffer_.insert(receive_buffer_.end(),
-                                   read_buffer.begin(),
-                                   read_buffer.begin() + bytes_read);
-
-            // Check for complete MLLP message
-            auto msg = extract_message();
-            if (msg) {
-                return msg;
+            // Check for complete MLLP message; bytes after the first
+            // response frame are discarded
+            std::span<const uint8_t> input(read_buffer.data(),
+                                           static_cast<size_t>(bytes_read));
+            while (!input.empty()) {
+                auto frame = framer_.next_frame(input);
+                if (!frame) {
+                    return std::nullopt;
+                }
+                if (*frame) {
+                    mllp_message msg;
+                    msg.content = std::move(**frame);
+                    msg.received_at = std::chrono::system_clock::now();
+                    return msg;
+                }
             }
         }
     }
 
-    [[nodiscard]] std::optional<mllp_message> extract_message() {
-        // Look for start byte
-        auto start_it = std::find(receive_buffer_.begin(), receive_buffer_.end(),
-                                   static_cast<uint8_t>(MLLP_START_BYTE));
-        if (start_it == receive_buffer_.end()) {
-            return std::nullopt;
-        }
+#ifdef PACS_BRIDGE_HAS_IO_URING
+    // =========================================================================
+    // io_uring Data Transfer
+    // =========================================================================
 
-        // Look for end sequence (FS + CR)
-        for (auto it = start_it + 1; it < receive_buffer_.end() - 1; ++it) {
-            if (*it == static_cast<uint8_t>(MLLP_END_BYTE) &&
-                *(it + 1) == static_cast<uint8_t>(MLLP_CARRIAGE_RETURN)) {
-                // Found complete message
-                mllp_message msg;
-                msg.content.assign(start_it + 1, it);
-                msg.received_at = std::chrono::system_clock::now();
+    static constexpr unsigned URING_ENTRIES = 4;
+    static constexpr uint64_t URING_SEND = 1;
+    static constexpr uint64_t URING_RECV = 2;
+    static constexpr uint64_t URING_CANCEL = 3;
+
+    void uring_prepare_recv() {
+        io_uring_sqe* sqe = ring_->get_sqe();
+        sqe->opcode = IORING_OP_RECV;
+        sqe->fd = socket_;
+        sqe->addr = reinterpret_cast<uint64_t>(uring_buffer_.data());
+        sqe->len = static_cast<uint32_t>(uring_buffer_.size());
+        sqe->user_data = URING_RECV;
+    }
 
-                // Remove processed data from buffer
-                receive_buffer_.erase(receive_buffer_.begin(), it + 2);
+    /**
+     * @brief Exchange through io_uring
+     *
+     * The send is linked to the first receive, so both are submitted and
+     * completed by a single io_uring_enter in the common case where the
+     * response fits in one read. Further receives are issued only for
+     * responses split across segments.
+     */
+    [[nodiscard]] std::optional<mllp_message>
+    uring_exchange(const std::vector<uint8_t>& framed) {
+        framer_.reset();
+        uring_buffer_.resize(4096);
+
+        io_uring_sqe* sqe = ring_->get_sqe();
+        sqe->opcode = IORING_OP_SEND;
+        sqe->fd = socket_;
+        sqe->addr = reinterpret_cast<uint64_t>(framed.data());
+        sqe->len = static_cast<uint32_t>(framed.size());
+        sqe->msg_flags = MSG_NOSIGNAL | MSG_WAITALL;
+        sqe->flags = IOSQE_IO_LINK;
+        sqe->user_data = URING_SEND;
+        uring_prepare_recv();
+
+        const auto deadline = std::chrono::steady_clock::now() + config_.io_timeout;
+        unsigned inflight = 2;
+        bool failed = false;
+        std::optional<mllp_message> response;
+
+        while (inflight > 0) {
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now());
+            if (remaining.count() <= 0) {
+                failed = true;
+                break;
+            }
+            int ret = ring_->submit_and_wait(1, remaining);
+            if (ret < 0 && ret != -ETIME) {
+                failed = true;
+                break;
+            }
+
+            bool need_recv = false;
+            ring_->for_each_cqe([&](const io_uring_cqe& cqe) {
+                --inflight;
+                if (cqe.user_data == URING_SEND) {
+                    if (cqe.res != static_cast<int>(framed.size())) {
+                        failed = true;
+                        return;
+                    }
+                    add_stat(&stats_.bytes_sent, framed.size());
+                    session_info_.bytes_sent += framed.size();
+                    return;
+                }
+                if (cqe.res <= 0) {
+                    failed = true;
+                    return;
+                }
 
-                return msg;
+                const auto bytes = static_cast<size_t>(cqe.res);
+                add_stat(&stats_.bytes_received, bytes);
+                session_info_.bytes_received += bytes;
+
+                // Bytes after the first response frame are discarded
+                std::span<const uint8_t> input(uring_buffer_.data(), bytes);
+                while (!input.empty() && !response) {
+                    auto frame = framer_.next_frame(input);
+                    if (!frame) {
+                        failed = true;
+                        return;
+                    }
+                    if (*frame) {
+                        mllp_message msg;
+                        msg.content = std::move(**frame);
+                        msg.received_at = std::chrono::system_clock::now();
+                        response = std::move(msg);
+                    }
+                }
+                need_recv = !response;
+            });
+
+            if (failed) {
+                break;
+            }
+            if (need_recv) {
+                uring_prepare_recv();
+                ++inflight;
             }
         }
 
-        return std::nullopt;
+        if (failed) {
+            uring_cancel(inflight);
+            return std::nullopt;
+        }
+        return response;
+    }
+
+    /**
+     * @brief Cancel operations still in flight and reap their completions
+     *
+     * The kernel may still reference the caller's buffers until then.
+     */
+    void uring_cancel(unsigned inflight) {
+        if (inflight == 0) {
+            return;
+        }
+        io_uring_sqe* sqe = ring_->get_sqe();
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = socket_;
+        sqe->cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+        sqe->user_data = URING_CANCEL;
+
+        bool cancel_done = false;
+        while (inflight > 0 || !cancel_done) {
+            if (ring_->submit_and_wait(1) < 0) {
+                break;
+            }
+            ring_->for_each_cqe([&](const io_uring_cqe& cqe) {
+                if (cqe.user_data == URING_CANCEL) {
+                    cancel_done = true;
+                } else {
+                    --inflight;
+                }
+            });
+        }
     }
+#endif
 
     // =========================================================================
     // Statistics Helpers
@@ -873,7 +1022,13 @@ private:
     mllp_session_info session_info_;
 
     // Receive buffer
-    std::vector<uint8_t> receive_buffer_;
+    mllp_frame_scanner framer_;
+
+#ifdef PACS_BRIDGE_HAS_IO_URING
+    // io_uring transport (nullptr = blocking socket calls)
+    std::unique_ptr<io_uring_ring> ring_;
+    std::vector<uint8_t> uring_buffer_;
+#endif
 
     // Statistics
     mutable std::mutex stats_mutex_;
@@ -0,0 +1,102 @@
+/**
+ * @file mllp_frame_scanner.cpp
+ * @brief Implementation of incremental MLLP frame extraction
+ *
+ * @see include/pacs/bridge/mllp/mllp_frame_scanner.h
+ */
+
+#include "pacs/bridge/mllp/mllp_frame_scanner.h"
+
+#include <cstring>
+
+namespace pacs::bridge::mllp {
+
+namespace {
+
+/**
+ * @brief Offset of the first occurrence of byte in input, or input.size()
+ */
+size_t find_byte(std::span<const uint8_t> input, char byte) noexcept {
+    const void* hit = std::memchr(input.data(), static_cast<unsigned char>(byte),
+                                  input.size());
+    return hit ? static_cast<size_t>(static_cast<const uint8_t*>(hit) -
+                                     input.data())
+               : input.size();
+}
+
+}  // namespace
+
+mllp_frame_scanner::mllp_frame_scanner(size_t max_message_size)
+    : max_message_size_(max_message_size) {}
+
+std::expected<std::optional<std::vector<uint8_t>>, mllp_error>
+mllp_frame_scanner::next_frame(std::span<const uint8_t>& input) {
+    while (!input.empty()) {
+        switch (state_) {
+            case scan_state::seeking_start: {
+                const size_t start = find_byte(input, MLLP_START_BYTE);
+                if (start == input.size()) {
+                    // No start marker; discard garbage
+                    input = {};
+                    return std::nullopt;
+                }
+                input = input.subspan(start + 1);
+                state_ = scan_state::in_body;
+                break;
+            }
+
+            case scan_state::in_body: {
+                const size_t end = find_byte(input, MLLP_END_BYTE);
+                if (body_.size() + end > max_message_size_) {
+                    input = {};
+                    reset();
+                    return std::unexpected(mllp_error::message_too_large);
+                }
+                const auto body_bytes = input.first(end);
+                body_.insert(body_.end(), body_bytes.begin(), body_bytes.end());
+                if (end == input.size()) {
+                    input = {};
+                    return std::nullopt;
+                }
+                input = input.subspan(end + 1);
+                state_ = scan_state::after_end_byte;
+                break;
+            }
+
+            case scan_state::after_end_byte: {
+                if (input.front() != static_cast<uint8_t>(MLLP_CARRIAGE_RETURN)) {
+                    // Lone FS is part of the payload
+                    body_.push_back(static_cast<uint8_t>(MLLP_END_BYTE));
+                    state_ = scan_state::in_body;
+                    break;
+                }
+                input = input.subspan(1);
+                state_ = scan_state::seeking_start;
+                std::vector<uint8_t> payload = std::move(body_);
+                body_ = {};
+                return payload;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+void mllp_frame_scanner::recycle(std::vector<uint8_t>&& buffer) noexcept {
+    if (!body_.empty() || buffer.capacity() > max_recycled_capacity ||
+        buffer.capacity() <= body_.capacity()) {
+        return;
+    }
+    body_ = std::move(buffer);
+    body_.clear();
+}
+
+void mllp_frame_scanner::reset() noexcept {
+    state_ = scan_state::seeking_start;
+    if (body_.capacity() > max_recycled_capacity) {
+        body_ = {};
+    } else {
+        body_.clear();
+    }
+}
+
+}  // namespace pacs::bridge::mllp
@@ -2,16 +2,33 @@
  * @file mllp_network_adapter.cpp
  * @brief Implementation of network adapter interfaces
  *
- * This file currently contains no implementation as the adapter interfaces
- * are pure virtual. Concrete implementations are in bsd_mllp_server.cpp
- * and future TLS-enabled implementations.
+ * Provides default implementations for the non-pure parts of the adapter
+ * interfaces. Concrete implementations are in bsd_mllp_server.cpp,
+ * tls_mllp_server.cpp and network_system_mllp_server.cpp.
  */
 
 #include "pacs/bridge/mllp/mllp_network_adapter.h"
 
+#include <algorithm>
+
 namespace pacs::bridge::mllp {
 
-// This file intentionally left empty.
-// All interface implementations are in concrete adapter classes.
+std::expected<size_t, network_error>
+mllp_session::receive_into(std::span<uint8_t> buffer,
+                           std::chrono::milliseconds timeout) {
+    auto result = receive(buffer.size(), timeout);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+    const size_t count = std::min(result->size(), buffer.size());
+    std::copy_n(result->begin(), count, buffer.begin());
+    return count;
+}
+
+bool mllp_session::start_async_receive(receive_callback /*on_data*/,
+                                       close_callback /*on_close*/,
+                                       std::chrono::milliseconds /*idle_timeout*/) {
+    return false;
+}
 
 }  // namespace pacs::bridge::mllp
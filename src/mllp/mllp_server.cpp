@@ -15,12 +15,17 @@
 
 #include "pacs/bridge/mllp/mllp_server.h"
 
+#include "pacs/bridge/mllp/mllp_frame_scanner.h"
 #include "pacs/bridge/mllp/mllp_network_adapter.h"
 #include "pacs/bridge/monitoring/bridge_metrics.h"
+#include "pacs/bridge/performance/object_pool.h"
+#include "pacs/bridge/performance/thread_pool_manager.h"
 #include "pacs/bridge/tracing/trace_manager.h"
 
 // Include network adapters
 #include "bsd_mllp_server.h"
+#include "epoll_mllp_server.h"
+#include "io_uring_mllp_server.h"
 
 #ifdef PACS_BRIDGE_HAS_OPENSSL
 #include "tls_mllp_server.h"
@@ -33,6 +38,7 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <deque>
 #include <future>
 #include <mutex>
 #include <shared_mutex>
@@ -80,25 +86,30 @@ private:
 /**
  * @brief Wrapper for mllp_session with additional MLLP-specific state
  *
- * Manages the receive buffer and per-session statistics for MLLP processing.
+ * Manages the framing state and per-session statistics for MLLP processing.
  * The underlying network I/O is delegated to mllp_session.
  */
 struct session_wrapper {
     uint64_t id = 0;
     std::unique_ptr<mllp_session> session;
 
-    // Receive buffer for partial message accumulation
-    std::vector<uint8_t> receive_buffer;
-    static constexpr size_t INITIAL_BUFFER_SIZE = 4096;
+    // Framing state carried across reads for partial messages
+    mllp_frame_scanner framer;
+
+    // Event-loop model: frames awaiting the handler, dispatched in order by
+    // at most one worker at a time
+    std::mutex dispatch_mutex;
+    std::deque<std::vector<uint8_t>> pending_frames;
+    bool dispatch_scheduled = false;
 
     // Per-session MLLP statistics
     std::atomic<size_t> messages_received{0};
     std::atomic<size_t> messages_sent{0};
 
-    explicit session_wrapper(std::unique_ptr<mllp_session> sess)
-        : id(sess ? sess->session_id() : 0), session(std::move(sess)) {
-        receive_buffer.reserve(INITIAL_BUFFER_SIZE);
-    }
+    session_wrapper(std::unique_ptr<mllp_session> sess, size_t max_message_size)
+        : id(sess ? sess->session_id() : 0),
+          session(std::move(sess)),
+          framer(max_message_size) {}
 
     [[nodiscard]] mllp_session_info to_session_info() const {
         mllp_session_info info;
@@ -129,7 +140,8 @@ struct session_wrapper {
  */
 class mllp_server::impl {
 public:
-    explicit impl(const mllp_server_config& config) : config_(config) {}
+    explicit impl(const mllp_server_config& config)
+        : config_(config), read_buffers_(read_buffer_pool_config()) {}
 
     ~impl() { stop_internal(true, std::chrono::seconds{5}); }
 
@@ -157,6 +169,14 @@ public:
             return result;
         }
 
+        // Event-loop adapters hand completed frames to a bounded worker pool
+        if (event_loop_) {
+            if (auto result = start_workers(); !result) {
+                server_adapter_.reset();
+                return result;
+            }
+        }
+
         // Set connection callback
         server_adapter_->on_connection(
             [this](std::unique_ptr<mllp_session> session) {
@@ -167,6 +187,7 @@ public:
         auto start_result = server_adapter_->start();
         if (!start_result) {
             server_adapter_.reset();
+            stop_workers();
             return std::unexpected(mllp_error::socket_error);
         }
 
@@ -193,6 +214,9 @@ public:
             server_adapter_->stop(wait_for_connections);
         }
 
+        // No further frames can arrive; finish or drop queued dispatches
+        stop_workers();
+
         // Close all sessions to unblock any poll() calls.
         // This causes session threads to exit their receive loop.
         close_all_sessions_internal(false);
@@ -349,6 +373,44 @@ private:
         adapter_config.no_delay = true;
         adapter_config.reuse_addr = true;
 
+        event_loop_ = false;
+        if (config_.io_model == mllp_io_model::io_uring) {
+            if (config_.tls.enabled) {
+                // Completion loop has no TLS session support
+                return std::unexpected(mllp_error::invalid_configuration);
+            }
+#ifdef PACS_BRIDGE_HAS_IO_URING
+            if (io_uring_ring::supported()) {
+                server_adapter_ =
+                    std::make_unique<io_uring_mllp_server>(adapter_config);
+                event_loop_ = true;
+                return {};
+            }
+#endif
+            // Kernel without io_uring: fall back to the epoll event loop
+        }
+
+        if (config_.io_model == mllp_io_model::event_loop ||
+            config_.io_model == mllp_io_model::io_uring ||
+            (config_.io_model == mllp_io_model::automatic &&
+             !config_.tls.enabled)) {
+#ifdef PACS_BRIDGE_HAS_EPOLL
+            if (config_.tls.enabled) {
+                // Event loop has no TLS session support
+                return std::unexpected(mllp_error::invalid_configuration);
+            }
+            server_adapter_ = std::make_unique<epoll_mllp_server>(
+                adapter_config, config_.reactor_threads);
+            event_loop_ = true;
+            return {};
+#else
+            if (config_.io_model == mllp_io_model::event_loop ||
+                config_.io_model == mllp_io_model::io_uring) {
+                return std::unexpected(mllp_error::invalid_configuration);
+            }
+#endif
+        }
+
         if (config_.tls.enabled) {
 #ifdef PACS_BRIDGE_HAS_OPENSSL
             server_adapter_ = std::make_unique<tls_mllp_server>(
@@ -370,6 +432,32 @@ private:
         return {};
     }
 
+    // =========================================================================
+    // Worker Pool (event-loop model)
+    // =========================================================================
+
+    [[nodiscard]] std::expected<void, mllp_error> start_workers() {
+        performance::thread_pool_config pool_config;
+        pool_config.min_threads = config_.worker_threads;
+        pool_config.max_threads = config_.worker_threads;
+        pool_config.queue_capacity = config_.max_pending_messages;
+        pool_config.thread_name_prefix = "mllp_worker";
+
+        workers_ = std::make_unique<performance::thread_pool_manager>(pool_config);
+        if (!workers_->start()) {
+            workers_.reset();
+            return std::unexpected(mllp_error::invalid_configuration);
+        }
+        return {};
+    }
+
+    void stop_workers() {
+        if (workers_) {
+            (void)workers_->stop(true, std::chrono::seconds{5});
+            workers_.reset();
+        }
+    }
+
     // =========================================================================
     // Connection Handling
     // =========================================================================
@@ -394,7 +482,8 @@ private:
         increment_stat(&stats_.total_connections);
 
         // Create session wrapper
-        auto wrapper = std::make_unique<session_wrapper>(std::move(session));
+        auto wrapper = std::make_shared<session_wrapper>(
+            std::move(session), config_.max_message_size);
         uint64_t session_id = wrapper->id;
 
         // Notify connection handler
@@ -403,7 +492,7 @@ private:
         // Store session
         {
             std::unique_lock lock(sessions_mutex_);
-            sessions_[session_id] = std::move(wrapper);
+            sessions_[session_id] = wrapper;
 
             // Update metrics
             auto& metrics = monitoring::bridge_metrics_collector::instance();
@@ -411,6 +500,11 @@ private:
             metrics.set_mllp_active_connections(sessions_.size());
         }
 
+        // Event loop: the reactor pushes data, no per-session thread
+        if (event_loop_ && start_async_session(wrapper)) {
+            return;
+        }
+
         // Start session handler
 #ifndef PACS_BRIDGE_STANDALONE_BUILD
         if (config_.executor) {
@@ -442,11 +536,35 @@ private:
     // Session Handling
     // =========================================================================
 
+    /**
+     * @brief Pool for per-session read buffers
+     *
+     * Buffers are created on first use and returned when a session ends, so
+     * they are reused across connections without preallocating.
+     */
+    static performance::memory_config read_buffer_pool_config() {
+        performance::memory_config config;
+        config.default_buffer_size = READ_BUFFER_SIZE;
+        config.message_buffer_pool_size = 0;
+        config.max_memory_bytes = 0;
+        return config;
+    }
+
     void handle_session(uint64_t session_id) {
-        constexpr size_t READ_BUFFER_SIZE = 8192;
         auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
             config_.idle_timeout);
 
+        // Reused for every read on this session
+        auto handle = read_buffers_.acquire(READ_BUFFER_SIZE);
+        if (!handle) {
+            increment_stat(&stats_.connection_errors);
+            close_session(session_id, true);
+            return;
+        }
+        performance::scoped_buffer read_buffer(read_buffers_, *handle);
+        const std::span<uint8_t> read_span(read_buffer.data(),
+                                           read_buffer.capacity());
+
         while (!stop_requested_) {
             // Get session wrapper
             session_wrapper* wrapper_ptr = nullptr;
@@ -466,7 +584,7 @@ private:
 
             // Read data from session
             auto read_result =
-                wrapper_ptr->session->receive(READ_BUFFER_SIZE, timeout);
+                wrapper_ptr->session->receive_into(read_span, timeout);
 
             if (!read_result) {
                 auto error = read_result.error();
@@ -485,116 +603,194 @@ private:
                 break;
             }
 
-            const auto& data = read_result.value();
-            if (data.empty()) {
+            const size_t bytes_read = read_result.value();
+            if (bytes_read == 0) {
                 continue;
             }
 
             // Update statistics
-            add_stat(&stats_.bytes_received, data.size());
-
-            // Append to receive buffer
-            wrapper_ptr->receive_buffer.insert(wrapper_ptr->receive_buffer.end(),
-                                               data.begin(), data.end());
+            add_stat(&stats_.bytes_received, bytes_read);
 
-            // Check buffer size limit
-            if (wrapper_ptr->receive_buffer.size() > config_.max_message_size) {
+            // Process complete MLLP messages
+            if (!process_messages(wrapper_ptr, read_span.first(bytes_read))) {
                 increment_stat(&stats_.protocol_errors);
                 notify_error(mllp_error::message_too_large,
                              wrapper_ptr->to_session_info(),
                              "Message exceeds maximum size");
                 break;
             }
-
-            // Process complete MLLP messages
-            process_messages(wrapper_ptr);
         }
 
         // Close session
         close_session(session_id, true);
     }
 
-    void process_messages(session_wrapper* wrapper) {
-        auto& buffer = wrapper->receive_buffer;
-
-        while (true) {
-            // Find start of message (VT byte)
-            auto start_it =
-                std::find(buffer.begin(), buffer.end(),
-                          static_cast<uint8_t>(MLLP_START_BYTE));
-            if (start_it == buffer.end()) {
-                // No start marker found, clear any garbage data
-                buffer.clear();
+    /**
+     * @brief Feed received bytes to the session framer and dispatch frames
+     * @return false if a frame exceeded the maximum message size
+     */
+    bool process_messages(session_wrapper* wrapper,
+                          std::span<const uint8_t> input) {
+        while (!input.empty()) {
+            auto frame = wrapper->framer.next_frame(input);
+            if (!frame) {
+                return false;
+            }
+            if (!*frame) {
+                // No complete message yet
                 break;
             }
 
-            // Remove any data before start marker
-            if (start_it != buffer.begin()) {
-                buffer.erase(buffer.begin(), start_it);
-            }
+            // Reuse the content buffer for the next frame on this session
+            wrapper->framer.recycle(dispatch_message(wrapper, std::move(**frame)));
+        }
+        return true;
+    }
 
-            // Find end of message (FS + CR)
-            auto end_it = buffer.end();
-            for (auto it = buffer.begin() + 1; it < buffer.end() - 1; ++it) {
-                if (*it == static_cast<uint8_t>(MLLP_END_BYTE) &&
-                    *(it + 1) == static_cast<uint8_t>(MLLP_CARRIAGE_RETURN)) {
-                    end_it = it;
-                    break;
+    // =========================================================================
+    // Event-Loop Session Handling
+    // =========================================================================
+
+    /**
+     * @brief Switch a session to push-mode receive on its reactor
+     * @return false if the adapter cannot deliver data asynchronously
+     */
+    bool start_async_session(const std::shared_ptr<session_wrapper>& wrapper) {
+        const uint64_t session_id = wrapper->id;
+        std::weak_ptr<session_wrapper> weak = wrapper;
+
+        return wrapper->session->start_async_receive(
+            [this, weak](std::span<const uint8_t> data) {
+                if (auto locked = weak.lock()) {
+                    on_session_data(locked, data);
                 }
-            }
+            },
+            [this, session_id](network_error reason) {
+                if (reason != network_error::connection_closed &&
+                    reason != network_error::timeout) {
+                    increment_stat(&stats_.connection_errors);
+                }
+                close_session(session_id, true);
+            },
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                config_.idle_timeout));
+    }
 
-            if (end_it == buffer.end()) {
-                // No complete message yet
+    /**
+     * @brief Frame bytes delivered by the reactor and queue complete messages
+     */
+    void on_session_data(const std::shared_ptr<session_wrapper>& wrapper,
+                         std::span<const uint8_t> input) {
+        add_stat(&stats_.bytes_received, input.size());
+
+        while (!input.empty()) {
+            auto frame = wrapper->framer.next_frame(input);
+            if (!frame) {
+                increment_stat(&stats_.protocol_errors);
+                notify_error(mllp_error::message_too_large,
+                             wrapper->to_session_info(),
+                             "Message exceeds maximum size");
+                // The reactor reports the hang-up and removes the session
+                wrapper->session->close();
+                return;
+            }
+            if (!*frame) {
                 break;
             }
+            enqueue_frame(wrapper, std::move(**frame));
+        }
+    }
 
-            // Start tracing span for message receive
-            auto span = tracing::trace_manager::instance().start_span(
-                "mllp_receive", tracing::span_kind::server);
-            span.set_attribute("mllp.port", static_cast<int64_t>(config_.port))
-                .set_attribute("mllp.remote_address",
-                               wrapper->session->remote_address())
-                .set_attribute("mllp.remote_port",
-                               static_cast<int64_t>(wrapper->session->remote_port()))
-                .set_attribute("mllp.session_id",
-                               static_cast<int64_t>(wrapper->id));
-
-            // Extract message content (between VT and FS)
-            mllp_message msg;
-            msg.content.assign(buffer.begin() + 1, end_it);
-            msg.session = wrapper->to_session_info();
-            msg.received_at = std::chrono::system_clock::now();
-
-            // Add message size to span
-            span.set_attribute("mllp.message_size",
-                               static_cast<int64_t>(msg.content.size()));
-
-            // Remove processed message from buffer (including CR)
-            buffer.erase(buffer.begin(), end_it + 2);
+    void enqueue_frame(const std::shared_ptr<session_wrapper>& wrapper,
+                       std::vector<uint8_t> content) {
+        {
+            std::lock_guard lock(wrapper->dispatch_mutex);
+            wrapper->pending_frames.push_back(std::move(content));
+            if (wrapper->dispatch_scheduled) {
+                // The scheduled drain will pick it up in order
+                return;
+            }
+            wrapper->dispatch_scheduled = true;
+        }
 
-            // Update statistics
-            wrapper->messages_received++;
-            increment_stat(&stats_.messages_received);
+        if (!workers_ ||
+            !workers_->try_post([this, wrapper] { drain_session(wrapper); })) {
+            // Worker queue full: run the handler on the reactor thread, which
+            // stops it reading further input until the backlog clears
+            drain_session(wrapper);
+        }
+    }
 
-            // Call message handler
-            std::optional<mllp_message> response;
+    void drain_session(const std::shared_ptr<session_wrapper>& wrapper) {
+        while (true) {
+            std::vector<uint8_t> content;
             {
-                std::shared_lock lock(handlers_mutex_);
-                if (message_handler_) {
-                    response = message_handler_(msg, *msg.session);
+                std::lock_guard lock(wrapper->dispatch_mutex);
+                if (wrapper->pending_frames.empty()) {
+                    wrapper->dispatch_scheduled = false;
+                    return;
                 }
+                content = std::move(wrapper->pending_frames.front());
+                wrapper->pending_frames.pop_front();
             }
+            (void)dispatch_message(wrapper.get(), std::move(content));
+        }
+    }
+
+    // =========================================================================
+    // Message Dispatch
+    // =========================================================================
+
+    /**
+     * @brief Run the message handler on one frame and send its response
+     * @return The content buffer, for reuse by the caller
+     */
+    std::vector<uint8_t> dispatch_message(session_wrapper* wrapper,
+                                          std::vector<uint8_t> content) {
+        // Start tracing span for message receive
+        auto span = tracing::trace_manager::instance().start_span(
+            "mllp_receive", tracing::span_kind::server);
+        span.set_attribute("mllp.port", static_cast<int64_t>(config_.port))
+            .set_attribute("mllp.remote_address",
+                           wrapper->session->remote_address())
+            .set_attribute("mllp.remote_port",
+                           static_cast<int64_t>(wrapper->session->remote_port()))
+            .set_attribute("mllp.session_id",
+                           static_cast<int64_t>(wrapper->id));
+
+        // Take ownership of the framed content (between VT and FS)
+        mllp_message msg;
+        msg.content = std::move(content);
+        msg.session = wrapper->to_session_info();
+        msg.received_at = std::chrono::system_clock::now();
+
+        // Add message size to span
+        span.set_attribute("mllp.message_size",
+                           static_cast<int64_t>(msg.content.size()));
+
+        // Update statistics
+        wrapper->messages_received++;
+        increment_stat(&stats_.messages_received);
 
-            // Send response if provided
-            if (response) {
-                send_response(wrapper, *response);
-                span.set_attribute("mllp.response_sent", true);
-            } else {
-                span.set_attribute("mllp.response_sent", false);
+        // Call message handler
+        std::optional<mllp_message> response;
+        {
+            std::shared_lock lock(handlers_mutex_);
+            if (message_handler_) {
+                response = message_handler_(msg, *msg.session);
             }
+        }
 
-            // Span ends automatically via RAII
+        // Send response if provided
+        if (response) {
+            send_response(wrapper, *response);
+            span.set_attribute("mllp.response_sent", true);
+        } else {
+            span.set_attribute("mllp.response_sent", false);
         }
+
+        // Span ends automatically via RAII
+        return std::move(msg.content);
     }
 
     void send_response(session_wrapper* wrapper, const mllp_message& response) {
@@ -650,11 +846,20 @@ private:
     // Member Variables
     // =========================================================================
 
+    static constexpr size_t READ_BUFFER_SIZE = 8192;
+
     mllp_server_config config_;
 
-    // Network adapter (BSD or TLS)
+    // Per-session read buffers
+    performance::message_buffer_pool read_buffers_;
+
+    // Network adapter (BSD, TLS, epoll or io_uring)
     std::unique_ptr<mllp_server_adapter> server_adapter_;
 
+    // Event-loop model: adapter pushes data, workers run the handler
+    bool event_loop_ = false;
+    std::unique_ptr<performance::thread_pool_manager> workers_;
+
     // State management
     mutable std::shared_mutex state_mutex_;
     bool running_ = false;
@@ -671,7 +876,7 @@ private:
 
     // Sessions
     mutable std::shared_mutex sessions_mutex_;
-    std::unordered_map<uint64_t, std::unique_ptr<session_wrapper>> sessions_;
+    std::unordered_map<uint64_t, std::shared_ptr<session_wrapper>> sessions_;
 
     // Handlers
     mutable std::shared_mutex handlers_mutex_;
@@ -79,6 +79,18 @@ network_system_session::~network_system_session() {
 std::expected<std::vector<uint8_t>, network_error>
 network_system_session::receive(size_t max_bytes,
                                 std::chrono::milliseconds timeout) {
+    std::vector<uint8_t> buffer(max_bytes);
+    auto result = receive_into(buffer, timeout);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+    buffer.resize(result.value());
+    return buffer;
+}
+
+std::expected<size_t, network_error>
+network_system_session::receive_into(std::span<uint8_t> buffer,
+                                     std::chrono::milliseconds timeout) {
     std::unique_lock lock(buffer_mutex_);
 
     auto deadline = std::chrono::steady_clock::now() + timeout;
@@ -101,11 +113,9 @@ network_system_session::receive(size_t max_bytes,
         return std::unexpected(network_error::connection_closed);
     }
 
-    // Extract up to max_bytes from the buffer
-    size_t to_read = std::min(max_bytes, receive_buffer_.size());
-    std::vector<uint8_t> result(
-        receive_buffer_.begin(),
-        receive_buffer_.begin() + static_cast<ptrdiff_t>(to_read));
+    // Extract up to buffer.size() bytes from the buffer
+    size_t to_read = std::min(buffer.size(), receive_buffer_.size());
+    std::copy_n(receive_buffer_.begin(), to_read, buffer.begin());
     receive_buffer_.erase(
         receive_buffer_.begin(),
         receive_buffer_.begin() + static_cast<ptrdiff_t>(to_read));
@@ -118,7 +128,7 @@ network_system_session::receive(size_t max_bytes,
         stats_.last_activity = std::chrono::system_clock::now();
     }
 
-    return result;
+    return to_read;
 }
 
 std::expected<size_t, network_error>
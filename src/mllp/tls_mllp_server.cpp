@@ -182,6 +182,18 @@ tls_mllp_session::perform_handshake(std::chrono::milliseconds timeout) {
 
 std::expected<std::vector<uint8_t>, network_error>
 tls_mllp_session::receive(size_t max_bytes, std::chrono::milliseconds timeout) {
+    std::vector<uint8_t> buffer(max_bytes);
+    auto result = receive_into(buffer, timeout);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+    buffer.resize(result.value());
+    return buffer;
+}
+
+std::expected<size_t, network_error>
+tls_mllp_session::receive_into(std::span<uint8_t> buffer,
+                               std::chrono::milliseconds timeout) {
     if (!is_open_) {
         return std::unexpected(network_error::connection_closed);
     }
@@ -192,12 +204,11 @@ tls_mllp_session::receive(size_t max_bytes, std::chrono::milliseconds timeout) {
         }
     }
 
-    std::vector<uint8_t> buffer(max_bytes);
     auto deadline = std::chrono::steady_clock::now() + timeout;
 
     while (true) {
         int bytes_received = SSL_read(ssl_, buffer.data(),
-                                      static_cast<int>(max_bytes));
+                                      static_cast<int>(buffer.size()));
 
         if (bytes_received > 0) {
             // Success
@@ -206,8 +217,7 @@ tls_mllp_session::receive(size_t max_bytes, std::chrono::milliseconds timeout) {
             stats_.messages_received++;
             stats_.last_activity = std::chrono::system_clock::now();
 
-            buffer.resize(static_cast<size_t>(bytes_received));
-            return buffer;
+            return static_cast<size_t>(bytes_received);
         }
 
         int ssl_error = SSL_get_error(ssl_, bytes_received);
@@ -27,6 +27,7 @@
  *
  * Exported Classes:
  * - Core types: hl7_subcomponent, hl7_component, hl7_field, hl7_segment, hl7_message
+ * - Flat model: hl7_flat_message, hl7_segment_view, hl7_field_view, hl7_component_view
  * - Parser: hl7_parser, hl7_streaming_parser
  * - Builder: hl7_builder, adt_builder, orm_builder, oru_builder
  * - Validator: hl7_validator
@@ -72,6 +73,10 @@ class hl7_component;
 class hl7_field;
 class hl7_segment;
 class hl7_message;
+class hl7_component_view;
+class hl7_field_view;
+class hl7_segment_view;
+class hl7_flat_message;
 
 } // namespace pacs::bridge::hl7
 
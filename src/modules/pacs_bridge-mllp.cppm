@@ -65,6 +65,7 @@ constexpr int DEFAULT_TIMEOUT_MS = 30000;
 
 export namespace pacs::bridge::mllp {
 
+class mllp_frame_scanner;
 class mllp_server;
 
 } // namespace pacs::bridge::mllp
@@ -7,10 +7,13 @@
 
 #include "pacs/bridge/monitoring/bridge_metrics.h"
 
+#include "pacs/bridge/internal/log_linear_histogram.h"
+#include "pacs/bridge/internal/sharded_counter.h"
+
 #include <algorithm>
+#include <array>
 #include <chrono>
-#include <iomanip>
-#include <sstream>
+#include <string_view>
 
 #if defined(__APPLE__) || defined(__linux__)
 #include <fcntl.h>
@@ -32,64 +35,246 @@ namespace pacs::bridge::monitoring {
 // Internal Metric Storage
 // ═══════════════════════════════════════════════════════════════════════════
 
-struct bridge_metrics_collector::metrics_data {
-    // HL7 Message Counters (by message_type)
-    std::unordered_map<std::string, std::atomic<uint64_t>> hl7_messages_received;
-    std::unordered_map<std::string, std::atomic<uint64_t>> hl7_messages_sent;
-    std::unordered_map<std::string, std::atomic<uint64_t>> hl7_errors;
-
-    // HL7 Processing Duration Histogram (by message_type)
-    // We store raw durations for histogram calculation
-    struct histogram_data {
-        std::vector<std::chrono::nanoseconds> samples;
-        std::mutex mutex;
-        static constexpr size_t max_samples = 10000;
-
-        void add_sample(std::chrono::nanoseconds duration) {
-            std::lock_guard<std::mutex> lock(mutex);
-            if (samples.size() >= max_samples) {
-                // Ring buffer behavior: remove oldest
-                samples.erase(samples.begin());
-            }
-            samples.push_back(duration);
+namespace {
+
+using internal::log_linear_histogram;
+using internal::sharded_counter;
+
+/** Label sets one family can hold, whatever the global limit */
+constexpr size_t max_label_sets = 512;
+
+/**
+ * @brief Label sets registered across all families, against the limit
+ */
+struct cardinality_registry {
+    std::atomic<size_t> count{0};
+    std::atomic<size_t> limit{default_cardinality_limit};
+
+    bool try_acquire() noexcept {
+        if (count.fetch_add(1, std::memory_order_relaxed) <
+            limit.load(std::memory_order_relaxed)) {
+            return true;
+        }
+        count.fetch_sub(1, std::memory_order_relaxed);
+        return false;
+    }
+};
+
+/** Message types registered up front so their cells exist before traffic */
+constexpr std::array<std::string_view, 12> common_message_types = {
+    "ADT", "ORM", "ORU", "SIU", "MDM", "DFT",
+    "BAR", "ACK", "ADT_ACK", "ORM_ACK", "ORU_ACK", "SIU_ACK"};
+
+std::string escape_label_value(std::string_view value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (char c : value) {
+        switch (c) {
+            case '\\': escaped += "\\\\"; break;
+            case '"': escaped += "\\\""; break;
+            case '\n': escaped += "\\n"; break;
+            default: escaped += c; break;
+        }
+    }
+    return escaped;
+}
+
+/**
+ * @brief Cells of one metric, keyed by label values
+ *
+ * An insert-only open-addressing table: lookups of existing label sets are
+ * a hash and a few acquire loads, with no lock; only the first use of a
+ * label set takes the mutex to allocate its cell. Cells never move, so a
+ * returned reference stays valid for the life of the family.
+ *
+ * When the family is full or the registry refuses a new label set, the
+ * family creates one "other" cell; from then on unseen label values go
+ * straight to it without taking the mutex, so a sender cycling through
+ * random values costs a failed lookup, not a lock.
+ */
+template <typename Cell, size_t Arity>
+class metric_family {
+public:
+    using values_type = std::array<std::string_view, Arity>;
+
+    metric_family(cardinality_registry& registry,
+                  std::array<std::string_view, Arity> names)
+        : registry_(registry), names_(names) {}
+
+    Cell& get(const values_type& values) {
+        size_t hash = hash_of(values);
+        if (entry* found = find(values, hash)) {
+            return found->cell;
+        }
+        if (entry* other = overflow_.load(std::memory_order_acquire)) {
+            return other->cell;
         }
+        return insert(values, hash).cell;
+    }
 
-        std::vector<std::chrono::nanoseconds> get_samples() const {
-            std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(mutex));
-            return samples;
+    /** Visit (rendered labels, cell) in first-use order */
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& e : entries_) {
+            fn(e->labels, e->cell);
+        }
+        if (const entry* other = overflow_.load(std::memory_order_acquire)) {
+            fn(other->labels, other->cell);
         }
+    }
+
+private:
+    static constexpr size_t slot_count = 2 * max_label_sets;
+    static_assert((slot_count & (slot_count - 1)) == 0);
+
+    struct entry {
+        size_t hash = 0;
+        std::string key;     // Label values joined by '\0'
+        std::string labels;  // name="value",... ready for exposition
+        Cell cell;
     };
 
-    std::unordered_map<std::string, histogram_data> hl7_processing_duration;
-    std::mutex hl7_duration_mutex;
+    static size_t hash_of(const values_type& values) noexcept {
+        size_t hash = 0;
+        for (auto value : values) {
+            hash = hash * 31 + std::hash<std::string_view>{}(value);
+        }
+        return hash;
+    }
+
+    static bool matches(const entry& e, const values_type& values) noexcept {
+        std::string_view key = e.key;
+        for (size_t i = 0; i < Arity; ++i) {
+            if (key.substr(0, values[i].size()) != values[i]) {
+                return false;
+            }
+            key.remove_prefix(values[i].size());
+            if (i + 1 < Arity) {
+                if (key.empty() || key.front() != '\0') {
+                    return false;
+                }
+                key.remove_prefix(1);
+            }
+        }
+        return key.empty();
+    }
+
+    entry* find(const values_type& values, size_t hash) const noexcept {
+        for (size_t i = hash & (slot_count - 1);; i = (i + 1) & (slot_count - 1)) {
+            entry* e = slots_[i].load(std::memory_order_acquire);
+            if (!e) {
+                return nullptr;
+            }
+            if (e->hash == hash && matches(*e, values)) {
+                return e;
+            }
+        }
+    }
+
+    std::string render(const values_type& values) const {
+        std::string labels;
+        for (size_t i = 0; i < Arity; ++i) {
+            if (i > 0) labels += ',';
+            labels += names_[i];
+            labels += "=\"";
+            labels += escape_label_value(values[i]);
+            labels += '"';
+        }
+        return labels;
+    }
+
+    entry& insert(const values_type& values, size_t hash) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (entry* found = find(values, hash)) {
+            return *found;
+        }
+        if (entry* other = overflow_.load(std::memory_order_relaxed)) {
+            return *other;
+        }
+        if (entries_.size() >= max_label_sets || !registry_.try_acquire()) {
+            overflow_storage_ = std::make_unique<entry>();
+            values_type other;
+            other.fill("other");
+            overflow_storage_->labels = render(other);
+            overflow_.store(overflow_storage_.get(), std::memory_order_release);
+            return *overflow_storage_;
+        }
+
+        auto e = std::make_unique<entry>();
+        e->hash = hash;
+        for (size_t i = 0; i < Arity; ++i) {
+            if (i > 0) e->key += '\0';
+            e->key += values[i];
+        }
+        e->labels = render(values);
+
+        size_t i = hash & (slot_count - 1);
+        while (slots_[i].load(std::memory_order_relaxed)) {
+            i = (i + 1) & (slot_count - 1);
+        }
+        slots_[i].store(e.get(), std::memory_order_release);
+        entries_.push_back(std::move(e));
+        return *entries_.back();
+    }
+
+    cardinality_registry& registry_;
+    std::array<std::string_view, Arity> names_;
+    std::array<std::atomic<entry*>, slot_count> slots_{};
+    std::vector<std::unique_ptr<entry>> entries_;
+    std::atomic<entry*> overflow_{nullptr};
+    std::unique_ptr<entry> overflow_storage_;
+    mutable std::mutex mutex_;
+};
+
+using counter_family = metric_family<sharded_counter, 1>;
+using counter_family2 = metric_family<sharded_counter, 2>;
+using gauge_family = metric_family<std::atomic<size_t>, 1>;
+using histogram_family = metric_family<log_linear_histogram, 1>;
+
+}  // namespace
+
+struct bridge_metrics_collector::metrics_data {
+    cardinality_registry registry;
+
+    // HL7 Message Counters (by message_type)
+    counter_family hl7_messages_received{registry, {"message_type"}};
+    counter_family hl7_messages_sent{registry, {"message_type"}};
+    counter_family2 hl7_errors{registry, {"message_type", "error_type"}};
+
+    // HL7 Processing Duration Histogram (by message_type), in nanoseconds
+    histogram_family hl7_processing_duration{registry, {"message_type"}};
 
     // MWL Counters
-    std::atomic<uint64_t> mwl_entries_created{0};
-    std::atomic<uint64_t> mwl_entries_updated{0};
-    std::atomic<uint64_t> mwl_entries_cancelled{0};
-    histogram_data mwl_query_duration;
+    sharded_counter mwl_entries_created;
+    sharded_counter mwl_entries_updated;
+    sharded_counter mwl_entries_cancelled;
+    log_linear_histogram mwl_query_duration;
 
     // Queue Metrics (by destination)
-    std::unordered_map<std::string, std::atomic<size_t>> queue_depth;
-    std::unordered_map<std::string, std::atomic<uint64_t>> messages_enqueued;
-    std::unordered_map<std::string, std::atomic<uint64_t>> messages_delivered;
-    std::unordered_map<std::string, std::atomic<uint64_t>> delivery_failures;
-    std::unordered_map<std::string, std::atomic<uint64_t>> dead_letters;
-    std::mutex queue_mutex;
+    gauge_family queue_depth{registry, {"destination"}};
+    counter_family messages_enqueued{registry, {"destination"}};
+    counter_family messages_delivered{registry, {"destination"}};
+    counter_family delivery_failures{registry, {"destination"}};
+    counter_family dead_letters{registry, {"destination"}};
 
     // Connection Metrics
     std::atomic<size_t> mllp_active_connections{0};
-    std::atomic<uint64_t> mllp_total_connections{0};
+    sharded_counter mllp_total_connections;
     std::atomic<size_t> fhir_active_requests{0};
-    std::unordered_map<std::string, std::atomic<uint64_t>> fhir_requests;
-    std::mutex fhir_mutex;
+    counter_family2 fhir_requests{registry, {"method", "resource"}};
 
     // System Metrics
     std::atomic<double> process_cpu_seconds{0.0};
     std::atomic<size_t> process_memory_bytes{0};
     std::atomic<size_t> process_open_fds{0};
 
-    metrics_data() = default;
+    metrics_data() {
+        for (auto type : common_message_types) {
+            (void)hl7_messages_received.get({type});
+            (void)hl7_messages_sent.get({type});
+        }
+    }
 };
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -176,49 +361,43 @@ void bridge_metrics_collector::shutdown() {
 // ═══════════════════════════════════════════════════════════════════════════
 
 void bridge_metrics_collector::record_hl7_message_received(
-    const std::string& message_type) {
+    std::string_view message_type) {
     if (!enabled_.load())
         return;
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    data_->hl7_messages_received[message_type]++;
+    data_->hl7_messages_received.get({message_type}).increment();
 }
 
 void bridge_metrics_collector::record_hl7_message_sent(
-    const std::string& message_type) {
+    std::string_view message_type) {
     if (!enabled_.load())
         return;
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    data_->hl7_messages_sent[message_type]++;
+    data_->hl7_messages_sent.get({message_type}).increment();
 }
 
 void bridge_metrics_collector::record_hl7_processing_duration(
-    const std::string& message_type, std::chrono::nanoseconds duration) {
+    std::string_view message_type, std::chrono::nanoseconds duration) {
     if (!enabled_.load())
         return;
 
-    {
-        std::lock_guard<std::mutex> lock(data_->hl7_duration_mutex);
-        data_->hl7_processing_duration[message_type].add_sample(duration);
-    }
+    data_->hl7_processing_duration.get({message_type})
+        .record(static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0)));
 
 #ifdef PACS_BRIDGE_HAS_MONITORING_SYSTEM
     // Also record in performance_monitor for advanced analysis
-    std::string operation_name = "hl7_processing_" + message_type;
+    std::string operation_name = "hl7_processing_" + std::string(message_type);
     performance_monitor_.get_profiler().record_sample(operation_name, duration,
                                                        true);
 #endif
 }
 
-void bridge_metrics_collector::record_hl7_error(const std::string& message_type,
-                                                const std::string& error_type) {
+void bridge_metrics_collector::record_hl7_error(std::string_view message_type,
+                                                std::string_view error_type) {
     if (!enabled_.load())
         return;
 
-    std::string key = message_type + ":" + error_type;
-    std::lock_guard<std::mutex> lock(mutex_);
-    data_->hl7_errors[key]++;
+    data_->hl7_errors.get({message_type, error_type}).increment();
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -228,19 +407,19 @@ void bridge_metrics_collector::record_hl7_error(const std::string& message_type,
 void bridge_metrics_collector::record_mwl_entry_created() {
     if (!enabled_.load())
         return;
-    data_->mwl_entries_created++;
+    data_->mwl_entries_created.increment();
 }
 
 void bridge_metrics_collector::record_mwl_entry_updated() {
     if (!enabled_.load())
         return;
-    data_->mwl_entries_updated++;
+    data_->mwl_entries_updated.increment();
 }
 
 void bridge_metrics_collector::record_mwl_entry_cancelled() {
     if (!enabled_.load())
         return;
-    data_->mwl_entries_cancelled++;
+    data_->mwl_entries_cancelled.increment();
 }
 
 void bridge_metrics_collector::record_mwl_query_duration(
@@ -248,7 +427,8 @@ void bridge_metrics_collector::record_mwl_query_duration(
     if (!enabled_.load())
         return;
 
-    data_->mwl_query_duration.add_sample(duration);
+    data_->mwl_query_duration.record(
+        static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0)));
 
 #ifdef PACS_BRIDGE_HAS_MONITORING_SYSTEM
     performance_monitor_.get_profiler().record_sample("mwl_query", duration,
@@ -260,49 +440,45 @@ void bridge_metrics_collector::record_mwl_query_duration(
 // Queue Metrics
 // ═══════════════════════════════════════════════════════════════════════════
 
-void bridge_metrics_collector::set_queue_depth(const std::string& destination,
+void bridge_metrics_collector::set_queue_depth(std::string_view destination,
                                                size_t depth) {
     if (!enabled_.load())
         return;
 
-    std::lock_guard<std::mutex> lock(data_->queue_mutex);
-    data_->queue_depth[destination].store(depth);
+    data_->queue_depth.get({destination})
+        .store(depth, std::memory_order_relaxed);
 }
 
 void bridge_metrics_collector::record_message_enqueued(
-    const std::string& destination) {
+    std::string_view destination) {
     if (!enabled_.load())
         return;
 
-    std::lock_guard<std::mutex> lock(data_->queue_mutex);
-    data_->messages_enqueued[destination]++;
+    data_->messages_enqueued.get({destination}).increment();
 }
 
 void bridge_metrics_collector::record_message_delivered(
-    const std::string& destination) {
+    std::string_view destination) {
     if (!enabled_.load())
         return;
 
-    std::lock_guard<std::mutex> lock(data_->queue_mutex);
-    data_->messages_delivered[destination]++;
+    data_->messages_delivered.get({destination}).increment();
 }
 
 void bridge_metrics_collector::record_delivery_failure(
-    const std::string& destination) {
+    std::string_view destination) {
     if (!enabled_.load())
         return;
 
-    std::lock_guard<std::mutex> lock(data_->queue_mutex);
-    data_->delivery_failures[destination]++;
+    data_->delivery_failures.get({destination}).increment();
 }
 
 void bridge_metrics_collector::record_dead_letter(
-    const std::string& destination) {
+    std::string_view destination) {
     if (!enabled_.load())
         return;
 
-    std::lock_guard<std::mutex> lock(data_->queue_mutex);
-    data_->dead_letters[destination]++;
+    data_->dead_letters.get({destination}).increment();
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -318,7 +494,7 @@ void bridge_metrics_collector::set_mllp_active_connections(size_t count) {
 void bridge_metrics_collector::record_mllp_connection() {
     if (!enabled_.load())
         return;
-    data_->mllp_total_connections++;
+    data_->mllp_total_connections.increment();
 }
 
 void bridge_metrics_collector::set_fhir_active_requests(size_t count) {
@@ -327,14 +503,68 @@ void bridge_metrics_collector::set_fhir_active_requests(size_t count) {
     data_->fhir_active_requests.store(count);
 }
 
-void bridge_metrics_collector::record_fhir_request(const std::string& method,
-                                                   const std::string& resource) {
+void bridge_metrics_collector::record_fhir_request(std::string_view method,
+                                                   std::string_view resource) {
     if (!enabled_.load())
         return;
 
-    std::string key = method + ":" + resource;
-    std::lock_guard<std::mutex> lock(data_->fhir_mutex);
-    data_->fhir_requests[key]++;
+    data_->fhir_requests.get({method, resource}).increment();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Metric Handles
+// ═══════════════════════════════════════════════════════════════════════════
+
+hl7_message_metrics bridge_metrics_collector::hl7_metrics(
+    std::string_view message_type) {
+    hl7_message_metrics handles;
+    handles.received = counter_handle(
+        &data_->hl7_messages_received.get({message_type}), &enabled_);
+    handles.sent =
+        counter_handle(&data_->hl7_messages_sent.get({message_type}), &enabled_);
+    handles.processing_duration = histogram_handle(
+        &data_->hl7_processing_duration.get({message_type}), &enabled_);
+    return handles;
+}
+
+counter_handle bridge_metrics_collector::hl7_error_counter(
+    std::string_view message_type, std::string_view error_type) {
+    return counter_handle(&data_->hl7_errors.get({message_type, error_type}),
+                          &enabled_);
+}
+
+destination_metrics bridge_metrics_collector::queue_metrics(
+    std::string_view destination) {
+    destination_metrics handles;
+    handles.depth =
+        gauge_handle(&data_->queue_depth.get({destination}), &enabled_);
+    handles.enqueued =
+        counter_handle(&data_->messages_enqueued.get({destination}), &enabled_);
+    handles.delivered =
+        counter_handle(&data_->messages_delivered.get({destination}), &enabled_);
+    handles.delivery_failures =
+        counter_handle(&data_->delivery_failures.get({destination}), &enabled_);
+    handles.dead_letters =
+        counter_handle(&data_->dead_letters.get({destination}), &enabled_);
+    return handles;
+}
+
+counter_handle bridge_metrics_collector::fhir_request_counter(
+    std::string_view method, std::string_view resource) {
+    return counter_handle(&data_->fhir_requests.get({method, resource}),
+                          &enabled_);
+}
+
+void bridge_metrics_collector::set_cardinality_limit(size_t limit) noexcept {
+    data_->registry.limit.store(limit, std::memory_order_relaxed);
+}
+
+size_t bridge_metrics_collector::cardinality_limit() const noexcept {
+    return data_->registry.limit.load(std::memory_order_relaxed);
+}
+
+size_t bridge_metrics_collector::label_set_count() const noexcept {
+    return data_->registry.count.load(std::memory_order_relaxed);
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -445,238 +675,183 @@ void bridge_metrics_collector::update_system_metrics() {
 
 namespace {
 
-void write_counter_metric(std::ostringstream& ss, const std::string& name,
-                          const std::string& help,
-                          const std::string& labels, uint64_t value) {
-    ss << "# HELP " << name << " " << help << "\n";
-    ss << "# TYPE " << name << " counter\n";
-    ss << name;
-    if (!labels.empty()) {
-        ss << "{" << labels << "}";
-    }
-    ss << " " << value << "\n";
+const std::vector<double> latency_bounds = default_latency_buckets();
+
+const metric_descriptor hl7_received_desc{
+    "hl7_messages_received_total", "Total HL7 messages received",
+    metric_type::counter};
+const metric_descriptor hl7_sent_desc{
+    "hl7_messages_sent_total", "Total HL7 messages sent", metric_type::counter};
+const metric_descriptor hl7_errors_desc{
+    "hl7_message_errors_total", "Total HL7 message errors",
+    metric_type::counter};
+const metric_descriptor hl7_duration_desc{
+    "hl7_message_processing_duration_seconds",
+    "HL7 message processing duration in seconds", metric_type::histogram};
+const metric_descriptor mwl_created_desc{
+    "mwl_entries_created_total", "Total MWL entries created",
+    metric_type::counter};
+const metric_descriptor mwl_updated_desc{
+    "mwl_entries_updated_total", "Total MWL entries updated",
+    metric_type::counter};
+const metric_descriptor mwl_cancelled_desc{
+    "mwl_entries_cancelled_total", "Total MWL entries cancelled",
+    metric_type::counter};
+const metric_descriptor mwl_duration_desc{
+    "mwl_query_duration_seconds", "MWL query duration in seconds",
+    metric_type::histogram};
+const metric_descriptor queue_depth_desc{
+    "queue_depth", "Current queue depth", metric_type::gauge};
+const metric_descriptor enqueued_desc{
+    "queue_messages_enqueued_total", "Total messages enqueued",
+    metric_type::counter};
+const metric_descriptor delivered_desc{
+    "queue_messages_delivered_total", "Total messages delivered",
+    metric_type::counter};
+const metric_descriptor failures_desc{
+    "queue_delivery_failures_total", "Total delivery failures",
+    metric_type::counter};
+const metric_descriptor dead_letters_desc{
+    "queue_dead_letters_total", "Total dead letters", metric_type::counter};
+const metric_descriptor mllp_active_desc{
+    "mllp_active_connections", "Current active MLLP connections",
+    metric_type::gauge};
+const metric_descriptor mllp_total_desc{
+    "mllp_total_connections", "Total MLLP connections", metric_type::counter};
+const metric_descriptor fhir_active_desc{
+    "fhir_active_requests", "Current active FHIR requests", metric_type::gauge};
+const metric_descriptor fhir_requests_desc{
+    "fhir_requests_total", "Total FHIR requests", metric_type::counter};
+const metric_descriptor label_sets_desc{
+    "metrics_label_sets", "Label sets registered across labeled metrics",
+    metric_type::gauge};
+const metric_descriptor cpu_desc{
+    "process_cpu_seconds_total", "Total CPU time in seconds",
+    metric_type::counter};
+const metric_descriptor memory_desc{
+    "process_resident_memory_bytes", "Resident memory size in bytes",
+    metric_type::gauge};
+const metric_descriptor fds_desc{
+    "process_open_fds", "Number of open file descriptors", metric_type::gauge};
+
+/** Write a family only if it has at least one label set */
+template <typename Family, typename WriteSample>
+void write_family(exposition_writer& writer, const metric_descriptor& descriptor,
+                  const Family& family, WriteSample&& write_sample) {
+    bool first = true;
+    family.for_each([&](const std::string& labels, const auto& cell) {
+        if (first) {
+            writer.family(descriptor);
+            first = false;
+        }
+        write_sample(labels, cell);
+    });
 }
 
-void write_gauge_metric(std::ostringstream& ss, const std::string& name,
-                        const std::string& help,
-                        const std::string& labels, double value) {
-    ss << "# HELP " << name << " " << help << "\n";
-    ss << "# TYPE " << name << " gauge\n";
-    ss << name;
-    if (!labels.empty()) {
-        ss << "{" << labels << "}";
-    }
-    ss << " " << std::fixed << std::setprecision(6) << value << "\n";
+template <typename Family>
+void write_counters(exposition_writer& writer,
+                    const metric_descriptor& descriptor, const Family& family) {
+    write_family(writer, descriptor, family,
+                 [&](const std::string& labels, const sharded_counter& count) {
+                     writer.counter(descriptor, labels, count.load());
+                 });
 }
 
-void write_histogram_metric(
-    std::ostringstream& ss, const std::string& name, const std::string& help,
-    const std::string& labels,
-    const std::vector<std::chrono::nanoseconds>& samples,
-    const std::vector<double>& buckets) {
-    if (samples.empty())
-        return;
-
-    ss << "# HELP " << name << " " << help << "\n";
-    ss << "# TYPE " << name << " histogram\n";
-
-    // Calculate bucket counts
-    std::vector<uint64_t> bucket_counts(buckets.size(), 0);
-    double sum = 0.0;
-
-    for (const auto& sample : samples) {
-        double seconds =
-            std::chrono::duration<double>(sample).count();
-        sum += seconds;
-
-        for (size_t i = 0; i < buckets.size(); i++) {
-            if (seconds <= buckets[i]) {
-                bucket_counts[i]++;
-            }
-        }
-    }
-
-    std::string base_labels = labels.empty() ? "" : labels + ",";
-
-    // Write bucket counts
-    uint64_t cumulative = 0;
-    for (size_t i = 0; i < buckets.size(); i++) {
-        cumulative += bucket_counts[i];
-        ss << name << "_bucket{" << base_labels << "le=\""
-           << std::fixed << std::setprecision(3) << buckets[i] << "\"} "
-           << cumulative << "\n";
-    }
-
-    // +Inf bucket
-    ss << name << "_bucket{" << base_labels << "le=\"+Inf\"} "
-       << samples.size() << "\n";
-
-    // Sum and count
-    ss << name << "_sum";
-    if (!labels.empty()) {
-        ss << "{" << labels << "}";
-    }
-    ss << " " << std::fixed << std::setprecision(6) << sum << "\n";
+void write_counter(exposition_writer& writer,
+                   const metric_descriptor& descriptor, uint64_t value) {
+    writer.family(descriptor);
+    writer.counter(descriptor, {}, value);
+}
 
-    ss << name << "_count";
-    if (!labels.empty()) {
-        ss << "{" << labels << "}";
-    }
-    ss << " " << samples.size() << "\n";
+void write_gauge(exposition_writer& writer, const metric_descriptor& descriptor,
+                 double value) {
+    writer.family(descriptor);
+    writer.gauge(descriptor, {}, value);
 }
 
 }  // namespace
 
 std::string bridge_metrics_collector::get_prometheus_metrics() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    std::ostringstream ss;
+    std::string out;
+    out.reserve(last_exposition_size_.load(std::memory_order_relaxed));
+    write_prometheus_metrics(out);
+    return out;
+}
 
-    auto buckets = default_latency_buckets();
+void bridge_metrics_collector::write_prometheus_metrics(
+    std::string& out, exposition_format format) const {
+    size_t start = out.size();
+    exposition_writer writer(out, format);
 
     // HL7 Message Counters
-    for (const auto& [msg_type, count] : data_->hl7_messages_received) {
-        std::string labels = "message_type=\"" + msg_type + "\"";
-        ss << "# HELP hl7_messages_received_total Total HL7 messages received\n";
-        ss << "# TYPE hl7_messages_received_total counter\n";
-        ss << "hl7_messages_received_total{" << labels << "} "
-           << count.load() << "\n";
-    }
-
-    for (const auto& [msg_type, count] : data_->hl7_messages_sent) {
-        std::string labels = "message_type=\"" + msg_type + "\"";
-        ss << "# HELP hl7_messages_sent_total Total HL7 messages sent\n";
-        ss << "# TYPE hl7_messages_sent_total counter\n";
-        ss << "hl7_messages_sent_total{" << labels << "} "
-           << count.load() << "\n";
-    }
-
-    // HL7 Errors
-    for (const auto& [key, count] : data_->hl7_errors) {
-        auto pos = key.find(':');
-        std::string msg_type = (pos != std::string::npos) ? key.substr(0, pos) : key;
-        std::string error_type = (pos != std::string::npos) ? key.substr(pos + 1) : "unknown";
-        std::string labels = "message_type=\"" + msg_type + "\",error_type=\"" + error_type + "\"";
-        ss << "# HELP hl7_message_errors_total Total HL7 message errors\n";
-        ss << "# TYPE hl7_message_errors_total counter\n";
-        ss << "hl7_message_errors_total{" << labels << "} "
-           << count.load() << "\n";
-    }
-
-    // HL7 Processing Duration Histograms
-    {
-        std::lock_guard<std::mutex> duration_lock(
-            const_cast<std::mutex&>(data_->hl7_duration_mutex));
-        for (auto& [msg_type, histogram] : data_->hl7_processing_duration) {
-            std::string labels = "message_type=\"" + msg_type + "\"";
-            auto samples = histogram.get_samples();
-            write_histogram_metric(
-                ss, "hl7_message_processing_duration_seconds",
-                "HL7 message processing duration in seconds",
-                labels, samples, buckets);
-        }
-    }
+    write_counters(writer, hl7_received_desc, data_->hl7_messages_received);
+    write_counters(writer, hl7_sent_desc, data_->hl7_messages_sent);
+    write_counters(writer, hl7_errors_desc, data_->hl7_errors);
+
+    // HL7 Processing Duration Histograms (series with no samples are skipped)
+    bool duration_header = false;
+    data_->hl7_processing_duration.for_each(
+        [&](const std::string& labels, const log_linear_histogram& histogram) {
+            auto snapshot = histogram.collect();
+            if (snapshot.count == 0) {
+                return;
+            }
+            if (!duration_header) {
+                writer.family(hl7_duration_desc);
+                duration_header = true;
+            }
+            writer.histogram(hl7_duration_desc, labels, snapshot,
+                             latency_bounds);
+        });
 
     // MWL Counters
-    write_counter_metric(ss, "mwl_entries_created_total",
-                         "Total MWL entries created", "",
-                         data_->mwl_entries_created.load());
-    write_counter_metric(ss, "mwl_entries_updated_total",
-                         "Total MWL entries updated", "",
-                         data_->mwl_entries_updated.load());
-    write_counter_metric(ss, "mwl_entries_cancelled_total",
-                         "Total MWL entries cancelled", "",
-                         data_->mwl_entries_cancelled.load());
+    write_counter(writer, mwl_created_desc, data_->mwl_entries_created.load());
+    write_counter(writer, mwl_updated_desc, data_->mwl_entries_updated.load());
+    write_counter(writer, mwl_cancelled_desc,
+                  data_->mwl_entries_cancelled.load());
 
     // MWL Query Duration
     {
-        auto samples = data_->mwl_query_duration.get_samples();
-        write_histogram_metric(ss, "mwl_query_duration_seconds",
-                               "MWL query duration in seconds",
-                               "", samples, buckets);
+        auto snapshot = data_->mwl_query_duration.collect();
+        if (snapshot.count > 0) {
+            writer.family(mwl_duration_desc);
+            writer.histogram(mwl_duration_desc, {}, snapshot, latency_bounds);
+        }
     }
 
     // Queue Metrics
-    {
-        std::lock_guard<std::mutex> queue_lock(
-            const_cast<std::mutex&>(data_->queue_mutex));
-
-        for (const auto& [dest, depth] : data_->queue_depth) {
-            std::string labels = "destination=\"" + dest + "\"";
-            write_gauge_metric(ss, "queue_depth", "Current queue depth",
-                               labels, static_cast<double>(depth.load()));
-        }
-
-        for (const auto& [dest, count] : data_->messages_enqueued) {
-            std::string labels = "destination=\"" + dest + "\"";
-            ss << "# HELP queue_messages_enqueued_total Total messages enqueued\n";
-            ss << "# TYPE queue_messages_enqueued_total counter\n";
-            ss << "queue_messages_enqueued_total{" << labels << "} "
-               << count.load() << "\n";
-        }
-
-        for (const auto& [dest, count] : data_->messages_delivered) {
-            std::string labels = "destination=\"" + dest + "\"";
-            ss << "# HELP queue_messages_delivered_total Total messages delivered\n";
-            ss << "# TYPE queue_messages_delivered_total counter\n";
-            ss << "queue_messages_delivered_total{" << labels << "} "
-               << count.load() << "\n";
-        }
-
-        for (const auto& [dest, count] : data_->delivery_failures) {
-            std::string labels = "destination=\"" + dest + "\"";
-            ss << "# HELP queue_delivery_failures_total Total delivery failures\n";
-            ss << "# TYPE queue_delivery_failures_total counter\n";
-            ss << "queue_delivery_failures_total{" << labels << "} "
-               << count.load() << "\n";
-        }
-
-        for (const auto& [dest, count] : data_->dead_letters) {
-            std::string labels = "destination=\"" + dest + "\"";
-            ss << "# HELP queue_dead_letters_total Total dead letters\n";
-            ss << "# TYPE queue_dead_letters_total counter\n";
-            ss << "queue_dead_letters_total{" << labels << "} "
-               << count.load() << "\n";
-        }
-    }
+    write_family(writer, queue_depth_desc, data_->queue_depth,
+                 [&](const std::string& labels, const std::atomic<size_t>& depth) {
+                     writer.gauge(queue_depth_desc, labels,
+                                  static_cast<double>(depth.load()));
+                 });
+    write_counters(writer, enqueued_desc, data_->messages_enqueued);
+    write_counters(writer, delivered_desc, data_->messages_delivered);
+    write_counters(writer, failures_desc, data_->delivery_failures);
+    write_counters(writer, dead_letters_desc, data_->dead_letters);
 
     // Connection Metrics
-    write_gauge_metric(ss, "mllp_active_connections",
-                       "Current active MLLP connections", "",
-                       static_cast<double>(data_->mllp_active_connections.load()));
-    write_counter_metric(ss, "mllp_total_connections",
-                         "Total MLLP connections", "",
-                         data_->mllp_total_connections.load());
-    write_gauge_metric(ss, "fhir_active_requests",
-                       "Current active FHIR requests", "",
-                       static_cast<double>(data_->fhir_active_requests.load()));
+    write_gauge(writer, mllp_active_desc,
+                static_cast<double>(data_->mllp_active_connections.load()));
+    write_counter(writer, mllp_total_desc, data_->mllp_total_connections.load());
+    write_gauge(writer, fhir_active_desc,
+                static_cast<double>(data_->fhir_active_requests.load()));
+    write_counters(writer, fhir_requests_desc, data_->fhir_requests);
 
-    {
-        std::lock_guard<std::mutex> fhir_lock(
-            const_cast<std::mutex&>(data_->fhir_mutex));
-        for (const auto& [key, count] : data_->fhir_requests) {
-            auto pos = key.find(':');
-            std::string method = (pos != std::string::npos) ? key.substr(0, pos) : key;
-            std::string resource = (pos != std::string::npos) ? key.substr(pos + 1) : "unknown";
-            std::string labels = "method=\"" + method + "\",resource=\"" + resource + "\"";
-            ss << "# HELP fhir_requests_total Total FHIR requests\n";
-            ss << "# TYPE fhir_requests_total counter\n";
-            ss << "fhir_requests_total{" << labels << "} "
-               << count.load() << "\n";
-        }
-    }
+    // Label Cardinality
+    write_gauge(writer, label_sets_desc,
+                static_cast<double>(label_set_count()));
 
     // System Metrics
-    write_counter_metric(ss, "process_cpu_seconds_total",
-                         "Total CPU time in seconds", "",
-                         static_cast<uint64_t>(data_->process_cpu_seconds.load()));
-    write_gauge_metric(ss, "process_resident_memory_bytes",
-                       "Resident memory size in bytes", "",
-                       static_cast<double>(data_->process_memory_bytes.load()));
-    write_gauge_metric(ss, "process_open_fds",
-                       "Number of open file descriptors", "",
-                       static_cast<double>(data_->process_open_fds.load()));
-
-    return ss.str();
+    write_counter(writer, cpu_desc,
+                  static_cast<uint64_t>(data_->process_cpu_seconds.load()));
+    write_gauge(writer, memory_desc,
+                static_cast<double>(data_->process_memory_bytes.load()));
+    write_gauge(writer, fds_desc,
+                static_cast<double>(data_->process_open_fds.load()));
+
+    writer.finish();
+    last_exposition_size_.store(out.size() - start, std::memory_order_relaxed);
 }
 
 }  // namespace pacs::bridge::monitoring
@@ -18,9 +18,13 @@
 #include "pacs/bridge/monitoring/health_server.h"
 
 #include "pacs/bridge/monitoring/bridge_metrics.h"
+#include "pacs/bridge/monitoring/prometheus_writer.h"
 
 #include <algorithm>
 #include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
 #include <cstring>
 #include <future>
 #include <mutex>
@@ -45,6 +49,7 @@ using ssize_t = std::ptrdiff_t;
 #include <netinet/tcp.h>
 #include <poll.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 using socket_t = int;
 constexpr socket_t INVALID_SOCKET_VALUE = -1;
@@ -157,51 +162,178 @@ std::pair<std::string, std::string> parse_http_request(std::string_view request)
 }
 
 /**
- * @brief Format HTTP response for sending
+ * @brief Split the header block off a raw HTTP request
  *
- * @param response HTTP response structure
- * @return Formatted HTTP response string
+ * @param request Raw HTTP request data
+ * @return Header lines after the request line, up to the blank line
+ */
+std::string_view request_headers(std::string_view request) {
+    auto line_end = request.find('\n');
+    if (line_end == std::string_view::npos) {
+        return {};
+    }
+    std::string_view headers = request.substr(line_end + 1);
+    auto end = headers.find("\r\n\r\n");
+    if (end == std::string_view::npos) {
+        end = headers.find("\n\n");
+    }
+    return end == std::string_view::npos ? headers : headers.substr(0, end);
+}
+
+/**
+ * @brief Find a header value by case-insensitive name
+ *
+ * @param headers Raw header lines
+ * @param name Header name without the colon
+ * @return Trimmed value, empty if absent
+ */
+std::string_view find_header(std::string_view headers, std::string_view name) {
+    while (!headers.empty()) {
+        auto line_end = headers.find('\n');
+        std::string_view line = headers.substr(0, line_end);
+        headers = line_end == std::string_view::npos
+                      ? std::string_view{}
+                      : headers.substr(line_end + 1);
+
+        auto colon = line.find(':');
+        if (colon != name.size() ||
+            !std::equal(name.begin(), name.end(), line.begin(),
+                        [](char a, char b) {
+                            return std::tolower(static_cast<unsigned char>(a)) ==
+                                   std::tolower(static_cast<unsigned char>(b));
+                        })) {
+            continue;
+        }
+        std::string_view value = line.substr(colon + 1);
+        while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) {
+            value.remove_prefix(1);
+        }
+        while (!value.empty() && (value.back() == '\r' || value.back() == ' ')) {
+            value.remove_suffix(1);
+        }
+        return value;
+    }
+    return {};
+}
+
+/**
+ * @brief Format the HTTP status line and headers of a response
+ *
+ * @param response HTTP response structure (body is not read)
+ * @param body_size Size of the body sent after the headers
+ * @return Status line and headers, ending with the blank line
  */
-std::string format_http_response(const http_response& response) {
-    std::ostringstream ss;
+std::string format_http_headers(const http_response& response, size_t body_size) {
+    std::string out;
+    out.reserve(256);
 
     // Status line
-    ss << "HTTP/1.1 " << response.status_code << " ";
+    char number[24];
+    out.append("HTTP/1.1 ");
+    out.append(number,
+               std::to_chars(number, number + sizeof(number), response.status_code).ptr);
+    out.push_back(' ');
     switch (response.status_code) {
         case 200:
-            ss << "OK";
+            out.append("OK");
             break;
         case 404:
-            ss << "Not Found";
+            out.append("Not Found");
             break;
         case 500:
-            ss << "Internal Server Error";
+            out.append("Internal Server Error");
             break;
         case 503:
-            ss << "Service Unavailable";
+            out.append("Service Unavailable");
             break;
         default:
-            ss << "Unknown";
+            out.append("Unknown");
             break;
     }
-    ss << "\r\n";
+    out.append("\r\n");
 
     // Headers
-    ss << "Content-Type: " << response.content_type << "\r\n";
-    ss << "Content-Length: " << response.body.size() << "\r\n";
-    ss << "Connection: close\r\n";
+    out.append("Content-Type: ").append(response.content_type).append("\r\n");
+    if (!response.content_encoding.empty()) {
+        out.append("Content-Encoding: ")
+            .append(response.content_encoding)
+            .append("\r\n");
+        out.append("Vary: Accept-Encoding\r\n");
+    }
+    out.append("Content-Length: ");
+    out.append(number,
+               std::to_chars(number, number + sizeof(number), body_size).ptr);
+    out.append("\r\n");
+    out.append("Connection: close\r\n");
 
     // CORS headers for development
-    ss << "Access-Control-Allow-Origin: *\r\n";
-    ss << "Access-Control-Allow-Methods: GET, OPTIONS\r\n";
+    out.append("Access-Control-Allow-Origin: *\r\n");
+    out.append("Access-Control-Allow-Methods: GET, OPTIONS\r\n");
 
     // Empty line between headers and body
-    ss << "\r\n";
+    out.append("\r\n");
+
+    return out;
+}
 
-    // Body
-    ss << response.body;
+/**
+ * @brief Bound how long a client can stall a read or write
+ */
+void set_socket_timeouts(socket_t socket, int seconds) {
+    if (seconds <= 0) {
+        return;
+    }
+#ifdef _WIN32
+    DWORD timeout = static_cast<DWORD>(seconds) * 1000;
+    setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO,
+               reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+    setsockopt(socket, SOL_SOCKET, SO_SNDTIMEO,
+               reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+#else
+    struct timeval timeout {};
+    timeout.tv_sec = seconds;
+    setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(socket, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+#endif
+}
 
-    return ss.str();
+/**
+ * @brief Send headers and body without joining them into one buffer
+ */
+void send_response(socket_t socket, const http_response& response,
+                   std::string_view body) {
+    std::string head = format_http_headers(response, body.size());
+#ifdef _WIN32
+    ::send(socket, head.data(), static_cast<int>(head.size()), 0);
+    if (!body.empty()) {
+        ::send(socket, body.data(), static_cast<int>(body.size()), 0);
+    }
+#else
+    struct iovec iov[2] = {
+        {head.data(), head.size()},
+        {const_cast<char*>(body.data()), body.size()},
+    };
+    struct iovec* next = iov;
+    int count = body.empty() ? 1 : 2;
+    while (count > 0) {
+        ssize_t written = ::writev(socket, next, count);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return;
+        }
+        // Skip what was sent; a partial write resumes mid-buffer
+        auto remaining = static_cast<size_t>(written);
+        while (count > 0 && remaining >= next->iov_len) {
+            remaining -= next->iov_len;
+            ++next;
+            --count;
+        }
+        if (count > 0) {
+            next->iov_base = static_cast<char*>(next->iov_base) + remaining;
+            next->iov_len -= remaining;
+        }
+    }
+#endif
 }
 
 }  // namespace
@@ -377,7 +509,8 @@ public:
         return stats_;
     }
 
-    [[nodiscard]] http_response handle_request(std::string_view path) const {
+    [[nodiscard]] http_response handle_request(std::string_view path,
+                                               std::string_view headers = {}) const {
         // Update statistics
         {
             std::lock_guard lock(stats_mutex_);
@@ -406,10 +539,8 @@ public:
             response = handle_deep();
             std::lock_guard lock(stats_mutex_);
             stats_.deep_health_requests++;
-        } else if (config_.enable_metrics_endpoint &&
-                   (path == config_.metrics_path ||
-                    normalized_path == config_.metrics_path)) {
-            response = handle_metrics();
+        } else if (is_metrics_path(path)) {
+            response = handle_metrics(headers);
             std::lock_guard lock(stats_mutex_);
             stats_.metrics_requests++;
         } else {
@@ -489,10 +620,9 @@ private:
     void configure_default_metrics_provider() {
         std::lock_guard lock(metrics_mutex_);
         if (!metrics_provider_) {
-            // Auto-configure with bridge_metrics_collector
-            metrics_provider_ = []() {
-                return bridge_metrics_collector::instance().get_prometheus_metrics();
-            };
+            // Auto-configure with bridge_metrics_collector, streamed into
+            // metrics_buffer_ rather than through a provider string
+            use_collector_metrics_ = true;
         }
     }
 
@@ -555,6 +685,8 @@ private:
     }
 
     void handle_connection(socket_t client_socket) {
+        set_socket_timeouts(client_socket, config_.connection_timeout_seconds);
+
         // Read HTTP request
         std::vector<char> buffer(4096);
         ssize_t bytes_read = ::recv(client_socket, buffer.data(),
@@ -562,6 +694,9 @@ private:
 
         http_response response;
 
+        // Reused buffer the metrics body was taken from, if any
+        std::string* metrics_buffer = nullptr;
+
         if (bytes_read > 0) {
             buffer[static_cast<size_t>(bytes_read)] = '\0';
             std::string_view request(buffer.data(),
@@ -570,8 +705,11 @@ private:
             // Parse request
             auto [method, path] = parse_http_request(request);
 
-            if (method == "GET") {
-                response = handle_request(path);
+            if (method == "GET" && is_metrics_path(path)) {
+                count_metrics_request();
+                metrics_buffer = take_metrics(request_headers(request), response);
+            } else if (method == "GET") {
+                response = handle_request(path, request_headers(request));
             } else if (method == "OPTIONS") {
                 // Handle CORS preflight
                 response = http_response{200, "text/plain", ""};
@@ -584,9 +722,8 @@ private:
         }
 
         // Send response
-        std::string response_str = format_http_response(response);
-        ::send(client_socket, response_str.data(),
-               static_cast<int>(response_str.size()), 0);
+        send_response(client_socket, response, response.body);
+        recycle_metrics_buffer(metrics_buffer, response.body);
 
         // Close connection
         CLOSE_SOCKET(client_socket);
@@ -638,20 +775,106 @@ private:
         }
     }
 
-    [[nodiscard]] http_response handle_metrics() const {
+    [[nodiscard]] bool is_metrics_path(std::string_view path) const {
+        if (!config_.enable_metrics_endpoint) {
+            return false;
+        }
+        std::string_view normalized = path;
+        if (normalized.starts_with(config_.base_path)) {
+            normalized.remove_prefix(config_.base_path.size());
+        }
+        return path == config_.metrics_path || normalized == config_.metrics_path;
+    }
+
+    void count_metrics_request() const {
+        std::lock_guard lock(stats_mutex_);
+        stats_.total_requests++;
+        stats_.metrics_requests++;
+    }
+
+    [[nodiscard]] http_response handle_metrics(std::string_view headers) const {
+        // The returned response keeps the buffer's allocation
+        http_response response;
+        (void)take_metrics(headers, response);
+        return response;
+    }
+
+    /**
+     * @brief Render the metrics response and move its body into response
+     *
+     * The body is swapped out of the reused buffer so it can be sent
+     * without holding metrics_mutex_.
+     *
+     * @return The buffer the body came from, for recycle_metrics_buffer(),
+     *         or nullptr if it was built in response.body
+     */
+    std::string* take_metrics(std::string_view headers, http_response& response) const {
         std::lock_guard lock(metrics_mutex_);
-        if (!metrics_provider_) {
-            return http_response{200, "text/plain; version=0.0.4; charset=utf-8",
-                                 "# No metrics provider configured\n"};
+        std::string_view body = render_metrics(headers, response);
+        for (std::string* buffer : {&metrics_buffer_, &compressed_buffer_}) {
+            if (body.data() == buffer->data()) {
+                response.body.swap(*buffer);
+                return buffer;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Hand a sent body's allocation back to the buffer it came from
+     *
+     * Keeps the larger allocation when another scrape refilled the buffer
+     * in the meantime.
+     */
+    void recycle_metrics_buffer(std::string* buffer, std::string& body) const {
+        if (buffer == nullptr) {
+            return;
+        }
+        std::lock_guard lock(metrics_mutex_);
+        if (buffer->capacity() < body.capacity()) {
+            buffer->swap(body);
+        }
+    }
+
+    /**
+     * @brief Build the metrics response in the reused buffers
+     *
+     * Caller holds metrics_mutex_. Sets everything but the body on
+     * response and returns the body, which views metrics_buffer_,
+     * compressed_buffer_ or response.body.
+     */
+    std::string_view render_metrics(std::string_view headers,
+                                    http_response& response) const {
+        auto format = exposition_format::prometheus_text;
+        if (metrics_provider_) {
+            try {
+                metrics_buffer_ = metrics_provider_();
+            } catch (const std::exception& e) {
+                response = http_response::internal_error(e.what());
+                return response.body;
+            }
+        } else if (use_collector_metrics_) {
+            if (find_header(headers, "Accept").find("application/openmetrics-text") !=
+                std::string_view::npos) {
+                format = exposition_format::openmetrics_text;
+            }
+            metrics_buffer_.clear();
+            bridge_metrics_collector::instance().write_prometheus_metrics(
+                metrics_buffer_, format);
+        } else {
+            response = http_response{200, "text/plain; version=0.0.4; charset=utf-8",
+                                     "# No metrics provider configured\n"};
+            return response.body;
         }
 
-        try {
-            std::string metrics = metrics_provider_();
-            return http_response{200, "text/plain; version=0.0.4; charset=utf-8",
-                                 std::move(metrics)};
-        } catch (const std::exception& e) {
-            return http_response::internal_error(e.what());
+        response = http_response{200, std::string(content_type(format)), {}};
+        if (config_.enable_metrics_compression &&
+            accepts_gzip(find_header(headers, "Accept-Encoding")) &&
+            compressor_.compress(metrics_buffer_, compressed_buffer_)) {
+            response.content_encoding = "gzip";
+            return compressed_buffer_;
         }
+        return metrics_buffer_;
     }
 
     // =========================================================================
@@ -679,6 +902,12 @@ private:
     // Metrics
     mutable std::mutex metrics_mutex_;
     metrics_provider metrics_provider_;
+    bool use_collector_metrics_ = false;
+
+    // Exposition and compression state, reused across scrapes
+    mutable std::string metrics_buffer_;
+    mutable std::string compressed_buffer_;
+    mutable gzip_compressor compressor_;
 
 #ifndef PACS_BRIDGE_STANDALONE_BUILD
     // Futures for tracking executor-based jobs
@@ -834,6 +1063,11 @@ http_response health_server::handle_request(std::string_view path) const {
     return pimpl_->handle_request(path);
 }
 
+http_response health_server::handle_request(std::string_view path,
+                                            std::string_view headers) const {
+    return pimpl_->handle_request(path, headers);
+}
+
 // ═══════════════════════════════════════════════════════════════════════════
 // Configuration Helpers
 // ═══════════════════════════════════════════════════════════════════════════
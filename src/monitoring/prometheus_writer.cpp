@@ -0,0 +1,308 @@
+/**
+ * @file prometheus_writer.cpp
+ * @brief Streaming Prometheus / OpenMetrics text exposition encoder
+ *
+ * @see include/pacs/bridge/monitoring/prometheus_writer.h
+ */
+
+#include "pacs/bridge/monitoring/prometheus_writer.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cctype>
+#include <cmath>
+
+#ifdef PACS_BRIDGE_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+namespace pacs::bridge::monitoring {
+
+std::string_view content_type(exposition_format format) noexcept {
+    switch (format) {
+        case exposition_format::openmetrics_text:
+            return "application/openmetrics-text; version=1.0.0; charset=utf-8";
+        case exposition_format::prometheus_text:
+        default:
+            return "text/plain; version=0.0.4; charset=utf-8";
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Metric Descriptor
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+constexpr std::string_view total_suffix = "_total";
+
+std::string_view type_name(metric_type type) noexcept {
+    switch (type) {
+        case metric_type::counter:
+            return "counter";
+        case metric_type::gauge:
+            return "gauge";
+        case metric_type::histogram:
+        default:
+            return "histogram";
+    }
+}
+
+std::string render_header(std::string_view family, std::string_view help,
+                          metric_type type) {
+    std::string header;
+    header.append("# HELP ").append(family).append(" ").append(help);
+    header.append("\n# TYPE ").append(family).append(" ");
+    header.append(type_name(type)).append("\n");
+    return header;
+}
+
+}  // namespace
+
+metric_descriptor::metric_descriptor(std::string_view name,
+                                     std::string_view help, metric_type type)
+    : type_(type), name_(name) {
+    text_header_ = render_header(name_, help, type_);
+
+    std::string_view family = name_;
+    if (type_ == metric_type::counter) {
+        if (family.ends_with(total_suffix)) {
+            family.remove_suffix(total_suffix.size());
+        }
+        openmetrics_sample_name_ = std::string(family) + std::string(total_suffix);
+    } else {
+        openmetrics_sample_name_ = name_;
+    }
+    openmetrics_header_ = render_header(family, help, type_);
+}
+
+std::string_view metric_descriptor::sample_name(
+    exposition_format format) const noexcept {
+    return format == exposition_format::openmetrics_text
+               ? std::string_view(openmetrics_sample_name_)
+               : std::string_view(name_);
+}
+
+std::string_view metric_descriptor::header(
+    exposition_format format) const noexcept {
+    return format == exposition_format::openmetrics_text
+               ? std::string_view(openmetrics_header_)
+               : std::string_view(text_header_);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Exposition Writer
+// ═══════════════════════════════════════════════════════════════════════════
+
+void exposition_writer::family(const metric_descriptor& descriptor) {
+    out_.append(descriptor.header(format_));
+}
+
+void exposition_writer::counter(const metric_descriptor& descriptor,
+                                std::string_view labels, uint64_t value) {
+    sample_prefix(descriptor.sample_name(format_), {}, labels, {});
+    append(value);
+    out_.push_back('\n');
+}
+
+void exposition_writer::gauge(const metric_descriptor& descriptor,
+                              std::string_view labels, double value) {
+    sample_prefix(descriptor.sample_name(format_), {}, labels, {});
+    append_fixed(value, 6);
+    out_.push_back('\n');
+}
+
+void exposition_writer::histogram(
+    const metric_descriptor& descriptor, std::string_view labels,
+    const internal::log_linear_histogram::snapshot& snapshot,
+    std::span<const double> bounds) {
+    std::string_view name = descriptor.sample_name(format_);
+
+    // le="..." rendered into a stack buffer: le="<digits>"
+    char le[48];
+    for (double bound : bounds) {
+        auto limit = static_cast<uint64_t>(bound * 1e9);
+        char* p = le;
+        p = std::copy_n("le=\"", 4, p);
+        p = std::to_chars(p, le + sizeof(le) - 1, bound,
+                          std::chars_format::fixed, 3)
+                .ptr;
+        *p++ = '"';
+        sample_prefix(name, "_bucket", labels,
+                      std::string_view(le, static_cast<size_t>(p - le)));
+        append(snapshot.count_at_or_below(limit));
+        out_.push_back('\n');
+    }
+
+    sample_prefix(name, "_bucket", labels, "le=\"+Inf\"");
+    append(snapshot.count);
+    out_.push_back('\n');
+
+    sample_prefix(name, "_sum", labels, {});
+    append_fixed(static_cast<double>(snapshot.sum) / 1e9, 6);
+    out_.push_back('\n');
+
+    sample_prefix(name, "_count", labels, {});
+    append(snapshot.count);
+    out_.push_back('\n');
+}
+
+void exposition_writer::finish() {
+    if (format_ == exposition_format::openmetrics_text) {
+        out_.append("# EOF\n");
+    }
+}
+
+void exposition_writer::sample_prefix(std::string_view name,
+                                      std::string_view suffix,
+                                      std::string_view labels,
+                                      std::string_view extra_label) {
+    out_.append(name).append(suffix);
+    if (!labels.empty() || !extra_label.empty()) {
+        out_.push_back('{');
+        out_.append(labels);
+        if (!labels.empty() && !extra_label.empty()) {
+            out_.push_back(',');
+        }
+        out_.append(extra_label);
+        out_.push_back('}');
+    }
+    out_.push_back(' ');
+}
+
+void exposition_writer::append(uint64_t value) {
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out_.append(buffer, result.ptr);
+}
+
+void exposition_writer::append_fixed(double value, int precision) {
+    if (std::isnan(value)) {
+        out_.append("NaN");
+        return;
+    }
+    if (std::isinf(value)) {
+        out_.append(value > 0 ? "+Inf" : "-Inf");
+        return;
+    }
+    char buffer[64];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value,
+                                std::chars_format::fixed, precision);
+    if (result.ec != std::errc{}) {
+        result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    }
+    out_.append(buffer, result.ptr);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Compression
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool gzip_available() noexcept {
+#ifdef PACS_BRIDGE_HAS_ZLIB
+    return true;
+#else
+    return false;
+#endif
+}
+
+#ifdef PACS_BRIDGE_HAS_ZLIB
+struct gzip_compressor::stream {
+    z_stream z{};
+    bool ready = false;
+
+    stream() {
+        // windowBits 15 + 16 selects the gzip wrapper; level 1 keeps scrape
+        // latency low, exposition text compresses well even so
+        ready = deflateInit2(&z, 1, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+    }
+
+    ~stream() {
+        if (ready) {
+            deflateEnd(&z);
+        }
+    }
+};
+#else
+struct gzip_compressor::stream {};
+#endif
+
+gzip_compressor::gzip_compressor() : stream_(std::make_unique<stream>()) {}
+
+gzip_compressor::~gzip_compressor() = default;
+
+bool gzip_compressor::compress(std::string_view input, std::string& output) {
+#ifdef PACS_BRIDGE_HAS_ZLIB
+    z_stream& z = stream_->z;
+    if (!stream_->ready || deflateReset(&z) != Z_OK) {
+        output.clear();
+        return false;
+    }
+
+    output.resize(deflateBound(&z, static_cast<uLong>(input.size())));
+    z.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    z.avail_in = static_cast<uInt>(input.size());
+    z.next_out = reinterpret_cast<Bytef*>(output.data());
+    z.avail_out = static_cast<uInt>(output.size());
+
+    if (deflate(&z, Z_FINISH) != Z_STREAM_END) {
+        output.clear();
+        return false;
+    }
+    output.resize(z.total_out);
+    return true;
+#else
+    (void)input;
+    output.clear();
+    return false;
+#endif
+}
+
+bool gzip_compress(std::string_view input, std::string& output) {
+    gzip_compressor compressor;
+    return compressor.compress(input, output);
+}
+
+bool accepts_gzip(std::string_view accept_encoding) noexcept {
+    // Match the "gzip" coding, honouring an explicit q=0 rejection
+    while (!accept_encoding.empty()) {
+        auto comma = accept_encoding.find(',');
+        std::string_view coding = accept_encoding.substr(0, comma);
+        accept_encoding = comma == std::string_view::npos
+                              ? std::string_view{}
+                              : accept_encoding.substr(comma + 1);
+
+        while (!coding.empty() && coding.front() == ' ') coding.remove_prefix(1);
+        auto semi = coding.find(';');
+        std::string_view name = coding.substr(0, semi);
+        while (!name.empty() && name.back() == ' ') name.remove_suffix(1);
+
+        bool is_gzip =
+            name.size() == 4 &&
+            std::equal(name.begin(), name.end(), "gzip", [](char a, char b) {
+                return std::tolower(static_cast<unsigned char>(a)) == b;
+            });
+        if (!is_gzip && name != "*") {
+            continue;
+        }
+        if (semi != std::string_view::npos) {
+            std::string_view params = coding.substr(semi + 1);
+            auto q = params.find("q=");
+            if (q != std::string_view::npos) {
+                // q=0, q=0.0, q=0.000 all mean "not acceptable"
+                std::string_view value = params.substr(q + 2);
+                value = value.substr(0, value.find_first_of(" ;,"));
+                bool zero = !value.empty() &&
+                            value.find_first_not_of("0.") == std::string_view::npos;
+                if (zero) {
+                    if (is_gzip) return false;
+                    continue;
+                }
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+}  // namespace pacs::bridge::monitoring
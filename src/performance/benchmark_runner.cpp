@@ -512,16 +512,23 @@ struct benchmark_runner::impl {
         }
 
         std::atomic<uint64_t> completed{0};
-        size_t submitted = 0;
+        uint64_t submitted = 0;
+
+        // Keep a fixed window of tasks in flight so workers never starve
+        // and the injection queues never overflow
+        const uint64_t window = pool_config.queue_capacity;
 
         auto deadline = std::chrono::steady_clock::now() + config.duration;
 
         while (std::chrono::steady_clock::now() < deadline && !cancelled.load()) {
-            uint64_t before = completed.load(std::memory_order_relaxed);
+            if (submitted - completed.load(std::memory_order_relaxed) >= window) {
+                std::this_thread::yield();
+                continue;
+            }
 
             // Submit tasks
             for (size_t i = 0; i < 100; ++i) {
-                pool.post(
+                bool posted = pool.post(
                     [&completed]() {
                         // Simulate work
                         auto parser = zero_copy_parser::parse(get_sample_message());
@@ -529,16 +536,9 @@ struct benchmark_runner::impl {
                         completed.fetch_add(1, std::memory_order_relaxed);
                     },
                     task_priority::normal);
-                ++submitted;
-            }
-
-            // Wait for at least some tasks to complete before submitting more
-            auto wait_deadline = std::chrono::steady_clock::now() +
-                                 std::chrono::milliseconds(100);
-            while (completed.load(std::memory_order_relaxed) < before + 50 &&
-                   std::chrono::steady_clock::now() < wait_deadline &&
-                   !cancelled.load()) {
-                std::this_thread::yield();
+                if (posted) {
+                    ++submitted;
+                }
             }
         }
 
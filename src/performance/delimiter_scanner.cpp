@@ -0,0 +1,252 @@
+/**
+ * @file delimiter_scanner.cpp
+ * @brief Implementation of the vectorized HL7 delimiter scanner
+ */
+
+#include "pacs/bridge/performance/delimiter_scanner.h"
+
+#include <algorithm>
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || \
+    defined(_M_IX86)
+#define PACS_BRIDGE_SCANNER_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define PACS_BRIDGE_TARGET_AVX2
+#define PACS_BRIDGE_TARGET_SSE2
+#else
+#define PACS_BRIDGE_TARGET_AVX2 __attribute__((target("avx2")))
+#define PACS_BRIDGE_TARGET_SSE2 __attribute__((target("sse2")))
+#endif
+#endif
+
+namespace pacs::bridge::performance {
+
+namespace {
+
+// =============================================================================
+// Scan Kernels
+// =============================================================================
+
+/** Typical HL7 traffic has a delimiter every 4-8 bytes */
+constexpr size_t initial_reserve_divisor = 8;
+
+/**
+ * @brief Growth bounds for delimiter_index
+ *
+ * Delimiter-sparse payloads such as base64 reports should not reserve space
+ * proportional to their size.
+ */
+constexpr size_t min_index_chunk = 1024;
+constexpr size_t max_initial_chunk = 64 * 1024;
+
+/**
+ * @brief Output cursor shared by the scan kernels
+ */
+struct scan_output {
+    uint32_t* data;
+    size_t capacity;
+    size_t written = 0;
+
+    [[nodiscard]] size_t room() const noexcept { return capacity - written; }
+};
+
+/**
+ * @brief Byte-at-a-time scan; stops when out is full
+ */
+size_t scan_scalar(std::string_view data, size_t pos,
+                   const delimiter_set& delimiters, scan_output& out) {
+    for (; pos < data.size() && out.room() > 0; ++pos) {
+        if (delimiters.contains(data[pos])) {
+            out.data[out.written++] = static_cast<uint32_t>(pos);
+        }
+    }
+    return pos;
+}
+
+#ifdef PACS_BRIDGE_SCANNER_X86
+
+/**
+ * @brief Append offsets of set bits in a movemask result
+ */
+inline void emit_mask(uint32_t mask, size_t base, scan_output& out) {
+    while (mask != 0) {
+        out.data[out.written++] =
+            static_cast<uint32_t>(base + static_cast<size_t>(std::countr_zero(mask)));
+        mask &= mask - 1;
+    }
+}
+
+/**
+ * @brief 16-byte blocks; stops at the data tail or when a block might not fit
+ */
+PACS_BRIDGE_TARGET_SSE2
+size_t scan_sse2(std::string_view data, size_t pos,
+                 const delimiter_set& delimiters, scan_output& out) {
+    const auto bytes = delimiters.bytes();
+    __m128i needles[delimiter_set::max_size];
+    for (size_t k = 0; k < bytes.size(); ++k) {
+        needles[k] = _mm_set1_epi8(bytes[k]);
+    }
+
+    const char* p = data.data();
+    for (; pos + 16 <= data.size() && out.room() >= 16; pos += 16) {
+        const __m128i chunk =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + pos));
+        __m128i hits = _mm_setzero_si128();
+        for (size_t k = 0; k < bytes.size(); ++k) {
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, needles[k]));
+        }
+        emit_mask(static_cast<uint32_t>(_mm_movemask_epi8(hits)), pos, out);
+    }
+    return pos;
+}
+
+/**
+ * @brief 32-byte blocks; stops at the data tail or when a block might not fit
+ */
+PACS_BRIDGE_TARGET_AVX2
+size_t scan_avx2(std::string_view data, size_t pos,
+                 const delimiter_set& delimiters, scan_output& out) {
+    const auto bytes = delimiters.bytes();
+    __m256i needles[delimiter_set::max_size];
+    for (size_t k = 0; k < bytes.size(); ++k) {
+        needles[k] = _mm256_set1_epi8(bytes[k]);
+    }
+
+    const char* p = data.data();
+    for (; pos + 32 <= data.size() && out.room() >= 32; pos += 32) {
+        const __m256i chunk =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + pos));
+        __m256i hits = _mm256_setzero_si256();
+        for (size_t k = 0; k < bytes.size(); ++k) {
+            hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(chunk, needles[k]));
+        }
+        emit_mask(static_cast<uint32_t>(_mm256_movemask_epi8(hits)), pos, out);
+    }
+    return pos;
+}
+
+simd_level detect_simd_level() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int regs[4];
+    __cpuid(regs, 0);
+    if (regs[0] >= 7) {
+        __cpuid(regs, 1);
+        const bool osxsave = (regs[2] & (1 << 27)) != 0;
+        const bool avx = (regs[2] & (1 << 28)) != 0;
+        __cpuidex(regs, 7, 0);
+        const bool avx2 = (regs[1] & (1 << 5)) != 0;
+        if (osxsave && avx && avx2 && (_xgetbv(0) & 0x6) == 0x6) {
+            return simd_level::avx2;
+        }
+    }
+    return simd_level::sse2;
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return simd_level::avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return simd_level::sse2;
+    }
+    return simd_level::scalar;
+#endif
+}
+
+#else
+
+simd_level detect_simd_level() noexcept { return simd_level::scalar; }
+
+#endif  // PACS_BRIDGE_SCANNER_X86
+
+}  // namespace
+
+// =============================================================================
+// SIMD Level
+// =============================================================================
+
+simd_level detected_simd_level() noexcept {
+    static const simd_level level = detect_simd_level();
+    return level;
+}
+
+// =============================================================================
+// Delimiter Scanner
+// =============================================================================
+
+delimiter_scanner::delimiter_scanner(std::string_view data,
+                                     const delimiter_set& delimiters,
+                                     simd_level level) noexcept
+    : data_(data),
+      delimiters_(delimiters),
+      level_(std::min(level, detected_simd_level())) {}
+
+size_t delimiter_scanner::next(std::span<uint32_t> out) noexcept {
+    if (delimiters_.empty()) {
+        position_ = data_.size();
+        return 0;
+    }
+
+    scan_output output{out.data(), out.size()};
+    size_t pos = position_;
+
+#ifdef PACS_BRIDGE_SCANNER_X86
+    if (level_ == simd_level::avx2) {
+        pos = scan_avx2(data_, pos, delimiters_, output);
+    }
+    if (level_ != simd_level::scalar) {
+        pos = scan_sse2(data_, pos, delimiters_, output);
+        if (pos + 16 <= data_.size() && output.written > 0) {
+            // Output is full; leave the remaining blocks to the next call
+            // rather than falling back to the scalar loop. Buffers smaller
+            // than one block fall through to the scalar loop instead.
+            position_ = pos;
+            return output.written;
+        }
+    }
+#endif
+
+    position_ = scan_scalar(data_, pos, delimiters_, output);
+    return output.written;
+}
+
+// =============================================================================
+// Delimiter Index
+// =============================================================================
+
+delimiter_index delimiter_index::scan(std::string_view data,
+                                      const delimiter_set& delimiters) {
+    return scan(data, delimiters, detected_simd_level());
+}
+
+delimiter_index delimiter_index::scan(std::string_view data,
+                                      const delimiter_set& delimiters,
+                                      simd_level level) {
+    delimiter_scanner scanner(data, delimiters, level);
+
+    delimiter_index index;
+    index.level_ = scanner.level();
+
+    size_t count = 0;
+    size_t chunk = std::clamp(data.size() / initial_reserve_divisor,
+                              min_index_chunk, max_initial_chunk);
+    while (!scanner.done()) {
+        index.positions_.resize(count + chunk);
+        count += scanner.next(std::span(index.positions_).subspan(count));
+        chunk = std::max(chunk, count);
+    }
+    index.positions_.resize(count);
+
+    return index;
+}
+
+size_t delimiter_index::lower_bound(uint32_t offset) const noexcept {
+    return static_cast<size_t>(
+        std::lower_bound(positions_.begin(), positions_.end(), offset) -
+        positions_.begin());
+}
+
+}  // namespace pacs::bridge::performance
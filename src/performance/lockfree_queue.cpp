@@ -6,15 +6,19 @@
  */
 
 #include "pacs/bridge/performance/lockfree_queue.h"
+#include "pacs/bridge/performance/small_task.h"
 
 #include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <concepts>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
 #include <vector>
 
@@ -72,6 +76,290 @@ private:
 
 }  // namespace
 
+// =============================================================================
+// Bounded MPMC Queue Implementation
+// =============================================================================
+
+/*
+ * Ring of cells, each with a sequence number (D. Vyukov's bounded MPMC
+ * queue). A producer claims a cell by advancing enqueue_pos once the cell's
+ * sequence says it is free; a consumer claims it by advancing dequeue_pos
+ * once the sequence says it is filled. Producers and consumers only contend
+ * on their own position counter.
+ */
+template <concepts::Queueable T>
+struct lockfree_queue<T>::impl {
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    struct alignas(CACHE_LINE_SIZE) cell {
+        std::atomic<size_t> sequence{0};
+        std::optional<T> value;
+    };
+
+    struct alignas(CACHE_LINE_SIZE) padded_position {
+        std::atomic<size_t> value{0};
+    };
+
+    lockfree_queue_config config;
+    std::unique_ptr<cell[]> cells;
+    size_t capacity;
+    size_t mask;
+    padded_position enqueue_pos;
+    padded_position dequeue_pos;
+    queue_statistics stats;
+
+    explicit impl(const lockfree_queue_config& cfg)
+        : config(cfg),
+          capacity(next_power_of_2(std::max<size_t>(cfg.capacity, 2))),
+          mask(capacity - 1) {
+        cells = std::make_unique<cell[]>(capacity);
+        for (size_t i = 0; i < capacity; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~impl() {
+        while (try_pop()) {
+        }
+    }
+
+    // Leaves item untouched when the queue is full
+    bool try_push(T& item) noexcept {
+        size_t pos = enqueue_pos.value.load(std::memory_order_relaxed);
+        cell* target = nullptr;
+        while (true) {
+            target = &cells[pos & mask];
+            size_t seq = target->sequence.load(std::memory_order_acquire);
+            auto dif = static_cast<std::intptr_t>(seq) -
+                       static_cast<std::intptr_t>(pos);
+            if (dif == 0) {
+                if (enqueue_pos.value.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+                stats.contentions.fetch_add(1, std::memory_order_relaxed);
+            } else if (dif < 0) {
+                return false;  // Full
+            } else {
+                pos = enqueue_pos.value.load(std::memory_order_relaxed);
+            }
+        }
+
+        target->value.emplace(std::move(item));
+        target->sequence.store(pos + 1, std::memory_order_release);
+
+        stats.total_pushed.fetch_add(1, std::memory_order_relaxed);
+        record_depth();
+        return true;
+    }
+
+    std::optional<T> try_pop() noexcept {
+        size_t pos = dequeue_pos.value.load(std::memory_order_relaxed);
+        cell* source = nullptr;
+        while (true) {
+            source = &cells[pos & mask];
+            size_t seq = source->sequence.load(std::memory_order_acquire);
+            auto dif = static_cast<std::intptr_t>(seq) -
+                       static_cast<std::intptr_t>(pos + 1);
+            if (dif == 0) {
+                if (dequeue_pos.value.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+                stats.contentions.fetch_add(1, std::memory_order_relaxed);
+            } else if (dif < 0) {
+                return std::nullopt;  // Empty
+            } else {
+                pos = dequeue_pos.value.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::optional<T> result(std::move(*source->value));
+        source->value.reset();
+        source->sequence.store(pos + capacity, std::memory_order_release);
+
+        stats.total_popped.fetch_add(1, std::memory_order_relaxed);
+        stats.current_depth.store(approx_size(), std::memory_order_relaxed);
+        return result;
+    }
+
+    // Retries try_push with backoff until the deadline
+    bool push_until(T& item, std::chrono::milliseconds timeout) {
+        if (try_push(item)) {
+            return true;
+        }
+        stats.push_failures.fetch_add(1, std::memory_order_relaxed);
+        waiter wait(config, timeout);
+        while (wait.next()) {
+            if (try_push(item)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::optional<T> pop_until(std::chrono::milliseconds timeout) {
+        if (auto item = try_pop()) {
+            return item;
+        }
+        stats.pop_failures.fetch_add(1, std::memory_order_relaxed);
+        waiter wait(config, timeout);
+        while (wait.next()) {
+            if (auto item = try_pop()) {
+                return item;
+            }
+        }
+        return std::nullopt;
+    }
+
+    size_t approx_size() const noexcept {
+        size_t tail = enqueue_pos.value.load(std::memory_order_relaxed);
+        size_t head = dequeue_pos.value.load(std::memory_order_relaxed);
+        return tail > head ? std::min(tail - head, capacity) : 0;
+    }
+
+    void record_depth() noexcept {
+        size_t depth = approx_size();
+        stats.current_depth.store(depth, std::memory_order_relaxed);
+        size_t peak = stats.peak_depth.load(std::memory_order_relaxed);
+        while (depth > peak && !stats.peak_depth.compare_exchange_weak(
+                                   peak, depth, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * Spin with backoff, then yield, then sleep briefly, until the deadline
+     */
+    class waiter {
+    public:
+        waiter(const lockfree_queue_config& cfg, std::chrono::milliseconds timeout)
+            : spin_limit_(cfg.enable_backoff ? cfg.spin_count : 0),
+              unlimited_(timeout == std::chrono::milliseconds::max()),
+              deadline_(unlimited_ ? std::chrono::steady_clock::time_point::max()
+                                   : std::chrono::steady_clock::now() + timeout) {}
+
+        // false once the deadline has passed
+        bool next() {
+            if (!unlimited_ && std::chrono::steady_clock::now() >= deadline_) {
+                return false;
+            }
+            if (attempts_ < spin_limit_) {
+                backoff_.backoff();
+            } else if (attempts_ < spin_limit_ + 64) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+            ++attempts_;
+            return true;
+        }
+
+    private:
+        size_t spin_limit_;
+        bool unlimited_;
+        std::chrono::steady_clock::time_point deadline_;
+        size_t attempts_ = 0;
+        exponential_backoff backoff_{1, 64};
+    };
+};
+
+template <concepts::Queueable T>
+lockfree_queue<T>::lockfree_queue(const lockfree_queue_config& config)
+    : impl_(std::make_unique<impl>(config)) {}
+
+template <concepts::Queueable T>
+lockfree_queue<T>::~lockfree_queue() = default;
+
+template <concepts::Queueable T>
+bool lockfree_queue<T>::push(T item, std::chrono::milliseconds timeout) {
+    return impl_->push_until(item, timeout);
+}
+
+template <concepts::Queueable T>
+bool lockfree_queue<T>::try_push(T item) noexcept {
+    if (impl_->try_push(item)) {
+        return true;
+    }
+    impl_->stats.push_failures.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+template <concepts::Queueable T>
+size_t lockfree_queue<T>::push_batch(std::span<T> items) {
+    size_t pushed = 0;
+    for (auto& item : items) {
+        if (!impl_->try_push(item)) {
+            impl_->stats.push_failures.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+        ++pushed;
+    }
+    return pushed;
+}
+
+template <concepts::Queueable T>
+std::optional<T> lockfree_queue<T>::pop(std::chrono::milliseconds timeout) {
+    return impl_->pop_until(timeout);
+}
+
+template <concepts::Queueable T>
+std::optional<T> lockfree_queue<T>::try_pop() noexcept {
+    auto item = impl_->try_pop();
+    if (!item) {
+        impl_->stats.pop_failures.fetch_add(1, std::memory_order_relaxed);
+    }
+    return item;
+}
+
+template <concepts::Queueable T>
+std::vector<T> lockfree_queue<T>::pop_batch(size_t max_items) {
+    std::vector<T> items;
+    while (items.size() < max_items) {
+        auto item = impl_->try_pop();
+        if (!item) {
+            break;
+        }
+        items.push_back(std::move(*item));
+    }
+    return items;
+}
+
+template <concepts::Queueable T>
+std::vector<T> lockfree_queue<T>::pop_all() {
+    return pop_batch(std::numeric_limits<size_t>::max());
+}
+
+template <concepts::Queueable T>
+bool lockfree_queue<T>::empty() const noexcept {
+    return impl_->approx_size() == 0;
+}
+
+template <concepts::Queueable T>
+bool lockfree_queue<T>::full() const noexcept {
+    return impl_->approx_size() >= impl_->capacity;
+}
+
+template <concepts::Queueable T>
+size_t lockfree_queue<T>::size() const noexcept {
+    return impl_->approx_size();
+}
+
+template <concepts::Queueable T>
+size_t lockfree_queue<T>::capacity() const noexcept {
+    return impl_->capacity;
+}
+
+template <concepts::Queueable T>
+const queue_statistics& lockfree_queue<T>::statistics() const noexcept {
+    return impl_->stats;
+}
+
+template <concepts::Queueable T>
+void lockfree_queue<T>::clear() {
+    while (impl_->try_pop()) {
+    }
+}
+
 // =============================================================================
 // Work-Stealing Queue Implementation
 // =============================================================================
@@ -84,63 +372,66 @@ struct work_stealing_queue<T>::impl {
         std::atomic<int64_t> value{0};
     };
 
-    std::vector<std::atomic<T*>> buffer;
+    // occupied is set by the owner once the item is written and cleared by
+    // whoever claimed the index once the item is moved out
+    struct slot {
+        std::atomic<bool> occupied{false};
+        std::optional<T> item;
+    };
+
+    std::vector<slot> buffer;
     size_t capacity_mask;
     padded_atomic_size top;
     padded_atomic_size bottom;
 
     explicit impl(size_t cap)
         : buffer(next_power_of_2(cap)),
-          capacity_mask(next_power_of_2(cap) - 1) {
-        for (auto& slot : buffer) {
-            slot.store(nullptr, std::memory_order_relaxed);
-        }
-    }
+          capacity_mask(next_power_of_2(cap) - 1) {}
 
-    ~impl() {
-        // Clean up any remaining items
-        // try_pop() already handles pointer deletion internally
-        while (try_pop()) {
-            // Just discard the returned value
+    bool push(T&& item) {
+        int64_t b = bottom.value.load(std::memory_order_relaxed);
+        auto& s = buffer[static_cast<size_t>(b) & capacity_mask];
+        // Still occupied: the ring is full, or a thief that claimed the
+        // previous lap's index has not moved its item out yet
+        if (s.occupied.load(std::memory_order_acquire)) {
+            return false;
         }
+        s.item.emplace(std::move(item));
+        s.occupied.store(true, std::memory_order_relaxed);
+        bottom.value.store(b + 1, std::memory_order_release);
+        return true;
     }
 
-    void push(T item) {
-        int64_t b = bottom.value.load(std::memory_order_relaxed);
-        buffer[b & capacity_mask].store(new T(std::move(item)),
-                                        std::memory_order_relaxed);
-        std::atomic_thread_fence(std::memory_order_release);
-        bottom.value.store(b + 1, std::memory_order_relaxed);
+    static T take(slot& s) {
+        T result = std::move(*s.item);
+        s.item.reset();
+        s.occupied.store(false, std::memory_order_release);
+        return result;
     }
 
     std::optional<T> try_pop() {
+        // Every bottom store releases, so a thief that reads any of them
+        // also sees the items pushed below it
         int64_t b = bottom.value.load(std::memory_order_relaxed) - 1;
-        bottom.value.store(b, std::memory_order_relaxed);
+        bottom.value.store(b, std::memory_order_release);
         std::atomic_thread_fence(std::memory_order_seq_cst);
         int64_t t = top.value.load(std::memory_order_relaxed);
 
-        if (t <= b) {
-            // Non-empty queue
-            T* item = buffer[b & capacity_mask].load(std::memory_order_relaxed);
-            if (t == b) {
-                // Last item - potential race with steal
-                if (!top.value.compare_exchange_strong(
-                        t, t + 1, std::memory_order_seq_cst,
-                        std::memory_order_relaxed)) {
-                    // Lost race
-                    bottom.value.store(b + 1, std::memory_order_relaxed);
-                    return std::nullopt;
-                }
-                bottom.value.store(b + 1, std::memory_order_relaxed);
-            }
-            T result = std::move(*item);
-            delete item;
-            return result;
-        } else {
+        if (t > b) {
             // Empty queue
-            bottom.value.store(b + 1, std::memory_order_relaxed);
+            bottom.value.store(b + 1, std::memory_order_release);
             return std::nullopt;
         }
+        if (t == b) {
+            // Last item - potential race with steal
+            bool won = top.value.compare_exchange_strong(
+                t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.value.store(b + 1, std::memory_order_release);
+            if (!won) {
+                return std::nullopt;
+            }
+        }
+        return take(buffer[static_cast<size_t>(b) & capacity_mask]);
     }
 
     std::optional<T> try_steal() {
@@ -148,19 +439,16 @@ struct work_stealing_queue<T>::impl {
         std::atomic_thread_fence(std::memory_order_seq_cst);
         int64_t b = bottom.value.load(std::memory_order_acquire);
 
-        if (t < b) {
-            T* item = buffer[t & capacity_mask].load(std::memory_order_relaxed);
-            if (!top.value.compare_exchange_strong(
-                    t, t + 1, std::memory_order_seq_cst,
-                    std::memory_order_relaxed)) {
-                // Lost race
-                return std::nullopt;
-            }
-            T result = std::move(*item);
-            delete item;
-            return result;
+        if (t >= b) {
+            return std::nullopt;
         }
-        return std::nullopt;
+        if (!top.value.compare_exchange_strong(t, t + 1,
+                                               std::memory_order_seq_cst,
+                                               std::memory_order_relaxed)) {
+            // Lost race
+            return std::nullopt;
+        }
+        return take(buffer[static_cast<size_t>(t) & capacity_mask]);
     }
 
     bool is_empty() const {
@@ -184,8 +472,8 @@ template <concepts::Queueable T>
 work_stealing_queue<T>::~work_stealing_queue() = default;
 
 template <concepts::Queueable T>
-void work_stealing_queue<T>::push(T item) {
-    impl_->push(std::move(item));
+bool work_stealing_queue<T>::push(T&& item) {
+    return impl_->push(std::move(item));
 }
 
 template <concepts::Queueable T>
@@ -208,7 +496,15 @@ size_t work_stealing_queue<T>::size() const noexcept {
     return impl_->approx_size();
 }
 
+template <concepts::Queueable T>
+size_t work_stealing_queue<T>::capacity() const noexcept {
+    return impl_->buffer.size();
+}
+
 // Explicit instantiations for common types
+template class lockfree_queue<std::function<void()>>;
+template class lockfree_queue<small_task<>>;
 template class work_stealing_queue<std::function<void()>>;
+template class work_stealing_queue<small_task<>>;
 
 }  // namespace pacs::bridge::performance
@@ -0,0 +1,167 @@
+/**
+ * @file small_task.cpp
+ * @brief Pooled overflow storage for small_task
+ *
+ * Blocks come in four size classes (128 B to 1 KiB). Each thread keeps a
+ * free list per class; a thread that frees more than it allocates (a pool
+ * worker running tasks posted elsewhere) hands half its list to a shared
+ * depot, and a thread that runs dry refills from the depot before falling
+ * back to operator new. The depot mutex is taken once per batch, not per
+ * task.
+ *
+ * @see include/pacs/bridge/performance/small_task.h
+ */
+
+#include "pacs/bridge/performance/small_task.h"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace pacs::bridge::performance::detail {
+
+namespace {
+
+constexpr std::array<size_t, 4> size_classes = {128, 256, 512, 1024};
+constexpr size_t batch_size = 32;
+constexpr size_t local_limit = 2 * batch_size;
+constexpr size_t depot_limit = 4096;
+
+size_t class_of(size_t size, size_t alignment) noexcept {
+    if (alignment > alignof(std::max_align_t)) {
+        return size_classes.size();
+    }
+    for (size_t i = 0; i < size_classes.size(); ++i) {
+        if (size <= size_classes[i]) {
+            return i;
+        }
+    }
+    return size_classes.size();
+}
+
+struct free_block {
+    free_block* next;
+};
+
+class depot {
+public:
+    depot() {
+        for (auto& blocks : blocks_) {
+            blocks.reserve(depot_limit);
+        }
+    }
+
+    // Moves up to batch_size blocks into list; returns how many
+    size_t take(size_t cls, free_block*& list) {
+        std::lock_guard lock(mutex_);
+        auto& blocks = blocks_[cls];
+        size_t count = std::min(batch_size, blocks.size());
+        for (size_t i = 0; i < count; ++i) {
+            auto* block = static_cast<free_block*>(blocks.back());
+            blocks.pop_back();
+            block->next = list;
+            list = block;
+        }
+        return count;
+    }
+
+    // Takes count blocks from list; frees what the depot cannot hold
+    void give(size_t cls, free_block*& list, size_t count) {
+        std::lock_guard lock(mutex_);
+        auto& blocks = blocks_[cls];
+        for (size_t i = 0; i < count && list; ++i) {
+            free_block* block = list;
+            list = block->next;
+            if (blocks.size() < depot_limit) {
+                blocks.push_back(block);
+            } else {
+                ::operator delete(block);
+            }
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::array<std::vector<void*>, size_classes.size()> blocks_;
+};
+
+// Never destroyed: threads may exit after static destruction has begun
+depot& shared_depot() {
+    static depot* instance = new depot();
+    return *instance;
+}
+
+// Set once this thread's cache is destroyed; later frees on the thread
+// (from other thread_local destructors) bypass it
+thread_local bool cache_destroyed = false;
+
+class local_cache {
+public:
+    ~local_cache() {
+        cache_destroyed = true;
+        for (size_t cls = 0; cls < size_classes.size(); ++cls) {
+            shared_depot().give(cls, lists_[cls], counts_[cls]);
+        }
+    }
+
+    void* allocate(size_t cls) {
+        if (!lists_[cls]) {
+            counts_[cls] += shared_depot().take(cls, lists_[cls]);
+        }
+        if (free_block* block = lists_[cls]) {
+            lists_[cls] = block->next;
+            --counts_[cls];
+            return block;
+        }
+        return ::operator new(size_classes[cls]);
+    }
+
+    void deallocate(void* ptr, size_t cls) noexcept {
+        auto* block = static_cast<free_block*>(ptr);
+        block->next = lists_[cls];
+        lists_[cls] = block;
+        if (++counts_[cls] > local_limit) {
+            shared_depot().give(cls, lists_[cls], batch_size);
+            counts_[cls] -= batch_size;
+        }
+    }
+
+private:
+    std::array<free_block*, size_classes.size()> lists_{};
+    std::array<size_t, size_classes.size()> counts_{};
+};
+
+local_cache& thread_cache() {
+    thread_local local_cache cache;
+    return cache;
+}
+
+}  // namespace
+
+void* allocate_task_storage(size_t size, size_t alignment) {
+    size_t cls = class_of(size, alignment);
+    if (cls == size_classes.size()) {
+        return ::operator new(size, std::align_val_t{alignment});
+    }
+    if (cache_destroyed) {
+        return ::operator new(size_classes[cls]);
+    }
+    return thread_cache().allocate(cls);
+}
+
+void deallocate_task_storage(void* ptr, size_t size, size_t alignment) noexcept {
+    size_t cls = class_of(size, alignment);
+    if (cls == size_classes.size()) {
+        ::operator delete(ptr, std::align_val_t{alignment});
+        return;
+    }
+    if (cache_destroyed) {
+        ::operator delete(ptr);
+        return;
+    }
+    thread_cache().deallocate(ptr, cls);
+}
+
+}  // namespace pacs::bridge::performance::detail
@@ -1,38 +1,90 @@
 /**
  * @file thread_pool_manager.cpp
  * @brief Implementation of thread pool management with work-stealing
+ *
+ * Each worker owns one Chase-Lev deque per priority lane. Tasks posted from a
+ * worker thread go to that worker's deque; tasks posted from any other thread
+ * go to a bounded MPMC injection queue for their lane. A worker looks for work
+ * lane by lane, most urgent first: its own deque, then the injection queue.
+ * Only when both are empty in every lane does it steal from other workers,
+ * oldest task first.
+ *
+ * Idle workers park on an atomic wait (a futex on Linux). Posting wakes one
+ * parked worker, and costs no system call while every worker is busy.
  */
 
 #include "pacs/bridge/performance/thread_pool_manager.h"
+#include "pacs/bridge/performance/lockfree_queue.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <condition_variable>
-#include <deque>
 #include <mutex>
-#include <random>
+#include <optional>
 #include <thread>
 #include <vector>
 
 namespace pacs::bridge::performance {
 
+namespace {
+
+// One lane per task_priority value
+constexpr size_t lane_count = 5;
+
+// Capacity of each worker's deque per lane; a full deque spills into the
+// injection queue
+constexpr size_t local_capacity = 256;
+
+// Completions a worker accumulates before folding them into the statistics
+constexpr uint64_t stats_flush_interval = 64;
+
+// Rounds of polling before an idle worker parks
+constexpr int idle_spins = 16;
+
+}  // namespace
+
 // =============================================================================
 // Thread Pool Manager Implementation
 // =============================================================================
 
 struct thread_pool_manager::impl {
+    using task_deque = work_stealing_queue<task_fn>;
+    using task_queue = lockfree_queue<task_fn>;
+
+    struct worker {
+        size_t index = 0;
+        std::array<std::unique_ptr<task_deque>, lane_count> lanes;
+        std::thread thread;
+        uint32_t steal_seed = 0;
+
+        // Owner-only tallies, folded into stats by flush()
+        uint64_t completed = 0;
+        uint64_t duration_sum_us = 0;
+        uint64_t duration_peak_us = 0;
+    };
+
     thread_pool_config config;
     thread_pool_statistics stats;
 
-    std::vector<std::thread> workers;
-    std::vector<std::deque<std::pair<task_priority, task_fn>>> task_queues;
-    std::mutex queue_mutex;
-    std::condition_variable queue_cv;
+    std::vector<std::unique_ptr<worker>> workers;
+    std::array<std::unique_ptr<task_queue>, lane_count> injection;
+
     std::atomic<bool> running{false};
     std::atomic<bool> stopping{false};
+    std::atomic<bool> abandon{false};
 
-    // Per-thread random generators for work stealing
-    std::vector<std::mt19937> thread_rngs;
+    // Workers that have left worker_loop; stop() waits on it with a deadline
+    std::mutex exit_mutex;
+    std::condition_variable exit_cv;
+    size_t exited_workers = 0;
+
+    // Parking: idle workers wait for wake_epoch to change
+    std::atomic<uint32_t> wake_epoch{0};
+    std::atomic<size_t> sleepers{0};
+
+    static thread_local impl* current_pool;
+    static thread_local worker* current_worker;
 
     explicit impl(const thread_pool_config& cfg) : config(cfg) {
         // Determine actual max threads
@@ -47,6 +99,15 @@ struct thread_pool_manager::impl {
         if (config.min_threads > config.max_threads) {
             config.min_threads = config.max_threads;
         }
+
+        // queue_capacity is per thread; each lane can hold all of it
+        lockfree_queue_config queue_config;
+        queue_config.capacity =
+            std::max<size_t>(config.queue_capacity, 1) *
+            std::max<size_t>(config.min_threads, 1);
+        for (auto& lane : injection) {
+            lane = std::make_unique<task_queue>(queue_config);
+        }
     }
 
     ~impl() {
@@ -61,19 +122,27 @@ struct thread_pool_manager::impl {
         }
 
         stopping.store(false);
-
-        // Initialize per-thread queues and RNGs
-        task_queues.resize(config.min_threads);
-        thread_rngs.resize(config.min_threads);
-        std::random_device rd;
-        for (size_t i = 0; i < config.min_threads; ++i) {
-            thread_rngs[i].seed(rd());
+        abandon.store(false);
+        {
+            std::lock_guard<std::mutex> lock(exit_mutex);
+            exited_workers = 0;
         }
 
-        // Create worker threads
+        workers.clear();
         workers.reserve(config.min_threads);
         for (size_t i = 0; i < config.min_threads; ++i) {
-            workers.emplace_back([this, i] { worker_loop(i); });
+            auto w = std::make_unique<worker>();
+            w->index = i;
+            w->steal_seed = static_cast<uint32_t>(i * 2654435761u + 1);
+            for (auto& lane : w->lanes) {
+                lane = std::make_unique<task_deque>(local_capacity);
+            }
+            workers.push_back(std::move(w));
+        }
+
+        // Start only once every deque exists; workers steal from each other
+        for (auto& w : workers) {
+            w->thread = std::thread([this, w = w.get()] { worker_loop(*w); });
         }
 
         stats.total_threads.store(config.min_threads, std::memory_order_relaxed);
@@ -87,176 +156,269 @@ struct thread_pool_manager::impl {
             return std::unexpected(performance_error::not_initialized);
         }
 
+        if (!wait_for_tasks) {
+            abandon.store(true);
+        }
         stopping.store(true);
-        queue_cv.notify_all();
-
-        auto deadline = std::chrono::steady_clock::now() + timeout;
-
-        for (auto& worker : workers) {
-            if (worker.joinable()) {
-                if (wait_for_tasks) {
-                    // Wait with timeout
-                    auto remaining =
-                        deadline - std::chrono::steady_clock::now();
-                    if (remaining > std::chrono::milliseconds::zero()) {
-                        // Note: std::thread doesn't support timed join,
-                        // so we just join and hope for the best
-                        worker.join();
-                    } else {
-                        worker.detach();  // Timeout exceeded
-                    }
-                } else {
-                    worker.detach();
-                }
+        wake_all();
+
+        // Let the workers drain until the deadline without blocking in join()
+        bool drained;
+        {
+            std::unique_lock<std::mutex> lock(exit_mutex);
+            drained = exit_cv.wait_for(lock, timeout, [this] {
+                return exited_workers == workers.size();
+            });
+        }
+        if (!drained) {
+            // Timeout exceeded: remaining workers finish their current
+            // task and leave the rest queued for discard
+            abandon.store(true);
+            wake_all();
+        }
+
+        for (auto& w : workers) {
+            if (w->thread.joinable()) {
+                w->thread.join();
             }
         }
 
+        // Discard whatever was abandoned or posted while stopping
+        for (auto& lane : injection) {
+            while (lane->try_pop()) {
+            }
+        }
         workers.clear();
-        task_queues.clear();
+        stats.queued_tasks.store(0, std::memory_order_relaxed);
         running.store(false);
 
         return {};
     }
 
-    void worker_loop(size_t worker_id) {
+    // -------------------------------------------------------------------------
+    // Worker
+    // -------------------------------------------------------------------------
+
+    void worker_loop(worker& self) {
+        current_pool = this;
+        current_worker = &self;
         stats.active_threads.fetch_add(1, std::memory_order_relaxed);
 
-        while (!stopping.load(std::memory_order_acquire)) {
-            std::optional<task_fn> task;
+        while (!abandon.load(std::memory_order_acquire)) {
+            std::optional<task_fn> task = find_task(self);
+            for (int spin = 0; !task && spin < idle_spins; ++spin) {
+                std::this_thread::yield();
+                task = find_task(self);
+            }
 
-            {
-                std::unique_lock lock(queue_mutex);
+            if (task) {
+                run(self, *task);
+                continue;
+            }
 
-                // Check own queue first (by priority)
-                task = pop_from_queue(worker_id);
+            // Queues are empty; a stopping pool has drained
+            if (stopping.load(std::memory_order_acquire)) {
+                break;
+            }
+            if (auto found = park(self)) {
+                run(self, *found);
+            }
+        }
 
-                if (!task && config.enable_work_stealing) {
-                    // Try to steal from other queues
-                    task = try_steal(worker_id);
-                }
+        flush(self);
+        stats.active_threads.fetch_sub(1, std::memory_order_relaxed);
+        current_worker = nullptr;
+        current_pool = nullptr;
 
-                if (!task) {
-                    // Wait for new task
-                    stats.active_threads.fetch_sub(1, std::memory_order_relaxed);
-                    queue_cv.wait_for(lock, std::chrono::milliseconds{100},
-                                      [this, worker_id] {
-                                          return stopping.load() ||
-                                                 !task_queues[worker_id].empty();
-                                      });
-                    stats.active_threads.fetch_add(1, std::memory_order_relaxed);
-
-                    task = pop_from_queue(worker_id);
-                }
-            }
+        {
+            std::lock_guard<std::mutex> lock(exit_mutex);
+            ++exited_workers;
+        }
+        exit_cv.notify_all();
+    }
 
-            if (task) {
-                auto start = std::chrono::steady_clock::now();
+    std::optional<task_fn> find_task(worker& self) {
+        for (size_t lane = 0; lane < lane_count; ++lane) {
+            if (auto task = self.lanes[lane]->pop()) {
+                return task;
+            }
+            if (auto task = injection[lane]->try_pop()) {
+                return task;
+            }
+        }
+        if (config.enable_work_stealing) {
+            return try_steal(self);
+        }
+        return std::nullopt;
+    }
 
-                try {
-                    (*task)();
-                } catch (...) {
-                    // Swallow exceptions from tasks
+    std::optional<task_fn> try_steal(worker& self) {
+        const size_t count = workers.size();
+        if (count <= 1) return std::nullopt;
+
+        // xorshift32: a different victim order each time, without shared state
+        uint32_t x = self.steal_seed;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        self.steal_seed = x;
+
+        const size_t first = x % count;
+        for (size_t lane = 0; lane < lane_count; ++lane) {
+            for (size_t i = 0; i < count; ++i) {
+                auto& victim = *workers[(first + i) % count];
+                if (&victim == &self) continue;
+                if (auto task = victim.lanes[lane]->steal()) {
+                    stats.work_stolen.fetch_add(1, std::memory_order_relaxed);
+                    return task;
                 }
+            }
+        }
+        return std::nullopt;
+    }
 
-                auto end = std::chrono::steady_clock::now();
-                auto duration_us =
-                    std::chrono::duration_cast<std::chrono::microseconds>(
-                        end - start)
-                        .count();
-
-                stats.total_completed.fetch_add(1, std::memory_order_relaxed);
-
-                // Update average (simple moving average approximation)
-                auto current_avg =
-                    stats.avg_task_duration_us.load(std::memory_order_relaxed);
-                auto new_avg = (current_avg * 7 + duration_us) / 8;
-                stats.avg_task_duration_us.store(new_avg,
-                                                 std::memory_order_relaxed);
-
-                // Update peak
-                auto peak =
-                    stats.peak_task_duration_us.load(std::memory_order_relaxed);
-                while (static_cast<uint64_t>(duration_us) > peak &&
-                       !stats.peak_task_duration_us.compare_exchange_weak(
-                           peak, duration_us, std::memory_order_relaxed)) {
-                }
+    // Waits for a wakeup; returns a task found while announcing the park
+    std::optional<task_fn> park(worker& self) {
+        flush(self);
+
+        const uint32_t epoch = wake_epoch.load(std::memory_order_acquire);
+        sleepers.fetch_add(1, std::memory_order_seq_cst);
+        // Pairs with the fence in wake_one(): either the poster sees this
+        // sleeper, or the search below sees its task
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::optional<task_fn> task;
+        if (!stopping.load(std::memory_order_acquire)) {
+            task = find_task(self);
+            if (!task) {
+                stats.active_threads.fetch_sub(1, std::memory_order_relaxed);
+                wake_epoch.wait(epoch, std::memory_order_acquire);
+                stats.active_threads.fetch_add(1, std::memory_order_relaxed);
             }
         }
 
-        stats.active_threads.fetch_sub(1, std::memory_order_relaxed);
+        sleepers.fetch_sub(1, std::memory_order_relaxed);
+        return task;
     }
 
-    std::optional<task_fn> pop_from_queue(size_t worker_id) {
-        if (worker_id >= task_queues.size()) return std::nullopt;
+    void run(worker& self, task_fn& task) {
+        auto start = std::chrono::steady_clock::now();
 
-        auto& queue = task_queues[worker_id];
+        try {
+            task();
+        } catch (...) {
+            // Swallow exceptions from tasks
+        }
 
-        // Find highest priority task
-        auto it = std::min_element(
-            queue.begin(), queue.end(),
-            [](const auto& a, const auto& b) { return a.first < b.first; });
+        auto end = std::chrono::steady_clock::now();
+        auto duration_us = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+                .count());
 
-        if (it != queue.end()) {
-            auto task = std::move(it->second);
-            queue.erase(it);
-            stats.queued_tasks.fetch_sub(1, std::memory_order_relaxed);
-            return task;
+        ++self.completed;
+        self.duration_sum_us += duration_us;
+        self.duration_peak_us = std::max(self.duration_peak_us, duration_us);
+        if (self.completed >= stats_flush_interval) {
+            flush(self);
         }
-
-        return std::nullopt;
     }
 
-    std::optional<task_fn> try_steal(size_t worker_id) {
-        if (task_queues.size() <= 1) return std::nullopt;
-
-        // Random victim selection
-        std::uniform_int_distribution<size_t> dist(0, task_queues.size() - 2);
-        size_t victim = dist(thread_rngs[worker_id]);
-        if (victim >= worker_id) ++victim;  // Skip self
+    // Folds a worker's tallies into the shared statistics
+    void flush(worker& self) {
+        if (self.completed == 0) {
+            return;
+        }
 
-        if (!task_queues[victim].empty()) {
-            // Steal from back (least recently added)
-            auto task = std::move(task_queues[victim].back().second);
-            task_queues[victim].pop_back();
-            stats.queued_tasks.fetch_sub(1, std::memory_order_relaxed);
-            stats.work_stolen.fetch_add(1, std::memory_order_relaxed);
-            return task;
+        stats.total_completed.fetch_add(self.completed, std::memory_order_relaxed);
+        stats.queued_tasks.fetch_sub(self.completed, std::memory_order_relaxed);
+
+        // Update average (simple moving average approximation)
+        auto batch_avg = self.duration_sum_us / self.completed;
+        auto current_avg =
+            stats.avg_task_duration_us.load(std::memory_order_relaxed);
+        stats.avg_task_duration_us.store((current_avg * 7 + batch_avg) / 8,
+                                         std::memory_order_relaxed);
+
+        // Update peak
+        auto peak = stats.peak_task_duration_us.load(std::memory_order_relaxed);
+        while (self.duration_peak_us > peak &&
+               !stats.peak_task_duration_us.compare_exchange_weak(
+                   peak, self.duration_peak_us, std::memory_order_relaxed)) {
         }
 
-        return std::nullopt;
+        self.completed = 0;
+        self.duration_sum_us = 0;
+        self.duration_peak_us = 0;
     }
 
-    bool post(task_fn task, task_priority priority) {
-        if (!running.load() || stopping.load()) {
-            return false;
+    // -------------------------------------------------------------------------
+    // Wakeups
+    // -------------------------------------------------------------------------
+
+    void wake_one() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepers.load(std::memory_order_relaxed) > 0) {
+            wake_epoch.fetch_add(1, std::memory_order_release);
+            wake_epoch.notify_one();
         }
+    }
 
-        size_t total = stats.total_submitted.fetch_add(1, std::memory_order_relaxed);
+    void wake_all() {
+        wake_epoch.fetch_add(1, std::memory_order_seq_cst);
+        wake_epoch.notify_all();
+    }
 
-        // Round-robin to queues
-        size_t queue_id = total % task_queues.size();
+    // -------------------------------------------------------------------------
+    // Submission
+    // -------------------------------------------------------------------------
 
-        {
-            std::lock_guard lock(queue_mutex);
+    size_t lane_of(task_priority priority) const noexcept {
+        if (!config.enable_priority_scheduling) {
+            return static_cast<size_t>(task_priority::normal);
+        }
+        return std::min<size_t>(static_cast<size_t>(priority), lane_count - 1);
+    }
 
-            // Check queue capacity
-            if (task_queues[queue_id].size() >= config.queue_capacity) {
-                stats.total_rejected.fetch_add(1, std::memory_order_relaxed);
-                return false;
-            }
+    // Queues task without waking anyone; false if its lane is full
+    bool enqueue(task_fn& task, size_t lane) {
+        if (current_pool == this && current_worker &&
+            current_worker->lanes[lane]->push(std::move(task))) {
+            return true;
+        }
+        return injection[lane]->try_push(std::move(task));
+    }
 
-            task_queues[queue_id].emplace_back(priority, std::move(task));
+    // Counted before enqueueing, so a worker's flush never sees more tasks
+    // completed than queued
+    void record_submitted(size_t count) {
+        stats.total_submitted.fetch_add(count, std::memory_order_relaxed);
+        size_t queued =
+            stats.queued_tasks.fetch_add(count, std::memory_order_relaxed) +
+            count;
+        size_t peak = stats.peak_queued.load(std::memory_order_relaxed);
+        while (queued > peak &&
+               !stats.peak_queued.compare_exchange_weak(
+                   peak, queued, std::memory_order_relaxed)) {
+        }
+    }
 
-            size_t queued =
-                stats.queued_tasks.fetch_add(1, std::memory_order_relaxed) + 1;
-            size_t peak = stats.peak_queued.load(std::memory_order_relaxed);
-            while (queued > peak &&
-                   !stats.peak_queued.compare_exchange_weak(
-                       peak, queued, std::memory_order_relaxed)) {
-            }
+    void record_rejected(size_t count) {
+        stats.queued_tasks.fetch_sub(count, std::memory_order_relaxed);
+        stats.total_rejected.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    bool post(task_fn task, task_priority priority) {
+        if (!running.load(std::memory_order_acquire) ||
+            stopping.load(std::memory_order_acquire)) {
+            return false;
         }
 
-        queue_cv.notify_one();
+        record_submitted(1);
+        if (!enqueue(task, lane_of(priority))) {
+            record_rejected(1);
+            return false;
+        }
+        wake_one();
         return true;
     }
 
@@ -266,16 +428,36 @@ struct thread_pool_manager::impl {
     }
 
     size_t post_batch(std::span<task_fn> tasks, task_priority priority) {
+        if (!running.load(std::memory_order_acquire) ||
+            stopping.load(std::memory_order_acquire) || tasks.empty()) {
+            return 0;
+        }
+
+        const size_t lane = lane_of(priority);
+        record_submitted(tasks.size());
         size_t posted = 0;
         for (auto& task : tasks) {
-            if (post(std::move(task), priority)) {
+            if (enqueue(task, lane)) {
                 ++posted;
             }
         }
+        if (posted < tasks.size()) {
+            record_rejected(tasks.size() - posted);
+        }
+
+        // One wakeup per task, at most one per worker
+        for (size_t i = 0; i < std::min(posted, config.min_threads); ++i) {
+            wake_one();
+        }
         return posted;
     }
 };
 
+thread_local thread_pool_manager::impl* thread_pool_manager::impl::current_pool =
+    nullptr;
+thread_local thread_pool_manager::impl::worker*
+    thread_pool_manager::impl::current_worker = nullptr;
+
 thread_pool_manager::thread_pool_manager(const thread_pool_config& config)
     : impl_(std::make_unique<impl>(config)) {}
 
@@ -5,6 +5,8 @@
 
 #include "pacs/bridge/performance/zero_copy_parser.h"
 
+#include "pacs/bridge/performance/delimiter_scanner.h"
+
 #include <algorithm>
 #include <chrono>
 #include <unordered_map>
@@ -223,16 +225,15 @@ struct zero_copy_parser::impl {
         segment_data.reserve(config.segment_index_capacity);
         segment_index.clear();
 
-        // HL7 uses \r as segment delimiter, but also handle \n and \r\n
-        size_t seg_start = 0;
-        while (seg_start < data.size()) {
-            size_t seg_end = seg_start;
+        // HL7 uses \r as segment delimiter, but also handle \n and \r\n.
+        // Terminators are located with one vector scan so large segments
+        // (e.g. base64 OBX-5 payloads) are skipped without a byte loop.
+        const auto terminators = delimiter_index::scan(data, {'\r', '\n'});
 
-            // Find end of segment
-            while (seg_end < data.size() && data[seg_end] != '\r' &&
-                   data[seg_end] != '\n') {
-                ++seg_end;
-            }
+        size_t seg_start = 0;
+        for (size_t k = 0; k <= terminators.size(); ++k) {
+            const size_t seg_end =
+                k < terminators.size() ? terminators[k] : data.size();
 
             if (seg_end > seg_start) {
                 auto segment = data.substr(seg_start, seg_end - seg_start);
@@ -243,12 +244,7 @@ struct zero_copy_parser::impl {
                 }
             }
 
-            // Skip delimiters
-            seg_start = seg_end;
-            while (seg_start < data.size() &&
-                   (data[seg_start] == '\r' || data[seg_start] == '\n')) {
-                ++seg_start;
-            }
+            seg_start = seg_end + 1;
         }
 
         parsed = true;
@@ -32,12 +32,13 @@ public:
     // Message Handling
     // =========================================================================
 
-    Result<adt_result> handle(const hl7_message& message) {
+    template <typename Message>
+    Result<adt_result> handle(const Message& message) {
         std::lock_guard<std::mutex> lock(mutex_);
 
         // Record message received metric
         auto& metrics = monitoring::bridge_metrics_collector::instance();
-        metrics.record_hl7_message_received("ADT");
+        metrics_.received.increment();
 
         // Start processing timer
         auto start_time = std::chrono::high_resolution_clock::now();
@@ -87,13 +88,13 @@ public:
         auto end_time = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
             end_time - start_time);
-        metrics.record_hl7_processing_duration("ADT", duration);
+        metrics_.processing_duration.record(duration);
 
         // Update statistics based on result
         if (result.is_ok()) {
             stats_.success_count++;
             // Record ACK sent
-            metrics.record_hl7_message_sent("ADT_ACK");
+            ack_sent_.increment();
         } else {
             stats_.failure_count++;
             metrics.record_hl7_error("ADT", "processing_failed");
@@ -102,7 +103,8 @@ public:
         return result;
     }
 
-    bool can_handle(const hl7_message& message) const noexcept {
+    template <typename Message>
+    bool can_handle(const Message& message) const noexcept {
         auto header = message.header();
         if (header.type != message_type::ADT) {
             return false;
@@ -120,20 +122,23 @@ public:
     // Individual Event Handlers
     // =========================================================================
 
+    template <typename Message>
     Result<adt_result> handle_admit_impl(
-        const hl7_message& message) {
+        const Message& message) {
         return create_or_update_patient(message, adt_trigger_event::A01,
                                          config_.allow_a01_update);
     }
 
+    template <typename Message>
     Result<adt_result> handle_register_impl(
-        const hl7_message& message) {
+        const Message& message) {
         // A04 always creates (for outpatient registration)
         return create_or_update_patient(message, adt_trigger_event::A04, true);
     }
 
+    template <typename Message>
     Result<adt_result> handle_update_impl(
-        const hl7_message& message) {
+        const Message& message) {
         // Extract patient data
         auto patient_result = mapper_.to_patient(message);
         if (patient_result.is_err()) {
@@ -146,7 +151,7 @@ public:
         }
 
         // Check if patient exists
-        auto existing = cache_->get(patient.patient_id);
+        auto existing = cache_->get_shared(patient.patient_id);
         if (!existing) {
             if (config_.allow_a08_create) {
                 // Create if configured to allow
@@ -156,11 +161,12 @@ public:
         }
 
         // Update patient
-        return update_patient(message, *existing, patient);
+        return update_patient(message, **existing, patient);
     }
 
+    template <typename Message>
     Result<adt_result> handle_merge_impl(
-        const hl7_message& message) {
+        const Message& message) {
         // Extract merge information from MRG segment
         auto merge_info_opt = extract_merge_info(message);
         if (!merge_info_opt) {
@@ -216,8 +222,9 @@ public:
     // Helper Methods
     // =========================================================================
 
+    template <typename Message>
     Result<adt_result> create_or_update_patient(
-        const hl7_message& message, adt_trigger_event trigger,
+        const Message& message, adt_trigger_event trigger,
         bool allow_update) {
         // Extract patient data
         auto patient_result = mapper_.to_patient(message);
@@ -239,10 +246,10 @@ public:
         }
 
         // Check if patient exists
-        auto existing = cache_->get(patient.patient_id);
+        auto existing = cache_->get_shared(patient.patient_id);
         if (existing) {
             if (allow_update) {
-                return update_patient(message, *existing, patient);
+                return update_patient(message, **existing, patient);
             }
             return to_error_info(adt_error::duplicate_patient);
         }
@@ -250,8 +257,9 @@ public:
         return create_patient(message, patient, trigger);
     }
 
+    template <typename Message>
     Result<adt_result> create_patient(
-        const hl7_message& message, const mapping::dicom_patient& patient,
+        const Message& message, const mapping::dicom_patient& patient,
         adt_trigger_event trigger) {
         // Add to cache
         cache_->put(patient.patient_id, patient);
@@ -282,8 +290,9 @@ public:
         return result;
     }
 
+    template <typename Message>
     Result<adt_result> update_patient(
-        const hl7_message& message, const mapping::dicom_patient& old_patient,
+        const Message& message, const mapping::dicom_patient& old_patient,
         const mapping::dicom_patient& new_patient) {
         // Update in cache
         cache_->put(new_patient.patient_id, new_patient);
@@ -322,10 +331,11 @@ public:
         return result;
     }
 
+    template <typename Message>
     std::optional<merge_info> extract_merge_info(
-        const hl7_message& message) const {
+        const Message& message) const {
         // Get MRG segment
-        auto* mrg = message.segment("MRG");
+        auto mrg = message.segment("MRG");
         if (!mrg) {
             return std::nullopt;
         }
@@ -345,7 +355,7 @@ public:
         }
 
         // Primary patient ID comes from PID-3
-        auto* pid = message.segment("PID");
+        auto pid = message.segment("PID");
         if (pid) {
             info.primary_patient_id = std::string(pid->field_value(3));
             const auto& pid3 = pid->field(3);
@@ -355,7 +365,7 @@ public:
         }
 
         // Get merge datetime from EVN-2 if available
-        auto* evn = message.segment("EVN");
+        auto evn = message.segment("EVN");
         if (evn) {
             info.merge_datetime = std::string(evn->field_value(2));
         }
@@ -383,7 +393,8 @@ public:
         return errors;
     }
 
-    hl7_message create_ack(const hl7_message& original, ack_code code,
+    template <typename Message>
+    hl7_message create_ack(const Message& original, ack_code code,
                            std::string_view text) const {
         if (config_.detailed_ack) {
             return original.create_ack(code, text);
@@ -444,6 +455,12 @@ private:
 
     mutable std::mutex mutex_;
     statistics stats_;
+
+    // Metric handles, resolved once per handler
+    monitoring::hl7_message_metrics metrics_ =
+        monitoring::bridge_metrics_collector::instance().hl7_metrics("ADT");
+    monitoring::counter_handle ack_sent_ =
+        monitoring::bridge_metrics_collector::instance().hl7_metrics("ADT_ACK").sent;
 };
 
 // =============================================================================
@@ -467,10 +484,20 @@ Result<adt_result> adt_handler::handle(
     return pimpl_->handle(message);
 }
 
+Result<adt_result> adt_handler::handle(
+    const hl7_flat_message& message) {
+    return pimpl_->handle(message);
+}
+
 bool adt_handler::can_handle_impl(const hl7_message& message) const noexcept {
     return pimpl_->can_handle(message);
 }
 
+bool adt_handler::can_handle_impl(
+    const hl7_flat_message& message) const noexcept {
+    return pimpl_->can_handle(message);
+}
+
 std::vector<std::string> adt_handler::supported_triggers() const {
     return pimpl_->supported_triggers();
 }
@@ -0,0 +1,1073 @@
+/**
+ * @file hl7_flat_message.cpp
+ * @brief Arena-backed flat HL7 message implementation
+ */
+
+#include "pacs/bridge/protocol/hl7/hl7_flat_message.h"
+
+#include "pacs/bridge/performance/delimiter_scanner.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace pacs::bridge::hl7 {
+
+using detail::flat_node;
+
+namespace {
+
+// =============================================================================
+// Path Parsing
+// =============================================================================
+
+/**
+ * @brief Parsed "SEG[n].f.c.s" path; absent indices are 0
+ */
+struct parsed_path {
+    std::string_view segment_id;
+    size_t occurrence = 0;
+    size_t field = 0;
+    size_t component = 0;
+    size_t subcomponent = 0;
+    bool has_component = false;
+    bool has_subcomponent = false;
+};
+
+/**
+ * @brief Parse a leading decimal index; mirrors hl7_segment::get_value()
+ */
+bool parse_index(std::string_view text, size_t& out) {
+    auto result = std::from_chars(text.data(), text.data() + text.size(), out);
+    return result.ec == std::errc{};
+}
+
+/**
+ * @brief Parse the field part of a path ("f[.c[.s]]")
+ */
+bool parse_field_path(std::string_view path, parsed_path& out) {
+    size_t dot1 = path.find('.');
+    if (!parse_index(path.substr(0, dot1), out.field)) {
+        return false;
+    }
+    if (dot1 == std::string_view::npos) {
+        return true;
+    }
+
+    path = path.substr(dot1 + 1);
+    size_t dot2 = path.find('.');
+    if (!parse_index(path.substr(0, dot2), out.component)) {
+        return false;
+    }
+    out.has_component = true;
+    if (dot2 == std::string_view::npos) {
+        return true;
+    }
+
+    if (!parse_index(path.substr(dot2 + 1), out.subcomponent)) {
+        return false;
+    }
+    out.has_subcomponent = true;
+    return true;
+}
+
+/**
+ * @brief Parse a full message path ("SEG[n].f[.c[.s]]")
+ */
+bool parse_message_path(std::string_view path, parsed_path& out) {
+    size_t dot1 = path.find('.');
+    if (dot1 == std::string_view::npos) {
+        return false;
+    }
+
+    std::string_view seg_part = path.substr(0, dot1);
+    size_t bracket = seg_part.find('[');
+    if (bracket != std::string_view::npos) {
+        out.segment_id = seg_part.substr(0, bracket);
+        size_t end_bracket = seg_part.find(']', bracket);
+        if (end_bracket != std::string_view::npos) {
+            std::from_chars(seg_part.data() + bracket + 1,
+                            seg_part.data() + end_bracket, out.occurrence);
+        }
+    } else {
+        out.segment_id = seg_part;
+    }
+
+    return parse_field_path(path.substr(dot1 + 1), out);
+}
+
+// =============================================================================
+// Tokenizer
+// =============================================================================
+
+/**
+ * @brief Upper bounds on node counts per level, from one counting pass
+ */
+struct node_budget {
+    size_t segments = 1;
+    size_t fields = 0;
+    size_t repetitions = 0;
+    size_t components = 0;
+    size_t subcomponents = 0;
+};
+
+/** Delimiter offsets consumed per scanner call (stack buffer) */
+constexpr size_t scan_chunk = 256;
+
+/**
+ * @brief Terminators and separators located by the vector scanner
+ */
+performance::delimiter_set tokenizer_delimiters(const hl7_encoding_characters& enc) {
+    return {HL7_SEGMENT_TERMINATOR, HL7_LINE_FEED, enc.field_separator,
+            enc.component_separator, enc.repetition_separator,
+            enc.subcomponent_separator};
+}
+
+node_budget count_delimiters(std::string_view data,
+                             const hl7_encoding_characters& enc) {
+    size_t terminators = 0;
+    size_t field_seps = 0;
+    size_t rep_seps = 0;
+    size_t comp_seps = 0;
+    size_t sub_seps = 0;
+
+    performance::delimiter_scanner scanner(data, tokenizer_delimiters(enc));
+    std::array<uint32_t, scan_chunk> chunk;
+    while (const size_t n = scanner.next(chunk)) {
+        for (size_t i = 0; i < n; ++i) {
+            const char c = data[chunk[i]];
+            if (c == HL7_SEGMENT_TERMINATOR || c == HL7_LINE_FEED) {
+                ++terminators;
+            } else if (c == enc.field_separator) {
+                ++field_seps;
+            } else if (c == enc.component_separator) {
+                ++comp_seps;
+            } else if (c == enc.repetition_separator) {
+                ++rep_seps;
+            } else if (c == enc.subcomponent_separator) {
+                ++sub_seps;
+            }
+        }
+    }
+
+    // Every segment contributes at most one more field than it has field
+    // separators, every field one more repetition than it has repetition
+    // separators, and so on down the hierarchy.
+    node_budget budget;
+    budget.segments = terminators + 1;
+    budget.fields = field_seps + budget.segments;
+    budget.repetitions = budget.fields + rep_seps;
+    budget.components = budget.repetitions + comp_seps;
+    budget.subcomponents = budget.components + sub_seps;
+    return budget;
+}
+
+/**
+ * @brief Single-pass builder that appends nodes to the partitioned arena
+ *
+ * Nodes are appended depth-first, so the children of any node occupy a
+ * contiguous run of the next level's table.
+ */
+class flat_builder {
+public:
+    flat_builder(flat_node* segments, flat_node* fields, flat_node* reps,
+                 flat_node* comps, flat_node* subs,
+                 const hl7_encoding_characters& enc)
+        : segments_(segments),
+          fields_(fields),
+          reps_(reps),
+          comps_(comps),
+          subs_(subs),
+          enc_(enc) {}
+
+    [[nodiscard]] uint32_t segment_count() const noexcept { return seg_n_; }
+
+    /**
+     * @brief Start the segment beginning at offset begin
+     *
+     * Only the segment ID and, for MSH, the MSH-1/MSH-2 bytes are examined
+     * here; the rest of the segment is tokenized by separator().
+     */
+    void begin_segment(std::string_view data, uint32_t begin) {
+        data_ = data;
+        seg_begin_ = begin;
+        mark_ = {seg_n_, field_n_, rep_n_, comp_n_, sub_n_};
+        fields_from_ = no_fields;
+        msh2_offset_ = no_fields;
+
+        flat_node& seg = segments_[seg_n_++];
+        seg.offset = begin;
+        seg.length = 0;
+        seg.first_child = field_n_;
+        seg.child_count = 0;
+
+        for (uint32_t i = 0; i < 4; ++i) {
+            if (at_line_end(begin + i)) {
+                return;  // Too short; end_segment() reports the error
+            }
+        }
+        if (data[begin + 3] != enc_.field_separator) {
+            return;
+        }
+
+        if (data.compare(begin, 3, "MSH") == 0) {
+            // MSH-1 (the field separator itself)
+            add_literal_field(begin + 3, 1);
+
+            // MSH-2 (encoding characters) is kept verbatim
+            uint32_t msh2_end = begin + 4;
+            while (!at_line_end(msh2_end) &&
+                   data[msh2_end] != enc_.field_separator) {
+                ++msh2_end;
+            }
+            msh2_offset_ = begin + 4;
+            add_literal_field(msh2_offset_, msh2_end - msh2_offset_);
+
+            if (!at_line_end(msh2_end)) {
+                fields_from_ = msh2_end + 1;
+            }
+        } else {
+            fields_from_ = begin + 4;
+        }
+
+        if (fields_from_ != no_fields) {
+            open_field(fields_from_);
+        }
+    }
+
+    /**
+     * @brief Feed a separator at pos inside the current segment
+     */
+    void separator(uint32_t pos, char c) {
+        if (fields_from_ == no_fields || pos < fields_from_) {
+            return;
+        }
+        if (c == ' ' && in_trailing_space(pos)) {
+            return;  // Trimmed by end_segment()
+        }
+
+        if (c == enc_.field_separator) {
+            close_field(pos);
+            open_field(pos + 1);
+        } else if (c == enc_.component_separator) {
+            close_sub(pos);
+            close_comp(pos);
+            open_comp(pos + 1);
+        } else if (c == enc_.repetition_separator) {
+            close_sub(pos);
+            close_comp(pos);
+            close_rep(pos);
+            open_rep(pos + 1);
+        } else if (c == enc_.subcomponent_separator) {
+            close_sub(pos);
+            open_sub(pos + 1);
+        }
+    }
+
+    /**
+     * @brief Finish the current segment at the line terminator pos
+     *
+     * Trailing whitespace is trimmed exactly as hl7_message::parse does;
+     * segments that are empty after trimming are discarded.
+     */
+    [[nodiscard]] std::expected<void, hl7_error> end_segment(uint32_t pos) {
+        uint32_t end = pos;
+        while (end > seg_begin_ && (data_[end - 1] == '\r' ||
+                                    data_[end - 1] == '\n' ||
+                                    data_[end - 1] == ' ')) {
+            --end;
+        }
+
+        if (end == seg_begin_) {
+            seg_n_ = mark_.segments;
+            field_n_ = mark_.fields;
+            rep_n_ = mark_.repetitions;
+            comp_n_ = mark_.components;
+            sub_n_ = mark_.subcomponents;
+            return {};
+        }
+
+        if (end - seg_begin_ < 3) {
+            return std::unexpected(hl7_error::invalid_segment);
+        }
+
+        flat_node& seg = segments_[seg_n_ - 1];
+        seg.length = end - seg_begin_;
+
+        if (data_.compare(seg_begin_, 3, "MSH") == 0) {
+            if (end - seg_begin_ < 4 ||
+                data_[seg_begin_ + 3] != enc_.field_separator) {
+                return std::unexpected(hl7_error::invalid_msh);
+            }
+            if (fields_from_ == no_fields && msh2_offset_ + fields_[field_n_ - 1].length > end) {
+                // MSH-2 ran into trailing whitespace; rebuild it trimmed
+                field_n_--;
+                rep_n_ = fields_[field_n_].first_child;
+                if (fields_[field_n_].child_count != 0) {
+                    comp_n_ = reps_[rep_n_].first_child;
+                    sub_n_ = comps_[comp_n_].first_child;
+                }
+                add_literal_field(msh2_offset_, end - msh2_offset_);
+            }
+        }
+
+        if (fields_from_ != no_fields) {
+            close_field(end);
+        }
+
+        seg.child_count = field_n_ - seg.first_child;
+        return {};
+    }
+
+    [[nodiscard]] uint32_t field_count() const noexcept { return field_n_; }
+    [[nodiscard]] uint32_t repetition_count() const noexcept { return rep_n_; }
+    [[nodiscard]] uint32_t component_count() const noexcept { return comp_n_; }
+    [[nodiscard]] uint32_t subcomponent_count() const noexcept { return sub_n_; }
+
+private:
+    static constexpr uint32_t no_fields = UINT32_MAX;
+
+    /**
+     * @brief Node counts at the start of the current segment
+     */
+    struct node_mark {
+        uint32_t segments = 0;
+        uint32_t fields = 0;
+        uint32_t repetitions = 0;
+        uint32_t components = 0;
+        uint32_t subcomponents = 0;
+    };
+
+    [[nodiscard]] bool at_line_end(uint32_t pos) const noexcept {
+        return pos >= data_.size() || data_[pos] == HL7_SEGMENT_TERMINATOR ||
+               data_[pos] == HL7_LINE_FEED;
+    }
+
+    /**
+     * @brief Check if pos lies in the whitespace run before the line end
+     *
+     * Only reached when a separator is a space. Results are remembered so
+     * each byte is examined at most once.
+     */
+    [[nodiscard]] bool in_trailing_space(uint32_t pos) {
+        if (pos < space_checked_until_) {
+            return pos >= trailing_space_from_;
+        }
+        uint32_t q = pos;
+        while (!at_line_end(q) && data_[q] == ' ') {
+            ++q;
+        }
+        space_checked_until_ = q;
+        trailing_space_from_ = at_line_end(q) ? pos : q;
+        return at_line_end(q);
+    }
+
+    /**
+     * @brief Add a field with a single rep/component/subcomponent spanning
+     *        the given bytes (used for MSH-1 and MSH-2)
+     */
+    void add_literal_field(uint32_t offset, uint32_t length) {
+        if (length == 0) {
+            fields_[field_n_++] = {offset, 0, rep_n_, 0};
+            return;
+        }
+        subs_[sub_n_] = {offset, length, 0, 0};
+        comps_[comp_n_] = {offset, length, sub_n_++, 1};
+        reps_[rep_n_] = {offset, length, comp_n_++, 1};
+        fields_[field_n_++] = {offset, length, rep_n_++, 1};
+    }
+
+    void open_sub(uint32_t at) { subs_[sub_n_] = {at, 0, 0, 0}; }
+
+    void close_sub(uint32_t at) {
+        subs_[sub_n_].length = at - subs_[sub_n_].offset;
+        ++sub_n_;
+    }
+
+    void open_comp(uint32_t at) {
+        comps_[comp_n_] = {at, 0, sub_n_, 0};
+        open_sub(at);
+    }
+
+    void close_comp(uint32_t at) {
+        flat_node& comp = comps_[comp_n_];
+        comp.length = at - comp.offset;
+        if (comp.length == 0) {
+            // Discard the single empty subcomponent
+            sub_n_ = comp.first_child;
+        }
+        comp.child_count = sub_n_ - comp.first_child;
+        ++comp_n_;
+    }
+
+    void open_rep(uint32_t at) {
+        reps_[rep_n_] = {at, 0, comp_n_, 0};
+        open_comp(at);
+    }
+
+    void close_rep(uint32_t at) {
+        flat_node& rep = reps_[rep_n_];
+        rep.length = at - rep.offset;
+        rep.child_count = comp_n_ - rep.first_child;
+        ++rep_n_;
+    }
+
+    void open_field(uint32_t at) {
+        fields_[field_n_] = {at, 0, rep_n_, 0};
+        open_rep(at);
+    }
+
+    void close_field(uint32_t at) {
+        close_sub(at);
+        close_comp(at);
+        close_rep(at);
+
+        flat_node& field = fields_[field_n_];
+        field.length = at - field.offset;
+        if (field.length == 0) {
+            // Discard the single empty repetition and its empty component
+            comp_n_ = reps_[field.first_child].first_child;
+            rep_n_ = field.first_child;
+        }
+        field.child_count = rep_n_ - field.first_child;
+        ++field_n_;
+    }
+
+    flat_node* segments_;
+    flat_node* fields_;
+    flat_node* reps_;
+    flat_node* comps_;
+    flat_node* subs_;
+    const hl7_encoding_characters& enc_;
+
+    uint32_t seg_n_ = 0;
+    uint32_t field_n_ = 0;
+    uint32_t rep_n_ = 0;
+    uint32_t comp_n_ = 0;
+    uint32_t sub_n_ = 0;
+
+    // Current segment
+    std::string_view data_;
+    uint32_t seg_begin_ = 0;
+    uint32_t fields_from_ = no_fields;
+    uint32_t msh2_offset_ = no_fields;
+    node_mark mark_;
+
+    // Memo for in_trailing_space()
+    uint32_t space_checked_until_ = 0;
+    uint32_t trailing_space_from_ = 0;
+};
+
+}  // namespace
+
+// =============================================================================
+// hl7_component_view
+// =============================================================================
+
+size_t hl7_component_view::subcomponent_count() const noexcept {
+    if (!owner_) return 0;
+    const auto* comp =
+        owner_->component_node(segment_, field_, repetition_, component_);
+    return comp ? comp->child_count : 0;
+}
+
+std::string_view hl7_component_view::subcomponent(size_t index) const noexcept {
+    if (!owner_) return {};
+    return owner_->resolve(segment_, field_, repetition_, component_, index);
+}
+
+std::string_view hl7_component_view::raw() const noexcept {
+    if (!owner_) return {};
+    const auto* comp =
+        owner_->component_node(segment_, field_, repetition_, component_);
+    return comp ? owner_->slice(*comp) : std::string_view{};
+}
+
+// =============================================================================
+// hl7_field_view
+// =============================================================================
+
+size_t hl7_field_view::repetition_count() const noexcept {
+    if (!owner_) return 0;
+    const auto* field = owner_->field_node(segment_, field_);
+    return field ? field->child_count : 0;
+}
+
+size_t hl7_field_view::component_count() const noexcept {
+    if (!owner_) return 0;
+    const auto* rep = owner_->repetition_node(segment_, field_, 1);
+    return rep ? rep->child_count : 0;
+}
+
+bool hl7_field_view::empty() const noexcept {
+    if (!owner_) return true;
+    if (owner_->is_modified() && !value().empty()) {
+        return false;
+    }
+    // A field made only of separators ("^^~") has no data, as in hl7_field
+    const auto& enc = owner_->encoding();
+    return std::ranges::all_of(raw(), [&enc](char c) {
+        return c == enc.component_separator || c == enc.repetition_separator ||
+               c == enc.subcomponent_separator;
+    });
+}
+
+hl7_component_view hl7_field_view::component(size_t rep_index,
+                                             size_t comp_index) const noexcept {
+    if (!owner_) return {};
+    return hl7_component_view(owner_, segment_, field_,
+                              static_cast<uint32_t>(rep_index),
+                              static_cast<uint32_t>(comp_index));
+}
+
+std::string_view hl7_field_view::raw() const noexcept {
+    if (!owner_) return {};
+    const auto* field = owner_->field_node(segment_, field_);
+    return field ? owner_->slice(*field) : std::string_view{};
+}
+
+// =============================================================================
+// hl7_segment_view
+// =============================================================================
+
+std::string_view hl7_segment_view::segment_id() const noexcept {
+    if (!owner_) return {};
+    return raw().substr(0, 3);
+}
+
+size_t hl7_segment_view::field_count() const noexcept {
+    if (!owner_) return 0;
+    const auto* seg = owner_->segment_node(segment_);
+    return seg ? seg->child_count : 0;
+}
+
+hl7_field_view hl7_segment_view::field(size_t index) const noexcept {
+    if (!owner_) return {};
+    return hl7_field_view(owner_, segment_, static_cast<uint32_t>(index));
+}
+
+std::string_view hl7_segment_view::get_value(std::string_view path) const noexcept {
+    if (!owner_) return {};
+
+    parsed_path parsed;
+    if (!parse_field_path(path, parsed)) {
+        return {};
+    }
+    return owner_->resolve(segment_, parsed.field, 1,
+                           parsed.has_component ? parsed.component : 1,
+                           parsed.has_subcomponent ? parsed.subcomponent : 1);
+}
+
+std::string_view hl7_segment_view::raw() const noexcept {
+    if (!owner_) return {};
+    const auto* seg = owner_->segment_node(segment_);
+    return seg ? owner_->slice(*seg) : std::string_view{};
+}
+
+// =============================================================================
+// hl7_flat_message - Construction
+// =============================================================================
+
+hl7_flat_message::hl7_flat_message(const hl7_flat_message& other)
+    : borrowed_(other.borrowed_),
+      storage_(other.storage_),
+      buffer_(borrowed_ ? other.buffer_ : std::string_view(storage_)),
+      encoding_(other.encoding_),
+      arena_size_(other.arena_size_),
+      field_base_(other.field_base_),
+      repetition_base_(other.repetition_base_),
+      component_base_(other.component_base_),
+      subcomponent_base_(other.subcomponent_base_),
+      segment_count_(other.segment_count_),
+      overlay_(other.overlay_) {
+    if (other.arena_) {
+        arena_ = std::make_unique_for_overwrite<flat_node[]>(arena_size_);
+        std::copy_n(other.arena_.get(), arena_size_, arena_.get());
+    }
+}
+
+hl7_flat_message::hl7_flat_message(hl7_flat_message&& other) noexcept
+    : borrowed_(other.borrowed_),
+      storage_(std::move(other.storage_)),
+      buffer_(borrowed_ ? other.buffer_ : std::string_view(storage_)),
+      encoding_(other.encoding_),
+      arena_(std::move(other.arena_)),
+      arena_size_(std::exchange(other.arena_size_, 0)),
+      field_base_(other.field_base_),
+      repetition_base_(other.repetition_base_),
+      component_base_(other.component_base_),
+      subcomponent_base_(other.subcomponent_base_),
+      segment_count_(std::exchange(other.segment_count_, 0)),
+      overlay_(std::move(other.overlay_)) {
+    other.buffer_ = {};
+}
+
+hl7_flat_message& hl7_flat_message::operator=(const hl7_flat_message& other) {
+    if (this != &other) {
+        *this = hl7_flat_message(other);
+    }
+    return *this;
+}
+
+hl7_flat_message& hl7_flat_message::operator=(hl7_flat_message&& other) noexcept {
+    if (this != &other) {
+        borrowed_ = other.borrowed_;
+        storage_ = std::move(other.storage_);
+        buffer_ = borrowed_ ? other.buffer_ : std::string_view(storage_);
+        other.buffer_ = {};
+        encoding_ = other.encoding_;
+        arena_ = std::move(other.arena_);
+        arena_size_ = std::exchange(other.arena_size_, 0);
+        field_base_ = other.field_base_;
+        repetition_base_ = other.repetition_base_;
+        component_base_ = other.component_base_;
+        subcomponent_base_ = other.subcomponent_base_;
+        segment_count_ = std::exchange(other.segment_count_, 0);
+        overlay_ = std::move(other.overlay_);
+    }
+    return *this;
+}
+
+// =============================================================================
+// hl7_flat_message - Parsing
+// =============================================================================
+
+std::expected<hl7_flat_message, hl7_error> hl7_flat_message::parse(
+    std::string_view data) {
+    // Validate before copying so oversized input is never duplicated
+    if (data.length() > HL7_MAX_MESSAGE_SIZE) {
+        return std::unexpected(hl7_error::message_too_large);
+    }
+    return parse_owned(std::string(data));
+}
+
+std::expected<hl7_flat_message, hl7_error> hl7_flat_message::parse_owned(
+    std::string data) {
+    hl7_flat_message msg;
+    msg.storage_ = std::move(data);
+    msg.buffer_ = msg.storage_;
+    return index(std::move(msg));
+}
+
+std::expected<hl7_flat_message, hl7_error> hl7_flat_message::parse_borrowed(
+    std::string_view data) {
+    hl7_flat_message msg;
+    msg.borrowed_ = true;
+    msg.buffer_ = data;
+    return index(std::move(msg));
+}
+
+std::expected<hl7_flat_message, hl7_error> hl7_flat_message::index(
+    hl7_flat_message msg) {
+    if (msg.buffer_.length() < 8) {
+        return std::unexpected(hl7_error::empty_message);
+    }
+    if (msg.buffer_.compare(0, 3, "MSH") != 0) {
+        return std::unexpected(hl7_error::missing_msh);
+    }
+    if (msg.buffer_.length() > HL7_MAX_MESSAGE_SIZE) {
+        return std::unexpected(hl7_error::message_too_large);
+    }
+
+    msg.encoding_ =
+        hl7_encoding_characters::from_msh2(msg.buffer_.substr(4, 4));
+    msg.encoding_.field_separator = msg.buffer_[3];
+
+    const std::string_view view = msg.buffer_;
+
+    // Size the arena exactly once from a counting pass
+    const node_budget budget = count_delimiters(view, msg.encoding_);
+    msg.arena_size_ = budget.segments + budget.fields + budget.repetitions +
+                      budget.components + budget.subcomponents;
+    msg.arena_ = std::make_unique_for_overwrite<flat_node[]>(msg.arena_size_);
+
+    msg.field_base_ = static_cast<uint32_t>(budget.segments);
+    msg.repetition_base_ = static_cast<uint32_t>(msg.field_base_ + budget.fields);
+    msg.component_base_ =
+        static_cast<uint32_t>(msg.repetition_base_ + budget.repetitions);
+    msg.subcomponent_base_ =
+        static_cast<uint32_t>(msg.component_base_ + budget.components);
+
+    flat_node* base = msg.arena_.get();
+    flat_builder builder(base, base + msg.field_base_, base + msg.repetition_base_,
+                         base + msg.component_base_, base + msg.subcomponent_base_,
+                         msg.encoding_);
+
+    // Both passes stream delimiter offsets from the vector scanner through a
+    // stack buffer, so tokenizing adds no allocation and payload bytes
+    // between delimiters are never visited individually
+    performance::delimiter_scanner scanner(view, tokenizer_delimiters(msg.encoding_));
+    std::array<uint32_t, scan_chunk> chunk;
+
+    builder.begin_segment(view, 0);
+    while (const size_t n = scanner.next(chunk)) {
+        for (size_t i = 0; i < n; ++i) {
+            const uint32_t pos = chunk[i];
+            const char c = view[pos];
+            if (c != HL7_SEGMENT_TERMINATOR && c != HL7_LINE_FEED) {
+                builder.separator(pos, c);
+                continue;
+            }
+            if (auto result = builder.end_segment(pos); !result) {
+                return std::unexpected(result.error());
+            }
+            builder.begin_segment(view, pos + 1);
+        }
+    }
+    if (auto result = builder.end_segment(static_cast<uint32_t>(view.size()));
+        !result) {
+        return std::unexpected(result.error());
+    }
+
+    msg.segment_count_ = builder.segment_count();
+
+    if (msg.segment_count_ == 0 || !msg.segment_at(0).is_msh()) {
+        return std::unexpected(hl7_error::missing_msh);
+    }
+
+    return msg;
+}
+
+// =============================================================================
+// hl7_flat_message - Node Access
+// =============================================================================
+
+const flat_node* hl7_flat_message::segment_node(size_t index) const noexcept {
+    if (index >= segment_count_) {
+        return nullptr;
+    }
+    return &arena_[index];
+}
+
+const flat_node* hl7_flat_message::field_node(size_t segment,
+                                              size_t field) const noexcept {
+    const auto* seg = segment_node(segment);
+    if (!seg || field == 0 || field > seg->child_count) {
+        return nullptr;
+    }
+    return &arena_[field_base_ + seg->first_child + field - 1];
+}
+
+const flat_node* hl7_flat_message::repetition_node(
+    size_t segment, size_t field, size_t repetition) const noexcept {
+    const auto* f = field_node(segment, field);
+    if (!f || repetition == 0 || repetition > f->child_count) {
+        return nullptr;
+    }
+    return &arena_[repetition_base_ + f->first_child + repetition - 1];
+}
+
+const flat_node* hl7_flat_message::component_node(
+    size_t segment, size_t field, size_t repetition,
+    size_t component) const noexcept {
+    const auto* rep = repetition_node(segment, field, repetition);
+    if (!rep || component == 0 || component > rep->child_count) {
+        return nullptr;
+    }
+    return &arena_[component_base_ + rep->first_child + component - 1];
+}
+
+std::string_view hl7_flat_message::resolve(size_t segment, size_t field,
+                                           size_t repetition, size_t component,
+                                           size_t subcomponent) const noexcept {
+    if (field == 0 || repetition == 0 || component == 0 || subcomponent == 0) {
+        return {};
+    }
+
+    // Latest overlay write covering this position wins
+    for (auto it = overlay_.rbegin(); it != overlay_.rend(); ++it) {
+        if (it->segment != segment || it->field != field) {
+            continue;
+        }
+        if (it->component == 0) {
+            // Whole-field write replaces every repetition and component
+            return (repetition == 1 && component == 1 && subcomponent == 1)
+                       ? std::string_view(it->value)
+                       : std::string_view{};
+        }
+        if (repetition != 1 || it->component != component) {
+            continue;
+        }
+        if (it->subcomponent == 0) {
+            return subcomponent == 1 ? std::string_view(it->value)
+                                     : std::string_view{};
+        }
+        if (it->subcomponent == subcomponent) {
+            return it->value;
+        }
+    }
+
+    const auto* comp = component_node(segment, field, repetition, component);
+    if (!comp || subcomponent > comp->child_count) {
+        return {};
+    }
+    return slice(arena_[subcomponent_base_ + comp->first_child + subcomponent - 1]);
+}
+
+// =============================================================================
+// hl7_flat_message - Message Information
+// =============================================================================
+
+hl7_message_header hl7_flat_message::header() const {
+    hl7_message_header hdr;
+
+    auto msh = segment("MSH");
+    if (!msh) {
+        return hdr;
+    }
+
+    hdr.encoding = encoding_;
+    hdr.sending_application = std::string(msh->field_value(3));
+    hdr.sending_facility = std::string(msh->field_value(4));
+    hdr.receiving_application = std::string(msh->field_value(5));
+    hdr.receiving_facility = std::string(msh->field_value(6));
+
+    if (auto ts = hl7_timestamp::parse(msh->field_value(7))) {
+        hdr.timestamp = *ts;
+    }
+
+    hdr.security = std::string(msh->field_value(8));
+
+    const auto type_field = msh->field(9);
+    hdr.type_string = std::string(type_field.component(1).value());
+    hdr.type = parse_message_type(hdr.type_string);
+    hdr.trigger_event = std::string(type_field.component(2).value());
+    hdr.message_structure = std::string(type_field.component(3).value());
+
+    hdr.message_control_id = std::string(msh->field_value(10));
+    hdr.processing_id = std::string(msh->field_value(11));
+    hdr.version_id = std::string(msh->field_value(12));
+
+    auto seq_str = msh->field_value(13);
+    if (!seq_str.empty()) {
+        int64_t seq = 0;
+        if (auto result = std::from_chars(seq_str.data(),
+                                           seq_str.data() + seq_str.size(), seq);
+            result.ec == std::errc{}) {
+            hdr.sequence_number = seq;
+        }
+    }
+
+    hdr.accept_ack_type = std::string(msh->field_value(15));
+    hdr.app_ack_type = std::string(msh->field_value(16));
+    hdr.country_code = std::string(msh->field_value(17));
+    hdr.character_set = std::string(msh->field_value(18));
+
+    return hdr;
+}
+
+message_type hl7_flat_message::type() const noexcept {
+    auto msh = segment("MSH");
+    if (!msh) return message_type::UNKNOWN;
+    return parse_message_type(msh->field(9).component(1).value());
+}
+
+std::string_view hl7_flat_message::trigger_event() const noexcept {
+    auto msh = segment("MSH");
+    if (!msh) return {};
+    return msh->field(9).component(2).value();
+}
+
+std::string_view hl7_flat_message::control_id() const noexcept {
+    auto msh = segment("MSH");
+    if (!msh) return {};
+    return msh->field_value(10);
+}
+
+// =============================================================================
+// hl7_flat_message - Segment Access
+// =============================================================================
+
+size_t hl7_flat_message::segment_count(std::string_view segment_id) const noexcept {
+    size_t count = 0;
+    for (size_t i = 0; i < segment_count_; ++i) {
+        if (slice(arena_[i]).substr(0, 3) == segment_id) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+hl7_segment_view hl7_flat_message::segment_at(size_t index) const {
+    if (index >= segment_count_) {
+        throw std::out_of_range("hl7_flat_message::segment_at");
+    }
+    return hl7_segment_view(this, static_cast<uint32_t>(index));
+}
+
+hl7_segment_view hl7_flat_message::segment(std::string_view segment_id,
+                                           size_t occurrence) const noexcept {
+    size_t count = 0;
+    for (size_t i = 0; i < segment_count_; ++i) {
+        if (slice(arena_[i]).substr(0, 3) == segment_id) {
+            if (count == occurrence) {
+                return hl7_segment_view(this, static_cast<uint32_t>(i));
+            }
+            ++count;
+        }
+    }
+    return {};
+}
+
+std::vector<hl7_segment_view> hl7_flat_message::segments(
+    std::string_view segment_id) const {
+    std::vector<hl7_segment_view> result;
+    for (size_t i = 0; i < segment_count_; ++i) {
+        if (slice(arena_[i]).substr(0, 3) == segment_id) {
+            result.push_back(hl7_segment_view(this, static_cast<uint32_t>(i)));
+        }
+    }
+    return result;
+}
+
+// =============================================================================
+// hl7_flat_message - Path-based Access
+// =============================================================================
+
+std::string_view hl7_flat_message::get_value(std::string_view path) const noexcept {
+    parsed_path parsed;
+    if (!parse_message_path(path, parsed)) {
+        return {};
+    }
+
+    auto seg = segment(parsed.segment_id, parsed.occurrence);
+    if (!seg) {
+        return {};
+    }
+
+    return resolve(seg.segment_, parsed.field, 1,
+                   parsed.has_component ? parsed.component : 1,
+                   parsed.has_subcomponent ? parsed.subcomponent : 1);
+}
+
+bool hl7_flat_message::set_value(std::string_view path, std::string value) {
+    parsed_path parsed;
+    if (!parse_message_path(path, parsed)) {
+        return false;
+    }
+
+    auto seg = segment(parsed.segment_id, parsed.occurrence);
+    if (!seg) {
+        return false;
+    }
+
+    // Index 0 addresses the first element, as in hl7_segment::set_value()
+    overlay_entry entry;
+    entry.segment = seg.segment_;
+    entry.field = static_cast<uint32_t>(std::max<size_t>(parsed.field, 1));
+    if (parsed.has_component) {
+        entry.component = static_cast<uint32_t>(std::max<size_t>(parsed.component, 1));
+    }
+    if (parsed.has_subcomponent) {
+        entry.subcomponent =
+            static_cast<uint32_t>(std::max<size_t>(parsed.subcomponent, 1));
+    }
+    entry.value = std::move(value);
+    overlay_.push_back(std::move(entry));
+    return true;
+}
+
+// =============================================================================
+// hl7_flat_message - Conversion
+// =============================================================================
+
+std::string hl7_flat_message::serialize() const {
+    if (is_modified()) {
+        auto message = to_message();
+        return message ? message->serialize() : std::string{};
+    }
+
+    size_t total = 0;
+    for (size_t i = 0; i < segment_count_; ++i) {
+        total += arena_[i].length + 1;
+    }
+
+    std::string result;
+    result.reserve(total);
+    for (size_t i = 0; i < segment_count_; ++i) {
+        result += slice(arena_[i]);
+        result += HL7_SEGMENT_TERMINATOR;
+    }
+    return result;
+}
+
+std::string hl7_flat_message::overlay_path(const overlay_entry& entry) const {
+    std::string_view seg_id = slice(arena_[entry.segment]).substr(0, 3);
+
+    size_t occurrence = 0;
+    for (size_t i = 0; i < entry.segment; ++i) {
+        if (slice(arena_[i]).substr(0, 3) == seg_id) {
+            ++occurrence;
+        }
+    }
+
+    std::string path(seg_id);
+    path += '[';
+    path += std::to_string(occurrence);
+    path += "].";
+    path += std::to_string(entry.field);
+    if (entry.component != 0) {
+        path += '.';
+        path += std::to_string(entry.component);
+        if (entry.subcomponent != 0) {
+            path += '.';
+            path += std::to_string(entry.subcomponent);
+        }
+    }
+    return path;
+}
+
+std::expected<hl7_message, hl7_error> hl7_flat_message::to_message() const {
+    if (segment_count_ == 0) {
+        return std::unexpected(hl7_error::empty_message);
+    }
+
+    auto parsed = hl7_message::parse(buffer_);
+    if (!parsed) {
+        return std::unexpected(parsed.error());
+    }
+
+    for (const auto& entry : overlay_) {
+        parsed->set_value(overlay_path(entry), entry.value);
+    }
+    return std::move(*parsed);
+}
+
+hl7_message hl7_flat_message::create_ack(ack_code code,
+                                          std::string_view text) const {
+    hl7_message ack;
+    ack.set_encoding(encoding_);
+
+    auto& msh = ack.add_segment("MSH");
+
+    // Swap sending/receiving
+    auto hdr = header();
+
+    msh.set_field(1, std::string(1, encoding_.field_separator));
+    msh.set_field(2, encoding_.to_msh2());
+    msh.set_field(3, hdr.receiving_application);
+    msh.set_field(4, hdr.receiving_facility);
+    msh.set_field(5, hdr.sending_application);
+    msh.set_field(6, hdr.sending_facility);
+    msh.set_field(7, hl7_timestamp::now().to_string());
+    msh.set_value("9.1", "ACK");
+    msh.set_value("9.2", hdr.trigger_event);
+    msh.set_field(10, hdr.message_control_id + "_ACK");
+    msh.set_field(11, hdr.processing_id);
+    msh.set_field(12, hdr.version_id);
+
+    // Add MSA segment
+    auto& msa = ack.add_segment("MSA");
+    msa.set_field(1, to_string(code));
+    msa.set_field(2, hdr.message_control_id);
+    if (!text.empty()) {
+        msa.set_field(3, std::string(text));
+    }
+
+    return ack;
+}
+
+}  // namespace pacs::bridge::hl7
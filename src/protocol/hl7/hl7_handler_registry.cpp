@@ -9,6 +9,7 @@
 #include "pacs/bridge/protocol/hl7/hl7_handler_registry.h"
 
 #include <algorithm>
+#include <type_traits>
 
 namespace pacs::bridge::hl7 {
 
@@ -75,8 +76,9 @@ void hl7_handler_registry::clear() {
 // Message Processing
 // =============================================================================
 
-IHL7Handler* hl7_handler_registry::find_handler(
-    const hl7_message& message) const {
+template<typename Message>
+IHL7Handler* hl7_handler_registry::find_handler_for(
+    const Message& message) const {
     std::lock_guard<std::mutex> lock(handlers_mutex_);
 
     for (const auto& [_, handler] : handlers_) {
@@ -88,10 +90,11 @@ IHL7Handler* hl7_handler_registry::find_handler(
     return nullptr;
 }
 
-Result<handler_result> hl7_handler_registry::process(
-    const hl7_message& message) {
+template<typename Message>
+Result<handler_result> hl7_handler_registry::process_with(
+    const Message& message) {
     // Find handler
-    IHL7Handler* handler = find_handler(message);
+    IHL7Handler* handler = find_handler_for(message);
 
     {
         std::lock_guard<std::mutex> lock(stats_mutex_);
@@ -123,6 +126,12 @@ Result<handler_result> hl7_handler_registry::process(
             stats_.failure_count++;
         }
 
+        if constexpr (std::is_same_v<Message, hl7_flat_message>) {
+            if (!handler->supports_view()) {
+                stats_.materialized_count++;
+            }
+        }
+
         std::string handler_type{handler->handler_type()};
         stats_.handler_counts[handler_type]++;
     }
@@ -130,10 +139,34 @@ Result<handler_result> hl7_handler_registry::process(
     return result;
 }
 
+IHL7Handler* hl7_handler_registry::find_handler(
+    const hl7_message& message) const {
+    return find_handler_for(message);
+}
+
+Result<handler_result> hl7_handler_registry::process(
+    const hl7_message& message) {
+    return process_with(message);
+}
+
 bool hl7_handler_registry::can_process(const hl7_message& message) const {
     return find_handler(message) != nullptr;
 }
 
+IHL7Handler* hl7_handler_registry::find_handler(
+    const hl7_flat_message& message) const {
+    return find_handler_for(message);
+}
+
+Result<handler_result> hl7_handler_registry::process(
+    const hl7_flat_message& message) {
+    return process_with(message);
+}
+
+bool hl7_handler_registry::can_process(const hl7_flat_message& message) const {
+    return find_handler(message) != nullptr;
+}
+
 // =============================================================================
 // Statistics
 // =============================================================================
@@ -5,12 +5,39 @@
 
 #include "pacs/bridge/protocol/hl7/hl7_message.h"
 
+#include "pacs/bridge/performance/delimiter_scanner.h"
+
 #include <algorithm>
 #include <charconv>
 #include <sstream>
 
 namespace pacs::bridge::hl7 {
 
+namespace {
+
+using performance::delimiter_index;
+using performance::delimiter_set;
+
+/**
+ * @brief Separators that split a segment into fields and below
+ */
+delimiter_set separator_set(const hl7_encoding_characters& encoding) {
+    return {encoding.field_separator, encoding.component_separator,
+            encoding.repetition_separator, encoding.subcomponent_separator};
+}
+
+/**
+ * @brief Separators plus segment terminators, for whole-message scans
+ */
+delimiter_set message_delimiter_set(const hl7_encoding_characters& encoding) {
+    auto set = separator_set(encoding);
+    set.add(HL7_SEGMENT_TERMINATOR);
+    set.add(HL7_LINE_FEED);
+    return set;
+}
+
+}  // namespace
+
 // =============================================================================
 // Static Empty Instances
 // =============================================================================
@@ -87,6 +114,13 @@ std::string hl7_component::serialize(
 
 hl7_component hl7_component::parse(std::string_view data,
                                     const hl7_encoding_characters& encoding) {
+    auto index = delimiter_index::scan(data, {encoding.subcomponent_separator});
+    return parse_indexed(data, index.positions(), 0, encoding);
+}
+
+hl7_component hl7_component::parse_indexed(
+    std::string_view data, std::span<const uint32_t> delimiters,
+    uint32_t offset, const hl7_encoding_characters& encoding) {
     hl7_component comp;
 
     if (data.empty()) {
@@ -94,17 +128,15 @@ hl7_component hl7_component::parse(std::string_view data,
     }
 
     size_t start = 0;
-    size_t pos = 0;
-
-    while (pos <= data.length()) {
-        if (pos == data.length() ||
-            data[pos] == encoding.subcomponent_separator) {
+    for (uint32_t delim : delimiters) {
+        const size_t pos = delim - offset;
+        if (data[pos] == encoding.subcomponent_separator) {
             comp.subcomponents_.emplace_back(
                 std::string(data.substr(start, pos - start)));
             start = pos + 1;
         }
-        ++pos;
     }
+    comp.subcomponents_.emplace_back(std::string(data.substr(start)));
 
     return comp;
 }
@@ -245,42 +277,50 @@ std::string hl7_field::serialize(
 
 hl7_field hl7_field::parse(std::string_view data,
                             const hl7_encoding_characters& encoding) {
+    auto index = delimiter_index::scan(
+        data, {encoding.component_separator, encoding.repetition_separator,
+               encoding.subcomponent_separator});
+    return parse_indexed(data, index.positions(), 0, encoding);
+}
+
+hl7_field hl7_field::parse_indexed(std::string_view data,
+                                   std::span<const uint32_t> delimiters,
+                                   uint32_t offset,
+                                   const hl7_encoding_characters& encoding) {
     hl7_field field;
 
     if (data.empty()) {
         return field;
     }
 
-    // Split by repetition separator
-    size_t rep_start = 0;
-    size_t pos = 0;
-
-    while (pos <= data.length()) {
-        if (pos == data.length() || data[pos] == encoding.repetition_separator) {
-            std::string_view rep_data = data.substr(rep_start, pos - rep_start);
-
-            std::vector<hl7_component> components;
-
-            // Split by component separator
-            size_t comp_start = 0;
-            size_t comp_pos = 0;
-
-            while (comp_pos <= rep_data.length()) {
-                if (comp_pos == rep_data.length() ||
-                    rep_data[comp_pos] == encoding.component_separator) {
-                    components.push_back(hl7_component::parse(
-                        rep_data.substr(comp_start, comp_pos - comp_start),
-                        encoding));
-                    comp_start = comp_pos + 1;
-                }
-                ++comp_pos;
-            }
-
+    // Repetitions split first, then components; subcomponent offsets are
+    // handed down to hl7_component unexamined
+    std::vector<hl7_component> components;
+    size_t comp_start = 0;
+    size_t comp_first = 0;
+
+    auto close_component = [&](size_t pos, size_t k) {
+        components.push_back(hl7_component::parse_indexed(
+            data.substr(comp_start, pos - comp_start),
+            delimiters.subspan(comp_first, k - comp_first),
+            offset + static_cast<uint32_t>(comp_start), encoding));
+        comp_start = pos + 1;
+        comp_first = k + 1;
+    };
+
+    for (size_t k = 0; k < delimiters.size(); ++k) {
+        const size_t pos = delimiters[k] - offset;
+        const char c = data[pos];
+        if (c == encoding.repetition_separator) {
+            close_component(pos, k);
             field.repetitions_.push_back(std::move(components));
-            rep_start = pos + 1;
+            components.clear();
+        } else if (c == encoding.component_separator) {
+            close_component(pos, k);
         }
-        ++pos;
     }
+    close_component(data.length(), delimiters.size());
+    field.repetitions_.push_back(std::move(components));
 
     return field;
 }
@@ -456,6 +496,13 @@ std::string hl7_segment::serialize(
 
 std::expected<hl7_segment, hl7_error> hl7_segment::parse(
     std::string_view data, const hl7_encoding_characters& encoding) {
+    auto index = delimiter_index::scan(data, separator_set(encoding));
+    return parse_indexed(data, index.positions(), 0, encoding);
+}
+
+std::expected<hl7_segment, hl7_error> hl7_segment::parse_indexed(
+    std::string_view data, std::span<const uint32_t> delimiters,
+    uint32_t offset, const hl7_encoding_characters& encoding) {
     if (data.empty()) {
         return std::unexpected(hl7_error::invalid_segment);
     }
@@ -467,70 +514,60 @@ std::expected<hl7_segment, hl7_error> hl7_segment::parse(
 
     hl7_segment segment(std::string(data.substr(0, 3)));
 
+    // Offset within data where regular fields start (npos: no fields)
+    size_t fields_start = std::string_view::npos;
+
     // Handle MSH segment specially
     if (segment.is_msh()) {
-        if (data.length() < 4) {
+        if (data.length() < 4 || data[3] != encoding.field_separator) {
             return std::unexpected(hl7_error::invalid_msh);
         }
 
         // MSH-1 is the field separator (position 3)
-        // MSH-2 is the encoding characters (positions 4-7)
-        // We already have encoding, skip to MSH-3
-
-        data = data.substr(3);  // Skip "MSH"
-
-        if (data.empty() || data[0] != encoding.field_separator) {
-            return std::unexpected(hl7_error::invalid_msh);
-        }
-
-        data = data.substr(1);  // Skip field separator
-
-        // Find MSH-2 (encoding characters)
-        size_t msh2_end = data.find(encoding.field_separator);
+        // MSH-2 is the encoding characters (positions 4-7); it contains the
+        // separators themselves, so skip to the next field separator
+        size_t msh2_end = data.find(encoding.field_separator, 4);
         if (msh2_end == std::string_view::npos) {
             msh2_end = data.length();
         }
 
         // Add placeholder fields for MSH-1 and MSH-2
         segment.fields_.emplace_back(std::string(1, encoding.field_separator));
-        segment.fields_.emplace_back(std::string(data.substr(0, msh2_end)));
+        segment.fields_.emplace_back(std::string(data.substr(4, msh2_end - 4)));
 
-        // Parse remaining fields
         if (msh2_end < data.length()) {
-            data = data.substr(msh2_end + 1);
-
-            size_t field_start = 0;
-            size_t pos = 0;
-
-            while (pos <= data.length()) {
-                if (pos == data.length() ||
-                    data[pos] == encoding.field_separator) {
-                    segment.fields_.push_back(hl7_field::parse(
-                        data.substr(field_start, pos - field_start), encoding));
-                    field_start = pos + 1;
-                }
-                ++pos;
-            }
+            fields_start = msh2_end + 1;
         }
-    } else {
-        // Regular segment
-        if (data.length() > 3 && data[3] == encoding.field_separator) {
-            data = data.substr(4);  // Skip "XXX|"
-
-            size_t field_start = 0;
-            size_t pos = 0;
-
-            while (pos <= data.length()) {
-                if (pos == data.length() ||
-                    data[pos] == encoding.field_separator) {
-                    segment.fields_.push_back(hl7_field::parse(
-                        data.substr(field_start, pos - field_start), encoding));
-                    field_start = pos + 1;
-                }
-                ++pos;
-            }
+    } else if (data.length() > 3 && data[3] == encoding.field_separator) {
+        fields_start = 4;  // Skip "XXX|"
+    }
+
+    if (fields_start == std::string_view::npos) {
+        return segment;
+    }
+
+    // Drop delimiters inside the segment ID / MSH-2
+    const auto first = static_cast<uint32_t>(offset + fields_start);
+    size_t k = static_cast<size_t>(
+        std::lower_bound(delimiters.begin(), delimiters.end(), first) -
+        delimiters.begin());
+
+    size_t field_start = fields_start;
+    size_t field_first = k;
+    for (; k < delimiters.size(); ++k) {
+        const size_t pos = delimiters[k] - offset;
+        if (data[pos] == encoding.field_separator) {
+            segment.fields_.push_back(hl7_field::parse_indexed(
+                data.substr(field_start, pos - field_start),
+                delimiters.subspan(field_first, k - field_first),
+                offset + static_cast<uint32_t>(field_start), encoding));
+            field_start = pos + 1;
+            field_first = k + 1;
         }
     }
+    segment.fields_.push_back(hl7_field::parse_indexed(
+        data.substr(field_start), delimiters.subspan(field_first),
+        offset + static_cast<uint32_t>(field_start), encoding));
 
     return segment;
 }
@@ -606,34 +643,57 @@ std::expected<hl7_message, hl7_error> hl7_message::parse(
     hl7_message msg;
     msg.pimpl_->encoding_ = encoding;
 
-    // Split into segments
+    // Locate every terminator and separator in one pass; segments, fields
+    // and components are then cut from this index without rescanning
+    const auto index = delimiter_index::scan(data, message_delimiter_set(encoding));
+    const auto delimiters = index.positions();
+
     size_t seg_start = 0;
-    size_t pos = 0;
-
-    while (pos <= data.length()) {
-        if (pos == data.length() || data[pos] == HL7_SEGMENT_TERMINATOR ||
-            data[pos] == HL7_LINE_FEED) {
-            if (pos > seg_start) {
-                std::string_view seg_data = data.substr(seg_start, pos - seg_start);
-
-                // Trim trailing whitespace
-                while (!seg_data.empty() &&
-                       (seg_data.back() == '\r' || seg_data.back() == '\n' ||
-                        seg_data.back() == ' ')) {
-                    seg_data = seg_data.substr(0, seg_data.length() - 1);
-                }
-
-                if (!seg_data.empty()) {
-                    auto seg_result = hl7_segment::parse(seg_data, encoding);
-                    if (!seg_result) {
-                        return std::unexpected(seg_result.error());
-                    }
-                    msg.pimpl_->segments_.push_back(std::move(*seg_result));
-                }
+    size_t seg_first = 0;
+
+    auto add_segment = [&](size_t pos, size_t k) -> std::expected<void, hl7_error> {
+        size_t seg_end = pos;
+
+        // Trim trailing whitespace
+        while (seg_end > seg_start &&
+               (data[seg_end - 1] == '\r' || data[seg_end - 1] == '\n' ||
+                data[seg_end - 1] == ' ')) {
+            --seg_end;
+        }
+
+        if (seg_end > seg_start) {
+            size_t seg_last = k;
+            while (seg_last > seg_first && delimiters[seg_last - 1] >= seg_end) {
+                --seg_last;
+            }
+
+            auto seg_result = hl7_segment::parse_indexed(
+                data.substr(seg_start, seg_end - seg_start),
+                delimiters.subspan(seg_first, seg_last - seg_first),
+                static_cast<uint32_t>(seg_start), encoding);
+            if (!seg_result) {
+                return std::unexpected(seg_result.error());
+            }
+            msg.pimpl_->segments_.push_back(std::move(*seg_result));
+        }
+
+        seg_start = pos + 1;
+        seg_first = k + 1;
+        return {};
+    };
+
+    for (size_t k = 0; k < delimiters.size(); ++k) {
+        const char c = data[delimiters[k]];
+        if (c == HL7_SEGMENT_TERMINATOR || c == HL7_LINE_FEED) {
+            if (auto result = add_segment(delimiters[k], k); !result) {
+                return std::unexpected(result.error());
             }
-            seg_start = pos + 1;
         }
-        ++pos;
+    }
+    if (seg_start < data.length()) {
+        if (auto result = add_segment(data.length(), delimiters.size()); !result) {
+            return std::unexpected(result.error());
+        }
     }
 
     // Validate MSH is present
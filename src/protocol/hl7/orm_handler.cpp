@@ -31,6 +31,12 @@ public:
     orm_handler_config config_;
     statistics stats_;
 
+    // Metric handles, resolved once per handler
+    monitoring::hl7_message_metrics metrics_ =
+        monitoring::bridge_metrics_collector::instance().hl7_metrics("ORM");
+    monitoring::counter_handle ack_sent_ =
+        monitoring::bridge_metrics_collector::instance().hl7_metrics("ORM_ACK").sent;
+
     // Callbacks
     order_created_callback on_created_;
     order_updated_callback on_updated_;
@@ -59,8 +65,9 @@ public:
           config_(config) {}
 
     // Extract ZDS segment for Study Instance UID (if present)
-    std::string extract_study_uid(const hl7_message& message) const {
-        const auto* zds = message.segment("ZDS");
+    template <typename Message>
+    std::string extract_study_uid(const Message& message) const {
+        auto zds = message.segment("ZDS");
         if (zds) {
             // ZDS-1 contains pre-assigned Study Instance UID
             std::string_view uid = zds->field_value(1);
@@ -135,9 +142,20 @@ orm_handler& orm_handler::operator=(orm_handler&&) noexcept = default;
 
 Result<orm_result> orm_handler::handle(
     const hl7_message& message) {
+    return handle_impl(message);
+}
+
+Result<orm_result> orm_handler::handle(
+    const hl7_flat_message& message) {
+    return handle_impl(message);
+}
+
+template <typename Message>
+Result<orm_result> orm_handler::handle_impl(
+    const Message& message) {
     // Record message received metric
     auto& metrics = monitoring::bridge_metrics_collector::instance();
-    metrics.record_hl7_message_received("ORM");
+    pimpl_->metrics_.received.increment();
 
     auto start = std::chrono::steady_clock::now();
     pimpl_->stats_.total_processed++;
@@ -151,7 +169,7 @@ Result<orm_result> orm_handler::handle(
     }
 
     // Extract order information
-    auto order_info_result = extract_order_info(message);
+    auto order_info_result = extract_order_info_impl(message);
     if (!order_info_result.is_ok()) {
         pimpl_->stats_.failure_count++;
         metrics.record_hl7_error("ORM", "extraction_failed");
@@ -175,27 +193,27 @@ Result<orm_result> orm_handler::handle(
     switch (order.control) {
         case order_control::new_order:
             pimpl_->stats_.nw_count++;
-            result = handle_new_order(message);
+            result = handle_new_order_impl(message);
             break;
 
         case order_control::change_order:
             pimpl_->stats_.xo_count++;
-            result = handle_change_order(message);
+            result = handle_change_order_impl(message);
             break;
 
         case order_control::cancel_order:
             pimpl_->stats_.ca_count++;
-            result = handle_cancel_order(message);
+            result = handle_cancel_order_impl(message);
             break;
 
         case order_control::discontinue_order:
             pimpl_->stats_.dc_count++;
-            result = handle_discontinue_order(message);
+            result = handle_discontinue_order_impl(message);
             break;
 
         case order_control::status_change:
             pimpl_->stats_.sc_count++;
-            result = handle_status_change(message);
+            result = handle_status_change_impl(message);
             break;
 
         default:
@@ -213,12 +231,12 @@ Result<orm_result> orm_handler::handle(
     // Record processing duration metric (convert to nanoseconds)
     auto duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
         end - start);
-    metrics.record_hl7_processing_duration("ORM", duration_ns);
+    pimpl_->metrics_.processing_duration.record(duration_ns);
 
     if (result.is_ok()) {
         pimpl_->stats_.success_count++;
         // Record ACK sent
-        metrics.record_hl7_message_sent("ORM_ACK");
+        pimpl_->ack_sent_.increment();
     } else {
         pimpl_->stats_.failure_count++;
         metrics.record_hl7_error("ORM", "processing_failed");
@@ -227,7 +245,19 @@ Result<orm_result> orm_handler::handle(
     return result;
 }
 
-bool orm_handler::can_handle_impl(const hl7_message& message) const noexcept {
+bool orm_handler::can_handle_impl(
+    const hl7_message& message) const noexcept {
+    return can_handle_message(message);
+}
+
+bool orm_handler::can_handle_impl(
+    const hl7_flat_message& message) const noexcept {
+    return can_handle_message(message);
+}
+
+template <typename Message>
+bool orm_handler::can_handle_message(
+    const Message& message) const noexcept {
     auto header = message.header();
     if (header.type != message_type::ORM) {
         return false;
@@ -244,8 +274,14 @@ std::vector<std::string> orm_handler::supported_controls() const {
 
 Result<orm_result> orm_handler::handle_new_order(
     const hl7_message& message) {
+    return handle_new_order_impl(message);
+}
+
+template <typename Message>
+Result<orm_result> orm_handler::handle_new_order_impl(
+    const Message& message) {
     // Extract order info
-    auto order_result = extract_order_info(message);
+    auto order_result = extract_order_info_impl(message);
     if (!order_result.is_ok()) {
         return order_result.error();
     }
@@ -310,15 +346,21 @@ Result<orm_result> orm_handler::handle_new_order(
     result.study_instance_uid = mwl.requested_procedure.study_instance_uid;
     result.description = exists ? "Order updated (NW with existing entry)"
                                 : "New order created";
-    result.ack_message = generate_ack(message, true);
+    result.ack_message = generate_ack_impl(message, true);
 
     return result;
 }
 
 Result<orm_result> orm_handler::handle_change_order(
     const hl7_message& message) {
+    return handle_change_order_impl(message);
+}
+
+template <typename Message>
+Result<orm_result> orm_handler::handle_change_order_impl(
+    const Message& message) {
     // Extract order info
-    auto order_result = extract_order_info(message);
+    auto order_result = extract_order_info_impl(message);
     if (!order_result.is_ok()) {
         return order_result.error();
     }
@@ -330,7 +372,7 @@ Result<orm_result> orm_handler::handle_change_order(
     if (!exists) {
         if (pimpl_->config_.allow_xo_create) {
             // Create new entry (delegate to new_order handler logic)
-            return handle_new_order(message);
+            return handle_new_order_impl(message);
         }
         return to_error_info(orm_error::order_not_found);
     }
@@ -381,15 +423,21 @@ Result<orm_result> orm_handler::handle_change_order(
     result.filler_order_number = order.filler_order_number;
     result.study_instance_uid = mwl.requested_procedure.study_instance_uid;
     result.description = "Order updated";
-    result.ack_message = generate_ack(message, true);
+    result.ack_message = generate_ack_impl(message, true);
 
     return result;
 }
 
 Result<orm_result> orm_handler::handle_cancel_order(
     const hl7_message& message) {
+    return handle_cancel_order_impl(message);
+}
+
+template <typename Message>
+Result<orm_result> orm_handler::handle_cancel_order_impl(
+    const Message& message) {
     // Extract order info
-    auto order_result = extract_order_info(message);
+    auto order_result = extract_order_info_impl(message);
     if (!order_result.is_ok()) {
         return order_result.error();
     }
@@ -423,15 +471,21 @@ Result<orm_result> orm_handler::handle_cancel_order(
     result.placer_order_number = order.placer_order_number;
     result.filler_order_number = order.filler_order_number;
     result.description = "Order cancelled";
-    result.ack_message = generate_ack(message, true);
+    result.ack_message = generate_ack_impl(message, true);
 
     return result;
 }
 
 Result<orm_result> orm_handler::handle_discontinue_order(
     const hl7_message& message) {
+    return handle_discontinue_order_impl(message);
+}
+
+template <typename Message>
+Result<orm_result> orm_handler::handle_discontinue_order_impl(
+    const Message& message) {
     // Extract order info
-    auto order_result = extract_order_info(message);
+    auto order_result = extract_order_info_impl(message);
     if (!order_result.is_ok()) {
         return order_result.error();
     }
@@ -475,15 +529,21 @@ Result<orm_result> orm_handler::handle_discontinue_order(
     result.filler_order_number = order.filler_order_number;
     result.study_instance_uid = mwl.requested_procedure.study_instance_uid;
     result.description = "Order discontinued";
-    result.ack_message = generate_ack(message, true);
+    result.ack_message = generate_ack_impl(message, true);
 
     return result;
 }
 
 Result<orm_result> orm_handler::handle_status_change(
     const hl7_message& message) {
+    return handle_status_change_impl(message);
+}
+
+template <typename Message>
+Result<orm_result> orm_handler::handle_status_change_impl(
+    const Message& message) {
     // Extract order info
-    auto order_result = extract_order_info(message);
+    auto order_result = extract_order_info_impl(message);
     if (!order_result.is_ok()) {
         return order_result.error();
     }
@@ -542,19 +602,25 @@ Result<orm_result> orm_handler::handle_status_change(
     result.study_instance_uid = mwl.requested_procedure.study_instance_uid;
     result.description =
         "Order status changed to " + std::string(to_mwl_status(order.status));
-    result.ack_message = generate_ack(message, true);
+    result.ack_message = generate_ack_impl(message, true);
 
     return result;
 }
 
 Result<order_info> orm_handler::extract_order_info(
     const hl7_message& message) const {
+    return extract_order_info_impl(message);
+}
+
+template <typename Message>
+Result<order_info> orm_handler::extract_order_info_impl(
+    const Message& message) const {
     order_info info;
     auto header = message.header();
     info.message_control_id = header.message_control_id;
 
     // Extract ORC segment
-    const auto* orc = message.segment("ORC");
+    auto orc = message.segment("ORC");
     if (!orc) {
         return to_error_info(orm_error::missing_required_field);
     }
@@ -586,7 +652,7 @@ Result<order_info> orm_handler::extract_order_info(
     }
 
     // Extract PID segment
-    const auto* pid = message.segment("PID");
+    auto pid = message.segment("PID");
     if (!pid) {
         return to_error_info(orm_error::missing_required_field);
     }
@@ -603,7 +669,7 @@ Result<order_info> orm_handler::extract_order_info(
     }
 
     // Extract OBR segment
-    const auto* obr = message.segment("OBR");
+    auto obr = message.segment("OBR");
     if (!obr) {
         return to_error_info(orm_error::missing_required_field);
     }
@@ -627,6 +693,13 @@ Result<order_info> orm_handler::extract_order_info(
 hl7_message orm_handler::generate_ack(const hl7_message& original, bool success,
                                        std::string_view error_code,
                                        std::string_view error_message) const {
+    return generate_ack_impl(original, success, error_code, error_message);
+}
+
+template <typename Message>
+hl7_message orm_handler::generate_ack_impl(const Message& original, bool success,
+                                         std::string_view error_code,
+                                         std::string_view error_message) const {
     hl7_message ack;
     auto orig_header = original.header();
 
@@ -21,6 +21,10 @@ class oru_generator::impl {
 public:
     oru_generator_config config_;
 
+    // Metric handles, resolved once per generator
+    monitoring::hl7_message_metrics metrics_ =
+        monitoring::bridge_metrics_collector::instance().hl7_metrics("ORU");
+
     explicit impl(const oru_generator_config& config) : config_(config) {}
 
     [[nodiscard]] Result<hl7_message> generate(
@@ -284,10 +288,10 @@ Result<hl7_message> oru_generator::generate(
     auto end = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
         end - start);
-    metrics.record_hl7_processing_duration("ORU", duration);
+    pimpl_->metrics_.processing_duration.record(duration);
 
     if (result.is_ok()) {
-        metrics.record_hl7_message_sent("ORU");
+        pimpl_->metrics_.sent.increment();
     } else {
         metrics.record_hl7_error("ORU", "generation_failed");
     }
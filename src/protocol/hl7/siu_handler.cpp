@@ -31,6 +31,12 @@ public:
     siu_handler_config config_;
     statistics stats_;
 
+    // Metric handles, resolved once per handler
+    monitoring::hl7_message_metrics metrics_ =
+        monitoring::bridge_metrics_collector::instance().hl7_metrics("SIU");
+    monitoring::counter_handle ack_sent_ =
+        monitoring::bridge_metrics_collector::instance().hl7_metrics("SIU_ACK").sent;
+
     // Callbacks
     appointment_created_callback on_created_;
     appointment_updated_callback on_updated_;
@@ -198,13 +204,25 @@ siu_handler::~siu_handler() = default;
 siu_handler::siu_handler(siu_handler&&) noexcept = default;
 siu_handler& siu_handler::operator=(siu_handler&&) noexcept = default;
 
-Result<siu_result> siu_handler::handle(const hl7_message& message) {
+Result<siu_result> siu_handler::handle(
+    const hl7_message& message) {
+    return handle_impl(message);
+}
+
+Result<siu_result> siu_handler::handle(
+    const hl7_flat_message& message) {
+    return handle_impl(message);
+}
+
+template <typename Message>
+Result<siu_result> siu_handler::handle_impl(
+    const Message& message) {
     auto start = std::chrono::steady_clock::now();
     pimpl_->stats_.total_processed++;
 
     // Get metrics collector instance
     auto& metrics = monitoring::bridge_metrics_collector::instance();
-    metrics.record_hl7_message_received("SIU");
+    pimpl_->metrics_.received.increment();
 
     // Validate message type
     auto header = message.header();
@@ -215,7 +233,7 @@ Result<siu_result> siu_handler::handle(const hl7_message& message) {
     }
 
     // Extract appointment information
-    auto appt_result = extract_appointment_info(message);
+    auto appt_result = extract_appointment_info_impl(message);
     if (!appt_result.is_ok()) {
         pimpl_->stats_.failure_count++;
         metrics.record_hl7_error("SIU", "extraction_failed");
@@ -239,22 +257,22 @@ Result<siu_result> siu_handler::handle(const hl7_message& message) {
     switch (appt.trigger) {
         case siu_trigger_event::s12_new_appointment:
             pimpl_->stats_.s12_count++;
-            result = handle_s12(message);
+            result = handle_s12_impl(message);
             break;
 
         case siu_trigger_event::s13_rescheduled:
             pimpl_->stats_.s13_count++;
-            result = handle_s13(message);
+            result = handle_s13_impl(message);
             break;
 
         case siu_trigger_event::s14_modification:
             pimpl_->stats_.s14_count++;
-            result = handle_s14(message);
+            result = handle_s14_impl(message);
             break;
 
         case siu_trigger_event::s15_cancellation:
             pimpl_->stats_.s15_count++;
-            result = handle_s15(message);
+            result = handle_s15_impl(message);
             break;
 
         default:
@@ -272,11 +290,11 @@ Result<siu_result> siu_handler::handle(const hl7_message& message) {
     // Record processing duration for metrics
     auto duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
         end - start);
-    metrics.record_hl7_processing_duration("SIU", duration_ns);
+    pimpl_->metrics_.processing_duration.record(duration_ns);
 
     if (result.is_ok()) {
         pimpl_->stats_.success_count++;
-        metrics.record_hl7_message_sent("SIU_ACK");
+        pimpl_->ack_sent_.increment();
     } else {
         pimpl_->stats_.failure_count++;
         metrics.record_hl7_error("SIU", "processing_failed");
@@ -285,7 +303,19 @@ Result<siu_result> siu_handler::handle(const hl7_message& message) {
     return result;
 }
 
-bool siu_handler::can_handle_impl(const hl7_message& message) const noexcept {
+bool siu_handler::can_handle_impl(
+    const hl7_message& message) const noexcept {
+    return can_handle_message(message);
+}
+
+bool siu_handler::can_handle_impl(
+    const hl7_flat_message& message) const noexcept {
+    return can_handle_message(message);
+}
+
+template <typename Message>
+bool siu_handler::can_handle_message(
+    const Message& message) const noexcept {
     auto header = message.header();
     if (header.type != message_type::SIU) {
         return false;
@@ -299,9 +329,16 @@ std::vector<std::string> siu_handler::supported_triggers() const {
     return {"S12", "S13", "S14", "S15"};
 }
 
-Result<siu_result> siu_handler::handle_s12(const hl7_message& message) {
+Result<siu_result> siu_handler::handle_s12(
+    const hl7_message& message) {
+    return handle_s12_impl(message);
+}
+
+template <typename Message>
+Result<siu_result> siu_handler::handle_s12_impl(
+    const Message& message) {
     // Extract appointment info
-    auto appt_result = extract_appointment_info(message);
+    auto appt_result = extract_appointment_info_impl(message);
     if (!appt_result.is_ok()) {
         return appt_result.error();
     }
@@ -353,14 +390,21 @@ Result<siu_result> siu_handler::handle_s12(const hl7_message& message) {
     result.study_instance_uid = mwl.requested_procedure.study_instance_uid;
     result.description = exists ? "Appointment updated (S12 with existing entry)"
                                 : "New appointment created";
-    result.ack_message = generate_ack(message, true);
+    result.ack_message = generate_ack_impl(message, true);
 
     return result;
 }
 
-Result<siu_result> siu_handler::handle_s13(const hl7_message& message) {
+Result<siu_result> siu_handler::handle_s13(
+    const hl7_message& message) {
+    return handle_s13_impl(message);
+}
+
+template <typename Message>
+Result<siu_result> siu_handler::handle_s13_impl(
+    const Message& message) {
     // Extract appointment info
-    auto appt_result = extract_appointment_info(message);
+    auto appt_result = extract_appointment_info_impl(message);
     if (!appt_result.is_ok()) {
         return appt_result.error();
     }
@@ -375,7 +419,7 @@ Result<siu_result> siu_handler::handle_s13(const hl7_message& message) {
     if (!exists) {
         if (pimpl_->config_.allow_reschedule_create) {
             // Create new entry (delegate to S12 handler logic)
-            return handle_s12(message);
+            return handle_s12_impl(message);
         }
         return to_error_info(siu_error::appointment_not_found);
     }
@@ -420,14 +464,21 @@ Result<siu_result> siu_handler::handle_s13(const hl7_message& message) {
     result.scheduled_datetime = appt.scheduled_datetime;
     result.study_instance_uid = mwl.requested_procedure.study_instance_uid;
     result.description = "Appointment rescheduled";
-    result.ack_message = generate_ack(message, true);
+    result.ack_message = generate_ack_impl(message, true);
 
     return result;
 }
 
-Result<siu_result> siu_handler::handle_s14(const hl7_message& message) {
+Result<siu_result> siu_handler::handle_s14(
+    const hl7_message& message) {
+    return handle_s14_impl(message);
+}
+
+template <typename Message>
+Result<siu_result> siu_handler::handle_s14_impl(
+    const Message& message) {
     // Extract appointment info
-    auto appt_result = extract_appointment_info(message);
+    auto appt_result = extract_appointment_info_impl(message);
     if (!appt_result.is_ok()) {
         return appt_result.error();
     }
@@ -476,14 +527,21 @@ Result<siu_result> siu_handler::handle_s14(const hl7_message& message) {
     result.scheduled_datetime = appt.scheduled_datetime;
     result.study_instance_uid = mwl.requested_procedure.study_instance_uid;
     result.description = "Appointment modified";
-    result.ack_message = generate_ack(message, true);
+    result.ack_message = generate_ack_impl(message, true);
 
     return result;
 }
 
-Result<siu_result> siu_handler::handle_s15(const hl7_message& message) {
+Result<siu_result> siu_handler::handle_s15(
+    const hl7_message& message) {
+    return handle_s15_impl(message);
+}
+
+template <typename Message>
+Result<siu_result> siu_handler::handle_s15_impl(
+    const Message& message) {
     // Extract appointment info
-    auto appt_result = extract_appointment_info(message);
+    auto appt_result = extract_appointment_info_impl(message);
     if (!appt_result.is_ok()) {
         return appt_result.error();
     }
@@ -518,13 +576,19 @@ Result<siu_result> siu_handler::handle_s15(const hl7_message& message) {
     result.filler_appointment_id = appt.filler_appointment_id;
     result.patient_id = appt.patient_id;
     result.description = "Appointment cancelled";
-    result.ack_message = generate_ack(message, true);
+    result.ack_message = generate_ack_impl(message, true);
 
     return result;
 }
 
 Result<appointment_info> siu_handler::extract_appointment_info(
     const hl7_message& message) const {
+    return extract_appointment_info_impl(message);
+}
+
+template <typename Message>
+Result<appointment_info> siu_handler::extract_appointment_info_impl(
+    const Message& message) const {
     appointment_info info;
     auto header = message.header();
     info.message_control_id = header.message_control_id;
@@ -536,7 +600,7 @@ Result<appointment_info> siu_handler::extract_appointment_info(
     }
 
     // Extract SCH segment
-    const auto* sch = message.segment("SCH");
+    auto sch = message.segment("SCH");
     if (!sch) {
         return to_error_info(siu_error::missing_required_field);
     }
@@ -561,7 +625,7 @@ Result<appointment_info> siu_handler::extract_appointment_info(
     info.status = parse_appointment_status(sch->field_value(25));
 
     // Extract PID segment
-    const auto* pid = message.segment("PID");
+    auto pid = message.segment("PID");
     if (!pid) {
         return to_error_info(siu_error::missing_required_field);
     }
@@ -578,14 +642,14 @@ Result<appointment_info> siu_handler::extract_appointment_info(
     }
 
     // Extract RGS segment (Resource Group Segment) if present
-    const auto* rgs = message.segment("RGS");
+    auto rgs = message.segment("RGS");
     if (rgs) {
         // RGS-3 contains resource group ID
         // (used for grouping related resources)
     }
 
     // Extract AIS segment (Appointment Information - Service) if present
-    const auto* ais = message.segment("AIS");
+    auto ais = message.segment("AIS");
     if (ais) {
         // Universal Service ID (AIS-3)
         info.procedure_code = std::string(ais->field(3).component(1).value());
@@ -611,6 +675,13 @@ Result<appointment_info> siu_handler::extract_appointment_info(
 hl7_message siu_handler::generate_ack(const hl7_message& original, bool success,
                                        std::string_view error_code,
                                        std::string_view error_message) const {
+    return generate_ack_impl(original, success, error_code, error_message);
+}
+
+template <typename Message>
+hl7_message siu_handler::generate_ack_impl(const Message& original, bool success,
+                                         std::string_view error_code,
+                                         std::string_view error_message) const {
     hl7_message ack;
     auto orig_header = original.header();
 
@@ -5,6 +5,9 @@
 
 #include "pacs/bridge/router/message_router.h"
 
+#include "pacs/bridge/integration/thread_adapter.h"
+#include "pacs/bridge/internal/atomic_shared_ptr.h"
+#include "pacs/bridge/internal/sharded_counter.h"
 #include "pacs/bridge/tracing/trace_manager.h"
 
 #ifdef PACS_BRIDGE_STANDALONE_BUILD
@@ -14,10 +17,13 @@
 #endif
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <mutex>
 #include <regex>
 #include <sstream>
+#include <unordered_map>
 
 namespace pacs::bridge::router {
 
@@ -116,15 +122,45 @@ bool match_wildcard(std::string_view pattern, std::string_view value) {
     return pattern == value;
 }
 
-bool match_regex(const std::string& pattern, std::string_view value) {
-    if (pattern.empty()) return true;
-
+/**
+ * @brief Compile a route regex (case-insensitive)
+ *
+ * @return nullptr if the pattern is not a valid regex
+ */
+std::shared_ptr<const std::regex> compile_regex(const std::string& pattern) {
     try {
-        std::regex re(pattern, std::regex::icase);
-        return std::regex_match(std::string(value), re);
+        return std::make_shared<const std::regex>(pattern, std::regex::icase);
     } catch (const std::regex_error&) {
-        return false;
+        return nullptr;
+    }
+}
+
+/**
+ * @brief Regex for a pattern, compiled once per thread
+ *
+ * Serves route::matches(), which is called without a routing table; the
+ * router itself matches with patterns compiled when routes are added.
+ */
+const std::regex* cached_regex(const std::string& pattern) {
+    constexpr size_t max_cached = 256;
+    thread_local std::unordered_map<std::string, std::shared_ptr<const std::regex>>
+        cache;
+
+    auto it = cache.find(pattern);
+    if (it == cache.end()) {
+        if (cache.size() >= max_cached) {
+            cache.clear();
+        }
+        it = cache.emplace(pattern, compile_regex(pattern)).first;
     }
+    return it->second.get();
+}
+
+bool match_regex(const std::string& pattern, std::string_view value) {
+    if (pattern.empty()) return true;
+
+    const std::regex* re = cached_regex(pattern);
+    return re && std::regex_match(value.begin(), value.end(), *re);
 }
 
 bool pattern_matches(const std::string& pattern, std::string_view value,
@@ -135,55 +171,238 @@ bool pattern_matches(const std::string& pattern, std::string_view value,
     return match_wildcard(pattern, value);
 }
 
-}  // namespace
+/**
+ * @brief Check every pattern field against an extracted MSH header
+ */
+bool header_matches(const message_pattern& pattern,
+                    const hl7::hl7_message_header& header) {
+    return pattern_matches(pattern.message_type, header.type_string,
+                           pattern.use_regex) &&
+           pattern_matches(pattern.trigger_event, header.trigger_event,
+                           pattern.use_regex) &&
+           pattern_matches(pattern.sending_application,
+                           header.sending_application, pattern.use_regex) &&
+           pattern_matches(pattern.sending_facility, header.sending_facility,
+                           pattern.use_regex) &&
+           pattern_matches(pattern.receiving_application,
+                           header.receiving_application, pattern.use_regex) &&
+           pattern_matches(pattern.receiving_facility,
+                           header.receiving_facility, pattern.use_regex) &&
+           pattern_matches(pattern.processing_id, header.processing_id,
+                           pattern.use_regex) &&
+           pattern_matches(pattern.version, header.version_id,
+                           pattern.use_regex);
+}
 
 // =============================================================================
-// route Implementation
+// Compiled Patterns
 // =============================================================================
 
-bool route::matches(const hl7::hl7_message& message) const {
-    if (!enabled) return false;
+/**
+ * @brief MSH fields a message_pattern matches, in index order
+ */
+enum pattern_field : size_t {
+    field_message_type,
+    field_trigger_event,
+    field_sending_application,
+    field_sending_facility,
+    field_receiving_application,
+    field_receiving_facility,
+    field_processing_id,
+    field_version,
+    field_count
+};
+
+std::string_view header_field(const hl7::hl7_message_header& header,
+                              size_t field) {
+    switch (field) {
+        case field_message_type: return header.type_string;
+        case field_trigger_event: return header.trigger_event;
+        case field_sending_application: return header.sending_application;
+        case field_sending_facility: return header.sending_facility;
+        case field_receiving_application: return header.receiving_application;
+        case field_receiving_facility: return header.receiving_facility;
+        case field_processing_id: return header.processing_id;
+        case field_version: return header.version_id;
+        default: return {};
+    }
+}
 
-    auto header = message.header();
+/**
+ * @brief One pattern field compiled for repeated matching
+ *
+ * Same semantics as pattern_matches(); regexes are compiled once here.
+ */
+class field_matcher {
+public:
+    field_matcher() = default;
 
-    // Check all pattern fields
-    if (!pattern_matches(pattern.message_type, header.type_string,
-                         pattern.use_regex)) {
-        return false;
+    field_matcher(const std::string& pattern, bool use_regex) {
+        if (pattern.empty() || (!use_regex && pattern == "*")) {
+            return;
+        }
+        if (use_regex) {
+            regex_ = compile_regex(pattern);
+            kind_ = regex_ ? kind::regex : kind::never;
+        } else if (pattern.back() == '*') {
+            kind_ = kind::prefix;
+            text_ = pattern.substr(0, pattern.size() - 1);
+        } else {
+            kind_ = kind::exact;
+            text_ = pattern;
+        }
     }
 
-    if (!pattern_matches(pattern.trigger_event, header.trigger_event,
-                         pattern.use_regex)) {
+    [[nodiscard]] bool matches(std::string_view value) const {
+        switch (kind_) {
+            case kind::any: return true;
+            case kind::exact: return value == text_;
+            case kind::prefix: return value.starts_with(text_);
+            case kind::regex:
+                return std::regex_match(value.begin(), value.end(), *regex_);
+            case kind::never: return false;
+        }
         return false;
     }
 
-    if (!pattern_matches(pattern.sending_application, header.sending_application,
-                         pattern.use_regex)) {
-        return false;
+    /** Value every match equals, or nullptr */
+    [[nodiscard]] const std::string* exact_value() const noexcept {
+        return kind_ == kind::exact ? &text_ : nullptr;
     }
 
-    if (!pattern_matches(pattern.sending_facility, header.sending_facility,
-                         pattern.use_regex)) {
-        return false;
+    /** True for a regex that failed to compile */
+    [[nodiscard]] bool invalid() const noexcept { return kind_ == kind::never; }
+
+private:
+    enum class kind { any, exact, prefix, regex, never };
+
+    kind kind_ = kind::any;
+    std::string text_;
+    std::shared_ptr<const std::regex> regex_;
+};
+
+/**
+ * @brief message_pattern compiled when its route is added
+ */
+struct compiled_pattern {
+    std::array<field_matcher, field_count> fields;
+
+    explicit compiled_pattern(const message_pattern& pattern) {
+        const bool re = pattern.use_regex;
+        fields[field_message_type] = field_matcher(pattern.message_type, re);
+        fields[field_trigger_event] = field_matcher(pattern.trigger_event, re);
+        fields[field_sending_application] =
+            field_matcher(pattern.sending_application, re);
+        fields[field_sending_facility] = field_matcher(pattern.sending_facility, re);
+        fields[field_receiving_application] =
+            field_matcher(pattern.receiving_application, re);
+        fields[field_receiving_facility] =
+            field_matcher(pattern.receiving_facility, re);
+        fields[field_processing_id] = field_matcher(pattern.processing_id, re);
+        fields[field_version] = field_matcher(pattern.version, re);
     }
 
-    if (!pattern_matches(pattern.receiving_application, header.receiving_application,
-                         pattern.use_regex)) {
-        return false;
+    [[nodiscard]] bool matches(const hl7::hl7_message_header& header) const {
+        for (size_t field = 0; field < field_count; ++field) {
+            if (!fields[field].matches(header_field(header, field))) {
+                return false;
+            }
+        }
+        return true;
     }
+};
 
-    if (!pattern_matches(pattern.receiving_facility, header.receiving_facility,
-                         pattern.use_regex)) {
-        return false;
+/**
+ * @brief Trie of routes keyed on their exact-valued pattern fields
+ *
+ * Levels follow the MSH fields from message type through receiving
+ * facility. A route descends along its exact values, taking the wildcard
+ * edge for a field matched any other way (any, prefix, regex), and is
+ * stored after its last exact field. A lookup follows the message's value
+ * and the wildcard edge at each level, so it reaches only routes whose
+ * exact fields all equal the message's; the cost depends on those, not on
+ * the total number of routes. Candidates must still be checked against
+ * their compiled pattern.
+ */
+class route_index {
+public:
+    /** Add the route at position (its index in priority order) */
+    void insert(uint32_t position, const compiled_pattern& pattern) {
+        size_t depth = 0;
+        for (size_t field = 0; field < indexed_fields; ++field) {
+            if (pattern.fields[field].exact_value()) {
+                depth = field + 1;
+            }
+        }
+
+        node* current = &root_;
+        for (size_t field = 0; field < depth; ++field) {
+            const std::string* value = pattern.fields[field].exact_value();
+            std::unique_ptr<node>& next =
+                value ? current->exact[*value] : current->wildcard;
+            if (!next) {
+                next = std::make_unique<node>();
+            }
+            current = next.get();
+        }
+        current->routes.push_back(position);
     }
 
-    if (!pattern_matches(pattern.processing_id, header.processing_id,
-                         pattern.use_regex)) {
-        return false;
+    /** Positions of routes that may match header, in priority order */
+    void candidates(const hl7::hl7_message_header& header,
+                    std::vector<uint32_t>& out) const {
+        out.clear();
+        collect(root_, 0, header, out);
+        std::sort(out.begin(), out.end());
+    }
+
+private:
+    static constexpr size_t indexed_fields = field_receiving_facility + 1;
+
+    struct string_hash {
+        using is_transparent = void;
+        size_t operator()(std::string_view value) const noexcept {
+            return std::hash<std::string_view>{}(value);
+        }
+    };
+
+    struct node {
+        std::vector<uint32_t> routes;
+        std::unordered_map<std::string, std::unique_ptr<node>, string_hash,
+                           std::equal_to<>>
+            exact;
+        std::unique_ptr<node> wildcard;
+    };
+
+    static void collect(const node& current, size_t field,
+                        const hl7::hl7_message_header& header,
+                        std::vector<uint32_t>& out) {
+        out.insert(out.end(), current.routes.begin(), current.routes.end());
+        if (field == indexed_fields) {
+            return;
+        }
+        if (!current.exact.empty()) {
+            auto it = current.exact.find(header_field(header, field));
+            if (it != current.exact.end()) {
+                collect(*it->second, field + 1, header, out);
+            }
+        }
+        if (current.wildcard) {
+            collect(*current.wildcard, field + 1, header, out);
+        }
     }
 
-    if (!pattern_matches(pattern.version, header.version_id,
-                         pattern.use_regex)) {
+    node root_;
+};
+
+}  // namespace
+
+// =============================================================================
+// route Implementation
+// =============================================================================
+
+bool route::matches(const hl7::hl7_message& message) const {
+    if (!matches_header(message.header())) {
         return false;
     }
 
@@ -195,32 +414,343 @@ bool route::matches(const hl7::hl7_message& message) const {
     return true;
 }
 
+bool route::matches_header(const hl7::hl7_message_header& header) const {
+    return enabled && header_matches(pattern, header);
+}
+
+// =============================================================================
+// Message Source
+// =============================================================================
+
+namespace {
+
+/**
+ * @brief Inbound message in whichever form it was received
+ *
+ * Supplies the other representation on demand: a view is materialized into
+ * an hl7_message only for filters and message handlers, and an hl7_message
+ * is re-indexed as a view only for view handlers. Each is built at most once.
+ * A representation that cannot be built is reported as nullptr; routing
+ * then fails with router_error::invalid_message.
+ */
+class message_source {
+public:
+    explicit message_source(const hl7::hl7_message& message)
+        : message_(&message), header_(message.header()) {}
+
+    explicit message_source(const hl7::hl7_flat_message& view)
+        : view_(&view), header_(view.header()) {}
+
+    [[nodiscard]] const hl7::hl7_message_header& header() const noexcept {
+        return header_;
+    }
+
+    /** The message, or nullptr if the view cannot be materialized */
+    [[nodiscard]] const hl7::hl7_message* message() {
+        if (!message_ && !message_failed_) {
+            auto materialized = view_->to_message();
+            if (materialized) {
+                owned_message_ = std::move(*materialized);
+                message_ = &*owned_message_;
+            } else {
+                message_failed_ = true;
+            }
+        }
+        return message_;
+    }
+
+    /** The view, or nullptr if the message cannot be re-indexed */
+    [[nodiscard]] const hl7::hl7_flat_message* view() {
+        if (!view_ && !view_failed_) {
+            auto parsed = hl7::hl7_flat_message::parse_owned(message_->serialize());
+            if (parsed) {
+                owned_view_ = std::move(*parsed);
+                view_ = &*owned_view_;
+            } else {
+                view_failed_ = true;
+            }
+        }
+        return view_;
+    }
+
+    /** True if a received view had to be turned into an hl7_message */
+    [[nodiscard]] bool materialized() const noexcept {
+        return owned_message_.has_value();
+    }
+
+    /**
+     * @brief Owned copy of the message, for chains that outlive the call
+     *
+     * Copies whichever representation is at hand, preferring a received
+     * or already materialized hl7_message.
+     *
+     * @return The copy, or nullptr if a view's bytes no longer parse
+     */
+    [[nodiscard]] std::shared_ptr<const struct owned_message> copy() const;
+
+private:
+    const hl7::hl7_message* message_ = nullptr;
+    const hl7::hl7_flat_message* view_ = nullptr;
+    std::optional<hl7::hl7_message> owned_message_;
+    std::optional<hl7::hl7_flat_message> owned_view_;
+    bool message_failed_ = false;
+    bool view_failed_ = false;
+    hl7::hl7_message_header header_;
+};
+
+/**
+ * @brief Message copied for async handler chains
+ *
+ * Each chain reads it through its own message_source, so chains running
+ * at the same time do not share lazily built representations.
+ */
+struct owned_message {
+    std::optional<hl7::hl7_message> message;
+    std::optional<hl7::hl7_flat_message> view;
+
+    [[nodiscard]] message_source source() const {
+        return message ? message_source(*message) : message_source(*view);
+    }
+};
+
+std::shared_ptr<const owned_message> message_source::copy() const {
+    auto owned = std::make_shared<owned_message>();
+    if (message_) {
+        owned->message = *message_;
+    } else {
+        auto parsed = hl7::hl7_flat_message::parse_owned(std::string(view_->raw()));
+        if (!parsed) {
+            return nullptr;
+        }
+        owned->view = std::move(*parsed);
+    }
+    return owned;
+}
+
+}  // namespace
+
+// =============================================================================
+// Routing Counters
+// =============================================================================
+
+namespace {
+
+using internal::sharded_counter;
+
+/**
+ * @brief Routing statistics, shared with chains still running on the pool
+ */
+struct router_counters {
+    sharded_counter total_messages;
+    sharded_counter matched_messages;
+    sharded_counter default_handled;
+    sharded_counter unhandled_messages;
+    sharded_counter handler_errors;
+    sharded_counter materialized_messages;
+    sharded_counter async_chains;
+};
+
+/**
+ * @brief Result of one route's handler chain
+ */
+struct chain_outcome {
+    /** Last handler result; empty if no handler ran */
+    std::optional<handler_result> result;
+
+    /** A handler threw or returned an error */
+    bool failed = false;
+
+    /** Error to report when failed */
+    router_error code = router_error::handler_error;
+
+    /** Tracing error text when failed */
+    std::string error;
+};
+
+}  // namespace
+
 // =============================================================================
 // message_router::impl
 // =============================================================================
 
 class message_router::impl {
 public:
+    /**
+     * @brief Handler resolved when the routing table is compiled
+     *
+     * Both pointers are null if the handler was unregistered after the
+     * route was added.
+     */
+    struct compiled_handler {
+        std::string id;
+        std::shared_ptr<const message_handler> message;
+        std::shared_ptr<const view_handler> view;
+    };
+
+    /**
+     * @brief Route with its pattern compiled and handler chain resolved
+     *
+     * Definitions are immutable once published; set_route_enabled()
+     * publishes a modified copy. The enabled flag is applied when the index
+     * is built.
+     */
+    struct compiled_route {
+        std::shared_ptr<const struct route> definition;
+        std::shared_ptr<const compiled_pattern> pattern;
+        std::vector<compiled_handler> handlers;
+        std::shared_ptr<sharded_counter> matches;
+    };
+
+    /**
+     * @brief Immutable routing configuration read by route()
+     *
+     * Rebuilt under mutex_ on every configuration change and published
+     * through internal::atomic_shared_ptr, so routing never takes mutex_. A
+     * routing call keeps the table it loaded alive until it returns.
+     */
+    struct routing_table {
+        std::vector<compiled_route> routes;
+        route_index index;  // enabled routes only
+        std::shared_ptr<const message_handler> default_handler;
+        std::shared_ptr<const logger_callback> logger;
+        log_level min_log_level = log_level::info;
+        std::shared_ptr<integration::thread_adapter> pool;
+        std::shared_ptr<router_counters> counters;
+    };
+
+    impl() { publish(); }
+
+    // Configuration, guarded by mutex_ and compiled into table_
     mutable std::mutex mutex_;
-    std::unordered_map<std::string, message_handler> handlers_;
-    std::vector<struct route> routes_;
-    message_handler default_handler_;
-    mutable statistics stats_;
-    logger_callback logger_;
+    std::unordered_map<std::string, std::shared_ptr<const message_handler>> handlers_;
+    std::unordered_map<std::string, std::shared_ptr<const view_handler>> view_handlers_;
+    /** Route with the pattern compiled when it was added */
+    struct route_entry {
+        std::shared_ptr<const struct route> definition;
+        std::shared_ptr<const compiled_pattern> pattern;
+    };
+
+    std::vector<route_entry> routes_;
+    std::shared_ptr<const message_handler> default_handler_;
+    std::shared_ptr<const logger_callback> logger_;
     log_level min_log_level_ = log_level::info;
+    std::shared_ptr<integration::thread_adapter> pool_;
+
+    // Per-route match counters by route ID; kept when a route is removed
+    std::unordered_map<std::string, std::shared_ptr<sharded_counter>> route_matches_;
+
+    // Published snapshot; accessed only through load_table()/publish()
+    internal::atomic_shared_ptr<const routing_table> table_;
+
+    // Routing statistics
+    std::shared_ptr<router_counters> counters_ = std::make_shared<router_counters>();
+
+    [[nodiscard]] bool has_handler(const std::string& id) const {
+        return handlers_.contains(id) || view_handlers_.contains(id);
+    }
+
+    [[nodiscard]] std::shared_ptr<const routing_table> load_table() const {
+        return table_.load();
+    }
+
+    /**
+     * @brief Compile the configuration into a new routing table
+     *
+     * Caller must hold mutex_.
+     */
+    void publish() {
+        auto table = std::make_shared<routing_table>();
+        table->routes.reserve(routes_.size());
+        for (const auto& [r, pattern] : routes_) {
+            compiled_route compiled;
+            compiled.definition = r;
+            compiled.pattern = pattern;
+            if (r->enabled) {
+                table->index.insert(static_cast<uint32_t>(table->routes.size()),
+                                    *pattern);
+            }
+            compiled.handlers.reserve(r->handler_ids.size());
+            for (const auto& handler_id : r->handler_ids) {
+                compiled_handler handler;
+                handler.id = handler_id;
+                if (auto it = handlers_.find(handler_id); it != handlers_.end()) {
+                    handler.message = it->second;
+                } else if (auto view_it = view_handlers_.find(handler_id);
+                           view_it != view_handlers_.end()) {
+                    handler.view = view_it->second;
+                }
+                compiled.handlers.push_back(std::move(handler));
+            }
+            auto& counter = route_matches_[r->id];
+            if (!counter) {
+                counter = std::make_shared<sharded_counter>();
+            }
+            compiled.matches = counter;
+            table->routes.push_back(std::move(compiled));
+        }
+        table->default_handler = default_handler_;
+        table->logger = logger_;
+        table->min_log_level = min_log_level_;
+        table->pool = pool_;
+        table->counters = counters_;
+
+        table_.store(std::shared_ptr<const routing_table>(std::move(table)));
+    }
+
+    [[nodiscard]] deferred_result route_source(message_source& source) const;
+
+    template <typename Span>
+    [[nodiscard]] std::expected<handler_result, router_error> dispatch(
+        const std::shared_ptr<const routing_table>& table, message_source& source,
+        Span& span,
+        std::future<std::expected<void, router_error>>& completion) const;
+
+    static chain_outcome run_chain(const routing_table& table,
+                                   const compiled_route& compiled,
+                                   message_source& source,
+                                   const std::string& control_id,
+                                   const std::string& msg_type);
+
+    /**
+     * @brief Build every representation compiled's handlers read
+     *
+     * @return false if the message cannot be converted for one of them
+     */
+    static bool prepare_source(const compiled_route& compiled,
+                               message_source& source) {
+        for (const auto& handler : compiled.handlers) {
+            if ((handler.message && !source.message()) ||
+                (handler.view && !source.view())) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static std::vector<chain_outcome> run_parallel(
+        const routing_table& table,
+        const std::vector<const compiled_route*>& routes, message_source& source,
+        const std::string& control_id, const std::string& msg_type);
+
+    static std::future<std::expected<void, router_error>> submit_async(
+        const std::shared_ptr<const routing_table>& table,
+        const std::vector<const compiled_route*>& routes,
+        const message_source& source, const std::string& control_id,
+        const std::string& msg_type);
 
     void sort_routes() {
-        std::sort(routes_.begin(), routes_.end(),
-                  [](const struct route& a, const struct route& b) {
-                      return a.priority < b.priority;
-                  });
+        std::stable_sort(routes_.begin(), routes_.end(),
+                         [](const auto& a, const auto& b) {
+                             return a.definition->priority < b.definition->priority;
+                         });
     }
 
-    void log(log_level level, const std::string& message_control_id,
-             const std::string& message_type, const std::string& route_id,
-             const std::string& handler_id, const std::string& message,
-             std::optional<int64_t> processing_time_us = std::nullopt) const {
-        if (level < min_log_level_) {
+    static void log(const routing_table& table, log_level level,
+                    const std::string& message_control_id,
+                    const std::string& message_type, const std::string& route_id,
+                    const std::string& handler_id, const std::string& message,
+                    std::optional<int64_t> processing_time_us = std::nullopt) {
+        if (level < table.min_log_level) {
             return;
         }
 
@@ -251,7 +781,7 @@ public:
         }
 
         // Also call custom callback if set
-        if (logger_) {
+        if (table.logger && *table.logger) {
             log_entry entry;
             entry.timestamp = std::chrono::system_clock::now();
             entry.level = level;
@@ -261,35 +791,43 @@ public:
             entry.handler_id = handler_id;
             entry.message = message;
             entry.processing_time_us = processing_time_us;
-            logger_(entry);
+            (*table.logger)(entry);
         }
     }
 
-    void log_debug(const std::string& message_control_id,
+    static void log_debug(const routing_table& table,
+                   const std::string& message_control_id,
                    const std::string& message_type,
-                   const std::string& message) const {
-        log(log_level::debug, message_control_id, message_type, "", "", message);
+                   const std::string& message) {
+        log(table, log_level::debug, message_control_id, message_type, "", "",
+            message);
     }
 
-    void log_info(const std::string& message_control_id,
+    static void log_info(const routing_table& table,
+                  const std::string& message_control_id,
                   const std::string& message_type,
                   const std::string& route_id,
-                  const std::string& message) const {
-        log(log_level::info, message_control_id, message_type, route_id, "", message);
+                  const std::string& message) {
+        log(table, log_level::info, message_control_id, message_type, route_id,
+            "", message);
     }
 
-    void log_warning(const std::string& message_control_id,
+    static void log_warning(const routing_table& table,
+                     const std::string& message_control_id,
                      const std::string& message_type,
-                     const std::string& message) const {
-        log(log_level::warning, message_control_id, message_type, "", "", message);
+                     const std::string& message) {
+        log(table, log_level::warning, message_control_id, message_type, "", "",
+            message);
     }
 
-    void log_error(const std::string& message_control_id,
+    static void log_error(const routing_table& table,
+                   const std::string& message_control_id,
                    const std::string& message_type,
                    const std::string& route_id,
                    const std::string& handler_id,
-                   const std::string& message) const {
-        log(log_level::error, message_control_id, message_type, route_id, handler_id, message);
+                   const std::string& message) {
+        log(table, log_level::error, message_control_id, message_type, route_id,
+            handler_id, message);
     }
 };
 
@@ -307,28 +845,60 @@ message_router& message_router::operator=(message_router&&) noexcept = default;
 bool message_router::register_handler(std::string_view id, message_handler handler) {
     std::lock_guard lock(pimpl_->mutex_);
 
-    auto [it, inserted] = pimpl_->handlers_.emplace(std::string(id), std::move(handler));
+    std::string key(id);
+    if (pimpl_->view_handlers_.contains(key)) {
+        return false;
+    }
+    auto [it, inserted] = pimpl_->handlers_.emplace(
+        std::move(key), std::make_shared<const message_handler>(std::move(handler)));
+    if (inserted) {
+        pimpl_->publish();
+    }
+    return inserted;
+}
+
+bool message_router::register_view_handler(std::string_view id,
+                                           view_handler handler) {
+    std::lock_guard lock(pimpl_->mutex_);
+
+    std::string key(id);
+    if (pimpl_->handlers_.contains(key)) {
+        return false;
+    }
+    auto [it, inserted] = pimpl_->view_handlers_.emplace(
+        std::move(key), std::make_shared<const view_handler>(std::move(handler)));
+    if (inserted) {
+        pimpl_->publish();
+    }
     return inserted;
 }
 
 bool message_router::unregister_handler(std::string_view id) {
     std::lock_guard lock(pimpl_->mutex_);
-    return pimpl_->handlers_.erase(std::string(id)) > 0;
+    std::string key(id);
+    if (pimpl_->handlers_.erase(key) + pimpl_->view_handlers_.erase(key) == 0) {
+        return false;
+    }
+    pimpl_->publish();
+    return true;
 }
 
 bool message_router::has_handler(std::string_view id) const noexcept {
     std::lock_guard lock(pimpl_->mutex_);
-    return pimpl_->handlers_.find(std::string(id)) != pimpl_->handlers_.end();
+    return pimpl_->has_handler(std::string(id));
 }
 
 std::vector<std::string> message_router::handler_ids() const {
     std::lock_guard lock(pimpl_->mutex_);
 
     std::vector<std::string> ids;
-    ids.reserve(pimpl_->handlers_.size());
+    ids.reserve(pimpl_->handlers_.size() + pimpl_->view_handlers_.size());
     for (const auto& [id, _] : pimpl_->handlers_) {
         ids.push_back(id);
     }
+    for (const auto& [id, _] : pimpl_->view_handlers_) {
+        ids.push_back(id);
+    }
     return ids;
 }
 
@@ -341,34 +911,28 @@ std::expected<void, router_error> message_router::add_route(const struct route&
 
     // Check for duplicate
     for (const auto& existing : pimpl_->routes_) {
-        if (existing.id == r.id) {
+        if (existing.definition->id == r.id) {
             return std::unexpected(router_error::route_exists);
         }
     }
 
     // Validate handler references
     for (const auto& handler_id : r.handler_ids) {
-        if (pimpl_->handlers_.find(handler_id) == pimpl_->handlers_.end()) {
+        if (!pimpl_->has_handler(handler_id)) {
             return std::unexpected(router_error::handler_not_found);
         }
     }
 
-    // Validate regex patterns if used
-    if (r.pattern.use_regex) {
-        try {
-            if (!r.pattern.message_type.empty()) {
-                std::regex(r.pattern.message_type);
-            }
-            if (!r.pattern.trigger_event.empty()) {
-                std::regex(r.pattern.trigger_event);
-            }
-        } catch (const std::regex_error&) {
-            return std::unexpected(router_error::invalid_pattern);
-        }
+    // Compile the pattern once; reject a regex that fails in any field
+    auto pattern = std::make_shared<const compiled_pattern>(r.pattern);
+    if (std::ranges::any_of(pattern->fields,
+                            [](const field_matcher& f) { return f.invalid(); })) {
+        return std::unexpected(router_error::invalid_pattern);
     }
 
-    pimpl_->routes_.push_back(r);
+    pimpl_->routes_.push_back({std::make_shared<struct route>(r), std::move(pattern)});
     pimpl_->sort_routes();
+    pimpl_->publish();
 
     return {};
 }
@@ -377,10 +941,13 @@ bool message_router::remove_route(std::string_view route_id) {
     std::lock_guard lock(pimpl_->mutex_);
 
     auto it = std::find_if(pimpl_->routes_.begin(), pimpl_->routes_.end(),
-                           [route_id](const struct route& r) { return r.id == route_id; });
+                           [route_id](const auto& r) {
+                               return r.definition->id == route_id;
+                           });
 
     if (it != pimpl_->routes_.end()) {
         pimpl_->routes_.erase(it);
+        pimpl_->publish();
         return true;
     }
     return false;
@@ -390,8 +957,12 @@ void message_router::set_route_enabled(std::string_view route_id, bool enabled)
     std::lock_guard lock(pimpl_->mutex_);
 
     for (auto& r : pimpl_->routes_) {
-        if (r.id == route_id) {
-            r.enabled = enabled;
+        if (r.definition->id == route_id) {
+            // Published tables share the definition; replace it, never mutate
+            auto updated = std::make_shared<struct route>(*r.definition);
+            updated->enabled = enabled;
+            r.definition = std::move(updated);
+            pimpl_->publish();
             break;
         }
     }
@@ -401,8 +972,8 @@ const route* message_router::get_route(std::string_view route_id) const {
     std::lock_guard lock(pimpl_->mutex_);
 
     for (const auto& r : pimpl_->routes_) {
-        if (r.id == route_id) {
-            return &r;
+        if (r.definition->id == route_id) {
+            return r.definition.get();
         }
     }
     return nullptr;
@@ -410,131 +981,427 @@ const route* message_router::get_route(std::string_view route_id) const {
 
 std::vector<route> message_router::routes() const {
     std::lock_guard lock(pimpl_->mutex_);
-    return pimpl_->routes_;
+
+    std::vector<struct route> result;
+    result.reserve(pimpl_->routes_.size());
+    for (const auto& r : pimpl_->routes_) {
+        result.push_back(*r.definition);
+    }
+    return result;
 }
 
 void message_router::clear_routes() {
     std::lock_guard lock(pimpl_->mutex_);
     pimpl_->routes_.clear();
+    pimpl_->publish();
+}
+
+std::expected<handler_result, router_error> message_router::route(
+    const hl7::hl7_message& message) const {
+    message_source source(message);
+    return pimpl_->route_source(source).result;
 }
 
 std::expected<handler_result, router_error> message_router::route(
+    const hl7::hl7_flat_message& message) const {
+    message_source source(message);
+    return pimpl_->route_source(source).result;
+}
+
+std::expected<handler_result, router_error> message_router::route(
+    const mllp::mllp_message& message, hl7::hl7_ingestion_mode mode) const {
+    std::string_view content(reinterpret_cast<const char*>(message.content.data()),
+                             message.content.size());
+
+    if (mode == hl7::hl7_ingestion_mode::lazy_view) {
+        auto view = hl7::hl7_flat_message::parse_borrowed(content);
+        if (!view) {
+            return std::unexpected(router_error::invalid_message);
+        }
+        return route(*view);
+    }
+
+    auto parsed = hl7::hl7_message::parse(content);
+    if (!parsed) {
+        return std::unexpected(router_error::invalid_message);
+    }
+    return route(*parsed);
+}
+
+message_router::deferred_result message_router::route_deferred(
     const hl7::hl7_message& message) const {
+    message_source source(message);
+    return pimpl_->route_source(source);
+}
+
+message_router::deferred_result message_router::route_deferred(
+    const hl7::hl7_flat_message& message) const {
+    message_source source(message);
+    return pimpl_->route_source(source);
+}
+
+message_router::deferred_result message_router::impl::route_source(
+    message_source& source) const {
     // Start tracing span
     auto span = tracing::trace_manager::instance().start_span(
         "hl7_route", tracing::span_kind::internal);
 
-    std::lock_guard lock(pimpl_->mutex_);
+    // Without mutex_: the table stays alive for this call even if replaced
+    auto table = load_table();
+
+    deferred_result deferred;
+    deferred.result = dispatch(table, source, span, deferred.completion);
+    if (!deferred.completion.valid()) {
+        std::promise<std::expected<void, router_error>> none;
+        none.set_value({});
+        deferred.completion = none.get_future();
+    }
+    if (source.materialized()) {
+        table->counters->materialized_messages.increment();
+    }
+    return deferred;
+}
+
+chain_outcome message_router::impl::run_chain(const routing_table& table,
+                                              const compiled_route& compiled,
+                                              message_source& source,
+                                              const std::string& control_id,
+                                              const std::string& msg_type) {
+    const auto& r = *compiled.definition;
+    chain_outcome outcome;
+
+    // No handler runs on a message some handler in the chain cannot read
+    if (!prepare_source(compiled, source)) {
+        log_error(table, control_id, msg_type, r.id, "",
+                  "Message could not be converted for the handler chain");
+        outcome.failed = true;
+        outcome.code = router_error::invalid_message;
+        outcome.error = "Invalid message";
+        return outcome;
+    }
+
+    for (const auto& handler : compiled.handlers) {
+        const std::string& handler_id = handler.id;
+        if (!handler.message && !handler.view) {
+            log_warning(table, control_id, msg_type,
+                        "Handler not found: " + handler_id);
+            continue;  // Handler removed since route was added
+        }
 
+        log_debug(table, control_id, msg_type,
+                  "Executing handler: " + handler_id);
+
+        try {
+            auto handler_start = std::chrono::steady_clock::now();
+            outcome.result = handler.message ? (*handler.message)(*source.message())
+                                             : (*handler.view)(*source.view());
+            auto handler_end = std::chrono::steady_clock::now();
+            auto handler_duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                handler_end - handler_start).count();
+
+            log(table, log_level::debug, control_id, msg_type, r.id, handler_id,
+                "Handler completed successfully",
+                handler_duration);
+        } catch (const std::exception& e) {
+            table.counters->handler_errors.increment();
+            log_error(table, control_id, msg_type, r.id, handler_id,
+                      std::string("Handler threw exception: ") + e.what());
+            outcome.failed = true;
+            outcome.error = std::string("Handler exception: ") + e.what();
+            return outcome;
+        }
+
+        if (!outcome.result->success) {
+            table.counters->handler_errors.increment();
+            log_error(table, control_id, msg_type, r.id, handler_id,
+                      "Handler returned error: " + outcome.result->error_message);
+            outcome.failed = true;
+            outcome.error = "Handler error: " + outcome.result->error_message;
+            return outcome;
+        }
+
+        if (!outcome.result->continue_chain) {
+            log_debug(table, control_id, msg_type,
+                      "Handler chain stopped by: " + handler_id);
+            break;  // Handler requested stop
+        }
+    }
+    return outcome;
+}
+
+std::vector<chain_outcome> message_router::impl::run_parallel(
+    const routing_table& table, const std::vector<const compiled_route*>& routes,
+    message_source& source, const std::string& control_id,
+    const std::string& msg_type) {
+    // Build every representation the chains read before sharing the
+    // source; a chain that cannot be served reports invalid_message
+    for (const auto* compiled : routes) {
+        (void)prepare_source(*compiled, source);
+    }
+
+    // A chain runs on whichever thread claims it first; the routing thread
+    // claims what the pool has not started, so a busy pool cannot stall it
+    struct parallel_task {
+        const compiled_route* route = nullptr;
+        std::atomic<bool> claimed{false};
+        std::promise<void> done;
+        chain_outcome outcome;
+    };
+
+    std::vector<std::shared_ptr<parallel_task>> tasks;
+    tasks.reserve(routes.size());
+    for (const auto* compiled : routes) {
+        auto task = std::make_shared<parallel_task>();
+        task->route = compiled;
+        tasks.push_back(std::move(task));
+    }
+
+    if (table.pool) {
+        for (size_t i = 1; i < tasks.size(); ++i) {
+            bool queued = table.pool->try_submit(
+                [&table, &source, &control_id, &msg_type, task = tasks[i]] {
+                    if (task->claimed.exchange(true)) {
+                        return;  // Run by the routing thread
+                    }
+                    try {
+                        task->outcome = run_chain(table, *task->route, source,
+                                                  control_id, msg_type);
+                    } catch (...) {
+                        task->outcome.failed = true;
+                        task->outcome.error = "Handler exception";
+                    }
+                    task->done.set_value();
+                });
+            if (!queued) {
+                break;  // Pool stopped; the routing thread claims the rest
+            }
+        }
+    }
+
+    std::vector<chain_outcome> outcomes;
+    outcomes.reserve(tasks.size());
+    for (auto& task : tasks) {
+        if (!task->claimed.exchange(true)) {
+            task->outcome = run_chain(table, *task->route, source, control_id,
+                                      msg_type);
+        } else {
+            task->done.get_future().wait();
+        }
+        outcomes.push_back(std::move(task->outcome));
+    }
+    return outcomes;
+}
+
+std::future<std::expected<void, router_error>> message_router::impl::submit_async(
+    const std::shared_ptr<const routing_table>& table,
+    const std::vector<const compiled_route*>& routes,
+    const message_source& source, const std::string& control_id,
+    const std::string& msg_type) {
+    struct async_batch {
+        std::atomic<size_t> remaining{0};
+        std::atomic<bool> failed{false};
+        std::atomic<router_error> error{router_error::handler_error};
+        std::promise<std::expected<void, router_error>> done;
+
+        // A chain dropped by the pool after it was queued never finishes
+        ~async_batch() {
+            if (remaining.load() != 0) {
+                done.set_value(std::unexpected(router_error::handler_error));
+            }
+        }
+
+        void finish(std::optional<router_error> chain_error) {
+            if (chain_error) {
+                error = *chain_error;
+                failed = true;
+            }
+            if (remaining.fetch_sub(1) == 1) {
+                if (failed) {
+                    done.set_value(std::unexpected(error.load()));
+                } else {
+                    done.set_value({});
+                }
+            }
+        }
+    };
+
+    auto batch = std::make_shared<async_batch>();
+    batch->remaining = routes.size();
+    auto completion = batch->done.get_future();
+
+    auto owned = source.copy();
+    if (!owned) {
+        batch->done.set_value(std::unexpected(router_error::invalid_message));
+        return completion;
+    }
+    for (const auto* compiled : routes) {
+        table->counters->async_chains.increment();
+        auto task = [table, compiled, owned, batch, control_id, msg_type] {
+            std::optional<router_error> chain_error = router_error::handler_error;
+            try {
+                auto chain_source = owned->source();
+                auto outcome = run_chain(*table, *compiled, chain_source,
+                                         control_id, msg_type);
+                if (!outcome.failed) {
+                    chain_error.reset();
+                } else {
+                    chain_error = outcome.code;
+                }
+            } catch (...) {
+                table->counters->handler_errors.increment();
+            }
+            batch->finish(chain_error);
+        };
+
+        // Without a pool, or once it has stopped, run the chain here
+        if (!table->pool || !table->pool->try_submit(task)) {
+            task();
+        }
+    }
+    return completion;
+}
+
+template <typename Span>
+std::expected<handler_result, router_error> message_router::impl::dispatch(
+    const std::shared_ptr<const routing_table>& table_ptr, message_source& source,
+    Span& span, std::future<std::expected<void, router_error>>& completion) const {
+    const auto& table = *table_ptr;
+    auto& counters = *table.counters;
     auto start_time = std::chrono::steady_clock::now();
 
-    ++pimpl_->stats_.total_messages;
+    counters.total_messages.increment();
 
-    // Extract message info for logging
-    auto header = message.header();
-    std::string control_id(message.control_id());
+    // Extract message info for logging; MSH is read once per message
+    const auto& header = source.header();
+    const std::string& control_id = header.message_control_id;
     std::string msg_type = header.full_message_type();
 
     // Add tracing attributes
     span.set_attribute("hl7.message_type", msg_type);
     span.set_attribute("hl7.control_id", control_id);
-    span.set_attribute("router.route_count", static_cast<int64_t>(pimpl_->routes_.size()));
+    span.set_attribute("router.route_count",
+                       static_cast<int64_t>(table.routes.size()));
 
-    pimpl_->log_debug(control_id, msg_type,
-                      "Routing message started");
+    log_debug(table, control_id, msg_type,
+              "Routing message started");
 
     handler_result final_result = handler_result::ok();
     bool any_matched = false;
-
-    // Try each route in priority order
-    for (const auto& r : pimpl_->routes_) {
-        if (!r.matches(message)) {
+    std::vector<const compiled_route*> parallel_routes;
+    std::vector<const compiled_route*> async_routes;
+
+    // Try each candidate route in priority order
+    std::vector<uint32_t> candidates;
+    table.index.candidates(header, candidates);
+    for (uint32_t position : candidates) {
+        const auto& compiled = table.routes[position];
+        const auto& r = *compiled.definition;
+        if (!compiled.pattern->matches(header)) {
             continue;
         }
-
-        any_matched = true;
-        ++pimpl_->stats_.matched_messages;
-        ++pimpl_->stats_.route_matches[r.id];
-
-        pimpl_->log_info(control_id, msg_type, r.id,
-                         "Route matched: " + r.name);
-
-        // Execute handler chain
-        for (const auto& handler_id : r.handler_ids) {
-            auto it = pimpl_->handlers_.find(handler_id);
-            if (it == pimpl_->handlers_.end()) {
-                pimpl_->log_warning(control_id, msg_type,
-                                    "Handler not found: " + handler_id);
-                continue;  // Handler removed since route was added
+        if (r.filter) {
+            const auto* message = source.message();
+            if (!message) {
+                log_error(table, control_id, msg_type, r.id, "",
+                          "Message could not be converted for the route filter");
+                span.set_error("Invalid message");
+                return std::unexpected(router_error::invalid_message);
             }
+            if (!r.filter(*message)) {
+                continue;
+            }
+        }
 
-            pimpl_->log_debug(control_id, msg_type,
-                              "Executing handler: " + handler_id);
+        any_matched = true;
+        counters.matched_messages.increment();
+        compiled.matches->increment();
 
-            try {
-                auto handler_start = std::chrono::steady_clock::now();
-                final_result = it->second(message);
-                auto handler_end = std::chrono::steady_clock::now();
-                auto handler_duration = std::chrono::duration_cast<std::chrono::microseconds>(
-                    handler_end - handler_start).count();
-
-                pimpl_->log(log_level::debug, control_id, msg_type, r.id, handler_id,
-                            "Handler completed successfully",
-                            handler_duration);
-            } catch (const std::exception& e) {
-                ++pimpl_->stats_.handler_errors;
-                pimpl_->log_error(control_id, msg_type, r.id, handler_id,
-                                  std::string("Handler threw exception: ") + e.what());
-                span.set_attribute("router.matched_route", r.id);
-                span.set_error(std::string("Handler exception: ") + e.what());
-                return std::unexpected(router_error::handler_error);
-            }
+        log_info(table, control_id, msg_type, r.id,
+                 "Route matched: " + r.name);
 
-            if (!final_result.success) {
-                ++pimpl_->stats_.handler_errors;
-                pimpl_->log_error(control_id, msg_type, r.id, handler_id,
-                                  "Handler returned error: " + final_result.error_message);
+        if (r.execution == execution_policy::parallel) {
+            parallel_routes.push_back(&compiled);
+        } else if (r.execution == execution_policy::async) {
+            async_routes.push_back(&compiled);
+        } else {
+            // Execute handler chain
+            auto outcome = run_chain(table, compiled, source, control_id, msg_type);
+            if (outcome.failed) {
                 span.set_attribute("router.matched_route", r.id);
-                span.set_error("Handler error: " + final_result.error_message);
-                return std::unexpected(router_error::handler_error);
+                span.set_error(outcome.error);
+                return std::unexpected(outcome.code);
             }
-
-            if (!final_result.continue_chain) {
-                pimpl_->log_debug(control_id, msg_type,
-                                  "Handler chain stopped by: " + handler_id);
-                break;  // Handler requested stop
+            if (outcome.result) {
+                final_result = std::move(*outcome.result);
             }
         }
 
         if (r.terminal || !final_result.continue_chain) {
             if (r.terminal) {
-                pimpl_->log_debug(control_id, msg_type,
-                                  "Terminal route reached: " + r.id);
+                log_debug(table, control_id, msg_type,
+                          "Terminal route reached: " + r.id);
             }
             break;  // Terminal route or handler requested stop
         }
     }
 
+    // Async routes do not hold up the result
+    if (!async_routes.empty()) {
+        completion = submit_async(table_ptr, async_routes, source, control_id,
+                                  msg_type);
+        span.set_attribute("router.async_routes",
+                           static_cast<int64_t>(async_routes.size()));
+    }
+
+    // Fan out parallel routes and aggregate their results
+    if (!parallel_routes.empty()) {
+        auto outcomes = run_parallel(table, parallel_routes, source, control_id,
+                                     msg_type);
+        for (size_t i = 0; i < outcomes.size(); ++i) {
+            if (outcomes[i].failed) {
+                span.set_attribute("router.matched_route",
+                                   parallel_routes[i]->definition->id);
+                span.set_error(outcomes[i].error);
+                return std::unexpected(outcomes[i].code);
+            }
+        }
+        for (auto& outcome : outcomes) {
+            if (!final_result.response && outcome.result &&
+                outcome.result->response) {
+                final_result.response = std::move(outcome.result->response);
+            }
+        }
+        span.set_attribute("router.parallel_routes",
+                           static_cast<int64_t>(parallel_routes.size()));
+    }
+
     // Use default handler if no matches
     if (!any_matched) {
-        if (pimpl_->default_handler_) {
-            ++pimpl_->stats_.default_handled;
-            pimpl_->log_warning(control_id, msg_type,
-                                "No matching route, using default handler");
+        if (table.default_handler && *table.default_handler) {
+            counters.default_handled.increment();
+            log_warning(table, control_id, msg_type,
+                        "No matching route, using default handler");
             span.set_attribute("router.used_default", true);
+            const auto* message = source.message();
+            if (!message) {
+                log_error(table, control_id, msg_type, "", "default",
+                          "Message could not be converted for the default handler");
+                span.set_error("Invalid message");
+                return std::unexpected(router_error::invalid_message);
+            }
             try {
-                final_result = pimpl_->default_handler_(message);
+                final_result = (*table.default_handler)(*message);
             } catch (const std::exception& e) {
-                ++pimpl_->stats_.handler_errors;
-                pimpl_->log_error(control_id, msg_type, "", "default",
-                                  std::string("Default handler threw exception: ") + e.what());
+                counters.handler_errors.increment();
+                log_error(table, control_id, msg_type, "", "default",
+                          std::string("Default handler threw exception: ") + e.what());
                 span.set_error(std::string("Default handler exception: ") + e.what());
                 return std::unexpected(router_error::handler_error);
             }
         } else {
-            ++pimpl_->stats_.unhandled_messages;
-            pimpl_->log_warning(control_id, msg_type,
-                                "No matching route and no default handler");
+            counters.unhandled_messages.increment();
+            log_warning(table, control_id, msg_type,
+                        "No matching route and no default handler");
             span.set_attribute("router.matched", false);
             span.set_error("No matching route");
             return std::unexpected(router_error::no_matching_route);
@@ -549,19 +1416,25 @@ std::expected<handler_result, router_error> message_router::route(
 
     span.set_attribute("router.duration_us", static_cast<int64_t>(total_duration));
 
-    pimpl_->log(log_level::info, control_id, msg_type, "", "",
-                "Routing completed successfully", total_duration);
+    log(table, log_level::info, control_id, msg_type, "", "",
+        "Routing completed successfully", total_duration);
 
     return final_result;
 }
 
 std::vector<std::string> message_router::find_matching_routes(
     const hl7::hl7_message& message) const {
-    std::lock_guard lock(pimpl_->mutex_);
+    auto table = pimpl_->load_table();
+    const auto header = message.header();
+
+    std::vector<uint32_t> candidates;
+    table->index.candidates(header, candidates);
 
     std::vector<std::string> matches;
-    for (const auto& r : pimpl_->routes_) {
-        if (r.matches(message)) {
+    for (uint32_t position : candidates) {
+        const auto& compiled = table->routes[position];
+        const auto& r = *compiled.definition;
+        if (compiled.pattern->matches(header) && (!r.filter || r.filter(message))) {
             matches.push_back(r.id);
         }
     }
@@ -570,49 +1443,94 @@ std::vector<std::string> message_router::find_matching_routes(
 
 bool message_router::has_matching_route(
     const hl7::hl7_message& message) const noexcept {
-    std::lock_guard lock(pimpl_->mutex_);
+    auto table = pimpl_->load_table();
+    const auto header = message.header();
 
-    for (const auto& r : pimpl_->routes_) {
-        if (r.matches(message)) {
+    std::vector<uint32_t> candidates;
+    table->index.candidates(header, candidates);
+
+    for (uint32_t position : candidates) {
+        const auto& compiled = table->routes[position];
+        const auto& r = *compiled.definition;
+        if (compiled.pattern->matches(header) && (!r.filter || r.filter(message))) {
             return true;
         }
     }
     return false;
 }
 
+void message_router::set_worker_pool(
+    std::shared_ptr<integration::thread_adapter> pool) {
+    std::lock_guard lock(pimpl_->mutex_);
+    pimpl_->pool_ = std::move(pool);
+    pimpl_->publish();
+}
+
 void message_router::set_default_handler(message_handler handler) {
     std::lock_guard lock(pimpl_->mutex_);
-    pimpl_->default_handler_ = std::move(handler);
+    pimpl_->default_handler_ =
+        std::make_shared<const message_handler>(std::move(handler));
+    pimpl_->publish();
 }
 
 void message_router::clear_default_handler() {
     std::lock_guard lock(pimpl_->mutex_);
     pimpl_->default_handler_ = nullptr;
+    pimpl_->publish();
 }
 
 message_router::statistics message_router::get_statistics() const {
+    const auto& counters = *pimpl_->counters_;
+    statistics stats;
+    stats.total_messages = counters.total_messages.load();
+    stats.matched_messages = counters.matched_messages.load();
+    stats.default_handled = counters.default_handled.load();
+    stats.unhandled_messages = counters.unhandled_messages.load();
+    stats.handler_errors = counters.handler_errors.load();
+    stats.materialized_messages = counters.materialized_messages.load();
+    stats.async_chains = counters.async_chains.load();
+
     std::lock_guard lock(pimpl_->mutex_);
-    return pimpl_->stats_;
+    for (const auto& [id, counter] : pimpl_->route_matches_) {
+        if (auto count = counter->load(); count > 0) {
+            stats.route_matches.emplace(id, count);
+        }
+    }
+    return stats;
 }
 
 void message_router::reset_statistics() {
+    auto& counters = *pimpl_->counters_;
+    counters.total_messages.reset();
+    counters.matched_messages.reset();
+    counters.default_handled.reset();
+    counters.unhandled_messages.reset();
+    counters.handler_errors.reset();
+    counters.materialized_messages.reset();
+    counters.async_chains.reset();
+
     std::lock_guard lock(pimpl_->mutex_);
-    pimpl_->stats_ = statistics{};
+    for (const auto& [id, counter] : pimpl_->route_matches_) {
+        counter->reset();
+    }
 }
 
 void message_router::set_logger(logger_callback callback) {
     std::lock_guard lock(pimpl_->mutex_);
-    pimpl_->logger_ = std::move(callback);
+    pimpl_->logger_ = std::make_shared<const logger_callback>(std::move(callback));
+    pimpl_->publish();
 }
 
 void message_router::clear_logger() {
     std::lock_guard lock(pimpl_->mutex_);
     pimpl_->logger_ = nullptr;
+    pimpl_->publish();
 }
 
 void message_router::set_log_level(log_level level) {
     std::lock_guard lock(pimpl_->mutex_);
     pimpl_->min_log_level_ = level;
+    pimpl_->publish();
 }
 
 message_router::log_level message_router::get_log_level() const noexcept {
@@ -695,6 +1613,11 @@ route_builder& route_builder::terminal(bool t) {
     return *this;
 }
 
+route_builder& route_builder::execution(execution_policy policy) {
+    route_.execution = policy;
+    return *this;
+}
+
 route_builder& route_builder::filter(message_filter f) {
     route_.filter = std::move(f);
     return *this;
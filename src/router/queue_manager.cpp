@@ -8,16 +8,22 @@
 #include "pacs/bridge/monitoring/bridge_metrics.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <ctime>
 #include <future>
 #include <iomanip>
+#include <map>
 #include <mutex>
+#include <optional>
 #include <random>
 #include <sstream>
 #include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 // Database adapter for standardized database access
@@ -26,6 +32,9 @@
 // Thread adapter for centralized thread management (Phase 3a migration)
 #include "pacs/bridge/integration/thread_adapter.h"
 
+// Append-only segment files (queue_persistence::segmented_log)
+#include "segment_log.h"
+
 namespace pacs::bridge::router {
 
 // =============================================================================
@@ -155,6 +164,40 @@ std::chrono::system_clock::time_point from_sqlite_timestamp(const std::string& s
            std::chrono::milliseconds(millis);
 }
 
+/**
+ * @brief Timestamp encoding of the queue tables
+ *
+ * Tables created with queue_timestamp_format::epoch_micros store INTEGER
+ * microseconds since the epoch, so range scans on scheduled_at compare
+ * integers and rows are read without parsing. Otherwise timestamps are
+ * "YYYY-MM-DD HH:MM:SS.mmm" text.
+ */
+struct timestamp_codec {
+    bool epoch_micros = false;
+
+    std::expected<void, integration::database_error>
+    bind(integration::database_statement& stmt, std::size_t index,
+         std::chrono::system_clock::time_point tp) const {
+        if (epoch_micros) {
+            return stmt.bind_int64(
+                index,
+                std::chrono::duration_cast<std::chrono::microseconds>(tp.time_since_epoch())
+                    .count());
+        }
+        return stmt.bind_string(index, to_sqlite_timestamp(tp));
+    }
+
+    std::chrono::system_clock::time_point read(const integration::database_row& row,
+                                               std::size_t index) const {
+        if (epoch_micros) {
+            return std::chrono::system_clock::time_point{
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::microseconds{row.get_int64(index)})};
+        }
+        return from_sqlite_timestamp(row.get_string(index));
+    }
+};
+
 /**
  * @brief Calculate next retry delay with exponential backoff
  */
@@ -175,6 +218,917 @@ std::chrono::seconds calculate_retry_delay(int attempt_count,
     return std::min(calculated, max_delay);
 }
 
+/**
+ * @brief Atomically claim ready messages (all destinations)
+ *
+ * Parameters: 1 processing state, 2 pending state, 3 retry_scheduled state,
+ * 4 current timestamp, 5 limit.
+ */
+constexpr const char* CLAIM_SQL =
+    "UPDATE message_queue SET state = ?1, attempt_count = attempt_count + 1 "
+    "WHERE id IN (SELECT id FROM message_queue "
+    "WHERE (state = ?2 OR (state = ?3 AND scheduled_at <= ?4)) "
+    "ORDER BY priority ASC, scheduled_at ASC LIMIT ?5) "
+    "RETURNING id, destination, payload, priority, state, created_at, "
+    "scheduled_at, attempt_count, last_error, correlation_id, message_type";
+
+/**
+ * @brief Atomically claim ready messages for one destination (?6)
+ */
+constexpr const char* CLAIM_DESTINATION_SQL =
+    "UPDATE message_queue SET state = ?1, attempt_count = attempt_count + 1 "
+    "WHERE id IN (SELECT id FROM message_queue "
+    "WHERE (state = ?2 OR (state = ?3 AND scheduled_at <= ?4)) "
+    "AND destination = ?6 "
+    "ORDER BY priority ASC, scheduled_at ASC LIMIT ?5) "
+    "RETURNING id, destination, payload, priority, state, created_at, "
+    "scheduled_at, attempt_count, last_error, correlation_id, message_type";
+
+/**
+ * @brief Build a queued_message from a message_queue row
+ *
+ * Expects columns in CLAIM_SQL RETURNING order.
+ */
+queued_message read_message(const integration::database_row& row,
+                            const timestamp_codec& times) {
+    queued_message msg;
+    msg.id = row.get_string(0);
+    msg.destination = row.get_string(1);
+    msg.payload = row.get_string(2);
+    msg.priority = static_cast<int>(row.get_int64(3));
+    msg.state = static_cast<message_state>(row.get_int64(4));
+    msg.created_at = times.read(row, 5);
+    msg.scheduled_at = times.read(row, 6);
+    msg.attempt_count = static_cast<int>(row.get_int64(7));
+
+    if (!row.is_null(8)) msg.last_error = row.get_string(8);
+    if (!row.is_null(9)) msg.correlation_id = row.get_string(9);
+    if (!row.is_null(10)) msg.message_type = row.get_string(10);
+
+    return msg;
+}
+
+/**
+ * @brief Hashed timing wheel of scheduled retry times
+ *
+ * Tracks only due times; the messages themselves stay in the database and
+ * are claimed once due. Each slot covers one tick, and entries more than one
+ * revolution ahead carry the number of remaining revolutions.
+ */
+class retry_timer_wheel {
+public:
+    using clock = std::chrono::steady_clock;
+
+    static constexpr clock::duration tick = std::chrono::milliseconds{100};
+    static constexpr size_t slot_count = 512;
+
+    explicit retry_timer_wheel(clock::time_point origin) : origin_(origin) {}
+
+    /**
+     * @brief Track a due time
+     *
+     * @return false if the time is already due (nothing is tracked)
+     */
+    bool schedule(clock::time_point due) {
+        const uint64_t due_tick = tick_ceil(due);
+        if (due_tick <= current_tick_) {
+            return false;
+        }
+        const uint64_t ahead = due_tick - current_tick_;
+        slots_[due_tick % slot_count].push_back((ahead - 1) / slot_count);
+        ++size_;
+        return true;
+    }
+
+    /**
+     * @brief Advance the wheel to now
+     *
+     * @return Number of tracked times that became due
+     */
+    size_t advance(clock::time_point now) {
+        const uint64_t target = tick_floor(now);
+        size_t expired = 0;
+        while (current_tick_ < target && size_ > 0) {
+            ++current_tick_;
+            auto& slot = slots_[current_tick_ % slot_count];
+            size_t kept = 0;
+            for (uint64_t rounds : slot) {
+                if (rounds == 0) {
+                    ++expired;
+                } else {
+                    slot[kept++] = rounds - 1;
+                }
+            }
+            size_ -= slot.size() - kept;
+            slot.resize(kept);
+        }
+        current_tick_ = std::max(current_tick_, target);
+        return expired;
+    }
+
+    /**
+     * @brief Time at which the next tracked slot expires
+     */
+    [[nodiscard]] std::optional<clock::time_point> next_deadline() const {
+        if (size_ == 0) {
+            return std::nullopt;
+        }
+        for (uint64_t t = current_tick_ + 1; t <= current_tick_ + slot_count; ++t) {
+            if (!slots_[t % slot_count].empty()) {
+                return origin_ + tick * static_cast<int64_t>(t);
+            }
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+private:
+    uint64_t tick_floor(clock::time_point tp) const {
+        return tp <= origin_ ? 0 : static_cast<uint64_t>((tp - origin_) / tick);
+    }
+
+    uint64_t tick_ceil(clock::time_point tp) const {
+        return tp <= origin_
+                   ? 0
+                   : static_cast<uint64_t>((tp - origin_ + tick - clock::duration{1}) / tick);
+    }
+
+    clock::time_point origin_;
+    uint64_t current_tick_ = 0;
+    size_t size_ = 0;
+    std::array<std::vector<uint64_t>, slot_count> slots_;
+};
+
+/**
+ * @brief In-memory message tier for queue_persistence::hot_tier
+ *
+ * Holds every queued message by id. Ready messages are ordered per
+ * destination by (priority, scheduled_at, arrival); scheduled retries wait
+ * in a per-destination due-time index until they are due. Processing
+ * messages are held by id only. Not thread-safe.
+ */
+class hot_message_tier {
+public:
+    using time_point = std::chrono::system_clock::time_point;
+
+    /**
+     * @brief Add or replace a pending or retry_scheduled message
+     */
+    void insert(queued_message msg) {
+        std::string id = msg.id;
+        auto [it, inserted] = entries_.try_emplace(std::move(id));
+        if (!inserted) {
+            unlink(it->second);
+        }
+        it->second.msg = std::move(msg);
+        link(it->first, it->second);
+    }
+
+    /**
+     * @brief Claim up to count ready messages in priority order
+     *
+     * Claimed messages become processing with attempt_count incremented.
+     */
+    std::vector<queued_message> claim(size_t count, std::string_view destination,
+                                      time_point now) {
+        std::vector<destination_queue*> queues;
+        if (destination.empty()) {
+            for (auto& [name, queue] : destinations_) {
+                queues.push_back(&queue);
+            }
+        } else if (auto it = destinations_.find(destination); it != destinations_.end()) {
+            queues.push_back(&it->second);
+        }
+        for (auto* queue : queues) {
+            promote(*queue, now);
+        }
+
+        std::vector<queued_message> claimed;
+        while (claimed.size() < count) {
+            destination_queue* best = nullptr;
+            for (auto* queue : queues) {
+                if (!queue->ready.empty() &&
+                    (!best || queue->ready.begin()->first < best->ready.begin()->first)) {
+                    best = queue;
+                }
+            }
+            if (!best) break;
+
+            auto node = best->ready.begin();
+            auto& entry = entries_.at(node->second);
+            best->ready.erase(node);
+            entry.index = index_kind::none;
+
+            entry.msg.state = message_state::processing;
+            entry.msg.attempt_count++;
+            claimed.push_back(entry.msg);
+        }
+        return claimed;
+    }
+
+    /**
+     * @brief Remove a message
+     * @return The removed message, or nullopt if unknown
+     */
+    std::optional<queued_message> remove(const std::string& id) {
+        auto it = entries_.find(id);
+        if (it == entries_.end()) return std::nullopt;
+        unlink(it->second);
+        auto msg = std::move(it->second.msg);
+        entries_.erase(it);
+        return msg;
+    }
+
+    /**
+     * @brief Schedule a processing message for retry
+     * @return The updated message, or nullopt if unknown
+     */
+    std::optional<queued_message> reschedule(const std::string& id, time_point due,
+                                             std::string_view error) {
+        auto it = entries_.find(id);
+        if (it == entries_.end()) return std::nullopt;
+        unlink(it->second);
+        auto& msg = it->second.msg;
+        msg.state = message_state::retry_scheduled;
+        msg.scheduled_at = due;
+        msg.last_error = std::string(error);
+        link(it->first, it->second);
+        return msg;
+    }
+
+    /**
+     * @brief Return a processing message to pending, undoing its claim
+     * @return The updated message, or nullopt if not processing
+     */
+    std::optional<queued_message> release(const std::string& id) {
+        auto it = entries_.find(id);
+        if (it == entries_.end() || it->second.msg.state != message_state::processing) {
+            return std::nullopt;
+        }
+        auto& msg = it->second.msg;
+        msg.state = message_state::pending;
+        msg.attempt_count--;
+        link(it->first, it->second);
+        return msg;
+    }
+
+    /**
+     * @brief Return every processing message to pending
+     * @return The updated messages
+     */
+    std::vector<queued_message> reset_processing(time_point now) {
+        std::vector<queued_message> reset;
+        for (auto& [id, entry] : entries_) {
+            if (entry.msg.state != message_state::processing) continue;
+            entry.msg.state = message_state::pending;
+            entry.msg.scheduled_at = now;
+            link(id, entry);
+            reset.push_back(entry.msg);
+        }
+        return reset;
+    }
+
+    [[nodiscard]] std::optional<queued_message> find(const std::string& id) const {
+        auto it = entries_.find(id);
+        if (it == entries_.end()) return std::nullopt;
+        return it->second.msg;
+    }
+
+    /**
+     * @brief Pending and retry_scheduled messages in delivery order
+     */
+    [[nodiscard]] std::vector<queued_message> pending(std::string_view destination,
+                                                      size_t limit) const {
+        std::vector<queued_message> results;
+        for (const auto& [name, queue] : destinations_) {
+            if (!destination.empty() && name != destination) continue;
+            for (const auto& [key, id] : queue.ready) {
+                results.push_back(entries_.at(id).msg);
+            }
+            for (const auto& [key, id] : queue.delayed) {
+                results.push_back(entries_.at(id).msg);
+            }
+        }
+        std::sort(results.begin(), results.end(),
+                  [](const queued_message& a, const queued_message& b) {
+                      return std::tie(a.priority, a.scheduled_at) <
+                             std::tie(b.priority, b.scheduled_at);
+                  });
+        if (results.size() > limit) {
+            results.resize(limit);
+        }
+        return results;
+    }
+
+    /**
+     * @brief Number of pending and retry_scheduled messages
+     */
+    [[nodiscard]] size_t depth(std::string_view destination) const {
+        size_t total = 0;
+        for (const auto& [name, queue] : destinations_) {
+            if (!destination.empty() && name != destination) continue;
+            total += queue.ready.size() + queue.delayed.size();
+        }
+        return total;
+    }
+
+    /**
+     * @brief Ids of messages created before cutoff
+     */
+    [[nodiscard]] std::vector<std::string> created_before(time_point cutoff) const {
+        std::vector<std::string> ids;
+        for (const auto& [id, entry] : entries_) {
+            if (entry.msg.created_at < cutoff) {
+                ids.push_back(id);
+            }
+        }
+        return ids;
+    }
+
+    /**
+     * @brief Due times of retry_scheduled messages
+     */
+    [[nodiscard]] std::vector<time_point> retry_times() const {
+        std::vector<time_point> times;
+        for (const auto& [name, queue] : destinations_) {
+            for (const auto& [key, id] : queue.delayed) {
+                times.push_back(key.first);
+            }
+        }
+        return times;
+    }
+
+    /**
+     * @brief Fill the per-state counts and depth_by_destination of stats
+     */
+    void count(queue_statistics& stats) const {
+        for (const auto& [id, entry] : entries_) {
+            switch (entry.msg.state) {
+                case message_state::pending:
+                    stats.pending_count++;
+                    break;
+                case message_state::processing:
+                    stats.processing_count++;
+                    break;
+                case message_state::retry_scheduled:
+                    stats.retry_scheduled_count++;
+                    break;
+                default:
+                    break;
+            }
+        }
+        stats.depth_by_destination.clear();
+        for (const auto& [name, queue] : destinations_) {
+            if (queue.held > 0) {
+                stats.depth_by_destination.emplace_back(name, queue.held);
+            }
+        }
+    }
+
+    /**
+     * @brief Destinations with at least one message
+     */
+    [[nodiscard]] std::vector<std::string> destinations() const {
+        std::vector<std::string> results;
+        for (const auto& [name, queue] : destinations_) {
+            if (queue.held > 0) {
+                results.push_back(name);
+            }
+        }
+        return results;
+    }
+
+private:
+    using ready_key = std::tuple<int, time_point, uint64_t>;
+    using delayed_key = std::pair<time_point, uint64_t>;
+
+    enum class index_kind { none, ready, delayed };
+
+    struct entry {
+        queued_message msg;
+        uint64_t seq = 0;
+        index_kind index = index_kind::none;
+        bool counted = false;
+    };
+
+    struct destination_queue {
+        std::map<ready_key, std::string> ready;
+        std::map<delayed_key, std::string> delayed;
+        size_t held = 0;
+    };
+
+    void link(const std::string& id, entry& e) {
+        auto& queue = destinations_[e.msg.destination];
+        if (!e.counted) {
+            queue.held++;
+            e.counted = true;
+        }
+        e.seq = ++next_seq_;
+        if (e.msg.state == message_state::retry_scheduled) {
+            queue.delayed.emplace(delayed_key{e.msg.scheduled_at, e.seq}, id);
+            e.index = index_kind::delayed;
+        } else {
+            queue.ready.emplace(ready_key{e.msg.priority, e.msg.scheduled_at, e.seq}, id);
+            e.index = index_kind::ready;
+        }
+    }
+
+    void unlink(entry& e) {
+        auto it = destinations_.find(e.msg.destination);
+        if (it == destinations_.end()) return;
+        auto& queue = it->second;
+        if (e.index == index_kind::ready) {
+            queue.ready.erase(ready_key{e.msg.priority, e.msg.scheduled_at, e.seq});
+        } else if (e.index == index_kind::delayed) {
+            queue.delayed.erase(delayed_key{e.msg.scheduled_at, e.seq});
+        }
+        e.index = index_kind::none;
+        if (e.counted) {
+            queue.held--;
+            e.counted = false;
+        }
+    }
+
+    void promote(destination_queue& queue, time_point now) {
+        while (!queue.delayed.empty() && queue.delayed.begin()->first.first <= now) {
+            auto node = queue.delayed.begin();
+            auto& e = entries_.at(node->second);
+            queue.ready.emplace(ready_key{e.msg.priority, e.msg.scheduled_at, e.seq},
+                                node->second);
+            e.index = index_kind::ready;
+            queue.delayed.erase(node);
+        }
+    }
+
+    std::unordered_map<std::string, entry> entries_;
+    std::map<std::string, destination_queue, std::less<>> destinations_;
+    uint64_t next_seq_ = 0;
+};
+
+/**
+ * @brief Group-commit writer behind the hot tier
+ *
+ * Collects writes keyed by id, so later writes to a message replace
+ * earlier ones and an insert followed by a delete cancels out. A background
+ * thread hands each batch to the backend's commit(). A batch is committed at
+ * once when a caller is waiting for durability, otherwise after the commit
+ * interval or when max_batch writes are pending. Failed batches are retried;
+ * once max_attempts commits in a row have failed, each further failure
+ * releases the waiters of the writes it held.
+ *
+ * Backends implement open(), commit() and close(), and call stop() from
+ * their destructor.
+ */
+class group_commit_writer {
+public:
+    group_commit_writer(std::chrono::milliseconds interval, size_t max_batch,
+                        size_t max_attempts)
+        : interval_(interval), max_batch_(max_batch), max_attempts_(max_attempts) {}
+
+    virtual ~group_commit_writer() = default;
+
+    group_commit_writer(const group_commit_writer&) = delete;
+    group_commit_writer& operator=(const group_commit_writer&) = delete;
+
+    /**
+     * @brief Open the backend and start the commit thread
+     */
+    bool start() {
+        if (!open()) {
+            return false;
+        }
+        thread_ = std::thread([this]() { run(); });
+        return true;
+    }
+
+    /**
+     * @brief Commit everything pending and stop the commit thread
+     */
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        work_cv_.notify_one();
+        if (thread_.joinable()) {
+            thread_.join();
+            close();
+        }
+    }
+
+    /**
+     * @brief Record a message write
+     *
+     * @param new_row true if the message is not stored yet
+     * @return Write sequence number for wait_durable()
+     */
+    uint64_t upsert(const queued_message& msg, bool new_row) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        upsert_locked(msg, new_row);
+        return record_write();
+    }
+
+    /**
+     * @brief Record a message delete
+     * @return Write sequence number for wait_durable()
+     */
+    uint64_t remove(const std::string& id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        remove_locked(id);
+        return record_write();
+    }
+
+    /**
+     * @brief Record a message moving to the dead letter queue
+     *
+     * The delete and the dead letter are committed in the same batch.
+     */
+    uint64_t dead_letter(const dead_letter_entry& entry) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        remove_locked(entry.message.id);
+        pending_.dead_letters.insert_or_assign(entry.message.id, entry);
+        return record_write();
+    }
+
+    /**
+     * @brief Record a dead letter returning to the queue as msg
+     */
+    uint64_t restore(const queued_message& msg) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.dead_letters.insert_or_assign(msg.id, std::nullopt);
+        upsert_locked(msg, true);
+        return record_write();
+    }
+
+    /**
+     * @brief Record a dead letter delete
+     */
+    uint64_t remove_dead_letter(const std::string& id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.dead_letters.insert_or_assign(id, std::nullopt);
+        return record_write();
+    }
+
+    /**
+     * @brief Ask the commit thread to run backend maintenance
+     */
+    void request_maintenance() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            maintenance_requested_ = true;
+        }
+        work_cv_.notify_one();
+    }
+
+    /**
+     * @brief Block until the write with sequence seq is committed
+     *
+     * @return false if the writer stopped, or the batch holding the write
+     *         failed max_attempts times in a row; the write stays pending,
+     *         so callers that give up on it must record a compensating write
+     */
+    bool wait_durable(uint64_t seq) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (committed_seq_ >= seq) {
+            return true;
+        }
+        urgent_ = true;
+        work_cv_.notify_one();
+        done_cv_.wait(lock, [&]() {
+            return committed_seq_ >= seq || abandoned_seq_ >= seq || stopped_;
+        });
+        return committed_seq_ >= seq;
+    }
+
+    /**
+     * @brief Block until every recorded write is committed
+     */
+    bool flush() {
+        uint64_t seq;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            seq = next_seq_;
+        }
+        return wait_durable(seq);
+    }
+
+protected:
+    struct pending_write {
+        std::optional<queued_message> row;  // nullopt = delete
+        bool new_row = false;
+    };
+
+    struct batch_type {
+        std::unordered_map<std::string, pending_write> messages;
+        std::unordered_map<std::string, std::optional<dead_letter_entry>> dead_letters;
+
+        [[nodiscard]] bool empty() const noexcept {
+            return messages.empty() && dead_letters.empty();
+        }
+        [[nodiscard]] size_t size() const noexcept {
+            return messages.size() + dead_letters.size();
+        }
+    };
+
+    /** Prepare the backend (called before the commit thread starts) */
+    virtual bool open() = 0;
+
+    /** Persist one batch atomically */
+    virtual bool commit(const batch_type& batch) = 0;
+
+    /**
+     * @brief Housekeeping after a successful commit (commit thread)
+     *
+     * @param requested true if request_maintenance() was called
+     */
+    virtual void maintain(bool requested) { (void)requested; }
+
+    /** Release the backend (after the commit thread stopped) */
+    virtual void close() {}
+
+private:
+    void upsert_locked(const queued_message& msg, bool new_row) {
+        auto [it, inserted] = pending_.messages.try_emplace(msg.id);
+        if (inserted) {
+            it->second.new_row = new_row;
+        }
+        it->second.row = msg;
+    }
+
+    void remove_locked(const std::string& id) {
+        auto it = pending_.messages.find(id);
+        if (it == pending_.messages.end()) {
+            pending_.messages.emplace(id, pending_write{});
+        } else if (it->second.new_row) {
+            pending_.messages.erase(it);
+        } else {
+            it->second.row.reset();
+        }
+    }
+
+    uint64_t record_write() {
+        if (pending_.size() == 1 || pending_.size() >= max_batch_) {
+            work_cv_.notify_one();
+        }
+        return ++next_seq_;
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            work_cv_.wait(lock, [this]() {
+                return stopping_ || maintenance_requested_ || !pending_.empty() ||
+                       committed_seq_ < next_seq_;
+            });
+            if (!stopping_ && !urgent_ && !maintenance_requested_ &&
+                pending_.size() < max_batch_) {
+                work_cv_.wait_for(lock, interval_, [this]() {
+                    return stopping_ || urgent_ || pending_.size() >= max_batch_;
+                });
+            }
+            if (stopping_ && pending_.empty()) {
+                committed_seq_ = next_seq_;
+                break;
+            }
+
+            batch_type batch = std::exchange(pending_, {});
+            const uint64_t batch_seq = next_seq_;
+            const bool maintenance = std::exchange(maintenance_requested_, false);
+            urgent_ = false;
+
+            lock.unlock();
+            const bool committed = batch.empty() || commit(batch);
+            if (committed && !stopping_) {
+                maintain(maintenance);
+            }
+            lock.lock();
+
+            if (committed) {
+                committed_seq_ = batch_seq;
+                failed_attempts_ = 0;
+                done_cv_.notify_all();
+                continue;
+            }
+
+            // Release the batch's waiters; its writes stay pending
+            if (++failed_attempts_ >= max_attempts_) {
+                abandoned_seq_ = batch_seq;
+                done_cv_.notify_all();
+            }
+
+            // Merge the failed batch under newer writes and retry
+            for (auto& [id, write] : batch.messages) {
+                auto it = pending_.messages.find(id);
+                if (it == pending_.messages.end()) {
+                    pending_.messages.emplace(id, std::move(write));
+                } else if (write.new_row) {
+                    if (it->second.row) {
+                        it->second.new_row = true;
+                    } else {
+                        pending_.messages.erase(it);
+                    }
+                }
+            }
+            for (auto& [id, entry] : batch.dead_letters) {
+                pending_.dead_letters.try_emplace(id, std::move(entry));
+            }
+            if (stopping_) {
+                break;
+            }
+            work_cv_.wait_for(lock, std::max(interval_, std::chrono::milliseconds{10}),
+                              [this]() { return stopping_; });
+        }
+        stopped_ = true;
+        done_cv_.notify_all();
+    }
+
+    const std::chrono::milliseconds interval_;
+    const size_t max_batch_;
+    const size_t max_attempts_;
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    batch_type pending_;
+    uint64_t next_seq_ = 0;
+    uint64_t committed_seq_ = 0;
+    bool urgent_ = false;
+    bool maintenance_requested_ = false;
+    size_t failed_attempts_ = 0;   // consecutive failed commits
+    uint64_t abandoned_seq_ = 0;   // last write whose waiters were released
+    bool stopping_ = false;
+    bool stopped_ = false;
+    std::thread thread_;
+};
+
+/**
+ * @brief Group-commit writer persisting to the SQLite message_queue table
+ *
+ * Commits each batch in one transaction on a connection it holds for its
+ * lifetime. Dead letters are written directly by queue_manager in this mode.
+ */
+class sqlite_commit_writer final : public group_commit_writer {
+public:
+    sqlite_commit_writer(std::shared_ptr<integration::database_adapter> db,
+                         timestamp_codec times, std::chrono::milliseconds interval,
+                         size_t max_batch, size_t max_attempts, queue_sync_mode sync_mode)
+        : group_commit_writer(interval, max_batch, max_attempts),
+          db_(std::move(db)),
+          times_(times),
+          sync_mode_(sync_mode) {}
+
+    ~sqlite_commit_writer() override { stop(); }
+
+protected:
+    bool open() override {
+        auto scope = integration::connection_scope::acquire(*db_);
+        if (!scope) {
+            return false;
+        }
+        const char* pragma = sync_mode_ == queue_sync_mode::off    ? "PRAGMA synchronous=OFF"
+                             : sync_mode_ == queue_sync_mode::full ? "PRAGMA synchronous=FULL"
+                                                                   : "PRAGMA synchronous=NORMAL";
+        if (!scope->connection().execute(pragma)) {
+            return false;
+        }
+        scope_.emplace(std::move(*scope));
+        return true;
+    }
+
+    bool commit(const batch_type& batch) override {
+        auto& conn = scope_->connection();
+        auto guard = integration::transaction_guard::begin(conn);
+        if (!guard) {
+            return false;
+        }
+
+        for (const auto& [id, write] : batch.messages) {
+            if (!write.row) {
+                auto stmt = conn.prepare_cached("DELETE FROM message_queue WHERE id = ?");
+                if (!stmt || !stmt.value()->bind_string(1, id) || !stmt.value()->execute()) {
+                    return false;
+                }
+                continue;
+            }
+
+            const auto& msg = *write.row;
+            if (write.new_row) {
+                auto stmt = conn.prepare_cached(
+                    "INSERT INTO message_queue "
+                    "(id, destination, payload, priority, state, created_at, scheduled_at, "
+                    "attempt_count, last_error, correlation_id, message_type) "
+                    "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
+                if (!stmt) return false;
+                auto& insert = *stmt.value();
+                if (!insert.bind_string(1, msg.id) ||
+                    !insert.bind_string(2, msg.destination) ||
+                    !insert.bind_string(3, msg.payload) ||
+                    !insert.bind_int64(4, msg.priority) ||
+                    !insert.bind_int64(5, static_cast<int>(msg.state)) ||
+                    !times_.bind(insert, 6, msg.created_at) ||
+                    !times_.bind(insert, 7, msg.scheduled_at) ||
+                    !insert.bind_int64(8, msg.attempt_count) ||
+                    !insert.bind_string(9, msg.last_error) ||
+                    !insert.bind_string(10, msg.correlation_id) ||
+                    !insert.bind_string(11, msg.message_type) ||
+                    !insert.execute()) {
+                    return false;
+                }
+            } else {
+                auto stmt = conn.prepare_cached(
+                    "UPDATE message_queue SET state = ?, scheduled_at = ?, "
+                    "attempt_count = ?, last_error = ? WHERE id = ?");
+                if (!stmt) return false;
+                auto& update = *stmt.value();
+                if (!update.bind_int64(1, static_cast<int>(msg.state)) ||
+                    !times_.bind(update, 2, msg.scheduled_at) ||
+                    !update.bind_int64(3, msg.attempt_count) ||
+                    !update.bind_string(4, msg.last_error) ||
+                    !update.bind_string(5, msg.id) ||
+                    !update.execute()) {
+                    return false;
+                }
+            }
+        }
+
+        return guard->commit().has_value();
+    }
+
+    void close() override { scope_.reset(); }
+
+private:
+    std::shared_ptr<integration::database_adapter> db_;
+    std::optional<integration::connection_scope> scope_;
+    const timestamp_codec times_;
+    const queue_sync_mode sync_mode_;
+};
+
+#ifndef _WIN32
+
+/**
+ * @brief Group-commit writer persisting to a segment_log
+ *
+ * Each batch becomes one log batch. After commits, sealed segments that are
+ * mostly acknowledged are compacted; live records are re-put with their
+ * current contents from the lookups.
+ */
+class segment_log_writer final : public group_commit_writer {
+public:
+    /** Fraction of live records below which a sealed segment is compacted */
+    static constexpr double compaction_live_ratio = 0.25;
+
+    segment_log_writer(const queue_config& config, segment_log::message_lookup messages,
+                       segment_log::dead_letter_lookup dead_letters)
+        : group_commit_writer(config.group_commit_interval, config.group_commit_max_batch,
+                              config.group_commit_max_attempts),
+          log_(config.segment_directory, config.segment_size, config.sync_mode),
+          messages_(std::move(messages)),
+          dead_letters_(std::move(dead_letters)) {}
+
+    ~segment_log_writer() override { stop(); }
+
+    /**
+     * @brief Replay the log into state (before start())
+     */
+    bool replay(segment_log::replay_state& state) { return log_.open(state); }
+
+protected:
+    bool open() override { return true; }
+
+    bool commit(const batch_type& batch) override {
+        for (const auto& [id, write] : batch.messages) {
+            if (!write.row) {
+                log_.remove_message(id);
+            } else if (write.new_row) {
+                log_.put_message(*write.row);
+            } else {
+                log_.update_message(*write.row);
+            }
+        }
+        for (const auto& [id, entry] : batch.dead_letters) {
+            if (entry) {
+                log_.put_dead_letter(*entry);
+            } else {
+                log_.remove_dead_letter(id);
+            }
+        }
+        return log_.commit();
+    }
+
+    void maintain(bool requested) override {
+        // An explicit request compacts every sealed segment
+        log_.compact(messages_, dead_letters_, requested ? 1.0 : compaction_live_ratio);
+    }
+
+private:
+    segment_log log_;
+    segment_log::message_lookup messages_;
+    segment_log::dead_letter_lookup dead_letters_;
+};
+
+#endif  // _WIN32
+
 }  // namespace
 
 // =============================================================================
@@ -190,12 +1144,36 @@ public:
     // Database adapter for standardized database access
     std::shared_ptr<integration::database_adapter> db_adapter_;
 
+    // Timestamp column format of the opened tables
+    timestamp_codec times_;
+
     // Worker thread pool (used in non-executor mode)
     std::unique_ptr<integration::thread_adapter> thread_pool_;
     std::mutex worker_mutex_;
     std::condition_variable worker_cv_;
     sender_function sender_;
 
+    // Worker wake-up state (guarded by worker_mutex_). ready_signals_ counts
+    // messages made ready since workers last looked; the timekeeper is the
+    // one idle worker that sleeps until the next scheduled retry.
+    size_t ready_signals_ = 0;
+    bool timekeeper_active_ = false;
+    retry_timer_wheel retry_wheel_{std::chrono::steady_clock::now()};
+
+    // Hot tier (queue_persistence::hot_tier and segmented_log). hot_tier_ is
+    // authoritative for queued messages while running; every change is logged
+    // to writer_ under hot_mutex_ so storage sees changes in memory order.
+    std::unique_ptr<group_commit_writer> writer_;
+    mutable std::mutex hot_mutex_;
+    hot_message_tier hot_tier_;
+
+    // Messages logged as new but not durable yet; they join hot_tier_ once
+    // their commit completes (guarded by hot_mutex_)
+    std::unordered_map<std::string, queued_message> unpublished_;
+
+    // Dead letters when persisting to a segmented log (guarded by hot_mutex_)
+    std::unordered_map<std::string, dead_letter_entry> dead_letters_;
+
     // Futures for tracking worker/cleanup tasks
     std::vector<std::future<void>> worker_futures_;
     std::future<void> cleanup_future_;
@@ -235,6 +1213,15 @@ public:
             thread_pool_.reset();
         }
 
+        // Commit outstanding hot tier writes
+        if (writer_) {
+            writer_->stop();
+            writer_.reset();
+        }
+        hot_tier_ = hot_message_tier{};
+        unpublished_.clear();
+        dead_letters_.clear();
+
         // Release database adapter (closes all pooled connections)
         db_adapter_.reset();
 
@@ -242,7 +1229,10 @@ public:
     }
 
     void stop_workers() {
-        workers_running_ = false;
+        {
+            std::lock_guard<std::mutex> lock(worker_mutex_);
+            workers_running_ = false;
+        }
         worker_cv_.notify_all();
 
         for (auto& future : worker_futures_) {
@@ -262,16 +1252,34 @@ public:
             return std::unexpected(queue_error::invalid_message);
         }
 
-        // Open database
-        auto db_result = open_database();
-        if (!db_result) {
-            return db_result;
-        }
+        if (log_mode()) {
+            auto log_result = start_segmented_log();
+            if (!log_result) {
+                return log_result;
+            }
+
+            running_ = true;
+        } else {
+            // Open database
+            auto db_result = open_database();
+            if (!db_result) {
+                return db_result;
+            }
 
-        running_ = true;
+            running_ = true;
 
-        // Recover in-progress messages
-        recover_internal();
+            // Recover in-progress messages
+            recover_internal();
+
+            if (config_.persistence == queue_persistence::hot_tier) {
+                auto hot_result = start_hot_tier();
+                if (!hot_result) {
+                    db_adapter_.reset();
+                    running_ = false;
+                    return hot_result;
+                }
+            }
+        }
 
         // Start cleanup thread
         cleanup_running_ = true;
@@ -298,10 +1306,23 @@ public:
         return {};
     }
 
+    /**
+     * @brief True while messages can be stored (database or writer open)
+     */
+    [[nodiscard]] bool storage_open() const noexcept {
+        return db_adapter_ != nullptr || writer_ != nullptr;
+    }
+
+    [[nodiscard]] bool log_mode() const noexcept {
+        return config_.persistence == queue_persistence::segmented_log;
+    }
+
     std::expected<void, queue_error> open_database() {
         integration::database_config db_config;
         db_config.database_path = config_.database_path;
-        db_config.pool_size = 5;
+        // The hot tier writer holds one connection for its lifetime
+        db_config.pool_size =
+            config_.persistence == queue_persistence::hot_tier ? 6 : 5;
         db_config.connection_timeout = std::chrono::seconds{30};
         db_config.query_timeout = std::chrono::seconds{60};
         db_config.enable_wal = config_.enable_wal_mode;
@@ -322,16 +1343,21 @@ public:
     }
 
     std::expected<void, queue_error> create_tables() {
+        // Timestamp column type for newly created tables
+        const std::string time_type =
+            config_.timestamp_format == queue_timestamp_format::epoch_micros ? "INTEGER"
+                                                                             : "TEXT";
+
         // Main queue table
-        const char* queue_table = R"(
+        const std::string queue_table = R"(
             CREATE TABLE IF NOT EXISTS message_queue (
                 id TEXT PRIMARY KEY,
                 destination TEXT NOT NULL,
                 payload TEXT NOT NULL,
                 priority INTEGER DEFAULT 0,
                 state INTEGER DEFAULT 0,
-                created_at TEXT NOT NULL,
-                scheduled_at TEXT NOT NULL,
+                created_at )" + time_type + R"( NOT NULL,
+                scheduled_at )" + time_type + R"( NOT NULL,
                 attempt_count INTEGER DEFAULT 0,
                 last_error TEXT,
                 correlation_id TEXT,
@@ -339,49 +1365,192 @@ public:
             )
         )";
 
-        // Dead letter table
-        const char* dead_letter_table = R"(
+        // Indexes for efficient querying
+        const char* indexes[] = {
+            "CREATE INDEX IF NOT EXISTS idx_queue_state ON message_queue(state)",
+            "CREATE INDEX IF NOT EXISTS idx_queue_destination ON message_queue(destination)",
+            "CREATE INDEX IF NOT EXISTS idx_queue_scheduled ON message_queue(scheduled_at)",
+            "CREATE INDEX IF NOT EXISTS idx_queue_priority ON message_queue(priority)",
+            "CREATE INDEX IF NOT EXISTS idx_dlq_destination ON dead_letter_queue(destination)"};
+
+        // Create main queue table
+        auto result = db_adapter_->execute_schema(queue_table);
+        if (!result) {
+            return std::unexpected(queue_error::database_error);
+        }
+
+        // An existing table keeps the format it was created with
+        auto format = detect_timestamp_format();
+        if (!format) {
+            return std::unexpected(format.error());
+        }
+        times_.epoch_micros = *format == queue_timestamp_format::epoch_micros;
+
+        // Dead letter table, in the same format
+        const std::string dead_letter_time_type = times_.epoch_micros ? "INTEGER" : "TEXT";
+        const std::string dead_letter_table = R"(
             CREATE TABLE IF NOT EXISTS dead_letter_queue (
                 id TEXT PRIMARY KEY,
                 destination TEXT NOT NULL,
                 payload TEXT NOT NULL,
                 priority INTEGER DEFAULT 0,
-                created_at TEXT NOT NULL,
+                created_at )" + dead_letter_time_type + R"( NOT NULL,
                 attempt_count INTEGER DEFAULT 0,
                 reason TEXT NOT NULL,
-                dead_lettered_at TEXT NOT NULL,
+                dead_lettered_at )" + dead_letter_time_type + R"( NOT NULL,
                 error_history TEXT,
                 correlation_id TEXT,
                 message_type TEXT
             )
         )";
 
-        // Indexes for efficient querying
-        const char* indexes[] = {
-            "CREATE INDEX IF NOT EXISTS idx_queue_state ON message_queue(state)",
-            "CREATE INDEX IF NOT EXISTS idx_queue_destination ON message_queue(destination)",
-            "CREATE INDEX IF NOT EXISTS idx_queue_scheduled ON message_queue(scheduled_at)",
-            "CREATE INDEX IF NOT EXISTS idx_queue_priority ON message_queue(priority)",
-            "CREATE INDEX IF NOT EXISTS idx_dlq_destination ON dead_letter_queue(destination)"};
+        // Create dead letter table
+        result = db_adapter_->execute_schema(dead_letter_table);
+        if (!result) {
+            return std::unexpected(queue_error::database_error);
+        }
 
-        // Create main queue table
-        auto result = db_adapter_->execute_schema(queue_table);
+        // Create indexes (optional, don't fail on error)
+        for (const auto* idx : indexes) {
+            (void)db_adapter_->execute_schema(idx);  // Intentionally ignore result
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief Read the timestamp format message_queue was created with
+     */
+    std::expected<queue_timestamp_format, queue_error> detect_timestamp_format() {
+        auto conn_result = integration::connection_scope::acquire(*db_adapter_);
+        if (!conn_result) {
+            return std::unexpected(queue_error::database_error);
+        }
+
+        auto result = conn_result->connection().execute(
+            "SELECT type FROM pragma_table_info('message_queue') "
+            "WHERE name = 'scheduled_at'");
+        if (!result) {
+            return std::unexpected(queue_error::database_error);
+        }
+
+        auto format = queue_timestamp_format::text;
+        if (result.value()->next() &&
+            result.value()->current_row().get_string(0) == "INTEGER") {
+            format = queue_timestamp_format::epoch_micros;
+        }
+        (void)result.value()->next();
+        return format;
+    }
+
+    /**
+     * @brief Load queued messages into the hot tier and start the writer
+     */
+    std::expected<void, queue_error> start_hot_tier() {
+        auto conn_result = integration::connection_scope::acquire(*db_adapter_);
+        if (!conn_result) {
+            return std::unexpected(queue_error::database_error);
+        }
+        auto& conn_scope = *conn_result;
+
+        const char* sql =
+            "SELECT id, destination, payload, priority, state, created_at, "
+            "scheduled_at, attempt_count, last_error, correlation_id, message_type "
+            "FROM message_queue WHERE state IN (?, ?)";
+
+        auto stmt_result = conn_scope.connection().prepare(sql);
+        if (!stmt_result) {
+            return std::unexpected(queue_error::database_error);
+        }
+        auto& stmt = *stmt_result.value();
+
+        if (!stmt.bind_int64(1, static_cast<int>(message_state::pending)) ||
+            !stmt.bind_int64(2, static_cast<int>(message_state::retry_scheduled))) {
+            return std::unexpected(queue_error::database_error);
+        }
+
+        auto result = stmt.execute();
         if (!result) {
             return std::unexpected(queue_error::database_error);
         }
 
-        // Create dead letter table
-        result = db_adapter_->execute_schema(dead_letter_table);
-        if (!result) {
+        {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            while (result.value()->next()) {
+                hot_tier_.insert(read_message(result.value()->current_row(), times_));
+            }
+        }
+
+        writer_ = std::make_unique<sqlite_commit_writer>(
+            db_adapter_, times_, config_.group_commit_interval, config_.group_commit_max_batch,
+            config_.group_commit_max_attempts, config_.sync_mode);
+        if (!writer_->start()) {
+            writer_.reset();
+            return std::unexpected(queue_error::database_error);
+        }
+        return {};
+    }
+
+    /**
+     * @brief Replay the segmented log into memory and start its writer
+     *
+     * Messages that were processing when the log was last written are
+     * delivered again.
+     */
+    std::expected<void, queue_error> start_segmented_log() {
+#ifdef _WIN32
+        return std::unexpected(queue_error::database_error);
+#else
+        // Compaction re-puts records with their current contents. A message
+        // being dead-lettered or enqueued is looked up where it waits for
+        // durability, so compaction never drops a record still in flight.
+        auto writer = std::make_unique<segment_log_writer>(
+            config_,
+            [this](const std::string& id) -> std::optional<queued_message> {
+                std::lock_guard<std::mutex> lock(hot_mutex_);
+                if (auto msg = hot_tier_.find(id)) return msg;
+                if (auto it = unpublished_.find(id); it != unpublished_.end()) {
+                    return it->second;
+                }
+                if (auto it = dead_letters_.find(id); it != dead_letters_.end()) {
+                    return it->second.message;
+                }
+                return std::nullopt;
+            },
+            [this](const std::string& id) -> std::optional<dead_letter_entry> {
+                std::lock_guard<std::mutex> lock(hot_mutex_);
+                auto it = dead_letters_.find(id);
+                if (it == dead_letters_.end()) return std::nullopt;
+                return it->second;
+            });
+
+        segment_log::replay_state state;
+        if (!writer->replay(state)) {
             return std::unexpected(queue_error::database_error);
         }
 
-        // Create indexes (optional, don't fail on error)
-        for (const auto* idx : indexes) {
-            (void)db_adapter_->execute_schema(idx);  // Intentionally ignore result
+        auto now = std::chrono::system_clock::now();
+        {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            for (auto& [id, msg] : state.messages) {
+                if (msg.state == message_state::processing) {
+                    msg.state = message_state::pending;
+                    msg.scheduled_at = now;
+                }
+                hot_tier_.insert(std::move(msg));
+            }
+            dead_letters_ = std::move(state.dead_letters);
         }
 
+        if (!writer->start()) {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            hot_tier_ = hot_message_tier{};
+            dead_letters_.clear();
+            return std::unexpected(queue_error::database_error);
+        }
+        writer_ = std::move(writer);
         return {};
+#endif
     }
 
     void cleanup_loop() {
@@ -428,40 +1597,72 @@ public:
             return 0;  // No TTL configured
         }
 
-        if (!db_adapter_) return 0;
+        if (!storage_open()) return 0;
 
         auto cutoff = std::chrono::system_clock::now() - config_.message_ttl;
-        std::string cutoff_str = to_sqlite_timestamp(cutoff);
 
+        std::vector<std::string> expired_ids;
+        if (writer_) {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            expired_ids = hot_tier_.created_before(cutoff);
+        } else {
+            expired_ids = select_created_before(cutoff);
+        }
+
+        size_t count = 0;
+        for (const auto& id : expired_ids) {
+            // Get the message first
+            auto msg = get_message_internal(id);
+            if (msg) {
+                // Move to dead letter
+                dead_letter_internal(id, "Message expired (TTL exceeded)");
+                count++;
+            }
+        }
+
+        // Update statistics
+        {
+            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+            stats_.expired_count += count;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Ids of stored messages created before cutoff
+     */
+    std::vector<std::string> select_created_before(
+        std::chrono::system_clock::time_point cutoff) {
         // Acquire connection from pool
         auto conn_result = integration::connection_scope::acquire(*db_adapter_);
         if (!conn_result) {
-            return 0;
+            return {};
         }
         auto& conn_scope = *conn_result;
 
-        // Move expired messages to dead letter
+        // Select expired messages
         const char* select_sql =
             "SELECT id FROM message_queue WHERE created_at < ? AND state != ?";
 
         auto stmt_result = conn_scope.connection().prepare(select_sql);
         if (!stmt_result) {
-            return 0;
+            return {};
         }
         auto& stmt = *stmt_result.value();
 
-        auto bind_result = stmt.bind_string(1, cutoff_str);
+        auto bind_result = times_.bind(stmt, 1, cutoff);
         if (!bind_result) {
-            return 0;
+            return {};
         }
         bind_result = stmt.bind_int64(2, static_cast<int>(message_state::delivered));
         if (!bind_result) {
-            return 0;
+            return {};
         }
 
         auto result = stmt.execute();
         if (!result) {
-            return 0;
+            return {};
         }
 
         std::vector<std::string> expired_ids;
@@ -473,28 +1674,20 @@ public:
             }
         }
 
-        size_t count = 0;
-        for (const auto& id : expired_ids) {
-            // Get the message first
-            auto msg = get_message_internal(id);
-            if (msg) {
-                // Move to dead letter
-                dead_letter_internal(id, "Message expired (TTL exceeded)");
-                count++;
-            }
-        }
-
-        // Update statistics
-        {
-            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
-            stats_.expired_count += count;
-        }
-
-        return count;
+        return expired_ids;
     }
 
     size_t recover_internal() {
-        if (!db_adapter_) return 0;
+        if (!storage_open()) return 0;
+
+        if (writer_) {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            auto reset = hot_tier_.reset_processing(std::chrono::system_clock::now());
+            for (const auto& msg : reset) {
+                writer_->upsert(msg, false);
+            }
+            return reset.size();
+        }
 
         auto conn_result = integration::connection_scope::acquire(*db_adapter_);
         if (!conn_result) return 0;
@@ -509,9 +1702,8 @@ public:
         if (!stmt_result) return 0;
         auto& stmt = *stmt_result.value();
 
-        std::string now_str = to_sqlite_timestamp(std::chrono::system_clock::now());
         if (!stmt.bind_int64(1, static_cast<int>(message_state::pending))) return 0;
-        if (!stmt.bind_string(2, now_str)) return 0;
+        if (!times_.bind(stmt, 2, std::chrono::system_clock::now())) return 0;
         if (!stmt.bind_int64(3, static_cast<int>(message_state::processing))) return 0;
 
         auto result = stmt.execute();
@@ -534,13 +1726,74 @@ public:
             return std::unexpected(queue_error::queue_full);
         }
 
-        if (!db_adapter_) {
+        if (!storage_open()) {
             return std::unexpected(queue_error::not_running);
         }
 
         std::string id = generate_message_id();
         auto now = std::chrono::system_clock::now();
-        std::string now_str = to_sqlite_timestamp(now);
+
+        if (writer_) {
+            queued_message msg;
+            msg.id = id;
+            msg.destination = std::string(destination);
+            msg.payload = std::string(payload);
+            msg.priority = priority;
+            msg.state = message_state::pending;
+            msg.created_at = now;
+            msg.scheduled_at = now;
+            msg.correlation_id = std::string(correlation_id);
+            msg.message_type = std::string(message_type);
+
+            uint64_t seq;
+            {
+                std::lock_guard<std::mutex> lock(hot_mutex_);
+                seq = writer_->upsert(msg, true);
+                unpublished_.emplace(id, std::move(msg));
+            }
+
+            // Visible to workers only once durable
+            const bool durable = writer_->wait_durable(seq);
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            auto node = unpublished_.extract(id);
+            if (!durable) {
+                // Cancel the pending insert so a later commit cannot store it
+                writer_->remove(id);
+                return std::unexpected(queue_error::database_error);
+            }
+            hot_tier_.insert(std::move(node.mapped()));
+        } else {
+            auto stored = insert_message(id, destination, payload, priority, now,
+                                         correlation_id, message_type);
+            if (!stored) {
+                return std::unexpected(stored.error());
+            }
+        }
+
+        // Update statistics
+        {
+            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+            stats_.total_enqueued++;
+            stats_.pending_count++;
+        }
+
+        // Record metrics
+        monitoring::bridge_metrics_collector::instance().record_message_enqueued(
+            destination);
+
+        // Notify workers
+        signal_work(1);
+
+        return id;
+    }
+
+    std::expected<void, queue_error> insert_message(const std::string& id,
+                                                    std::string_view destination,
+                                                    std::string_view payload,
+                                                    int priority,
+                                                    std::chrono::system_clock::time_point now,
+                                                    std::string_view correlation_id,
+                                                    std::string_view message_type) {
 
         auto conn_result = integration::connection_scope::acquire(*db_adapter_);
         if (!conn_result) {
@@ -565,8 +1818,8 @@ public:
             !stmt.bind_string(3, payload) ||
             !stmt.bind_int64(4, priority) ||
             !stmt.bind_int64(5, static_cast<int>(message_state::pending)) ||
-            !stmt.bind_string(6, now_str) ||
-            !stmt.bind_string(7, now_str) ||
+            !times_.bind(stmt, 6, now) ||
+            !times_.bind(stmt, 7, now) ||
             !stmt.bind_string(8, correlation_id) ||
             !stmt.bind_string(9, message_type)) {
             return std::unexpected(queue_error::database_error);
@@ -577,162 +1830,205 @@ public:
             return std::unexpected(queue_error::database_error);
         }
 
+        return {};
+    }
+
+    /**
+     * @brief Atomically claim up to count ready messages
+     *
+     * One UPDATE ... RETURNING selects the highest priority ready rows and
+     * marks them processing, so concurrent callers never claim the same
+     * message. The statement is cached on the pooled connection.
+     */
+    std::vector<queued_message> claim_internal(size_t count, std::string_view destination) {
+        if (!storage_open() || count == 0) return {};
+
+        auto claimed = writer_ ? claim_hot(count, destination)
+                               : claim_from_database(count, destination);
+
         // Update statistics
-        {
+        if (!claimed.empty()) {
             std::lock_guard<std::mutex> stats_lock(stats_mutex_);
-            stats_.total_enqueued++;
-            stats_.pending_count++;
+            stats_.pending_count -= std::min(stats_.pending_count, claimed.size());
+            stats_.processing_count += claimed.size();
         }
 
-        // Record metrics
-        monitoring::bridge_metrics_collector::instance().record_message_enqueued(
-            std::string(destination));
-
-        // Notify workers
-        worker_cv_.notify_one();
+        // Claimed messages no longer need a worker woken for them
+        if (!claimed.empty()) {
+            std::lock_guard<std::mutex> lock(worker_mutex_);
+            ready_signals_ -= std::min(ready_signals_, claimed.size());
+        }
 
-        return id;
+        return claimed;
     }
 
-    std::optional<queued_message> dequeue_internal(std::string_view destination) {
-        if (!db_adapter_) return std::nullopt;
+    std::vector<queued_message> claim_hot(size_t count, std::string_view destination) {
+        std::lock_guard<std::mutex> lock(hot_mutex_);
+        auto claimed = hot_tier_.claim(count, destination, std::chrono::system_clock::now());
+        for (const auto& msg : claimed) {
+            writer_->upsert(msg, false);
+        }
+        return claimed;
+    }
 
+    std::vector<queued_message> claim_from_database(size_t count,
+                                                    std::string_view destination) {
         auto now = std::chrono::system_clock::now();
-        std::string now_str = to_sqlite_timestamp(now);
 
         // Acquire connection from pool
         auto conn_result = integration::connection_scope::acquire(*db_adapter_);
         if (!conn_result) {
-            return std::nullopt;
+            return {};
         }
         auto& conn_scope = *conn_result;
 
-        // Select highest priority message that is ready
-        std::string sql =
-            "SELECT id, destination, payload, priority, state, created_at, "
-            "scheduled_at, attempt_count, last_error, correlation_id, message_type "
-            "FROM message_queue "
-            "WHERE (state = ? OR (state = ? AND scheduled_at <= ?))";
-
-        if (!destination.empty()) {
-            sql += " AND destination = ?";
-        }
-
-        sql += " ORDER BY priority ASC, scheduled_at ASC LIMIT 1";
-
-        auto stmt_result = conn_scope.connection().prepare(sql);
-        if (!stmt_result) return std::nullopt;
+        auto stmt_result = conn_scope.connection().prepare_cached(
+            destination.empty() ? CLAIM_SQL : CLAIM_DESTINATION_SQL);
+        if (!stmt_result) return {};
         auto& stmt = *stmt_result.value();
 
-        int param = 1;
-        if (!stmt.bind_int64(param++, static_cast<int>(message_state::pending))) {
-            return std::nullopt;
-        }
-        if (!stmt.bind_int64(param++, static_cast<int>(message_state::retry_scheduled))) {
-            return std::nullopt;
-        }
-        if (!stmt.bind_string(param++, now_str)) {
-            return std::nullopt;
+        if (!stmt.bind_int64(1, static_cast<int>(message_state::processing)) ||
+            !stmt.bind_int64(2, static_cast<int>(message_state::pending)) ||
+            !stmt.bind_int64(3, static_cast<int>(message_state::retry_scheduled)) ||
+            !times_.bind(stmt, 4, now) ||
+            !stmt.bind_int64(5, static_cast<int64_t>(count))) {
+            return {};
         }
-        if (!destination.empty()) {
-            if (!stmt.bind_string(param++, destination)) {
-                return std::nullopt;
-            }
+        if (!destination.empty() && !stmt.bind_string(6, destination)) {
+            return {};
         }
 
         auto result = stmt.execute();
         if (!result) {
-            return std::nullopt;
+            return {};
         }
 
-        std::optional<queued_message> msg_result;
-        if (result.value()->next()) {
-            const auto& row = result.value()->current_row();
-            queued_message msg;
-            msg.id = row.get_string(0);
-            msg.destination = row.get_string(1);
-            msg.payload = row.get_string(2);
-            msg.priority = static_cast<int>(row.get_int64(3));
-            msg.state = static_cast<message_state>(row.get_int64(4));
-            msg.created_at = from_sqlite_timestamp(row.get_string(5));
-            msg.scheduled_at = from_sqlite_timestamp(row.get_string(6));
-            msg.attempt_count = static_cast<int>(row.get_int64(7));
-
-            if (!row.is_null(8)) msg.last_error = row.get_string(8);
-            if (!row.is_null(9)) msg.correlation_id = row.get_string(9);
-            if (!row.is_null(10)) msg.message_type = row.get_string(10);
-
-            msg_result = msg;
-        }
-
-        if (msg_result) {
-            // Update state to processing
-            const char* update_sql =
-                "UPDATE message_queue SET state = ?, attempt_count = attempt_count + 1 "
-                "WHERE id = ?";
-
-            auto update_stmt_result = conn_scope.connection().prepare(update_sql);
-            if (update_stmt_result) {
-                auto& update_stmt = *update_stmt_result.value();
-                if (update_stmt.bind_int64(1, static_cast<int>(message_state::processing)) &&
-                    update_stmt.bind_string(2, msg_result->id)) {
-                    (void)update_stmt.execute();
-
-                    msg_result->state = message_state::processing;
-                    msg_result->attempt_count++;
+        std::vector<queued_message> claimed;
+        while (result.value()->next()) {
+            claimed.push_back(read_message(result.value()->current_row(), times_));
+        }
+
+        // RETURNING does not preserve the subquery order
+        std::sort(claimed.begin(), claimed.end(),
+                  [](const queued_message& a, const queued_message& b) {
+                      return std::tie(a.priority, a.scheduled_at) <
+                             std::tie(b.priority, b.scheduled_at);
+                  });
+
+        return claimed;
+    }
+
+    /**
+     * @brief Return claimed but undelivered messages to pending
+     *
+     * Used when workers stop with part of a claimed batch unprocessed; the
+     * claim's attempt increment is undone.
+     */
+    void release_claimed(const std::vector<queued_message>& messages, size_t from) {
+        if (!storage_open() || from >= messages.size()) return;
+
+        if (writer_) {
+            size_t released = 0;
+            {
+                std::lock_guard<std::mutex> lock(hot_mutex_);
+                for (size_t i = from; i < messages.size(); ++i) {
+                    if (auto msg = hot_tier_.release(messages[i].id)) {
+                        writer_->upsert(*msg, false);
+                        released++;
+                    }
                 }
             }
+            finish_release(released);
+            return;
+        }
 
-            // Update statistics
-            {
-                std::lock_guard<std::mutex> stats_lock(stats_mutex_);
-                if (stats_.pending_count > 0) stats_.pending_count--;
-                stats_.processing_count++;
+        auto conn_result = integration::connection_scope::acquire(*db_adapter_);
+        if (!conn_result) {
+            return;
+        }
+        auto& conn_scope = *conn_result;
+
+        const char* sql =
+            "UPDATE message_queue SET state = ?, attempt_count = attempt_count - 1 "
+            "WHERE id = ? AND state = ?";
+
+        size_t released = 0;
+        for (size_t i = from; i < messages.size(); ++i) {
+            auto stmt_result = conn_scope.connection().prepare_cached(sql);
+            if (!stmt_result) {
+                break;
+            }
+            auto& stmt = *stmt_result.value();
+            if (!stmt.bind_int64(1, static_cast<int>(message_state::pending)) ||
+                !stmt.bind_string(2, messages[i].id) ||
+                !stmt.bind_int64(3, static_cast<int>(message_state::processing))) {
+                continue;
+            }
+            auto result = stmt.execute();
+            if (result) {
+                released += static_cast<size_t>(result.value()->affected_rows());
             }
         }
 
-        return msg_result;
+        finish_release(released);
     }
 
-    std::expected<void, queue_error> ack_internal(std::string_view message_id) {
-        // Get message destination before deletion for metrics
-        std::string destination;
+    void finish_release(size_t released) {
         {
-            auto msg = get_message_internal(std::string(message_id));
-            if (msg) {
-                destination = msg->destination;
-            }
+            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+            stats_.processing_count -= std::min(stats_.processing_count, released);
+            stats_.pending_count += released;
         }
 
-        if (!db_adapter_) {
+        signal_work(released);
+    }
+
+    std::expected<void, queue_error> ack_internal(std::string_view message_id) {
+        if (!storage_open()) {
             return std::unexpected(queue_error::not_running);
         }
 
-        auto conn_result = integration::connection_scope::acquire(*db_adapter_);
-        if (!conn_result) {
-            return std::unexpected(queue_error::database_error);
-        }
-        auto& conn_scope = *conn_result;
+        // Destination is kept for metrics
+        std::string destination;
+        if (writer_) {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            auto msg = hot_tier_.remove(std::string(message_id));
+            if (!msg) {
+                return std::unexpected(queue_error::message_not_found);
+            }
+            writer_->remove(msg->id);
+            destination = std::move(msg->destination);
+        } else {
+            auto conn_result = integration::connection_scope::acquire(*db_adapter_);
+            if (!conn_result) {
+                return std::unexpected(queue_error::database_error);
+            }
+            auto& conn_scope = *conn_result;
 
-        const char* sql = "DELETE FROM message_queue WHERE id = ?";
+            const char* sql = "DELETE FROM message_queue WHERE id = ? RETURNING destination";
 
-        auto stmt_result = conn_scope.connection().prepare(sql);
-        if (!stmt_result) {
-            return std::unexpected(queue_error::database_error);
-        }
-        auto& stmt = *stmt_result.value();
+            auto stmt_result = conn_scope.connection().prepare_cached(sql);
+            if (!stmt_result) {
+                return std::unexpected(queue_error::database_error);
+            }
+            auto& stmt = *stmt_result.value();
 
-        if (!stmt.bind_string(1, message_id)) {
-            return std::unexpected(queue_error::database_error);
-        }
+            if (!stmt.bind_string(1, message_id)) {
+                return std::unexpected(queue_error::database_error);
+            }
 
-        auto result = stmt.execute();
-        if (!result) {
-            return std::unexpected(queue_error::database_error);
-        }
+            auto result = stmt.execute();
+            if (!result) {
+                return std::unexpected(queue_error::database_error);
+            }
 
-        if (result.value()->affected_rows() == 0) {
-            return std::unexpected(queue_error::message_not_found);
+            if (!result.value()->next()) {
+                return std::unexpected(queue_error::message_not_found);
+            }
+            destination = result.value()->current_row().get_string(0);
+
+            // Step to completion so the cached statement ends its transaction
+            (void)result.value()->next();
         }
 
         // Update statistics
@@ -774,12 +2070,42 @@ public:
                                             config_.retry_backoff_multiplier,
                                             config_.max_retry_delay);
         auto next_retry = std::chrono::system_clock::now() + delay;
-        std::string next_retry_str = to_sqlite_timestamp(next_retry);
 
-        if (!db_adapter_) {
+        if (!storage_open()) {
             return std::unexpected(queue_error::not_running);
         }
 
+        if (writer_) {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            auto updated = hot_tier_.reschedule(msg->id, next_retry, error);
+            if (!updated) {
+                return std::unexpected(queue_error::message_not_found);
+            }
+            writer_->upsert(*updated, false);
+        } else {
+            auto stored = store_retry(message_id, next_retry, error);
+            if (!stored) {
+                return stored;
+            }
+        }
+
+        // Update statistics
+        {
+            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+            stats_.total_retries++;
+            if (stats_.processing_count > 0) stats_.processing_count--;
+            stats_.retry_scheduled_count++;
+        }
+
+        schedule_retry(next_retry);
+
+        return {};
+    }
+
+    std::expected<void, queue_error> store_retry(std::string_view message_id,
+                                                 std::chrono::system_clock::time_point next_retry,
+                                                 std::string_view error) {
+
         auto conn_result = integration::connection_scope::acquire(*db_adapter_);
         if (!conn_result) {
             return std::unexpected(queue_error::database_error);
@@ -797,7 +2123,7 @@ public:
         auto& stmt = *stmt_result.value();
 
         if (!stmt.bind_int64(1, static_cast<int>(message_state::retry_scheduled)) ||
-            !stmt.bind_string(2, next_retry_str) ||
+            !times_.bind(stmt, 2, next_retry) ||
             !stmt.bind_string(3, error) ||
             !stmt.bind_string(4, message_id)) {
             return std::unexpected(queue_error::database_error);
@@ -808,30 +2134,119 @@ public:
             return std::unexpected(queue_error::database_error);
         }
 
+        return {};
+    }
+
+    std::expected<void, queue_error> dead_letter_internal(std::string_view message_id,
+                                                           std::string_view reason) {
+        if (!storage_open()) {
+            return std::unexpected(queue_error::not_running);
+        }
+
+        std::optional<queued_message> msg;
+        std::chrono::system_clock::time_point dead_lettered_at;
+        if (log_mode()) {
+            auto logged = log_dead_letter(message_id, reason);
+            if (!logged) {
+                return std::unexpected(logged.error());
+            }
+            msg = std::move(logged->message);
+            dead_lettered_at = logged->dead_lettered_at;
+        } else {
+            if (writer_) {
+                // Taken out of the hot tier so no worker claims it meanwhile
+                std::lock_guard<std::mutex> lock(hot_mutex_);
+                msg = hot_tier_.remove(std::string(message_id));
+            } else {
+                msg = get_message_internal(std::string(message_id));
+            }
+            if (!msg) {
+                return std::unexpected(queue_error::message_not_found);
+            }
+
+            auto moved = flush_hot_writes()
+                             ? move_to_dead_letter(*msg, reason)
+                             : std::unexpected(queue_error::database_error);
+            if (!moved) {
+                if (writer_) {
+                    std::lock_guard<std::mutex> lock(hot_mutex_);
+                    hot_tier_.insert(std::move(*msg));
+                }
+                return std::unexpected(moved.error());
+            }
+            dead_lettered_at = *moved;
+        }
+
         // Update statistics
         {
             std::lock_guard<std::mutex> stats_lock(stats_mutex_);
-            stats_.total_retries++;
+            stats_.total_dead_lettered++;
             if (stats_.processing_count > 0) stats_.processing_count--;
-            stats_.retry_scheduled_count++;
+            stats_.dead_letter_count++;
+        }
+
+        // Record dead letter metric
+        monitoring::bridge_metrics_collector::instance().record_dead_letter(
+            msg->destination);
+
+        // Notify callback
+        if (dead_letter_callback_) {
+            dead_letter_entry entry;
+            entry.message = *msg;
+            entry.reason = std::string(reason);
+            entry.dead_lettered_at = dead_lettered_at;
+            entry.error_history.push_back(msg->last_error);
+            dead_letter_callback_(entry);
         }
 
         return {};
     }
 
-    std::expected<void, queue_error> dead_letter_internal(std::string_view message_id,
-                                                           std::string_view reason) {
-        auto msg = get_message_internal(std::string(message_id));
-        if (!msg) {
-            return std::unexpected(queue_error::message_not_found);
+    /**
+     * @brief Move a message from the hot tier to the dead letters and log it
+     *
+     * The message delete and the dead letter are committed in one batch.
+     */
+    std::expected<dead_letter_entry, queue_error> log_dead_letter(std::string_view message_id,
+                                                                  std::string_view reason) {
+        dead_letter_entry entry;
+        uint64_t seq;
+        {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            auto msg = hot_tier_.remove(std::string(message_id));
+            if (!msg) {
+                return std::unexpected(queue_error::message_not_found);
+            }
+            entry.message = std::move(*msg);
+            entry.reason = std::string(reason);
+            entry.dead_lettered_at = std::chrono::system_clock::now();
+            entry.error_history.push_back(entry.message.last_error);
+            seq = writer_->dead_letter(entry);
+            dead_letters_.insert_or_assign(entry.message.id, entry);
         }
 
-        if (!db_adapter_) {
-            return std::unexpected(queue_error::not_running);
+        if (!writer_->wait_durable(seq)) {
+            return std::unexpected(queue_error::database_error);
         }
+        return entry;
+    }
+
+    /**
+     * @brief Commit pending hot-tier writes before direct message_queue SQL
+     *
+     * In SQLite hot-tier mode dead letters bypass the writer; a write still
+     * queued for the same id would otherwise land after the direct SQL
+     * (e.g. an older update deleting a row a retry just restored).
+     */
+    bool flush_hot_writes() { return !writer_ || writer_->flush(); }
 
+    /**
+     * @brief Insert a message into dead_letter_queue and delete it from message_queue
+     * @return Dead-letter time
+     */
+    std::expected<std::chrono::system_clock::time_point, queue_error>
+    move_to_dead_letter(const queued_message& msg, std::string_view reason) {
         auto now = std::chrono::system_clock::now();
-        std::string now_str = to_sqlite_timestamp(now);
 
         auto conn_result = integration::connection_scope::acquire(*db_adapter_);
         if (!conn_result) {
@@ -858,18 +2273,17 @@ public:
         }
         auto& insert_stmt = *insert_stmt_result.value();
 
-        std::string created_str = to_sqlite_timestamp(msg->created_at);
-        if (!insert_stmt.bind_string(1, msg->id) ||
-            !insert_stmt.bind_string(2, msg->destination) ||
-            !insert_stmt.bind_string(3, msg->payload) ||
-            !insert_stmt.bind_int64(4, msg->priority) ||
-            !insert_stmt.bind_string(5, created_str) ||
-            !insert_stmt.bind_int64(6, msg->attempt_count) ||
+        if (!insert_stmt.bind_string(1, msg.id) ||
+            !insert_stmt.bind_string(2, msg.destination) ||
+            !insert_stmt.bind_string(3, msg.payload) ||
+            !insert_stmt.bind_int64(4, msg.priority) ||
+            !times_.bind(insert_stmt, 5, msg.created_at) ||
+            !insert_stmt.bind_int64(6, msg.attempt_count) ||
             !insert_stmt.bind_string(7, reason) ||
-            !insert_stmt.bind_string(8, now_str) ||
-            !insert_stmt.bind_string(9, msg->last_error) ||
-            !insert_stmt.bind_string(10, msg->correlation_id) ||
-            !insert_stmt.bind_string(11, msg->message_type)) {
+            !times_.bind(insert_stmt, 8, now) ||
+            !insert_stmt.bind_string(9, msg.last_error) ||
+            !insert_stmt.bind_string(10, msg.correlation_id) ||
+            !insert_stmt.bind_string(11, msg.message_type)) {
             return std::unexpected(queue_error::database_error);
         }
 
@@ -886,7 +2300,7 @@ public:
         }
         auto& delete_stmt = *delete_stmt_result.value();
 
-        if (!delete_stmt.bind_string(1, message_id)) {
+        if (!delete_stmt.bind_string(1, msg.id)) {
             return std::unexpected(queue_error::database_error);
         }
 
@@ -901,33 +2315,16 @@ public:
             return std::unexpected(queue_error::database_error);
         }
 
-        // Update statistics
-        {
-            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
-            stats_.total_dead_lettered++;
-            if (stats_.processing_count > 0) stats_.processing_count--;
-            stats_.dead_letter_count++;
-        }
-
-        // Record dead letter metric
-        monitoring::bridge_metrics_collector::instance().record_dead_letter(
-            msg->destination);
-
-        // Notify callback
-        if (dead_letter_callback_) {
-            dead_letter_entry entry;
-            entry.message = *msg;
-            entry.reason = std::string(reason);
-            entry.dead_lettered_at = now;
-            entry.error_history.push_back(msg->last_error);
-            dead_letter_callback_(entry);
-        }
-
-        return {};
+        return now;
     }
 
     std::optional<queued_message> get_message_internal(const std::string& message_id) const {
-        if (!db_adapter_) return std::nullopt;
+        if (!storage_open()) return std::nullopt;
+
+        if (writer_) {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            return hot_tier_.find(message_id);
+        }
 
         // Acquire connection from pool
         auto conn_result = integration::connection_scope::acquire(*db_adapter_);
@@ -955,29 +2352,19 @@ public:
         }
 
         if (result.value()->next()) {
-            const auto& row = result.value()->current_row();
-            queued_message msg;
-            msg.id = row.get_string(0);
-            msg.destination = row.get_string(1);
-            msg.payload = row.get_string(2);
-            msg.priority = static_cast<int>(row.get_int64(3));
-            msg.state = static_cast<message_state>(row.get_int64(4));
-            msg.created_at = from_sqlite_timestamp(row.get_string(5));
-            msg.scheduled_at = from_sqlite_timestamp(row.get_string(6));
-            msg.attempt_count = static_cast<int>(row.get_int64(7));
-
-            if (!row.is_null(8)) msg.last_error = row.get_string(8);
-            if (!row.is_null(9)) msg.correlation_id = row.get_string(9);
-            if (!row.is_null(10)) msg.message_type = row.get_string(10);
-
-            return msg;
+            return read_message(result.value()->current_row(), times_);
         }
 
         return std::nullopt;
     }
 
     size_t queue_depth_internal(std::string_view destination) const {
-        if (!db_adapter_) return 0;
+        if (!storage_open()) return 0;
+
+        if (writer_) {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            return hot_tier_.depth(destination);
+        }
 
         // Acquire connection from pool
         auto conn_result = integration::connection_scope::acquire(*db_adapter_);
@@ -1020,57 +2407,193 @@ public:
         return 0;
     }
 
-    void worker_loop() {
-        while (workers_running_) {
-            std::optional<queued_message> msg;
+    /**
+     * @brief Count messages made ready and wake workers to claim them
+     */
+    void signal_work(size_t count) {
+        if (count == 0) return;
+        {
+            std::lock_guard<std::mutex> lock(worker_mutex_);
+            ready_signals_ += count;
+        }
+        if (count == 1) {
+            worker_cv_.notify_one();
+        } else {
+            worker_cv_.notify_all();
+        }
+    }
+
+    /**
+     * @brief Track a scheduled retry on the timer wheel
+     */
+    void schedule_retry(std::chrono::system_clock::time_point due) {
+        auto steady_due = std::chrono::steady_clock::now() +
+                          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                              due - std::chrono::system_clock::now());
+        {
+            std::lock_guard<std::mutex> lock(worker_mutex_);
+            if (!retry_wheel_.schedule(steady_due)) {
+                ready_signals_++;
+            }
+        }
+        // The timekeeper may need an earlier deadline
+        worker_cv_.notify_all();
+    }
+
+    /**
+     * @brief Load retries scheduled before this start onto the timer wheel
+     */
+    void load_scheduled_retries() {
+        if (!storage_open()) return;
 
+        if (writer_) {
+            std::vector<std::chrono::system_clock::time_point> due_times;
             {
-                std::unique_lock<std::mutex> lock(worker_mutex_);
-                worker_cv_.wait(lock, [this]() {
-                    return !workers_running_ || queue_depth_internal("") > 0;
-                });
+                std::lock_guard<std::mutex> lock(hot_mutex_);
+                due_times = hot_tier_.retry_times();
+            }
+            for (const auto& due : due_times) {
+                schedule_retry(due);
+            }
+            return;
+        }
+
+        auto conn_result = integration::connection_scope::acquire(*db_adapter_);
+        if (!conn_result) {
+            return;
+        }
+        auto& conn_scope = *conn_result;
 
-                if (!workers_running_) break;
+        auto stmt_result = conn_scope.connection().prepare(
+            "SELECT DISTINCT scheduled_at FROM message_queue WHERE state = ?");
+        if (!stmt_result) return;
+        auto& stmt = *stmt_result.value();
+
+        if (!stmt.bind_int64(1, static_cast<int>(message_state::retry_scheduled))) {
+            return;
+        }
+
+        auto result = stmt.execute();
+        if (!result) {
+            return;
+        }
+
+        std::vector<std::chrono::system_clock::time_point> due_times;
+        while (result.value()->next()) {
+            due_times.push_back(
+                times_.read(result.value()->current_row(), 0));
+        }
+        for (const auto& due : due_times) {
+            schedule_retry(due);
+        }
+    }
+
+    /**
+     * @brief Block until messages may be ready to claim
+     *
+     * Consumes one ready signal. One idle worker acts as the timekeeper and
+     * sleeps until the next scheduled retry on the timer wheel; the others
+     * sleep until signaled. Nothing polls the database.
+     *
+     * @param limit Optional upper bound on the wait
+     * @return false if workers are stopping
+     */
+    bool wait_for_work(std::optional<std::chrono::milliseconds> limit = std::nullopt) {
+        std::unique_lock<std::mutex> lock(worker_mutex_);
+        const auto wait_end = limit ? std::optional{std::chrono::steady_clock::now() + *limit}
+                                    : std::nullopt;
+
+        while (workers_running_ && ready_signals_ == 0) {
+            if (wait_end && std::chrono::steady_clock::now() >= *wait_end) {
+                return workers_running_;
             }
 
-            msg = dequeue_internal("");
-            if (!msg) {
-                // No message ready, wait a bit
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-                continue;
+            if (!timekeeper_active_ && !retry_wheel_.empty()) {
+                timekeeper_active_ = true;
+                auto deadline = *retry_wheel_.next_deadline();
+                if (wait_end) {
+                    deadline = std::min(deadline, *wait_end);
+                }
+                worker_cv_.wait_until(lock, deadline);
+                timekeeper_active_ = false;
+
+                ready_signals_ += retry_wheel_.advance(std::chrono::steady_clock::now());
+                if (ready_signals_ > 1) {
+                    worker_cv_.notify_all();
+                } else if (ready_signals_ == 0) {
+                    // Hand timekeeping to another idle worker if one exists
+                    worker_cv_.notify_one();
+                }
+            } else if (wait_end) {
+                worker_cv_.wait_until(lock, *wait_end);
+            } else {
+                worker_cv_.wait(lock);
             }
+        }
 
-            // Process the message
-            if (sender_) {
-                auto start = std::chrono::steady_clock::now();
-                auto result = sender_(*msg);
-                auto end = std::chrono::steady_clock::now();
-                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        if (!workers_running_) {
+            return false;
+        }
+        ready_signals_--;
+        return true;
+    }
 
-                if (result) {
-                    ack_internal(msg->id);
-
-                    // Update average delivery time
-                    {
-                        std::lock_guard<std::mutex> stats_lock(stats_mutex_);
-                        double total = stats_.avg_delivery_time_ms *
-                                       (stats_.total_delivered > 0 ? stats_.total_delivered - 1 : 0);
-                        stats_.avg_delivery_time_ms =
-                            (total + static_cast<double>(duration.count())) /
-                            std::max(stats_.total_delivered, size_t{1});
-                    }
+    /**
+     * @brief Deliver one claimed message through the sender
+     */
+    void deliver(const queued_message& msg) {
+        auto start = std::chrono::steady_clock::now();
+        auto result = sender_(msg);
+        auto end = std::chrono::steady_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
 
-                    if (delivery_callback_) {
-                        delivery_callback_(*msg, true, "");
-                    }
-                } else {
-                    nack_internal(msg->id, result.error());
+        if (result) {
+            ack_internal(msg.id);
 
-                    if (delivery_callback_) {
-                        delivery_callback_(*msg, false, result.error());
-                    }
-                }
+            // Update average delivery time
+            {
+                std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+                double total = stats_.avg_delivery_time_ms *
+                               (stats_.total_delivered > 0 ? stats_.total_delivered - 1 : 0);
+                stats_.avg_delivery_time_ms =
+                    (total + static_cast<double>(duration.count())) /
+                    std::max(stats_.total_delivered, size_t{1});
+            }
+
+            if (delivery_callback_) {
+                delivery_callback_(msg, true, "");
+            }
+        } else {
+            nack_internal(msg.id, result.error());
+
+            if (delivery_callback_) {
+                delivery_callback_(msg, false, result.error());
+            }
+        }
+    }
+
+    /**
+     * @brief Deliver a claimed batch, releasing the rest if workers stop
+     */
+    void deliver_batch(const std::vector<queued_message>& batch) {
+        for (size_t i = 0; i < batch.size(); ++i) {
+            if (!workers_running_) {
+                release_claimed(batch, i);
+                return;
             }
+            deliver(batch[i]);
+        }
+    }
+
+    void worker_loop() {
+        while (workers_running_) {
+            auto batch = claim_internal(std::max<size_t>(config_.batch_size, 1), "");
+            if (batch.empty()) {
+                if (!wait_for_work()) break;
+                continue;
+            }
+
+            deliver_batch(batch);
         }
     }
 
@@ -1078,6 +2601,7 @@ public:
         if (workers_running_) return;
 
         workers_running_ = true;
+        load_scheduled_retries();
 #ifndef PACS_BRIDGE_STANDALONE_BUILD
         if (config_.executor) {
             for (size_t i = 0; i < config_.worker_count; ++i) {
@@ -1096,7 +2620,27 @@ public:
     }
 
     std::vector<dead_letter_entry> get_dead_letters_internal(size_t limit, size_t offset) const {
-        if (!db_adapter_) return {};
+        if (!storage_open()) return {};
+
+        if (log_mode()) {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            std::vector<const dead_letter_entry*> entries;
+            entries.reserve(dead_letters_.size());
+            for (const auto& [id, entry] : dead_letters_) {
+                entries.push_back(&entry);
+            }
+            std::sort(entries.begin(), entries.end(),
+                      [](const dead_letter_entry* a, const dead_letter_entry* b) {
+                          return a->dead_lettered_at > b->dead_lettered_at;
+                      });
+
+            std::vector<dead_letter_entry> results;
+            for (size_t i = offset; i < entries.size() && results.size() < limit; ++i) {
+                results.push_back(*entries[i]);
+                results.back().message.state = message_state::dead_letter;
+            }
+            return results;
+        }
 
         // Acquire connection from pool
         auto conn_result = integration::connection_scope::acquire(*db_adapter_);
@@ -1134,10 +2678,10 @@ public:
             entry.message.destination = row.get_string(1);
             entry.message.payload = row.get_string(2);
             entry.message.priority = static_cast<int>(row.get_int64(3));
-            entry.message.created_at = from_sqlite_timestamp(row.get_string(4));
+            entry.message.created_at = times_.read(row, 4);
             entry.message.attempt_count = static_cast<int>(row.get_int64(5));
             entry.reason = row.get_string(6);
-            entry.dead_lettered_at = from_sqlite_timestamp(row.get_string(7));
+            entry.dead_lettered_at = times_.read(row, 7);
 
             if (!row.is_null(8)) {
                 entry.error_history.push_back(row.get_string(8));
@@ -1154,7 +2698,12 @@ public:
     }
 
     size_t dead_letter_count_internal() const {
-        if (!db_adapter_) return 0;
+        if (!storage_open()) return 0;
+
+        if (log_mode()) {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            return dead_letters_.size();
+        }
 
         // Acquire connection from pool
         auto conn_result = integration::connection_scope::acquire(*db_adapter_);
@@ -1181,7 +2730,12 @@ public:
     }
 
     std::vector<std::string> destinations_internal() const {
-        if (!db_adapter_) return {};
+        if (!storage_open()) return {};
+
+        if (writer_) {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            return hot_tier_.destinations();
+        }
 
         // Acquire connection from pool
         auto conn_result = integration::connection_scope::acquire(*db_adapter_);
@@ -1217,10 +2771,23 @@ public:
     }
 
     std::expected<void, queue_error> retry_dead_letter_internal(std::string_view message_id) {
-        if (!db_adapter_) {
+        if (!storage_open()) {
             return std::unexpected(queue_error::not_running);
         }
 
+        if (log_mode()) {
+            auto restored = log_restore(message_id);
+            if (!restored) {
+                return restored;
+            }
+            finish_retry_dead_letter();
+            return {};
+        }
+
+        if (!flush_hot_writes()) {
+            return std::unexpected(queue_error::database_error);
+        }
+
         auto conn_result = integration::connection_scope::acquire(*db_adapter_);
         if (!conn_result) {
             return std::unexpected(queue_error::database_error);
@@ -1257,7 +2824,7 @@ public:
         msg.destination = row.get_string(1);
         msg.payload = row.get_string(2);
         msg.priority = static_cast<int>(row.get_int64(3));
-        msg.created_at = from_sqlite_timestamp(row.get_string(4));
+        msg.created_at = times_.read(row, 4);
         if (!row.is_null(5)) msg.correlation_id = row.get_string(5);
         if (!row.is_null(6)) msg.message_type = row.get_string(6);
 
@@ -1269,8 +2836,6 @@ public:
 
         // Insert back into main queue with reset attempt count
         auto now = std::chrono::system_clock::now();
-        std::string now_str = to_sqlite_timestamp(now);
-        std::string created_str = to_sqlite_timestamp(msg.created_at);
 
         const char* insert_sql =
             "INSERT INTO message_queue "
@@ -1289,8 +2854,8 @@ public:
             !insert_stmt.bind_string(3, msg.payload) ||
             !insert_stmt.bind_int64(4, msg.priority) ||
             !insert_stmt.bind_int64(5, static_cast<int>(message_state::pending)) ||
-            !insert_stmt.bind_string(6, created_str) ||
-            !insert_stmt.bind_string(7, now_str) ||
+            !times_.bind(insert_stmt, 6, msg.created_at) ||
+            !times_.bind(insert_stmt, 7, now) ||
             !insert_stmt.bind_string(8, msg.correlation_id) ||
             !insert_stmt.bind_string(9, msg.message_type)) {
             return std::unexpected(queue_error::database_error);
@@ -1323,6 +2888,60 @@ public:
             return std::unexpected(queue_error::database_error);
         }
 
+        if (writer_) {
+            msg.state = message_state::pending;
+            msg.scheduled_at = now;
+            msg.attempt_count = 0;
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            hot_tier_.insert(std::move(msg));
+        }
+
+        finish_retry_dead_letter();
+        return {};
+    }
+
+    /**
+     * @brief Log a dead letter's return to the queue and publish it once durable
+     *
+     * The dead letter stays listed until the restored message is durable.
+     */
+    std::expected<void, queue_error> log_restore(std::string_view message_id) {
+        std::string id(message_id);
+        uint64_t seq;
+        {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            auto it = dead_letters_.find(id);
+            if (it == dead_letters_.end() || unpublished_.count(id) != 0) {
+                return std::unexpected(queue_error::message_not_found);
+            }
+
+            // Back into the queue with reset attempt count
+            queued_message msg = it->second.message;
+            msg.state = message_state::pending;
+            msg.scheduled_at = std::chrono::system_clock::now();
+            msg.attempt_count = 0;
+            msg.last_error.clear();
+            seq = writer_->restore(msg);
+            unpublished_.emplace(id, std::move(msg));
+        }
+
+        const bool durable = writer_->wait_durable(seq);
+        std::lock_guard<std::mutex> lock(hot_mutex_);
+        auto node = unpublished_.extract(id);
+        if (!durable) {
+            // Re-log the dead letter so a later commit cannot restore it
+            auto it = dead_letters_.find(id);
+            if (it != dead_letters_.end()) {
+                writer_->dead_letter(it->second);
+            }
+            return std::unexpected(queue_error::database_error);
+        }
+        dead_letters_.erase(id);
+        hot_tier_.insert(std::move(node.mapped()));
+        return {};
+    }
+
+    void finish_retry_dead_letter() {
         // Update statistics
         {
             std::lock_guard<std::mutex> stats_lock(stats_mutex_);
@@ -1331,16 +2950,39 @@ public:
         }
 
         // Notify workers
-        worker_cv_.notify_one();
-
-        return {};
+        signal_work(1);
     }
 
     std::expected<void, queue_error> delete_dead_letter_internal(std::string_view message_id) {
-        if (!db_adapter_) {
+        if (!storage_open()) {
             return std::unexpected(queue_error::not_running);
         }
 
+        if (log_mode()) {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            std::string id(message_id);
+            if (dead_letters_.erase(id) == 0) {
+                return std::unexpected(queue_error::message_not_found);
+            }
+            writer_->remove_dead_letter(id);
+        } else {
+            auto deleted = delete_stored_dead_letter(message_id);
+            if (!deleted) {
+                return deleted;
+            }
+        }
+
+        // Update statistics
+        {
+            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+            if (stats_.dead_letter_count > 0) stats_.dead_letter_count--;
+        }
+
+        return {};
+    }
+
+    std::expected<void, queue_error> delete_stored_dead_letter(std::string_view message_id) {
+
         auto conn_result = integration::connection_scope::acquire(*db_adapter_);
         if (!conn_result) {
             return std::unexpected(queue_error::database_error);
@@ -1368,24 +3010,28 @@ public:
             return std::unexpected(queue_error::message_not_found);
         }
 
-        // Update statistics
-        {
-            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
-            if (stats_.dead_letter_count > 0) stats_.dead_letter_count--;
-        }
-
         return {};
     }
 
     size_t purge_dead_letters_internal() {
-        if (!db_adapter_) return 0;
+        if (!storage_open()) return 0;
 
-        size_t count = dead_letter_count_internal();
+        size_t count = 0;
+        if (log_mode()) {
+            std::lock_guard<std::mutex> lock(hot_mutex_);
+            for (const auto& [id, entry] : dead_letters_) {
+                writer_->remove_dead_letter(id);
+            }
+            count = dead_letters_.size();
+            dead_letters_.clear();
+        } else {
+            count = dead_letter_count_internal();
 
-        auto conn_result = integration::connection_scope::acquire(*db_adapter_);
-        if (!conn_result) return 0;
+            auto conn_result = integration::connection_scope::acquire(*db_adapter_);
+            if (!conn_result) return 0;
 
-        (void)conn_result->connection().execute("DELETE FROM dead_letter_queue");
+            (void)conn_result->connection().execute("DELETE FROM dead_letter_queue");
+        }
 
         // Update statistics
         {
@@ -1397,7 +3043,12 @@ public:
     }
 
     void compact_internal() {
-        if (!db_adapter_) return;
+        if (!storage_open()) return;
+
+        if (log_mode()) {
+            writer_->request_maintenance();
+            return;
+        }
 
         auto conn_result = integration::connection_scope::acquire(*db_adapter_);
         if (!conn_result) return;
@@ -1421,49 +3072,14 @@ public:
                 return;
             }
 
-            std::optional<queued_message> msg;
-
-            {
-                std::unique_lock<std::mutex> lock(worker_mutex_);
-                worker_cv_.wait_for(lock, std::chrono::milliseconds{100}, [this]() {
-                    return !workers_running_ || queue_depth_internal("") > 0;
-                });
-
-                if (!workers_running_) {
+            auto batch = claim_internal(std::max<size_t>(config_.batch_size, 1), "");
+            if (batch.empty()) {
+                // Bounded so executor threads are returned between iterations
+                if (!wait_for_work(std::chrono::milliseconds{100})) {
                     return;
                 }
-            }
-
-            msg = dequeue_internal("");
-            if (msg && sender_) {
-                auto start = std::chrono::steady_clock::now();
-                auto result = sender_(*msg);
-                auto end = std::chrono::steady_clock::now();
-                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-
-                if (result) {
-                    ack_internal(msg->id);
-
-                    // Update average delivery time
-                    {
-                        std::lock_guard<std::mutex> stats_lock(stats_mutex_);
-                        double total = stats_.avg_delivery_time_ms *
-                                       (stats_.total_delivered > 0 ? stats_.total_delivered - 1 : 0);
-                        stats_.avg_delivery_time_ms =
-                            (total + static_cast<double>(duration.count())) /
-                            std::max(stats_.total_delivered, size_t{1});
-                    }
-
-                    if (delivery_callback_) {
-                        delivery_callback_(*msg, true, "");
-                    }
-                } else {
-                    nack_internal(msg->id, result.error());
-
-                    if (delivery_callback_) {
-                        delivery_callback_(*msg, false, result.error());
-                    }
-                }
+            } else if (sender_) {
+                deliver_batch(batch);
             }
 
             // Reschedule for next iteration
@@ -1567,7 +3183,11 @@ std::optional<queued_message> queue_manager::dequeue(std::string_view destinatio
     if (!pimpl_->running_) {
         return std::nullopt;
     }
-    return pimpl_->dequeue_internal(destination);
+    auto claimed = pimpl_->claim_internal(1, destination);
+    if (claimed.empty()) {
+        return std::nullopt;
+    }
+    return std::move(claimed.front());
 }
 
 std::vector<queued_message> queue_manager::dequeue_batch(size_t count,
@@ -1576,14 +3196,7 @@ std::vector<queued_message> queue_manager::dequeue_batch(size_t count,
         return {};
     }
 
-    std::vector<queued_message> results;
-    results.reserve(count);
-    for (size_t i = 0; i < count; ++i) {
-        auto msg = pimpl_->dequeue_internal(destination);
-        if (!msg) break;
-        results.push_back(std::move(*msg));
-    }
-    return results;
+    return pimpl_->claim_internal(count, destination);
 }
 
 std::expected<void, queue_error> queue_manager::ack(std::string_view message_id) {
@@ -1670,6 +3283,11 @@ std::vector<queued_message> queue_manager::get_pending(std::string_view destinat
         return {};
     }
 
+    if (pimpl_->writer_) {
+        std::lock_guard<std::mutex> lock(pimpl_->hot_mutex_);
+        return pimpl_->hot_tier_.pending(destination, limit);
+    }
+
     if (!pimpl_->db_adapter_) return {};
 
     // Acquire connection from pool
@@ -1717,22 +3335,7 @@ std::vector<queued_message> queue_manager::get_pending(std::string_view destinat
 
     std::vector<queued_message> results;
     while (result.value()->next()) {
-        const auto& row = result.value()->current_row();
-        queued_message msg;
-        msg.id = row.get_string(0);
-        msg.destination = row.get_string(1);
-        msg.payload = row.get_string(2);
-        msg.priority = static_cast<int>(row.get_int64(3));
-        msg.state = static_cast<message_state>(row.get_int64(4));
-        msg.created_at = from_sqlite_timestamp(row.get_string(5));
-        msg.scheduled_at = from_sqlite_timestamp(row.get_string(6));
-        msg.attempt_count = static_cast<int>(row.get_int64(7));
-
-        if (!row.is_null(8)) msg.last_error = row.get_string(8);
-        if (!row.is_null(9)) msg.correlation_id = row.get_string(9);
-        if (!row.is_null(10)) msg.message_type = row.get_string(10);
-
-        results.push_back(std::move(msg));
+        results.push_back(read_message(result.value()->current_row(), pimpl_->times_));
     }
 
     return results;
@@ -1759,8 +3362,12 @@ queue_statistics queue_manager::get_statistics() const {
     stats.processing_count = 0;
     stats.retry_scheduled_count = 0;
 
-    // Query actual counts from database
-    if (pimpl_->db_adapter_) {
+    if (pimpl_->writer_) {
+        // The hot tier holds every queued message
+        std::lock_guard<std::mutex> hot_lock(pimpl_->hot_mutex_);
+        pimpl_->hot_tier_.count(stats);
+    } else if (pimpl_->db_adapter_) {
+        // Query actual counts from database
         // Acquire connection from pool
         auto conn_result = integration::connection_scope::acquire(*pimpl_->db_adapter_);
         if (conn_result) {
@@ -1914,6 +3521,32 @@ queue_config_builder& queue_config_builder::wal_mode(bool enable) {
     return *this;
 }
 
+queue_config_builder& queue_config_builder::hot_tier(std::chrono::milliseconds commit_interval,
+                                                    size_t max_batch) {
+    config_.persistence = queue_persistence::hot_tier;
+    config_.group_commit_interval = commit_interval;
+    config_.group_commit_max_batch = max_batch;
+    return *this;
+}
+
+queue_config_builder& queue_config_builder::segmented_log(std::string_view directory,
+                                                         size_t segment_size) {
+    config_.persistence = queue_persistence::segmented_log;
+    config_.segment_directory = std::string(directory);
+    config_.segment_size = segment_size;
+    return *this;
+}
+
+queue_config_builder& queue_config_builder::sync_mode(queue_sync_mode mode) {
+    config_.sync_mode = mode;
+    return *this;
+}
+
+queue_config_builder& queue_config_builder::timestamp_format(queue_timestamp_format format) {
+    config_.timestamp_format = format;
+    return *this;
+}
+
 queue_config queue_config_builder::build() const {
     return config_;
 }
@@ -468,6 +468,14 @@ reliable_sender_config_builder& reliable_sender_config_builder::ttl(
     return *this;
 }
 
+reliable_sender_config_builder& reliable_sender_config_builder::segmented_log(
+    std::string_view directory, size_t segment_size) {
+    config_.queue.persistence = queue_persistence::segmented_log;
+    config_.queue.segment_directory = std::string(directory);
+    config_.queue.segment_size = segment_size;
+    return *this;
+}
+
 reliable_sender_config_builder& reliable_sender_config_builder::add_destination(
     const outbound_destination& dest) {
     config_.router.destinations.push_back(dest);
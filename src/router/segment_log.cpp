@@ -0,0 +1,475 @@
+/**
+ * @file segment_log.cpp
+ * @brief Append-only segmented log storage for queue_manager
+ *
+ * @see src/router/segment_log.h
+ */
+
+#include "segment_log.h"
+
+#include "pacs/bridge/internal/binary_fields.h"
+
+#ifndef _WIN32
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace pacs::bridge::router {
+
+namespace {
+
+constexpr char segment_magic[8] = {'P', 'B', 'Q', 'S', 'E', 'G', '0', '1'};
+constexpr size_t segment_header_size = 16;
+constexpr size_t record_header_size = 8;  // length + CRC
+constexpr const char* segment_extension = ".seg";
+
+using internal::crc32;
+using internal::field_reader;
+using internal::field_writer;
+
+void write_message(field_writer& w, const queued_message& msg) {
+    w.str(msg.id);
+    w.str(msg.destination);
+    w.str(msg.payload);
+    w.i32(msg.priority);
+    w.u8(static_cast<uint8_t>(msg.state));
+    w.time(msg.created_at);
+    w.time(msg.scheduled_at);
+    w.i32(msg.attempt_count);
+    w.str(msg.last_error);
+    w.str(msg.correlation_id);
+    w.str(msg.message_type);
+}
+
+queued_message read_message(field_reader& r) {
+    queued_message msg;
+    msg.id = r.str();
+    msg.destination = r.str();
+    msg.payload = r.str();
+    msg.priority = r.i32();
+    msg.state = static_cast<message_state>(r.u8());
+    msg.created_at = r.time();
+    msg.scheduled_at = r.time();
+    msg.attempt_count = r.i32();
+    msg.last_error = r.str();
+    msg.correlation_id = r.str();
+    msg.message_type = r.str();
+    return msg;
+}
+
+std::string segment_file_name(uint64_t id) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx%s", static_cast<unsigned long long>(id),
+                  segment_extension);
+    return name;
+}
+
+std::optional<uint64_t> parse_segment_id(const std::filesystem::path& path) {
+    if (path.extension() != segment_extension) return std::nullopt;
+    const std::string stem = path.stem().string();
+    if (stem.size() != 16) return std::nullopt;
+    uint64_t id = 0;
+    for (char c : stem) {
+        int digit;
+        if (c >= '0' && c <= '9') digit = c - '0';
+        else if (c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+        else return std::nullopt;
+        id = (id << 4) | static_cast<uint64_t>(digit);
+    }
+    return id;
+}
+
+void sync_directory(const std::filesystem::path& directory) noexcept {
+    int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+}
+
+}  // namespace
+
+// =============================================================================
+// segment_log
+// =============================================================================
+
+segment_log::segment_log(std::filesystem::path directory, size_t segment_size,
+                         queue_sync_mode sync_mode)
+    : directory_(std::move(directory)),
+      segment_size_(std::max(segment_size, segment_header_size + 4096)),
+      sync_mode_(sync_mode) {}
+
+segment_log::~segment_log() { close_head(); }
+
+bool segment_log::open(replay_state& state) {
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    if (ec) return false;
+
+    std::map<uint64_t, std::filesystem::path> files;
+    for (const auto& dir_entry : std::filesystem::directory_iterator(directory_, ec)) {
+        if (auto id = parse_segment_id(dir_entry.path())) {
+            files.emplace(*id, dir_entry.path());
+        }
+    }
+    if (ec) return false;
+
+    uint64_t last_id = 0;
+    for (const auto& [id, path] : files) {
+        segments_[id].path = path;
+        if (!replay_segment(id, path, state)) {
+            return false;
+        }
+        last_id = id;
+    }
+
+    return open_head(last_id + 1, segment_size_);
+}
+
+bool segment_log::replay_segment(uint64_t id, const std::filesystem::path& path,
+                                 replay_state& state) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+    const size_t size = static_cast<size_t>(st.st_size);
+    if (size < segment_header_size) {
+        ::close(fd);
+        return true;  // Created but never written
+    }
+
+    void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) return false;
+    const auto* data = static_cast<const uint8_t*>(mapped);
+
+    field_reader header(data + sizeof(segment_magic), 8);
+    if (std::memcmp(data, segment_magic, sizeof(segment_magic)) != 0 ||
+        header.u64() != id) {
+        ::munmap(mapped, size);
+        return true;  // Not one of ours; leave it alone
+    }
+
+    // Records of the current batch, applied only once its commit marker is read
+    std::vector<std::pair<record_type, std::pair<size_t, size_t>>> batch;
+
+    size_t offset = segment_header_size;
+    while (offset + record_header_size < size) {
+        field_reader frame(data + offset, record_header_size);
+        const uint32_t length = frame.u32();
+        const uint32_t crc = frame.u32();
+        const size_t body = offset + record_header_size;
+        if (length == 0 || length > size - body || crc32(data + body, length) != crc) {
+            break;  // Zero fill or torn write
+        }
+        offset = body + length;
+
+        const auto type = static_cast<record_type>(data[body]);
+        if (type != record_type::commit) {
+            batch.push_back({type, {body + 1, length - 1}});
+            continue;
+        }
+
+        for (const auto& [record, span] : batch) {
+            field_reader r(data + span.first, span.second);
+            switch (record) {
+                case record_type::message_put: {
+                    auto msg = read_message(r);
+                    if (!r.ok()) break;
+                    apply_home({false, true, msg.id}, id);
+                    std::string key = msg.id;
+                    state.messages.insert_or_assign(std::move(key), std::move(msg));
+                    break;
+                }
+                case record_type::message_update: {
+                    std::string msg_id = r.str();
+                    auto state_value = static_cast<message_state>(r.u8());
+                    auto scheduled_at = r.time();
+                    auto attempt_count = r.i32();
+                    auto last_error = r.str();
+                    auto it = state.messages.find(msg_id);
+                    if (!r.ok() || it == state.messages.end()) break;
+                    it->second.state = state_value;
+                    it->second.scheduled_at = scheduled_at;
+                    it->second.attempt_count = attempt_count;
+                    it->second.last_error = std::move(last_error);
+                    break;
+                }
+                case record_type::message_remove: {
+                    std::string msg_id = r.str();
+                    if (!r.ok()) break;
+                    apply_home({false, false, msg_id}, id);
+                    state.messages.erase(msg_id);
+                    break;
+                }
+                case record_type::dead_letter_put: {
+                    dead_letter_entry entry;
+                    entry.message = read_message(r);
+                    entry.reason = r.str();
+                    entry.dead_lettered_at = r.time();
+                    const uint32_t errors = r.u32();
+                    for (uint32_t i = 0; i < errors && r.ok(); ++i) {
+                        entry.error_history.push_back(r.str());
+                    }
+                    if (!r.ok()) break;
+                    apply_home({true, true, entry.message.id}, id);
+                    std::string key = entry.message.id;
+                    state.dead_letters.insert_or_assign(std::move(key), std::move(entry));
+                    break;
+                }
+                case record_type::dead_letter_remove: {
+                    std::string entry_id = r.str();
+                    if (!r.ok()) break;
+                    apply_home({true, false, entry_id}, id);
+                    state.dead_letters.erase(entry_id);
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+        batch.clear();
+    }
+
+    ::munmap(mapped, size);
+    return true;
+}
+
+void segment_log::stage(record_type type, const std::vector<uint8_t>& payload) {
+    const auto type_byte = static_cast<uint8_t>(type);
+    uint32_t crc = crc32(&type_byte, 1);
+    crc = crc32(payload.data(), payload.size(), crc);
+
+    field_writer w(staged_);
+    w.u32(static_cast<uint32_t>(payload.size() + 1));
+    w.u32(crc);
+    w.u8(type_byte);
+    staged_.insert(staged_.end(), payload.begin(), payload.end());
+}
+
+void segment_log::put_message(const queued_message& msg) {
+    std::vector<uint8_t> payload;
+    field_writer w(payload);
+    write_message(w, msg);
+    stage(record_type::message_put, payload);
+    staged_homes_.push_back({false, true, msg.id});
+}
+
+void segment_log::update_message(const queued_message& msg) {
+    std::vector<uint8_t> payload;
+    field_writer w(payload);
+    w.str(msg.id);
+    w.u8(static_cast<uint8_t>(msg.state));
+    w.time(msg.scheduled_at);
+    w.i32(msg.attempt_count);
+    w.str(msg.last_error);
+    stage(record_type::message_update, payload);
+}
+
+void segment_log::remove_message(const std::string& id) {
+    std::vector<uint8_t> payload;
+    field_writer w(payload);
+    w.str(id);
+    stage(record_type::message_remove, payload);
+    staged_homes_.push_back({false, false, id});
+}
+
+void segment_log::put_dead_letter(const dead_letter_entry& entry) {
+    std::vector<uint8_t> payload;
+    field_writer w(payload);
+    write_message(w, entry.message);
+    w.str(entry.reason);
+    w.time(entry.dead_lettered_at);
+    w.u32(static_cast<uint32_t>(entry.error_history.size()));
+    for (const auto& error : entry.error_history) {
+        w.str(error);
+    }
+    stage(record_type::dead_letter_put, payload);
+    staged_homes_.push_back({true, true, entry.message.id});
+}
+
+void segment_log::remove_dead_letter(const std::string& id) {
+    std::vector<uint8_t> payload;
+    field_writer w(payload);
+    w.str(id);
+    stage(record_type::dead_letter_remove, payload);
+    staged_homes_.push_back({true, false, id});
+}
+
+bool segment_log::commit() {
+    if (staged_.empty()) {
+        return true;
+    }
+    stage(record_type::commit, {});
+
+    const size_t needed = staged_.size();
+    bool ok = true;
+    if (head_.map && head_.size + needed > head_.capacity) {
+        ok = seal_head();
+    }
+    if (ok && !head_.map) {
+        ok = open_head(head_.id + 1, std::max(segment_size_, segment_header_size + needed));
+    }
+
+    if (ok) {
+        std::memcpy(head_.map + head_.size, staged_.data(), needed);
+        if (sync_mode_ == queue_sync_mode::full) {
+            const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+            const size_t start = head_.size / page * page;
+            ok = ::msync(head_.map + start, head_.size + needed - start, MS_SYNC) == 0;
+        }
+    }
+
+    if (ok) {
+        head_.size += needed;
+        for (const auto& home : staged_homes_) {
+            apply_home(home, head_.id);
+        }
+    }
+
+    staged_.clear();
+    staged_homes_.clear();
+    return ok;
+}
+
+void segment_log::apply_home(const staged_home& home, uint64_t segment_id) {
+    auto& homes = home.dead_letter ? dead_letter_home_ : message_home_;
+    auto it = homes.find(home.id);
+    if (it != homes.end()) {
+        auto previous = segments_.find(it->second);
+        if (previous != segments_.end() && previous->second.live > 0) {
+            previous->second.live--;
+        }
+    }
+
+    if (home.put) {
+        auto& current = segments_[segment_id];
+        current.full_records++;
+        current.live++;
+        if (it != homes.end()) {
+            it->second = segment_id;
+        } else {
+            homes.emplace(home.id, segment_id);
+        }
+    } else if (it != homes.end()) {
+        homes.erase(it);
+    }
+}
+
+bool segment_log::open_head(uint64_t id, size_t capacity) {
+    auto path = directory_ / segment_file_name(id);
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) return false;
+
+    if (::ftruncate(fd, static_cast<off_t>(capacity)) != 0) {
+        ::close(fd);
+        return false;
+    }
+    void* mapped = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapped == MAP_FAILED) {
+        ::close(fd);
+        return false;
+    }
+
+    head_.id = id;
+    head_.fd = fd;
+    head_.map = static_cast<uint8_t*>(mapped);
+    head_.capacity = capacity;
+
+    std::vector<uint8_t> header(segment_magic, segment_magic + sizeof(segment_magic));
+    field_writer(header).u64(id);
+    std::memcpy(head_.map, header.data(), header.size());
+    head_.size = segment_header_size;
+
+    segments_[id].path = std::move(path);
+    if (sync_mode_ != queue_sync_mode::off) {
+        sync_directory(directory_);
+    }
+    return true;
+}
+
+bool segment_log::seal_head() {
+    bool ok = true;
+    if (sync_mode_ != queue_sync_mode::off && head_.map) {
+        ok = ::msync(head_.map, head_.size, MS_SYNC) == 0;
+    }
+    close_head();
+    return ok;
+}
+
+void segment_log::close_head() noexcept {
+    if (head_.map) {
+        if (sync_mode_ != queue_sync_mode::off) {
+            ::msync(head_.map, head_.size, MS_SYNC);
+        }
+        ::munmap(head_.map, head_.capacity);
+        head_.map = nullptr;
+    }
+    if (head_.fd >= 0) {
+        // Drop the unused zero tail
+        (void)::ftruncate(head_.fd, static_cast<off_t>(head_.size));
+        ::close(head_.fd);
+        head_.fd = -1;
+    }
+}
+
+size_t segment_log::compact(const message_lookup& messages,
+                            const dead_letter_lookup& dead_letters,
+                            double max_live_ratio) {
+    size_t deleted = 0;
+    while (segments_.size() > 1) {
+        auto oldest = segments_.begin();
+        if (oldest->first == head_.id) break;
+
+        auto& seg = oldest->second;
+        if (seg.live > 0 &&
+            static_cast<double>(seg.live) >
+                max_live_ratio * static_cast<double>(seg.full_records)) {
+            break;
+        }
+
+        if (seg.live > 0) {
+            // Re-put records still homed here at the head
+            for (const auto& [id, home] : message_home_) {
+                if (home != oldest->first) continue;
+                if (auto msg = messages(id)) {
+                    put_message(*msg);
+                } else {
+                    remove_message(id);
+                }
+            }
+            for (const auto& [id, home] : dead_letter_home_) {
+                if (home != oldest->first) continue;
+                if (auto entry = dead_letters(id)) {
+                    put_dead_letter(*entry);
+                } else {
+                    remove_dead_letter(id);
+                }
+            }
+            if (!commit() || seg.live > 0) break;
+        }
+
+        std::error_code ec;
+        std::filesystem::remove(seg.path, ec);
+        segments_.erase(oldest);
+        deleted++;
+    }
+    return deleted;
+}
+
+size_t segment_log::segment_count() const noexcept { return segments_.size(); }
+
+}  // namespace pacs::bridge::router
+
+#endif  // _WIN32
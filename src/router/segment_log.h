@@ -0,0 +1,182 @@
+#ifndef PACS_BRIDGE_ROUTER_SEGMENT_LOG_H
+#define PACS_BRIDGE_ROUTER_SEGMENT_LOG_H
+
+/**
+ * @file segment_log.h
+ * @brief Append-only segmented log storage for queue_manager
+ *
+ * Queue mutations are appended as records to memory-mapped segment files in
+ * one directory. Records are grouped into batches closed by a commit marker;
+ * every record carries a CRC-32, and a batch without a valid commit marker
+ * (torn by a crash) is ignored on replay. A batch never spans segments.
+ *
+ * Segment layout:
+ * - 16-byte header: magic "PBQSEG01", segment id (little-endian u64)
+ * - Records: payload length (u32), CRC-32 of type and payload (u32),
+ *   type (u8), payload
+ * - Zero fill after the last record
+ *
+ * open() replays every segment into the caller's state and starts a new
+ * head segment. Each live message and dead letter has a home: the segment
+ * holding its latest full record. Segments are reclaimed oldest first; live
+ * records still homed in the oldest segment are re-put at the head before
+ * its file is deleted.
+ *
+ * Not thread-safe; driven by a single writer thread. POSIX only.
+ */
+
+#include "pacs/bridge/router/queue_manager.h"
+
+#ifndef _WIN32
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace pacs::bridge::router {
+
+class segment_log {
+public:
+    /**
+     * @brief Queue contents recovered by open()
+     */
+    struct replay_state {
+        std::unordered_map<std::string, queued_message> messages;
+        std::unordered_map<std::string, dead_letter_entry> dead_letters;
+    };
+
+    using message_lookup =
+        std::function<std::optional<queued_message>(const std::string&)>;
+    using dead_letter_lookup =
+        std::function<std::optional<dead_letter_entry>(const std::string&)>;
+
+    /**
+     * @param directory Directory holding the segment files (created if missing)
+     * @param segment_size Capacity of each segment file in bytes
+     * @param sync_mode off: no msync; normal: msync when a segment is sealed;
+     *        full: msync every batch
+     */
+    segment_log(std::filesystem::path directory, size_t segment_size,
+                queue_sync_mode sync_mode);
+
+    ~segment_log();
+
+    segment_log(const segment_log&) = delete;
+    segment_log& operator=(const segment_log&) = delete;
+
+    /**
+     * @brief Replay existing segments into state and open a new head segment
+     *
+     * @return false on I/O failure
+     */
+    [[nodiscard]] bool open(replay_state& state);
+
+    // -------------------------------------------------------------------------
+    // Batch staging; nothing is written until commit()
+    // -------------------------------------------------------------------------
+
+    /** Stage the full record of a message */
+    void put_message(const queued_message& msg);
+
+    /** Stage the mutable fields (state, schedule, attempts, error) of a message */
+    void update_message(const queued_message& msg);
+
+    /** Stage removal of a message */
+    void remove_message(const std::string& id);
+
+    /** Stage the full record of a dead letter */
+    void put_dead_letter(const dead_letter_entry& entry);
+
+    /** Stage removal of a dead letter */
+    void remove_dead_letter(const std::string& id);
+
+    /**
+     * @brief Append the staged records as one batch
+     *
+     * @return false on I/O failure; the batch is discarded and may be restaged
+     */
+    [[nodiscard]] bool commit();
+
+    // -------------------------------------------------------------------------
+    // Compaction
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Reclaim sealed segments from the oldest while they are mostly dead
+     *
+     * A sealed segment is reclaimed once at most max_live_ratio of the full
+     * records written to it are still live. Live records are re-put at the
+     * head with their current contents from the lookups.
+     *
+     * @return Number of segments deleted
+     */
+    size_t compact(const message_lookup& messages,
+                   const dead_letter_lookup& dead_letters, double max_live_ratio);
+
+    /** Number of segment files, including the head */
+    [[nodiscard]] size_t segment_count() const noexcept;
+
+private:
+    enum class record_type : uint8_t {
+        message_put = 1,
+        message_update = 2,
+        message_remove = 3,
+        dead_letter_put = 4,
+        dead_letter_remove = 5,
+        commit = 0x7F
+    };
+
+    struct segment {
+        std::filesystem::path path;
+        size_t full_records = 0;  // message/dead-letter puts written here
+        size_t live = 0;          // puts here that are still the latest
+    };
+
+    struct head_segment {
+        uint64_t id = 0;
+        int fd = -1;
+        uint8_t* map = nullptr;
+        size_t capacity = 0;
+        size_t size = 0;
+    };
+
+    // Home bookkeeping applied once a batch's segment is known
+    struct staged_home {
+        bool dead_letter = false;
+        bool put = false;  // false = remove
+        std::string id;
+    };
+
+    void stage(record_type type, const std::vector<uint8_t>& payload);
+    [[nodiscard]] bool open_head(uint64_t id, size_t capacity);
+    [[nodiscard]] bool seal_head();
+    void close_head() noexcept;
+    void apply_home(const staged_home& home, uint64_t segment_id);
+    bool replay_segment(uint64_t id, const std::filesystem::path& path,
+                        replay_state& state);
+
+    std::filesystem::path directory_;
+    size_t segment_size_;
+    queue_sync_mode sync_mode_;
+
+    std::map<uint64_t, segment> segments_;
+    head_segment head_;
+
+    std::unordered_map<std::string, uint64_t> message_home_;
+    std::unordered_map<std::string, uint64_t> dead_letter_home_;
+
+    std::vector<uint8_t> staged_;
+    std::vector<staged_home> staged_homes_;
+};
+
+}  // namespace pacs::bridge::router
+
+#endif  // _WIN32
+
+#endif  // PACS_BRIDGE_ROUTER_SEGMENT_LOG_H
@@ -8,12 +8,25 @@
 
 #include "pacs/bridge/security/audit_logger.h"
 
+#include "pacs/bridge/internal/mpsc_ring.h"
+
+#include <algorithm>
 #include <atomic>
+#include <charconv>
 #include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <ctime>
 #include <fstream>
-#include <iomanip>
+#include <limits>
 #include <mutex>
-#include <sstream>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
 
 namespace pacs::bridge::security {
 
@@ -108,130 +121,315 @@ const char* to_string(audit_severity severity) noexcept {
 
 namespace {
 
-std::string escape_json(const std::string& str) {
-    std::ostringstream oss;
+void append_escaped(std::string& out, std::string_view str) {
+    static constexpr char hex[] = "0123456789abcdef";
     for (char c : str) {
         switch (c) {
-            case '"':  oss << "\\\""; break;
-            case '\\': oss << "\\\\"; break;
-            case '\b': oss << "\\b";  break;
-            case '\f': oss << "\\f";  break;
-            case '\n': oss << "\\n";  break;
-            case '\r': oss << "\\r";  break;
-            case '\t': oss << "\\t";  break;
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\b': out += "\\b";  break;
+            case '\f': out += "\\f";  break;
+            case '\n': out += "\\n";  break;
+            case '\r': out += "\\r";  break;
+            case '\t': out += "\\t";  break;
             default:
                 if (static_cast<unsigned char>(c) < 32) {
-                    oss << "\\u" << std::hex << std::setw(4)
-                        << std::setfill('0') << static_cast<int>(c);
+                    out += "\\u00";
+                    out += hex[(c >> 4) & 0xF];
+                    out += hex[c & 0xF];
                 } else {
-                    oss << c;
+                    out += c;
                 }
                 break;
         }
     }
-    return oss.str();
 }
 
-std::string format_timestamp(const std::chrono::system_clock::time_point& tp) {
-    auto time_t_value = std::chrono::system_clock::to_time_t(tp);
-    std::tm tm_value{};
-#ifdef _WIN32
-    gmtime_s(&tm_value, &time_t_value);
-#else
-    gmtime_r(&time_t_value, &tm_value);
-#endif
-    std::ostringstream oss;
-    oss << std::put_time(&tm_value, "%Y-%m-%dT%H:%M:%SZ");
-    return oss.str();
+template <typename T>
+void append_number(std::string& out, T value) {
+    char buffer[32];
+    auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, end);
 }
 
-std::string generate_event_id() {
-    static std::atomic<uint64_t> counter{0};
-    auto now = std::chrono::system_clock::now();
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now.time_since_epoch()).count();
-
-    std::ostringstream oss;
-    oss << std::hex << ms << "-" << std::setw(8) << std::setfill('0')
-        << (counter.fetch_add(1) & 0xFFFFFFFF);
-    return oss.str();
+void append_fixed3(std::string& out, double value) {
+    char buffer[64];
+    auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value,
+                                   std::chars_format::fixed, 3);
+    out.append(buffer, ec == std::errc{} ? end : buffer);
 }
 
-}  // namespace
+/** ,"key":"escaped value" */
+void append_string_field(std::string& out, std::string_view key, std::string_view value) {
+    out += ",\"";
+    out += key;
+    out += "\":\"";
+    append_escaped(out, value);
+    out += '"';
+}
 
-std::string healthcare_audit_event_record::to_json() const {
-    std::ostringstream oss;
+/** ISO 8601 UTC to the second, cached per thread since events cluster */
+void append_timestamp(std::string& out, std::chrono::system_clock::time_point tp) {
+    thread_local int64_t cached_second = std::numeric_limits<int64_t>::min();
+    thread_local char cached_text[32] = {};
 
-    oss << "{";
-    oss << "\"timestamp\":\"" << format_timestamp(timestamp) << "\"";
-    oss << ",\"event_id\":\"" << escape_json(event_id) << "\"";
-    oss << ",\"category\":\"" << to_string(category) << "\"";
-    oss << ",\"event\":\"" << to_string(type) << "\"";
-    oss << ",\"severity\":\"" << to_string(severity) << "\"";
-    oss << ",\"description\":\"" << escape_json(description) << "\"";
+    auto seconds = std::chrono::floor<std::chrono::seconds>(tp).time_since_epoch().count();
+    if (seconds != cached_second) {
+        auto time_t_value = static_cast<std::time_t>(seconds);
+        std::tm tm_value{};
+#ifdef _WIN32
+        gmtime_s(&tm_value, &time_t_value);
+#else
+        gmtime_r(&time_t_value, &tm_value);
+#endif
+        std::strftime(cached_text, sizeof(cached_text), "%Y-%m-%dT%H:%M:%SZ", &tm_value);
+        cached_second = seconds;
+    }
+    out += cached_text;
+}
 
-    if (!source_component.empty()) {
-        oss << ",\"source\":\"" << escape_json(source_component) << "\"";
+/**
+ * @brief Append event as one JSON object, reusing out's capacity
+ */
+void append_json(std::string& out, const healthcare_audit_event_record& event) {
+    out += "{\"timestamp\":\"";
+    append_timestamp(out, event.timestamp);
+    out += '"';
+    append_string_field(out, "event_id", event.event_id);
+    append_string_field(out, "category", to_string(event.category));
+    append_string_field(out, "event", to_string(event.type));
+    append_string_field(out, "severity", to_string(event.severity));
+    append_string_field(out, "description", event.description);
+
+    if (!event.source_component.empty()) {
+        append_string_field(out, "source", event.source_component);
     }
 
-    if (session_id) {
-        oss << ",\"session_id\":" << *session_id;
+    if (event.session_id) {
+        out += ",\"session_id\":";
+        append_number(out, *event.session_id);
     }
-    if (remote_address) {
-        oss << ",\"remote_address\":\"" << escape_json(*remote_address) << "\"";
+    if (event.remote_address) {
+        append_string_field(out, "remote_address", *event.remote_address);
     }
-    if (remote_port) {
-        oss << ",\"remote_port\":" << *remote_port;
+    if (event.remote_port) {
+        out += ",\"remote_port\":";
+        append_number(out, *event.remote_port);
     }
-    if (tls_enabled) {
-        oss << ",\"tls_enabled\":" << (*tls_enabled ? "true" : "false");
+    if (event.tls_enabled) {
+        out += ",\"tls_enabled\":";
+        out += *event.tls_enabled ? "true" : "false";
     }
-    if (client_cert_subject) {
-        oss << ",\"client_cert\":\"" << escape_json(*client_cert_subject) << "\"";
+    if (event.client_cert_subject) {
+        append_string_field(out, "client_cert", *event.client_cert_subject);
     }
 
-    if (message_control_id) {
-        oss << ",\"message_control_id\":\"" << escape_json(*message_control_id) << "\"";
+    if (event.message_control_id) {
+        append_string_field(out, "message_control_id", *event.message_control_id);
     }
-    if (message_type) {
-        oss << ",\"message_type\":\"" << escape_json(*message_type) << "\"";
+    if (event.message_type) {
+        append_string_field(out, "message_type", *event.message_type);
     }
-    if (sending_application) {
-        oss << ",\"sending_app\":\"" << escape_json(*sending_application) << "\"";
+    if (event.sending_application) {
+        append_string_field(out, "sending_app", *event.sending_application);
     }
-    if (sending_facility) {
-        oss << ",\"sending_facility\":\"" << escape_json(*sending_facility) << "\"";
+    if (event.sending_facility) {
+        append_string_field(out, "sending_facility", *event.sending_facility);
     }
-    if (message_size) {
-        oss << ",\"message_size\":" << *message_size;
+    if (event.message_size) {
+        out += ",\"message_size\":";
+        append_number(out, *event.message_size);
     }
 
-    oss << ",\"outcome\":\"" << escape_json(outcome) << "\"";
+    append_string_field(out, "outcome", event.outcome);
 
-    if (error_code) {
-        oss << ",\"error_code\":" << *error_code;
+    if (event.error_code) {
+        out += ",\"error_code\":";
+        append_number(out, *event.error_code);
     }
-    if (error_message) {
-        oss << ",\"error_message\":\"" << escape_json(*error_message) << "\"";
+    if (event.error_message) {
+        append_string_field(out, "error_message", *event.error_message);
     }
-    if (processing_time_ms) {
-        oss << ",\"processing_time_ms\":" << std::fixed << std::setprecision(3)
-            << *processing_time_ms;
+    if (event.processing_time_ms) {
+        out += ",\"processing_time_ms\":";
+        append_fixed3(out, *event.processing_time_ms);
     }
 
-    if (!properties.empty()) {
-        oss << ",\"properties\":{";
+    if (!event.properties.empty()) {
+        out += ",\"properties\":{";
         bool first = true;
-        for (const auto& [key, value] : properties) {
-            if (!first) oss << ",";
-            oss << "\"" << escape_json(key) << "\":\"" << escape_json(value) << "\"";
+        for (const auto& [key, value] : event.properties) {
+            if (!first) out += ',';
+            out += '"';
+            append_escaped(out, key);
+            out += "\":\"";
+            append_escaped(out, value);
+            out += '"';
             first = false;
         }
-        oss << "}";
+        out += '}';
     }
 
-    oss << "}";
-    return oss.str();
+    out += '}';
+}
+
+std::string generate_event_id() {
+    static std::atomic<uint64_t> counter{0};
+    auto now = std::chrono::system_clock::now();
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        now.time_since_epoch()).count();
+
+    char buffer[40];
+    auto [end, ec] = std::to_chars(buffer, buffer + 20, ms, 16);
+    *end++ = '-';
+    char sequence[8];
+    auto [seq_end, seq_ec] = std::to_chars(sequence, sequence + sizeof(sequence),
+                                           counter.fetch_add(1) & 0xFFFFFFFF, 16);
+    auto digits = static_cast<size_t>(seq_end - sequence);
+    std::fill_n(end, 8 - digits, '0');
+    std::copy(sequence, seq_end, end + (8 - digits));
+    return std::string(buffer, end + 8);
+}
+
+// =============================================================================
+// Audit File
+// =============================================================================
+
+/**
+ * @brief Append-only log file written with writev and synced with fdatasync
+ */
+class audit_file {
+public:
+    audit_file() = default;
+    ~audit_file() { close(); }
+
+    audit_file(const audit_file&) = delete;
+    audit_file& operator=(const audit_file&) = delete;
+
+    bool open(const std::filesystem::path& path) {
+        close();
+#ifndef _WIN32
+        fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0640);
+        if (fd_ < 0) {
+            return false;
+        }
+#else
+        file_ = std::fopen(path.string().c_str(), "ab");
+        if (file_ == nullptr) {
+            return false;
+        }
+#endif
+        std::error_code ec;
+        size_ = std::filesystem::file_size(path, ec);
+        if (ec) {
+            size_ = 0;
+        }
+        opened_at_ = std::chrono::steady_clock::now();
+        return true;
+    }
+
+    void close() {
+#ifndef _WIN32
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+#else
+        if (file_ != nullptr) {
+            std::fclose(file_);
+            file_ = nullptr;
+        }
+#endif
+    }
+
+    [[nodiscard]] bool is_open() const noexcept {
+#ifndef _WIN32
+        return fd_ >= 0;
+#else
+        return file_ != nullptr;
+#endif
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+
+    [[nodiscard]] std::chrono::steady_clock::duration age() const noexcept {
+        return std::chrono::steady_clock::now() - opened_at_;
+    }
+
+    /**
+     * @brief Append lines[0, count) with as few writev calls as possible
+     */
+    bool write(const std::string* lines, size_t count) {
+#ifndef _WIN32
+        iov_.clear();
+        for (size_t i = 0; i < count; ++i) {
+            iov_.push_back({const_cast<char*>(lines[i].data()), lines[i].size()});
+        }
+        size_t next = 0;
+        while (next < iov_.size()) {
+            int chunk = static_cast<int>(std::min<size_t>(iov_.size() - next, IOV_MAX));
+            ssize_t written = ::writev(fd_, iov_.data() + next, chunk);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            size_ += static_cast<size_t>(written);
+            // Skip fully written buffers; trim a partially written one
+            auto remaining = static_cast<size_t>(written);
+            while (next < iov_.size() && remaining >= iov_[next].iov_len) {
+                remaining -= iov_[next].iov_len;
+                ++next;
+            }
+            if (remaining > 0) {
+                iov_[next].iov_base = static_cast<char*>(iov_[next].iov_base) + remaining;
+                iov_[next].iov_len -= remaining;
+            }
+        }
+        return true;
+#else
+        for (size_t i = 0; i < count; ++i) {
+            if (std::fwrite(lines[i].data(), 1, lines[i].size(), file_) != lines[i].size()) {
+                return false;
+            }
+            size_ += lines[i].size();
+        }
+        return std::fflush(file_) == 0;
+#endif
+    }
+
+    bool sync() {
+#if defined(__linux__)
+        return ::fdatasync(fd_) == 0;
+#elif !defined(_WIN32)
+        return ::fsync(fd_) == 0;
+#else
+        return std::fflush(file_) == 0;
+#endif
+    }
+
+private:
+#ifndef _WIN32
+    int fd_ = -1;
+    std::vector<iovec> iov_;
+#else
+    std::FILE* file_ = nullptr;
+#endif
+    size_t size_ = 0;
+    std::chrono::steady_clock::time_point opened_at_;
+};
+
+// Lines per writev batch in async mode
+constexpr size_t max_batch_events = 1024;
+
+}  // namespace
+
+std::string healthcare_audit_event_record::to_json() const {
+    std::string json;
+    json.reserve(256);
+    append_json(json, *this);
+    return json;
 }
 
 // =============================================================================
@@ -241,7 +439,19 @@ std::string healthcare_audit_event_record::to_json() const {
 class healthcare_audit_logger::impl {
 public:
     explicit impl(const healthcare_audit_config& config)
-        : config_(config) {}
+        : config_(config) {
+        if (config_.async_writes) {
+            ring_ = std::make_unique<internal::mpsc_ring<healthcare_audit_event_record>>(
+                config_.async_queue_capacity);
+            // A full ring must always wake the writer
+            wake_threshold_ = std::clamp<size_t>(config_.flush_batch_size, 1, ring_->capacity());
+            lines_.resize(max_batch_events);
+        } else {
+            lines_.resize(1);
+        }
+    }
+
+    ~impl() { stop(); }
 
     bool start() {
         if (running_) return true;
@@ -253,70 +463,317 @@ public:
         }
 
         // Open log file
-        log_file_.open(config_.log_path, std::ios::app);
-        if (!log_file_) {
-            return false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!file_.open(config_.log_path)) {
+                return false;
+            }
+            stats_.started_at = std::chrono::system_clock::now();
         }
 
         running_ = true;
-        stats_.started_at = std::chrono::system_clock::now();
+        if (ring_) {
+            stopping_ = false;
+            writer_ = std::thread([this] { run_writer(); });
+        }
         return true;
     }
 
     void stop() {
-        if (!running_) return;
-        flush();
-        log_file_.close();
-        running_ = false;
+        if (!running_.exchange(false)) return;
+
+        // A log() call that saw running_ before the exchange may still be
+        // pushing; the writer keeps draining until it is done
+        while (producers_.load() != 0) {
+            std::this_thread::yield();
+        }
+
+        if (writer_.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(wake_mutex_);
+                stopping_ = true;
+            }
+            wake_.notify_one();
+            writer_.join();
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        file_.close();
     }
 
     void log(const healthcare_audit_event_record& event) {
-        if (!running_ || !config_.enabled) return;
+        producer_guard guard(producers_);
+        if (!accepts(event)) return;
+        if (ring_) {
+            enqueue(healthcare_audit_event_record(event));
+        } else {
+            write_now(event);
+        }
+    }
+
+    void log(healthcare_audit_event_record&& event) {
+        producer_guard guard(producers_);
+        if (!accepts(event)) return;
+        if (ring_) {
+            enqueue(std::move(event));
+        } else {
+            write_now(event);
+        }
+    }
+
+    void flush() {
+        if (!ring_ || !running_) return;
+
+        // Wait for everything pushed so far to be written
+        size_t target = ring_->pushed();
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        flush_requested_ = true;
+        wake_.notify_one();
+        flushed_.wait(lock, [&] { return written_ >= target || !running_; });
+    }
+
+    statistics snapshot_statistics() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        statistics result = stats_;
+        result.queue_full_waits = queue_full_waits_.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    healthcare_audit_config config_;
+    std::atomic<bool> running_{false};
+
+private:
+    struct category_counts {
+        size_t hl7 = 0;
+        size_t security = 0;
+        size_t error = 0;
+
+        category_counts& add(healthcare_audit_category category) {
+            if (category == healthcare_audit_category::hl7_transaction) ++hl7;
+            if (category == healthcare_audit_category::security) ++security;
+            if (category == healthcare_audit_category::error) ++error;
+            return *this;
+        }
+    };
+
+    [[nodiscard]] bool accepts(const healthcare_audit_event_record& event) const {
+        if (!running_ || !config_.enabled) return false;
 
         // Check severity filter
         if (static_cast<int>(event.severity) < static_cast<int>(config_.min_severity)) {
-            return;
+            return false;
         }
 
         // Check category filter
-        if (!config_.categories.empty() &&
-            config_.categories.find(event.category) == config_.categories.end()) {
-            return;
-        }
+        return config_.categories.empty() ||
+               config_.categories.find(event.category) != config_.categories.end();
+    }
 
+    /** Synchronous mode: format and write on the caller's thread */
+    void write_now(const healthcare_audit_event_record& event) {
         std::lock_guard<std::mutex> lock(mutex_);
+        lines_[0].clear();
+        append_json(lines_[0], event);
+        lines_[0] += '\n';
+        write_lines(1, category_counts{}.add(event.category));
+    }
+
+    /**
+     * @brief Counts a log() call for stop() to wait on
+     *
+     * Incremented before running_ is read, so stop() either sees the call
+     * or the call sees running_ cleared.
+     */
+    struct producer_guard {
+        explicit producer_guard(std::atomic<size_t>& count) : count_(count) {
+            count_.fetch_add(1);
+        }
+        ~producer_guard() { count_.fetch_sub(1); }
+        producer_guard(const producer_guard&) = delete;
+        producer_guard& operator=(const producer_guard&) = delete;
+
+        std::atomic<size_t>& count_;
+    };
+
+    void enqueue(healthcare_audit_event_record&& event) {
+        // Never drop an audit event: wait for the writer when full. stop()
+        // keeps the writer running until every producer has returned.
+        while (!ring_->try_push(std::move(event))) {
+            queue_full_waits_.fetch_add(1, std::memory_order_relaxed);
+            wake_.notify_one();
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+        if (ring_->size() >= wake_threshold_) {
+            wake_.notify_one();
+        }
+    }
 
-        // Write JSON line
-        log_file_ << event.to_json() << "\n";
-        log_file_.flush();
+    /**
+     * @brief Write lines_[0, count), rotating first if due (mutex_ held)
+     */
+    void write_lines(size_t count, const category_counts& counts) {
+        size_t bytes = 0;
+        for (size_t i = 0; i < count; ++i) {
+            bytes += lines_[i].size();
+        }
 
-        // Update statistics
-        ++stats_.events_logged;
+        if (rotation_due(bytes)) {
+            rotate();
+        }
+
+        bool ok = file_.is_open() && file_.write(lines_.data(), count);
+        if (ok && config_.durability == audit_durability::data_sync) {
+            ok = file_.sync();
+        }
+        if (!ok) {
+            ++stats_.write_failures;
+            return;
+        }
+
+        stats_.events_logged += count;
+        stats_.bytes_written += bytes;
+        ++stats_.batches_written;
+        stats_.hl7_transactions += counts.hl7;
+        stats_.security_events += counts.security;
+        stats_.error_events += counts.error;
         stats_.last_event_at = std::chrono::system_clock::now();
+    }
+
+    [[nodiscard]] bool rotation_due(size_t incoming) const {
+        if (!file_.is_open() || file_.size() == 0) {
+            return false;
+        }
+        if (config_.max_file_size > 0 && file_.size() + incoming > config_.max_file_size) {
+            return true;
+        }
+        return config_.rotation_interval.count() > 0 &&
+               file_.age() >= config_.rotation_interval;
+    }
 
-        if (event.category == healthcare_audit_category::hl7_transaction) {
-            ++stats_.hl7_transactions;
+    /**
+     * @brief Shift log_path.N .. log_path.1 up by one, move log_path to
+     *        log_path.1, then reopen log_path
+     *
+     * With prune_rotated_files, the oldest files beyond max_rotated_files
+     * are then deleted if they are past retention_period.
+     */
+    void rotate() {
+        file_.close();
+
+        std::error_code ec;
+        auto numbered = [this](size_t n) {
+            auto path = config_.log_path;
+            path += "." + std::to_string(n);
+            return path;
+        };
+        size_t rotated = 0;
+        while (std::filesystem::exists(numbered(rotated + 1), ec)) {
+            ++rotated;
+        }
+        for (size_t n = rotated; n > 0; --n) {
+            std::filesystem::rename(numbered(n), numbered(n + 1), ec);
+        }
+        std::filesystem::rename(config_.log_path, numbered(1), ec);
+        if (!ec) {
+            ++rotated;
         }
-        if (event.category == healthcare_audit_category::security) {
-            ++stats_.security_events;
+
+        if (config_.prune_rotated_files) {
+            // Higher numbers are older, so stop at the first file still
+            // within retention
+            auto now = std::filesystem::file_time_type::clock::now();
+            for (size_t n = rotated; n > config_.max_rotated_files; --n) {
+                auto written = std::filesystem::last_write_time(numbered(n), ec);
+                if (ec || now - written < config_.retention_period) {
+                    break;
+                }
+                std::filesystem::remove(numbered(n), ec);
+            }
         }
-        if (event.category == healthcare_audit_category::error) {
-            ++stats_.error_events;
+
+        if (file_.open(config_.log_path)) {
+            ++stats_.rotations;
         }
     }
 
-    void flush() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (log_file_.is_open()) {
-            log_file_.flush();
+    /**
+     * @brief Writer thread: drain the ring every flush_interval, when
+     *        flush_batch_size events are queued, or on flush()/stop()
+     */
+    void run_writer() {
+        for (;;) {
+            bool stopping = false;
+            {
+                std::unique_lock<std::mutex> lock(wake_mutex_);
+                wake_.wait_for(lock, config_.flush_interval, [this] {
+                    return stopping_ || flush_requested_ ||
+                           ring_->size() >= wake_threshold_;
+                });
+                flush_requested_ = false;
+                stopping = stopping_;
+            }
+
+            drain();
+
+            if (stopping && ring_->size() == 0) {
+                break;
+            }
         }
+        flushed_.notify_all();
     }
 
-    healthcare_audit_config config_;
-    std::ofstream log_file_;
-    std::mutex mutex_;
-    std::atomic<bool> running_{false};
+    void drain() {
+        healthcare_audit_event_record event;
+        for (;;) {
+            size_t count = 0;
+            category_counts counts;
+            while (count < max_batch_events && ring_->try_pop(event)) {
+                auto& line = lines_[count++];
+                line.clear();
+                append_json(line, event);
+                line += '\n';
+                counts.add(event.category);
+            }
+            if (count == 0) {
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                write_lines(count, counts);
+            }
+            {
+                std::lock_guard<std::mutex> lock(wake_mutex_);
+                written_ += count;
+            }
+            flushed_.notify_all();
+
+            if (count < max_batch_events) {
+                return;
+            }
+        }
+    }
+
+    // File, statistics and line buffers (writer thread or sync callers)
+    mutable std::mutex mutex_;
+    audit_file file_;
     statistics stats_{};
+    std::vector<std::string> lines_;
+
+    // log() calls in progress, waited on by stop()
+    std::atomic<size_t> producers_{0};
+
+    // Async mode
+    std::unique_ptr<internal::mpsc_ring<healthcare_audit_event_record>> ring_;
+    size_t wake_threshold_ = 1;
+    std::atomic<size_t> queue_full_waits_{0};
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+    std::condition_variable flushed_;
+    bool stopping_ = false;
+    bool flush_requested_ = false;
+    size_t written_ = 0;
+    std::thread writer_;
 };
 
 // =============================================================================
@@ -420,7 +877,7 @@ healthcare_audit_logger::event_builder::property(std::string_view key, std::stri
 }
 
 void healthcare_audit_logger::event_builder::commit() {
-    logger_.log(event_);
+    logger_.log(std::move(event_));
 }
 
 // =============================================================================
@@ -431,7 +888,9 @@ healthcare_audit_logger::healthcare_audit_logger(const healthcare_audit_config&
     : pimpl_(std::make_unique<impl>(config)) {}
 
 healthcare_audit_logger::~healthcare_audit_logger() {
-    stop();
+    if (pimpl_) {
+        stop();
+    }
 }
 
 healthcare_audit_logger::healthcare_audit_logger(healthcare_audit_logger&&) noexcept = default;
@@ -465,6 +924,10 @@ void healthcare_audit_logger::log(const healthcare_audit_event_record& event) {
     pimpl_->log(event);
 }
 
+void healthcare_audit_logger::log(healthcare_audit_event_record&& event) {
+    pimpl_->log(std::move(event));
+}
+
 healthcare_audit_logger::event_builder
 healthcare_audit_logger::log_event(healthcare_audit_category category,
                                    healthcare_audit_event type) {
@@ -723,7 +1186,7 @@ bool healthcare_audit_logger::verify_integrity(
 // =============================================================================
 
 healthcare_audit_logger::statistics healthcare_audit_logger::get_statistics() const {
-    return pimpl_->stats_;
+    return pimpl_->snapshot_statistics();
 }
 
 const healthcare_audit_config& healthcare_audit_logger::config() const noexcept {
@@ -2,41 +2,377 @@
  * @file log_sanitizer.cpp
  * @brief Implementation of healthcare-specific log sanitization
  *
+ * Redaction is a single left-to-right pass over the input. Each line that
+ * starts with a configured HL7 segment ID is walked field by field and the
+ * PHI fields of that segment are masked by position. Everything else goes
+ * through the free-text recognizers, which are dispatched on the byte at the
+ * current position from a table built once per configuration. Each
+ * recognizer consumes a bounded, deterministic shape (no backtracking), so
+ * the pass is linear in the input. Only user-added custom patterns still use
+ * std::regex.
+ *
  * @see include/pacs/bridge/security/log_sanitizer.h
  * @see https://github.com/kcenon/pacs_bridge/issues/43
  */
 
 #include "pacs/bridge/security/log_sanitizer.h"
 
-#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <optional>
 #include <regex>
 #include <sstream>
 
 namespace pacs::bridge::security {
 
-// =============================================================================
-// PHI Detection Patterns
-// =============================================================================
-
 namespace {
 
 // HL7 segment delimiter
 constexpr char HL7_SEGMENT_DELIMITER = '\r';
 constexpr char HL7_FIELD_DELIMITER = '|';
 
-// Field positions in PID segment that contain PHI
-// PID-3: Patient ID, PID-5: Patient Name, PID-7: DOB, PID-11: Address,
-// PID-13: Phone, PID-19: SSN
-const std::vector<int> PID_PHI_FIELDS = {3, 5, 7, 11, 13, 14, 18, 19};
+// =============================================================================
+// Character Classes
+// =============================================================================
+
+enum : uint8_t {
+    cls_digit = 1 << 0,
+    cls_alpha = 1 << 1,
+    cls_upper = 1 << 2,
+    cls_space = 1 << 3,         // \s
+    cls_word = 1 << 4,          // \w: [A-Za-z0-9_]
+    cls_name = 1 << 5,          // [A-Za-z'-]
+    cls_email_local = 1 << 6,   // [A-Za-z0-9._%+-]
+    cls_email_domain = 1 << 7   // [A-Za-z0-9.-]
+};
+
+constexpr std::array<uint8_t, 256> make_char_classes() {
+    std::array<uint8_t, 256> table{};
+    for (int c = 0; c < 256; ++c) {
+        const bool digit = c >= '0' && c <= '9';
+        const bool upper = c >= 'A' && c <= 'Z';
+        const bool alpha = upper || (c >= 'a' && c <= 'z');
+        uint8_t bits = 0;
+        if (digit) bits |= cls_digit | cls_word | cls_email_local | cls_email_domain;
+        if (alpha) bits |= cls_alpha | cls_word | cls_name | cls_email_local | cls_email_domain;
+        if (upper) bits |= cls_upper;
+        if (c == ' ' || (c >= '\t' && c <= '\r')) bits |= cls_space;
+        if (c == '_') bits |= cls_word | cls_email_local;
+        if (c == '\'') bits |= cls_name;
+        if (c == '-') bits |= cls_name | cls_email_local | cls_email_domain;
+        if (c == '.') bits |= cls_email_local | cls_email_domain;
+        if (c == '%' || c == '+') bits |= cls_email_local;
+        table[static_cast<size_t>(c)] = bits;
+    }
+    return table;
+}
+
+constexpr auto char_classes = make_char_classes();
+
+/** Whether text[i] exists and belongs to any of classes */
+bool has(std::string_view text, size_t i, uint8_t classes) noexcept {
+    return i < text.size() &&
+           (char_classes[static_cast<unsigned char>(text[i])] & classes) != 0;
+}
+
+/** Length of the run of classes characters starting at i */
+size_t run(std::string_view text, size_t i, uint8_t classes) noexcept {
+    size_t k = i;
+    while (has(text, k, classes)) {
+        ++k;
+    }
+    return k - i;
+}
+
+/** \b before a word character at i */
+bool word_start(std::string_view text, size_t i) noexcept {
+    return i == 0 || !has(text, i - 1, cls_word);
+}
+
+/** \b after a word character ending at i */
+bool word_end(std::string_view text, size_t i) noexcept {
+    return !has(text, i, cls_word);
+}
+
+bool take_digits(std::string_view text, size_t& k, size_t count) noexcept {
+    for (size_t n = 0; n < count; ++n, ++k) {
+        if (!has(text, k, cls_digit)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Skip one optional [-\s] (or [-.\s] when dot) separator */
+void skip_separator(std::string_view text, size_t& k, bool dot) noexcept {
+    if (has(text, k, cls_space) ||
+        (k < text.size() && (text[k] == '-' || (dot && text[k] == '.')))) {
+        ++k;
+    }
+}
+
+bool starts_with_icase(std::string_view text, size_t i,
+                       std::string_view lower) noexcept {
+    if (text.size() - i < lower.size()) {
+        return false;
+    }
+    for (size_t n = 0; n < lower.size(); ++n) {
+        char c = text[i + n];
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+        if (c != lower[n]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// =============================================================================
+// Free-Text Recognizers
+// =============================================================================
+
+/**
+ * @brief One PHI occurrence
+ *
+ * [begin, end) is replaced. [value_begin, end) is the masked value; for a
+ * keyed match (MRN: X) the first key_length bytes are kept as "key=".
+ */
+struct phi_span {
+    size_t begin = 0;
+    size_t value_begin = 0;
+    size_t end = 0;
+    size_t key_length = 0;
+    phi_field_type type = phi_field_type::custom;
+    std::string_view segment;
+    int field_number = 0;
+};
+
+phi_span value_span(size_t begin, size_t end, phi_field_type type) {
+    phi_span span;
+    span.begin = begin;
+    span.value_begin = begin;
+    span.end = end;
+    span.type = type;
+    return span;
+}
+
+// \b(MRN|PatientID|Patient ID)[\s:=]*([A-Z0-9]{4,12})\b, case-insensitive
+bool match_mrn(std::string_view text, size_t i, phi_span& span) {
+    static constexpr std::string_view keywords[] = {"patient id", "patientid", "mrn"};
+    for (auto keyword : keywords) {
+        if (!starts_with_icase(text, i, keyword)) {
+            continue;
+        }
+        size_t k = i + keyword.size();
+        while (has(text, k, cls_space) || (k < text.size() && (text[k] == ':' || text[k] == '='))) {
+            ++k;
+        }
+        size_t id = run(text, k, cls_digit | cls_alpha);
+        if (id < 4 || id > 12 || !word_end(text, k + id)) {
+            return false;
+        }
+        span = value_span(i, k + id, phi_field_type::patient_id);
+        span.value_begin = k;
+        span.key_length = keyword.size();
+        return true;
+    }
+    return false;
+}
+
+// |Last^First| or |Last^First^ ; the span covers the name only
+bool match_name(std::string_view text, size_t i, phi_span& span) {
+    size_t k = i + 1;
+    for (int part = 0; part < 2; ++part) {
+        if (!has(text, k, cls_upper)) {
+            return false;
+        }
+        size_t rest = run(text, k + 1, cls_name);
+        if (rest == 0) {
+            return false;
+        }
+        k += 1 + rest;
+        if (k >= text.size() || (part == 0 && text[k] != '^')) {
+            return false;
+        }
+        if (part == 0) {
+            ++k;
+        }
+    }
+    if (text[k] != '|' && text[k] != '^') {
+        return false;
+    }
+    span = value_span(i + 1, k, phi_field_type::patient_name);
+    return true;
+}
+
+// \b\d{3}[-\s]?\d{2}[-\s]?\d{4}\b
+bool match_ssn(std::string_view text, size_t i, phi_span& span) {
+    size_t k = i;
+    if (!take_digits(text, k, 3)) return false;
+    skip_separator(text, k, false);
+    if (!take_digits(text, k, 2)) return false;
+    skip_separator(text, k, false);
+    if (!take_digits(text, k, 4) || !word_end(text, k)) return false;
+    span = value_span(i, k, phi_field_type::ssn);
+    return true;
+}
+
+// \(?\d{3}\)?[-.\s]?\d{3}[-.\s]?\d{4}\b
+bool match_phone_number(std::string_view text, size_t k, size_t& end) {
+    if (k < text.size() && text[k] == '(') ++k;
+    if (!take_digits(text, k, 3)) return false;
+    if (k < text.size() && text[k] == ')') ++k;
+    skip_separator(text, k, true);
+    if (!take_digits(text, k, 3)) return false;
+    skip_separator(text, k, true);
+    if (!take_digits(text, k, 4) || !word_end(text, k)) return false;
+    end = k;
+    return true;
+}
+
+// (\+?1[-.\s]?)? followed by a ten-digit number
+bool match_phone(std::string_view text, size_t i, phi_span& span) {
+    size_t k = text[i] == '+' ? i + 1 : i;
+    size_t end = 0;
+    if (k < text.size() && text[k] == '1') {
+        size_t number = k + 1;
+        skip_separator(text, number, true);
+        if (match_phone_number(text, number, end)) {
+            span = value_span(i, end, phi_field_type::phone_number);
+            return true;
+        }
+    }
+    if (text[i] != '+' && match_phone_number(text, i, end)) {
+        span = value_span(i, end, phi_field_type::phone_number);
+        return true;
+    }
+    return false;
+}
 
-// MRN pattern: digits, possibly with prefixes
-const std::regex MRN_PATTERN(R"(\b(MRN|mrn|PatientID)[\s:=]*([A-Z0-9]{4,12})\b)");
+// \b(19|20)\d{6}\b
+bool match_dob(std::string_view text, size_t i, phi_span& span) {
+    size_t k = i;
+    if (!(text.substr(i, 2) == "19" || text.substr(i, 2) == "20") ||
+        !take_digits(text, k, 8) || !word_end(text, k)) {
+        return false;
+    }
+    span = value_span(i, k, phi_field_type::date_of_birth);
+    return true;
+}
 
-// Patient name pattern (Last, First or Last^First format)
-const std::regex NAME_PATTERN(R"(\b([A-Z][a-z]+)\s*[\^,]\s*([A-Z][a-z]+)\b)");
+// \b\d+\s+[A-Za-z]{2,}\s+(St|Street|Ave|Avenue|Rd|Road|Blvd|Dr|Drive|Ln|Lane)\b
+bool match_address(std::string_view text, size_t i, phi_span& span) {
+    static constexpr std::string_view suffixes[] = {
+        "st", "street", "ave", "avenue", "rd", "road",
+        "blvd", "dr", "drive", "ln", "lane"};
+    size_t k = i + run(text, i, cls_digit);
+    size_t gap = run(text, k, cls_space);
+    if (gap == 0) return false;
+    k += gap;
+    size_t street = run(text, k, cls_alpha);
+    if (street < 2) return false;
+    k += street;
+    gap = run(text, k, cls_space);
+    if (gap == 0) return false;
+    k += gap;
+    size_t suffix = run(text, k, cls_word);
+    for (auto candidate : suffixes) {
+        if (suffix == candidate.size() && starts_with_icase(text, k, candidate)) {
+            span = value_span(i, k + suffix, phi_field_type::address);
+            return true;
+        }
+    }
+    return false;
+}
 
-// DOB pattern (YYYYMMDD or YYYY-MM-DD or MM/DD/YYYY)
-const std::regex DOB_PATTERN(R"(\b(19|20)\d{2}[-/]?\d{2}[-/]?\d{2}\b)");
+// [A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Za-z]{2,}\b, anchored on the '@' at
+// at; the local part is found by looking back, never before floor
+bool match_email(std::string_view text, size_t at, size_t floor, phi_span& span) {
+    size_t local = at;
+    while (local > floor && has(text, local - 1, cls_email_local)) {
+        --local;
+    }
+    // Leftmost \b in the local part
+    while (local < at && has(text, local, cls_word) ==
+                             (local > 0 && has(text, local - 1, cls_word))) {
+        ++local;
+    }
+    if (local == at) {
+        return false;
+    }
+
+    // Longest domain: the last '.' followed by 2+ letters and a \b
+    size_t domain_end = at + 1 + run(text, at + 1, cls_email_domain);
+    for (size_t dot = domain_end; dot-- > at + 2;) {
+        if (text[dot] != '.') {
+            continue;
+        }
+        size_t tld = run(text, dot + 1, cls_alpha);
+        if (tld >= 2 && word_end(text, dot + 1 + tld)) {
+            span = value_span(local, dot + 1 + tld, phi_field_type::email);
+            return true;
+        }
+    }
+    return false;
+}
+
+// =============================================================================
+// HL7 Field Positions
+// =============================================================================
+
+struct phi_field {
+    std::string_view segment;
+    int field;
+    phi_field_type type;
+};
+
+// PHI fields by position (HL7 v2.5)
+constexpr phi_field BUILTIN_PHI_FIELDS[] = {
+    {"PID", 2, phi_field_type::patient_id},
+    {"PID", 3, phi_field_type::patient_id},
+    {"PID", 4, phi_field_type::patient_id},
+    {"PID", 5, phi_field_type::patient_name},
+    {"PID", 6, phi_field_type::patient_name},
+    {"PID", 7, phi_field_type::date_of_birth},
+    {"PID", 9, phi_field_type::patient_name},
+    {"PID", 11, phi_field_type::address},
+    {"PID", 13, phi_field_type::phone_number},
+    {"PID", 14, phi_field_type::phone_number},
+    {"PID", 18, phi_field_type::account_number},
+    {"PID", 19, phi_field_type::ssn},
+    {"PID", 20, phi_field_type::patient_id},
+    {"PID", 21, phi_field_type::patient_id},
+    {"NK1", 2, phi_field_type::patient_name},
+    {"NK1", 4, phi_field_type::address},
+    {"NK1", 5, phi_field_type::phone_number},
+    {"NK1", 6, phi_field_type::phone_number},
+    {"NK1", 30, phi_field_type::patient_name},
+    {"NK1", 31, phi_field_type::phone_number},
+    {"NK1", 32, phi_field_type::address},
+    {"NK1", 33, phi_field_type::patient_id},
+    {"NK1", 37, phi_field_type::ssn},
+    {"GT1", 2, phi_field_type::account_number},
+    {"GT1", 3, phi_field_type::patient_name},
+    {"GT1", 4, phi_field_type::patient_name},
+    {"GT1", 5, phi_field_type::address},
+    {"GT1", 6, phi_field_type::phone_number},
+    {"GT1", 7, phi_field_type::phone_number},
+    {"GT1", 8, phi_field_type::date_of_birth},
+    {"GT1", 12, phi_field_type::ssn},
+    {"IN1", 16, phi_field_type::patient_name},
+    {"IN1", 18, phi_field_type::date_of_birth},
+    {"IN1", 19, phi_field_type::address},
+    {"IN1", 36, phi_field_type::insurance_id},
+    {"IN1", 49, phi_field_type::insurance_id},
+    {"IN2", 1, phi_field_type::patient_id},
+    {"IN2", 2, phi_field_type::ssn},
+    {"IN2", 6, phi_field_type::insurance_id},
+    {"IN2", 8, phi_field_type::insurance_id},
+};
+
+// MSH-10: Message Control ID
+constexpr int MSH_CONTROL_ID_FIELD = 10;
 
 }  // namespace
 
@@ -48,57 +384,299 @@ class healthcare_log_sanitizer::impl {
 public:
     explicit impl(const healthcare_sanitization_config& config)
         : config_(config) {
-        initialize_patterns();
+        compile();
     }
 
-    void initialize_patterns() {
-        // Add standard healthcare patterns
-        custom_patterns_.clear();
+    /**
+     * @brief Build the recognizer dispatch table and segment rules
+     *
+     * Only recognizers and fields whose type is in fields_to_sanitize are
+     * compiled in, so disabled types cost nothing at scan time.
+     */
+    void compile() {
+        auto enabled = [this](phi_field_type type) {
+            return config_.fields_to_sanitize.count(type) > 0;
+        };
+
+        starts_.fill(0);
+        if (enabled(phi_field_type::patient_id)) {
+            for (char c : {'M', 'm', 'P', 'p'}) {
+                starts_[static_cast<unsigned char>(c)] |= rec_mrn;
+            }
+        }
+        if (enabled(phi_field_type::patient_name)) {
+            starts_['|'] |= rec_name;
+        }
+        if (enabled(phi_field_type::email)) {
+            starts_['@'] |= rec_email;
+        }
+        if (enabled(phi_field_type::phone_number)) {
+            starts_['+'] |= rec_phone;
+            starts_['('] |= rec_phone;
+        }
+        uint8_t digit_starts = 0;
+        if (enabled(phi_field_type::ssn)) digit_starts |= rec_ssn;
+        if (enabled(phi_field_type::phone_number)) digit_starts |= rec_phone;
+        if (enabled(phi_field_type::date_of_birth)) digit_starts |= rec_dob;
+        if (enabled(phi_field_type::address)) digit_starts |= rec_address;
+        for (unsigned char c = '0'; c <= '9'; ++c) {
+            starts_[c] |= digit_starts;
+        }
 
-        // MRN pattern
-        custom_patterns_.emplace_back(
-            std::regex(R"(\b(MRN|PatientID|Patient ID)[\s:=]*([A-Z0-9]{4,12})\b)",
-                       std::regex::icase),
-            "$1=[PATIENT_ID]");
+        rules_.clear();
+        for (const auto& id : config_.phi_segments) {
+            if (id.size() != 3) {
+                continue;
+            }
+            segment_rule rule;
+            rule.id = id;
+            rule.mask_all = true;
+            for (const auto& field : BUILTIN_PHI_FIELDS) {
+                if (field.segment != id) {
+                    continue;
+                }
+                rule.mask_all = false;
+                if (enabled(field.type)) {
+                    rule.fields[static_cast<size_t>(field.field)] =
+                        static_cast<int8_t>(field.type);
+                }
+            }
+            rules_.push_back(rule);
+        }
+        if (config_.sanitize_control_id && find_rule("MSH") == nullptr) {
+            segment_rule rule;
+            rule.id = "MSH";
+            rule.fields[MSH_CONTROL_ID_FIELD] = static_cast<int8_t>(phi_field_type::custom);
+            rules_.push_back(rule);
+        }
+    }
 
-        // Patient name pattern (Last^First HL7 format)
-        custom_patterns_.emplace_back(
-            std::regex(R"((\|)([A-Z][A-Za-z'-]+)\^([A-Z][A-Za-z'-]+)(\||\^))"),
-            "$1[PATIENT_NAME]$4");
+    /**
+     * @brief Report every PHI span in text, in order, to on_span
+     *
+     * Lines starting with a configured segment ID are masked by field
+     * position. When free_text is set, all other text (including unmasked
+     * fields of those segments) goes through the free-text recognizers.
+     * on_span returns false to stop the scan.
+     */
+    template <typename OnSpan>
+    void scan(std::string_view text, bool free_text, OnSpan&& on_span) const {
+        char separator = HL7_FIELD_DELIMITER;
+        size_t line = 0;
+        while (line < text.size()) {
+            size_t eol = line;
+            while (eol < text.size() && text[eol] != HL7_SEGMENT_DELIMITER &&
+                   text[eol] != '\n') {
+                ++eol;
+            }
+            std::string_view line_text = text.substr(0, eol);
+
+            const segment_rule* rule = nullptr;
+            if (eol - line > 3) {
+                std::string_view id = text.substr(line, 3);
+                if (id == "MSH") {
+                    separator = text[line + 3];
+                }
+                if (text[line + 3] == separator) {
+                    rule = find_rule(id);
+                }
+            }
 
-        // SSN pattern
-        custom_patterns_.emplace_back(
-            std::regex(R"(\b\d{3}[-\s]?\d{2}[-\s]?\d{4}\b)"),
-            "[SSN]");
+            bool more = true;
+            if (rule != nullptr) {
+                more = scan_segment(line_text, line, *rule, separator, free_text, on_span);
+            } else if (free_text) {
+                more = scan_text(line_text, line, on_span);
+            }
+            if (!more) {
+                return;
+            }
+            line = eol + 1;
+        }
+    }
 
-        // Phone number pattern
-        custom_patterns_.emplace_back(
-            std::regex(R"(\b(\+?1[-.\s]?)?\(?\d{3}\)?[-.\s]?\d{3}[-.\s]?\d{4}\b)"),
-            "[PHONE]");
+    /**
+     * @brief Append text to out with every PHI span masked
+     */
+    void redact(std::string_view text, bool free_text, std::string& out) const {
+        size_t copied = 0;
+        scan(text, free_text, [&](const phi_span& span) {
+            out.append(text.substr(copied, span.begin - copied));
+            if (span.key_length > 0) {
+                out.append(text.substr(span.begin, span.key_length));
+                out += '=';
+            }
+            append_mask(out, text.substr(span.value_begin, span.end - span.value_begin),
+                        span.type);
+            copied = span.end;
+            return true;
+        });
+        out.append(text.substr(copied));
+    }
 
-        // Email pattern
-        custom_patterns_.emplace_back(
-            std::regex(R"(\b[A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Z|a-z]{2,}\b)"),
-            "[EMAIL]");
+    void append_mask(std::string& out, std::string_view value,
+                     phi_field_type type) const {
+        switch (config_.style) {
+            case masking_style::asterisks:
+                out.append(value.size(), '*');
+                break;
+
+            case masking_style::x_characters:
+                out.append(value.size(), 'X');
+                break;
+
+            case masking_style::partial: {
+                size_t prefix = config_.partial_show_prefix;
+                size_t suffix = config_.partial_show_suffix;
+                if (value.size() <= prefix + suffix) {
+                    out.append(value.size(), '*');
+                } else {
+                    out.append(value.substr(0, prefix));
+                    out.append(value.size() - prefix - suffix, '*');
+                    out.append(value.substr(value.size() - suffix));
+                }
+                break;
+            }
 
-        // DOB in HL7 format (YYYYMMDD)
-        custom_patterns_.emplace_back(
-            std::regex(R"(\b(19|20)\d{6}\b)"),
-            "[DOB]");
+            case masking_style::remove:
+                break;
 
-        // Address-like patterns (number + street name)
-        custom_patterns_.emplace_back(
-            std::regex(R"(\b\d+\s+[A-Z][a-z]+\s+(St|Street|Ave|Avenue|Rd|Road|Blvd|Dr|Drive|Ln|Lane)\b)",
-                       std::regex::icase),
-            "[ADDRESS]");
+            case masking_style::type_label:
+            default:
+                out += '[';
+                out += to_string(type);
+                out += ']';
+                break;
+        }
     }
 
     healthcare_sanitization_config config_;
     std::vector<std::pair<std::regex, std::string>> custom_patterns_;
-};
 
-// Forward declaration
-std::string sanitize_hl7_segment(std::string_view segment, const std::string& segment_type);
+private:
+    enum recognizer : uint8_t {
+        rec_mrn = 1 << 0,
+        rec_name = 1 << 1,
+        rec_email = 1 << 2,
+        rec_ssn = 1 << 3,
+        rec_phone = 1 << 4,
+        rec_dob = 1 << 5,
+        rec_address = 1 << 6
+    };
+
+    static constexpr size_t max_rule_field = 63;
+
+    struct segment_rule {
+        std::string id;
+
+        /** Configured segment without a built-in field map: mask every field */
+        bool mask_all = false;
+
+        /** phi_field_type by field number, -1 where the field is kept */
+        std::array<int8_t, max_rule_field + 1> fields = make_unmasked();
+
+        static constexpr std::array<int8_t, max_rule_field + 1> make_unmasked() {
+            std::array<int8_t, max_rule_field + 1> unmasked{};
+            unmasked.fill(-1);
+            return unmasked;
+        }
+
+        [[nodiscard]] std::optional<phi_field_type> field_type(int field) const {
+            if (mask_all) {
+                return phi_field_type::custom;
+            }
+            if (field < 0 || static_cast<size_t>(field) > max_rule_field ||
+                fields[static_cast<size_t>(field)] < 0) {
+                return std::nullopt;
+            }
+            return static_cast<phi_field_type>(fields[static_cast<size_t>(field)]);
+        }
+    };
+
+    [[nodiscard]] const segment_rule* find_rule(std::string_view id) const {
+        for (const auto& rule : rules_) {
+            if (rule.id == id) {
+                return &rule;
+            }
+        }
+        return nullptr;
+    }
+
+    /** Mask the configured fields of the segment starting at line */
+    template <typename OnSpan>
+    bool scan_segment(std::string_view text, size_t line, const segment_rule& rule,
+                      char separator, bool free_text, OnSpan& on_span) const {
+        std::string_view id = text.substr(line, 3);
+        // MSH-1 is the field separator itself
+        int field = id == "MSH" ? 1 : 0;
+        size_t k = line + 3;
+        while (k < text.size()) {
+            ++field;
+            size_t start = k + 1;
+            size_t end = text.find(separator, start);
+            if (end == std::string_view::npos) {
+                end = text.size();
+            }
+            if (end > start) {
+                if (auto type = rule.field_type(field)) {
+                    phi_span span = value_span(start, end, *type);
+                    span.segment = id;
+                    span.field_number = field;
+                    if (!on_span(span)) {
+                        return false;
+                    }
+                } else if (free_text && !scan_text(text.substr(0, end), start, on_span)) {
+                    return false;
+                }
+            }
+            k = end;
+        }
+        return true;
+    }
+
+    /** Run the free-text recognizers over text[from, end) */
+    template <typename OnSpan>
+    bool scan_text(std::string_view text, size_t from, OnSpan& on_span) const {
+        size_t floor = from;
+        size_t i = from;
+        while (i < text.size()) {
+            uint8_t candidates = starts_[static_cast<unsigned char>(text[i])];
+            phi_span span;
+            if (candidates != 0 && match_at(text, i, floor, candidates, span)) {
+                if (!on_span(span)) {
+                    return false;
+                }
+                i = floor = span.end;
+            } else {
+                ++i;
+            }
+        }
+        return true;
+    }
+
+    static bool match_at(std::string_view text, size_t i, size_t floor,
+                         uint8_t candidates, phi_span& span) {
+        if (candidates & rec_name) {
+            return match_name(text, i, span);
+        }
+        if (candidates & rec_email) {
+            return match_email(text, i, floor, span);
+        }
+        if (!word_start(text, i)) {
+            return false;
+        }
+        if (candidates & rec_mrn) {
+            return match_mrn(text, i, span);
+        }
+        return ((candidates & rec_ssn) && match_ssn(text, i, span)) ||
+               ((candidates & rec_phone) && match_phone(text, i, span)) ||
+               ((candidates & rec_dob) && match_dob(text, i, span)) ||
+               ((candidates & rec_address) && match_address(text, i, span));
+    }
+
+    std::array<uint8_t, 256> starts_{};
+    std::vector<segment_rule> rules_;
+};
 
 // =============================================================================
 // Constructor / Destructor
@@ -118,58 +696,47 @@ healthcare_log_sanitizer& healthcare_log_sanitizer::operator=(healthcare_log_san
 // =============================================================================
 
 std::string healthcare_log_sanitizer::sanitize(std::string_view content) const {
+    std::string result;
+    result.reserve(content.size());
+    sanitize_to(content, result);
+    return result;
+}
+
+void healthcare_log_sanitizer::sanitize_to(std::string_view content,
+                                           std::string& out) const {
     if (!pimpl_->config_.enabled || content.empty()) {
-        return std::string(content);
+        out.append(content);
+        return;
     }
 
-    std::string result(content);
+    if (pimpl_->custom_patterns_.empty()) {
+        pimpl_->redact(content, true, out);
+        return;
+    }
 
-    // Apply all custom patterns
+    std::string result;
+    result.reserve(content.size());
+    pimpl_->redact(content, true, result);
     for (const auto& [pattern, replacement] : pimpl_->custom_patterns_) {
         result = std::regex_replace(result, pattern, replacement);
     }
-
-    return result;
+    out.append(result);
 }
 
 std::string healthcare_log_sanitizer::sanitize_hl7(std::string_view hl7_message) const {
-    if (!pimpl_->config_.enabled || hl7_message.empty()) {
-        return std::string(hl7_message);
-    }
-
     std::string result;
     result.reserve(hl7_message.size());
+    sanitize_hl7_to(hl7_message, result);
+    return result;
+}
 
-    // Process each segment
-    size_t start = 0;
-    size_t pos = 0;
-
-    while (pos <= hl7_message.size()) {
-        if (pos == hl7_message.size() || hl7_message[pos] == HL7_SEGMENT_DELIMITER) {
-            std::string_view segment = hl7_message.substr(start, pos - start);
-
-            // Check if this is a PHI segment
-            std::string segment_type;
-            if (segment.size() >= 3) {
-                segment_type = std::string(segment.substr(0, 3));
-            }
-
-            if (pimpl_->config_.phi_segments.count(segment_type) > 0) {
-                // Sanitize the segment field by field
-                result += sanitize_hl7_segment(segment, segment_type);
-            } else {
-                result += segment;
-            }
-
-            if (pos < hl7_message.size()) {
-                result += HL7_SEGMENT_DELIMITER;
-            }
-            start = pos + 1;
-        }
-        ++pos;
+void healthcare_log_sanitizer::sanitize_hl7_to(std::string_view hl7_message,
+                                               std::string& out) const {
+    if (!pimpl_->config_.enabled || hl7_message.empty()) {
+        out.append(hl7_message);
+        return;
     }
-
-    return result;
+    pimpl_->redact(hl7_message, false, out);
 }
 
 std::pair<std::string, std::vector<phi_detection>>
@@ -188,6 +755,15 @@ healthcare_log_sanitizer::sanitize_with_detections(std::string_view content) con
 // =============================================================================
 
 bool healthcare_log_sanitizer::contains_phi(std::string_view content) const {
+    bool found = false;
+    pimpl_->scan(content, true, [&found](const phi_span&) {
+        found = true;
+        return false;
+    });
+    if (found) {
+        return true;
+    }
+
     for (const auto& [pattern, _] : pimpl_->custom_patterns_) {
         if (std::regex_search(content.begin(), content.end(), pattern)) {
             return true;
@@ -200,31 +776,31 @@ std::vector<phi_detection>
 healthcare_log_sanitizer::detect_phi(std::string_view content) const {
     std::vector<phi_detection> detections;
 
-    // Detect MRN patterns
-    std::smatch match;
-    std::string content_str(content);
-    auto it = content_str.cbegin();
-
-    while (std::regex_search(it, content_str.cend(), match, MRN_PATTERN)) {
+    pimpl_->scan(content, true, [&detections](const phi_span& span) {
         phi_detection detection;
-        detection.type = phi_field_type::patient_id;
-        detection.position = static_cast<size_t>(match.position() + (it - content_str.cbegin()));
-        detection.length = match.length();
-        detection.context = "[MRN detected]";
-        detections.push_back(detection);
-        it = match.suffix().first;
-    }
+        detection.type = span.type;
+        detection.position = span.value_begin;
+        detection.length = span.end - span.value_begin;
+        if (!span.segment.empty()) {
+            detection.segment = std::string(span.segment);
+            detection.field_number = span.field_number;
+        }
+        detection.context = std::string("[") + to_string(span.type) + " detected]";
+        detections.push_back(std::move(detection));
+        return true;
+    });
 
-    // Detect name patterns
-    it = content_str.cbegin();
-    while (std::regex_search(it, content_str.cend(), match, NAME_PATTERN)) {
-        phi_detection detection;
-        detection.type = phi_field_type::patient_name;
-        detection.position = static_cast<size_t>(match.position() + (it - content_str.cbegin()));
-        detection.length = match.length();
-        detection.context = "[Name detected]";
-        detections.push_back(detection);
-        it = match.suffix().first;
+    // Custom patterns
+    for (const auto& [pattern, _] : pimpl_->custom_patterns_) {
+        std::cregex_iterator it(content.data(), content.data() + content.size(), pattern);
+        for (; it != std::cregex_iterator(); ++it) {
+            phi_detection detection;
+            detection.type = phi_field_type::custom;
+            detection.position = static_cast<size_t>(it->position());
+            detection.length = static_cast<size_t>(it->length());
+            detection.context = "[CUSTOM detected]";
+            detections.push_back(std::move(detection));
+        }
     }
 
     return detections;
@@ -236,32 +812,9 @@ healthcare_log_sanitizer::detect_phi(std::string_view content) const {
 
 std::string healthcare_log_sanitizer::mask(std::string_view value,
                                            phi_field_type type) const {
-    switch (pimpl_->config_.style) {
-        case masking_style::asterisks:
-            return std::string(value.size(), '*');
-
-        case masking_style::type_label:
-            return make_type_label(type);
-
-        case masking_style::x_characters:
-            return std::string(value.size(), 'X');
-
-        case masking_style::partial:
-            if (value.size() <= pimpl_->config_.partial_show_prefix +
-                               pimpl_->config_.partial_show_suffix) {
-                return std::string(value.size(), '*');
-            }
-            return std::string(value.substr(0, pimpl_->config_.partial_show_prefix)) +
-                   std::string(value.size() - pimpl_->config_.partial_show_prefix -
-                               pimpl_->config_.partial_show_suffix, '*') +
-                   std::string(value.substr(value.size() - pimpl_->config_.partial_show_suffix));
-
-        case masking_style::remove:
-            return "";
-
-        default:
-            return make_type_label(type);
-    }
+    std::string result;
+    pimpl_->append_mask(result, value, type);
+    return result;
 }
 
 std::string healthcare_log_sanitizer::make_type_label(phi_field_type type) {
@@ -274,7 +827,7 @@ std::string healthcare_log_sanitizer::make_type_label(phi_field_type type) {
 
 void healthcare_log_sanitizer::set_config(const healthcare_sanitization_config& config) {
     pimpl_->config_ = config;
-    pimpl_->initialize_patterns();
+    pimpl_->compile();
 }
 
 const healthcare_sanitization_config& healthcare_log_sanitizer::config() const noexcept {
@@ -296,55 +849,6 @@ void healthcare_log_sanitizer::add_custom_pattern(std::string_view pattern,
         std::string(replacement));
 }
 
-// =============================================================================
-// Private Helper Methods
-// =============================================================================
-
-// Note: This function is in pacs::bridge::security namespace to match forward declaration
-std::string sanitize_hl7_segment(std::string_view segment, const std::string& segment_type) {
-    std::string result;
-    result.reserve(segment.size());
-
-    // Split segment into fields
-    std::vector<std::string> fields;
-    size_t start = 0;
-    size_t pos = 0;
-
-    while (pos <= segment.size()) {
-        if (pos == segment.size() || segment[pos] == HL7_FIELD_DELIMITER) {
-            fields.emplace_back(segment.substr(start, pos - start));
-            start = pos + 1;
-        }
-        ++pos;
-    }
-
-    // Determine which fields to mask based on segment type
-    std::vector<int> phi_fields;
-    if (segment_type == "PID") {
-        phi_fields = PID_PHI_FIELDS;
-    }
-
-    // Rebuild segment with masked fields
-    for (size_t i = 0; i < fields.size(); ++i) {
-        if (i > 0) {
-            result += HL7_FIELD_DELIMITER;
-        }
-
-        // Field index is 1-based in HL7, but fields[0] is segment name
-        int field_num = static_cast<int>(i);
-        if (std::find(phi_fields.begin(), phi_fields.end(), field_num) != phi_fields.end()) {
-            // Mask this field
-            if (!fields[i].empty()) {
-                result += "[REDACTED]";
-            }
-        } else {
-            result += fields[i];
-        }
-    }
-
-    return result;
-}
-
 // =============================================================================
 // Utility Functions
 // =============================================================================
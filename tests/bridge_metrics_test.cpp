@@ -10,12 +10,17 @@
  * - Connection metrics recording
  * - Prometheus format export
  * - Scoped timer helper
+ * - Log-linear histogram buckets and concurrent recording counts
+ * - Pre-resolved metric handles and the label cardinality limit
+ * - Streaming exposition writer (Prometheus text, OpenMetrics, gzip)
  *
  * @see https://github.com/kcenon/pacs_bridge/issues/40
  * @see https://github.com/kcenon/pacs_bridge/issues/90
  */
 
 #include "pacs/bridge/monitoring/bridge_metrics.h"
+#include "pacs/bridge/internal/log_linear_histogram.h"
+#include "pacs/bridge/monitoring/prometheus_writer.h"
 
 #include <cassert>
 #include <chrono>
@@ -473,6 +478,344 @@ bool test_concurrent_recording() {
     return true;
 }
 
+/**
+ * Extract the value of the first sample line starting with prefix
+ */
+std::string sample_value(const std::string& output, const std::string& prefix) {
+    size_t pos = 0;
+    while ((pos = output.find(prefix, pos)) != std::string::npos) {
+        if (pos == 0 || output[pos - 1] == '\n') {
+            size_t start = pos + prefix.size();
+            return output.substr(start, output.find('\n', start) - start);
+        }
+        pos += prefix.size();
+    }
+    return {};
+}
+
+bool test_concurrent_counts_exact() {
+    auto& metrics = bridge_metrics_collector::instance();
+    metrics.set_enabled(true);
+
+    constexpr int num_threads = 4;
+    constexpr int iterations = 5000;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; i++) {
+        threads.emplace_back([&metrics]() {
+            for (int j = 0; j < iterations; j++) {
+                metrics.record_message_enqueued("exact_dest");
+                metrics.record_hl7_processing_duration(
+                    "EXACT", std::chrono::microseconds(500));
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    std::string output = metrics.get_prometheus_metrics();
+    std::string total = std::to_string(num_threads * iterations);
+    TEST_ASSERT(sample_value(output, "queue_messages_enqueued_total{destination=\"exact_dest\"} ") ==
+                    total,
+                "Sharded counter should not lose increments");
+    TEST_ASSERT(sample_value(output,
+                             "hl7_message_processing_duration_seconds_count{message_type=\"EXACT\"} ") ==
+                    total,
+                "Histogram count should not lose samples");
+    TEST_ASSERT(sample_value(output,
+                             "hl7_message_processing_duration_seconds_bucket{message_type=\"EXACT\",le=\"0.001\"} ") ==
+                    total,
+                "500us samples should fall at or below the 1ms bucket");
+    TEST_ASSERT(sample_value(output,
+                             "hl7_message_processing_duration_seconds_sum{message_type=\"EXACT\"} ") ==
+                    "10.000000",
+                "Histogram sum should be exact");
+
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Log-Linear Histogram Tests
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool test_histogram_bucket_bounds() {
+    using internal::log_linear_histogram;
+
+    // Small values get exact buckets
+    for (uint64_t v = 0; v < log_linear_histogram::sub_bucket_count; v++) {
+        TEST_ASSERT(log_linear_histogram::bucket_index(v) == v,
+                    "Values below the sub-bucket count should be exact");
+    }
+
+    // Every value lies within its bucket, and bucket width is at most 1/8
+    uint64_t previous_upper = 0;
+    for (size_t i = 1; i + 1 < log_linear_histogram::bucket_count; i++) {
+        uint64_t upper = log_linear_histogram::upper_bound(i);
+        uint64_t lower = previous_upper + 1;
+        TEST_ASSERT(upper >= lower, "Buckets should be contiguous");
+        TEST_ASSERT(log_linear_histogram::bucket_index(lower) == i &&
+                        log_linear_histogram::bucket_index(upper) == i,
+                    "Bucket bounds should map back to the bucket");
+        TEST_ASSERT(upper - lower < lower / 8 + 1,
+                    "Bucket width should be within 1/8 of its lower bound");
+        previous_upper = upper;
+    }
+
+    // Out-of-range values clamp into the last bucket
+    TEST_ASSERT(log_linear_histogram::bucket_index(UINT64_MAX) ==
+                    log_linear_histogram::bucket_count - 1,
+                "Huge values should land in the last bucket");
+
+    return true;
+}
+
+bool test_histogram_quantiles() {
+    internal::log_linear_histogram histogram;
+    for (uint64_t v = 1; v <= 100000; v++) {
+        histogram.record(v * 1000);  // 1us .. 100ms
+    }
+
+    auto snapshot = histogram.collect();
+    TEST_ASSERT(snapshot.count == 100000, "All samples should be counted");
+    TEST_ASSERT(snapshot.sum == 1000 * (100000ULL * 100001ULL / 2),
+                "Sum should be exact");
+
+    auto p50 = static_cast<double>(snapshot.quantile(0.5));
+    auto p99 = static_cast<double>(snapshot.quantile(0.99));
+    TEST_ASSERT(p50 >= 50e6 && p50 <= 50e6 * 1.125,
+                "p50 should be within one bucket of 50ms");
+    TEST_ASSERT(p99 >= 99e6 && p99 <= 99e6 * 1.125,
+                "p99 should be within one bucket of 99ms");
+
+    histogram.reset();
+    TEST_ASSERT(histogram.collect().count == 0, "Reset should clear buckets");
+
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Metric Handle Tests
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool test_metric_handles() {
+    auto& metrics = bridge_metrics_collector::instance();
+    metrics.set_enabled(true);
+
+    auto hl7 = metrics.hl7_metrics("HANDLE");
+    auto queue = metrics.queue_metrics("handle_dest");
+    TEST_ASSERT(hl7.received && hl7.sent && hl7.processing_duration,
+                "HL7 handles should resolve");
+    TEST_ASSERT(queue.depth && queue.enqueued && queue.dead_letters,
+                "Queue handles should resolve");
+
+    for (int i = 0; i < 3; i++) {
+        hl7.received.increment();
+        queue.enqueued.increment();
+    }
+    metrics.record_hl7_message_received("HANDLE");
+    hl7.processing_duration.record(std::chrono::milliseconds(2));
+    queue.depth.set(17);
+
+    // Handles are no-ops while collection is disabled
+    metrics.set_enabled(false);
+    hl7.received.increment();
+    metrics.set_enabled(true);
+
+    // A default-constructed handle is a no-op
+    counter_handle empty;
+    empty.increment();
+    TEST_ASSERT(!empty, "Default handle should be empty");
+
+    std::string output = metrics.get_prometheus_metrics();
+    TEST_ASSERT(sample_value(output, "hl7_messages_received_total{message_type=\"HANDLE\"} ") == "4",
+                "Handle and string API should share one counter");
+    TEST_ASSERT(sample_value(output, "queue_messages_enqueued_total{destination=\"handle_dest\"} ") == "3",
+                "Queue handle should count");
+    TEST_ASSERT(sample_value(output, "queue_depth{destination=\"handle_dest\"} ") == "17.000000",
+                "Gauge handle should set depth");
+    TEST_ASSERT(sample_value(output, "hl7_message_processing_duration_seconds_count{message_type=\"HANDLE\"} ") == "1",
+                "Histogram handle should record");
+
+    return true;
+}
+
+bool test_label_escaping() {
+    auto& metrics = bridge_metrics_collector::instance();
+    metrics.set_enabled(true);
+
+    metrics.record_message_enqueued("odd\"dest\\\n");
+
+    std::string output = metrics.get_prometheus_metrics();
+    TEST_ASSERT(output.find("destination=\"odd\\\"dest\\\\\\n\"") != std::string::npos,
+                "Label values should be escaped");
+
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Exposition Writer Tests
+// ═══════════════════════════════════════════════════════════════════════════
+
+size_t count_occurrences(const std::string& text, const std::string& needle) {
+    size_t count = 0;
+    for (size_t pos = text.find(needle); pos != std::string::npos;
+         pos = text.find(needle, pos + needle.size())) {
+        count++;
+    }
+    return count;
+}
+
+bool test_exposition_writer_formats() {
+    const metric_descriptor requests{"requests_total", "Total requests",
+                                     metric_type::counter};
+    const metric_descriptor latency{"latency_seconds", "Latency",
+                                    metric_type::histogram};
+
+    internal::log_linear_histogram histogram;
+    histogram.record(2'000'000);  // 2ms
+    auto snapshot = histogram.collect();
+    const double bounds[] = {0.001, 0.005};
+
+    std::string text;
+    exposition_writer prometheus(text);
+    prometheus.family(requests);
+    prometheus.counter(requests, "method=\"GET\"", 42);
+    prometheus.family(latency);
+    prometheus.histogram(latency, {}, snapshot, bounds);
+    prometheus.finish();
+
+    TEST_ASSERT(text.find("# TYPE requests_total counter\n") != std::string::npos,
+                "Prometheus text keeps the _total family name");
+    TEST_ASSERT(text.find("requests_total{method=\"GET\"} 42\n") != std::string::npos,
+                "Counter sample should be written");
+    TEST_ASSERT(text.find("latency_seconds_bucket{le=\"0.001\"} 0\n") != std::string::npos &&
+                    text.find("latency_seconds_bucket{le=\"0.005\"} 1\n") != std::string::npos &&
+                    text.find("latency_seconds_bucket{le=\"+Inf\"} 1\n") != std::string::npos,
+                "Histogram buckets should be cumulative");
+    TEST_ASSERT(text.find("latency_seconds_sum 0.002000\n") != std::string::npos,
+                "Histogram sum should be in seconds");
+    TEST_ASSERT(text.find("# EOF") == std::string::npos,
+                "Prometheus text has no EOF marker");
+
+    std::string open_metrics;
+    exposition_writer writer(open_metrics, exposition_format::openmetrics_text);
+    writer.family(requests);
+    writer.counter(requests, {}, 7);
+    writer.finish();
+
+    TEST_ASSERT(open_metrics ==
+                    "# HELP requests Total requests\n"
+                    "# TYPE requests counter\n"
+                    "requests_total 7\n"
+                    "# EOF\n",
+                "OpenMetrics drops _total from the family name only");
+
+    return true;
+}
+
+bool test_collector_streaming_output() {
+    auto& metrics = bridge_metrics_collector::instance();
+    metrics.set_enabled(true);
+    metrics.record_message_delivered("stream_a");
+    metrics.record_message_delivered("stream_b");
+
+    std::string buffer;
+    metrics.write_prometheus_metrics(buffer);
+    TEST_ASSERT(count_occurrences(buffer, "# TYPE queue_messages_delivered_total") == 1,
+                "Each family should have one TYPE line");
+    TEST_ASSERT(buffer == metrics.get_prometheus_metrics(),
+                "Streaming and string output should match");
+
+    // A reused buffer keeps its storage across scrapes
+    const char* storage = buffer.data();
+    for (int i = 0; i < 5; i++) {
+        buffer.clear();
+        metrics.write_prometheus_metrics(buffer);
+    }
+    TEST_ASSERT(buffer.data() == storage,
+                "Reused buffer should not reallocate");
+
+    std::string open_metrics;
+    metrics.write_prometheus_metrics(open_metrics,
+                                     exposition_format::openmetrics_text);
+    TEST_ASSERT(open_metrics.ends_with("# EOF\n"),
+                "OpenMetrics output should end with EOF");
+    TEST_ASSERT(open_metrics.find("# TYPE mllp_total_connections counter") !=
+                        std::string::npos &&
+                    open_metrics.find("\nmllp_total_connections_total ") !=
+                        std::string::npos,
+                "OpenMetrics counters should carry the _total suffix");
+
+    return true;
+}
+
+bool test_gzip_compression() {
+    TEST_ASSERT(accepts_gzip("gzip"), "gzip should be accepted");
+    TEST_ASSERT(accepts_gzip("deflate, GZIP;q=0.5"),
+                "gzip should match case-insensitively with weights");
+    TEST_ASSERT(accepts_gzip("*"), "Wildcard should accept gzip");
+    TEST_ASSERT(!accepts_gzip("gzip;q=0"), "q=0 should reject gzip");
+    TEST_ASSERT(!accepts_gzip("br, deflate"), "Other codings only");
+    TEST_ASSERT(!accepts_gzip(""), "Missing header should not accept gzip");
+
+    std::string text = bridge_metrics_collector::instance().get_prometheus_metrics();
+    std::string compressed;
+    bool ok = gzip_compress(text, compressed);
+    if (!gzip_available()) {
+        TEST_ASSERT(!ok && compressed.empty(),
+                    "Compression should fail cleanly without zlib");
+        return true;
+    }
+
+    TEST_ASSERT(ok, "Compression should succeed");
+    TEST_ASSERT(compressed.size() >= 2 &&
+                    static_cast<unsigned char>(compressed[0]) == 0x1f &&
+                    static_cast<unsigned char>(compressed[1]) == 0x8b,
+                "Output should carry the gzip magic bytes");
+    TEST_ASSERT(compressed.size() < text.size() / 2,
+                "Exposition text should compress well");
+
+    return true;
+}
+
+/**
+ * Runs last: once a metric folds a label set into "other", unseen label
+ * values of that metric keep going there.
+ */
+bool test_cardinality_limit() {
+    auto& metrics = bridge_metrics_collector::instance();
+    metrics.set_enabled(true);
+
+    size_t original_limit = metrics.cardinality_limit();
+    size_t base = metrics.label_set_count();
+    metrics.set_cardinality_limit(base + 3);
+
+    for (int i = 0; i < 50; i++) {
+        metrics.record_dead_letter("spam_" + std::to_string(i));
+    }
+
+    TEST_ASSERT(metrics.label_set_count() == base + 3,
+                "Label sets should stop at the limit");
+
+    std::string output = metrics.get_prometheus_metrics();
+    TEST_ASSERT(output.find("destination=\"spam_2\"") != std::string::npos,
+                "Label sets under the limit should be exported");
+    TEST_ASSERT(output.find("destination=\"spam_3\"") == std::string::npos,
+                "Label sets over the limit should not be exported");
+    TEST_ASSERT(sample_value(output, "queue_dead_letters_total{destination=\"other\"} ") == "47",
+                "Overflowing label sets should be counted under other");
+
+    // Existing label sets keep their own cells
+    metrics.record_dead_letter("spam_0");
+    output = metrics.get_prometheus_metrics();
+    TEST_ASSERT(sample_value(output, "queue_dead_letters_total{destination=\"spam_0\"} ") == "2",
+                "Registered label sets should still be counted");
+
+    metrics.set_cardinality_limit(original_limit);
+    return true;
+}
+
 }  // namespace pacs::bridge::monitoring::test
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -534,6 +877,24 @@ int main() {
     // Thread safety tests
     std::cout << "\n--- Thread Safety Tests ---" << std::endl;
     RUN_TEST(test_concurrent_recording);
+    RUN_TEST(test_concurrent_counts_exact);
+
+    // Log-linear histogram tests
+    std::cout << "\n--- Log-Linear Histogram Tests ---" << std::endl;
+    RUN_TEST(test_histogram_bucket_bounds);
+    RUN_TEST(test_histogram_quantiles);
+
+    // Metric handle tests
+    std::cout << "\n--- Metric Handle Tests ---" << std::endl;
+    RUN_TEST(test_metric_handles);
+    RUN_TEST(test_label_escaping);
+
+    // Exposition writer tests
+    std::cout << "\n--- Exposition Writer Tests ---" << std::endl;
+    RUN_TEST(test_exposition_writer_formats);
+    RUN_TEST(test_collector_streaming_output);
+    RUN_TEST(test_gzip_compression);
+    RUN_TEST(test_cardinality_limit);
 
     // Summary
     std::cout << "\n===== Summary =====" << std::endl;
@@ -3,7 +3,7 @@
  * @brief Comprehensive unit tests for patient data cache module
  *
  * Tests for patient cache operations, TTL management, LRU eviction,
- * aliases, and statistics. Target coverage: >= 80%
+ * aliases, statistics, sharding, and snapshots. Target coverage: >= 80%
  *
  * @see https://github.com/kcenon/pacs_bridge/issues/21
  */
@@ -14,6 +14,8 @@
 #include <cassert>
 #include <chrono>
 #include <condition_variable>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <mutex>
 #include <string>
@@ -86,6 +88,8 @@ bool test_cache_error_codes() {
                 "not_found should be -920");
     TEST_ASSERT(to_error_code(cache_error::cache_disabled) == -925,
                 "cache_disabled should be -925");
+    TEST_ASSERT(to_error_code(cache_error::snapshot_io_error) == -926,
+                "snapshot_io_error should be -926");
 
     TEST_ASSERT(std::string(to_string(cache_error::expired)) ==
                     "Cache entry has expired",
@@ -150,6 +154,7 @@ bool test_cache_config_defaults() {
     TEST_ASSERT(config.auto_evict, "Auto evict should be enabled by default");
     TEST_ASSERT(config.lru_eviction, "LRU eviction should be enabled by default");
     TEST_ASSERT(config.enable_statistics, "Statistics should be enabled by default");
+    TEST_ASSERT(config.refresh_ahead == 0.0, "Refresh-ahead should be disabled by default");
 
     return true;
 }
@@ -582,6 +587,95 @@ bool test_cache_get_or_load_loader_returns_nullopt() {
     return true;
 }
 
+bool test_cache_get_or_load_coalesces_misses() {
+    patient_cache cache;
+
+    constexpr int num_threads = 8;
+    std::atomic<int> loader_calls{0};
+    std::atomic<int> ready{0};
+    std::atomic<int> found{0};
+    std::atomic<bool> start_flag{false};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([&]() {
+            ready.fetch_add(1);
+            while (!start_flag.load()) {
+                std::this_thread::yield();
+            }
+            auto result = cache.get_or_load("12345", [&loader_calls]() {
+                loader_calls.fetch_add(1);
+                // Slow source: every thread misses before the load finishes
+                std::this_thread::sleep_for(std::chrono::milliseconds{200});
+                return create_test_patient("12345", "LOADED^PATIENT");
+            });
+            if (result.has_value() && result->patient_name == "LOADED^PATIENT") {
+                found.fetch_add(1);
+            }
+        });
+    }
+
+    while (ready.load() < num_threads) {
+        std::this_thread::yield();
+    }
+    start_flag.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto stats = cache.get_statistics();
+    TEST_ASSERT(loader_calls.load() == 1, "Concurrent misses should share one load");
+    TEST_ASSERT(found.load() == num_threads, "Every caller should get the patient");
+    TEST_ASSERT(stats.load_count == 1, "Statistics should count one load");
+    TEST_ASSERT(stats.coalesced_count + stats.hit_count == num_threads - 1,
+                "Other callers should wait on the load or hit its result");
+
+    return true;
+}
+
+bool test_cache_get_or_load_refresh_ahead() {
+    patient_cache_config config;
+    config.default_ttl = std::chrono::seconds{2};
+    config.refresh_ahead = 0.25;
+    patient_cache cache(config);
+
+    std::atomic<int> version{0};
+    auto loader = [&version]() {
+        int v = version.fetch_add(1) + 1;
+        return create_test_patient("12345", "VERSION^" + std::to_string(v));
+    };
+
+    auto first = cache.get_or_load("12345", loader);
+    TEST_ASSERT(first.has_value() && first->patient_name == "VERSION^1",
+                "First call should load");
+
+    // Past a quarter of the TTL the hit is served and reloaded behind it
+    std::this_thread::sleep_for(std::chrono::milliseconds{700});
+    auto stale = cache.get_or_load("12345", loader);
+    TEST_ASSERT(stale.has_value() && stale->patient_name == "VERSION^1",
+                "Hit should return the cached patient while refreshing");
+
+    bool refreshed = wait_until(
+        [&cache]() {
+            auto current = cache.peek("12345");
+            return current.has_value() && current->patient_name == "VERSION^2";
+        },
+        std::chrono::milliseconds{1000});
+    TEST_ASSERT(refreshed, "Entry should be reloaded in the background");
+
+    auto stats = cache.get_statistics();
+    TEST_ASSERT(stats.refresh_count == 1, "Should refresh once");
+    TEST_ASSERT(stats.load_count == 2, "Should load twice");
+    TEST_ASSERT(version.load() == 2, "Loader should be called twice");
+
+    // The refreshed entry restarts its TTL
+    auto meta = cache.get_metadata("12345");
+    TEST_ASSERT(meta.has_value() && meta->time_remaining().count() >= 1,
+                "Refreshed entry should have a fresh TTL");
+
+    return true;
+}
+
 // =============================================================================
 // Bulk Operations Tests
 // =============================================================================
@@ -1093,6 +1187,296 @@ bool test_cache_concurrent_statistics() {
     return true;
 }
 
+// =============================================================================
+// Sharding Tests
+// =============================================================================
+
+bool test_cache_shared_records() {
+    patient_cache cache;
+    cache.put("12345", create_test_patient("12345"));
+    cache.add_alias("MRN:12345", "12345");
+
+    auto first = cache.get_shared("12345");
+    auto second = cache.get_shared("MRN:12345");
+    TEST_ASSERT(first.has_value() && second.has_value(), "Should find patient");
+    TEST_ASSERT(first->get() == second->get(),
+                "Hits should share the stored record");
+
+    auto peeked = cache.peek_shared("12345");
+    TEST_ASSERT(peeked.has_value() && peeked->get() == first->get(),
+                "Peek should share the stored record");
+
+    // Caller's record outlives the entry
+    TEST_ASSERT(cache.remove("12345"), "Remove should succeed");
+    TEST_ASSERT((*first)->patient_id == "12345", "Held record should stay valid");
+
+    // Shared put stores the caller's record
+    auto record = std::make_shared<const mapping::dicom_patient>(
+        create_test_patient("67890"));
+    cache.put("67890", record);
+    auto stored = cache.get_shared("67890");
+    TEST_ASSERT(stored.has_value() && stored->get() == record.get(),
+                "Shared put should not copy the record");
+
+    return true;
+}
+
+bool test_cache_sharded_capacity() {
+    patient_cache_config config;
+    config.max_entries = 10000;
+    patient_cache cache(config);
+
+    for (int i = 0; i < 20000; i++) {
+        cache.put("P" + std::to_string(i), create_test_patient(std::to_string(i)));
+    }
+
+    TEST_ASSERT(cache.size() == 10000, "Shards together should hold max_entries");
+    auto stats = cache.get_statistics();
+    TEST_ASSERT(stats.eviction_count == 10000, "Should evict the overflow");
+    TEST_ASSERT(stats.max_size_reached == 10000, "Should never exceed capacity");
+    TEST_ASSERT(cache.keys().size() == 10000, "Keys should cover every shard");
+
+    // Aliases resolve across shards
+    int resolved = 0;
+    for (int i = 19000; i < 20000; i++) {
+        std::string key = "P" + std::to_string(i);
+        if (cache.add_alias("ALT" + std::to_string(i), key) &&
+            cache.contains("ALT" + std::to_string(i))) {
+            resolved++;
+        }
+    }
+    TEST_ASSERT(resolved > 0, "Aliases should resolve to entries in other shards");
+
+    cache.clear();
+    TEST_ASSERT(cache.empty(), "Clear should empty every shard");
+
+    return true;
+}
+
+bool test_cache_sharded_recency() {
+    patient_cache_config config;
+    config.max_entries = 1024;
+    config.shard_count = 16;
+    patient_cache cache(config);
+
+    for (int i = 0; i < 1024; i++) {
+        cache.put(std::to_string(i), create_test_patient(std::to_string(i)));
+    }
+
+    // Keys 0-255 are hot, the rest are never read
+    int hot_present = 0;
+    for (int i = 0; i < 256; i++) {
+        if (cache.get(std::to_string(i)).has_value()) {
+            hot_present++;
+        }
+    }
+    int cold_present = static_cast<int>(cache.size()) - hot_present;
+
+    for (int i = 1024; i < 1536; i++) {
+        cache.put(std::to_string(i), create_test_patient(std::to_string(i)));
+    }
+
+    int hot_kept = 0;
+    int cold_kept = 0;
+    for (int i = 0; i < 1024; i++) {
+        if (cache.contains(std::to_string(i))) {
+            (i < 256 ? hot_kept : cold_kept)++;
+        }
+    }
+
+    TEST_ASSERT(cache.size() <= 1024, "Cache should stay within capacity");
+    TEST_ASSERT(hot_kept * 10 >= hot_present * 9,
+                "Recently read entries should survive eviction");
+    TEST_ASSERT(cold_kept * 2 <= cold_present,
+                "Eviction should fall on entries never read");
+
+    return true;
+}
+
+// =============================================================================
+// Snapshot Tests
+// =============================================================================
+
+std::filesystem::path snapshot_test_path(const std::string& name) {
+    auto path = std::filesystem::temp_directory_path() /
+                ("pacs_bridge_cache_test_" + name + ".snap");
+    std::filesystem::remove(path);
+    return path;
+}
+
+bool test_cache_snapshot_round_trip() {
+    auto path = snapshot_test_path("round_trip");
+
+    patient_cache source;
+    auto patient = create_test_patient("12345", "DOE^JOHN");
+    patient.patient_weight = 72.5;
+    patient.other_patient_ids = {"SSN:123-45-6789", "ALT:1"};
+    source.put("12345", patient);
+    source.put("67890", create_test_patient("67890", "SMITH^JANE"));
+    source.add_alias("SSN:123-45-6789", "12345");
+
+    auto saved = source.save_snapshot(path);
+    TEST_ASSERT(saved.has_value() && *saved == 3,
+                "Snapshot should hold two entries and one alias");
+
+    patient_cache restored;
+    auto loaded = restored.load_snapshot(path);
+    TEST_ASSERT(loaded.has_value() && *loaded == 2, "Both entries should load");
+    TEST_ASSERT(restored.size() == 2, "Restored cache should hold both entries");
+
+    auto result = restored.get("SSN:123-45-6789");
+    TEST_ASSERT(result.has_value(), "Alias should be restored");
+    TEST_ASSERT(result->patient_name == "DOE^JOHN", "Name should round-trip");
+    TEST_ASSERT(result->patient_weight == 72.5, "Weight should round-trip");
+    TEST_ASSERT(!result->patient_size.has_value(), "Size should stay unset");
+    TEST_ASSERT(result->other_patient_ids.size() == 2 &&
+                    result->other_patient_ids[1] == "ALT:1",
+                "Other IDs should round-trip");
+    TEST_ASSERT(restored.get_statistics().restored_count == 2,
+                "Restores should be counted");
+
+    std::filesystem::remove(path);
+    return true;
+}
+
+bool test_cache_snapshot_preserves_ttl() {
+    auto path = snapshot_test_path("ttl");
+
+    patient_cache source;
+    source.put("long", create_test_patient("long"), std::chrono::seconds{3600});
+    source.put("short", create_test_patient("short"), std::chrono::seconds{1});
+    TEST_ASSERT(source.save_snapshot(path).has_value(), "Save should succeed");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+    patient_cache restored;
+    auto loaded = restored.load_snapshot(path);
+    TEST_ASSERT(loaded.has_value() && *loaded == 1,
+                "Entry that expired since the snapshot should be skipped");
+    TEST_ASSERT(!restored.contains("short"), "Expired entry should be absent");
+
+    auto before = source.get_metadata("long");
+    auto after = restored.get_metadata("long");
+    TEST_ASSERT(after.has_value() && after->ttl == std::chrono::seconds{3600},
+                "TTL should be preserved");
+    TEST_ASSERT(std::chrono::abs(after->created_at - before->created_at) <
+                    std::chrono::milliseconds(1),
+                "Creation time should be preserved, not reset to load time");
+
+    std::filesystem::remove(path);
+    return true;
+}
+
+bool test_cache_snapshot_keeps_fresher_entries() {
+    auto path = snapshot_test_path("fresher");
+
+    patient_cache source;
+    source.put("12345", create_test_patient("12345", "OLD^NAME"));
+    TEST_ASSERT(source.save_snapshot(path).has_value(), "Save should succeed");
+
+    patient_cache_config config;
+    config.max_entries = 2;
+    patient_cache restored(config);
+    restored.put("12345", create_test_patient("12345", "NEW^NAME"));
+    restored.put("a", create_test_patient("a"));
+
+    auto loaded = restored.load_snapshot(path);
+    TEST_ASSERT(loaded.has_value() && *loaded == 0,
+                "Cached keys should not be overwritten");
+    TEST_ASSERT(restored.get("12345")->patient_name == "NEW^NAME",
+                "Live entry should win over the snapshot");
+    TEST_ASSERT(restored.get_statistics().eviction_count == 0,
+                "Restoring should never evict");
+
+    std::filesystem::remove(path);
+    return true;
+}
+
+bool test_cache_snapshot_rejects_corrupt_file() {
+    auto path = snapshot_test_path("corrupt");
+    patient_cache cache;
+
+    auto missing = cache.load_snapshot(path);
+    TEST_ASSERT(!missing.has_value() &&
+                    missing.error() == cache_error::snapshot_io_error,
+                "Missing file should be an I/O error");
+
+    patient_cache source;
+    source.put("12345", create_test_patient("12345"));
+    TEST_ASSERT(source.save_snapshot(path).has_value(), "Save should succeed");
+
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-3, std::ios::end);
+        file.put('X');
+    }
+
+    auto corrupt = cache.load_snapshot(path);
+    TEST_ASSERT(!corrupt.has_value() &&
+                    corrupt.error() == cache_error::serialization_error,
+                "Checksum mismatch should be rejected");
+    TEST_ASSERT(cache.empty(), "Nothing should load from a corrupt file");
+
+    std::filesystem::remove(path);
+    return true;
+}
+
+bool test_cache_snapshot_owner_only() {
+#ifndef _WIN32
+    auto path = snapshot_test_path("owner_only");
+
+    patient_cache source;
+    source.put("12345", create_test_patient("12345", "DOE^JOHN"));
+    TEST_ASSERT(source.save_snapshot(path).has_value(), "Save should succeed");
+
+    using std::filesystem::perms;
+    auto mode = std::filesystem::status(path).permissions();
+    TEST_ASSERT((mode & (perms::group_all | perms::others_all)) == perms::none,
+                "Snapshot should be readable by its owner only");
+
+    std::filesystem::remove(path);
+#endif
+    return true;
+}
+
+bool test_cache_snapshot_warm_start() {
+    auto path = snapshot_test_path("warm_start");
+
+    {
+        patient_cache_config config;
+        config.snapshot_path = path;
+        config.snapshot_interval = std::chrono::seconds{1};
+        patient_cache source(config);
+        for (int i = 0; i < 100; i++) {
+            source.put(std::to_string(i), create_test_patient(std::to_string(i)));
+        }
+
+        // Written by the background thread
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!std::filesystem::exists(path) &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        TEST_ASSERT(std::filesystem::exists(path),
+                    "Snapshot should be written periodically");
+    }
+
+    patient_cache_config config;
+    config.snapshot_path = path;
+    config.snapshot_interval = std::chrono::seconds{0};
+    patient_cache restored(config);
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (restored.size() < 100 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    TEST_ASSERT(restored.size() == 100, "Snapshot should restore in the background");
+    TEST_ASSERT(restored.get("42").has_value(), "Restored entry should be served");
+
+    std::filesystem::remove(path);
+    return true;
+}
+
 // =============================================================================
 // Main Test Runner
 // =============================================================================
@@ -1141,6 +1525,8 @@ int run_all_tests() {
     RUN_TEST(test_cache_get_or_load_cached);
     RUN_TEST(test_cache_get_or_load_not_cached);
     RUN_TEST(test_cache_get_or_load_loader_returns_nullopt);
+    RUN_TEST(test_cache_get_or_load_coalesces_misses);
+    RUN_TEST(test_cache_get_or_load_refresh_ahead);
 
     std::cout << "\n=== Bulk Operations Tests ===" << std::endl;
     RUN_TEST(test_cache_get_many);
@@ -1169,6 +1555,19 @@ int run_all_tests() {
     RUN_TEST(test_cache_concurrent_alias_operations);
     RUN_TEST(test_cache_concurrent_statistics);
 
+    std::cout << "\n=== Sharding Tests ===" << std::endl;
+    RUN_TEST(test_cache_shared_records);
+    RUN_TEST(test_cache_sharded_capacity);
+    RUN_TEST(test_cache_sharded_recency);
+
+    std::cout << "\n=== Snapshot Tests ===" << std::endl;
+    RUN_TEST(test_cache_snapshot_round_trip);
+    RUN_TEST(test_cache_snapshot_preserves_ttl);
+    RUN_TEST(test_cache_snapshot_keeps_fresher_entries);
+    RUN_TEST(test_cache_snapshot_rejects_corrupt_file);
+    RUN_TEST(test_cache_snapshot_owner_only);
+    RUN_TEST(test_cache_snapshot_warm_start);
+
     std::cout << "\n=== Test Summary ===" << std::endl;
     std::cout << "Passed: " << passed << std::endl;
     std::cout << "Failed: " << failed << std::endl;
@@ -7,6 +7,7 @@
  * - HL7HandlerConcept validation
  * - HL7HandlerWrapper type erasure
  * - HL7HandlerRegistry functionality
+ * - Flat message view dispatch
  * - Performance validation
  *
  * @see https://github.com/kcenon/pacs_bridge/issues/202
@@ -16,6 +17,7 @@
 #include "pacs/bridge/cache/patient_cache.h"
 #include "pacs/bridge/pacs_adapter/mwl_client.h"
 #include "pacs/bridge/protocol/hl7/adt_handler.h"
+#include "pacs/bridge/protocol/hl7/hl7_flat_message.h"
 #include "pacs/bridge/protocol/hl7/hl7_handler_base.h"
 #include "pacs/bridge/protocol/hl7/hl7_handler_registry.h"
 #include "pacs/bridge/protocol/hl7/hl7_message.h"
@@ -397,6 +399,144 @@ TEST_F(RegistryTest, ResetStatistics) {
     EXPECT_EQ(stats.total_processed, 0);
 }
 
+// =============================================================================
+// Flat View Dispatch Tests
+// =============================================================================
+
+/**
+ * @brief Legacy handler implementing only the hl7_message interface
+ */
+class message_only_handler : public IHL7Handler {
+public:
+    using IHL7Handler::can_handle;
+    using IHL7Handler::process;
+
+    [[nodiscard]] bool can_handle(
+        const hl7_message& message) const noexcept override {
+        return message.type() == message_type::ADT;
+    }
+
+    [[nodiscard]] Result<handler_result> process(
+        const hl7_message& message) override {
+        handler_result result;
+        result.success = true;
+        result.message_type = message.header().type_string;
+        result.handler_type = "LEGACY";
+        return result;
+    }
+
+    [[nodiscard]] std::string_view handler_type() const noexcept override {
+        return "LEGACY";
+    }
+};
+
+class FlatViewDispatchTest : public ::testing::Test {
+protected:
+    std::shared_ptr<cache::patient_cache> cache_;
+    std::shared_ptr<pacs_adapter::mwl_client> mwl_client_;
+
+    void SetUp() override {
+        cache_ = std::make_shared<cache::patient_cache>();
+        mwl_client_ = create_test_mwl_client();
+    }
+};
+
+TEST_F(FlatViewDispatchTest, HandlersSatisfyViewConcept) {
+    static_assert(HL7ViewHandlerConcept<adt_handler>,
+                  "adt_handler must satisfy HL7ViewHandlerConcept");
+    static_assert(HL7ViewHandlerConcept<orm_handler>,
+                  "orm_handler must satisfy HL7ViewHandlerConcept");
+    static_assert(HL7ViewHandlerConcept<siu_handler>,
+                  "siu_handler must satisfy HL7ViewHandlerConcept");
+}
+
+TEST_F(FlatViewDispatchTest, CanHandleMatchesMessageModel) {
+    adt_handler adt(cache_);
+    orm_handler orm(mwl_client_);
+    siu_handler siu(mwl_client_);
+
+    for (const auto& raw : {SAMPLE_ADT_A01, SAMPLE_ORM_O01, SAMPLE_SIU_S12}) {
+        auto msg = hl7_message::parse(raw);
+        auto view = hl7_flat_message::parse(raw);
+        ASSERT_TRUE(msg.has_value());
+        ASSERT_TRUE(view.has_value());
+
+        EXPECT_EQ(adt.can_handle(*view), adt.can_handle(*msg));
+        EXPECT_EQ(orm.can_handle(*view), orm.can_handle(*msg));
+        EXPECT_EQ(siu.can_handle(*view), siu.can_handle(*msg));
+    }
+}
+
+TEST_F(FlatViewDispatchTest, WrapperReportsViewSupport) {
+    auto wrapper = make_handler_wrapper<adt_handler>(cache_);
+    EXPECT_TRUE(wrapper->supports_view());
+
+    message_only_handler legacy;
+    EXPECT_FALSE(legacy.supports_view());
+
+    auto view = hl7_flat_message::parse(SAMPLE_ADT_A01);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_TRUE(wrapper->can_handle(*view));
+    EXPECT_TRUE(legacy.can_handle(*view));
+}
+
+TEST_F(FlatViewDispatchTest, RegistryProcessesViewWithoutMaterializing) {
+    hl7_handler_registry registry;
+    registry.register_handler<adt_handler>(cache_);
+    registry.register_handler<orm_handler>(mwl_client_);
+
+    auto msg = hl7_message::parse(SAMPLE_ADT_A01);
+    auto view = hl7_flat_message::parse(SAMPLE_ADT_A01);
+    ASSERT_TRUE(msg.has_value());
+    ASSERT_TRUE(view.has_value());
+
+    auto from_view = registry.process(*view);
+    ASSERT_TRUE(from_view.is_ok());
+    EXPECT_TRUE(from_view.value().success);
+    EXPECT_EQ(from_view.value().handler_type, "ADT");
+    EXPECT_EQ(from_view.value().ack_message.get_value("MSA.1"), "AA");
+    EXPECT_EQ(from_view.value().ack_message.get_value("MSA.2"), "MSG001");
+
+    auto from_message = registry.process(*msg);
+    ASSERT_TRUE(from_message.is_ok());
+    EXPECT_TRUE(from_message.value().success);
+    EXPECT_EQ(from_view.value().message_type, from_message.value().message_type);
+
+    EXPECT_TRUE(registry.can_process(*view));
+    EXPECT_EQ(registry.find_handler(*view)->handler_type(), "ADT");
+
+    auto stats = registry.get_statistics();
+    EXPECT_EQ(stats.total_processed, 2);
+    EXPECT_EQ(stats.materialized_count, 0);
+}
+
+TEST_F(FlatViewDispatchTest, RegistryMaterializesForLegacyHandler) {
+    hl7_handler_registry registry;
+    ASSERT_TRUE(registry
+                    .register_handler(std::make_unique<message_only_handler>())
+                    .is_ok());
+
+    auto view = hl7_flat_message::parse(SAMPLE_ADT_A01);
+    ASSERT_TRUE(view.has_value());
+
+    auto result = registry.process(*view);
+    ASSERT_TRUE(result.is_ok());
+    EXPECT_EQ(result.value().handler_type, "LEGACY");
+    EXPECT_EQ(registry.get_statistics().materialized_count, 1);
+}
+
+TEST_F(FlatViewDispatchTest, RegistryViewNoHandler) {
+    hl7_handler_registry registry;
+    registry.register_handler<adt_handler>(cache_);
+
+    auto view = hl7_flat_message::parse(SAMPLE_SIU_S12);
+    ASSERT_TRUE(view.has_value());
+
+    auto result = registry.process(*view);
+    EXPECT_FALSE(result.is_ok());
+    EXPECT_EQ(result.error().code, to_error_code(registry_error::no_handler));
+}
+
 // =============================================================================
 // Handler Error Code Tests
 // =============================================================================
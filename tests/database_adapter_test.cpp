@@ -237,6 +237,107 @@ TEST_F(DatabaseAdapterTest, PreparedStatement) {
     adapter_->release_connection(*conn_result);
 }
 
+TEST_F(DatabaseAdapterTest, PreparedStatementReuseClearsBindings) {
+    ASSERT_TRUE(adapter_->execute_schema(
+        "CREATE TABLE items (id INTEGER PRIMARY KEY, name TEXT)"
+    ).has_value());
+
+    auto conn_result = adapter_->acquire_connection();
+    ASSERT_TRUE(conn_result.has_value());
+    auto& conn = *conn_result;
+
+    constexpr std::string_view insert_sql = "INSERT INTO items (name) VALUES (?)";
+    {
+        auto stmt = conn->prepare(insert_sql);
+        ASSERT_TRUE(stmt.has_value());
+        EXPECT_TRUE((*stmt)->bind_string(1, "first").has_value());
+        EXPECT_TRUE((*stmt)->execute().has_value());
+    }
+
+    // The second prepare reuses the compiled statement with no bindings left
+    {
+        auto stmt = conn->prepare(insert_sql);
+        ASSERT_TRUE(stmt.has_value());
+        EXPECT_TRUE((*stmt)->execute().has_value());
+    }
+
+    auto result = conn->execute("SELECT name FROM items ORDER BY id");
+    ASSERT_TRUE(result.has_value());
+    ASSERT_TRUE((*result)->next());
+    EXPECT_EQ((*result)->current_row().get_string(0), "first");
+    ASSERT_TRUE((*result)->next());
+    EXPECT_TRUE((*result)->current_row().is_null(0));
+    EXPECT_FALSE((*result)->next());
+
+    adapter_->release_connection(*conn_result);
+}
+
+TEST_F(DatabaseAdapterTest, PreparedCachedReturnsSameStatement) {
+    ASSERT_TRUE(adapter_->execute_schema(
+        "CREATE TABLE items (id INTEGER PRIMARY KEY, name TEXT)"
+    ).has_value());
+
+    auto conn_result = adapter_->acquire_connection();
+    ASSERT_TRUE(conn_result.has_value());
+    auto& conn = *conn_result;
+
+    auto first = conn->prepare_cached("INSERT INTO items (name) VALUES (?)");
+    ASSERT_TRUE(first.has_value());
+    EXPECT_TRUE((*first)->bind_string(1, "cached").has_value());
+    EXPECT_TRUE((*first)->execute().has_value());
+
+    auto second = conn->prepare_cached("INSERT INTO items (name) VALUES (?)");
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(*first, *second);
+    EXPECT_TRUE((*second)->execute().has_value());
+
+    auto result = conn->execute("SELECT COUNT(*), COUNT(name) FROM items");
+    ASSERT_TRUE(result.has_value());
+    ASSERT_TRUE((*result)->next());
+    EXPECT_EQ((*result)->current_row().get_int64(0), 2);
+    EXPECT_EQ((*result)->current_row().get_int64(1), 1);
+    EXPECT_FALSE((*result)->next());
+
+    adapter_->release_connection(*conn_result);
+}
+
+TEST_F(DatabaseAdapterTest, StatementCacheEviction) {
+    adapter_.reset();
+    std::filesystem::remove(test_db_path_);
+
+    database_config config;
+    config.database_path = test_db_path_.string();
+    config.pool_size = 1;
+    config.statement_cache_size = 1;
+    adapter_ = create_database_adapter(config);
+
+    ASSERT_TRUE(adapter_->execute_schema(
+        "CREATE TABLE counters (id INTEGER PRIMARY KEY, value INTEGER)"
+    ).has_value());
+
+    auto conn_result = adapter_->acquire_connection();
+    ASSERT_TRUE(conn_result.has_value());
+    auto& conn = *conn_result;
+
+    // Alternating statements evict each other from a one-entry cache
+    for (int i = 0; i < 4; ++i) {
+        auto insert = conn->prepare_cached("INSERT INTO counters (value) VALUES (?)");
+        ASSERT_TRUE(insert.has_value());
+        EXPECT_TRUE((*insert)->bind_int64(1, i).has_value());
+        EXPECT_TRUE((*insert)->execute().has_value());
+
+        auto count = conn->prepare_cached("SELECT COUNT(*) FROM counters");
+        ASSERT_TRUE(count.has_value());
+        auto result = (*count)->execute();
+        ASSERT_TRUE(result.has_value());
+        ASSERT_TRUE((*result)->next());
+        EXPECT_EQ((*result)->current_row().get_int64(0), i + 1);
+        EXPECT_FALSE((*result)->next());
+    }
+
+    adapter_->release_connection(*conn_result);
+}
+
 TEST_F(DatabaseAdapterTest, PreparedStatementWithBlob) {
     ASSERT_TRUE(adapter_->execute_schema(
         "CREATE TABLE data (id INTEGER PRIMARY KEY, content BLOB)"
@@ -0,0 +1,209 @@
+/**
+ * @file delimiter_scanner_test.cpp
+ * @brief Unit tests for the vectorized HL7 delimiter scanner
+ *
+ * Verifies that every scan kernel produces the same position index as the
+ * scalar reference for arbitrary alignments, tail lengths and delimiter
+ * densities, and that parsers built on the index handle large messages.
+ */
+
+#include <gtest/gtest.h>
+
+#include "pacs/bridge/performance/delimiter_scanner.h"
+#include "pacs/bridge/performance/zero_copy_parser.h"
+#include "pacs/bridge/protocol/hl7/hl7_flat_message.h"
+#include "pacs/bridge/protocol/hl7/hl7_message.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace pacs::bridge::performance {
+namespace {
+
+const delimiter_set hl7_delimiters{'\r', '\n', '|', '^', '~', '&'};
+
+std::vector<uint32_t> reference_positions(std::string_view data,
+                                          const delimiter_set& set) {
+    std::vector<uint32_t> out;
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (set.contains(data[i])) {
+            out.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    return out;
+}
+
+void expect_all_levels_match(std::string_view data, const delimiter_set& set) {
+    const auto expected = reference_positions(data, set);
+    for (auto level : {simd_level::scalar, simd_level::sse2, simd_level::avx2}) {
+        auto index = delimiter_index::scan(data, set, level);
+        std::vector<uint32_t> actual(index.positions().begin(),
+                                     index.positions().end());
+        EXPECT_EQ(actual, expected)
+            << "level=" << to_string(index.level()) << " size=" << data.size();
+    }
+}
+
+/**
+ * @brief Base64-like report payload with no HL7 delimiters
+ */
+std::string make_base64(size_t size) {
+    static constexpr char alphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out(size, 'A');
+    for (size_t i = 0; i < size; ++i) {
+        out[i] = alphabet[(i * 7 + i / 64) % 64];
+    }
+    return out;
+}
+
+// =============================================================================
+// Delimiter Set
+// =============================================================================
+
+TEST(DelimiterSetTest, MembershipAndDuplicates) {
+    delimiter_set set{'|', '^', '|'};
+    EXPECT_EQ(set.size(), 2u);
+    EXPECT_TRUE(set.contains('|'));
+    EXPECT_TRUE(set.contains('^'));
+    EXPECT_FALSE(set.contains('~'));
+    EXPECT_FALSE(set.contains('\0'));
+}
+
+TEST(DelimiterSetTest, HighBytesAndCapacity) {
+    delimiter_set set;
+    EXPECT_TRUE(set.empty());
+    EXPECT_TRUE(set.add(static_cast<char>(0xFF)));
+    EXPECT_TRUE(set.contains(static_cast<char>(0xFF)));
+    EXPECT_FALSE(set.contains(static_cast<char>(0x7F)));
+
+    for (char c = 'a'; c < 'a' + 7; ++c) {
+        EXPECT_TRUE(set.add(c));
+    }
+    EXPECT_EQ(set.size(), delimiter_set::max_size);
+    EXPECT_FALSE(set.add('z'));
+    EXPECT_FALSE(set.contains('z'));
+}
+
+// =============================================================================
+// Kernel Equivalence
+// =============================================================================
+
+TEST(DelimiterIndexTest, DetectedLevelIsNotExceeded) {
+    auto index = delimiter_index::scan("MSH|^~\\&", hl7_delimiters,
+                                       simd_level::avx2);
+    EXPECT_LE(static_cast<int>(index.level()),
+              static_cast<int>(detected_simd_level()));
+}
+
+TEST(DelimiterIndexTest, EmptyInputs) {
+    EXPECT_TRUE(delimiter_index::scan("", hl7_delimiters).empty());
+    EXPECT_TRUE(delimiter_index::scan("PID|1", delimiter_set{}).empty());
+}
+
+TEST(DelimiterIndexTest, AllLengthsAroundVectorWidth) {
+    // Covers every tail length for 16- and 32-byte kernels, with delimiters
+    // in the first and last lane of each block
+    for (size_t size = 0; size <= 100; ++size) {
+        std::string data(size, 'x');
+        for (size_t i = 0; i < size; i += 15) {
+            data[i] = '|';
+        }
+        if (size > 0) {
+            data[size - 1] = '\r';
+        }
+        expect_all_levels_match(data, hl7_delimiters);
+    }
+}
+
+TEST(DelimiterIndexTest, RandomData) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> byte(0, 255);
+    for (int round = 0; round < 50; ++round) {
+        std::string data(static_cast<size_t>(rng() % 2000), '\0');
+        for (auto& c : data) {
+            c = static_cast<char>(byte(rng));
+        }
+        expect_all_levels_match(data, hl7_delimiters);
+        expect_all_levels_match(data, {'\r', '\n'});
+    }
+}
+
+TEST(DelimiterIndexTest, UnalignedSubstrings) {
+    const std::string sample =
+        "MSH|^~\\&|HIS|HOSPITAL|PACS|RADIOLOGY|20240115103000||ADT^A01|MSG001|P|2.4\r"
+        "PID|1||12345^^^HOSPITAL^MR~67890^^^OTHER^PI||DOE^JOHN&JR||19800515|M\r";
+    for (size_t offset = 0; offset < 40; ++offset) {
+        expect_all_levels_match(std::string_view(sample).substr(offset),
+                                hl7_delimiters);
+    }
+}
+
+TEST(DelimiterScannerTest, ChunkedScanMatchesIndex) {
+    std::string data;
+    for (int i = 0; i < 200; ++i) {
+        data += "OBX|" + std::to_string(i) + "|TX|A^B~C&D||" +
+                make_base64(static_cast<size_t>(i % 70)) + "\r";
+    }
+    const auto expected = reference_positions(data, hl7_delimiters);
+
+    for (auto level : {simd_level::scalar, simd_level::sse2, simd_level::avx2}) {
+        for (size_t chunk_size : {size_t{1}, size_t{7}, size_t{64}, size_t{1000}}) {
+            delimiter_scanner scanner(data, hl7_delimiters, level);
+            std::vector<uint32_t> chunk(chunk_size);
+            std::vector<uint32_t> actual;
+            while (size_t n = scanner.next(chunk)) {
+                ASSERT_LE(n, chunk_size);
+                actual.insert(actual.end(), chunk.begin(),
+                              chunk.begin() + static_cast<std::ptrdiff_t>(n));
+            }
+            EXPECT_TRUE(scanner.done());
+            EXPECT_EQ(actual, expected)
+                << "level=" << to_string(scanner.level()) << " chunk=" << chunk_size;
+        }
+    }
+}
+
+TEST(DelimiterIndexTest, LowerBound) {
+    auto index = delimiter_index::scan("a|b|c|", {'|'});
+    ASSERT_EQ(index.size(), 3u);
+    EXPECT_EQ(index.lower_bound(0), 0u);
+    EXPECT_EQ(index.lower_bound(2), 1u);
+    EXPECT_EQ(index.lower_bound(3), 1u);
+    EXPECT_EQ(index.lower_bound(6), 3u);
+}
+
+// =============================================================================
+// Parsers on Large Payloads
+// =============================================================================
+
+TEST(DelimiterIndexTest, LargeBase64ReportParsesConsistently) {
+    const std::string payload = make_base64(3 * 1024 * 1024 + 5);
+    const std::string raw =
+        "MSH|^~\\&|RIS|RAD|HIS|HOSP|20240115150000||ORU^R01|MSG100|P|2.5\r"
+        "PID|1||12345^^^HOSP^MR||DOE^JOHN\r"
+        "OBX|1|ED|PDF^Report||^application^pdf^Base64^" + payload + "||||||F\r"
+        "OBX|2|TX|IMP||Normal||||||F\r";
+
+    auto index = delimiter_index::scan(raw, hl7_delimiters);
+    EXPECT_LT(index.size(), 100u);
+
+    auto tree = hl7::hl7_message::parse(raw);
+    ASSERT_TRUE(tree.has_value());
+    EXPECT_EQ(tree->segment_count(), 4u);
+    EXPECT_EQ(tree->get_value("OBX.5.5").size(), payload.size());
+    EXPECT_EQ(tree->get_value("OBX[1].5"), "Normal");
+
+    auto flat = hl7::hl7_flat_message::parse(raw);
+    ASSERT_TRUE(flat.has_value());
+    EXPECT_EQ(flat->get_value("OBX.5.5"), tree->get_value("OBX.5.5"));
+
+    auto lazy = zero_copy_parser::parse(raw);
+    ASSERT_TRUE(lazy.has_value());
+    EXPECT_EQ(lazy->segment_count(), 4u);
+    EXPECT_EQ(lazy->segments("OBX").size(), 2u);
+}
+
+}  // namespace
+}  // namespace pacs::bridge::performance
@@ -0,0 +1,353 @@
+/**
+ * @file hl7_flat_message_test.cpp
+ * @brief Unit tests for the arena-backed flat HL7 message model
+ *
+ * Verifies that hl7_flat_message returns the same values as hl7_message for
+ * every addressable position, that copy-on-write mutation matches
+ * hl7_message::set_value semantics, and that parsing allocates a small,
+ * size-independent number of blocks.
+ */
+
+#include <gtest/gtest.h>
+
+#include "pacs/bridge/protocol/hl7/hl7_flat_message.h"
+#include "pacs/bridge/protocol/hl7/hl7_message.h"
+
+#include "test_helpers.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+
+// =============================================================================
+// Allocation Counting
+// =============================================================================
+
+namespace {
+std::atomic<size_t> g_allocation_count{0};
+}  // namespace
+
+void* operator new(std::size_t size) {
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace pacs::bridge::hl7 {
+namespace {
+
+using namespace pacs::bridge::test;
+
+/**
+ * @brief Compare every addressable leaf of both models
+ */
+void expect_equivalent(std::string_view raw) {
+    auto dom = hl7_message::parse(raw);
+    auto flat = hl7_flat_message::parse(raw);
+    ASSERT_TRUE(dom.has_value());
+    ASSERT_TRUE(flat.has_value());
+
+    ASSERT_EQ(flat->segment_count(), dom->segment_count());
+    EXPECT_EQ(flat->control_id(), dom->control_id());
+    EXPECT_EQ(flat->trigger_event(), dom->trigger_event());
+    EXPECT_EQ(flat->type(), dom->type());
+
+    for (size_t s = 0; s < dom->segment_count(); ++s) {
+        const auto& seg = dom->segment_at(s);
+        auto view = flat->segment_at(s);
+
+        EXPECT_EQ(view.segment_id(), seg.segment_id());
+        ASSERT_EQ(view.field_count(), seg.field_count())
+            << "segment " << seg.segment_id();
+
+        for (size_t f = 1; f <= seg.field_count() + 1; ++f) {
+            const auto& field = seg.field(f);
+            auto fview = view.field(f);
+            EXPECT_EQ(fview.repetition_count(), field.repetition_count());
+            EXPECT_EQ(fview.component_count(), field.component_count());
+            EXPECT_EQ(fview.empty(), field.empty());
+
+            for (size_t r = 1; r <= field.repetition_count() + 1; ++r) {
+                for (size_t c = 1; c <= 6; ++c) {
+                    const auto& comp = field.component(r, c);
+                    auto cview = fview.component(r, c);
+                    EXPECT_EQ(cview.subcomponent_count(),
+                              comp.subcomponent_count());
+                    for (size_t sc = 1; sc <= 3; ++sc) {
+                        EXPECT_EQ(cview.subcomponent(sc),
+                                  comp.subcomponent(sc).value())
+                            << seg.segment_id() << "-" << f << "[" << r
+                            << "]." << c << "." << sc;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// =============================================================================
+// Parsing Equivalence
+// =============================================================================
+
+TEST(HL7FlatMessageTest, MatchesTreeModelForSampleMessages) {
+    expect_equivalent(hl7_samples::ADT_A01);
+    expect_equivalent(hl7_samples::ORM_O01);
+    expect_equivalent(hl7_samples::ORU_R01);
+    expect_equivalent(hl7_samples::ACK_AA);
+    expect_equivalent(hl7_samples::MINIMAL_MSG);
+    expect_equivalent(hl7_samples::MSG_WITH_ZDS);
+}
+
+TEST(HL7FlatMessageTest, MatchesTreeModelForCustomDelimiters) {
+    expect_equivalent(hl7_samples::CUSTOM_DELIM_MSG);
+}
+
+TEST(HL7FlatMessageTest, MatchesTreeModelForRepetitionsAndSubcomponents) {
+    expect_equivalent(
+        "MSH|^~\\&|A|B|C|D|20240101||ADT^A01|X1|P|2.5\r"
+        "PID|1||111^^^H&1.2.3&ISO^MR~222^^^H2^PI||DOE^JOHN~ALIAS^J||||^^\r"
+        "NTE|||a&b&c^d~~e\n"
+        "ZZZ\r");
+}
+
+TEST(HL7FlatMessageTest, MatchesTreeModelForTrailingWhitespace) {
+    expect_equivalent(
+        "MSH|^~\\&|A|B|C|D|20240101||ADT^A01|X1|P|2.5   \r\n"
+        "\r\n"
+        "PID|1||123^^^H   \r"
+        "   \r"
+        "NTE|||text  ");
+    expect_equivalent("MSH|^~\\&   \rPID|1\r");
+}
+
+TEST(HL7FlatMessageTest, MatchesTreeModelForSpaceSeparator) {
+    expect_equivalent("MSH ^~\\& A B C D 20240101  ADT^A01 X1 P 2.5  \r"
+                      "PID 1  123^^^H   \r");
+}
+
+TEST(HL7FlatMessageTest, PathAccess) {
+    auto msg = hl7_flat_message::parse(hl7_samples::ADT_A01);
+    ASSERT_TRUE(msg.has_value());
+
+    EXPECT_EQ(msg->get_value("PID.5.1"), "DOE");
+    EXPECT_EQ(msg->get_value("PID.5.2"), "JOHN");
+    EXPECT_EQ(msg->get_value("PID.3.4"), "HOSPITAL");
+    EXPECT_EQ(msg->get_value("MSH.9.2"), "A01");
+    EXPECT_EQ(msg->get_value("MSH.1"), "|");
+    EXPECT_EQ(msg->get_value("MSH.2"), "^~\\&");
+    EXPECT_EQ(msg->get_value("PV1[0].3.2"), "101");
+    EXPECT_TRUE(msg->get_value("PV1[1].3").empty());
+    EXPECT_TRUE(msg->get_value("OBX.5").empty());
+    EXPECT_TRUE(msg->get_value("PID").empty());
+}
+
+TEST(HL7FlatMessageTest, HeaderMatchesTreeModel) {
+    auto flat = hl7_flat_message::parse(hl7_samples::ORM_O01);
+    auto dom = hl7_message::parse(hl7_samples::ORM_O01);
+    ASSERT_TRUE(flat.has_value());
+    ASSERT_TRUE(dom.has_value());
+
+    auto a = flat->header();
+    auto b = dom->header();
+    EXPECT_EQ(a.sending_application, b.sending_application);
+    EXPECT_EQ(a.receiving_facility, b.receiving_facility);
+    EXPECT_EQ(a.type, b.type);
+    EXPECT_EQ(a.trigger_event, b.trigger_event);
+    EXPECT_EQ(a.message_control_id, b.message_control_id);
+    EXPECT_EQ(a.version_id, b.version_id);
+    EXPECT_EQ(a.accept_ack_type, b.accept_ack_type);
+}
+
+TEST(HL7FlatMessageTest, SegmentViews) {
+    auto msg = hl7_flat_message::parse(hl7_samples::MSG_WITH_ZDS);
+    ASSERT_TRUE(msg.has_value());
+
+    EXPECT_TRUE(msg->has_segment("ZDS"));
+    EXPECT_FALSE(msg->has_segment("OBX"));
+    EXPECT_FALSE(msg->segment("OBX"));
+
+    auto pid = msg->segment("PID");
+    ASSERT_TRUE(pid);
+    EXPECT_EQ(pid->field_value(3), "12345");
+    EXPECT_EQ(pid->get_value("5.2"), "JOHN");
+    EXPECT_EQ(pid->raw().substr(0, 6), "PID|1|");
+
+    EXPECT_EQ(msg->segments("ORC").size(), 1u);
+    EXPECT_THROW((void)msg->segment_at(99), std::out_of_range);
+}
+
+TEST(HL7FlatMessageTest, ParseErrors) {
+    EXPECT_EQ(hl7_flat_message::parse(std::string_view{}).error(),
+              hl7_error::empty_message);
+    EXPECT_EQ(hl7_flat_message::parse("PID|1||12345\r").error(),
+              hl7_error::missing_msh);
+    EXPECT_EQ(hl7_flat_message::parse(
+                  "MSH|^~\\&|A|B|C|D|20240101||ADT^A01|X|P|2.5\rPI\r")
+                  .error(),
+              hl7_error::invalid_segment);
+}
+
+TEST(HL7FlatMessageTest, AdoptsBufferWithoutCopy) {
+    std::string raw(hl7_samples::ADT_A01);
+    const char* data = raw.data();
+    auto msg = hl7_flat_message::parse_owned(std::move(raw));
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->raw().data(), data);
+}
+
+TEST(HL7FlatMessageTest, BorrowsCallerBuffer) {
+    const std::string raw(hl7_samples::ADT_A01);
+    auto msg = hl7_flat_message::parse_borrowed(raw);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_TRUE(msg->is_borrowed());
+    EXPECT_EQ(msg->raw().data(), raw.data());
+    EXPECT_EQ(msg->get_value("PID.5.1"), "DOE");
+
+    hl7_flat_message moved = std::move(*msg);
+    EXPECT_EQ(moved.raw().data(), raw.data());
+    EXPECT_EQ(moved.get_value("PID.5.2"), "JOHN");
+
+    auto owned = hl7_flat_message::parse(raw);
+    ASSERT_TRUE(owned.has_value());
+    EXPECT_FALSE(owned->is_borrowed());
+    EXPECT_NE(owned->raw().data(), raw.data());
+}
+
+TEST(HL7FlatMessageTest, CreateAckMatchesTreeModel) {
+    auto flat = hl7_flat_message::parse(hl7_samples::ORM_O01);
+    auto dom = hl7_message::parse(hl7_samples::ORM_O01);
+    ASSERT_TRUE(flat.has_value());
+    ASSERT_TRUE(dom.has_value());
+
+    auto a = flat->create_ack(ack_code::AE, "Rejected");
+    auto b = dom->create_ack(ack_code::AE, "Rejected");
+    EXPECT_EQ(a.get_value("MSA.1"), b.get_value("MSA.1"));
+    EXPECT_EQ(a.get_value("MSA.2"), b.get_value("MSA.2"));
+    EXPECT_EQ(a.get_value("MSA.3"), b.get_value("MSA.3"));
+    EXPECT_EQ(a.get_value("MSH.3"), b.get_value("MSH.3"));
+    EXPECT_EQ(a.get_value("MSH.5"), b.get_value("MSH.5"));
+    EXPECT_EQ(a.get_value("MSH.9.2"), b.get_value("MSH.9.2"));
+}
+
+// =============================================================================
+// Copy-on-write Mutation
+// =============================================================================
+
+TEST(HL7FlatMessageTest, SetValueMatchesTreeSemantics) {
+    auto flat = hl7_flat_message::parse(hl7_samples::ADT_A01);
+    auto dom = hl7_message::parse(hl7_samples::ADT_A01);
+    ASSERT_TRUE(flat.has_value());
+    ASSERT_TRUE(dom.has_value());
+
+    const std::string_view raw_before = flat->raw();
+    const std::string original(raw_before);
+
+    const char* writes[][2] = {
+        {"PID.5.2", "JANE"},
+        {"PID.3", "99999"},
+        {"PID.11.3.2", "SUB"},
+        {"PV1.3.1", "ICU"},
+        {"PV1.3", "ER"},
+    };
+    for (const auto& w : writes) {
+        EXPECT_TRUE(flat->set_value(w[0], w[1]));
+        dom->set_value(w[0], w[1]);
+    }
+
+    EXPECT_TRUE(flat->is_modified());
+    EXPECT_EQ(flat->raw(), original);
+
+    for (const char* path : {"PID.5.1", "PID.5.2", "PID.3.1", "PID.3.4",
+                             "PID.11.3.1", "PID.11.3.2", "PID.11.1",
+                             "PV1.3.1", "PV1.3.2", "PV1.7.1"}) {
+        EXPECT_EQ(flat->get_value(path), dom->get_value(path)) << path;
+    }
+
+    EXPECT_EQ(flat->serialize(), dom->serialize());
+    auto materialized = flat->to_message();
+    ASSERT_TRUE(materialized.has_value());
+    EXPECT_EQ(materialized->serialize(), dom->serialize());
+}
+
+TEST(HL7FlatMessageTest, ToMessageOnEmptyViewFails) {
+    hl7_flat_message empty;
+    auto materialized = empty.to_message();
+    ASSERT_FALSE(materialized.has_value());
+    EXPECT_EQ(materialized.error(), hl7_error::empty_message);
+}
+
+TEST(HL7FlatMessageTest, SetValueOnMissingSegmentFails) {
+    auto msg = hl7_flat_message::parse(hl7_samples::MINIMAL_MSG);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_FALSE(msg->set_value("PID.5.1", "DOE"));
+    EXPECT_FALSE(msg->is_modified());
+}
+
+TEST(HL7FlatMessageTest, CopyIsIndependent) {
+    auto msg = hl7_flat_message::parse(hl7_samples::ADT_A01);
+    ASSERT_TRUE(msg.has_value());
+
+    hl7_flat_message copy = *msg;
+    copy.set_value("PID.5.1", "SMITH");
+
+    EXPECT_EQ(msg->get_value("PID.5.1"), "DOE");
+    EXPECT_EQ(copy.get_value("PID.5.1"), "SMITH");
+    EXPECT_EQ(copy.get_value("PID.5.2"), "JOHN");
+}
+
+TEST(HL7FlatMessageTest, SerializeUnmodifiedNormalizesTerminators) {
+    std::string raw(hl7_samples::ACK_AA);
+    for (auto& c : raw) {
+        if (c == '\r') c = '\n';
+    }
+    auto msg = hl7_flat_message::parse(raw);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->serialize(), hl7_samples::ACK_AA);
+}
+
+// =============================================================================
+// Allocation Budget
+// =============================================================================
+
+TEST(HL7FlatMessageTest, ParseAllocatesOrderOfMagnitudeLess) {
+    std::string raw(hl7_samples::ORU_R01);
+    for (int i = 0; i < 20; ++i) {
+        raw += "OBX|" + std::to_string(i + 2) +
+               "|TX|GDT^REPORT^L||Line of report text^with^components||||||F\r";
+    }
+
+    size_t before = g_allocation_count.load();
+    {
+        auto dom = hl7_message::parse(raw);
+        ASSERT_TRUE(dom.has_value());
+    }
+    const size_t tree_allocations = g_allocation_count.load() - before;
+
+    before = g_allocation_count.load();
+    {
+        auto flat = hl7_flat_message::parse(raw);
+        ASSERT_TRUE(flat.has_value());
+    }
+    const size_t flat_allocations = g_allocation_count.load() - before;
+
+    // Buffer copy + arena block, independent of message size
+    EXPECT_LE(flat_allocations, 2u);
+    EXPECT_GE(tree_allocations, flat_allocations * 10);
+}
+
+}  // namespace
+}  // namespace pacs::bridge::hl7
@@ -16,8 +16,13 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <future>
 #include <latch>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <vector>
 
 using namespace pacs::bridge::messaging;
 using namespace pacs::bridge::hl7;
@@ -235,6 +240,147 @@ TEST_F(MessagingPatternTest, Unsubscribe) {
     bus.stop();
 }
 
+TEST_F(MessagingPatternTest, WildcardPatternsMatchLikeBefore) {
+    hl7_message_bus bus;
+    (void)bus.start();
+
+    std::atomic<int> exact{0}, single{0}, multi{0}, other_type{0}, deep{0};
+    auto count = [](std::atomic<int>& counter) {
+        return [&counter](const hl7_message&) {
+            counter++;
+            return subscription_result::ok();
+        };
+    };
+
+    (void)bus.subscribe("hl7.adt.a01", count(exact));
+    (void)bus.subscribe("hl7.adt.*", count(single));
+    (void)bus.subscribe("hl7.#", count(multi));
+    (void)bus.subscribe("hl7.orm.*", count(other_type));
+    (void)bus.subscribe("hl7.*", count(deep));
+
+    (void)bus.publish(test_message_);
+
+    EXPECT_EQ(exact.load(), 1);
+    EXPECT_EQ(single.load(), 1);
+    EXPECT_EQ(multi.load(), 1);
+    EXPECT_EQ(other_type.load(), 0);
+    EXPECT_EQ(deep.load(), 0) << "'*' matches a single level only";
+
+    EXPECT_TRUE(bus.has_subscribers("hl7.adt.a08"));
+    EXPECT_TRUE(bus.has_subscribers("hl7.siu.s12"));
+    EXPECT_FALSE(bus.has_subscribers("fhir.patient"));
+
+    bus.stop();
+}
+
+TEST_F(MessagingPatternTest, DeliveryFollowsPriorityAndStopPropagation) {
+    hl7_message_bus bus;
+    (void)bus.start();
+
+    std::vector<std::string> order;
+    (void)bus.subscribe(topics::HL7_ALL, [&](const hl7_message&) {
+        order.push_back("low");
+        return subscription_result::ok();
+    }, nullptr, 1);
+    (void)bus.subscribe(topics::HL7_ADT_ALL, [&](const hl7_message&) {
+        order.push_back("high");
+        return subscription_result::ok();
+    }, nullptr, 10);
+    (void)bus.subscribe("hl7.adt.a01", [&](const hl7_message&) {
+        order.push_back("normal");
+        return subscription_result::stop();
+    });
+
+    (void)bus.publish(test_message_);
+
+    ASSERT_EQ(order.size(), 2u);
+    EXPECT_EQ(order[0], "high");
+    EXPECT_EQ(order[1], "normal");
+
+    bus.stop();
+}
+
+TEST_F(MessagingPatternTest, SharedSubscribersReceiveOneHandle) {
+    hl7_message_bus bus;
+    (void)bus.start();
+
+    std::vector<message_ptr> received;
+    for (int i = 0; i < 3; ++i) {
+        (void)bus.subscribe_shared(topics::HL7_ADT_ALL,
+            [&](const message_ptr& msg) {
+                received.push_back(msg);
+                return subscription_result::ok();
+            });
+    }
+
+    (void)bus.publish(test_message_);
+    ASSERT_EQ(received.size(), 3u);
+    EXPECT_EQ(received[0].get(), received[1].get());
+    EXPECT_EQ(received[1].get(), received[2].get());
+
+    received.clear();
+    auto shared = std::make_shared<const hl7_message>(test_message_);
+    (void)bus.publish(shared);
+    ASSERT_EQ(received.size(), 3u);
+    EXPECT_EQ(received[0].get(), shared.get()) << "Published handle is passed through";
+
+    EXPECT_FALSE(bus.publish(message_ptr{}).has_value());
+
+    bus.stop();
+}
+
+TEST_F(MessagingPatternTest, ConcurrentPublishWhileSubscribing) {
+    hl7_message_bus bus;
+    (void)bus.start();
+
+    std::atomic<int> delivered{0};
+    (void)bus.subscribe(topics::HL7_ALL, [&](const hl7_message&) {
+        delivered++;
+        return subscription_result::ok();
+    });
+
+    constexpr int publishers = 4;
+    constexpr int per_publisher = 500;
+    std::atomic<bool> done{false};
+
+    std::thread churn([&] {
+        while (!done) {
+            auto handle = bus.subscribe(topics::HL7_ORM_ALL,
+                [](const hl7_message&) { return subscription_result::ok(); });
+            if (handle) {
+                (void)bus.unsubscribe(*handle);
+            }
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < publishers; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < per_publisher; ++i) {
+                (void)bus.publish(test_message_);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    done = true;
+    churn.join();
+
+    EXPECT_EQ(delivered.load(), publishers * per_publisher);
+    auto stats = bus.get_statistics();
+    EXPECT_EQ(stats.messages_published,
+              static_cast<uint64_t>(publishers * per_publisher));
+    EXPECT_EQ(stats.messages_delivered,
+              static_cast<uint64_t>(publishers * per_publisher));
+    ASSERT_EQ(stats.topic_counts.size(), 1u);
+    EXPECT_EQ(stats.topic_counts[0].first, "hl7.adt.a01");
+    EXPECT_EQ(stats.topic_counts[0].second,
+              static_cast<uint64_t>(publishers * per_publisher));
+
+    bus.stop();
+}
+
 // =============================================================================
 // HL7 Publisher/Subscriber Wrapper Tests
 // =============================================================================
@@ -430,6 +576,152 @@ TEST_F(MessagingPatternTest, PipelineBuilderWithTransformer) {
     EXPECT_EQ(result->get_value("ZPI.1"), "ENRICHED");
 }
 
+TEST_F(MessagingPatternTest, StagedPipelineProcessesAllMessages) {
+    std::atomic<int> validated{0};
+    auto pipeline = hl7_pipeline_builder::create("staged_pipeline")
+        .staged()
+        .add_validator("validate", [&](const hl7_message&) {
+            validated++;
+            return true;
+        }).with_workers(2, 16)
+        .add_transformer("enrich", [](const hl7_message& msg) {
+            auto enriched = msg;
+            enriched.set_value("ZPI.1", "ENRICHED");
+            return enriched;
+        })
+        .build();
+
+    std::vector<std::future<std::expected<hl7_message, pipeline_error>>> results;
+    for (int i = 0; i < 100; ++i) {
+        results.push_back(pipeline.submit(test_message_));
+    }
+
+    for (auto& result : results) {
+        auto processed = result.get();
+        ASSERT_TRUE(processed.has_value());
+        EXPECT_EQ(processed->get_value("ZPI.1"), "ENRICHED");
+    }
+    EXPECT_EQ(validated.load(), 100);
+    EXPECT_EQ(pipeline.in_flight(), 0u);
+
+    auto stats = pipeline.get_statistics();
+    EXPECT_EQ(stats.messages_processed, 100u);
+    ASSERT_EQ(stats.stage_statistics.size(), 2u);
+    for (const auto& stage : stats.stage_statistics) {
+        EXPECT_EQ(stage.invocations, 100u);
+        EXPECT_GT(stage.queue_capacity, 0u);
+    }
+
+    pipeline.stop();
+}
+
+TEST_F(MessagingPatternTest, StagedPipelineRetriesWithoutBlockingCaller) {
+    std::atomic<int> attempts{0};
+    auto pipeline = hl7_pipeline_builder::create("retry_pipeline")
+        .staged()
+        .add_processor("flaky", [&](const hl7_message&) {
+            return ++attempts < 3 ? stage_result::error("transient")
+                                  : stage_result::ok();
+        })
+        .with_retry(3, std::chrono::milliseconds{50})
+        .build();
+
+    auto start = std::chrono::steady_clock::now();
+    auto result = pipeline.submit(test_message_);
+    auto submit_time = std::chrono::steady_clock::now() - start;
+    EXPECT_LT(submit_time, std::chrono::milliseconds{50})
+        << "submit() should not wait for retries";
+
+    auto processed = result.get();
+    EXPECT_TRUE(processed.has_value());
+    EXPECT_EQ(attempts.load(), 3);
+
+    auto stats = pipeline.get_statistics();
+    ASSERT_EQ(stats.stage_statistics.size(), 1u);
+    EXPECT_EQ(stats.stage_statistics[0].retries, 2u);
+
+    pipeline.stop();
+}
+
+TEST_F(MessagingPatternTest, StagedPipelineReportsStageFailure) {
+    auto pipeline = hl7_pipeline_builder::create("failing_pipeline")
+        .staged()
+        .add_processor("fail", [](const hl7_message&) {
+            return stage_result::error("boom");
+        })
+        .build();
+
+    auto result = pipeline.submit(test_message_).get();
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), pipeline_error::stage_failed);
+    EXPECT_EQ(pipeline.get_statistics().messages_failed, 1u);
+
+    pipeline.stop();
+}
+
+TEST_F(MessagingPatternTest, StagedPipelineAppliesBackpressure) {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool release = false;
+
+    pipeline_config config;
+    config.execution = pipeline_execution::staged;
+    config.enqueue_timeout = std::chrono::milliseconds{10};
+    hl7_pipeline pipeline(config);
+
+    pipeline_stage blocked;
+    blocked.id = "blocked";
+    blocked.queue_capacity = 2;
+    blocked.processor = [&](const hl7_message&) {
+        std::unique_lock lock(mutex);
+        cv.wait(lock, [&] { return release; });
+        return stage_result::ok();
+    };
+    ASSERT_TRUE(pipeline.add_stage(blocked).has_value());
+
+    // One message is held by the worker; the queue holds two more
+    std::vector<std::future<std::expected<hl7_message, pipeline_error>>> accepted;
+    bool rejected = false;
+    for (int i = 0; i < 10 && !rejected; ++i) {
+        auto result = pipeline.submit(test_message_);
+        if (result.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            auto value = result.get();
+            ASSERT_FALSE(value.has_value());
+            EXPECT_EQ(value.error(), pipeline_error::queue_full);
+            rejected = true;
+        } else {
+            accepted.push_back(std::move(result));
+        }
+    }
+    EXPECT_TRUE(rejected) << "A full first stage should reject submissions";
+
+    auto stats = pipeline.get_statistics();
+    ASSERT_EQ(stats.stage_statistics.size(), 1u);
+    EXPECT_EQ(stats.stage_statistics[0].queue_capacity, 2u);
+    EXPECT_GT(stats.stage_statistics[0].queue_full_events, 0u);
+
+    {
+        std::lock_guard lock(mutex);
+        release = true;
+    }
+    cv.notify_all();
+
+    for (auto& result : accepted) {
+        EXPECT_TRUE(result.get().has_value());
+    }
+    pipeline.stop();
+}
+
+TEST_F(MessagingPatternTest, SynchronousSubmitProcessesInline) {
+    auto pipeline = hl7_pipeline_builder::create("sync_pipeline")
+        .add_processor("ok", [](const hl7_message&) { return stage_result::ok(); })
+        .build();
+
+    auto result = pipeline.submit(test_message_);
+    ASSERT_EQ(result.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_TRUE(result.get().has_value());
+}
+
 // =============================================================================
 // ACK Builder Tests
 // =============================================================================
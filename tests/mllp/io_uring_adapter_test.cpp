@@ -0,0 +1,458 @@
+/**
+ * @file io_uring_adapter_test.cpp
+ * @brief Integration tests for the io_uring MLLP network adapter
+ *
+ * Tests io_uring implementation over loopback:
+ * - Server lifecycle
+ * - Blocking and push-mode receive
+ * - Ordered asynchronous sends
+ * - Idle timeout and close notification
+ * - mllp_server / mllp_client round trips over io_uring
+ *
+ * Tests are skipped when the running kernel lacks io_uring support.
+ */
+
+#include "src/mllp/io_uring_mllp_server.h"
+
+#include "pacs/bridge/mllp/mllp_client.h"
+#include "pacs/bridge/mllp/mllp_server.h"
+
+#include <gtest/gtest.h>
+
+#ifdef PACS_BRIDGE_HAS_IO_URING
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace pacs::bridge::mllp::test {
+
+// =============================================================================
+// Test Utilities
+// =============================================================================
+
+/**
+ * @brief Generate unique port number for test isolation
+ */
+static uint16_t generate_test_port() {
+    static std::atomic<uint16_t> port_counter{16000};
+    return port_counter.fetch_add(1);
+}
+
+/**
+ * @brief Wait for condition with timeout
+ */
+template <typename Predicate>
+bool wait_for(Predicate condition, std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+/**
+ * @brief Connect a blocking loopback client socket
+ */
+static int connect_client(uint16_t port) {
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/**
+ * @brief Read exactly count bytes, or fewer if the peer closes
+ */
+static std::string read_exactly(int fd, size_t count) {
+    std::string result;
+    char buffer[4096];
+    while (result.size() < count) {
+        ssize_t n = ::recv(fd, buffer, std::min(sizeof(buffer), count - result.size()), 0);
+        if (n <= 0) {
+            break;
+        }
+        result.append(buffer, static_cast<size_t>(n));
+    }
+    return result;
+}
+
+/**
+ * @brief Test fixture for io_uring adapter tests
+ */
+class IoUringAdapterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!io_uring_ring::supported()) {
+            GTEST_SKIP() << "io_uring not supported by this kernel";
+        }
+        test_port_ = generate_test_port();
+    }
+
+    void TearDown() override {
+        if (server_) {
+            server_->stop(true);
+            server_.reset();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    /**
+     * @brief Create and start test server
+     */
+    std::unique_ptr<io_uring_mllp_server> create_server(uint16_t port) {
+        server_config config;
+        config.port = port;
+        config.backlog = 64;
+
+        auto server = std::make_unique<io_uring_mllp_server>(config);
+        server->on_connection([this](std::unique_ptr<mllp_session> session) {
+            on_new_connection(std::move(session));
+        });
+
+        auto result = server->start();
+        EXPECT_TRUE(result.has_value()) << "Server failed to start";
+        return server;
+    }
+
+    virtual void on_new_connection(std::unique_ptr<mllp_session> session) {
+        std::lock_guard<std::mutex> lock(sessions_mutex_);
+        sessions_.push_back(std::move(session));
+        sessions_cv_.notify_all();
+    }
+
+    bool wait_for_sessions(size_t count, std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(sessions_mutex_);
+        return sessions_cv_.wait_for(lock, timeout,
+                                      [this, count] { return sessions_.size() >= count; });
+    }
+
+    mllp_session* session_at(size_t index) {
+        std::lock_guard<std::mutex> lock(sessions_mutex_);
+        return sessions_.at(index).get();
+    }
+
+    uint16_t test_port_ = 0;
+    std::unique_ptr<io_uring_mllp_server> server_;
+    std::vector<std::unique_ptr<mllp_session>> sessions_;
+    std::mutex sessions_mutex_;
+    std::condition_variable sessions_cv_;
+};
+
+// =============================================================================
+// Server Lifecycle Tests
+// =============================================================================
+
+TEST_F(IoUringAdapterTest, ServerStartAndStop) {
+    server_ = create_server(test_port_);
+
+    EXPECT_TRUE(server_->is_running());
+    EXPECT_EQ(test_port_, server_->port());
+
+    server_->stop();
+
+    EXPECT_FALSE(server_->is_running());
+}
+
+TEST_F(IoUringAdapterTest, ServerStartOnInvalidPort) {
+    server_config config;
+    config.port = 0;
+
+    server_ = std::make_unique<io_uring_mllp_server>(config);
+    auto result = server_->start();
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(network_error::invalid_config, result.error());
+}
+
+TEST_F(IoUringAdapterTest, AcceptsManyConnections) {
+    server_ = create_server(test_port_);
+
+    constexpr size_t count = 32;
+    std::vector<int> clients;
+    for (size_t i = 0; i < count; ++i) {
+        int fd = connect_client(test_port_);
+        ASSERT_GE(fd, 0);
+        clients.push_back(fd);
+    }
+
+    ASSERT_TRUE(wait_for_sessions(count, std::chrono::seconds(5)));
+    EXPECT_EQ(count, server_->active_session_count());
+    EXPECT_EQ("127.0.0.1", session_at(0)->remote_address());
+
+    for (int fd : clients) {
+        ::close(fd);
+    }
+}
+
+// =============================================================================
+// Data Transfer Tests
+// =============================================================================
+
+TEST_F(IoUringAdapterTest, BlockingReceiveAndSend) {
+    server_ = create_server(test_port_);
+
+    int client = connect_client(test_port_);
+    ASSERT_GE(client, 0);
+    ASSERT_TRUE(wait_for_sessions(1, std::chrono::seconds(5)));
+    auto* session = session_at(0);
+
+    const std::string message = "Hello io_uring MLLP server";
+    ASSERT_EQ(static_cast<ssize_t>(message.size()),
+              ::send(client, message.data(), message.size(), 0));
+
+    auto received = session->receive(1024, std::chrono::seconds(5));
+    ASSERT_TRUE(received.has_value());
+    EXPECT_EQ(message, std::string(received->begin(), received->end()));
+
+    auto sent = session->send(*received);
+    ASSERT_TRUE(sent.has_value());
+    EXPECT_EQ(message.size(), *sent);
+    EXPECT_EQ(message, read_exactly(client, message.size()));
+
+    EXPECT_TRUE(wait_for([&] { return session->get_stats().bytes_sent == message.size(); },
+                         std::chrono::seconds(2)));
+    EXPECT_EQ(message.size(), session->get_stats().bytes_received);
+
+    ::close(client);
+}
+
+TEST_F(IoUringAdapterTest, AsyncReceiveDeliversDataAndClose) {
+    server_ = create_server(test_port_);
+
+    int client = connect_client(test_port_);
+    ASSERT_GE(client, 0);
+    ASSERT_TRUE(wait_for_sessions(1, std::chrono::seconds(5)));
+    auto* session = session_at(0);
+
+    std::mutex mutex;
+    std::string received;
+    std::atomic<bool> closed{false};
+    std::atomic<int> close_reason{0};
+
+    ASSERT_TRUE(session->start_async_receive(
+        [&](std::span<const uint8_t> data) {
+            std::lock_guard<std::mutex> lock(mutex);
+            received.append(data.begin(), data.end());
+        },
+        [&](network_error reason) {
+            close_reason = static_cast<int>(reason);
+            closed = true;
+        },
+        std::chrono::milliseconds{0}));
+
+    // Push mode owns the socket
+    EXPECT_FALSE(session->start_async_receive(nullptr, nullptr,
+                                              std::chrono::milliseconds{0}));
+    EXPECT_FALSE(session->receive(16, std::chrono::milliseconds(10)).has_value());
+
+    // Larger than one provided buffer
+    const std::string payload(100 * 1024, 'x');
+    std::thread writer([&] {
+        size_t sent = 0;
+        while (sent < payload.size()) {
+            ssize_t n = ::send(client, payload.data() + sent, payload.size() - sent, 0);
+            if (n <= 0) {
+                break;
+            }
+            sent += static_cast<size_t>(n);
+        }
+    });
+    writer.join();
+
+    EXPECT_TRUE(wait_for(
+        [&] {
+            std::lock_guard<std::mutex> lock(mutex);
+            return received.size() == payload.size();
+        },
+        std::chrono::seconds(5)));
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        EXPECT_EQ(payload, received);
+    }
+
+    ::close(client);
+    ASSERT_TRUE(wait_for([&] { return closed.load(); }, std::chrono::seconds(5)));
+    EXPECT_EQ(static_cast<int>(network_error::connection_closed), close_reason.load());
+    EXPECT_FALSE(session->is_open());
+}
+
+TEST_F(IoUringAdapterTest, AsyncSendsArriveInOrder) {
+    server_ = create_server(test_port_);
+
+    int client = connect_client(test_port_);
+    ASSERT_GE(client, 0);
+    ASSERT_TRUE(wait_for_sessions(1, std::chrono::seconds(5)));
+    auto* session = session_at(0);
+
+    std::string expected;
+    for (int i = 0; i < 200; ++i) {
+        std::string chunk = "ACK-" + std::to_string(i) + "|";
+        expected += chunk;
+        std::vector<uint8_t> bytes(chunk.begin(), chunk.end());
+        ASSERT_TRUE(session->send(bytes).has_value());
+    }
+
+    EXPECT_EQ(expected, read_exactly(client, expected.size()));
+    ::close(client);
+}
+
+TEST_F(IoUringAdapterTest, IdleTimeoutClosesSession) {
+    server_ = create_server(test_port_);
+
+    int client = connect_client(test_port_);
+    ASSERT_GE(client, 0);
+    ASSERT_TRUE(wait_for_sessions(1, std::chrono::seconds(5)));
+    auto* session = session_at(0);
+
+    std::atomic<bool> closed{false};
+    std::atomic<int> close_reason{0};
+    ASSERT_TRUE(session->start_async_receive(
+        [](std::span<const uint8_t>) {},
+        [&](network_error reason) {
+            close_reason = static_cast<int>(reason);
+            closed = true;
+        },
+        std::chrono::milliseconds{300}));
+
+    ASSERT_TRUE(wait_for([&] { return closed.load(); }, std::chrono::seconds(5)));
+    EXPECT_EQ(static_cast<int>(network_error::timeout), close_reason.load());
+
+    // The peer observes the shutdown
+    char byte = 0;
+    EXPECT_EQ(0, ::recv(client, &byte, 1, 0));
+    ::close(client);
+}
+
+TEST_F(IoUringAdapterTest, StopNotifiesOpenSessions) {
+    server_ = create_server(test_port_);
+
+    int client = connect_client(test_port_);
+    ASSERT_GE(client, 0);
+    ASSERT_TRUE(wait_for_sessions(1, std::chrono::seconds(5)));
+
+    std::atomic<bool> closed{false};
+    ASSERT_TRUE(session_at(0)->start_async_receive(
+        [](std::span<const uint8_t>) {}, [&](network_error) { closed = true; },
+        std::chrono::milliseconds{0}));
+
+    server_->stop();
+    EXPECT_TRUE(closed.load());
+    EXPECT_FALSE(session_at(0)->is_open());
+    ::close(client);
+}
+
+// =============================================================================
+// MLLP Server / Client Tests
+// =============================================================================
+
+TEST_F(IoUringAdapterTest, MllpRoundTripOverIoUring) {
+    const std::string ack =
+        "MSH|^~\\&|PACS|RADIOLOGY|HIS|HOSPITAL|20240115110001||ACK^O01|ACK001|P|2.4\r"
+        "MSA|AA|MSG001\r";
+
+    mllp_server_config server_config;
+    server_config.port = test_port_;
+    server_config.io_model = mllp_io_model::io_uring;
+    server_config.worker_threads = 2;
+
+    mllp_server server(server_config);
+    std::atomic<size_t> handled{0};
+    server.set_message_handler(
+        [&](const mllp_message&, const mllp_session_info&) -> std::optional<mllp_message> {
+            handled++;
+            return mllp_message::from_string(ack);
+        });
+    ASSERT_TRUE(server.start().has_value());
+
+    mllp_client_config client_config;
+    client_config.host = "127.0.0.1";
+    client_config.port = test_port_;
+    client_config.use_io_uring = true;
+    client_config.io_timeout = std::chrono::seconds(5);
+
+    mllp_client client(client_config);
+    ASSERT_TRUE(client.connect().has_value());
+
+    const std::string orm =
+        "MSH|^~\\&|HIS|HOSPITAL|PACS|RADIOLOGY|20240115110000||ORM^O01|MSG001|P|2.4\r"
+        "PID|1||12345^^^HOSPITAL^MR||DOE^JOHN||19800515|M\r";
+
+    for (int i = 0; i < 50; ++i) {
+        auto result = client.send(orm);
+        ASSERT_TRUE(result.has_value()) << "round trip " << i;
+        EXPECT_EQ(ack, result->response.to_string());
+    }
+    EXPECT_EQ(50u, handled.load());
+
+    // Responses larger than one read are reassembled
+    const std::string large_ack = ack + "NTE|1||" + std::string(20000, 'n') + "\r";
+    server.set_message_handler(
+        [&](const mllp_message&, const mllp_session_info&) -> std::optional<mllp_message> {
+            return mllp_message::from_string(large_ack);
+        });
+    auto large = client.send(orm);
+    ASSERT_TRUE(large.has_value());
+    EXPECT_EQ(large_ack, large->response.to_string());
+
+    client.disconnect();
+    server.stop();
+}
+
+TEST_F(IoUringAdapterTest, ClientTimesOutWithoutResponse) {
+    mllp_server_config server_config;
+    server_config.port = test_port_;
+    server_config.io_model = mllp_io_model::io_uring;
+
+    mllp_server server(server_config);
+    server.set_message_handler(
+        [](const mllp_message&, const mllp_session_info&) -> std::optional<mllp_message> {
+            return std::nullopt;
+        });
+    ASSERT_TRUE(server.start().has_value());
+
+    mllp_client_config client_config;
+    client_config.host = "127.0.0.1";
+    client_config.port = test_port_;
+    client_config.use_io_uring = true;
+    client_config.io_timeout = std::chrono::milliseconds(200);
+    client_config.retry_count = 0;
+
+    mllp_client client(client_config);
+    ASSERT_TRUE(client.connect().has_value());
+
+    auto start = std::chrono::steady_clock::now();
+    auto result = client.send(std::string_view("MSH|^~\\&|HIS|H|PACS|R|20240115||ADT^A01|1|P|2.4\r"));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_FALSE(result.has_value());
+    EXPECT_LT(elapsed, std::chrono::seconds(2));
+
+    client.disconnect();
+    server.stop();
+}
+
+}  // namespace pacs::bridge::mllp::test
+
+#endif  // PACS_BRIDGE_HAS_IO_URING
@@ -12,15 +12,22 @@
  */
 
 #include "pacs/bridge/mllp/mllp_client.h"
+#include "pacs/bridge/mllp/mllp_frame_scanner.h"
 #include "pacs/bridge/mllp/mllp_server.h"
 #include "pacs/bridge/mllp/mllp_types.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <chrono>
+#include <cstdio>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <span>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace pacs::bridge::mllp::test {
 
@@ -145,6 +152,138 @@ bool test_mllp_message_framing() {
     return true;
 }
 
+// =============================================================================
+// Frame Scanner Tests
+// =============================================================================
+
+/**
+ * @brief Feed bytes in fixed-size chunks and collect completed payloads
+ */
+std::vector<std::string> scan_in_chunks(mllp_frame_scanner& scanner,
+                                        const std::vector<uint8_t>& stream,
+                                        size_t chunk_size) {
+    std::vector<std::string> frames;
+    for (size_t offset = 0; offset < stream.size(); offset += chunk_size) {
+        std::span<const uint8_t> input(
+            stream.data() + offset, std::min(chunk_size, stream.size() - offset));
+        while (!input.empty()) {
+            auto frame = scanner.next_frame(input);
+            if (!frame) {
+                return frames;
+            }
+            if (*frame) {
+                frames.emplace_back((*frame)->begin(), (*frame)->end());
+            }
+        }
+    }
+    return frames;
+}
+
+bool test_frame_scanner_single_frame() {
+    auto framed = mllp_message::from_string("MSH|^~\\&|TEST\r").frame();
+
+    mllp_frame_scanner scanner;
+    std::span<const uint8_t> input(framed);
+    auto frame = scanner.next_frame(input);
+
+    TEST_ASSERT(frame.has_value(), "Scan should succeed");
+    TEST_ASSERT(frame->has_value(), "Frame should be complete");
+    TEST_ASSERT(std::string((*frame)->begin(), (*frame)->end()) ==
+                    "MSH|^~\\&|TEST\r",
+                "Payload should exclude framing bytes");
+    TEST_ASSERT(input.empty(), "All input should be consumed");
+    TEST_ASSERT(!scanner.in_frame(), "Scanner should be idle");
+
+    return true;
+}
+
+bool test_frame_scanner_fragmented() {
+    std::vector<uint8_t> stream;
+    for (const char* text : {"MSH|A\r", "MSH|B\x1C|\r", "MSH|C\r"}) {
+        auto framed = mllp_message::from_string(text).frame();
+        stream.insert(stream.end(), framed.begin(), framed.end());
+        // Noise between frames is discarded
+        stream.push_back('x');
+    }
+
+    // Every split point, including between FS and CR
+    for (size_t chunk_size : {1u, 2u, 3u, 7u, 64u}) {
+        mllp_frame_scanner scanner;
+        auto frames = scan_in_chunks(scanner, stream, chunk_size);
+        TEST_ASSERT(frames.size() == 3, "Should extract three frames");
+        TEST_ASSERT(frames[0] == "MSH|A\r", "First payload should match");
+        TEST_ASSERT(frames[1] == "MSH|B\x1C|\r",
+                    "Lone FS should remain in payload");
+        TEST_ASSERT(frames[2] == "MSH|C\r", "Third payload should match");
+        TEST_ASSERT(!scanner.in_frame(), "No partial frame should remain");
+    }
+
+    return true;
+}
+
+bool test_frame_scanner_large_message() {
+    // 5 MB payload arriving in 8 KB reads
+    std::string payload = "MSH|^~\\&|RIS\rOBX|1|ED|PDF||";
+    payload.append(5 * 1024 * 1024, 'A');
+    payload += "\r";
+    auto stream = mllp_message::from_string(payload).frame();
+
+    mllp_frame_scanner scanner;
+    auto start = std::chrono::steady_clock::now();
+    auto frames = scan_in_chunks(scanner, stream, 8192);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    TEST_ASSERT(frames.size() == 1, "Should extract one frame");
+    TEST_ASSERT(frames[0] == payload, "Payload should be intact");
+    TEST_ASSERT(elapsed < std::chrono::seconds{1},
+                "Scan should be linear in message size");
+
+    return true;
+}
+
+bool test_frame_scanner_size_limit() {
+    std::string payload(100, 'A');
+    auto stream = mllp_message::from_string(payload).frame();
+
+    mllp_frame_scanner scanner(64);
+    std::span<const uint8_t> input(stream);
+    auto frame = scanner.next_frame(input);
+    TEST_ASSERT(!frame.has_value(), "Oversized frame should fail");
+    TEST_ASSERT(frame.error() == mllp_error::message_too_large,
+                "Error should be message_too_large");
+    TEST_ASSERT(!scanner.in_frame(), "Scanner should reset after error");
+
+    // Scanner remains usable
+    auto small = mllp_message::from_string("MSH|OK").frame();
+    input = small;
+    frame = scanner.next_frame(input);
+    TEST_ASSERT(frame && *frame, "Next frame should be accepted");
+
+    return true;
+}
+
+bool test_frame_scanner_recycle() {
+    auto first = mllp_message::from_string("MSH|FIRST|MESSAGE").frame();
+    auto second = mllp_message::from_string("MSH|2").frame();
+
+    mllp_frame_scanner scanner;
+    std::span<const uint8_t> input(first);
+    auto frame = scanner.next_frame(input);
+    TEST_ASSERT(frame && *frame, "First frame should complete");
+
+    std::vector<uint8_t> content = std::move(**frame);
+    const uint8_t* storage = content.data();
+    scanner.recycle(std::move(content));
+
+    input = second;
+    frame = scanner.next_frame(input);
+    TEST_ASSERT(frame && *frame, "Second frame should complete");
+    TEST_ASSERT((*frame)->data() == storage,
+                "Recycled buffer should hold the next payload");
+
+    return true;
+}
+
 // =============================================================================
 // Configuration Tests
 // =============================================================================
@@ -170,6 +309,15 @@ bool test_server_config_validation() {
     TEST_ASSERT(!config.is_valid(), "0 max_message_size should be invalid");
     config.max_message_size = MLLP_MAX_MESSAGE_SIZE;
 
+    // Event-loop thread counts
+    config.reactor_threads = 0;
+    TEST_ASSERT(!config.is_valid(), "0 reactor_threads should be invalid");
+    config.reactor_threads = 1;
+
+    config.worker_threads = 0;
+    TEST_ASSERT(!config.is_valid(), "0 worker_threads should be invalid");
+    config.worker_threads = 4;
+
     // TLS enabled but invalid
     config.tls.enabled = true;
     TEST_ASSERT(!config.is_valid(), "TLS without certs should be invalid");
@@ -555,6 +703,187 @@ bool test_server_client_communication() {
     return true;
 }
 
+bool test_server_receives_large_message() {
+    mllp_server_config server_config;
+    server_config.port = 12601;
+
+    mllp_server server(server_config);
+
+    std::atomic<size_t> received_size{0};
+    server.set_message_handler(
+        [&received_size](const mllp_message& msg,
+                         const mllp_session_info& /*session*/)
+            -> std::optional<mllp_message> {
+            received_size = msg.content.size();
+            return mllp_message::from_string(
+                "MSH|^~\\&|PACS|RADIOLOGY|RIS|HOSPITAL|20240115103001||ACK|ACK001|P|2.4\r"
+                "MSA|AA|MSG100\r");
+        });
+
+    auto start_result = server.start();
+    if (!start_result.has_value()) {
+        std::cout << "  (skipped - port may be in use)" << std::endl;
+        return true;
+    }
+
+    mllp_client_config client_config;
+    client_config.host = "localhost";
+    client_config.port = 12601;
+    client_config.connect_timeout = std::chrono::milliseconds{5000};
+
+    mllp_client client(client_config);
+    TEST_ASSERT(client.connect().has_value(), "Client should connect");
+
+    // 2 MB report arrives over many reads
+    std::string hl7_msg =
+        "MSH|^~\\&|RIS|RADIOLOGY|PACS|HOSPITAL|20240115150000||ORU^R01|MSG100|P|2.4\r"
+        "OBX|1|ED|PDF||";
+    hl7_msg.append(2 * 1024 * 1024, 'A');
+    hl7_msg += "\r";
+
+    auto send_result = client.send(mllp_message::from_string(hl7_msg));
+    TEST_ASSERT(send_result.has_value(), "Send should succeed");
+    TEST_ASSERT(received_size == hl7_msg.size(),
+                "Server should receive the complete message");
+
+    client.disconnect();
+    server.stop(true, std::chrono::seconds{5});
+
+    return true;
+}
+
+bool test_event_loop_concurrent_clients() {
+    mllp_server_config server_config;
+    server_config.port = 12602;
+    server_config.io_model = mllp_io_model::event_loop;
+    server_config.reactor_threads = 1;
+    server_config.worker_threads = 2;
+
+    mllp_server server(server_config);
+
+    // Per-session arrival order of message numbers
+    std::mutex order_mutex;
+    std::map<uint64_t, std::vector<int>> order;
+    server.set_message_handler(
+        [&](const mllp_message& msg, const mllp_session_info& session)
+            -> std::optional<mllp_message> {
+            auto text = msg.to_string();
+            auto pos = text.find("|SEQ");
+            {
+                std::lock_guard lock(order_mutex);
+                order[session.session_id].push_back(
+                    std::stoi(text.substr(pos + 4, 3)));
+            }
+            return mllp_message::from_string(
+                "MSH|^~\\&|PACS|RADIOLOGY|RIS|HOSPITAL|20240115103001||ACK|ACK001|P|2.4\r"
+                "MSA|AA|MSG001\r");
+        });
+
+    auto start_result = server.start();
+    if (!start_result.has_value()) {
+        std::cout << "  (skipped - event loop unavailable or port in use)"
+                  << std::endl;
+        return true;
+    }
+
+    constexpr int client_count = 16;
+    constexpr int messages_per_client = 5;
+    std::atomic<int> acked{0};
+
+    std::vector<std::thread> clients;
+    for (int c = 0; c < client_count; ++c) {
+        clients.emplace_back([&acked] {
+            mllp_client_config client_config;
+            client_config.host = "localhost";
+            client_config.port = 12602;
+            mllp_client client(client_config);
+            if (!client.connect()) {
+                return;
+            }
+            for (int i = 0; i < messages_per_client; ++i) {
+                char seq[8];
+                std::snprintf(seq, sizeof(seq), "%03d", i);
+                auto result = client.send(mllp_message::from_string(
+                    std::string("MSH|^~\\&|RIS|RADIOLOGY|PACS|HOSPITAL|"
+                                "20240115103000||ORM^O01|SEQ") +
+                    seq + "|P|2.4\r"));
+                if (result) {
+                    acked++;
+                }
+            }
+            client.disconnect();
+        });
+    }
+    for (auto& t : clients) {
+        t.join();
+    }
+
+    TEST_ASSERT(acked == client_count * messages_per_client,
+                "Every message should be acknowledged");
+
+    auto stats = server.statistics();
+    TEST_ASSERT(stats.messages_received ==
+                    static_cast<size_t>(client_count * messages_per_client),
+                "Server should count every message");
+    TEST_ASSERT(stats.total_connections == static_cast<size_t>(client_count),
+                "Server should count every connection");
+
+    {
+        std::lock_guard lock(order_mutex);
+        TEST_ASSERT(order.size() == static_cast<size_t>(client_count),
+                    "Each client should have its own session");
+        for (const auto& [id, sequence] : order) {
+            TEST_ASSERT(std::is_sorted(sequence.begin(), sequence.end()),
+                        "Messages should be handled in arrival order per session");
+        }
+    }
+
+    server.stop(true, std::chrono::seconds{5});
+    return true;
+}
+
+bool test_event_loop_idle_timeout() {
+    mllp_server_config server_config;
+    server_config.port = 12603;
+    server_config.io_model = mllp_io_model::event_loop;
+    server_config.idle_timeout = std::chrono::seconds{1};
+
+    mllp_server server(server_config);
+
+    auto start_result = server.start();
+    if (!start_result.has_value()) {
+        std::cout << "  (skipped - event loop unavailable or port in use)"
+                  << std::endl;
+        return true;
+    }
+
+    mllp_client_config client_config;
+    client_config.host = "localhost";
+    client_config.port = 12603;
+    mllp_client client(client_config);
+    TEST_ASSERT(client.connect().has_value(), "Client should connect");
+
+    // Session registers, then is dropped by the reactor's idle sweep
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    bool seen = false;
+    bool closed = false;
+    while (std::chrono::steady_clock::now() < deadline) {
+        auto active = server.statistics().active_connections;
+        seen = seen || active == 1;
+        if (seen && active == 0) {
+            closed = true;
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    }
+    TEST_ASSERT(seen, "Session should become active");
+    TEST_ASSERT(closed, "Idle session should be closed");
+
+    client.disconnect();
+    server.stop(true, std::chrono::seconds{5});
+    return true;
+}
+
 // =============================================================================
 // Main Test Runner
 // =============================================================================
@@ -569,6 +898,13 @@ int run_all_tests() {
     RUN_TEST(test_mllp_message_creation);
     RUN_TEST(test_mllp_message_framing);
 
+    std::cout << "\n=== MLLP Frame Scanner Tests ===" << std::endl;
+    RUN_TEST(test_frame_scanner_single_frame);
+    RUN_TEST(test_frame_scanner_fragmented);
+    RUN_TEST(test_frame_scanner_large_message);
+    RUN_TEST(test_frame_scanner_size_limit);
+    RUN_TEST(test_frame_scanner_recycle);
+
     std::cout << "\n=== MLLP Configuration Tests ===" << std::endl;
     RUN_TEST(test_server_config_validation);
     RUN_TEST(test_client_config_validation);
@@ -597,6 +933,9 @@ int run_all_tests() {
 
     std::cout << "\n=== MLLP Integration Tests ===" << std::endl;
     RUN_TEST(test_server_client_communication);
+    RUN_TEST(test_server_receives_large_message);
+    RUN_TEST(test_event_loop_concurrent_clients);
+    RUN_TEST(test_event_loop_idle_timeout);
 
     std::cout << "\n=== Test Summary ===" << std::endl;
     std::cout << "Passed: " << passed << std::endl;
@@ -6,19 +6,25 @@
  *   - Patient record structure
  *   - FHIR Patient parsing
  *   - Patient matching and disambiguation
- *   - Lookup service operations
+ *   - Lookup service operations (coalescing, refresh-ahead, snapshots)
  *
  * @see https://github.com/kcenon/pacs_bridge/issues/104
  */
 
 #include <gtest/gtest.h>
 
+#include "pacs/bridge/emr/http_client_adapter.h"
 #include "pacs/bridge/emr/patient_lookup.h"
 #include "pacs/bridge/emr/patient_matcher.h"
 #include "pacs/bridge/emr/patient_record.h"
 
+#include <atomic>
 #include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace pacs::bridge::emr;
 using namespace std::chrono_literals;
@@ -737,4 +743,241 @@ TEST_F(LookupConfigTest, DefaultConfig) {
     EXPECT_EQ(config.cache_ttl, 3600s);
     EXPECT_EQ(config.negative_cache_ttl, 300s);
     EXPECT_TRUE(config.auto_disambiguate);
+    EXPECT_DOUBLE_EQ(config.refresh_ahead, 0.0);
+    EXPECT_TRUE(config.snapshot_path.empty());
+}
+
+// =============================================================================
+// Lookup Service Tests
+// =============================================================================
+
+class PatientLookupServiceTest : public ::testing::Test {
+protected:
+    static std::string patient_bundle(const std::string& family) {
+        return R"({
+            "resourceType": "Bundle",
+            "type": "searchset",
+            "total": 1,
+            "entry": [{
+                "resource": {
+                    "resourceType": "Patient",
+                    "id": "123",
+                    "identifier": [{"system": "urn:mrn", "value": "MRN123"}],
+                    "name": [{"family": ")" +
+               family + R"(", "given": ["John"]}]
+                }
+            }]
+        })";
+    }
+
+    static constexpr const char* empty_bundle =
+        R"({"resourceType": "Bundle", "type": "searchset", "total": 0})";
+
+    /** Known patient MRN123; every other MRN is not found */
+    static Result<http_response> emr_response(const http_request& request) {
+        http_response response;
+        response.status = http_status::ok;
+        response.body = request.url.find("MRN123") != std::string::npos
+                            ? patient_bundle("Smith")
+                            : std::string(empty_bundle);
+        return kcenon::common::ok(response);
+    }
+
+    static std::filesystem::path snapshot_path(const std::string& name) {
+        auto path = std::filesystem::temp_directory_path() /
+                    ("pacs_bridge_lookup_test_" + name + ".snap");
+        std::filesystem::remove(path);
+        return path;
+    }
+
+    std::unique_ptr<emr_patient_lookup> create_lookup(
+        callback_http_client::execute_callback callback,
+        const patient_lookup_config& config = {}) {
+        fhir_client_config client_config;
+        client_config.base_url = "https://emr.example.com/fhir";
+        auto client = std::make_shared<fhir_client>(
+            client_config, create_http_client(std::move(callback)));
+        return std::make_unique<emr_patient_lookup>(client, config);
+    }
+};
+
+TEST_F(PatientLookupServiceTest, ConcurrentMissesShareOneQuery) {
+    std::atomic<int> queries{0};
+    auto lookup = create_lookup([&queries](const http_request&)
+                                    -> Result<http_response> {
+        queries.fetch_add(1);
+        // Slow EMR: every thread misses before the query returns
+        std::this_thread::sleep_for(200ms);
+        http_response response;
+        response.status = http_status::ok;
+        response.body = patient_bundle("Smith");
+        return kcenon::common::ok(response);
+    });
+
+    constexpr int num_threads = 8;
+    std::atomic<int> found{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&] {
+            auto result = lookup->get_by_mrn("MRN123");
+            if (result.is_ok() && result.value().family_name() == "Smith") {
+                found.fetch_add(1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto stats = lookup->get_statistics();
+    EXPECT_EQ(queries.load(), 1);
+    EXPECT_EQ(found.load(), num_threads);
+    EXPECT_EQ(stats.total_queries, 1u);
+    EXPECT_EQ(stats.coalesced_queries + stats.cache_hits,
+              static_cast<size_t>(num_threads - 1));
+}
+
+TEST_F(PatientLookupServiceTest, RefreshAheadServesCachedRecord) {
+    std::atomic<int> queries{0};
+    std::atomic<bool> renamed{false};
+    patient_lookup_config config;
+    config.cache_ttl = 2s;
+    config.refresh_ahead = 0.25;
+    auto lookup = create_lookup(
+        [&](const http_request&) -> Result<http_response> {
+            queries.fetch_add(1);
+            http_response response;
+            response.status = http_status::ok;
+            response.body = patient_bundle(renamed.load() ? "Jones" : "Smith");
+            return kcenon::common::ok(response);
+        },
+        config);
+
+    auto first = lookup->get_by_mrn("MRN123");
+    ASSERT_TRUE(first.is_ok());
+    EXPECT_EQ(first.value().family_name(), "Smith");
+
+    // Past a quarter of the TTL a hit returns the cached record and
+    // re-queries the EMR behind it
+    std::this_thread::sleep_for(700ms);
+    renamed.store(true);
+    auto stale = lookup->get_by_mrn("MRN123");
+    ASSERT_TRUE(stale.is_ok());
+    EXPECT_EQ(stale.value().family_name(), "Smith");
+
+    auto deadline = std::chrono::steady_clock::now() + 1s;
+    std::string family;
+    while (std::chrono::steady_clock::now() < deadline) {
+        auto current = lookup->get_by_mrn("MRN123");
+        if (current.is_ok() && (family = current.value().family_name()) == "Jones") {
+            break;
+        }
+        std::this_thread::sleep_for(10ms);
+    }
+
+    EXPECT_EQ(family, "Jones");
+    EXPECT_EQ(queries.load(), 2);
+    EXPECT_EQ(lookup->get_statistics().background_refreshes, 1u);
+}
+
+TEST_F(PatientLookupServiceTest, RefreshAheadDisabled) {
+    std::atomic<int> queries{0};
+    patient_lookup_config config;
+    config.cache_ttl = 2s;
+    config.refresh_ahead = 0.0;
+    auto lookup = create_lookup(
+        [&queries](const http_request&) -> Result<http_response> {
+            queries.fetch_add(1);
+            http_response response;
+            response.status = http_status::ok;
+            response.body = patient_bundle("Smith");
+            return kcenon::common::ok(response);
+        },
+        config);
+
+    ASSERT_TRUE(lookup->get_by_mrn("MRN123").is_ok());
+    std::this_thread::sleep_for(700ms);
+    ASSERT_TRUE(lookup->get_by_mrn("MRN123").is_ok());
+    std::this_thread::sleep_for(100ms);
+
+    EXPECT_EQ(queries.load(), 1);
+    EXPECT_EQ(lookup->get_statistics().background_refreshes, 0u);
+}
+
+TEST_F(PatientLookupServiceTest, SnapshotRestoresCache) {
+    auto path = snapshot_path("restore");
+    {
+        auto source = create_lookup(emr_response);
+        ASSERT_TRUE(source->get_by_mrn("MRN123").is_ok());
+        ASSERT_TRUE(source->get_by_mrn("MRN999").is_err());
+
+        auto saved = source->save_snapshot(path);
+        ASSERT_TRUE(saved.is_ok());
+        EXPECT_EQ(saved.value(), 2u);
+    }
+
+    std::atomic<int> queries{0};
+    auto restored = create_lookup(
+        [&queries](const http_request& request) -> Result<http_response> {
+            queries.fetch_add(1);
+            return emr_response(request);
+        });
+    auto loaded = restored->load_snapshot(path);
+    ASSERT_TRUE(loaded.is_ok());
+    EXPECT_EQ(loaded.value(), 2u);
+
+    auto found = restored->get_by_mrn("MRN123");
+    ASSERT_TRUE(found.is_ok());
+    EXPECT_EQ(found.value().family_name(), "Smith");
+    EXPECT_EQ(found.value().given_name(), "John");
+    EXPECT_TRUE(restored->get_by_mrn("MRN999").is_err());
+
+    EXPECT_EQ(queries.load(), 0);
+    EXPECT_EQ(restored->get_statistics().cache_hits, 2u);
+    EXPECT_EQ(restored->get_statistics().restored_entries, 2u);
+
+    std::filesystem::remove(path);
+}
+
+TEST_F(PatientLookupServiceTest, SnapshotWarmStart) {
+    auto path = snapshot_path("warm_start");
+    {
+        auto source = create_lookup(emr_response);
+        ASSERT_TRUE(source->get_by_mrn("MRN123").is_ok());
+        ASSERT_TRUE(source->save_snapshot(path).is_ok());
+    }
+
+    patient_lookup_config config;
+    config.snapshot_path = path;
+    config.snapshot_interval = 0s;
+    auto restored = create_lookup(emr_response, config);
+
+    auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (restored->get_cache_stats().entries == 0 &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(10ms);
+    }
+    EXPECT_EQ(restored->get_cache_stats().entries, 1u);
+    EXPECT_TRUE(restored->get_by_mrn("MRN123").is_ok());
+    EXPECT_EQ(restored->get_statistics().total_queries, 0u);
+
+    std::filesystem::remove(path);
+}
+
+TEST_F(PatientLookupServiceTest, SnapshotRejectsCorruptFile) {
+    auto path = snapshot_path("corrupt");
+    auto lookup = create_lookup(emr_response);
+
+    EXPECT_TRUE(lookup->load_snapshot(path).is_err());
+
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << std::string(64, 'x');
+    }
+    auto loaded = lookup->load_snapshot(path);
+    ASSERT_TRUE(loaded.is_err());
+    EXPECT_EQ(loaded.error().code, to_error_code(patient_error::cache_failed));
+    EXPECT_EQ(lookup->get_cache_stats().entries, 0u);
+
+    std::filesystem::remove(path);
 }
@@ -13,14 +13,20 @@
 #include "pacs/bridge/performance/lockfree_queue.h"
 #include "pacs/bridge/performance/object_pool.h"
 #include "pacs/bridge/performance/performance_types.h"
+#include "pacs/bridge/performance/small_task.h"
 #include "pacs/bridge/performance/thread_pool_manager.h"
 #include "pacs/bridge/performance/zero_copy_parser.h"
 
+#include <array>
 #include <atomic>
 #include <cassert>
 #include <chrono>
 #include <cstring>
+#include <functional>
+#include <future>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -144,6 +150,197 @@ bool test_lockfree_queue_config_validation() {
     return true;
 }
 
+bool test_lockfree_queue_bounded_fifo() {
+    lockfree_queue_config config;
+    config.capacity = 4;
+    lockfree_queue<std::function<void()>> queue(config);
+
+    int order = 0;
+    for (int i = 0; i < 4; ++i) {
+        TEST_ASSERT(queue.try_push([&order, i] { order = order * 10 + i; }),
+                    "Push within capacity should succeed");
+    }
+    TEST_ASSERT(queue.full(), "Queue should report full");
+    TEST_ASSERT(!queue.try_push([] {}), "Push beyond capacity should fail");
+    TEST_ASSERT(!queue.push([] {}, std::chrono::milliseconds(5)),
+                "Blocking push should time out when full");
+    TEST_ASSERT(queue.statistics().push_failures.load() == 2,
+                "Failed pushes should be counted");
+
+    while (auto task = queue.try_pop()) {
+        (*task)();
+    }
+    TEST_ASSERT(order == 123, "Items should pop in FIFO order");
+    TEST_ASSERT(queue.empty(), "Queue should be empty");
+    TEST_ASSERT(queue.statistics().peak_depth.load() == 4,
+                "Peak depth should be recorded");
+    return true;
+}
+
+bool test_lockfree_queue_mpmc() {
+    lockfree_queue_config config;
+    config.capacity = 64;
+    lockfree_queue<std::function<void()>> queue(config);
+
+    constexpr int producers = 4;
+    constexpr int per_producer = 10000;
+    std::atomic<int> executed{0};
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < 3; ++c) {
+        consumers.emplace_back([&] {
+            while (!done || !queue.empty()) {
+                if (auto task = queue.pop(std::chrono::milliseconds(1))) {
+                    (*task)();
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < per_producer; ++i) {
+                (void)queue.push([&executed] { ++executed; });
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    done = true;
+    for (auto& t : consumers) {
+        t.join();
+    }
+
+    TEST_ASSERT(executed == producers * per_producer,
+                "Every pushed item should be popped exactly once");
+    return true;
+}
+
+bool test_work_stealing_queue_inline_ring() {
+    work_stealing_queue<std::function<void()>> deque(4);
+    TEST_ASSERT(deque.capacity() == 4, "Capacity should be rounded ring size");
+
+    std::vector<int> order;
+    for (int i = 0; i < 4; ++i) {
+        TEST_ASSERT(deque.push([&order, i] { order.push_back(i); }),
+                    "Push should succeed while not full");
+    }
+
+    std::function<void()> extra = [&order] { order.push_back(99); };
+    TEST_ASSERT(!deque.push(std::move(extra)), "Push should fail when full");
+    TEST_ASSERT(static_cast<bool>(extra), "Rejected item should be untouched");
+
+    auto stolen = deque.steal();
+    TEST_ASSERT(stolen.has_value(), "Steal should take an item");
+    (*stolen)();
+    auto popped = deque.pop();
+    TEST_ASSERT(popped.has_value(), "Pop should take an item");
+    (*popped)();
+    TEST_ASSERT(order.size() == 2 && order[0] == 0 && order[1] == 3,
+                "Thieves take the oldest item, the owner the newest");
+
+    TEST_ASSERT(deque.push(std::move(extra)), "Freed slots should be reused");
+    TEST_ASSERT(deque.size() == 3, "Size should track pushes and takes");
+    return true;
+}
+
+bool test_work_stealing_queue_concurrent_steal() {
+    work_stealing_queue<std::function<void()>> deque(64);
+
+    constexpr int total = 20000;
+    std::atomic<int> executed{0};
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; ++t) {
+        thieves.emplace_back([&] {
+            while (!done || !deque.empty()) {
+                if (auto task = deque.steal()) {
+                    (*task)();
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Owner pushes, and pops its own work whenever the ring is full
+    for (int i = 0; i < total; ++i) {
+        std::function<void()> task = [&executed] { ++executed; };
+        while (!deque.push(std::move(task))) {
+            if (auto own = deque.pop()) {
+                (*own)();
+            }
+        }
+    }
+    while (auto own = deque.pop()) {
+        (*own)();
+    }
+    done = true;
+    for (auto& t : thieves) {
+        t.join();
+    }
+
+    TEST_ASSERT(executed == total, "Every pushed item should run exactly once");
+    return true;
+}
+
+bool test_small_task_inline_and_overflow() {
+    int calls = 0;
+    small_task<> small([&calls] { ++calls; });
+    TEST_ASSERT(small.is_inline(), "Small capture should be stored inline");
+
+    std::array<char, 200> payload{};
+    payload[199] = 7;
+    small_task<> large([&calls, payload] { calls += payload[199]; });
+    TEST_ASSERT(!large.is_inline(), "Large capture should overflow");
+
+    small_task<> moved(std::move(large));
+    TEST_ASSERT(!large && moved, "Move should transfer the callable");
+    small();
+    moved();
+    TEST_ASSERT(calls == 8, "Both callables should run");
+
+    small_task<> empty;
+    TEST_ASSERT(!empty, "Default task should be empty");
+    bool threw = false;
+    try {
+        empty();
+    } catch (const std::bad_function_call&) {
+        threw = true;
+    }
+    TEST_ASSERT(threw, "Invoking an empty task should throw");
+    return true;
+}
+
+bool test_small_task_move_only_state() {
+    auto counter = std::make_shared<int>(0);
+    std::promise<int> promise;
+    auto future = promise.get_future();
+    {
+        small_task<> task([promise = std::move(promise),
+                           owned = std::make_unique<int>(41),
+                           counter]() mutable { promise.set_value(*owned + 1); });
+        TEST_ASSERT(counter.use_count() == 2, "Task should own its captures");
+        task();
+    }
+    TEST_ASSERT(future.get() == 42, "Move-only captures should be usable");
+    TEST_ASSERT(counter.use_count() == 1, "Destroying the task releases captures");
+
+    // Overflow blocks freed on another thread are recycled, not leaked
+    std::array<char, 300> payload{};
+    std::vector<small_task<>> tasks;
+    for (int i = 0; i < 500; ++i) {
+        tasks.emplace_back([payload, counter] { (void)payload; });
+    }
+    std::thread([&tasks] { tasks.clear(); }).join();
+    TEST_ASSERT(counter.use_count() == 1, "Overflowed captures are destroyed");
+    return true;
+}
+
 // =============================================================================
 // Object Pool Tests
 // =============================================================================
@@ -403,6 +600,36 @@ bool test_thread_pool_start_stop() {
     return true;
 }
 
+bool test_thread_pool_stop_timeout() {
+    thread_pool_config config;
+    config.min_threads = 1;
+    config.max_threads = 1;
+
+    thread_pool_manager pool(config);
+    (void)pool.start();
+
+    // About 5 s of queued work; stop() must give up on it after the timeout
+    std::atomic<int> completed{0};
+    for (int i = 0; i < 100; ++i) {
+        pool.post([&completed]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds{50});
+            completed.fetch_add(1, std::memory_order_relaxed);
+        }, task_priority::normal);
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    auto stop_result = pool.stop(true, std::chrono::milliseconds{200});
+    auto elapsed = std::chrono::steady_clock::now() - begin;
+
+    TEST_ASSERT(stop_result.has_value(), "Should stop successfully");
+    TEST_ASSERT(elapsed < std::chrono::seconds{2},
+                "stop() should return shortly after its timeout");
+    TEST_ASSERT(completed.load() < 100, "Queued tasks should be abandoned");
+    TEST_ASSERT(!pool.is_running(), "Should not be running after stop");
+
+    return true;
+}
+
 bool test_thread_pool_task_submission() {
     thread_pool_config config;
     config.min_threads = 2;
@@ -518,6 +745,84 @@ bool test_thread_pool_statistics() {
     return true;
 }
 
+bool test_thread_pool_priority_lanes() {
+    thread_pool_config config;
+    config.min_threads = 1;
+    config.max_threads = 1;
+
+    thread_pool_manager pool(config);
+    (void)pool.start();
+
+    // Hold the only worker so every later post is queued before it runs
+    std::atomic<bool> release{false};
+    std::atomic<bool> holding{false};
+    pool.post([&] {
+        holding = true;
+        while (!release) {
+            std::this_thread::yield();
+        }
+    });
+    TEST_ASSERT(wait_for([&] { return holding.load(); },
+                         std::chrono::milliseconds{2000}),
+                "Worker should pick up the blocking task");
+
+    std::vector<int> order;
+    std::mutex order_mutex;
+    auto record = [&](int value) {
+        return [&order, &order_mutex, value] {
+            std::lock_guard lock(order_mutex);
+            order.push_back(value);
+        };
+    };
+    pool.post(record(4), task_priority::background);
+    pool.post(record(2), task_priority::normal);
+    pool.post(record(0), task_priority::critical);
+    pool.post(record(3), task_priority::low);
+    pool.post(record(1), task_priority::high);
+    release = true;
+
+    (void)pool.stop(true, std::chrono::seconds{5});
+
+    TEST_ASSERT(order == (std::vector<int>{0, 1, 2, 3, 4}),
+                "Queued tasks should run most urgent lane first");
+    return true;
+}
+
+bool test_thread_pool_work_stealing() {
+    thread_pool_config config;
+    config.min_threads = 4;
+    config.max_threads = 4;
+
+    thread_pool_manager pool(config);
+    (void)pool.start();
+
+    // Children posted from a worker land on its own deque; the parent then
+    // blocks, so only other workers stealing can run them
+    constexpr int children = 100;
+    std::atomic<int> executed{0};
+    std::atomic<bool> all_ran{false};
+    pool.post([&] {
+        for (int i = 0; i < children; ++i) {
+            pool.post([&executed] { ++executed; });
+        }
+        all_ran = wait_for([&] { return executed.load() == children; },
+                           std::chrono::milliseconds{5000});
+    });
+
+    TEST_ASSERT(wait_for([&] { return executed.load() == children; },
+                         std::chrono::milliseconds{5000}),
+                "Children should complete");
+    (void)pool.stop(true, std::chrono::seconds{5});
+
+    TEST_ASSERT(all_ran, "Children should run while their parent is blocked");
+    TEST_ASSERT(pool.statistics().work_stolen.load() >= children,
+                "Every child should have been stolen");
+    TEST_ASSERT(pool.statistics().total_completed.load() == children + 1,
+                "Completions should be reported after stop");
+    TEST_ASSERT(pool.pending_tasks() == 0, "Nothing should remain queued");
+    return true;
+}
+
 // =============================================================================
 // Connection Pool Tests
 // =============================================================================
@@ -785,6 +1090,12 @@ int main() {
     RUN_TEST(test_performance_targets_constants);
     RUN_TEST(test_thread_pool_config_presets);
     RUN_TEST(test_lockfree_queue_config_validation);
+    RUN_TEST(test_lockfree_queue_bounded_fifo);
+    RUN_TEST(test_lockfree_queue_mpmc);
+    RUN_TEST(test_work_stealing_queue_inline_ring);
+    RUN_TEST(test_work_stealing_queue_concurrent_steal);
+    RUN_TEST(test_small_task_inline_and_overflow);
+    RUN_TEST(test_small_task_move_only_state);
 
     // Object Pool Tests
     std::cout << "\n--- Object Pool ---" << std::endl;
@@ -806,9 +1117,12 @@ int main() {
     // Thread Pool Manager Tests
     std::cout << "\n--- Thread Pool Manager ---" << std::endl;
     RUN_TEST(test_thread_pool_start_stop);
+    RUN_TEST(test_thread_pool_stop_timeout);
     RUN_TEST(test_thread_pool_task_submission);
     RUN_TEST(test_thread_pool_priority_scheduling);
     RUN_TEST(test_thread_pool_statistics);
+    RUN_TEST(test_thread_pool_priority_lanes);
+    RUN_TEST(test_thread_pool_work_stealing);
 
     // Connection Pool Tests
     std::cout << "\n--- Connection Pool ---" << std::endl;
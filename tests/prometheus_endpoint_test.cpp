@@ -14,6 +14,7 @@
 #include "pacs/bridge/monitoring/bridge_metrics.h"
 #include "pacs/bridge/monitoring/health_checker.h"
 #include "pacs/bridge/monitoring/health_server.h"
+#include "pacs/bridge/monitoring/prometheus_writer.h"
 
 #include <atomic>
 #include <cassert>
@@ -360,6 +361,50 @@ bool test_deep_health_endpoint() {
     return true;
 }
 
+bool test_metrics_negotiation() {
+    auto& metrics = bridge_metrics_collector::instance();
+    metrics.set_enabled(true);
+    metrics.record_hl7_message_received("ADT");
+
+    health_checker checker(health_config{});
+    health_server::config cfg;
+    cfg.port = TEST_PORT + 10;
+    cfg.enable_metrics_endpoint = true;
+
+    health_server server(checker, cfg);
+    TEST_ASSERT(server.start(), "Server should start");
+
+    auto plain = server.handle_request("/metrics", "Host: localhost\r\n");
+    auto open_metrics = server.handle_request(
+        "/metrics", "Accept: application/openmetrics-text; version=1.0.0\r\n");
+    auto gzipped = server.handle_request(
+        "/metrics", "accept-encoding: deflate, gzip\r\n");
+
+    server.stop(true);
+
+    TEST_ASSERT(plain.content_type.find("text/plain") != std::string::npos &&
+                    plain.content_encoding.empty(),
+                "Default scrape should be uncompressed Prometheus text");
+    TEST_ASSERT(plain.body.find("hl7_messages_received_total") != std::string::npos,
+                "Default scrape should stream collector metrics");
+    TEST_ASSERT(open_metrics.content_type.find("application/openmetrics-text") !=
+                        std::string::npos &&
+                    open_metrics.body.ends_with("# EOF\n"),
+                "OpenMetrics should be served when requested");
+
+    if (gzip_available()) {
+        TEST_ASSERT(gzipped.content_encoding == "gzip",
+                    "gzip should be used when accepted");
+        TEST_ASSERT(gzipped.body.size() < plain.body.size(),
+                    "Compressed body should be smaller");
+    } else {
+        TEST_ASSERT(gzipped.content_encoding.empty(),
+                    "Without zlib the body should be sent uncompressed");
+    }
+
+    return true;
+}
+
 bool test_not_found_endpoint() {
     health_checker checker(health_config{});
     health_server::config cfg;
@@ -534,6 +579,7 @@ int main() {
     RUN_TEST(test_liveness_endpoint);
     RUN_TEST(test_readiness_endpoint);
     RUN_TEST(test_deep_health_endpoint);
+    RUN_TEST(test_metrics_negotiation);
     RUN_TEST(test_not_found_endpoint);
 
     // Concurrent tests
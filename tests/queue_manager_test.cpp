@@ -11,13 +11,25 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include "pacs/bridge/integration/database_adapter.h"
 #include "pacs/bridge/router/queue_manager.h"
 
 #include "utils/test_helpers.h"
 
+#include <algorithm>
 #include <chrono>
 #include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
 #include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 namespace pacs::bridge::router {
 namespace {
@@ -365,6 +377,54 @@ TEST_F(QueueOperationsTest, DequeueBatch) {
     EXPECT_EQ(queue_->queue_depth(), 2u);
 }
 
+TEST_F(QueueOperationsTest, DequeueBatchPriorityOrder) {
+    (void)queue_->enqueue("RIS", "LOW", 10);
+    (void)queue_->enqueue("RIS", "HIGH", -10);
+    (void)queue_->enqueue("RIS", "NORMAL", 0);
+
+    auto batch = queue_->dequeue_batch(3);
+    ASSERT_EQ(batch.size(), 3u);
+    EXPECT_EQ(batch[0].payload, "HIGH");
+    EXPECT_EQ(batch[1].payload, "NORMAL");
+    EXPECT_EQ(batch[2].payload, "LOW");
+
+    for (const auto& msg : batch) {
+        EXPECT_EQ(msg.state, message_state::processing);
+        EXPECT_EQ(msg.attempt_count, 1);
+    }
+}
+
+TEST_F(QueueOperationsTest, ConcurrentDequeueClaimsEachMessageOnce) {
+    constexpr int message_count = 200;
+    for (int i = 0; i < message_count; ++i) {
+        ASSERT_EXPECTED_OK(queue_->enqueue("RIS", "MSG_" + std::to_string(i)));
+    }
+
+    std::mutex claimed_mutex;
+    std::vector<std::string> claimed;
+    std::vector<std::thread> consumers;
+    for (int t = 0; t < 4; ++t) {
+        consumers.emplace_back([&] {
+            while (true) {
+                auto batch = queue_->dequeue_batch(7);
+                if (batch.empty()) break;
+                std::lock_guard<std::mutex> lock(claimed_mutex);
+                for (auto& msg : batch) {
+                    claimed.push_back(msg.id);
+                }
+            }
+        });
+    }
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+
+    std::sort(claimed.begin(), claimed.end());
+    EXPECT_EQ(claimed.size(), static_cast<size_t>(message_count));
+    EXPECT_EQ(std::adjacent_find(claimed.begin(), claimed.end()), claimed.end());
+    EXPECT_EQ(queue_->queue_depth(), 0u);
+}
+
 TEST_F(QueueOperationsTest, AckMessage) {
     auto enqueue_result = queue_->enqueue("RIS", "PAYLOAD");
     ASSERT_EXPECTED_OK(enqueue_result);
@@ -815,6 +875,119 @@ TEST_F(PersistenceTest, DeadLettersSurviveRestart) {
     }
 }
 
+TEST_F(PersistenceTest, EpochMicrosTimestampsSurviveRestart) {
+    std::string msg_id;
+    std::chrono::system_clock::time_point created_at;
+
+    {
+        auto config = queue_config_builder::create()
+                          .database(test_db_path_)
+                          .timestamp_format(queue_timestamp_format::epoch_micros)
+                          .build();
+
+        queue_manager queue(config);
+        ASSERT_EXPECTED_OK(queue.start());
+
+        auto result = queue.enqueue("RIS", "EPOCH_MSG");
+        ASSERT_EXPECTED_OK(result);
+        msg_id = *result;
+
+        auto dl = queue.enqueue("RIS", "EPOCH_DL_MSG");
+        ASSERT_EXPECTED_OK(dl);
+        ASSERT_EXPECTED_OK(queue.dead_letter(*dl, "Test epoch"));
+
+        auto msg = queue.get_message(msg_id);
+        ASSERT_TRUE(msg.has_value());
+        created_at = msg->created_at;
+        queue.stop();
+    }
+
+    {
+        integration::database_config db_config;
+        db_config.database_path = test_db_path_;
+        auto db = integration::create_database_adapter(db_config);
+        auto conn = db->acquire_connection();
+        ASSERT_TRUE(conn.has_value());
+        auto result = (*conn)->execute(
+            "SELECT typeof(created_at), typeof(scheduled_at) FROM message_queue");
+        ASSERT_TRUE(result.has_value());
+        ASSERT_TRUE((*result)->next());
+        EXPECT_EQ((*result)->current_row().get_string(0), "integer");
+        EXPECT_EQ((*result)->current_row().get_string(1), "integer");
+        EXPECT_FALSE((*result)->next());
+        db->release_connection(*conn);
+    }
+
+    // Reopened with the default format; the tables keep theirs
+    {
+        auto config = queue_config_builder::create()
+                          .database(test_db_path_)
+                          .build();
+
+        queue_manager queue(config);
+        ASSERT_EXPECTED_OK(queue.start());
+
+        auto msg = queue.get_message(msg_id);
+        ASSERT_TRUE(msg.has_value());
+        EXPECT_EQ(std::chrono::duration_cast<std::chrono::microseconds>(
+                      msg->created_at - created_at).count(), 0);
+
+        auto dead_letters = queue.get_dead_letters();
+        ASSERT_EQ(dead_letters.size(), 1u);
+        EXPECT_GE(dead_letters[0].dead_lettered_at, created_at);
+
+        auto dequeued = queue.dequeue();
+        ASSERT_TRUE(dequeued.has_value());
+        EXPECT_EQ(dequeued->id, msg_id);
+        ASSERT_EXPECTED_OK(queue.ack(msg_id));
+
+        queue.stop();
+    }
+}
+
+TEST_F(PersistenceTest, TextTablesKeepTheirFormat) {
+    {
+        auto config = queue_config_builder::create()
+                          .database(test_db_path_)
+                          .build();
+
+        queue_manager queue(config);
+        ASSERT_EXPECTED_OK(queue.start());
+        (void)queue.enqueue("RIS", "TEXT_MSG_1");
+        queue.stop();
+    }
+
+    {
+        auto config = queue_config_builder::create()
+                          .database(test_db_path_)
+                          .timestamp_format(queue_timestamp_format::epoch_micros)
+                          .build();
+
+        queue_manager queue(config);
+        ASSERT_EXPECTED_OK(queue.start());
+        (void)queue.enqueue("RIS", "TEXT_MSG_2");
+
+        auto pending = queue.get_pending("RIS");
+        ASSERT_EQ(pending.size(), 2u);
+        EXPECT_EQ(pending[0].payload, "TEXT_MSG_1");
+        EXPECT_EQ(pending[1].payload, "TEXT_MSG_2");
+        queue.stop();
+    }
+
+    integration::database_config db_config;
+    db_config.database_path = test_db_path_;
+    auto db = integration::create_database_adapter(db_config);
+    auto conn = db->acquire_connection();
+    ASSERT_TRUE(conn.has_value());
+    auto result = (*conn)->execute(
+        "SELECT COUNT(*) FROM message_queue WHERE typeof(scheduled_at) = 'text'");
+    ASSERT_TRUE(result.has_value());
+    ASSERT_TRUE((*result)->next());
+    EXPECT_EQ((*result)->current_row().get_int64(0), 2);
+    EXPECT_FALSE((*result)->next());
+    db->release_connection(*conn);
+}
+
 // =============================================================================
 // Maintenance Tests
 // =============================================================================
@@ -967,5 +1140,594 @@ TEST_F(WorkerThreadTest, WorkersHandleMultipleMessages) {
     queue.stop();
 }
 
+TEST_F(WorkerThreadTest, ScheduledRetryWakesWorkers) {
+    auto config = queue_config_builder::create()
+                      .database(test_db_path_)
+                      .workers(2)
+                      .retry_policy(3, std::chrono::seconds{1}, 2.0)
+                      .build();
+
+    queue_manager queue(config);
+    ASSERT_EXPECTED_OK(queue.start());
+
+    std::atomic<int> attempts{0};
+    std::atomic<bool> delivered{false};
+    std::mutex delivered_mutex;
+    std::condition_variable delivered_cv;
+
+    queue.start_workers([&](const queued_message&) -> std::expected<void, std::string> {
+        if (attempts.fetch_add(1) == 0) {
+            return std::unexpected("first attempt fails");
+        }
+        delivered = true;
+        delivered_cv.notify_all();
+        return {};
+    });
+
+    ASSERT_EXPECTED_OK(queue.enqueue("RIS", "RETRY_TEST_PAYLOAD"));
+
+    // Retry is due after 1 second; no new enqueue wakes the workers
+    {
+        std::unique_lock<std::mutex> lock(delivered_mutex);
+        delivered_cv.wait_for(lock, std::chrono::seconds{30},
+                              [&] { return delivered.load(); });
+    }
+
+    EXPECT_TRUE(delivered.load());
+    EXPECT_EQ(attempts.load(), 2);
+
+    queue.stop_workers();
+    queue.stop();
+}
+
+// =============================================================================
+// Crash Recovery Helper
+// =============================================================================
+
+#ifndef _WIN32
+/**
+ * @brief SIGKILL a child enqueueing through config mid-write, then check
+ *        that every enqueue it reported as acknowledged survives
+ *
+ * @param reopen_config Configuration the parent reopens the storage with
+ */
+void expect_enqueues_survive_crash(const queue_config& config,
+                                   const queue_config& reopen_config) {
+    constexpr int producer_count = 4;
+    constexpr size_t kill_after = 200;
+
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+
+    pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        // Child: enqueue until killed, reporting each acknowledged id
+        ::close(fds[0]);
+        queue_manager queue(config);
+        if (!queue.start()) {
+            ::_exit(1);
+        }
+        std::vector<std::thread> producers;
+        for (int p = 0; p < producer_count; ++p) {
+            producers.emplace_back([&, p] {
+                for (int i = 0;; ++i) {
+                    auto id = queue.enqueue("RIS", "P" + std::to_string(p) + "_" +
+                                                       std::to_string(i));
+                    if (id) {
+                        // One write per line; lines under PIPE_BUF never interleave
+                        std::string line = *id + "\n";
+                        (void)!::write(fds[1], line.data(), line.size());
+                    }
+                }
+            });
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+        ::_exit(0);
+    }
+
+    // Parent: SIGKILL the child mid-write once enough ids are durable
+    ::close(fds[1]);
+    std::string reported;
+    char buffer[4096];
+    ssize_t n;
+    bool killed = false;
+    while ((n = ::read(fds[0], buffer, sizeof(buffer))) > 0) {
+        reported.append(buffer, static_cast<size_t>(n));
+        if (!killed && static_cast<size_t>(std::count(reported.begin(), reported.end(),
+                                                      '\n')) >= kill_after) {
+            ::kill(child, SIGKILL);
+            killed = true;
+        }
+    }
+    ::close(fds[0]);
+
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    ASSERT_TRUE(killed) << "Child exited before reporting " << kill_after << " ids";
+    ASSERT_TRUE(WIFSIGNALED(status));
+
+    // Every id reported before the kill was acknowledged, so must survive
+    std::vector<std::string> ids;
+    std::istringstream lines(reported);
+    for (std::string line; std::getline(lines, line);) {
+        ids.push_back(line);
+    }
+    EXPECT_GE(ids.size(), kill_after);
+
+    queue_manager reopened(reopen_config);
+    ASSERT_EXPECTED_OK(reopened.start());
+    for (const auto& id : ids) {
+        EXPECT_TRUE(reopened.get_message(id).has_value()) << "Lost message " << id;
+    }
+    reopened.stop();
+}
+#endif
+
+// =============================================================================
+// Hot Tier Tests
+// =============================================================================
+
+class HotTierTest : public QueueManagerLifecycleTest {
+protected:
+    queue_config hot_config() const {
+        return queue_config_builder::create()
+            .database(test_db_path_)
+            .workers(2)
+            .retry_policy(3, std::chrono::seconds{1}, 2.0)
+            .hot_tier(std::chrono::milliseconds{5})
+            .build();
+    }
+
+    queue_config direct_config() const {
+        return queue_config_builder::create().database(test_db_path_).build();
+    }
+};
+
+TEST_F(HotTierTest, EnqueueDequeueAck) {
+    queue_manager queue(hot_config());
+    ASSERT_EXPECTED_OK(queue.start());
+
+    auto low = queue.enqueue("RIS", "LOW", 10);
+    auto high = queue.enqueue("RIS", "HIGH", -10);
+    ASSERT_EXPECTED_OK(low);
+    ASSERT_EXPECTED_OK(high);
+    EXPECT_EQ(queue.queue_depth(), 2u);
+
+    auto first = queue.dequeue();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->payload, "HIGH");
+    EXPECT_EQ(first->state, message_state::processing);
+    EXPECT_EQ(first->attempt_count, 1);
+
+    ASSERT_EXPECTED_OK(queue.ack(first->id));
+    EXPECT_FALSE(queue.get_message(first->id).has_value());
+    EXPECT_EQ(queue.ack(first->id).error(), queue_error::message_not_found);
+    EXPECT_EQ(queue.queue_depth(), 1u);
+
+    queue.stop();
+}
+
+TEST_F(HotTierTest, NackSchedulesRetry) {
+    queue_manager queue(hot_config());
+    ASSERT_EXPECTED_OK(queue.start());
+
+    auto id = queue.enqueue("RIS", "RETRY_ME");
+    ASSERT_EXPECTED_OK(id);
+
+    auto msg = queue.dequeue();
+    ASSERT_TRUE(msg.has_value());
+    ASSERT_EXPECTED_OK(queue.nack(msg->id, "timeout"));
+
+    auto stored = queue.get_message(*id);
+    ASSERT_TRUE(stored.has_value());
+    EXPECT_EQ(stored->state, message_state::retry_scheduled);
+    EXPECT_EQ(stored->last_error, "timeout");
+
+    // Not ready until the retry delay elapses
+    EXPECT_FALSE(queue.dequeue().has_value());
+
+    queue.stop();
+}
+
+TEST_F(HotTierTest, StatisticsMatchDatabase) {
+    queue_manager queue(hot_config());
+    ASSERT_EXPECTED_OK(queue.start());
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EXPECTED_OK(queue.enqueue("RIS", "MSG_" + std::to_string(i)));
+    }
+    auto msg = queue.dequeue();
+    ASSERT_TRUE(msg.has_value());
+
+    auto stats = queue.get_statistics();
+    EXPECT_EQ(stats.pending_count, 2u);
+    EXPECT_EQ(stats.processing_count, 1u);
+
+    queue.stop();
+}
+
+TEST_F(HotTierTest, StateSurvivesRestart) {
+    {
+        queue_manager queue(hot_config());
+        ASSERT_EXPECTED_OK(queue.start());
+
+        for (int i = 0; i < 5; ++i) {
+            ASSERT_EXPECTED_OK(queue.enqueue("RIS", "MSG_" + std::to_string(i)));
+        }
+        auto acked = queue.dequeue();
+        ASSERT_TRUE(acked.has_value());
+        ASSERT_EXPECTED_OK(queue.ack(acked->id));
+
+        // Left processing; recovered to pending on restart
+        auto in_flight = queue.dequeue();
+        ASSERT_TRUE(in_flight.has_value());
+
+        queue.stop();
+    }
+
+    queue_manager reopened(direct_config());
+    ASSERT_EXPECTED_OK(reopened.start());
+    EXPECT_EQ(reopened.queue_depth(), 4u);
+    reopened.stop();
+}
+
+TEST_F(HotTierTest, WorkersDeliverFromHotTier) {
+    constexpr int message_count = 20;
+    {
+        queue_manager queue(hot_config());
+        ASSERT_EXPECTED_OK(queue.start());
+
+        std::atomic<int> delivered_count{0};
+        std::mutex delivered_mutex;
+        std::condition_variable delivered_cv;
+
+        queue.start_workers([&](const queued_message&) -> std::expected<void, std::string> {
+            delivered_count.fetch_add(1);
+            delivered_cv.notify_all();
+            return {};
+        });
+
+        for (int i = 0; i < message_count; ++i) {
+            ASSERT_EXPECTED_OK(queue.enqueue("RIS", "MSG_" + std::to_string(i)));
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(delivered_mutex);
+            delivered_cv.wait_for(lock, std::chrono::seconds{30},
+                                  [&] { return delivered_count.load() >= message_count; });
+        }
+        EXPECT_EQ(delivered_count.load(), message_count);
+
+        queue.stop_workers();
+        queue.stop();
+    }
+
+    // Acks reached the database before stop() returned
+    queue_manager reopened(direct_config());
+    ASSERT_EXPECTED_OK(reopened.start());
+    EXPECT_EQ(reopened.queue_depth(), 0u);
+    reopened.stop();
+}
+
+TEST_F(HotTierTest, DeadLetterRetrySurvivesReopen) {
+    std::string id;
+    {
+        queue_manager queue(hot_config());
+        ASSERT_EXPECTED_OK(queue.start());
+
+        auto enqueued = queue.enqueue("RIS", "RETRIED");
+        ASSERT_EXPECTED_OK(enqueued);
+        id = *enqueued;
+
+        // Leaves a state update queued on the writer
+        auto msg = queue.dequeue();
+        ASSERT_TRUE(msg.has_value());
+
+        ASSERT_EXPECTED_OK(queue.dead_letter(id, "manual"));
+        ASSERT_EXPECTED_OK(queue.retry_dead_letter(id));
+        queue.stop();
+    }
+
+    queue_manager reopened(direct_config());
+    ASSERT_EXPECTED_OK(reopened.start());
+    auto restored = reopened.get_message(id);
+    ASSERT_TRUE(restored.has_value()) << "Retried dead letter was lost";
+    EXPECT_EQ(restored->state, message_state::pending);
+    EXPECT_EQ(reopened.dead_letter_count(), 0u);
+    reopened.stop();
+}
+
+TEST_F(HotTierTest, EnqueueFailsWhileCommitsFail) {
+    queue_manager queue(hot_config());
+    ASSERT_EXPECTED_OK(queue.start());
+
+    integration::database_config db_config;
+    db_config.database_path = test_db_path_;
+    auto db = integration::create_database_adapter(db_config);
+    auto conn = db->acquire_connection();
+    ASSERT_TRUE(conn.has_value());
+
+    // Every group commit fails while the table is renamed away
+    ASSERT_TRUE((*conn)->execute("ALTER TABLE message_queue RENAME TO message_queue_hidden"));
+    auto failed = queue.enqueue("RIS", "NOT_STORED");
+    ASSERT_FALSE(failed.has_value());
+    EXPECT_EQ(failed.error(), queue_error::database_error);
+    EXPECT_EQ(queue.queue_depth(), 0u);
+
+    // Commits resume once the table is back; the failed enqueue stays cancelled
+    ASSERT_TRUE((*conn)->execute("ALTER TABLE message_queue_hidden RENAME TO message_queue"));
+    db->release_connection(*conn);
+    auto stored = queue.enqueue("RIS", "STORED");
+    ASSERT_EXPECTED_OK(stored);
+    queue.stop();
+
+    queue_manager reopened(direct_config());
+    ASSERT_EXPECTED_OK(reopened.start());
+    EXPECT_EQ(reopened.queue_depth(), 1u);
+    EXPECT_TRUE(reopened.get_message(*stored).has_value());
+    reopened.stop();
+}
+
+#ifndef _WIN32
+TEST_F(HotTierTest, CrashKeepsEnqueuedMessages) {
+    expect_enqueues_survive_crash(hot_config(), direct_config());
+}
+#endif
+
+// =============================================================================
+// Segmented Log Tests
+// =============================================================================
+
+// segment_log is POSIX-only; start() fails with database_error on Windows
+#ifndef _WIN32
+
+class SegmentedLogTest : public pacs_bridge_test {
+protected:
+    std::filesystem::path segment_dir_;
+
+    void SetUp() override {
+        pacs_bridge_test::SetUp();
+        segment_dir_ = std::filesystem::temp_directory_path() /
+                       ("test_queue_segments_" + std::to_string(::getpid()));
+        std::filesystem::remove_all(segment_dir_);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(segment_dir_);
+        pacs_bridge_test::TearDown();
+    }
+
+    queue_config log_config(size_t segment_size = 64 * 1024) const {
+        return queue_config_builder::create()
+            .workers(2)
+            .retry_policy(2, std::chrono::seconds{1}, 2.0)
+            .segmented_log(segment_dir_.string(), segment_size)
+            .build();
+    }
+
+    size_t segment_files() const {
+        size_t count = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(segment_dir_)) {
+            if (entry.path().extension() == ".seg") {
+                count++;
+            }
+        }
+        return count;
+    }
+};
+
+TEST_F(SegmentedLogTest, StateSurvivesRestart) {
+    std::string retried_id;
+    {
+        queue_manager queue(log_config());
+        ASSERT_EXPECTED_OK(queue.start());
+
+        for (int i = 0; i < 5; ++i) {
+            ASSERT_EXPECTED_OK(queue.enqueue("RIS", "MSG_" + std::to_string(i), i));
+        }
+        auto acked = queue.dequeue();
+        ASSERT_TRUE(acked.has_value());
+        ASSERT_EXPECTED_OK(queue.ack(acked->id));
+
+        auto retried = queue.dequeue();
+        ASSERT_TRUE(retried.has_value());
+        ASSERT_EXPECTED_OK(queue.nack(retried->id, "timeout"));
+        retried_id = retried->id;
+
+        // Left processing; delivered again after restart
+        auto in_flight = queue.dequeue();
+        ASSERT_TRUE(in_flight.has_value());
+
+        queue.stop();
+    }
+
+    queue_manager reopened(log_config());
+    ASSERT_EXPECTED_OK(reopened.start());
+    EXPECT_EQ(reopened.queue_depth(), 4u);
+
+    auto retried = reopened.get_message(retried_id);
+    ASSERT_TRUE(retried.has_value());
+    EXPECT_EQ(retried->state, message_state::retry_scheduled);
+    EXPECT_EQ(retried->last_error, "timeout");
+    EXPECT_EQ(retried->attempt_count, 1);
+
+    auto stats = reopened.get_statistics();
+    EXPECT_EQ(stats.pending_count, 3u);
+    EXPECT_EQ(stats.retry_scheduled_count, 1u);
+    reopened.stop();
+}
+
+TEST_F(SegmentedLogTest, DeadLettersSurviveRestart) {
+    std::string dead_id;
+    std::string deleted_id;
+    {
+        queue_manager queue(log_config());
+        ASSERT_EXPECTED_OK(queue.start());
+
+        auto first = queue.enqueue("RIS", "DEAD");
+        auto second = queue.enqueue("RIS", "DELETED");
+        ASSERT_EXPECTED_OK(first);
+        ASSERT_EXPECTED_OK(second);
+        dead_id = *first;
+        deleted_id = *second;
+
+        ASSERT_EXPECTED_OK(queue.dead_letter(dead_id, "rejected"));
+        ASSERT_EXPECTED_OK(queue.dead_letter(deleted_id, "rejected"));
+        EXPECT_EQ(queue.dead_letter_count(), 2u);
+        EXPECT_EQ(queue.queue_depth(), 0u);
+        ASSERT_EXPECTED_OK(queue.delete_dead_letter(deleted_id));
+
+        queue.stop();
+    }
+
+    {
+        queue_manager queue(log_config());
+        ASSERT_EXPECTED_OK(queue.start());
+
+        auto dead_letters = queue.get_dead_letters();
+        ASSERT_EQ(dead_letters.size(), 1u);
+        EXPECT_EQ(dead_letters[0].message.id, dead_id);
+        EXPECT_EQ(dead_letters[0].message.payload, "DEAD");
+        EXPECT_EQ(dead_letters[0].reason, "rejected");
+        EXPECT_EQ(dead_letters[0].message.state, message_state::dead_letter);
+
+        ASSERT_EXPECTED_OK(queue.retry_dead_letter(dead_id));
+        EXPECT_EQ(queue.dead_letter_count(), 0u);
+        EXPECT_EQ(queue.retry_dead_letter(dead_id).error(), queue_error::message_not_found);
+
+        queue.stop();
+    }
+
+    queue_manager reopened(log_config());
+    ASSERT_EXPECTED_OK(reopened.start());
+    EXPECT_EQ(reopened.dead_letter_count(), 0u);
+    auto msg = reopened.get_message(dead_id);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->state, message_state::pending);
+    EXPECT_EQ(msg->attempt_count, 0);
+    reopened.stop();
+}
+
+TEST_F(SegmentedLogTest, CompactionReclaimsAcknowledgedSegments) {
+    const std::string payload(200, 'X');
+    std::string long_lived_id;
+    {
+        queue_manager queue(log_config(4096));
+        ASSERT_EXPECTED_OK(queue.start());
+
+        auto long_lived = queue.enqueue("PACS", "LONG_LIVED", 100);
+        ASSERT_EXPECTED_OK(long_lived);
+        long_lived_id = *long_lived;
+
+        for (int i = 0; i < 500; ++i) {
+            ASSERT_EXPECTED_OK(queue.enqueue("RIS", payload));
+            auto msg = queue.dequeue("RIS");
+            ASSERT_TRUE(msg.has_value());
+            ASSERT_EXPECTED_OK(queue.ack(msg->id));
+        }
+
+        // Dozens of segments were written; acknowledged ones are reclaimed
+        queue.compact();
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (segment_files() > 3 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+        EXPECT_LE(segment_files(), 3u);
+
+        queue.stop();
+    }
+
+    queue_manager reopened(log_config(4096));
+    ASSERT_EXPECTED_OK(reopened.start());
+    EXPECT_EQ(reopened.queue_depth(), 1u);
+    auto msg = reopened.get_message(long_lived_id);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->payload, "LONG_LIVED");
+    EXPECT_EQ(msg->priority, 100);
+    reopened.stop();
+}
+
+TEST_F(SegmentedLogTest, TornTailIsIgnored) {
+    {
+        queue_manager queue(log_config());
+        ASSERT_EXPECTED_OK(queue.start());
+        for (int i = 0; i < 3; ++i) {
+            ASSERT_EXPECTED_OK(queue.enqueue("RIS", "MSG_" + std::to_string(i)));
+        }
+        queue.stop();
+    }
+
+    // Simulate a batch torn by a crash
+    std::filesystem::path last;
+    for (const auto& entry : std::filesystem::directory_iterator(segment_dir_)) {
+        if (last.empty() || entry.path() > last) {
+            last = entry.path();
+        }
+    }
+    ASSERT_FALSE(last.empty());
+    {
+        std::ofstream out(last, std::ios::binary | std::ios::app);
+        const char torn[] = {0x20, 0x00, 0x00, 0x00, 0x12, 0x34, 0x56, 0x78, 0x01, 'I', 'D'};
+        out.write(torn, sizeof(torn));
+    }
+
+    queue_manager reopened(log_config());
+    ASSERT_EXPECTED_OK(reopened.start());
+    EXPECT_EQ(reopened.queue_depth(), 3u);
+    ASSERT_EXPECTED_OK(reopened.enqueue("RIS", "AFTER_TORN"));
+    reopened.stop();
+
+    queue_manager again(log_config());
+    ASSERT_EXPECTED_OK(again.start());
+    EXPECT_EQ(again.queue_depth(), 4u);
+    again.stop();
+}
+
+TEST_F(SegmentedLogTest, WorkersDeliverFromLog) {
+    constexpr int message_count = 20;
+    {
+        queue_manager queue(log_config());
+        ASSERT_EXPECTED_OK(queue.start());
+
+        std::atomic<int> delivered_count{0};
+        std::mutex delivered_mutex;
+        std::condition_variable delivered_cv;
+
+        queue.start_workers([&](const queued_message&) -> std::expected<void, std::string> {
+            delivered_count.fetch_add(1);
+            delivered_cv.notify_all();
+            return {};
+        });
+
+        for (int i = 0; i < message_count; ++i) {
+            ASSERT_EXPECTED_OK(queue.enqueue("RIS", "MSG_" + std::to_string(i)));
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(delivered_mutex);
+            delivered_cv.wait_for(lock, std::chrono::seconds{30},
+                                  [&] { return delivered_count.load() >= message_count; });
+        }
+        EXPECT_EQ(delivered_count.load(), message_count);
+
+        queue.stop_workers();
+        queue.stop();
+    }
+
+    queue_manager reopened(log_config());
+    ASSERT_EXPECTED_OK(reopened.start());
+    EXPECT_EQ(reopened.queue_depth(), 0u);
+    reopened.stop();
+}
+
+TEST_F(SegmentedLogTest, CrashKeepsEnqueuedMessages) {
+    expect_enqueues_survive_crash(log_config(8192), log_config(8192));
+}
+
+#endif  // _WIN32
+
 }  // namespace
 }  // namespace pacs::bridge::router
@@ -158,6 +158,17 @@ TEST_F(ReliableSenderConfigBuilderTest, FluentBuilder) {
     EXPECT_TRUE(config.auto_start_workers);
 }
 
+TEST_F(ReliableSenderConfigBuilderTest, SegmentedLogBuilder) {
+    auto config = reliable_sender_config_builder::create()
+                      .segmented_log("/tmp/reliable_segments", 1024 * 1024)
+                      .build();
+
+    EXPECT_EQ(config.queue.persistence, queue_persistence::segmented_log);
+    EXPECT_EQ(config.queue.segment_directory, "/tmp/reliable_segments");
+    EXPECT_EQ(config.queue.segment_size, 1024u * 1024u);
+    EXPECT_TRUE(config.is_valid());
+}
+
 // =============================================================================
 // Lifecycle Tests
 // =============================================================================
@@ -583,6 +594,39 @@ TEST_F(ReliableSenderRecoveryTest, MessagesPersistedAcrossRestart) {
     }
 }
 
+// segment_log is POSIX-only; start() fails with database_error on Windows
+#ifndef _WIN32
+TEST_F(ReliableSenderRecoveryTest, SegmentedLogPersistedAcrossRestart) {
+    const std::string segment_dir = test_data_path("reliable_recovery_segments");
+    std::filesystem::remove_all(segment_dir);
+
+    auto config = reliable_sender_config_builder::create()
+                      .segmented_log(segment_dir)
+                      .auto_start_workers(false)
+                      .build();
+
+    {
+        reliable_outbound_sender sender(config);
+        ASSERT_TRUE(sender.start().has_value());
+        for (int i = 0; i < 5; ++i) {
+            EXPECT_TRUE(sender.enqueue("RIS", "MSH|^~\\&|PACS|HOSP|...|" + std::to_string(i))
+                            .has_value());
+        }
+        sender.stop();
+    }
+
+    {
+        reliable_outbound_sender sender(config);
+        ASSERT_TRUE(sender.start().has_value());
+        EXPECT_EQ(sender.queue_depth(), 5u);
+        EXPECT_EQ(sender.get_pending("RIS", 10).size(), 5u);
+        sender.stop();
+    }
+
+    std::filesystem::remove_all(segment_dir);
+}
+#endif
+
 // =============================================================================
 // Dead Letter Queue Tests
 // =============================================================================
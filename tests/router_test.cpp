@@ -9,12 +9,19 @@
  */
 
 #include "pacs/bridge/router/message_router.h"
+#include "pacs/bridge/integration/thread_adapter.h"
 #include "pacs/bridge/protocol/hl7/hl7_builder.h"
 #include "pacs/bridge/protocol/hl7/hl7_parser.h"
 
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace pacs::bridge::router::test {
@@ -743,6 +750,92 @@ bool test_routing_find_matching_routes() {
     return true;
 }
 
+bool test_routing_mixed_patterns_keep_priority() {
+    message_router router;
+    router.register_handler("h1", [](const hl7::hl7_message&) { return handler_result::ok(); });
+
+    auto add = [&router](std::string_view id, int priority,
+                         message_pattern pattern) {
+        route r;
+        r.id = std::string(id);
+        r.priority = priority;
+        r.pattern = std::move(pattern);
+        r.handler_ids = {"h1"};
+        return router.add_route(r).has_value();
+    };
+
+    message_pattern regex_type;
+    regex_type.message_type = "a.t";  // regexes match case-insensitively
+    regex_type.use_regex = true;
+
+    message_pattern prefix_type;
+    prefix_type.message_type = "AD*";
+
+    message_pattern facility;
+    facility.sending_facility = "HOSPITAL";
+
+    message_pattern other_facility;
+    other_facility.message_type = "ADT";
+    other_facility.sending_facility = "CLINIC";
+
+    message_pattern bad_sender_regex;
+    bad_sender_regex.sending_application = "([";
+    bad_sender_regex.use_regex = true;
+
+    TEST_ASSERT(add("any", 50, message_pattern::any()), "any route");
+    TEST_ASSERT(add("adt_a01", 10, message_pattern::for_type_trigger("ADT", "A01")),
+                "exact route");
+    TEST_ASSERT(add("regex", 20, regex_type), "regex route");
+    TEST_ASSERT(add("prefix", 30, prefix_type), "prefix route");
+    TEST_ASSERT(add("facility", 40, facility), "facility route");
+    TEST_ASSERT(add("clinic", 1, other_facility), "other facility route");
+    TEST_ASSERT(add("orm", 5, message_pattern::for_type("ORM")), "orm route");
+    TEST_ASSERT(!add("bad_sender", 2, bad_sender_regex), "bad sender regex rejected");
+
+    auto matching = router.find_matching_routes(parse_message(SAMPLE_ADT_A01));
+    std::vector<std::string> expected{"adt_a01", "regex", "prefix", "facility", "any"};
+    TEST_ASSERT(matching == expected, "ADT^A01 should match in priority order");
+
+    matching = router.find_matching_routes(parse_message(SAMPLE_ADT_A08));
+    expected = {"regex", "prefix", "facility", "any"};
+    TEST_ASSERT(matching == expected, "ADT^A08 should skip the A01 route");
+
+    router.set_route_enabled("regex", false);
+    matching = router.find_matching_routes(parse_message(SAMPLE_ORM_O01));
+    expected = {"orm", "facility", "any"};
+    TEST_ASSERT(matching == expected, "ORM^O01 should match its own routes");
+
+    return true;
+}
+
+bool test_route_invalid_regex_rejected() {
+    message_router router;
+
+    route r;
+    r.id = "bad";
+    r.pattern.message_type = "([";
+    r.pattern.use_regex = true;
+
+    auto result = router.add_route(r);
+    TEST_ASSERT(!result.has_value(), "Invalid regex should be rejected");
+    TEST_ASSERT(result.error() == router_error::invalid_pattern,
+                "Error should be invalid_pattern");
+
+    // Every MSH field is validated, not only type and trigger
+    route sender;
+    sender.id = "bad_sender";
+    sender.pattern.sending_application = "RIS(";
+    sender.pattern.use_regex = true;
+
+    result = router.add_route(sender);
+    TEST_ASSERT(!result.has_value(), "Invalid sender regex should be rejected");
+    TEST_ASSERT(result.error() == router_error::invalid_pattern,
+                "Error should be invalid_pattern");
+    TEST_ASSERT(router.get_route("bad_sender") == nullptr,
+                "Rejected route should not be added");
+    return true;
+}
+
 // =============================================================================
 // Statistics Tests
 // =============================================================================
@@ -799,6 +892,572 @@ bool test_router_statistics_reset() {
     return true;
 }
 
+// =============================================================================
+// Concurrency Tests
+// =============================================================================
+
+bool test_routing_handlers_run_concurrently() {
+    message_router router;
+
+    // Each handler waits until the other is inside; a router that holds a
+    // lock across handler execution would time out here
+    std::mutex mutex;
+    std::condition_variable cv;
+    int inside = 0;
+    router.register_handler("rendezvous", [&](const hl7::hl7_message&) {
+        std::unique_lock lock(mutex);
+        ++inside;
+        cv.notify_all();
+        bool met = cv.wait_for(lock, std::chrono::seconds(5),
+                               [&] { return inside >= 2; });
+        return met ? handler_result::ok() : handler_result::error("timed out");
+    });
+
+    route r;
+    r.id = "all";
+    r.pattern = message_pattern::any();
+    r.handler_ids = {"rendezvous"};
+    (void)router.add_route(r);
+
+    auto msg = parse_message(SAMPLE_ADT_A01);
+    std::atomic<int> succeeded{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 2; ++i) {
+        threads.emplace_back([&] {
+            if (router.route(msg).has_value()) {
+                ++succeeded;
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    TEST_ASSERT(succeeded == 2, "Both handlers should run at the same time");
+    return true;
+}
+
+bool test_handler_may_reconfigure_router() {
+    message_router router;
+    router.register_handler("disable_self", [&router](const hl7::hl7_message&) {
+        router.set_route_enabled("once", false);
+        return handler_result::ok();
+    });
+
+    route r;
+    r.id = "once";
+    r.pattern = message_pattern::any();
+    r.handler_ids = {"disable_self"};
+    (void)router.add_route(r);
+
+    auto msg = parse_message(SAMPLE_ADT_A01);
+    TEST_ASSERT(router.route(msg).has_value(), "First message should match");
+    TEST_ASSERT(!router.route(msg).has_value(),
+                "Route disabled by its handler should not match again");
+    return true;
+}
+
+bool test_routing_during_reconfiguration() {
+    message_router router;
+    router.register_handler("h1", [](const hl7::hl7_message&) {
+        return handler_result::ok();
+    });
+    router.set_default_handler([](const hl7::hl7_message&) {
+        return handler_result::ok();
+    });
+
+    route stable;
+    stable.id = "adt";
+    stable.pattern = message_pattern::for_type("ADT");
+    stable.handler_ids = {"h1"};
+    (void)router.add_route(stable);
+
+    constexpr int threads_count = 4;
+    constexpr int per_thread = 500;
+    auto msg = parse_message(SAMPLE_ADT_A01);
+
+    std::atomic<bool> done{false};
+    std::atomic<int> failures{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < per_thread; ++i) {
+                if (!router.route(msg).has_value()) {
+                    ++failures;
+                }
+            }
+        });
+    }
+
+    // Churn the configuration while messages are routed
+    std::thread writer([&] {
+        for (int i = 0; !done; ++i) {
+            route extra;
+            extra.id = "extra_" + std::to_string(i % 4);
+            extra.pattern = message_pattern::for_type("ORM");
+            extra.handler_ids = {"h1"};
+            (void)router.add_route(extra);
+            router.set_route_enabled("adt", true);
+            (void)router.remove_route(extra.id);
+        }
+    });
+
+    for (auto& t : threads) {
+        t.join();
+    }
+    done = true;
+    writer.join();
+
+    auto stats = router.get_statistics();
+    TEST_ASSERT(failures == 0, "Every message should route");
+    TEST_ASSERT(stats.total_messages == threads_count * per_thread,
+                "Every message should be counted");
+    TEST_ASSERT(stats.route_matches["adt"] == threads_count * per_thread,
+                "Per-route counts should not lose increments");
+    return true;
+}
+
+// =============================================================================
+// Execution Policy Tests
+// =============================================================================
+
+std::shared_ptr<integration::thread_adapter> make_pool() {
+    std::shared_ptr<integration::thread_adapter> pool =
+        integration::create_thread_adapter();
+    integration::worker_pool_config config;
+    config.min_threads = 2;
+    config.max_threads = 4;
+    if (!pool->initialize(config)) {
+        return nullptr;
+    }
+    return pool;
+}
+
+bool test_async_route_does_not_block() {
+    auto pool = make_pool();
+    TEST_ASSERT(pool != nullptr, "Worker pool should initialize");
+
+    message_router router;
+    router.set_worker_pool(pool);
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool release = false;
+    std::atomic<int> async_runs{0};
+
+    router.register_handler("slow", [&](const hl7::hl7_message&) {
+        std::unique_lock lock(mutex);
+        cv.wait(lock, [&] { return release; });
+        ++async_runs;
+        return handler_result::ok();
+    });
+    router.register_handler("fast", [](const hl7::hl7_message&) {
+        return handler_result::ok();
+    });
+
+    auto async_route = route_builder::create("audit")
+                           .match_type("ADT")
+                           .handler("slow")
+                           .execution(execution_policy::async)
+                           .build();
+    auto sync_route = route_builder::create("main")
+                          .match_type("ADT")
+                          .handler("fast")
+                          .build();
+    TEST_ASSERT(router.add_route(async_route).has_value(), "Async route added");
+    TEST_ASSERT(router.add_route(sync_route).has_value(), "Sync route added");
+
+    auto deferred = router.route_deferred(parse_message(SAMPLE_ADT_A01));
+    TEST_ASSERT(deferred.result.has_value(), "Routing should succeed");
+    TEST_ASSERT(async_runs == 0, "Async chain should not have finished yet");
+    TEST_ASSERT(deferred.completion.valid(), "Completion future should be valid");
+
+    {
+        std::lock_guard lock(mutex);
+        release = true;
+    }
+    cv.notify_all();
+
+    auto completion = deferred.completion.get();
+    TEST_ASSERT(completion.has_value(), "Async chain should succeed");
+    TEST_ASSERT(async_runs == 1, "Async chain should run once");
+    TEST_ASSERT(router.get_statistics().async_chains == 1,
+                "Async chain should be counted");
+
+    pool->shutdown();
+    return true;
+}
+
+bool test_async_route_reports_failure() {
+    message_router router;  // No pool: async chains run inline
+    router.register_handler("bad", [](const hl7::hl7_message&) {
+        return handler_result::error("boom");
+    });
+    auto r = route_builder::create("audit")
+                 .match_type("ADT")
+                 .handler("bad")
+                 .execution(execution_policy::async)
+                 .build();
+    (void)router.add_route(r);
+
+    auto deferred = router.route_deferred(parse_message(SAMPLE_ADT_A01));
+    TEST_ASSERT(deferred.result.has_value(),
+                "Async failures should not fail the routing call");
+    auto completion = deferred.completion.get();
+    TEST_ASSERT(!completion.has_value(), "Completion should carry the failure");
+    TEST_ASSERT(completion.error() == router_error::handler_error,
+                "Failure should be a handler error");
+    TEST_ASSERT(router.get_statistics().handler_errors == 1,
+                "Handler error should be counted");
+    return true;
+}
+
+bool test_async_route_with_stopped_pool() {
+    auto pool = make_pool();
+    TEST_ASSERT(pool != nullptr, "Worker pool should initialize");
+
+    message_router router;
+    router.set_worker_pool(pool);
+    pool->shutdown();  // Stopped pool: the chain must still run
+
+    std::atomic<int> async_runs{0};
+    router.register_handler("audit", [&async_runs](const hl7::hl7_message&) {
+        ++async_runs;
+        return handler_result::ok();
+    });
+    (void)router.add_route(route_builder::create("audit")
+                               .match_type("ADT")
+                               .handler("audit")
+                               .execution(execution_policy::async)
+                               .build());
+
+    auto deferred = router.route_deferred(parse_message(SAMPLE_ADT_A01));
+    TEST_ASSERT(deferred.result.has_value(), "Routing should succeed");
+    TEST_ASSERT(deferred.completion.wait_for(std::chrono::seconds(5)) ==
+                    std::future_status::ready,
+                "Completion should not hang");
+    TEST_ASSERT(deferred.completion.get().has_value(), "Async chain should succeed");
+    TEST_ASSERT(async_runs == 1, "Async chain should run once");
+    return true;
+}
+
+bool test_parallel_routes_run_concurrently() {
+    auto pool = make_pool();
+    TEST_ASSERT(pool != nullptr, "Worker pool should initialize");
+
+    message_router router;
+    router.set_worker_pool(pool);
+
+    // Each handler waits for the other; only concurrent execution completes
+    std::mutex mutex;
+    std::condition_variable cv;
+    int arrived = 0;
+    auto rendezvous = [&](const hl7::hl7_message&) {
+        std::unique_lock lock(mutex);
+        ++arrived;
+        cv.notify_all();
+        bool met = cv.wait_for(lock, std::chrono::seconds(5),
+                               [&] { return arrived >= 2; });
+        return met ? handler_result::ok() : handler_result::error("not parallel");
+    };
+    router.register_handler("a", rendezvous);
+    router.register_handler("b", [&](const hl7::hl7_message& msg) {
+        auto result = rendezvous(msg);
+        result.response = msg;
+        return result;
+    });
+
+    (void)router.add_route(route_builder::create("pa")
+                               .match_type("ADT")
+                               .handler("a")
+                               .execution(execution_policy::parallel)
+                               .build());
+    (void)router.add_route(route_builder::create("pb")
+                               .match_type("ADT")
+                               .handler("b")
+                               .execution(execution_policy::parallel)
+                               .build());
+
+    auto result = router.route(parse_message(SAMPLE_ADT_A01));
+    TEST_ASSERT(result.has_value(), "Parallel routes should both succeed");
+    TEST_ASSERT(result->response.has_value(),
+                "Response from a parallel chain should be returned");
+
+    auto stats = router.get_statistics();
+    TEST_ASSERT(stats.route_matches["pa"] == 1 && stats.route_matches["pb"] == 1,
+                "Both parallel routes should match");
+
+    pool->shutdown();
+    return true;
+}
+
+bool test_parallel_route_error_fails_routing() {
+    message_router router;  // No pool: parallel chains run on the caller
+    std::atomic<int> runs{0};
+    router.register_handler("ok", [&](const hl7::hl7_message&) {
+        ++runs;
+        return handler_result::ok();
+    });
+    router.register_handler("bad", [&](const hl7::hl7_message&) {
+        ++runs;
+        return handler_result::error("boom");
+    });
+
+    (void)router.add_route(route_builder::create("p1")
+                               .match_type("ADT")
+                               .handler("bad")
+                               .execution(execution_policy::parallel)
+                               .build());
+    (void)router.add_route(route_builder::create("p2")
+                               .match_type("ADT")
+                               .handler("ok")
+                               .execution(execution_policy::parallel)
+                               .build());
+
+    auto result = router.route(parse_message(SAMPLE_ADT_A01));
+    TEST_ASSERT(!result.has_value(), "A failed parallel chain fails routing");
+    TEST_ASSERT(result.error() == router_error::handler_error,
+                "Failure should be a handler error");
+    TEST_ASSERT(runs == 2, "Every parallel chain should still run");
+    return true;
+}
+
+bool test_route_builder_execution_policy() {
+    auto r = route_builder::create("test").match_type("ADT").build();
+    TEST_ASSERT(r.execution == execution_policy::sequential,
+                "Routes should default to sequential execution");
+
+    r = route_builder::create("test")
+            .match_type("ADT")
+            .execution(execution_policy::parallel)
+            .build();
+    TEST_ASSERT(r.execution == execution_policy::parallel,
+                "Builder should set the execution policy");
+    TEST_ASSERT(std::string(to_string(execution_policy::async)) == "async",
+                "Policy names should be stable");
+    return true;
+}
+
+// =============================================================================
+// Lazy View Routing Tests
+// =============================================================================
+
+bool test_view_routing_without_materialization() {
+    message_router router;
+
+    std::string seen_control_id;
+    router.register_view_handler(
+        "adt_view", [&seen_control_id](const hl7::hl7_flat_message& msg) {
+            seen_control_id = std::string(msg.control_id());
+            return handler_result::ok();
+        });
+
+    route r;
+    r.id = "adt_route";
+    r.pattern = message_pattern::for_type_trigger("ADT", "A01");
+    r.handler_ids = {"adt_view"};
+    (void)router.add_route(r);
+
+    auto view = hl7::hl7_flat_message::parse(SAMPLE_ADT_A01);
+    TEST_ASSERT(view.has_value(), "View should parse");
+
+    auto result = router.route(*view);
+    TEST_ASSERT(result.has_value(), "Routing should succeed");
+    TEST_ASSERT(result->success, "Result should be successful");
+    TEST_ASSERT(seen_control_id == "MSG001", "View handler should see message");
+
+    auto stats = router.get_statistics();
+    TEST_ASSERT(stats.matched_messages == 1, "Should count match");
+    TEST_ASSERT(stats.materialized_messages == 0,
+                "View handler should not materialize");
+
+    return true;
+}
+
+bool test_view_routing_materializes_once() {
+    message_router router;
+
+    int view_calls = 0;
+    int message_calls = 0;
+    router.register_view_handler("view", [&view_calls](const hl7::hl7_flat_message&) {
+        view_calls++;
+        return handler_result::ok();
+    });
+    router.register_handler("first", [&message_calls](const hl7::hl7_message&) {
+        message_calls++;
+        return handler_result::ok();
+    });
+    router.register_handler("second", [&message_calls](const hl7::hl7_message&) {
+        message_calls++;
+        return handler_result::ok();
+    });
+
+    route r;
+    r.id = "mixed_route";
+    r.pattern = message_pattern::for_type("ADT");
+    r.handler_ids = {"view", "first", "second"};
+    r.filter = [](const hl7::hl7_message& msg) {
+        return msg.get_value("PID.3") == "12345";
+    };
+    (void)router.add_route(r);
+
+    auto view = hl7::hl7_flat_message::parse(SAMPLE_ADT_A01);
+    TEST_ASSERT(view.has_value(), "View should parse");
+
+    auto result = router.route(*view);
+    TEST_ASSERT(result.has_value(), "Routing should succeed");
+    TEST_ASSERT(view_calls == 1, "View handler should be called");
+    TEST_ASSERT(message_calls == 2, "Message handlers should be called");
+    TEST_ASSERT(router.get_statistics().materialized_messages == 1,
+                "Filter and handlers should share one materialization");
+
+    return true;
+}
+
+bool test_view_handler_on_parsed_message() {
+    message_router router;
+
+    std::string seen_patient;
+    router.register_view_handler(
+        "view", [&seen_patient](const hl7::hl7_flat_message& msg) {
+            seen_patient = msg.get_value("PID.3");
+            return handler_result::ok();
+        });
+    (void)router.add_route(
+        route_builder::create("all").match_any().handler("view").build());
+
+    auto result = router.route(parse_message(SAMPLE_ORM_O01));
+    TEST_ASSERT(result.has_value(), "Routing should succeed");
+    TEST_ASSERT(seen_patient == "12345", "View handler should see message");
+    TEST_ASSERT(router.get_statistics().materialized_messages == 0,
+                "Parsed input is not counted as materialized");
+
+    return true;
+}
+
+bool test_mllp_routing_modes_agree() {
+    auto run = [](hl7::hl7_ingestion_mode mode, std::string& trace) {
+        message_router router;
+        router.register_handler("adt", [&trace](const hl7::hl7_message& msg) {
+            trace += "adt:" + std::string(msg.control_id()) + ";";
+            return handler_result::ok();
+        });
+        router.register_view_handler("orm", [&trace](const hl7::hl7_flat_message& msg) {
+            trace += "orm:" + std::string(msg.control_id()) + ";";
+            return handler_result::ok();
+        });
+        (void)router.add_route(route_builder::create("adt_route")
+                                   .match_type("ADT")
+                                   .handler("adt")
+                                   .build());
+        (void)router.add_route(route_builder::create("orm_route")
+                                   .match_type("ORM")
+                                   .handler("orm")
+                                   .build());
+
+        bool ok = true;
+        for (const auto* raw : {&SAMPLE_ADT_A01, &SAMPLE_ORM_O01, &SAMPLE_ORU_R01}) {
+            auto result = router.route(mllp::mllp_message::from_string(*raw), mode);
+            ok = ok && (result.has_value() == (raw != &SAMPLE_ORU_R01));
+        }
+        return ok;
+    };
+
+    std::string parsed_trace;
+    std::string lazy_trace;
+    TEST_ASSERT(run(hl7::hl7_ingestion_mode::parsed, parsed_trace),
+                "Parsed mode routing should match expectations");
+    TEST_ASSERT(run(hl7::hl7_ingestion_mode::lazy_view, lazy_trace),
+                "Lazy mode routing should match expectations");
+    TEST_ASSERT(parsed_trace == "adt:MSG001;orm:MSG003;",
+                "Parsed mode should call both handlers");
+    TEST_ASSERT(lazy_trace == parsed_trace, "Both modes should agree");
+
+    return true;
+}
+
+bool test_mllp_routing_invalid_message() {
+    message_router router;
+    router.set_default_handler([](const hl7::hl7_message&) {
+        return handler_result::ok();
+    });
+
+    auto bad = mllp::mllp_message::from_string("PID|1||12345\r");
+    for (auto mode : {hl7::hl7_ingestion_mode::parsed,
+                      hl7::hl7_ingestion_mode::lazy_view}) {
+        auto result = router.route(bad, mode);
+        TEST_ASSERT(!result.has_value(), "Invalid message should fail");
+        TEST_ASSERT(result.error() == router_error::invalid_message,
+                    "Error should be invalid_message");
+    }
+
+    return true;
+}
+
+bool test_view_routing_unconvertible_message() {
+    message_router router;
+
+    int view_calls = 0;
+    int message_calls = 0;
+    router.register_view_handler("view", [&view_calls](const hl7::hl7_flat_message&) {
+        view_calls++;
+        return handler_result::ok();
+    });
+    router.register_handler("message", [&message_calls](const hl7::hl7_message&) {
+        message_calls++;
+        return handler_result::ok();
+    });
+    (void)router.add_route(route_builder::create("mixed")
+                               .match_any()
+                               .handler("view")
+                               .handler("message")
+                               .build());
+
+    // An empty view cannot be materialized into an hl7_message
+    hl7::hl7_flat_message empty;
+    auto result = router.route(empty);
+    TEST_ASSERT(!result.has_value(), "Routing should fail");
+    TEST_ASSERT(result.error() == router_error::invalid_message,
+                "Error should be invalid_message");
+    TEST_ASSERT(view_calls == 0 && message_calls == 0,
+                "No handler in the chain should run");
+
+    message_router fallback;
+    fallback.set_default_handler([&message_calls](const hl7::hl7_message&) {
+        message_calls++;
+        return handler_result::ok();
+    });
+    result = fallback.route(empty);
+    TEST_ASSERT(!result.has_value() && result.error() == router_error::invalid_message,
+                "Default handler should not see an unconvertible message");
+    TEST_ASSERT(message_calls == 0, "Default handler should not run");
+
+    return true;
+}
+
+bool test_view_handler_id_conflicts() {
+    message_router router;
+
+    TEST_ASSERT(router.register_handler("h", [](const hl7::hl7_message&) {
+        return handler_result::ok();
+    }), "Message handler should register");
+    TEST_ASSERT(!router.register_view_handler("h", [](const hl7::hl7_flat_message&) {
+        return handler_result::ok();
+    }), "View handler with taken ID should be rejected");
+    TEST_ASSERT(router.register_view_handler("v", [](const hl7::hl7_flat_message&) {
+        return handler_result::ok();
+    }), "View handler should register");
+    TEST_ASSERT(!router.register_handler("v", [](const hl7::hl7_message&) {
+        return handler_result::ok();
+    }), "Message handler with taken ID should be rejected");
+
+    TEST_ASSERT(router.handler_ids().size() == 2, "Should list both handlers");
+    TEST_ASSERT(router.unregister_handler("v"), "Should unregister view handler");
+    TEST_ASSERT(router.handler_ids().size() == 1, "One handler should remain");
+
+    return true;
+}
+
 // =============================================================================
 // Route Builder Tests
 // =============================================================================
@@ -939,17 +1598,41 @@ int run_all_tests() {
     RUN_TEST(test_routing_priority);
     RUN_TEST(test_routing_terminal_route);
     RUN_TEST(test_routing_find_matching_routes);
+    RUN_TEST(test_routing_mixed_patterns_keep_priority);
+    RUN_TEST(test_route_invalid_regex_rejected);
 
     std::cout << "\n=== Statistics Tests ===" << std::endl;
     RUN_TEST(test_router_statistics);
     RUN_TEST(test_router_statistics_reset);
 
+    std::cout << "\n=== Concurrency Tests ===" << std::endl;
+    RUN_TEST(test_routing_handlers_run_concurrently);
+    RUN_TEST(test_handler_may_reconfigure_router);
+    RUN_TEST(test_routing_during_reconfiguration);
+
+    std::cout << "\n=== Execution Policy Tests ===" << std::endl;
+    RUN_TEST(test_async_route_does_not_block);
+    RUN_TEST(test_async_route_reports_failure);
+    RUN_TEST(test_async_route_with_stopped_pool);
+    RUN_TEST(test_parallel_routes_run_concurrently);
+    RUN_TEST(test_parallel_route_error_fails_routing);
+
+    std::cout << "\n=== Lazy View Routing Tests ===" << std::endl;
+    RUN_TEST(test_view_routing_without_materialization);
+    RUN_TEST(test_view_routing_materializes_once);
+    RUN_TEST(test_view_handler_on_parsed_message);
+    RUN_TEST(test_mllp_routing_modes_agree);
+    RUN_TEST(test_mllp_routing_invalid_message);
+    RUN_TEST(test_view_routing_unconvertible_message);
+    RUN_TEST(test_view_handler_id_conflicts);
+
     std::cout << "\n=== Route Builder Tests ===" << std::endl;
     RUN_TEST(test_route_builder_basic);
     RUN_TEST(test_route_builder_sender_receiver);
     RUN_TEST(test_route_builder_options);
     RUN_TEST(test_route_builder_filter);
     RUN_TEST(test_route_builder_multiple_handlers);
+    RUN_TEST(test_route_builder_execution_policy);
 
     std::cout << "\n=== Test Summary ===" << std::endl;
     std::cout << "Passed: " << passed << std::endl;
@@ -16,9 +16,12 @@
 
 #include <cassert>
 #include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace pacs::bridge::security::test {
 
@@ -341,6 +344,96 @@ bool test_log_sanitizer_masking_styles() {
     return true;
 }
 
+bool test_log_sanitizer_hl7_field_positions() {
+    healthcare_log_sanitizer sanitizer;
+
+    std::string hl7 =
+        "MSH|^~\\&|HIS|HOSPITAL|PACS|RADIOLOGY|20240101||ADT^A01|MSG001|P|2.4\r"
+        "PID|1||MRN123||Doe^John||19800101|M|||123 Main St^^Springfield||"
+        "555-1234|||||ACC99|123-45-6789\r"
+        "PV1|1|I|WARD^101";
+
+    auto result = sanitizer.sanitize_hl7(hl7);
+
+    TEST_ASSERT(result ==
+                    "MSH|^~\\&|HIS|HOSPITAL|PACS|RADIOLOGY|20240101||ADT^A01|MSG001|P|2.4\r"
+                    "PID|1||[PATIENT_ID]||[PATIENT_NAME]||[DOB]|M|||[ADDRESS]||"
+                    "[PHONE]|||||[ACCOUNT]|[SSN]\r"
+                    "PV1|1|I|WARD^101",
+                "PID fields should be masked by position, everything else kept");
+
+    auto detections = sanitizer.detect_phi(hl7);
+    bool found_ssn = false;
+    for (const auto& detection : detections) {
+        if (detection.type == phi_field_type::ssn && detection.segment == "PID") {
+            found_ssn = detection.field_number == 19 &&
+                        hl7.substr(detection.position, detection.length) == "123-45-6789";
+        }
+    }
+    TEST_ASSERT(found_ssn, "PID-19 should be detected with its position");
+
+    return true;
+}
+
+bool test_log_sanitizer_hl7_config() {
+    healthcare_sanitization_config config;
+    config.fields_to_sanitize = {phi_field_type::patient_name};
+    config.phi_segments = {"PID", "ZPI"};
+    config.sanitize_control_id = true;
+    config.style = masking_style::asterisks;
+    healthcare_log_sanitizer sanitizer(config);
+
+    // Non-default field separator comes from MSH
+    std::string hl7 =
+        "MSH#^~\\&#HIS#HOSPITAL#PACS#RADIOLOGY#20240101##ADT^A01#MSG001#P#2.4\n"
+        "PID#1##MRN123##Doe^John##19800101\n"
+        "ZPI#1#SECRET";
+
+    auto result = sanitizer.sanitize_hl7(hl7);
+
+    TEST_ASSERT(result ==
+                    "MSH#^~\\&#HIS#HOSPITAL#PACS#RADIOLOGY#20240101##ADT^A01#******#P#2.4\n"
+                    "PID#1##MRN123##********##19800101\n"
+                    "ZPI#*#******",
+                "Only enabled fields, MSH-10 and unmapped segments should be masked");
+
+    return true;
+}
+
+bool test_log_sanitizer_free_text_recognizers() {
+    healthcare_log_sanitizer sanitizer;
+
+    TEST_ASSERT(sanitizer.sanitize("Patient MRN: A12345 admitted") ==
+                    "Patient MRN=[PATIENT_ID] admitted",
+                "MRN keyword should be kept and the ID masked");
+    TEST_ASSERT(sanitizer.sanitize("born 19800101, lives at 42 Elm Street") ==
+                    "born [DOB], lives at [ADDRESS]",
+                "DOB and street address should be masked");
+    TEST_ASSERT(sanitizer.sanitize("call +1 555.123.4567 or mail j.doe@mail.example.org.") ==
+                    "call [PHONE] or mail [EMAIL].",
+                "Phone with country code and email should be masked");
+    TEST_ASSERT(sanitizer.sanitize("seg |Doe^John^A|Roe^Jane|") ==
+                    "seg |[PATIENT_NAME]^A|[PATIENT_NAME]|",
+                "Adjacent HL7 names should both be masked");
+    TEST_ASSERT(sanitizer.sanitize("order 1234567890123 took 250 ms") ==
+                    "order 1234567890123 took 250 ms",
+                "Numbers without a PHI shape should be kept");
+
+    // Embedded HL7 segment in a log line is masked by position
+    auto logged = sanitizer.sanitize("Received:\rPID|1||X7||Doe^John");
+    TEST_ASSERT(logged == "Received:\rPID|1||[PATIENT_ID]||[PATIENT_NAME]",
+                "HL7 segments inside log text should be masked by position");
+
+    // Disabled types are not redacted
+    healthcare_sanitization_config config;
+    config.fields_to_sanitize = {phi_field_type::email};
+    sanitizer.set_config(config);
+    TEST_ASSERT(sanitizer.sanitize("SSN 123-45-6789 a@b.io") == "SSN 123-45-6789 [EMAIL]",
+                "Only configured types should be redacted");
+
+    return true;
+}
+
 bool test_safe_hl7_summary() {
     std::string hl7 =
         "MSH|^~\\&|SENDER|FACILITY|RECEIVER|FAC|20240101||ADT^A01|MSG001|P|2.4";
@@ -438,6 +531,169 @@ bool test_audit_event_serialization() {
     return true;
 }
 
+bool test_audit_event_json_format() {
+    healthcare_audit_event_record event;
+    event.timestamp = std::chrono::system_clock::time_point{std::chrono::seconds{1700000000}};
+    event.event_id = "EVT001";
+    event.category = healthcare_audit_category::hl7_transaction;
+    event.type = healthcare_audit_event::hl7_message_processed;
+    event.description = "tab\there \"quoted\" \x01";
+    event.session_id = 42;
+    event.outcome = "success";
+    event.processing_time_ms = 15.5;
+
+    TEST_ASSERT(event.to_json() ==
+                    "{\"timestamp\":\"2023-11-14T22:13:20Z\",\"event_id\":\"EVT001\","
+                    "\"category\":\"hl7_transaction\",\"event\":\"hl7_message_processed\","
+                    "\"severity\":\"info\","
+                    "\"description\":\"tab\\there \\\"quoted\\\" \\u0001\","
+                    "\"session_id\":42,\"outcome\":\"success\","
+                    "\"processing_time_ms\":15.500}",
+                "JSON layout and escaping should be stable");
+
+    return true;
+}
+
+namespace {
+
+std::vector<std::string> read_lines(const std::filesystem::path& path) {
+    std::vector<std::string> lines;
+    std::ifstream file(path);
+    for (std::string line; std::getline(file, line);) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+std::filesystem::path fresh_audit_dir(const std::string& name) {
+    auto dir = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(dir);
+    return dir;
+}
+
+}  // namespace
+
+bool test_audit_logger_async_writes() {
+    auto dir = fresh_audit_dir("pacs_bridge_audit_async");
+
+    healthcare_audit_config config;
+    config.log_path = dir / "audit.log";
+    config.async_writes = true;
+    config.async_queue_capacity = 64;  // small enough to make producers wait
+    config.flush_interval = std::chrono::milliseconds{5};
+    config.durability = audit_durability::data_sync;
+    healthcare_audit_logger logger(config);
+    TEST_ASSERT(logger.start(), "Async logger should start");
+
+    constexpr int threads = 4;
+    constexpr int per_thread = 500;
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threads; ++t) {
+        producers.emplace_back([&logger, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                logger.log_hl7_received("ADT^A01", "MSG" + std::to_string(t * per_thread + i),
+                                        "SENDER", 1024, static_cast<uint64_t>(t));
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    logger.flush();
+
+    auto lines = read_lines(config.log_path);
+    TEST_ASSERT(lines.size() == threads * per_thread,
+                "Every event should be written after flush()");
+    for (const auto& line : lines) {
+        TEST_ASSERT(line.front() == '{' && line.back() == '}',
+                    "Each line should be one JSON object");
+    }
+
+    auto stats = logger.get_statistics();
+    TEST_ASSERT(stats.events_logged == threads * per_thread, "All events counted");
+    TEST_ASSERT(stats.hl7_transactions == threads * per_thread, "Category counted");
+    TEST_ASSERT(stats.batches_written < stats.events_logged, "Events should be batched");
+
+    // Events logged after flush are written by stop()
+    logger.log_system_stop("test");
+    logger.stop();
+    TEST_ASSERT(read_lines(config.log_path).size() == threads * per_thread + 1,
+                "stop() should drain the queue");
+
+    std::filesystem::remove_all(dir);
+    return true;
+}
+
+bool test_audit_logger_rotation() {
+    auto dir = fresh_audit_dir("pacs_bridge_audit_rotation");
+
+    healthcare_audit_config config;
+    config.log_path = dir / "audit.log";
+    config.max_file_size = 4096;
+    config.max_rotated_files = 2;
+    config.prune_rotated_files = true;
+    config.retention_period = std::chrono::hours{0};
+    healthcare_audit_logger logger(config);
+    TEST_ASSERT(logger.start(), "Logger should start");
+
+    for (int i = 0; i < 200; ++i) {
+        logger.log_connection_closed(static_cast<uint64_t>(i), "normal");
+    }
+
+    auto rotated1 = config.log_path;
+    rotated1 += ".1";
+    auto rotated2 = config.log_path;
+    rotated2 += ".2";
+    auto rotated3 = config.log_path;
+    rotated3 += ".3";
+
+    TEST_ASSERT(std::filesystem::exists(rotated1), "First rotated file should exist");
+    TEST_ASSERT(std::filesystem::exists(rotated2), "Second rotated file should exist");
+    TEST_ASSERT(!std::filesystem::exists(rotated3),
+                "No more than max_rotated_files should be kept");
+    TEST_ASSERT(std::filesystem::file_size(config.log_path) <= config.max_file_size,
+                "Current file should stay within max_file_size");
+    TEST_ASSERT(std::filesystem::file_size(rotated1) <= config.max_file_size,
+                "Rotated file should stay within max_file_size");
+    TEST_ASSERT(logger.get_statistics().rotations > 2, "Rotations should be counted");
+
+    logger.stop();
+    std::filesystem::remove_all(dir);
+    return true;
+}
+
+bool test_audit_logger_rotation_keeps_files_by_default() {
+    auto dir = fresh_audit_dir("pacs_bridge_audit_rotation_keep");
+
+    healthcare_audit_config config;
+    config.log_path = dir / "audit.log";
+    config.max_file_size = 4096;
+    config.max_rotated_files = 0;
+    healthcare_audit_logger logger(config);
+    TEST_ASSERT(logger.start(), "Logger should start");
+
+    for (int i = 0; i < 200; ++i) {
+        logger.log_connection_closed(static_cast<uint64_t>(i), "normal");
+    }
+    logger.stop();
+
+    auto rotations = logger.get_statistics().rotations;
+    TEST_ASSERT(rotations > 2, "Rotations should be counted");
+
+    size_t lines = read_lines(config.log_path).size();
+    for (size_t n = 1; n <= rotations; ++n) {
+        auto rotated = config.log_path;
+        rotated += "." + std::to_string(n);
+        TEST_ASSERT(std::filesystem::exists(rotated),
+                    "Rotated files should be kept unless pruning is enabled");
+        lines += read_lines(rotated).size();
+    }
+    TEST_ASSERT(lines >= 200, "No audit event should be lost to rotation");
+
+    std::filesystem::remove_all(dir);
+    return true;
+}
+
 bool test_audit_logger_hl7_transaction() {
     healthcare_audit_config config;
     config.enabled = false;  // Disable actual file logging for test
@@ -778,6 +1034,9 @@ int run_all_tests() {
     RUN_TEST(test_log_sanitizer_contains_phi);
     RUN_TEST(test_log_sanitizer_custom_pattern);
     RUN_TEST(test_log_sanitizer_masking_styles);
+    RUN_TEST(test_log_sanitizer_hl7_field_positions);
+    RUN_TEST(test_log_sanitizer_hl7_config);
+    RUN_TEST(test_log_sanitizer_free_text_recognizers);
     RUN_TEST(test_safe_hl7_summary);
     RUN_TEST(test_safe_session_desc);
 
@@ -785,6 +1044,10 @@ int run_all_tests() {
     RUN_TEST(test_audit_event_record_structure);
     RUN_TEST(test_audit_event_builder);
     RUN_TEST(test_audit_event_serialization);
+    RUN_TEST(test_audit_event_json_format);
+    RUN_TEST(test_audit_logger_async_writes);
+    RUN_TEST(test_audit_logger_rotation);
+    RUN_TEST(test_audit_logger_rotation_keeps_files_by_default);
     RUN_TEST(test_audit_logger_hl7_transaction);
     RUN_TEST(test_audit_logger_security_event);
     RUN_TEST(test_audit_logger_system_events);
@@ -271,6 +271,18 @@ TEST_F(ThreadAdapterShutdownTest, DoubleShutdown) {
     EXPECT_FALSE(adapter_->is_running());
 }
 
+TEST_F(ThreadAdapterShutdownTest, SubmitAfterShutdownIsRejected) {
+    adapter_->shutdown(true);
+
+    bool ran = false;
+    EXPECT_FALSE(adapter_->try_submit([&ran] { ran = true; }));
+
+    auto future = adapter_->submit([] { return 42; });
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_THROW(future.get(), std::runtime_error);
+    EXPECT_FALSE(ran);
+}
+
 // =============================================================================
 // Stress Tests
 // =============================================================================